@@ -22,15 +22,24 @@
 
 namespace archival {
 
+model::offset upload_candidate::last_included_offset() const {
+    if (!tail_sources.empty()) {
+        return tail_sources.back()->offsets().committed_offset;
+    }
+    return source->offsets().committed_offset;
+}
+
 std::ostream& operator<<(std::ostream& s, const upload_candidate& c) {
     s << "{ exposed_name: " << c.exposed_name
       << ", starting_offset: " << c.starting_offset
-      << ", segment_file_name: " << c.source->reader().filename() << " }";
+      << ", segment_file_name: " << c.source->reader().filename()
+      << ", coalesced_segments: " << c.tail_sources.size() << " }";
     return s;
 }
 
-archival_policy::archival_policy(model::ntp ntp)
-  : _ntp(std::move(ntp)) {}
+archival_policy::archival_policy(model::ntp ntp, size_t min_upload_size)
+  : _ntp(std::move(ntp))
+  , _min_upload_size(min_upload_size) {}
 
 archival_policy::lookup_result archival_policy::find_segment(
   model::offset last_offset, storage::log_manager& lm) {
@@ -91,7 +100,7 @@ archival_policy::lookup_result archival_policy::find_segment(
           _ntp);
         return {};
     }
-    return {.segment = *it, .ntp_conf = &ntp_conf};
+    return {.segment = *it, .ntp_conf = &ntp_conf, .segments = &set};
 }
 
 /// \brief Initializes upload_candidate structure taking into account
@@ -167,9 +176,38 @@ static upload_candidate create_upload_candidate(
       .content_length = clen};
 }
 
+void archival_policy::coalesce(
+  upload_candidate& candidate, const storage::segment_set& set) {
+    auto prev_committed = candidate.source->offsets().committed_offset;
+    auto it = set.lower_bound(prev_committed + model::offset(1));
+    while (it != set.end() && candidate.content_length < _min_upload_size) {
+        const auto& sg = *it;
+        if (
+          sg->has_appender() || sg->is_compacted_segment()
+          || sg->offsets().base_offset != prev_committed + model::offset(1)) {
+            // Only closed, non-compacted segments that follow the
+            // previous one without a gap can be uploaded as one object.
+            // An offset gap would make the object unparsable after the
+            // point where the gap is.
+            break;
+        }
+        vlog(
+          archival_log.debug,
+          "Coalescing segment {} into upload {}, length {} -> {}",
+          sg->reader().filename(),
+          candidate.exposed_name,
+          candidate.content_length,
+          candidate.content_length + sg->reader().file_size());
+        candidate.content_length += sg->reader().file_size();
+        prev_committed = sg->offsets().committed_offset;
+        candidate.tail_sources.push_back(sg);
+        it++;
+    }
+}
+
 upload_candidate archival_policy::get_next_candidate(
   model::offset last_offset, storage::log_manager& lm) {
-    auto [segment, ntp_conf] = find_segment(last_offset, lm);
+    auto [segment, ntp_conf, segments] = find_segment(last_offset, lm);
     if (segment.get() == nullptr || ntp_conf == nullptr) {
         return {};
     }
@@ -177,7 +215,12 @@ upload_candidate archival_policy::get_next_candidate(
     // false)
     auto end = segment->offsets().committed_offset;
     if (end > last_offset) {
-        return create_upload_candidate(last_offset, segment, ntp_conf);
+        auto candidate = create_upload_candidate(
+          last_offset, segment, ntp_conf);
+        if (_min_upload_size != 0) {
+            coalesce(candidate, *segments);
+        }
+        return candidate;
     }
     return {};
 }
@@ -24,6 +24,12 @@ struct upload_candidate {
     model::offset starting_offset;
     size_t file_offset;
     size_t content_length;
+    /// Small adjacent segments that are uploaded together with 'source'
+    /// as one object, in offset order. 'content_length' covers them.
+    std::vector<ss::lw_shared_ptr<storage::segment>> tail_sources{};
+
+    /// Committed offset of the last segment included in the upload
+    model::offset last_included_offset() const;
 };
 
 std::ostream& operator<<(std::ostream& s, const upload_candidate& c);
@@ -35,7 +41,12 @@ std::ostream& operator<<(std::ostream& s, const upload_candidate& c);
 /// but uses ntp as a key to extract the data when needed.
 class archival_policy {
 public:
-    explicit archival_policy(model::ntp ntp);
+    /// \param ntp is an ntp the policy is responsible for
+    /// \param min_upload_size is a desired lower bound on the size of the
+    ///        uploaded object, consecutive small segments are coalesced
+    ///        into one upload candidate to reach it (0 disables
+    ///        coalescing)
+    explicit archival_policy(model::ntp ntp, size_t min_upload_size = 0);
 
     /// \brief regurn next upload candidate
     ///
@@ -53,12 +64,19 @@ private:
     struct lookup_result {
         ss::lw_shared_ptr<storage::segment> segment;
         const storage::ntp_config* ntp_conf;
+        const storage::segment_set* segments;
     };
 
     lookup_result
     find_segment(model::offset last_offset, storage::log_manager& lm);
 
+    /// Attach closed adjacent segments to 'candidate' until its content
+    /// length reaches '_min_upload_size'
+    void
+    coalesce(upload_candidate& candidate, const storage::segment_set& set);
+
     model::ntp _ntp;
+    size_t _min_upload_size;
 };
 
 } // namespace archival
\ No newline at end of file
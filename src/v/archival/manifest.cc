@@ -16,9 +16,11 @@
 #include "bytes/iobuf_ostreambuf.h"
 #include "cluster/types.h"
 #include "hashing/xx.h"
+#include "bytes/iobuf_parser.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/timestamp.h"
+#include "reflection/adl.h"
 #include "storage/ntp_config.h"
 #include "vlog.h"
 
@@ -77,6 +79,16 @@ remote_manifest_path manifest::get_manifest_path() const {
     return generate_partition_manifest_path(_ntp, _rev);
 }
 
+remote_manifest_path manifest::get_delta_manifest_path(uint64_t seq) const {
+    // Deltas use the same prefix as the base manifest so they can be
+    // found next to it.
+    constexpr uint32_t bitmask = 0xF0000000;
+    auto path = fmt::format("{}_{}", _ntp.path(), _rev());
+    uint32_t hash = bitmask & xxhash_32(path.data(), path.size());
+    return remote_manifest_path(fmt::format(
+      "{:08x}/meta/{}_{}/manifest.json.{}", hash, _ntp.path(), _rev(), seq));
+}
+
 remote_segment_path
 manifest::get_remote_segment_path(const segment_name& name) const {
     auto path = fmt::format("{}_{}/{}", _ntp.path(), _rev(), name());
@@ -138,11 +150,157 @@ manifest manifest::difference(const manifest& remote_set) const {
     return result;
 }
 
+/*
+ * Binary manifest layout (manifest_version::v3), encoded with
+ * reflection::adl (little endian, fixed width):
+ *
+ *   int32   version
+ *   sstring namespace
+ *   sstring topic
+ *   int32   partition
+ *   int64   revision
+ *   int64   last_offset
+ *   uint32  segment count
+ *   per segment, in segment name order:
+ *     sstring name
+ *     uint8   flags (bit 0: is_compacted, bit 1: is_compressed)
+ *     uint64  size_bytes
+ *     int64   base offset, delta encoded against the previous segment's
+ *             committed offset (absolute for the first segment)
+ *     int64   committed offset, delta encoded against the base offset
+ *     uint32  boundary count, non-zero only for coalesced objects
+ *     per boundary:
+ *       int64   base offset, delta encoded against the segment's base
+ *               offset
+ *       uint64  file offset inside the (uncompressed) object
+ *
+ * manifest_version::v2 is the same layout without the boundary list and
+ * is still accepted on read.
+ *
+ * The json representation always starts with '{' while the binary one
+ * starts with the little endian version number, so the format of a
+ * downloaded manifest is detectable from the first byte.
+ */
+static constexpr uint8_t segment_flag_compacted = 0x01;
+static constexpr uint8_t segment_flag_compressed = 0x02;
+
+static bool is_binary_representation(const iobuf& buf) {
+    if (buf.empty()) {
+        return false;
+    }
+    iobuf_const_parser parser(buf);
+    return parser.consume_type<char>() != '{';
+}
+
+struct binary_manifest_content {
+    model::ntp ntp;
+    model::revision_id rev;
+    model::offset last_offset;
+    manifest::segment_map segments;
+};
+
+static binary_manifest_content parse_binary(iobuf buf) {
+    iobuf_parser parser(std::move(buf));
+    auto version = reflection::adl<int32_t>{}.from(parser);
+    if (
+      version != static_cast<int32_t>(manifest_version::v2)
+      && version != static_cast<int32_t>(manifest_version::v3)) {
+        throw std::runtime_error("manifest version not supported");
+    }
+    auto ns = model::ns(reflection::adl<ss::sstring>{}.from(parser));
+    auto tp = model::topic(reflection::adl<ss::sstring>{}.from(parser));
+    auto pt = model::partition_id(reflection::adl<int32_t>{}.from(parser));
+    auto rev = model::revision_id(reflection::adl<int64_t>{}.from(parser));
+    auto last_offset = model::offset(reflection::adl<int64_t>{}.from(parser));
+    auto count = reflection::adl<uint32_t>{}.from(parser);
+    manifest::segment_map segments;
+    model::offset prev;
+    for (uint32_t i = 0; i < count; i++) {
+        auto name = segment_name(reflection::adl<ss::sstring>{}.from(parser));
+        auto flags = reflection::adl<uint8_t>{}.from(parser);
+        auto size_bytes = reflection::adl<uint64_t>{}.from(parser);
+        auto base = model::offset(
+          prev() + reflection::adl<int64_t>{}.from(parser));
+        auto committed = model::offset(
+          base() + reflection::adl<int64_t>{}.from(parser));
+        manifest::segment_meta meta{
+          .is_compacted = (flags & segment_flag_compacted) != 0,
+          .size_bytes = static_cast<size_t>(size_bytes),
+          .base_offset = base,
+          .committed_offset = committed,
+          .is_compressed = (flags & segment_flag_compressed) != 0,
+        };
+        if (version >= static_cast<int32_t>(manifest_version::v3)) {
+            auto nbounds = reflection::adl<uint32_t>{}.from(parser);
+            meta.segment_boundaries.reserve(nbounds);
+            for (uint32_t j = 0; j < nbounds; j++) {
+                auto bbase = model::offset(
+                  base() + reflection::adl<int64_t>{}.from(parser));
+                auto bpos = reflection::adl<uint64_t>{}.from(parser);
+                meta.segment_boundaries.push_back({
+                  .base_offset = bbase,
+                  .file_offset = static_cast<size_t>(bpos),
+                });
+            }
+        }
+        segments.insert(std::make_pair(std::move(name), meta));
+        prev = committed;
+    }
+    return {
+      .ntp = model::ntp(std::move(ns), std::move(tp), pt),
+      .rev = rev,
+      .last_offset = last_offset,
+      .segments = std::move(segments),
+    };
+}
+
+iobuf manifest::to_binary() const {
+    iobuf out;
+    reflection::serialize(
+      out,
+      static_cast<int32_t>(manifest_version::v3),
+      _ntp.ns()(),
+      _ntp.tp.topic()(),
+      static_cast<int32_t>(_ntp.tp.partition()),
+      static_cast<int64_t>(_rev()),
+      static_cast<int64_t>(_last_offset()),
+      static_cast<uint32_t>(_segments.size()));
+    model::offset prev;
+    for (const auto& [name, meta] : _segments) {
+        uint8_t flags = (meta.is_compacted ? segment_flag_compacted : 0)
+                        | (meta.is_compressed ? segment_flag_compressed : 0);
+        reflection::serialize(
+          out,
+          name(),
+          flags,
+          static_cast<uint64_t>(meta.size_bytes),
+          static_cast<int64_t>(meta.base_offset() - prev()),
+          static_cast<int64_t>(meta.committed_offset() - meta.base_offset()),
+          static_cast<uint32_t>(meta.segment_boundaries.size()));
+        for (const auto& b : meta.segment_boundaries) {
+            reflection::serialize(
+              out,
+              static_cast<int64_t>(b.base_offset() - meta.base_offset()),
+              static_cast<uint64_t>(b.file_offset));
+        }
+        prev = meta.committed_offset;
+    }
+    return out;
+}
+
 ss::future<> manifest::update(ss::input_stream<char>&& is) {
     using namespace rapidjson;
     iobuf result;
     auto os = make_iobuf_ref_output_stream(result);
     co_await ss::copy(is, os);
+    if (is_binary_representation(result)) {
+        auto content = parse_binary(std::move(result));
+        _ntp = std::move(content.ntp);
+        _rev = content.rev;
+        _last_offset = content.last_offset;
+        _segments = std::move(content.segments);
+        co_return;
+    }
     iobuf_istreambuf ibuf(result);
     std::istream stream(&ibuf);
     Document m;
@@ -152,19 +310,8 @@ ss::future<> manifest::update(ss::input_stream<char>&& is) {
     co_return;
 }
 
-void manifest::update(const rapidjson::Document& m) {
-    using namespace rapidjson;
-    auto ver = model::partition_id(m["version"].GetInt());
-    if (ver != static_cast<int>(manifest_version::v1)) {
-        throw std::runtime_error("manifest version not supported");
-    }
-    auto ns = model::ns(m["namespace"].GetString());
-    auto tp = model::topic(m["topic"].GetString());
-    auto pt = model::partition_id(m["partition"].GetInt());
-    _rev = model::revision_id(m["revision"].GetInt());
-    _ntp = model::ntp(ns, tp, pt);
-    _last_offset = model::offset(m["last_offset"].GetInt64());
-    segment_map tmp;
+static manifest::segment_map parse_segments(const rapidjson::Document& m) {
+    manifest::segment_map tmp;
     if (m.HasMember("segments")) {
         const auto& s = m["segments"].GetObject();
         for (auto it = s.MemberBegin(); it != s.MemberEnd(); it++) {
@@ -172,23 +319,87 @@ void manifest::update(const rapidjson::Document& m) {
             auto coffs = it->value["committed_offset"].GetInt64();
             auto boffs = it->value["base_offset"].GetInt64();
             auto size_bytes = it->value["size_bytes"].GetInt64();
-            segment_meta meta{
+            manifest::segment_meta meta{
               .is_compacted = it->value["is_compacted"].GetBool(),
               .size_bytes = static_cast<size_t>(size_bytes),
               .base_offset = model::offset(boffs),
               .committed_offset = model::offset(coffs),
             };
+            // manifests written before upload compression lack the field
+            if (it->value.HasMember("is_compressed")) {
+                meta.is_compressed = it->value["is_compressed"].GetBool();
+            }
+            // only present for coalesced upload objects
+            if (it->value.HasMember("segment_boundaries")) {
+                for (const auto& b :
+                     it->value["segment_boundaries"].GetArray()) {
+                    meta.segment_boundaries.push_back({
+                      .base_offset = model::offset(
+                        b["base_offset"].GetInt64()),
+                      .file_offset = static_cast<size_t>(
+                        b["file_offset"].GetInt64()),
+                    });
+                }
+            }
             tmp.insert(std::make_pair(name, meta));
         }
     }
+    return tmp;
+}
+
+void manifest::update(const rapidjson::Document& m) {
+    using namespace rapidjson;
+    auto ver = model::partition_id(m["version"].GetInt());
+    if (ver != static_cast<int>(manifest_version::v1)) {
+        throw std::runtime_error("manifest version not supported");
+    }
+    auto ns = model::ns(m["namespace"].GetString());
+    auto tp = model::topic(m["topic"].GetString());
+    auto pt = model::partition_id(m["partition"].GetInt());
+    _rev = model::revision_id(m["revision"].GetInt());
+    _ntp = model::ntp(ns, tp, pt);
+    _last_offset = model::offset(m["last_offset"].GetInt64());
+    auto tmp = parse_segments(m);
     std::swap(tmp, _segments);
 }
 
-serialized_json_stream manifest::serialize() const {
-    iobuf serialized;
-    iobuf_ostreambuf obuf(serialized);
-    std::ostream os(&obuf);
-    serialize(os);
+ss::future<> manifest::update_delta(ss::input_stream<char>&& is) {
+    using namespace rapidjson;
+    iobuf result;
+    auto os = make_iobuf_ref_output_stream(result);
+    co_await ss::copy(is, os);
+    if (is_binary_representation(result)) {
+        auto content = parse_binary(std::move(result));
+        for (const auto& [name, meta] : content.segments) {
+            add(name, meta);
+        }
+        _last_offset = std::max(_last_offset, content.last_offset);
+        co_return;
+    }
+    iobuf_istreambuf ibuf(result);
+    std::istream stream(&ibuf);
+    Document m;
+    IStreamWrapper wrapper(stream);
+    m.ParseStream(wrapper);
+    update_delta(m);
+    co_return;
+}
+
+void manifest::update_delta(const rapidjson::Document& m) {
+    using namespace rapidjson;
+    auto ver = model::partition_id(m["version"].GetInt());
+    if (ver != static_cast<int>(manifest_version::v1)) {
+        throw std::runtime_error("manifest version not supported");
+    }
+    auto delta_last_offset = model::offset(m["last_offset"].GetInt64());
+    for (const auto& [name, meta] : parse_segments(m)) {
+        add(name, meta);
+    }
+    _last_offset = std::max(_last_offset, delta_last_offset);
+}
+
+serialized_data_stream manifest::serialize() const {
+    iobuf serialized = to_binary();
     size_t size_bytes = serialized.size_bytes();
     return {
       .stream = make_iobuf_input_stream(std::move(serialized)),
@@ -220,12 +431,27 @@ void manifest::serialize(std::ostream& out) const {
             w.StartObject();
             w.Key("is_compacted");
             w.Bool(meta.is_compacted);
+            w.Key("is_compressed");
+            w.Bool(meta.is_compressed);
             w.Key("size_bytes");
             w.Int64(meta.size_bytes);
             w.Key("committed_offset");
             w.Int64(meta.committed_offset());
             w.Key("base_offset");
             w.Int64(meta.base_offset());
+            if (!meta.segment_boundaries.empty()) {
+                w.Key("segment_boundaries");
+                w.StartArray();
+                for (const auto& b : meta.segment_boundaries) {
+                    w.StartObject();
+                    w.Key("base_offset");
+                    w.Int64(b.base_offset());
+                    w.Key("file_offset");
+                    w.Int64(b.file_offset);
+                    w.EndObject();
+                }
+                w.EndArray();
+            }
             w.EndObject();
         }
         w.EndObject();
@@ -320,7 +546,7 @@ void topic_manifest::update(const rapidjson::Document& m) {
     _rev = model::revision_id(rev);
 }
 
-serialized_json_stream topic_manifest::serialize() const {
+serialized_data_stream topic_manifest::serialize() const {
     iobuf serialized;
     iobuf_ostreambuf obuf(serialized);
     std::ostream os(&obuf);
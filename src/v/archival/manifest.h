@@ -27,10 +27,11 @@
 
 #include <compare>
 #include <iterator>
+#include <vector>
 
 namespace archival {
 
-struct serialized_json_stream {
+struct serialized_data_stream {
     ss::input_stream<char> stream;
     size_t size_bytes;
 };
@@ -39,10 +40,25 @@ struct serialized_json_stream {
 class manifest final {
 public:
     struct segment_meta {
+        /// Location of one source segment inside a coalesced upload
+        /// object; 'file_offset' counts uncompressed bytes
+        struct boundary {
+            model::offset base_offset;
+            size_t file_offset;
+
+            auto operator<=>(const boundary&) const = default;
+        };
+
         bool is_compacted;
         size_t size_bytes;
         model::offset base_offset;
         model::offset committed_offset;
+        /// Segment was compressed with long-range zstd before the upload;
+        /// 'size_bytes' is always the original (uncompressed) size
+        bool is_compressed{false};
+        /// Non-empty when the object is a concatenation of several small
+        /// adjacent segments, one entry per source segment
+        std::vector<boundary> segment_boundaries{};
 
         // bool operator==(const segment_meta& other) const = default;
         // bool operator<(const segment_meta& other) const = default;
@@ -62,6 +78,10 @@ public:
     /// Manifest object name in S3
     remote_manifest_path get_manifest_path() const;
 
+    /// Manifest delta object name in S3, deltas are numbered sequentially
+    /// starting from zero after every compaction into the base manifest
+    remote_manifest_path get_delta_manifest_path(uint64_t seq) const;
+
     /// Segment file name in S3
     remote_segment_path get_remote_segment_path(const segment_name& name) const;
 
@@ -98,15 +118,23 @@ public:
     /// \return manifest with segments that doesn't present in 'remote_set'
     manifest difference(const manifest& remote_set) const;
 
-    /// Update manifest file from input_stream (remote set)
+    /// Update manifest file from input_stream (remote set). Both the
+    /// binary and the legacy json representation are accepted, the format
+    /// is detected from the first byte.
     ss::future<> update(ss::input_stream<char>&& is);
 
+    /// Merge manifest delta from input_stream into this manifest. Unlike
+    /// 'update' the existing segments are kept.
+    ss::future<> update_delta(ss::input_stream<char>&& is);
+
     /// Serialize manifest object
     ///
-    /// \return asynchronous input_stream with the serialized json
-    serialized_json_stream serialize() const;
+    /// \return asynchronous input_stream with the compact binary
+    /// representation that is uploaded to S3
+    serialized_data_stream serialize() const;
 
-    /// Serialize manifest object
+    /// Export manifest as json. Debugging/tooling path, not what is
+    /// uploaded to S3.
     ///
     /// \param out output stream that should be used to output the json
     void serialize(std::ostream& out) const;
@@ -125,6 +153,13 @@ private:
     /// from manifest.json file
     void update(const rapidjson::Document& m);
 
+    /// Merge manifest delta content from json document
+    void update_delta(const rapidjson::Document& m);
+
+    /// Serialize to the compact binary representation
+    /// (manifest_version::v3, see manifest.cc for the layout)
+    iobuf to_binary() const;
+
     model::ntp _ntp;
     model::revision_id _rev;
     segment_map _segments;
@@ -146,7 +181,7 @@ public:
     /// Serialize manifest object
     ///
     /// \return asynchronous input_stream with the serialized json
-    serialized_json_stream serialize() const;
+    serialized_data_stream serialize() const;
 
     /// Serialize manifest object
     ///
@@ -11,6 +11,7 @@
 #include "archival/ntp_archiver_service.h"
 
 #include "archival/logger.h"
+#include "compression/stream_zstd.h"
 #include "model/metadata.h"
 #include "s3/client.h"
 #include "s3/error.h"
@@ -20,6 +21,7 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/file.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/semaphore.hh>
@@ -29,7 +31,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <exception>
+#include <memory>
 #include <stdexcept>
 
 namespace archival {
@@ -38,23 +42,41 @@ std::ostream& operator<<(std::ostream& o, const configuration& cfg) {
     fmt::print(
       o,
       "{{bucket_name: {}, interval: {}, client_config: {}, connection_limit: "
-      "{}}}",
+      "{}, upload_part_size: {}, part_upload_limit: {}, "
+      "segment_upload_concurrency: {}, read_cache_size: {}, "
+      "min_object_size: {}, "
+      "compress_uploads: {}, compression_window_log: {}}}",
       cfg.bucket_name,
       cfg.interval.count(),
       cfg.client_config,
-      cfg.connection_limit);
+      cfg.connection_limit,
+      cfg.upload_part_size,
+      cfg.part_upload_limit,
+      cfg.segment_upload_concurrency,
+      cfg.read_cache_size,
+      cfg.min_object_size,
+      cfg.compress_uploads,
+      cfg.compression_window_log);
     return o;
 }
 
 ntp_archiver::ntp_archiver(
-  const storage::ntp_config& ntp, const configuration& conf)
+  const storage::ntp_config& ntp,
+  const configuration& conf,
+  ss::lw_shared_ptr<s3::client_pool> pool)
   : _ntp(ntp.ntp())
   , _rev(ntp.get_revision())
-  , _client_conf(conf.client_config)
-  , _policy(_ntp)
+  , _pool(std::move(pool))
+  , _policy(_ntp, conf.min_object_size())
   , _bucket(conf.bucket_name)
   , _remote(_ntp, _rev)
-  , _gate() {
+  , _delta(_ntp, _rev)
+  , _gate()
+  , _part_size(conf.upload_part_size())
+  , _compress_uploads(conf.compress_uploads)
+  , _compression_window_log(conf.compression_window_log)
+  , _part_upload_limit(conf.part_upload_limit())
+  , _concurrency(conf.segment_upload_concurrency()) {
     vlog(archival_log.trace, "Create ntp_archiver {}", _ntp.path());
 }
 
@@ -76,10 +98,10 @@ ss::future<download_manifest_result> ntp_archiver::download_manifest() {
     auto key = _remote.get_manifest_path();
     vlog(archival_log.debug, "Download manifest {}", key());
     auto path = s3::object_key(key().string());
-    s3::client client(_client_conf, _as);
+    auto lease = co_await _pool->acquire();
     auto result = download_manifest_result::success;
     try {
-        auto resp = co_await client.get_object(_bucket, path);
+        auto resp = co_await lease.client->get_object(_bucket, path);
         vlog(archival_log.debug, "Receive OK response from {}", path);
         co_await _remote.update(resp->as_input_stream());
     } catch (const s3::rest_error_response& err) {
@@ -100,27 +122,80 @@ ss::future<download_manifest_result> ntp_archiver::download_manifest() {
             throw;
         }
     }
-    co_await client.shutdown();
+    if (result != download_manifest_result::backoff) {
+        // Merge manifest deltas uploaded after the last compaction. The
+        // deltas are numbered sequentially so we probe until the first
+        // missing one.
+        uint64_t seq = 0;
+        while (true) {
+            auto dkey = _remote.get_delta_manifest_path(seq);
+            auto dpath = s3::object_key(dkey().string());
+            try {
+                auto resp = co_await lease.client->get_object(_bucket, dpath);
+                vlog(archival_log.debug, "Merging manifest delta {}", dpath);
+                co_await _remote.update_delta(resp->as_input_stream());
+            } catch (const s3::rest_error_response& err) {
+                if (err.code() == s3::s3_error_code::no_such_key) {
+                    break;
+                }
+                throw;
+            }
+            seq++;
+        }
+        _delta_seq = seq;
+        if (seq != 0) {
+            // the deltas alone can reconstruct the manifest even if the
+            // base was never uploaded
+            result = download_manifest_result::success;
+        }
+    }
     co_return result;
 }
 
 ss::future<> ntp_archiver::upload_manifest() {
     gate_guard guard{_gate};
-    vlog(archival_log.debug, "Uploading manifest for {}", _ntp);
+    if (_delta_seq >= max_manifest_deltas || _delta.size() == 0) {
+        // Compact accumulated deltas into the base manifest. Re-uploading
+        // the base also covers the case when there are no new segments.
+        vlog(archival_log.debug, "Uploading manifest for {}", _ntp);
+        if (co_await upload_manifest_object(
+              _remote, _remote.get_manifest_path())) {
+            auto ndeltas = _delta_seq;
+            _delta_seq = 0;
+            _delta = manifest(_ntp, _rev);
+            co_await remove_manifest_deltas(ndeltas);
+        }
+        co_return;
+    }
+    // Only the segments added since the previous upload are shipped,
+    // the reader merges the base manifest with the deltas.
+    vlog(
+      archival_log.debug,
+      "Uploading manifest delta {} for {}",
+      _delta_seq,
+      _ntp);
+    if (co_await upload_manifest_object(
+          _delta, _remote.get_delta_manifest_path(_delta_seq))) {
+        _delta_seq++;
+        _delta = manifest(_ntp, _rev);
+    }
+    co_return;
+}
+
+ss::future<bool> ntp_archiver::upload_manifest_object(
+  const manifest& m, remote_manifest_path key) {
     ss::lowres_clock::duration backoff = 4ms;
     int backoff_quota = 8; // max backoff time should be close to 10s
-    auto key = _remote.get_manifest_path();
     vlog(archival_log.trace, "Upload manifest {}", key());
     auto path = s3::object_key(key().string());
     std::vector<s3::object_tag> tags = {{"rp-type", "partition-manifest"}};
     while (!_gate.is_closed() && backoff_quota-- > 0) {
         bool slowdown = false;
-        s3::client client(_client_conf, _as);
+        auto lease = co_await _pool->acquire();
         try {
-            auto [is, size] = _remote.serialize();
-            co_await client.put_object(
+            auto [is, size] = m.serialize();
+            co_await lease.client->put_object(
               _bucket, path, size, std::move(is), tags);
-            co_await client.shutdown();
         } catch (const s3::rest_error_response& err) {
             vlog(
               archival_log.error,
@@ -142,6 +217,7 @@ ss::future<> ntp_archiver::upload_manifest() {
               "Uploading manifest for {}, unexpected error: {}",
               _ntp,
               std::current_exception());
+            co_return false;
         }
         if (slowdown) {
             // Apply exponential backoff because S3 asked us
@@ -155,26 +231,114 @@ ss::future<> ntp_archiver::upload_manifest() {
             backoff *= 2;
             continue;
         }
-        break;
+        co_return true;
     }
-    if (backoff_quota == 0) {
-        // We exceded backoff quota, warn user and continue. The manifest
-        // should be re-uploaded with the next uploaded segment.
-        vlog(
-          archival_log.warn,
-          "Uploading manifest for {}, backoff quota exceded, manifest {} not "
-          "uploaded",
-          _ntp,
-          path);
+    // We exceded backoff quota, warn user and continue. The manifest
+    // should be re-uploaded with the next uploaded segment.
+    vlog(
+      archival_log.warn,
+      "Uploading manifest for {}, backoff quota exceded, manifest {} not "
+      "uploaded",
+      _ntp,
+      path);
+    co_return false;
+}
+
+ss::future<> ntp_archiver::remove_manifest_deltas(uint64_t ndeltas) {
+    if (ndeltas == 0) {
+        co_return;
+    }
+    auto lease = co_await _pool->acquire();
+    for (uint64_t seq = 0; seq < ndeltas; seq++) {
+        auto key = _remote.get_delta_manifest_path(seq);
+        try {
+            co_await lease.client->delete_object(
+              _bucket, s3::object_key(key().string()));
+        } catch (...) {
+            // The delta is superseded by the base manifest so the
+            // leftover object is harmless, merging it again is a no-op
+            vlog(
+              archival_log.warn,
+              "Failed to remove manifest delta {}. Reason: {}",
+              key(),
+              std::current_exception());
+        }
     }
-    co_return;
 }
 
 const manifest& ntp_archiver::get_remote_manifest() const { return _remote; }
 
+namespace {
+
+/// Data source that reads a list of input streams back to back. Used to
+/// upload several adjacent log segments as a single S3 object.
+class concat_data_source final : public ss::data_source_impl {
+public:
+    explicit concat_data_source(std::vector<ss::input_stream<char>> streams)
+      : _streams(std::move(streams)) {}
+
+    ss::future<ss::temporary_buffer<char>> get() override {
+        while (_ix < _streams.size()) {
+            auto buf = co_await _streams[_ix].read();
+            if (!buf.empty()) {
+                co_return buf;
+            }
+            co_await _streams[_ix].close();
+            _ix++;
+        }
+        co_return ss::temporary_buffer<char>();
+    }
+
+    ss::future<> close() override {
+        for (; _ix < _streams.size(); _ix++) {
+            co_await _streams[_ix].close();
+        }
+    }
+
+private:
+    std::vector<ss::input_stream<char>> _streams;
+    size_t _ix{0};
+};
+
+/// Create input_stream that produces the content of the upload candidate,
+/// including the coalesced tail segments (if any)
+ss::input_stream<char> make_candidate_stream(
+  const upload_candidate& candidate, const ss::io_priority_class& pc) {
+    if (candidate.tail_sources.empty()) {
+        return candidate.source->reader().data_stream(
+          candidate.file_offset, pc);
+    }
+    std::vector<ss::input_stream<char>> streams;
+    streams.reserve(candidate.tail_sources.size() + 1);
+    streams.push_back(
+      candidate.source->reader().data_stream(candidate.file_offset, pc));
+    for (const auto& tail : candidate.tail_sources) {
+        streams.push_back(tail->reader().data_stream(0, pc));
+    }
+    return ss::input_stream<char>(ss::data_source(
+      std::make_unique<concat_data_source>(std::move(streams))));
+}
+
+} // namespace
+
+bool ntp_archiver::compress_upload(const upload_candidate& candidate) const {
+    return _compress_uploads && candidate.content_length <= _part_size;
+}
+
 ss::future<bool> ntp_archiver::upload_segment(
   ss::semaphore& req_limit, upload_candidate candidate) {
     gate_guard guard{_gate};
+    if (
+      candidate.content_length > _part_size
+      && candidate.tail_sources.empty()) {
+        // Large segments are uploaded part by part so individual PUT
+        // requests stay small and can be sent in parallel. Coalesced
+        // candidates are always sent as one PUT: their size is bounded by
+        // the coalescing target and the part offsets wouldn't map to a
+        // single file.
+        co_return co_await upload_segment_multipart(
+          req_limit, std::move(candidate));
+    }
     vlog(
       archival_log.debug,
       "Uploading segment for {}, exposed name {} offset {}, length {}",
@@ -187,11 +351,43 @@ ss::future<bool> ntp_archiver::upload_segment(
     auto s3path = _remote.get_remote_segment_path(
       segment_name(candidate.exposed_name));
     std::vector<s3::object_tag> tags = {{"rp-type", "segment"}};
+    std::optional<iobuf> compressed;
+    if (compress_upload(candidate)) {
+        // Stream the segment through the long-range compressor chunk by
+        // chunk: only the compressed frame is held in memory and nothing
+        // extra lands on disk. Compressing once up front also keeps the
+        // backoff retries below from redoing the work.
+        auto src = make_candidate_stream(
+          candidate, ss::default_priority_class());
+        compression::zstd_frame_compressor cmp(true, _compression_window_log);
+        size_t left = candidate.content_length;
+        while (left > 0) {
+            auto buf = co_await src.read_up_to(left);
+            if (buf.empty()) {
+                break;
+            }
+            left -= buf.size();
+            cmp.append(buf.get(), buf.size());
+        }
+        co_await src.close();
+        compressed = cmp.take();
+        vlog(
+          archival_log.debug,
+          "Uploading segment for {}, compressed {} -> {} bytes",
+          _ntp,
+          candidate.content_length,
+          compressed->size_bytes());
+        tags.push_back({"rp-compression", "zstd"});
+    }
     while (!_gate.is_closed() && backoff_quota-- > 0) {
         auto units = co_await ss::get_units(req_limit, 1);
-        s3::client client(_client_conf, _as);
-        auto stream = candidate.source->reader().data_stream(
-          candidate.file_offset, ss::default_priority_class());
+        auto lease = co_await _pool->acquire();
+        auto stream = compressed ? make_iobuf_input_stream(compressed->share(
+                        0, compressed->size_bytes()))
+                                 : make_candidate_stream(
+                                   candidate, ss::default_priority_class());
+        auto content_length = compressed ? compressed->size_bytes()
+                                         : candidate.content_length;
         bool slowdown = false;
         vlog(
           archival_log.debug,
@@ -200,13 +396,12 @@ ss::future<bool> ntp_archiver::upload_segment(
           s3path);
         try {
             // Segment upload attempt
-            co_await client.put_object(
+            co_await lease.client->put_object(
               _bucket,
               s3::object_key(s3path().string()),
-              candidate.content_length,
+              content_length,
               std::move(stream),
               tags);
-            co_await client.shutdown();
         } catch (const s3::rest_error_response& err) {
             vlog(
               archival_log.error,
@@ -249,6 +444,134 @@ ss::future<bool> ntp_archiver::upload_segment(
     co_return true;
 }
 
+ss::future<ss::sstring> ntp_archiver::upload_part(
+  ss::semaphore& req_limit,
+  ss::semaphore& part_limit,
+  const upload_candidate& candidate,
+  const ss::sstring& upload_id,
+  size_t part_ix) {
+    gate_guard guard{_gate};
+    auto punits = co_await ss::get_units(part_limit, 1);
+    auto path = s3::object_key(_remote
+                                 .get_remote_segment_path(
+                                   segment_name(candidate.exposed_name))()
+                                 .string());
+    const size_t part_offset = part_ix * _part_size;
+    const size_t part_size = std::min(
+      _part_size, candidate.content_length - part_offset);
+    ss::lowres_clock::duration backoff = 4ms;
+    int backoff_quota = 8; // max backoff time should be close to 10s
+    while (backoff_quota-- > 0) {
+        if (_gate.is_closed()) {
+            throw ss::gate_closed_exception();
+        }
+        auto units = co_await ss::get_units(req_limit, 1);
+        // Every part rents its own client because the http connection
+        // can only transfer one request at a time
+        auto lease = co_await _pool->acquire();
+        auto stream = candidate.source->reader().data_stream(
+          candidate.file_offset + part_offset,
+          part_size,
+          ss::default_priority_class());
+        try {
+            // Part upload attempt
+            auto etag = co_await lease.client->upload_part(
+              _bucket,
+              path,
+              upload_id,
+              part_ix + 1,
+              part_size,
+              std::move(stream));
+            co_return etag;
+        } catch (const s3::rest_error_response& err) {
+            if (err.code() != s3::s3_error_code::slow_down) {
+                throw;
+            }
+        }
+        // Apply exponential backoff because S3 asked us
+        vlog(
+          archival_log.debug,
+          "Uploading part {} for {}, {}ms backoff required",
+          part_ix + 1,
+          _ntp,
+          backoff.count());
+        co_await ss::sleep_abortable(
+          backoff + _backoff.next_jitter_duration(), _as);
+        backoff *= 2;
+    }
+    throw std::runtime_error(fmt::format(
+      "part {} upload for {} backoff quota exceded",
+      part_ix + 1,
+      _ntp.path()));
+}
+
+ss::future<bool> ntp_archiver::upload_segment_multipart(
+  ss::semaphore& req_limit, upload_candidate candidate) {
+    gate_guard guard{_gate};
+    auto s3path = _remote.get_remote_segment_path(
+      segment_name(candidate.exposed_name));
+    auto path = s3::object_key(s3path().string());
+    const size_t part_count = (candidate.content_length + _part_size - 1)
+                              / _part_size;
+    vlog(
+      archival_log.debug,
+      "Uploading segment for {}, path {}, length {}, {} parts",
+      _ntp,
+      s3path,
+      candidate.content_length,
+      part_count);
+    std::vector<s3::object_tag> tags = {{"rp-type", "segment"}};
+    ss::sstring upload_id;
+    bool success = false;
+    try {
+        {
+            // The lease is scoped so the client is returned to the pool
+            // while the parts are uploaded, otherwise the parts of
+            // several segments could deadlock waiting for each other
+            auto lease = co_await _pool->acquire();
+            upload_id = co_await lease.client->create_multipart_upload(
+              _bucket, path, tags);
+        }
+        ss::semaphore part_limit{_part_upload_limit};
+        std::vector<ss::future<ss::sstring>> parts;
+        parts.reserve(part_count);
+        for (size_t i = 0; i < part_count; i++) {
+            parts.emplace_back(
+              upload_part(req_limit, part_limit, candidate, upload_id, i));
+        }
+        auto etags = co_await ss::when_all_succeed(begin(parts), end(parts));
+        auto lease = co_await _pool->acquire();
+        co_await lease.client->complete_multipart_upload(
+          _bucket, path, upload_id, etags);
+        success = true;
+    } catch (...) {
+        vlog(
+          archival_log.error,
+          "Failed to upload segment for {}, path {}. Reason: {}",
+          _ntp,
+          s3path,
+          std::current_exception());
+    }
+    if (!success && !upload_id.empty()) {
+        // Get rid of the parts that were already uploaded, otherwise
+        // they will be kept by S3 and billed for
+        try {
+            auto lease = co_await _pool->acquire();
+            co_await lease.client->abort_multipart_upload(
+              _bucket, path, upload_id);
+        } catch (...) {
+            vlog(
+              archival_log.warn,
+              "Failed to abort multipart upload for {}, path {}. "
+              "Reason: {}",
+              _ntp,
+              s3path,
+              std::current_exception());
+        }
+    }
+    co_return success;
+}
+
 ss::future<ntp_archiver::batch_result> ntp_archiver::upload_next_candidates(
   ss::semaphore& req_limit, storage::log_manager& lm) {
     vlog(archival_log.debug, "Uploading next candidates called for {}", _ntp);
@@ -292,17 +615,33 @@ ss::future<ntp_archiver::batch_result> ntp_archiver::upload_next_candidates(
             offset = meta->committed_offset + model::offset(1);
             continue;
         }
-        offset = upload.source->offsets().committed_offset + model::offset(1);
-        flist.emplace_back(upload_segment(req_limit, upload));
+        offset = upload.last_included_offset() + model::offset(1);
         manifest::segment_meta m{
           .is_compacted = upload.source->is_compacted_segment(),
-          .size_bytes
-          = upload.source->size_bytes()
-            - (upload.starting_offset - upload.source->offsets().base_offset),
+          .size_bytes = upload.content_length,
           .base_offset = upload.starting_offset,
-          .committed_offset = upload.source->offsets().committed_offset,
+          .committed_offset = upload.last_included_offset(),
+          .is_compressed = compress_upload(upload),
         };
-        meta.emplace_back(m);
+        if (!upload.tail_sources.empty()) {
+            // Record where every source segment starts inside the
+            // coalesced object so the read path can locate them
+            m.segment_boundaries.push_back({
+              .base_offset = upload.starting_offset,
+              .file_offset = 0,
+            });
+            size_t pos = upload.source->reader().file_size()
+                         - upload.file_offset;
+            for (const auto& tail : upload.tail_sources) {
+                m.segment_boundaries.push_back({
+                  .base_offset = tail->offsets().base_offset,
+                  .file_offset = pos,
+                });
+                pos += tail->reader().file_size();
+            }
+        }
+        flist.emplace_back(upload_segment(req_limit, upload));
+        meta.emplace_back(std::move(m));
         names.emplace_back(upload.exposed_name);
     }
     if (flist.empty()) {
@@ -320,6 +659,7 @@ ss::future<ntp_archiver::batch_result> ntp_archiver::upload_next_candidates(
             break;
         }
         _remote.add(segment_name(names[i]), meta[i]);
+        _delta.add(segment_name(names[i]), meta[i]);
     }
     if (total.num_succeded != 0) {
         vlog(
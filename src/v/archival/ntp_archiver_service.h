@@ -20,6 +20,7 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/semaphore.hh>
 
 #include <map>
@@ -40,6 +41,26 @@ struct configuration {
     ss::lowres_clock::duration gc_interval;
     /// Number of simultaneous S3 uploads
     s3_connection_limit connection_limit;
+    /// Size of a single part of the multipart segment upload
+    s3_upload_part_size upload_part_size;
+    /// Number of simultaneous part uploads per segment
+    s3_part_upload_limit part_upload_limit;
+    /// Number of segments that a single ntp_archiver uploads in parallel
+    segment_upload_limit segment_upload_concurrency;
+    /// Size of the cache used by the remote read path
+    segment_read_cache_size read_cache_size;
+    /// Desired lower bound on the size of an uploaded object, consecutive
+    /// small segments are coalesced into one object to reach it, 0
+    /// disables coalescing
+    s3_min_object_size min_object_size{0};
+    /// Compress segments with long-range zstd before the upload
+    bool compress_uploads{false};
+    /// Log2 of the zstd match window used for upload compression, 0 keeps
+    /// the zstd default
+    int compression_window_log{0};
+    /// Scheduling group the upload loop runs in, defaults to the main
+    /// group for tests and tools
+    ss::scheduling_group upload_scheduling_group{};
 };
 
 std::ostream& operator<<(std::ostream& o, const configuration& cfg);
@@ -62,8 +83,11 @@ public:
     ///
     /// \param ntp is an ntp that archiver is responsible for
     /// \param conf is an S3 client configuration
-    /// \param bucket is an S3 bucket that should be used to store the data
-    ntp_archiver(const storage::ntp_config& ntp, const configuration& conf);
+    /// \param pool is a shard-local S3 client pool shared by all archivers
+    ntp_archiver(
+      const storage::ntp_config& ntp,
+      const configuration& conf,
+      ss::lw_shared_ptr<s3::client_pool> pool);
 
     /// Stop archiver.
     ///
@@ -81,13 +105,22 @@ public:
     const ss::lowres_clock::time_point get_last_upload_time() const;
 
     /// Download manifest from pre-defined S3 locatnewion
+    /// The base manifest is merged with manifest deltas uploaded after the
+    /// last compaction.
     ///
     /// \return future that returns true if the manifest was found in S3
     ss::future<download_manifest_result> download_manifest();
 
     /// Upload manifest to the pre-defined S3 location
+    /// Normally only the delta with the segments added since the previous
+    /// call is uploaded. After 'max_manifest_deltas' deltas the full
+    /// manifest is re-uploaded and the deltas are removed.
     ss::future<> upload_manifest();
 
+    /// Number of manifest deltas that are accumulated before they're
+    /// compacted into the base manifest
+    static constexpr uint64_t max_manifest_deltas = 16;
+
     const manifest& get_remote_manifest() const;
 
     struct batch_result {
@@ -107,25 +140,68 @@ public:
     upload_next_candidates(ss::semaphore& req_limit, storage::log_manager& lm);
 
 private:
+    /// Upload a single manifest object (base or delta) with backoff.
+    ///
+    /// \return true on success and false otherwise
+    ss::future<bool>
+    upload_manifest_object(const manifest& m, remote_manifest_path key);
+
+    /// Remove manifest deltas that were compacted into the base manifest,
+    /// best effort
+    ss::future<> remove_manifest_deltas(uint64_t ndeltas);
+
     /// Upload individual segment to S3.
     ///
     /// \return true on success and false otherwise
     ss::future<bool>
     upload_segment(ss::semaphore& req_limit, upload_candidate candidate);
 
+    /// Upload individual segment to S3 using multipart upload. Parts are
+    /// uploaded in parallel, not more than '_part_upload_limit' per segment
+    /// and not more than 'req_limit' per shard.
+    ///
+    /// \return true on success and false otherwise
+    ss::future<bool> upload_segment_multipart(
+      ss::semaphore& req_limit, upload_candidate candidate);
+
+    /// Upload a single part of the multipart upload with backoff.
+    ///
+    /// \return etag of the uploaded part
+    ss::future<ss::sstring> upload_part(
+      ss::semaphore& req_limit,
+      ss::semaphore& part_limit,
+      const upload_candidate& candidate,
+      const ss::sstring& upload_id,
+      size_t part_ix);
+
+    /// True when the candidate will be compressed before the upload.
+    /// Multipart uploads are sent as-is: the S3 client needs the content
+    /// length of every part up front and buffering a whole compressed
+    /// segment in memory to learn it would defeat the part-by-part upload
+    bool compress_upload(const upload_candidate& candidate) const;
+
     model::ntp _ntp;
     model::revision_id _rev;
-    s3::configuration _client_conf;
+    /// Shard-local S3 client pool shared with other archivers
+    ss::lw_shared_ptr<s3::client_pool> _pool;
     archival_policy _policy;
     s3::bucket_name _bucket;
     /// Remote manifest contains representation of the data stored in S3 (it
     /// gets uploaded to the remote location)
     manifest _remote;
+    /// Segments that were added to '_remote' since the last manifest upload
+    manifest _delta;
+    /// Sequence number of the next manifest delta
+    uint64_t _delta_seq{0};
     ss::gate _gate;
     ss::abort_source _as;
     ss::semaphore _mutex{1};
     simple_time_jitter<ss::lowres_clock> _backoff{100ms};
-    size_t _concurrency{4};
+    size_t _part_size;
+    bool _compress_uploads;
+    int _compression_window_log;
+    size_t _part_upload_limit;
+    size_t _concurrency;
     ss::lowres_clock::time_point _last_upload_time;
 };
 
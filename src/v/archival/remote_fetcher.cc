@@ -0,0 +1,228 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/vectorizedio/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "archival/remote_fetcher.h"
+
+#include "archival/logger.h"
+#include "compression/stream_zstd.h"
+#include "model/record.h"
+#include "storage/fs_utils.h"
+#include "storage/parser.h"
+#include "utils/gate_guard.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/iostream.hh>
+
+#include <algorithm>
+#include <system_error>
+#include <vector>
+
+namespace archival {
+
+segment_cache::segment_cache(size_t max_bytes)
+  : _max_bytes(max_bytes) {}
+
+std::optional<iobuf> segment_cache::get(const remote_segment_path& path) {
+    auto key = ss::sstring(path().native());
+    auto it = _index.find(key);
+    if (it == _index.end()) {
+        return std::nullopt;
+    }
+    _lru.splice(_lru.begin(), _lru, it->second);
+    auto& data = it->second->data;
+    return data.share(0, data.size_bytes());
+}
+
+void segment_cache::put(const remote_segment_path& path, iobuf data) {
+    auto key = ss::sstring(path().native());
+    if (_index.contains(key) || data.size_bytes() > _max_bytes) {
+        return;
+    }
+    while (!_lru.empty() && _size_bytes + data.size_bytes() > _max_bytes) {
+        auto& victim = _lru.back();
+        vlog(
+          archival_log.debug,
+          "Evicting segment {} from the read cache",
+          victim.path);
+        _size_bytes -= victim.data.size_bytes();
+        _index.erase(victim.path);
+        _lru.pop_back();
+    }
+    _size_bytes += data.size_bytes();
+    _lru.push_front(entry{.path = key, .data = std::move(data)});
+    _index.insert(std::make_pair(std::move(key), _lru.begin()));
+}
+
+/// Collects batches that belong to the [start_offset, max_offset]
+/// range until the byte budget is exhausted
+class remote_batch_consumer final : public storage::batch_consumer {
+public:
+    remote_batch_consumer(
+      model::record_batch_reader::data_t& buffer,
+      model::offset start_offset,
+      model::offset max_offset,
+      size_t max_bytes,
+      size_t& bytes_consumed,
+      model::term_id term)
+      : _buffer(buffer)
+      , _start_offset(start_offset)
+      , _max_offset(max_offset)
+      , _max_bytes(max_bytes)
+      , _bytes_consumed(bytes_consumed)
+      , _term(term) {}
+
+    consume_result consume_batch_start(
+      model::record_batch_header header,
+      size_t /*physical_base_offset*/,
+      size_t /*size_on_disk*/) override {
+        if (header.last_offset() < _start_offset) {
+            return skip_batch::yes;
+        }
+        if (header.base_offset() > _max_offset) {
+            return stop_parser::yes;
+        }
+        if (
+          _bytes_consumed != 0
+          && _bytes_consumed + header.size_bytes > _max_bytes) {
+            return stop_parser::yes;
+        }
+        _header = header;
+        _header.ctx.term = _term;
+        return skip_batch::no;
+    }
+
+    void consume_records(iobuf&& records) override {
+        _records = std::move(records);
+    }
+
+    stop_parser consume_batch_end() override {
+        _bytes_consumed += _header.size_bytes;
+        _buffer.emplace_back(model::record_batch(
+          _header, std::move(_records), model::record_batch::tag_ctor_ng{}));
+        if (
+          _header.last_offset() >= _max_offset
+          || _bytes_consumed >= _max_bytes) {
+            return stop_parser::yes;
+        }
+        _header = {};
+        return stop_parser::no;
+    }
+
+    void print(std::ostream& os) const override {
+        fmt::print(os, "archival::remote_batch_consumer");
+    }
+
+private:
+    model::record_batch_reader::data_t& _buffer;
+    model::offset _start_offset;
+    model::offset _max_offset;
+    size_t _max_bytes;
+    size_t& _bytes_consumed;
+    model::term_id _term;
+    model::record_batch_header _header{};
+    iobuf _records;
+};
+
+remote_fetcher::remote_fetcher(
+  s3::bucket_name bucket,
+  ss::lw_shared_ptr<s3::client_pool> pool,
+  segment_read_cache_size cache_size)
+  : _bucket(std::move(bucket))
+  , _pool(std::move(pool))
+  , _cache(cache_size()) {}
+
+ss::future<> remote_fetcher::stop() { return _gate.close(); }
+
+ss::future<iobuf>
+remote_fetcher::hydrate(const remote_segment_path& path, bool is_compressed) {
+    if (auto cached = _cache.get(path); cached.has_value()) {
+        vlog(archival_log.debug, "Read cache hit for segment {}", path());
+        co_return std::move(*cached);
+    }
+    vlog(archival_log.debug, "Hydrating segment {}", path());
+    auto lease = co_await _pool->acquire();
+    auto resp = co_await lease.client->get_object(
+      _bucket, s3::object_key(path().string()));
+    auto stream = resp->as_input_stream();
+    iobuf data;
+    while (true) {
+        auto buf = co_await stream.read();
+        if (buf.empty()) {
+            break;
+        }
+        data.append(std::move(buf));
+    }
+    co_await stream.close();
+    if (is_compressed) {
+        // the archiver compresses with a widened match window, so lift the
+        // decoder's window cap accordingly
+        compression::stream_zstd dec;
+        dec.set_long_range(true);
+        data = dec.uncompress(std::move(data));
+    }
+    _cache.put(path, data.share(0, data.size_bytes()));
+    co_return data;
+}
+
+ss::future<model::record_batch_reader> remote_fetcher::fetch(
+  const manifest& m,
+  model::offset start_offset,
+  model::offset max_offset,
+  size_t max_bytes) {
+    gate_guard guard{_gate};
+    // The manifest is keyed by segment name so we need to pull out the
+    // segments that overlap with the offset range and order them by
+    // base offset first.
+    std::vector<std::pair<segment_name, manifest::segment_meta>> segments;
+    for (const auto& [name, meta] : m) {
+        if (
+          meta.committed_offset >= start_offset
+          && meta.base_offset <= max_offset) {
+            segments.emplace_back(segment_name(name), meta);
+        }
+    }
+    std::sort(
+      segments.begin(), segments.end(), [](const auto& lhs, const auto& rhs) {
+          return lhs.second.base_offset < rhs.second.base_offset;
+      });
+    model::record_batch_reader::data_t batches;
+    size_t bytes_consumed = 0;
+    for (const auto& [name, meta] : segments) {
+        if (bytes_consumed >= max_bytes) {
+            break;
+        }
+        auto term = model::term_id(0);
+        if (auto sm = storage::segment_path::parse_segment_filename(name());
+            sm.has_value()) {
+            term = sm->term;
+        }
+        auto data = co_await hydrate(
+          m.get_remote_segment_path(name), meta.is_compressed);
+        auto consumer = std::make_unique<remote_batch_consumer>(
+          batches, start_offset, max_offset, max_bytes, bytes_consumed, term);
+        auto parser = storage::continuous_batch_parser(
+          std::move(consumer), make_iobuf_input_stream(std::move(data)));
+        auto result = co_await parser.consume();
+        co_await parser.close();
+        if (!result) {
+            throw std::system_error(result.error());
+        }
+    }
+    vlog(
+      archival_log.debug,
+      "Remote fetch for {}, start offset {}, read {} batches, {} bytes",
+      m.get_ntp(),
+      start_offset,
+      batches.size(),
+      bytes_consumed);
+    co_return model::make_memory_record_batch_reader(std::move(batches));
+}
+
+} // namespace archival
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/vectorizedio/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "archival/manifest.h"
+#include "archival/types.h"
+#include "bytes/iobuf.h"
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "s3/client.h"
+
+#include <seastar/core/gate.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <list>
+
+namespace archival {
+
+/// Bounded cache of segments hydrated from S3.
+/// The least recently used segments are evicted when the cache grows
+/// over the configured capacity. Segments that are larger than the
+/// capacity are not cached at all.
+class segment_cache {
+public:
+    explicit segment_cache(size_t max_bytes);
+
+    /// Get cached segment content or nullopt on cache miss
+    std::optional<iobuf> get(const remote_segment_path& path);
+
+    /// Add segment content to the cache, evicting the least recently
+    /// used segments if needed
+    void put(const remote_segment_path& path, iobuf data);
+
+    /// Total size of the cached segments in bytes
+    size_t size_bytes() const noexcept { return _size_bytes; }
+
+private:
+    struct entry {
+        ss::sstring path;
+        iobuf data;
+    };
+    using lru_list = std::list<entry>;
+
+    size_t _max_bytes;
+    size_t _size_bytes{0};
+    /// Most recently used segments are at the front of the list
+    lru_list _lru;
+    absl::node_hash_map<ss::sstring, lru_list::iterator> _index;
+};
+
+/// Serves fetch requests that target offsets that are no longer
+/// available locally. The manifest is used to map the offset range to a
+/// set of segments which are hydrated from S3 into the 'segment_cache'
+/// and parsed into record batches.
+class remote_fetcher {
+public:
+    remote_fetcher(
+      s3::bucket_name bucket,
+      ss::lw_shared_ptr<s3::client_pool> pool,
+      segment_read_cache_size cache_size);
+
+    /// Stop the fetcher.
+    ///
+    /// \return future that becomes ready when all in-flight reads finish
+    ss::future<> stop();
+
+    /// \brief Read a range of batches from the archived segments.
+    /// The manifest has no intra-segment index so the hydration unit is
+    /// the whole segment object.
+    ///
+    /// \param m is a manifest of the partition
+    /// \param start_offset is the first offset that the caller needs
+    /// \param max_offset is the last offset that can be returned
+    /// \param max_bytes limits the size of the read
+    /// \return reader over the batches in the requested range
+    ss::future<model::record_batch_reader> fetch(
+      const manifest& m,
+      model::offset start_offset,
+      model::offset max_offset,
+      size_t max_bytes);
+
+private:
+    /// Get segment content from the cache or download it from S3. Segments
+    /// compressed at upload time are decompressed here; the cache always
+    /// holds the original segment bytes
+    ss::future<iobuf>
+    hydrate(const remote_segment_path& path, bool is_compressed);
+
+    s3::bucket_name _bucket;
+    ss::lw_shared_ptr<s3::client_pool> _pool;
+    segment_cache _cache;
+    ss::gate _gate;
+};
+
+} // namespace archival
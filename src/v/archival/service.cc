@@ -36,6 +36,7 @@
 #include <seastar/core/sleep.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/when_all.hh>
+#include <seastar/core/with_scheduling_group.hh>
 
 #include <boost/iterator/counting_iterator.hpp>
 
@@ -133,7 +134,24 @@ scheduler_service_impl::get_archival_service_config() {
       .interval
       = config::shard_local_cfg().archival_storage_reconciliation_ms.value(),
       .connection_limit = s3_connection_limit(
-        config::shard_local_cfg().archival_storage_max_connections.value())};
+        config::shard_local_cfg().archival_storage_max_connections.value()),
+      .upload_part_size = s3_upload_part_size(
+        config::shard_local_cfg().archival_storage_upload_part_size.value()),
+      .part_upload_limit = s3_part_upload_limit(
+        config::shard_local_cfg()
+          .archival_storage_max_part_uploads_per_segment.value()),
+      .segment_upload_concurrency = segment_upload_limit(
+        config::shard_local_cfg()
+          .archival_storage_max_segment_uploads.value()),
+      .read_cache_size = segment_read_cache_size(
+        config::shard_local_cfg().archival_storage_read_cache_size.value()),
+      .min_object_size = s3_min_object_size(
+        config::shard_local_cfg().archival_storage_min_upload_size.value()),
+      .compress_uploads
+      = config::shard_local_cfg().archival_storage_compress_uploads.value(),
+      .compression_window_log
+      = config::shard_local_cfg()
+          .archival_storage_compression_window_log.value()};
     vlog(archival_log.debug, "Archival configuration generated: {}", cfg);
     co_return cfg;
 }
@@ -150,7 +168,10 @@ scheduler_service_impl::scheduler_service_impl(
   , _jitter(conf.interval, 1ms)
   , _gc_jitter(conf.gc_interval, 1ms)
   , _conn_limit(conf.connection_limit())
-  , _stop_limit(conf.connection_limit()) {}
+  , _stop_limit(conf.connection_limit())
+  , _pool(ss::make_lw_shared<s3::client_pool>(
+      conf.connection_limit(), conf.client_config))
+  , _fetcher(conf.bucket_name, _pool, conf.read_cache_size) {}
 
 scheduler_service_impl::scheduler_service_impl(
   ss::sharded<storage::api>& api,
@@ -173,15 +194,28 @@ void scheduler_service_impl::rearm_timer() {
           });
     });
 }
+/// Scheduler service instance of the current shard, used by the remote
+/// read path to reach the service from the kafka fetch handler
+static thread_local scheduler_service_impl* shard_local_service{nullptr};
+
+scheduler_service_impl* scheduler_service_impl::local_instance() {
+    return shard_local_service;
+}
+
 ss::future<> scheduler_service_impl::start() {
+    shard_local_service = this;
     _timer.set_callback([this] { rearm_timer(); });
     _timer.rearm(_jitter());
-    (void)run_uploads();
+    (void)ss::with_scheduling_group(
+      _conf.upload_scheduling_group, [this] { return run_uploads(); });
     return ss::now();
 }
 
 ss::future<> scheduler_service_impl::stop() {
     vlog(archival_log.info, "Scheduler service stop");
+    if (shard_local_service == this) {
+        shard_local_service = nullptr;
+    }
     _timer.cancel();
     _as.request_abort();
     std::vector<ss::future<>> outstanding;
@@ -193,7 +227,9 @@ ss::future<> scheduler_service_impl::stop() {
     return ss::do_with(
       std::move(outstanding), [this](std::vector<ss::future<>>& outstanding) {
           return ss::when_all_succeed(outstanding.begin(), outstanding.end())
-            .then([this] { return _gate.close(); });
+            .then([this] { return _gate.close(); })
+            .then([this] { return _fetcher.stop(); })
+            .then([this] { return _pool->stop(); });
       });
 }
 
@@ -201,6 +237,24 @@ ss::lw_shared_ptr<ntp_archiver> scheduler_service_impl::get_upload_candidate() {
     return _queue.get_upload_candidate();
 }
 
+ss::future<std::optional<model::record_batch_reader>>
+scheduler_service_impl::read_remote(
+  const model::ntp& ntp,
+  model::offset start_offset,
+  model::offset max_offset,
+  size_t max_bytes) {
+    gate_guard gg(_gate);
+    auto archiver = _queue[ntp];
+    if (!archiver) {
+        co_return std::nullopt;
+    }
+    const auto& m = archiver->get_remote_manifest();
+    if (m.size() == 0 || start_offset > m.get_last_offset()) {
+        co_return std::nullopt;
+    }
+    co_return co_await _fetcher.fetch(m, start_offset, max_offset, max_bytes);
+}
+
 ss::future<> scheduler_service_impl::upload_topic_manifest(
   model::topic_namespace_view view, model::revision_id rev) {
     gate_guard gg(_gate);
@@ -209,19 +263,18 @@ ss::future<> scheduler_service_impl::upload_topic_manifest(
         try {
             auto units = co_await ss::get_units(_conn_limit, 1);
             vlog(archival_log.info, "Uploading topic manifest {}", view);
-            s3::client client(_conf.client_config, _as);
+            auto lease = co_await _pool->acquire();
             topic_manifest tm(*cfg, rev);
             auto [istr, size_bytes] = tm.serialize();
             auto key = tm.get_manifest_path();
             vlog(archival_log.debug, "Topic manifest object key is '{}'", key);
             std::vector<s3::object_tag> tags = {{"rp-type", "topic-manifest"}};
-            co_await client.put_object(
+            co_await lease.client->put_object(
               _conf.bucket_name,
               s3::object_key(key),
               size_bytes,
               std::move(istr),
               tags);
-            co_await client.shutdown();
         } catch (const s3::rest_error_response& err) {
             vlog(
               archival_log.error,
@@ -254,7 +307,7 @@ scheduler_service_impl::create_archivers(std::vector<model::ntp> to_create) {
                     return ss::now();
                 }
                 auto svc = ss::make_lw_shared<ntp_archiver>(
-                  log->config(), _conf);
+                  log->config(), _conf, _pool);
                 return ss::repeat([this, svc, ntp] {
                     return svc->download_manifest()
                       .then(
@@ -474,3 +527,20 @@ ss::future<> scheduler_service_impl::run_uploads() {
 }
 
 } // namespace archival::internal
+
+namespace archival {
+
+ss::future<std::optional<model::record_batch_reader>> read_remote_segments(
+  const model::ntp& ntp,
+  model::offset start_offset,
+  model::offset max_offset,
+  size_t max_bytes) {
+    auto* svc = internal::scheduler_service_impl::local_instance();
+    if (svc == nullptr) {
+        return ss::make_ready_future<std::optional<model::record_batch_reader>>(
+          std::nullopt);
+    }
+    return svc->read_remote(ntp, start_offset, max_offset, max_bytes);
+}
+
+} // namespace archival
@@ -11,8 +11,10 @@
 #pragma once
 #include "archival/manifest.h"
 #include "archival/ntp_archiver_service.h"
+#include "archival/remote_fetcher.h"
 #include "cluster/partition_manager.h"
 #include "model/fundamental.h"
+#include "model/record_batch_reader.h"
 #include "s3/client.h"
 #include "storage/api.h"
 #include "storage/log_manager.h"
@@ -146,6 +148,25 @@ public:
     /// Return range with all available ntps
     bool contains(const model::ntp& ntp) const { return _queue.contains(ntp); }
 
+    /// Scheduler service instance that is local to the current shard or
+    /// nullptr if the service is not started
+    static scheduler_service_impl* local_instance();
+
+    /// \brief Read a range of batches from the archived segments.
+    ///
+    /// \param ntp is a partition to read from
+    /// \param start_offset is the first offset that the caller needs
+    /// \param max_offset is the last offset that can be returned
+    /// \param max_bytes limits the size of the read
+    /// \return reader over the archived batches or nullopt if the
+    ///         partition is not archived or the offset is not covered
+    ///         by the manifest
+    ss::future<std::optional<model::record_batch_reader>> read_remote(
+      const model::ntp& ntp,
+      model::offset start_offset,
+      model::offset max_offset,
+      size_t max_bytes);
+
 private:
     /// Remove archivers from the workingset
     ss::future<> remove_archivers(std::vector<model::ntp> to_remove);
@@ -165,6 +186,10 @@ private:
     ss::abort_source _as;
     ss::semaphore _conn_limit;
     ss::semaphore _stop_limit;
+    /// Shard-local S3 client pool shared by all archivers
+    ss::lw_shared_ptr<s3::client_pool> _pool;
+    /// Serves fetch requests from the archived segments
+    remote_fetcher _fetcher;
     ntp_upload_queue _queue;
     simple_time_jitter<ss::lowres_clock> _backoff{100ms};
 };
@@ -198,4 +223,17 @@ public:
     using internal::scheduler_service_impl::get_archival_service_config;
 };
 
+/// \brief Read a range of batches from the archived (S3) portion of the
+/// log. This is used by the fetch path when the requested offset was
+/// already removed by the local retention policy.
+///
+/// \return reader over the archived batches or nullopt if the archival
+///         service is not enabled on this shard, the partition is not
+///         archived, or the offset is not covered by the manifest
+ss::future<std::optional<model::record_batch_reader>> read_remote_segments(
+  const model::ntp& ntp,
+  model::offset start_offset,
+  model::offset max_offset,
+  size_t max_bytes);
+
 } // namespace archival
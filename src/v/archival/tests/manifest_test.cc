@@ -10,6 +10,7 @@
 
 #include "archival/manifest.h"
 #include "bytes/iobuf.h"
+#include "bytes/iobuf_ostreambuf.h"
 #include "bytes/iobuf_parser.h"
 #include "model/metadata.h"
 #include "seastarx.h"
@@ -60,6 +61,22 @@ static std::string_view complete_manifest_json = R"json({
         }
     }
 })json";
+static std::string_view delta_manifest_json = R"json({
+    "version": 1,
+    "namespace": "test-ns",
+    "topic": "test-topic",
+    "partition": 42,
+    "revision": 1,
+    "last_offset": 39,
+    "segments": {
+        "30-1-v1.log": {
+            "is_compacted": false,
+            "size_bytes": 4096,
+            "base_offset": 30,
+            "committed_offset": 39
+        }
+    }
+})json";
 static const model::ntp manifest_ntp(
   model::ns("test-ns"), model::topic("test-topic"), model::partition_id(42));
 
@@ -117,6 +134,24 @@ SEASTAR_THREAD_TEST_CASE(test_complete_manifest_update) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(test_delta_manifest_path) {
+    manifest m(manifest_ntp, model::revision_id(0));
+    auto path = m.get_delta_manifest_path(2);
+    BOOST_REQUIRE_EQUAL(
+      path, "20000000/meta/test-ns/test-topic/42_0/manifest.json.2");
+}
+
+SEASTAR_THREAD_TEST_CASE(test_manifest_update_delta) {
+    manifest m;
+    m.update(make_manifest_stream(complete_manifest_json)).get0();
+    m.update_delta(make_manifest_stream(delta_manifest_json)).get0();
+    BOOST_REQUIRE_EQUAL(m.size(), 3);
+    BOOST_REQUIRE(m.contains(segment_name("10-1-v1.log")));
+    BOOST_REQUIRE(m.contains(segment_name("20-1-v1.log")));
+    BOOST_REQUIRE(m.contains(segment_name("30-1-v1.log")));
+    BOOST_REQUIRE_EQUAL(m.get_last_offset(), model::offset(39));
+}
+
 SEASTAR_THREAD_TEST_CASE(test_manifest_serialization) {
     manifest m(manifest_ntp, model::revision_id(0));
     m.add(
@@ -147,6 +182,112 @@ SEASTAR_THREAD_TEST_CASE(test_manifest_serialization) {
     BOOST_REQUIRE(m == restored);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_binary_manifest_flags_and_size) {
+    manifest m(manifest_ntp, model::revision_id(1));
+    m.add(
+      segment_name("10-1-v1.log"),
+      {
+        .is_compacted = true,
+        .size_bytes = 1024,
+        .base_offset = model::offset(10),
+        .committed_offset = model::offset(19),
+        .is_compressed = true,
+      });
+    m.add(
+      segment_name("20-1-v1.log"),
+      {
+        .is_compacted = false,
+        .size_bytes = 2048,
+        .base_offset = model::offset(20),
+        .committed_offset = model::offset(29),
+      });
+
+    auto [is, size] = m.serialize();
+    iobuf buf;
+    auto os = make_iobuf_ref_output_stream(buf);
+    ss::copy(is, os).get();
+    BOOST_REQUIRE_EQUAL(size, buf.size_bytes());
+
+    // the binary representation should be a fraction of the json one
+    iobuf json;
+    iobuf_ostreambuf obuf(json);
+    std::ostream jos(&obuf);
+    m.serialize(jos);
+    BOOST_REQUIRE_LT(buf.size_bytes(), json.size_bytes());
+
+    manifest restored;
+    restored.update(make_iobuf_input_stream(std::move(buf))).get0();
+    BOOST_REQUIRE(m == restored);
+    BOOST_REQUIRE(restored.get(segment_name("10-1-v1.log"))->is_compacted);
+    BOOST_REQUIRE(restored.get(segment_name("10-1-v1.log"))->is_compressed);
+    BOOST_REQUIRE(!restored.get(segment_name("20-1-v1.log"))->is_compacted);
+    BOOST_REQUIRE(!restored.get(segment_name("20-1-v1.log"))->is_compressed);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_manifest_segment_boundaries) {
+    // coalesced upload object that covers three source segments
+    manifest m(manifest_ntp, model::revision_id(1));
+    m.add(
+      segment_name("10-1-v1.log"),
+      {
+        .is_compacted = false,
+        .size_bytes = 3072,
+        .base_offset = model::offset(10),
+        .committed_offset = model::offset(39),
+        .segment_boundaries = {
+          {.base_offset = model::offset(10), .file_offset = 0},
+          {.base_offset = model::offset(20), .file_offset = 1024},
+          {.base_offset = model::offset(30), .file_offset = 2048},
+        },
+      });
+
+    // binary round trip
+    auto [is, size] = m.serialize();
+    iobuf buf;
+    auto os = make_iobuf_ref_output_stream(buf);
+    ss::copy(is, os).get();
+    manifest restored;
+    restored.update(make_iobuf_input_stream(std::move(buf))).get0();
+    BOOST_REQUIRE(m == restored);
+    const auto* meta = restored.get(segment_name("10-1-v1.log"));
+    BOOST_REQUIRE_EQUAL(meta->segment_boundaries.size(), 3);
+    BOOST_REQUIRE(
+      meta->segment_boundaries[1].base_offset == model::offset(20));
+    BOOST_REQUIRE_EQUAL(meta->segment_boundaries[1].file_offset, 1024);
+
+    // json round trip, the export also carries the boundaries
+    iobuf json;
+    iobuf_ostreambuf obuf(json);
+    std::ostream jos(&obuf);
+    m.serialize(jos);
+    manifest from_json;
+    from_json.update(make_iobuf_input_stream(std::move(json))).get0();
+    BOOST_REQUIRE(m == from_json);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_binary_manifest_update_delta) {
+    // base manifest from legacy json, binary delta on top
+    manifest m;
+    m.update(make_manifest_stream(complete_manifest_json)).get0();
+
+    manifest delta(manifest_ntp, model::revision_id(1));
+    delta.add(
+      segment_name("30-1-v1.log"),
+      {
+        .is_compacted = false,
+        .size_bytes = 4096,
+        .base_offset = model::offset(30),
+        .committed_offset = model::offset(39),
+      });
+    auto [is, size] = delta.serialize();
+    m.update_delta(std::move(is)).get0();
+
+    BOOST_REQUIRE_EQUAL(m.size(), 3);
+    BOOST_REQUIRE(m.contains(segment_name("10-1-v1.log")));
+    BOOST_REQUIRE(m.contains(segment_name("30-1-v1.log")));
+    BOOST_REQUIRE_EQUAL(m.get_last_offset(), model::offset(39));
+}
+
 SEASTAR_THREAD_TEST_CASE(test_manifest_difference) {
     manifest a(manifest_ntp, model::revision_id(0));
     a.add(segment_name("0-0-1.log"), {});
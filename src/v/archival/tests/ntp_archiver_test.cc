@@ -50,6 +50,22 @@ static constexpr std::string_view manifest_payload = R"json({
         }
     }
 })json";
+static constexpr std::string_view delta_manifest_payload = R"json({
+    "version": 1,
+    "namespace": "test-ns",
+    "topic": "test-topic",
+    "partition": 42,
+    "revision": 0,
+    "last_offset": 2004,
+    "segments": {
+        "1005-5-v1.log": {
+            "is_compacted": false,
+            "size_bytes": 300,
+            "committed_offset": 2004,
+            "base_offset": 1005
+        }
+    }
+})json";
 static constexpr std::string_view manifest_with_deleted_segment = R"json({
     "version": 1,
     "namespace": "test-ns",
@@ -79,6 +95,8 @@ static const ss::sstring manifest_url = fmt::format(         // NOLINT
   "/20000000/meta/{}_{}/manifest.json",
   manifest_ntp.path(),
   manifest_revision());
+static const ss::sstring delta0_manifest_url = manifest_url + ".0"; // NOLINT
+static const ss::sstring delta1_manifest_url = manifest_url + ".1"; // NOLINT
 
 // NOLINTNEXTLINE
 static const ss::sstring segment1_url
@@ -91,6 +109,8 @@ static const std::vector<s3_imposter_fixture::expectation>
   default_expectations({
     s3_imposter_fixture::expectation{
       .url = manifest_url, .body = ss::sstring(manifest_payload)},
+    s3_imposter_fixture::expectation{
+      .url = delta0_manifest_url, .body = std::nullopt},
     s3_imposter_fixture::expectation{.url = segment1_url, .body = "segment1"},
     s3_imposter_fixture::expectation{.url = segment2_url, .body = "segment2"},
   });
@@ -99,6 +119,12 @@ static storage::ntp_config get_ntp_conf() {
     return storage::ntp_config(manifest_ntp, "base-dir");
 }
 
+static ss::lw_shared_ptr<s3::client_pool> make_client_pool() {
+    auto conf = get_configuration();
+    return ss::make_lw_shared<s3::client_pool>(
+      conf.connection_limit(), conf.client_config);
+}
+
 static manifest load_manifest(std::string_view v) {
     manifest m;
     iobuf i;
@@ -108,34 +134,51 @@ static manifest load_manifest(std::string_view v) {
     return std::move(m);
 }
 
-/// Compare two json objects logically by parsing them first and then going
-/// through fields
-static bool
-compare_json_objects(const std::string_view& lhs, const std::string_view& rhs) {
-    using namespace rapidjson;
-    Document lhsd, rhsd;
-    lhsd.Parse({lhs.data(), lhs.size()});
-    rhsd.Parse({rhs.data(), rhs.size()});
-    if (lhsd != rhsd) {
-        vlog(
-          test_log.trace, "Json objects are not equal:\n{}and\n{}", lhs, rhs);
-    }
-    return lhsd == rhsd;
-}
-
 FIXTURE_TEST(test_download_manifest, s3_imposter_fixture) { // NOLINT
     set_expectations_and_listen(default_expectations);
-    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration());
-    auto action = ss::defer([&archiver] { archiver.stop().get(); });
+    auto pool = make_client_pool();
+    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration(), pool);
+    auto action = ss::defer([&archiver, pool] {
+        archiver.stop().get();
+        pool->stop().get();
+    });
     archiver.download_manifest().get();
     auto expected = load_manifest(manifest_payload);
     BOOST_REQUIRE(expected == archiver.get_remote_manifest()); // NOLINT
 }
 
+FIXTURE_TEST(test_download_manifest_with_delta, s3_imposter_fixture) { // NOLINT
+    set_expectations_and_listen({
+      s3_imposter_fixture::expectation{
+        .url = manifest_url, .body = ss::sstring(manifest_payload)},
+      s3_imposter_fixture::expectation{
+        .url = delta0_manifest_url, .body = ss::sstring(delta_manifest_payload)},
+      s3_imposter_fixture::expectation{
+        .url = delta1_manifest_url, .body = std::nullopt},
+    });
+    auto pool = make_client_pool();
+    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration(), pool);
+    auto action = ss::defer([&archiver, pool] {
+        archiver.stop().get();
+        pool->stop().get();
+    });
+    archiver.download_manifest().get();
+    const auto& m = archiver.get_remote_manifest();
+    BOOST_REQUIRE_EQUAL(m.size(), 3);
+    BOOST_REQUIRE(m.contains(segment_name("1-2-v1.log")));     // NOLINT
+    BOOST_REQUIRE(m.contains(segment_name("1000-4-v1.log")));  // NOLINT
+    BOOST_REQUIRE(m.contains(segment_name("1005-5-v1.log")));  // NOLINT
+    BOOST_REQUIRE_EQUAL(m.get_last_offset(), model::offset(2004));
+}
+
 FIXTURE_TEST(test_upload_manifest, s3_imposter_fixture) { // NOLINT
     set_expectations_and_listen(default_expectations);
-    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration());
-    auto action = ss::defer([&archiver] { archiver.stop().get(); });
+    auto pool = make_client_pool();
+    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration(), pool);
+    auto action = ss::defer([&archiver, pool] {
+        archiver.stop().get();
+        pool->stop().get();
+    });
     auto pm = const_cast<manifest*>( // NOLINT
       &archiver.get_remote_manifest());
     pm->add(
@@ -156,15 +199,21 @@ FIXTURE_TEST(test_upload_manifest, s3_imposter_fixture) { // NOLINT
       });
     archiver.upload_manifest().get();
     auto req = get_requests().front();
-    // NOLINTNEXTLINE
-    BOOST_REQUIRE(compare_json_objects(req.content, manifest_payload));
+    // the manifest is uploaded in the binary representation; compare it
+    // logically against the expected json payload
+    auto uploaded = load_manifest(req.content);
+    BOOST_REQUIRE(uploaded == load_manifest(manifest_payload)); // NOLINT
 }
 
 // NOLINTNEXTLINE
 FIXTURE_TEST(test_upload_segments, archiver_fixture) {
     set_expectations_and_listen(default_expectations);
-    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration());
-    auto action = ss::defer([&archiver] { archiver.stop().get(); });
+    auto pool = make_client_pool();
+    archival::ntp_archiver archiver(get_ntp_conf(), get_configuration(), pool);
+    auto action = ss::defer([&archiver, pool] {
+        archiver.stop().get();
+        pool->stop().get();
+    });
 
     std::vector<segment_desc> segments = {
       {manifest_ntp, model::offset(1), model::term_id(2)},
@@ -184,9 +233,10 @@ FIXTURE_TEST(test_upload_segments, archiver_fixture) {
         vlog(test_log.error, "{}", url);
     }
     BOOST_REQUIRE_EQUAL(get_requests().size(), 3);
-    BOOST_REQUIRE(get_targets().count(manifest_url)); // NOLINT
+    // newly uploaded segments are shipped as a manifest delta
+    BOOST_REQUIRE(get_targets().count(delta0_manifest_url)); // NOLINT
     {
-        auto it = get_targets().find(manifest_url);
+        auto it = get_targets().find(delta0_manifest_url);
         const auto& [url, req] = *it;
         verify_manifest_content(req.content);
         BOOST_REQUIRE(req._method == "PUT"); // NOLINT
@@ -282,4 +332,15 @@ FIXTURE_TEST(test_archiver_policy, archiver_fixture) {
     auto upload4 = policy.get_next_candidate(
       upload3.source->offsets().committed_offset + model::offset(1), lm);
     BOOST_REQUIRE(upload4.source.get() == nullptr);
+
+    // A coalescing policy can't merge these segments because their
+    // offsets are not adjacent, so the candidate stays a single segment
+    archival::archival_policy coalescing_policy(manifest_ntp, 1024 * 1024);
+    auto upload5 = coalescing_policy.get_next_candidate(model::offset(0), lm);
+    log_upload_candidate(upload5);
+    BOOST_REQUIRE(upload5.source.get() != nullptr);
+    BOOST_REQUIRE(upload5.tail_sources.empty());
+    BOOST_REQUIRE(
+      upload5.last_included_offset()
+      == upload5.source->offsets().committed_offset);
 }
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/vectorizedio/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "archival/manifest.h"
+#include "archival/remote_fetcher.h"
+#include "archival/tests/service_fixture.h"
+#include "model/fundamental.h"
+#include "model/limits.h"
+#include "model/record_batch_reader.h"
+#include "test_utils/fixture.h"
+#include "units.h"
+
+#include <seastar/core/sstring.hh>
+#include <seastar/util/defer.hh>
+
+using namespace archival;
+
+inline ss::logger fetch_test_log("remote-fetch-test"); // NOLINT
+
+static const model::ntp test_ntp( // NOLINT
+  model::ns("test-ns"),
+  model::topic("test-topic"),
+  model::partition_id(42));
+static const model::revision_id test_rev(0); // NOLINT
+
+// NOLINTNEXTLINE
+FIXTURE_TEST(test_remote_fetch, archiver_fixture) {
+    std::vector<segment_desc> segments = {
+      {test_ntp, model::offset(1), model::term_id(2)},
+      {test_ntp, model::offset(1000), model::term_id(4)},
+    };
+    init_storage_api_local(segments);
+
+    // Build a manifest that describes the local segments and serve their
+    // content through the S3 imposter
+    archival::manifest m(test_ntp, test_rev);
+    std::vector<s3_imposter_fixture::expectation> expectations;
+    for (const auto& desc : segments) {
+        auto name = archival::segment_name(
+          fmt::format("{}-{}-v1.log", desc.base_offset(), desc.term()));
+        auto segment = get_segment(test_ntp, name);
+        BOOST_REQUIRE(segment.get() != nullptr);
+        auto stream = segment->offset_data_stream(
+          segment->offsets().base_offset, ss::default_priority_class());
+        auto tmp = stream.read_exactly(segment->size_bytes()).get0();
+        stream.close().get();
+        m.add(
+          name,
+          archival::manifest::segment_meta{
+            .is_compacted = false,
+            .size_bytes = segment->size_bytes(),
+            .base_offset = segment->offsets().base_offset,
+            .committed_offset = segment->offsets().committed_offset,
+          });
+        expectations.push_back({
+          .url = "/" + m.get_remote_segment_path(name)().string(),
+          .body = ss::sstring(tmp.get(), tmp.size()),
+        });
+    }
+    set_expectations_and_listen(expectations);
+
+    auto conf = get_configuration();
+    auto pool = ss::make_lw_shared<s3::client_pool>(
+      conf.connection_limit(), conf.client_config);
+    archival::remote_fetcher fetcher(
+      conf.bucket_name, pool, conf.read_cache_size);
+    auto action = ss::defer([&fetcher, pool] {
+        fetcher.stop().get();
+        pool->stop().get();
+    });
+
+    const auto max = model::model_limits<model::offset>::max();
+    auto reader = fetcher.fetch(m, model::offset(1), max, 10_MiB).get0();
+    auto batches = model::consume_reader_to_memory(
+                     std::move(reader), model::no_timeout)
+                     .get0();
+    BOOST_REQUIRE(!batches.empty());
+    BOOST_REQUIRE_EQUAL(batches.front().base_offset(), model::offset(1));
+    // the batches should be ordered and non-overlapping and the read
+    // should cross the segment boundary
+    auto expected = batches.front().base_offset();
+    bool second_segment_read = false;
+    for (const auto& b : batches) {
+        BOOST_REQUIRE(b.base_offset() >= expected);
+        expected = b.last_offset() + model::offset(1);
+        second_segment_read = second_segment_read
+                              || b.base_offset() >= model::offset(1000);
+    }
+    BOOST_REQUIRE(second_segment_read);
+
+    // the repeated read should be served from the cache
+    auto num_requests = get_requests().size();
+    auto cached_reader = fetcher.fetch(m, model::offset(1), max, 10_MiB)
+                           .get0();
+    auto cached_batches = model::consume_reader_to_memory(
+                            std::move(cached_reader), model::no_timeout)
+                            .get0();
+    BOOST_REQUIRE_EQUAL(cached_batches.size(), batches.size());
+    BOOST_REQUIRE_EQUAL(get_requests().size(), num_requests);
+
+    // the read that starts in the second segment shouldn't touch the
+    // first one
+    auto tail_reader = fetcher.fetch(m, model::offset(1000), max, 10_MiB)
+                         .get0();
+    auto tail_batches = model::consume_reader_to_memory(
+                          std::move(tail_reader), model::no_timeout)
+                          .get0();
+    BOOST_REQUIRE(!tail_batches.empty());
+    BOOST_REQUIRE_EQUAL(tail_batches.front().base_offset(), model::offset(1000));
+}
@@ -19,6 +19,7 @@
 #include "storage/disk_log_impl.h"
 #include "storage/tests/utils/random_batch.h"
 #include "test_utils/async.h"
+#include "units.h"
 
 #include <seastar/core/circular_buffer.hh>
 #include <seastar/core/coroutine.hh>
@@ -86,6 +87,10 @@ archival::configuration get_configuration() {
     conf.client_config = s3conf;
     conf.bucket_name = s3::bucket_name("test-bucket");
     conf.connection_limit = archival::s3_connection_limit(10);
+    conf.upload_part_size = archival::s3_upload_part_size(32_MiB);
+    conf.part_upload_limit = archival::s3_part_upload_limit(4);
+    conf.segment_upload_concurrency = archival::segment_upload_limit(4);
+    conf.read_cache_size = archival::segment_read_cache_size(128_MiB);
     return conf;
 }
 
@@ -64,7 +64,9 @@ FIXTURE_TEST(test_reconciliation_manifest_download, archiver_fixture) {
     })json";
     set_expectations_and_listen({
       {.url = urls[0], .body = manifest_json},
+      {.url = ss::sstring(urls[0]) + ".0", .body = std::nullopt},
       {.url = urls[1], .body = std::nullopt},
+      {.url = ss::sstring(urls[1]) + ".0", .body = std::nullopt},
       {.url = urls[2], .body = std::nullopt},
     });
 
@@ -95,6 +97,7 @@ FIXTURE_TEST(test_reconciliation_drop_ntp, archiver_fixture) {
       = "/20000000/meta/test-namespace/topic_2/topic_manifest.json";
     set_expectations_and_listen({
       {.url = url, .body = std::nullopt},
+      {.url = ss::sstring(url) + ".0", .body = std::nullopt},
       {.url = topic_url, .body = std::nullopt},
     });
 
@@ -129,12 +132,15 @@ FIXTURE_TEST(test_segment_upload, archiver_fixture) {
 
     const char* manifest_url
       = "/c0000000/meta/test-namespace/topic_3/0_2/manifest.json";
+    const char* delta_manifest_url
+      = "/c0000000/meta/test-namespace/topic_3/0_2/manifest.json.0";
     const char* topic_url
       = "/00000000/meta/test-namespace/topic_3/topic_manifest.json";
     const char* seg000 = "/e34f82da/test-namespace/topic_3/0_2/0-0-v1.log";
     const char* seg100 = "/dd2813e1/test-namespace/topic_3/0_2/100-0-v1.log";
     set_expectations_and_listen({
       {.url = manifest_url, .body = std::nullopt},
+      {.url = delta_manifest_url, .body = std::nullopt},
       {.url = topic_url, .body = std::nullopt},
       {.url = seg000, .body = std::nullopt},
       {.url = seg100, .body = std::nullopt},
@@ -168,8 +174,9 @@ FIXTURE_TEST(test_segment_upload, archiver_fixture) {
 
     (void)service.run_uploads();
 
-    // 2 partition manifests, 1 topic manifest, 2 segments
-    const size_t num_requests_expected = 5;
+    // 2 GETs for the partition manifest and the delta probe, 1 manifest
+    // delta PUT, 1 topic manifest PUT, 2 segment PUTs
+    const size_t num_requests_expected = 6;
     tests::cooperative_spin_wait_with_timeout(10s, [this] {
         return get_requests().size() == num_requests_expected;
     }).get();
@@ -178,8 +185,14 @@ FIXTURE_TEST(test_segment_upload, archiver_fixture) {
     auto manifest_req = get_targets().equal_range(manifest_url);
     BOOST_REQUIRE(manifest_req.first != manifest_req.second);
     for (auto it = manifest_req.first; it != manifest_req.second; it++) {
+        BOOST_REQUIRE(it->second._method == "GET");
+    }
+
+    // newly uploaded segments are shipped as a manifest delta
+    auto delta_req = get_targets().equal_range(delta_manifest_url);
+    BOOST_REQUIRE(delta_req.first != delta_req.second);
+    for (auto it = delta_req.first; it != delta_req.second; it++) {
         if (it->second._method == "PUT") {
-            BOOST_REQUIRE(it->second._method == "PUT");
             verify_manifest_content(it->second.content);
         } else {
             BOOST_REQUIRE(it->second._method == "GET");
@@ -34,6 +34,22 @@ using local_segment_path
 /// Number of simultaneous connections to S3
 using s3_connection_limit
   = named_type<size_t, struct archival_s3_connection_limit_t>;
+/// Size of a single part of the multipart segment upload
+using s3_upload_part_size
+  = named_type<size_t, struct archival_s3_upload_part_size_t>;
+/// Number of simultaneous part uploads per segment
+using s3_part_upload_limit
+  = named_type<size_t, struct archival_s3_part_upload_limit_t>;
+/// Number of segments that a single ntp_archiver uploads in parallel
+using segment_upload_limit
+  = named_type<size_t, struct archival_segment_upload_limit_t>;
+/// Size of the cache that stores segments hydrated from S3
+using segment_read_cache_size
+  = named_type<size_t, struct archival_segment_read_cache_size_t>;
+/// Desired lower bound on the size of an uploaded object, consecutive
+/// small segments are coalesced into one object to reach it
+using s3_min_object_size
+  = named_type<size_t, struct archival_s3_min_object_size_t>;
 
 enum class download_manifest_result : int32_t {
     success,
@@ -43,6 +59,13 @@ enum class download_manifest_result : int32_t {
 
 enum class manifest_version : int32_t {
     v1 = 1,
+    // compact binary representation encoded with reflection::adl. the
+    // first serialized field is this version number whose first byte can
+    // never be '{', so the binary and json formats are distinguishable
+    v2 = 2,
+    // v2 plus a per-segment list of boundaries that locates every source
+    // segment inside a coalesced upload object
+    v3 = 3,
 };
 
 enum class topic_manifest_version : int32_t {
@@ -11,6 +11,7 @@
 
 #pragma once
 #include "seastarx.h"
+#include "vassert.h"
 
 #include <seastar/core/bitops.hh>
 
@@ -18,6 +19,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace details {
 class io_allocation_size {
@@ -54,6 +56,51 @@ public:
         131072}};
     static size_t next_allocation_size(size_t data_size);
 
+    // the growth progression actually consulted on this shard. defaults to
+    // alloc_table; deployments whose fragment size distribution is known
+    // (e.g. measured with the iobuf fragment metrics) can install a table
+    // fitted to it at startup. per-shard so no locking is needed.
+    static std::vector<uint32_t>& allocation_table() {
+        static thread_local std::vector<uint32_t> table{
+          alloc_table.begin(), alloc_table.end()};
+        return table;
+    }
+
+    // replaces the shard's growth progression. must be called before the
+    // shard allocates iobufs it cares about - existing fragments are
+    // unaffected. the table must be strictly ascending so the allocator
+    // keeps making forward progress.
+    static void configure_allocation_table(std::vector<uint32_t> table) {
+        vassert(!table.empty(), "iobuf allocation table must not be empty");
+        for (size_t i = 1; i < table.size(); ++i) {
+            vassert(
+              table[i - 1] < table[i],
+              "iobuf allocation table must be strictly ascending: {} >= {}",
+              table[i - 1],
+              table[i]);
+        }
+        allocation_table() = std::move(table);
+    }
+
+    // the smallest chunk we hand out for a tiny first append
+    static constexpr size_t min_chunk_size = 64;
+
+    // sizing for the first fragment of an iobuf. the rpc and kafka codec
+    // paths create millions of tiny buffers (headers, key/value slices)
+    // that never grow past their initial append, so the first chunk is
+    // sized from the requested bytes alone - rounded up to a power of two
+    // small size class - instead of the growth table's 768 byte minimum.
+    // larger first appends keep using the growth table.
+    static size_t first_allocation_size(size_t data_size) {
+        if (data_size >= allocation_table().front()) {
+            return next_allocation_size(data_size);
+        }
+        return std::max(
+          min_chunk_size,
+          static_cast<size_t>(1) << ss::log2ceil(
+            std::max(data_size, size_t(1))));
+    }
+
     // if the size falls into the range of seastar's small allocator, allow a
     // full allocation. otherwise, allocate on lower bound power of 2 size which
     // aligns with a span bucket in seastar's large allocation pool.
@@ -70,10 +117,11 @@ public:
 //   - uses folly::vector of 1.5 growth without using double conversions
 inline size_t io_allocation_size::next_allocation_size(size_t data_size) {
     // size_t next_size = ((_next_alloc_sz * 3) + 1) / 2;
-    if (data_size > alloc_table.back()) {
-        return alloc_table.back();
+    const auto& table = allocation_table();
+    if (data_size > table.back()) {
+        return table.back();
     }
-    for (auto x : alloc_table) {
+    for (auto x : table) {
         // should be <, because we want forward progress in the allocator
         // chunks. so if you call the allocator with 512, you'll get 768, and if
         // you call the allocator with 768, you'll get 1152, and so on.
@@ -81,7 +129,7 @@ inline size_t io_allocation_size::next_allocation_size(size_t data_size) {
             return x;
         }
     }
-    return alloc_table.back();
+    return table.back();
 }
 
 } // namespace details
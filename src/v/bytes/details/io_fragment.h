@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/details/io_fragment_stats.h"
 #include "bytes/details/out_of_range.h"
 #include "seastarx.h"
 #include "utils/intrusive_list_helpers.h"
@@ -26,15 +27,24 @@ public:
 
     io_fragment(ss::temporary_buffer<char> buf, full)
       : _buf(std::move(buf))
-      , _used_bytes(_buf.size()) {}
+      , _used_bytes(_buf.size()) {
+        io_fragment_stats::local().note_alloc(_buf.size());
+    }
     io_fragment(ss::temporary_buffer<char> buf, empty)
       : _buf(std::move(buf))
-      , _used_bytes(0) {}
+      , _used_bytes(0) {
+        io_fragment_stats::local().note_alloc(_buf.size());
+    }
     io_fragment(io_fragment&& o) noexcept = delete;
     io_fragment& operator=(io_fragment&& o) noexcept = delete;
     io_fragment(const io_fragment& o) = delete;
     io_fragment& operator=(const io_fragment& o) = delete;
-    ~io_fragment() noexcept = default;
+    ~io_fragment() noexcept {
+        // release() leaves an empty buffer behind; nothing to account then
+        if (_buf.size() > 0) {
+            io_fragment_stats::local().note_free(_buf.size(), _used_bytes);
+        }
+    }
 
     bool operator==(const io_fragment& o) const {
         return _used_bytes == o._used_bytes && _buf == o._buf;
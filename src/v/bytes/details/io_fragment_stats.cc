@@ -0,0 +1,60 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/details/io_fragment_stats.h"
+
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace details {
+
+void io_fragment_stats::setup_metrics() {
+    namespace sm = ss::metrics;
+    auto class_label = sm::label("size_class");
+    std::vector<sm::metric_definition> defs;
+    for (size_t i = 0; i < num_classes; ++i) {
+        const std::vector<sm::label_instance> labels = {
+          class_label(size_t(1) << (i + min_class_log2))};
+        auto& c = _classes[i];
+        defs.push_back(sm::make_derive(
+          "fragments_allocated",
+          [&c] { return c.allocated; },
+          sm::description("Total iobuf fragments allocated in this class"),
+          labels));
+        defs.push_back(sm::make_derive(
+          "fragments_freed",
+          [&c] { return c.freed; },
+          sm::description("Total iobuf fragments freed in this class"),
+          labels));
+        defs.push_back(sm::make_derive(
+          "capacity_bytes_freed",
+          [&c] { return c.capacity_bytes_freed; },
+          sm::description("Capacity of freed fragments; together with "
+                          "used_bytes_freed measures internal fragmentation"),
+          labels));
+        defs.push_back(sm::make_derive(
+          "used_bytes_freed",
+          [&c] { return c.used_bytes_freed; },
+          sm::description("Bytes actually written in freed fragments"),
+          labels));
+        defs.push_back(sm::make_gauge(
+          "fragments_live",
+          [&c] {
+              return c.allocated >= c.freed ? c.allocated - c.freed
+                                            : uint64_t(0);
+          },
+          sm::description("Approximate live fragments in this class"),
+          labels));
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("iobuf"), std::move(defs));
+}
+
+} // namespace details
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+
+#include <seastar/core/bitops.hh>
+#include <seastar/core/metrics_registration.hh>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace details {
+
+/// Per-shard accounting of io_fragment allocations, bucketed by power of
+/// two size class from 64 bytes through 128 KiB. The point is to measure
+/// internal fragmentation: used_bytes_freed / capacity_bytes_freed of a
+/// class is the fraction of allocated buffer memory that ever held data,
+/// and allocated - freed approximates the live fragment count. trim() and
+/// release() can move a fragment to a smaller class between allocation
+/// and destruction, so per-class live counts may drift; the counters
+/// themselves are exact.
+class io_fragment_stats {
+public:
+    static constexpr size_t min_class_log2 = 6;
+    static constexpr size_t max_class_log2 = 17;
+    static constexpr size_t num_classes = max_class_log2 - min_class_log2 + 1;
+
+    struct size_class {
+        uint64_t allocated{0};
+        uint64_t freed{0};
+        uint64_t capacity_bytes_freed{0};
+        uint64_t used_bytes_freed{0};
+    };
+
+    /// index of the class whose upper bound covers the capacity
+    static size_t class_of(size_t capacity) {
+        const auto log2 = static_cast<size_t>(
+          ss::log2ceil(std::max(capacity, size_t(1))));
+        return std::clamp(log2, min_class_log2, max_class_log2)
+               - min_class_log2;
+    }
+
+    void note_alloc(size_t capacity) {
+        ++_classes[class_of(capacity)].allocated;
+    }
+
+    void note_free(size_t capacity, size_t used) {
+        auto& c = _classes[class_of(capacity)];
+        ++c.freed;
+        c.capacity_bytes_freed += capacity;
+        c.used_bytes_freed += used;
+    }
+
+    const std::array<size_class, num_classes>& classes() const {
+        return _classes;
+    }
+
+    /// registers the shard's counters under the "vectorized_iobuf" group,
+    /// one series set per size class
+    void setup_metrics();
+
+    static io_fragment_stats& local() {
+        static thread_local io_fragment_stats stats;
+        return stats;
+    }
+
+private:
+    std::array<size_class, num_classes> _classes{};
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace details
@@ -165,6 +165,10 @@ public:
     size_t bytes_consumed() const { return _bytes_consumed; }
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     size_t segment_bytes_left() const { return _frag_index_end - _frag_index; }
+    /// pointer into the current fragment, valid for segment_bytes_left()
+    /// bytes. lets decoders work on contiguous memory instead of the
+    /// byte-for-byte iterator when a value cannot straddle fragments
+    const char* segment_index() const { return _frag_index; }
     bool is_finished() const { return _frag == _frag_end; }
 
     /// starts a new iterator byte-for-byte starting at *this* index
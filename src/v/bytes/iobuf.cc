@@ -16,9 +16,11 @@
 #include <seastar/core/do_with.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/when_all.hh>
 
 #include <iostream>
 #include <limits>
+#include <vector>
 
 std::ostream& operator<<(std::ostream& o, const iobuf& io) {
     return o << "{bytes=" << io.size_bytes()
@@ -181,6 +183,122 @@ iobuf iobuf::share(size_t pos, size_t len) {
     return ret;
 }
 
+namespace {
+
+/*
+ * Per-shard parking lot for buffer references owned by other shards.
+ * Deleters are not safe to run off their home shard, and a submit_to per
+ * fragment costs a cross-shard message per page. Remote destruction parks
+ * the reference here instead and batches are handed back to each owner
+ * with a single message.
+ */
+struct foreign_release_queue {
+    // references parked for one owner before an early flush kicks in
+    static constexpr size_t max_pending_per_owner = 128;
+    // one bucket per owner shard, sized on first use
+    std::vector<std::vector<ss::temporary_buffer<char>>> buckets;
+    bool flush_scheduled{false};
+};
+
+thread_local foreign_release_queue release_queue;
+
+ss::future<> flush_owner_bucket(ss::shard_id owner) {
+    auto batch = std::exchange(release_queue.buckets[owner], {});
+    if (batch.empty()) {
+        return ss::make_ready_future<>();
+    }
+    // dropping the vector on the owner shard runs every deleter there
+    return ss::smp::submit_to(
+      owner, [batch = std::move(batch)]() mutable { batch.clear(); });
+}
+
+void schedule_foreign_flush() {
+    if (release_queue.flush_scheduled) {
+        return;
+    }
+    release_queue.flush_scheduled = true;
+    // run once the current task queue drains so that every release from
+    // this reactor poll shares the same round trips
+    (void)ss::later().then([] {
+        release_queue.flush_scheduled = false;
+        return iobuf::drain_foreign_releases();
+    });
+}
+
+void park_foreign_release(ss::shard_id owner, ss::temporary_buffer<char> buf) {
+    if (release_queue.buckets.size() < ss::smp::count) {
+        release_queue.buckets.resize(ss::smp::count);
+    }
+    auto& bucket = release_queue.buckets[owner];
+    bucket.push_back(std::move(buf));
+    if (bucket.size() >= foreign_release_queue::max_pending_per_owner) {
+        (void)flush_owner_bucket(owner);
+        return;
+    }
+    schedule_foreign_flush();
+}
+
+} // namespace
+
+ss::future<> iobuf::drain_foreign_releases() {
+    auto& buckets = release_queue.buckets;
+    std::vector<ss::future<>> flushes;
+    for (ss::shard_id owner = 0; owner < buckets.size(); ++owner) {
+        if (!buckets[owner].empty()) {
+            flushes.push_back(flush_owner_bucket(owner));
+        }
+    }
+    if (flushes.empty()) {
+        return ss::make_ready_future<>();
+    }
+    return ss::when_all_succeed(flushes.begin(), flushes.end());
+}
+
+iobuf iobuf::foreign_share() {
+    oncore_debug_verify(_verify_shard);
+    const auto owner = ss::this_shard_id();
+    iobuf ret;
+    for (auto& frag : _frags) {
+        if (frag.is_empty()) {
+            continue;
+        }
+        auto buf = frag.share();
+        auto* data = buf.get_write();
+        const auto size = buf.size();
+        // the wrapping buffer aliases the shared one; the deleter keeps the
+        // real reference and decides where it may be dropped
+        auto f = new fragment( // NOLINT
+          ss::temporary_buffer<char>(
+            data,
+            size,
+            ss::make_deleter([owner, buf = std::move(buf)]() mutable {
+                if (owner == ss::this_shard_id()) {
+                    buf = ss::temporary_buffer<char>{};
+                    return;
+                }
+                park_foreign_release(owner, std::move(buf));
+            })),
+          fragment::full{});
+        ret.append_take_ownership(f);
+    }
+    return ret;
+}
+
+iobuf iobuf::foreign_adopt(iobuf&& source) {
+    // deliberately bypasses the mutating api (and with it the debug-mode
+    // core affinity check): the fragments move between lists untouched and
+    // their deleters remain safe to run here
+    iobuf ret;
+    ret._size = source._size;
+    source._size = 0;
+    while (!source._frags.empty()) {
+        auto& f = source._frags.front();
+        source._frags.pop_front();
+        ret._frags.push_back(f);
+    }
+    return ret;
+}
+
 bool iobuf::operator==(const iobuf& o) const {
     if (_size != o._size) {
         return false;
@@ -112,6 +112,23 @@ public:
     /// shares the underlying temporary buffers
     iobuf share(size_t pos, size_t len);
 
+    /// shares the underlying buffers for use on another shard. the result
+    /// may be moved to and destroyed on any shard: every fragment records
+    /// this shard as its owner, and destruction on a remote shard parks the
+    /// reference on that shard's release queue, which is handed back to the
+    /// owner one cross-shard message per batch instead of one per fragment
+    iobuf foreign_share();
+
+    /// take over the fragments of an iobuf that was foreign_share()d on
+    /// another shard, rebinding it to this shard without copying. must be
+    /// called before the buffer is used locally
+    static iobuf foreign_adopt(iobuf&&);
+
+    /// hand the foreign buffer references parked on this shard back to
+    /// their owners now instead of at the next scheduled flush. normal
+    /// operation flushes automatically; exposed for tests
+    static ss::future<> drain_foreign_releases();
+
     /**
      * Copying an iobuf is optimized for cases where the size of the resulting
      * iobuf will not be increased (e.g. via iobuf::append).
@@ -128,6 +145,11 @@ public:
     /// as an empty details::io_fragment
     void reserve_memory(size_t reservation);
 
+    /// like reserve_memory but the new fragment has exactly the requested
+    /// capacity, bypassing the allocation growth table. for callers that
+    /// know the final size of a small buffer up front
+    void reserve_memory_exact(size_t reservation);
+
     /// append src + len into storage
     void append(const char*, size_t);
     /// append src + len into storage
@@ -233,6 +255,15 @@ inline void iobuf::prepend_take_ownership(fragment* f) {
 
 inline void iobuf::create_new_fragment(size_t sz) {
     oncore_debug_verify(_verify_shard);
+    if (_frags.empty()) {
+        // tiny buffers are right-sized instead of starting on the growth
+        // table; see first_allocation_size
+        auto asz = details::io_allocation_size::first_allocation_size(sz);
+        auto f = new fragment(
+          ss::temporary_buffer<char>(asz), fragment::empty{});
+        append_take_ownership(f);
+        return;
+    }
     auto chunk_max = std::max(sz, last_allocation_size());
     auto asz = details::io_allocation_size::next_allocation_size(chunk_max);
     auto f = new fragment(ss::temporary_buffer<char>(asz), fragment::empty{});
@@ -260,6 +291,19 @@ inline void iobuf::reserve_memory(size_t reservation) {
     }
 }
 
+inline void iobuf::reserve_memory_exact(size_t reservation) {
+    oncore_debug_verify(_verify_shard);
+    vassert(reservation, "zero length reservations are unsupported");
+    if (auto b = available_bytes(); b < reservation) {
+        if (b > 0) {
+            _frags.back().trim();
+        }
+        auto f = new fragment(
+          ss::temporary_buffer<char>(reservation), fragment::empty{});
+        append_take_ownership(f);
+    }
+}
+
 [[gnu::always_inline]] void inline iobuf::prepend(
   ss::temporary_buffer<char> b) {
     if (unlikely(!b.size())) {
@@ -20,6 +20,8 @@
 #include <seastar/core/sstring.hh>
 
 #include <memory>
+#include <optional>
+#include <string_view>
 
 /**
  * iobuf parser interface suitable for an iobuf passed by const-ref. also
@@ -46,6 +48,14 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
+        // fast path: a maximum length encoding fits in the current fragment,
+        // decode from contiguous memory instead of the byte iterator
+        if (likely(_in.segment_bytes_left() >= vint::max_length)) {
+            auto [val, length_size] = vint::deserialize(
+              _in.segment_index(), vint::max_length);
+            _in.skip(length_size);
+            return {val, length_size};
+        }
         auto [val, length_size] = vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
@@ -64,6 +74,34 @@ public:
         return b;
     }
 
+    /// borrowed view over the next len bytes when they are contiguous in
+    /// the current fragment; valid while the parser's iobuf is alive and
+    /// unmodified. returns std::nullopt when the bytes span a fragment
+    /// boundary - nothing is consumed in that case, the caller falls back
+    /// to the owning read_string
+    std::optional<std::string_view> read_string_view(size_t len) {
+        if (likely(_in.segment_bytes_left() >= len)) {
+            std::string_view v(_in.segment_index(), len);
+            validate_utf8(v);
+            _in.skip(len);
+            return v;
+        }
+        return std::nullopt;
+    }
+
+    /// borrowed counterpart of read_bytes with the same contiguity and
+    /// lifetime rules as read_string_view
+    std::optional<bytes_view> share_bytes_view(size_t n) {
+        if (likely(_in.segment_bytes_left() >= n)) {
+            // NOLINTNEXTLINE
+            bytes_view v(
+              reinterpret_cast<const uint8_t*>(_in.segment_index()), n);
+            _in.skip(n);
+            return v;
+        }
+        return std::nullopt;
+    }
+
     bool read_bool() { return bool(consume_type<int8_t>()); }
 
     template<typename T>
@@ -76,6 +114,8 @@ public:
         return _in.consume_be_type<T>();
     }
 
+    void consume_to(size_t n, char* dst) { _in.consume_to(n, dst); }
+
     void skip(size_t n) { _in.skip(n); }
 
     // clang-format off
@@ -11,6 +11,7 @@
 #include "bytes/details/io_allocation_size.h"
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_istreambuf.h"
+#include "bytes/iobuf_parser.h"
 #include "bytes/iobuf_ostreambuf.h"
 #include "bytes/tests/utils.h"
 
@@ -373,6 +374,66 @@ SEASTAR_THREAD_TEST_CASE(alloctor_forward_progress) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(iobuf_small_first_allocation) {
+    iobuf buf;
+    buf.append("abc", 3);
+    BOOST_REQUIRE_EQUAL(std::distance(buf.begin(), buf.end()), 1);
+    // tiny first appends get a right-sized small chunk
+    BOOST_REQUIRE_EQUAL(buf.begin()->capacity(), 64);
+    iobuf mid;
+    const auto b = random_generators::gen_alphanum_string(100);
+    mid.append(b.data(), b.size());
+    BOOST_REQUIRE_EQUAL(mid.begin()->capacity(), 128);
+    // first appends past the default chunk size use the growth table
+    iobuf big;
+    const auto c = random_generators::gen_alphanum_string(600);
+    big.append(c.data(), c.size());
+    BOOST_REQUIRE_EQUAL(big.begin()->capacity(), 768);
+}
+
+SEASTAR_THREAD_TEST_CASE(iobuf_reserve_memory_exact) {
+    iobuf buf;
+    buf.reserve_memory_exact(1000);
+    BOOST_REQUIRE_EQUAL(std::distance(buf.begin(), buf.end()), 1);
+    BOOST_REQUIRE_EQUAL(buf.begin()->capacity(), 1000);
+    const auto b = random_generators::gen_alphanum_string(1000);
+    buf.append(b.data(), b.size());
+    // the append fits the reservation without growing the buffer
+    BOOST_REQUIRE_EQUAL(std::distance(buf.begin(), buf.end()), 1);
+    BOOST_REQUIRE_EQUAL(buf.size_bytes(), 1000);
+}
+
+SEASTAR_THREAD_TEST_CASE(iobuf_parser_read_string_view) {
+    iobuf buf;
+    buf.append("hello world", 11);
+    iobuf_const_parser p(buf);
+    auto v = p.read_string_view(5);
+    BOOST_REQUIRE(v.has_value());
+    BOOST_REQUIRE_EQUAL(*v, "hello");
+    BOOST_REQUIRE_EQUAL(p.bytes_consumed(), 5);
+    p.skip(1);
+    auto b = p.share_bytes_view(5);
+    BOOST_REQUIRE(b.has_value());
+    BOOST_REQUIRE_EQUAL(p.bytes_left(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(iobuf_parser_read_string_view_fragmented) {
+    // fill the 64 byte first fragment exactly so "hello" straddles the
+    // fragment boundary
+    iobuf buf;
+    const auto prefix = random_generators::gen_alphanum_string(61);
+    buf.append(prefix.data(), prefix.size());
+    buf.append("hello", 5);
+    BOOST_REQUIRE_EQUAL(std::distance(buf.begin(), buf.end()), 2);
+    iobuf_const_parser p(buf);
+    p.skip(prefix.size());
+    auto v = p.read_string_view(5);
+    // no contiguous run of 5 bytes: nothing consumed, caller falls back
+    BOOST_REQUIRE(!v.has_value());
+    BOOST_REQUIRE_EQUAL(p.bytes_consumed(), prefix.size());
+    BOOST_REQUIRE_EQUAL(p.read_string(5), "hello");
+}
+
 SEASTAR_THREAD_TEST_CASE(test_next_chunk_allocation_append_temp_buf) {
     const auto b = random_generators::gen_alphanum_string(1024);
 
@@ -618,3 +679,24 @@ SEASTAR_THREAD_TEST_CASE(iobuf_string_view_cmp) {
         BOOST_REQUIRE_EQUAL(buf, std::string_view(str));
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_foreign_share_and_adopt) {
+    iobuf buf;
+    append_sequence(buf, 20);
+
+    auto shared = buf.foreign_share();
+    BOOST_REQUIRE_EQUAL(shared, buf);
+
+    // the adopted buffer references the same pages and supports the normal
+    // mutating operations on this shard
+    auto adopted = iobuf::foreign_adopt(std::move(shared));
+    BOOST_REQUIRE_EQUAL(adopted, buf);
+    adopted.append("tail", 4);
+    BOOST_REQUIRE_EQUAL(adopted.size_bytes(), buf.size_bytes() + 4);
+
+    // on the owner shard the release path is direct; drain is a no-op but
+    // must be safe to call
+    adopted = iobuf{};
+    iobuf::drain_foreign_releases().get();
+    BOOST_REQUIRE_EQUAL(buf.size_bytes(), 20 * characters_per_append);
+}
@@ -12,6 +12,7 @@
 #pragma once
 #include "bytes/iobuf.h"
 #include "hashing/crc32c.h"
+#include "hashing/xx.h"
 
 inline void crc_extend_iobuf(crc32& crc, const iobuf& buf) {
     auto in = iobuf::iterator_consumer(buf.cbegin(), buf.cend());
@@ -21,3 +22,12 @@ inline void crc_extend_iobuf(crc32& crc, const iobuf& buf) {
         return ss::stop_iteration::no;
     });
 }
+
+/// hash an iobuf fragment list in place - no coalescing, no copies
+inline uint64_t xxh3_64_iobuf(const iobuf& buf) {
+    incremental_xxh3 h;
+    for (const auto& frag : buf) {
+        h.update(frag.get(), frag.size());
+    }
+    return h.digest();
+}
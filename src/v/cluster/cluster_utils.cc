@@ -107,6 +107,9 @@ ss::future<> maybe_create_tcp_client(
                 .then(
                   [&cache, node, new_addr](
                     ss::shared_ptr<ss::tls::certificate_credentials>&& cert) {
+                      auto maintenance_interval
+                        = config::shard_local_cfg()
+                            .rpc_client_connection_maintenance_interval_ms();
                       return cache.emplace(
                         node,
                         rpc::transport_configuration{
@@ -115,7 +118,14 @@ ss::future<> maybe_create_tcp_client(
                           .disable_metrics = rpc::metrics_disabled(
                             config::shard_local_cfg().disable_metrics)},
                         rpc::make_exponential_backoff_policy<rpc::clock_type>(
-                          std::chrono::seconds(1), std::chrono::seconds(60)));
+                          std::chrono::seconds(1), std::chrono::seconds(60)),
+                        maintenance_interval > std::chrono::milliseconds(0)
+                          ? std::make_optional<rpc::clock_type::duration>(
+                            maintenance_interval)
+                          : std::nullopt,
+                        rpc::reconnect_transport::warm_standby(
+                          config::shard_local_cfg()
+                            .rpc_client_warm_standby_connections()));
                   });
           });
       });
@@ -27,12 +27,38 @@
 #include "likely.h"
 #include "model/metadata.h"
 #include "model/timeout_clock.h"
+#include "reflection/adl.h"
+#include "storage/api.h"
 
 #include <seastar/core/thread.hh>
 #include <seastar/util/later.hh>
 
 namespace cluster {
 
+namespace {
+
+/**
+ * Periodically persisted copy of the controller's replicated topic state.
+ * Loading it at startup lets the stm skip replaying every command at or
+ * below last_applied and replay only the log suffix written since the
+ * snapshot was taken.
+ */
+struct controller_state_snapshot {
+    static constexpr int8_t current_version = 0;
+    int8_t version{current_version};
+    model::offset last_applied;
+    std::vector<topic_configuration_assignment> topics;
+};
+
+constexpr std::chrono::seconds snapshot_interval(60);
+
+const bytes& controller_snapshot_key() {
+    static const bytes key("controller_state_snapshot");
+    return key;
+}
+
+} // namespace
+
 controller::controller(
   ss::sharded<rpc::connection_cache>& ccache,
   ss::sharded<partition_manager>& pm,
@@ -85,6 +111,7 @@ ss::future<> controller::start() {
             raft::persistent_last_applied::yes,
             std::ref(_tp_updates_dispatcher));
       })
+      .then([this] { return apply_controller_snapshot(); })
       .then([this] {
           return _tp_frontend.start(
             _raft0->self().id(),
@@ -118,8 +145,72 @@ ss::future<> controller::start() {
               return stm.wait(stm.bootstrap_last_applied(), model::no_timeout);
           });
       })
-      .then(
-        [this] { return _backend.invoke_on_all(&controller_backend::start); });
+      .then([this] {
+          return _backend.invoke_on_all(&controller_backend::start);
+      })
+      .then([this] {
+          _snapshot_timer.set_callback([this] {
+              (void)ss::with_gate(_gate, [this] {
+                  return maybe_write_controller_snapshot();
+              }).handle_exception([](const std::exception_ptr& e) {
+                  vlog(
+                    clusterlog.warn,
+                    "Error persisting controller state snapshot - {}",
+                    e);
+              });
+          });
+          _snapshot_timer.arm_periodic(snapshot_interval);
+      });
+}
+
+ss::future<> controller::apply_controller_snapshot() {
+    auto buf = _storage.local().kvs().get(
+      storage::kvstore::key_space::controller, controller_snapshot_key());
+    if (!buf) {
+        return ss::now();
+    }
+    auto snap = reflection::from_iobuf<controller_state_snapshot>(
+      std::move(*buf));
+    if (snap.version != controller_state_snapshot::current_version) {
+        vlog(
+          clusterlog.info,
+          "Ignoring controller state snapshot with unsupported version {}",
+          snap.version);
+        return ss::now();
+    }
+    vlog(
+      clusterlog.info,
+      "Seeding controller state from snapshot taken at offset {} with {} "
+      "topics",
+      snap.last_applied,
+      snap.topics.size());
+    _last_snapshot_offset = snap.last_applied;
+    auto last_applied = snap.last_applied;
+    return _tp_updates_dispatcher
+      .apply_snapshot(last_applied, std::move(snap.topics))
+      .then([this, last_applied] {
+          return _stm.invoke_on(
+            controller_stm_shard, [last_applied](controller_stm& stm) {
+                stm.start_from(last_applied + model::offset(1));
+            });
+      });
+}
+
+ss::future<> controller::maybe_write_controller_snapshot() {
+    auto last_applied = _raft0->read_last_applied();
+    if (last_applied <= _last_snapshot_offset) {
+        return ss::now();
+    }
+    controller_state_snapshot snap;
+    snap.last_applied = last_applied;
+    snap.topics = _tp_state.local().all_topic_assignments();
+    return _storage.local()
+      .kvs()
+      .put(
+        storage::kvstore::key_space::controller,
+        controller_snapshot_key(),
+        reflection::to_iobuf(std::move(snap)))
+      .then([this, last_applied] { _last_snapshot_offset = last_applied; });
 }
 
 ss::future<> controller::shutdown_input() {
@@ -137,17 +228,31 @@ ss::future<> controller::stop() {
         f = shutdown_input();
     }
 
+    _snapshot_timer.cancel();
+
     return f.then([this] {
-        return _backend.stop()
-          .then([this] { return _tp_frontend.stop(); })
-          .then([this] { return _stm.stop(); })
-          .then([this] { return _tp_state.stop(); })
-          .then([this] { return _members_manager.stop(); })
-          .then([this] { return _partition_allocator.stop(); })
-          .then([this] { return _partition_leaders.stop(); })
-          .then([this] { return _members_table.stop(); })
-          .then([this] { return _as.stop(); });
-    });
+        // best effort final snapshot, so that the next startup replays as
+        // little of the log as possible
+        return maybe_write_controller_snapshot().handle_exception(
+          [](const std::exception_ptr& e) {
+              vlog(
+                clusterlog.warn,
+                "Error persisting controller state snapshot - {}",
+                e);
+          });
+    })
+      .then([this] { return _gate.close(); })
+      .then([this] {
+          return _backend.stop()
+            .then([this] { return _tp_frontend.stop(); })
+            .then([this] { return _stm.stop(); })
+            .then([this] { return _tp_state.stop(); })
+            .then([this] { return _members_manager.stop(); })
+            .then([this] { return _partition_allocator.stop(); })
+            .then([this] { return _partition_leaders.stop(); })
+            .then([this] { return _members_table.stop(); })
+            .then([this] { return _as.stop(); });
+      });
 }
 
 } // namespace cluster
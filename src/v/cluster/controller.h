@@ -18,7 +18,9 @@
 #include "storage/fwd.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/timer.hh>
 
 #include <vector>
 
@@ -51,6 +53,11 @@ public:
     ss::future<> stop();
 
 private:
+    // bootstrap the stm from the last persisted state snapshot, so replay
+    // covers only the log suffix written since then
+    ss::future<> apply_controller_snapshot();
+    ss::future<> maybe_write_controller_snapshot();
+
     ss::sharded<ss::abort_source> _as;                     // instance per core
     ss::sharded<partition_allocator> _partition_allocator; // single instance
     ss::sharded<topic_table> _tp_state;                    // instance per core
@@ -68,6 +75,9 @@ private:
     ss::sharded<storage::api>& _storage;
     topic_updates_dispatcher _tp_updates_dispatcher;
     consensus_ptr _raft0;
+    ss::timer<> _snapshot_timer;
+    model::offset _last_snapshot_offset;
+    ss::gate _gate;
 };
 
 } // namespace cluster
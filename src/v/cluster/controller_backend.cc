@@ -51,13 +51,15 @@ bool is_configuration_up_to_date(
   const ss::lw_shared_ptr<partition>& partition,
   const std::vector<model::broker_shard>& bs,
   model::revision_id change_revision) {
-    auto group_cfg = partition->group_configuration();
+    // read-only helper on a hot reconciliation path: the shared snapshot
+    // avoids copying the broker list for every partition every pass
+    auto group_cfg = partition->group_configuration_snapshot();
     auto configuration_committed = partition->get_latest_configuration_offset()
                                    <= partition->committed_offset();
 
     // group configuration revision is older than expected, this configuration
     // isn't up to date.
-    if (group_cfg.revision_id() < change_revision) {
+    if (group_cfg->revision_id() < change_revision) {
         return false;
     }
 
@@ -81,7 +83,7 @@ bool is_configuration_up_to_date(
      * remove the partiton after other node claim update as finished.
      *
      */
-    if (includes_self && group_cfg.type() == raft::configuration_type::joint) {
+    if (includes_self && group_cfg->type() == raft::configuration_type::joint) {
         return false;
     }
     /*
@@ -97,7 +99,7 @@ bool is_configuration_up_to_date(
      * the same as expected, we claim configuration as being up to date
      */
     absl::flat_hash_set<model::node_id> all_ids;
-    for (auto& id : group_cfg.current_config().voters) {
+    for (auto& id : group_cfg->current_config().voters) {
         all_ids.emplace(id.id());
     }
     /**
@@ -108,7 +110,7 @@ bool is_configuration_up_to_date(
      * nodes will become a voters)
      */
     if (!includes_self) {
-        for (auto& id : group_cfg.current_config().learners) {
+        for (auto& id : group_cfg->current_config().learners) {
             all_ids.emplace(id.id());
         }
     }
@@ -169,11 +171,16 @@ ss::future<> controller_backend::bootstrap_controller_backend() {
 
 ss::future<> controller_backend::do_bootstrap() {
     return ss::parallel_for_each(
-      _topic_deltas.begin(),
-      _topic_deltas.end(),
-      [this](underlying_t::value_type& ntp_deltas) {
-          return bootstrap_ntp(ntp_deltas.first, ntp_deltas.second);
-      });
+             _topic_deltas.begin(),
+             _topic_deltas.end(),
+             [this](underlying_t::value_type& ntp_deltas) {
+                 return ss::with_semaphore(
+                   _partition_ops_sem, 1, [this, &ntp_deltas] {
+                       return bootstrap_ntp(
+                         ntp_deltas.first, ntp_deltas.second);
+                   });
+             })
+      .then([this] { return flush_shard_table_updates(); });
 }
 
 std::vector<topic_table::delta> calculate_bootstrap_deltas(
@@ -309,15 +316,21 @@ ss::future<> controller_backend::reconcile_ntp(deltas_t& deltas) {
 ss::future<> controller_backend::reconcile_topics() {
     return ss::with_semaphore(_topics_sem, 1, [this] {
         if (_topic_deltas.empty()) {
-            return ss::now();
+            // publish updates left over from an interrupted pass
+            return flush_shard_table_updates();
         }
-        // reconcile NTPs in parallel
+        // reconcile NTPs in parallel, with bounded concurrency as every
+        // partition operation may open files and create a raft group
         return ss::parallel_for_each(
                  _topic_deltas.begin(),
                  _topic_deltas.end(),
                  [this](underlying_t::value_type& ntp_deltas) {
-                     return reconcile_ntp(ntp_deltas.second);
+                     return ss::with_semaphore(
+                       _partition_ops_sem, 1, [this, &ntp_deltas] {
+                           return reconcile_ntp(ntp_deltas.second);
+                       });
                  })
+          .then([this] { return flush_shard_table_updates(); })
           .then([this] {
               // cleanup empty NTP keys
               for (auto it = _topic_deltas.cbegin();
@@ -403,7 +416,9 @@ ss::future<std::error_code> controller_backend::process_partition_update(
      * revision to catch up we will keep the partition alive until one of the
      * other nodes will send update_finished command
      */
-    if (partition && partition->group_configuration().revision_id() > rev) {
+    if (
+      partition
+      && partition->group_configuration_snapshot()->revision_id() > rev) {
         vlog(
           clusterlog.trace,
           "found newer revision for {}, finishing update to: {}",
@@ -579,13 +594,22 @@ ss::future<std::error_code> controller_backend::update_partition_replica_set(
     return ss::make_ready_future<std::error_code>(errc::not_leader);
 }
 
-ss::future<> controller_backend::add_to_shard_table(
-  model::ntp ntp, raft::group_id raft_group, uint32_t shard) {
-    // update shard_table: broadcast
-    return _shard_table.invoke_on_all(
-      [ntp = std::move(ntp), raft_group, shard](shard_table& s) mutable {
-          s.insert(std::move(ntp), shard);
-          s.insert(raft_group, shard);
+ss::future<> controller_backend::flush_shard_table_updates() {
+    if (_pending_shard_table_updates.empty()) {
+        return ss::now();
+    }
+    // update shard_table: a single broadcast covers all partitions created
+    // during the pass
+    return ss::do_with(
+      std::exchange(_pending_shard_table_updates, {}),
+      [this](std::vector<shard_table_update>& updates) {
+          return _shard_table.invoke_on_all(
+            [&updates](shard_table& s) {
+                for (auto& u : updates) {
+                    s.insert(u.ntp, u.shard);
+                    s.insert(u.group, u.shard);
+                }
+            });
       });
 }
 
@@ -624,11 +648,12 @@ ss::future<std::error_code> controller_backend::create_partition(
 
     return f
       .then([this, ntp = std::move(ntp), group_id]() mutable {
-          // we create only partitions that belongs to current shard
-          return add_to_shard_table(
-            std::move(ntp), group_id, ss::this_shard_id());
-      })
-      .then([] { return make_error_code(errc::success); });
+          // we create only partitions that belongs to current shard, the
+          // shard table broadcast is deferred to the end of the pass
+          _pending_shard_table_updates.push_back(shard_table_update{
+            std::move(ntp), group_id, ss::this_shard_id()});
+          return make_error_code(errc::success);
+      });
 }
 
 ss::future<std::error_code>
@@ -645,6 +670,15 @@ controller_backend::delete_partition(model::ntp ntp, model::revision_id rev) {
 
     auto group_id = part->group();
 
+    // drop shard table updates for this ntp that were not yet published, so
+    // the flush will not resurrect an entry for the removed partition
+    _pending_shard_table_updates.erase(
+      std::remove_if(
+        _pending_shard_table_updates.begin(),
+        _pending_shard_table_updates.end(),
+        [&ntp](const shard_table_update& u) { return u.ntp == ntp; }),
+      _pending_shard_table_updates.end());
+
     return _shard_table
       .invoke_on_all(
         [ntp, group_id](shard_table& st) mutable { st.erase(ntp, group_id); })
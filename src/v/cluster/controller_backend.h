@@ -18,6 +18,7 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/core/sharded.hh>
 
 namespace cluster {
@@ -65,7 +66,6 @@ private:
       raft::group_id,
       model::revision_id,
       std::vector<model::broker>);
-    ss::future<> add_to_shard_table(model::ntp, raft::group_id, ss::shard_id);
     ss::future<std::error_code>
       delete_partition(model::ntp, model::revision_id);
     ss::future<std::error_code> update_partition_replica_set(
@@ -79,8 +79,23 @@ private:
     ss::future<> do_bootstrap();
     ss::future<> bootstrap_ntp(const model::ntp&, deltas_t&);
 
+    ss::future<> flush_shard_table_updates();
+
     void housekeeping();
 
+    // entry scheduled for publication to all shard table instances, the
+    // cross core broadcast is made once per reconciliation pass instead of
+    // once per created partition
+    struct shard_table_update {
+        model::ntp ntp;
+        raft::group_id group;
+        ss::shard_id shard;
+    };
+
+    // limits number of partitions being created/deleted at the same time on
+    // a shard, creating a log and a raft group each opens several files
+    static constexpr size_t max_concurrent_partition_ops = 64;
+
     ss::sharded<topic_table>& _topics;
     ss::sharded<shard_table>& _shard_table;
     ss::sharded<partition_manager>& _partition_manager;
@@ -91,8 +106,10 @@ private:
     ss::sstring _data_directory;
     ss::sharded<ss::abort_source>& _as;
     underlying_t _topic_deltas;
+    std::vector<shard_table_update> _pending_shard_table_updates;
     ss::timer<> _housekeeping_timer;
     ss::semaphore _topics_sem{1};
+    ss::semaphore _partition_ops_sem{max_concurrent_partition_ops};
     ss::gate _gate;
 };
 
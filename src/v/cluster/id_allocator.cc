@@ -28,7 +28,8 @@ id_allocator::id_allocator(
 
 ss::future<allocate_id_reply>
 id_allocator::allocate_id(allocate_id_request&& req, rpc::streaming_context&) {
-    return _id_allocator_frontend.local().do_allocate_id(req.timeout);
+    return _id_allocator_frontend.local().do_allocate_id(
+      req.range, req.timeout);
 }
 
 } // namespace cluster
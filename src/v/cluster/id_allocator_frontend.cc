@@ -47,6 +47,34 @@ id_allocator_frontend::id_allocator_frontend(
 
 ss::future<allocate_id_reply>
 id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
+    // common case - serve from the range this shard leased earlier, a local
+    // increment instead of a raft round trip
+    if (
+      _local_range > 0 && ss::lowres_clock::now() < _local_lease_expiration) {
+        auto id = _local_base;
+        _local_base += 1;
+        _local_range -= 1;
+        return ss::make_ready_future<allocate_id_reply>(
+          allocate_id_reply{id, errc::success});
+    }
+    // lease a fresh range, serve the first id from it and keep the rest.
+    // expired remainders are simply dropped - ids are only required to be
+    // unique, so never reusing an abandoned range is always safe
+    auto range = config::shard_local_cfg().id_allocator_batch_size.value();
+    return allocate_id_range(range, timeout)
+      .then([this](allocate_id_reply r) {
+          if (r.ec != errc::success || r.range <= 0) {
+              return allocate_id_reply{r.id, r.ec};
+          }
+          _local_base = r.id + 1;
+          _local_range = r.range - 1;
+          _local_lease_expiration = ss::lowres_clock::now() + lease_ttl;
+          return allocate_id_reply{r.id, errc::success};
+      });
+}
+
+ss::future<allocate_id_reply> id_allocator_frontend::allocate_id_range(
+  int64_t range, model::timeout_clock::duration timeout) {
     auto nt = model::topic_namespace(
       model::kafka_internal_namespace, model::id_allocator_topic);
 
@@ -56,7 +84,7 @@ id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
         has_topic = try_create_id_allocator_topic();
     }
 
-    return has_topic.then([this, timeout](bool does_topic_exist) {
+    return has_topic.then([this, range, timeout](bool does_topic_exist) {
         if (!does_topic_exist) {
             return ss::make_ready_future<allocate_id_reply>(
               allocate_id_reply{0, errc::topic_not_exists});
@@ -76,31 +104,33 @@ id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
         auto _self = _controller->self();
 
         if (leader == _self) {
-            return do_allocate_id(timeout);
+            return do_allocate_id(range, timeout);
         }
 
         vlog(
           clusterlog.trace,
-          "dispatching allocate id to {} from {}",
+          "dispatching allocate id range to {} from {}",
           leader,
           _self);
 
-        return dispatch_allocate_id_to_leader(leader.value(), timeout);
+        return dispatch_allocate_id_to_leader(leader.value(), range, timeout);
     });
 }
 
 ss::future<allocate_id_reply>
 id_allocator_frontend::dispatch_allocate_id_to_leader(
-  model::node_id leader, model::timeout_clock::duration timeout) {
+  model::node_id leader,
+  int64_t range,
+  model::timeout_clock::duration timeout) {
     return _connection_cache.local()
       .with_node_client<cluster::id_allocator_client_protocol>(
         _controller->self(),
         ss::this_shard_id(),
         leader,
         timeout,
-        [timeout](id_allocator_client_protocol cp) {
+        [range, timeout](id_allocator_client_protocol cp) {
             return cp.allocate_id(
-              allocate_id_request{timeout},
+              allocate_id_request{timeout, range},
               rpc::client_opts(model::timeout_clock::now() + timeout));
         })
       .then(&rpc::get_ctx_data<allocate_id_reply>)
@@ -117,8 +147,8 @@ id_allocator_frontend::dispatch_allocate_id_to_leader(
       });
 }
 
-ss::future<allocate_id_reply>
-id_allocator_frontend::do_allocate_id(model::timeout_clock::duration timeout) {
+ss::future<allocate_id_reply> id_allocator_frontend::do_allocate_id(
+  int64_t range, model::timeout_clock::duration timeout) {
     auto shard = _shard_table.local().shard_for(model::id_allocator_ntp);
 
     if (shard == std::nullopt) {
@@ -131,7 +161,7 @@ id_allocator_frontend::do_allocate_id(model::timeout_clock::duration timeout) {
     }
 
     return _partition_manager.invoke_on(
-      *shard, _ssg, [timeout](cluster::partition_manager& mgr) mutable {
+      *shard, _ssg, [range, timeout](cluster::partition_manager& mgr) mutable {
           auto partition = mgr.get(model::id_allocator_ntp);
           if (!partition) {
               vlog(
@@ -151,16 +181,17 @@ id_allocator_frontend::do_allocate_id(model::timeout_clock::duration timeout) {
                 allocate_id_reply{0, errc::topic_not_exists});
           }
           return stm
-            ->allocate_id_and_wait(model::timeout_clock::now() + timeout)
+            ->allocate_id_range_and_wait(
+              range, model::timeout_clock::now() + timeout)
             .then([](id_allocator_stm::stm_allocation_result r) {
                 if (r.raft_status == raft::errc::success) {
-                    return allocate_id_reply{r.id, errc::success};
+                    return allocate_id_reply{r.base, errc::success, r.range};
                 } else {
                     vlog(
                       clusterlog.trace,
-                      "allocate id stm call failed with {}",
+                      "allocate id range stm call failed with {}",
                       r.raft_status);
-                    return allocate_id_reply{r.id, errc::replication_error};
+                    return allocate_id_reply{r.base, errc::replication_error};
                 }
             });
       });
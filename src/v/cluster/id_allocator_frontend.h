@@ -24,9 +24,14 @@ class id_allocator;
 // id_allocator_frontend is an frontend of the id_allocator_stm,
 // an engine behind the id_allocator service.
 //
-// when a client invokes id_allocator_frontend::allocate_id on a
-// remote node the frontend redirects the request to the service
-// located on the leading broker of the id_allocator's partition.
+// each frontend instance leases a range of ids with a single request
+// and serves allocations from shard local memory until the range is
+// exhausted or its lease expires, so the common case is a plain
+// increment without any network or log activity.
+//
+// when a range has to be leased and the leader of the id_allocator's
+// partition is on a remote node the frontend redirects the request to
+// the service located on the leading broker.
 //
 // when a client is located on the same node as the leader then the
 // frontend bypasses the network and directly engages with the state
@@ -49,6 +54,10 @@ public:
     allocate_id(model::timeout_clock::duration timeout);
 
 private:
+    // a leased range that outlives its lease is discarded, bounding how far
+    // ids served by an idle shard can lag behind the replicated state
+    static constexpr std::chrono::seconds lease_ttl{60};
+
     ss::smp_service_group _ssg;
     ss::sharded<cluster::partition_manager>& _partition_manager;
     ss::sharded<cluster::shard_table>& _shard_table;
@@ -57,11 +66,19 @@ private:
     ss::sharded<partition_leaders_table>& _leaders;
     std::unique_ptr<cluster::controller>& _controller;
 
+    // shard local remainder of the most recently leased range
+    int64_t _local_base{0};
+    int64_t _local_range{0};
+    ss::lowres_clock::time_point _local_lease_expiration;
+
+    ss::future<allocate_id_reply>
+    allocate_id_range(int64_t, model::timeout_clock::duration);
+
     ss::future<allocate_id_reply> dispatch_allocate_id_to_leader(
-      model::node_id, model::timeout_clock::duration);
+      model::node_id, int64_t, model::timeout_clock::duration);
 
     ss::future<allocate_id_reply>
-    do_allocate_id(model::timeout_clock::duration timeout);
+    do_allocate_id(int64_t, model::timeout_clock::duration);
 
     ss::future<bool> try_create_id_allocator_topic();
 
@@ -40,19 +40,9 @@ id_allocator_stm::id_allocator_stm(
   , _c(c) {}
 
 ss::future<id_allocator_stm::stm_allocation_result>
-id_allocator_stm::allocate_id_and_wait(
-  model::timeout_clock::time_point timeout) {
+id_allocator_stm::allocate_id_range_and_wait(
+  int64_t range, model::timeout_clock::time_point timeout) {
     auto prelude = ss::now();
-    auto range = _config.id_allocator_batch_size.value();
-
-    if (_last_allocated_range > 0) {
-        auto allocated_id = _last_allocated_base;
-        _last_allocated_range -= 1;
-        _last_allocated_base += 1;
-
-        return ss::make_ready_future<stm_allocation_result>(
-          stm_allocation_result{allocated_id, raft::errc::success});
-    }
 
     if (_processed > _config.id_allocator_log_capacity.value()) {
         auto seq = sequence_id{_run_id.value(), _c->self(), ++_last_seq_tick};
@@ -92,10 +82,8 @@ id_allocator_stm::allocate_id_and_wait(
           _run_id.value(), _c->self(), ++_last_seq_tick};
 
         return replicate_and_wait(allocation_cmd{seq, range}, timeout, seq)
-          .then([this](log_allocation_result r) {
-              _last_allocated_base = r.base + 1;
-              _last_allocated_range = r.range - 1;
-              return stm_allocation_result{r.base, r.raft_status};
+          .then([](log_allocation_result r) {
+              return stm_allocation_result{r.base, r.range, r.raft_status};
           });
     });
 }
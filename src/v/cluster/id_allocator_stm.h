@@ -35,10 +35,11 @@ namespace cluster {
 // commands and returns a result.
 //
 // (*) When we do this procedure for each request it becomes costly
-// in terms of latency so the id_allocator_stm allocates the ids in
-// batches using "+1000" commands (the actual value comes from the
-// configuration see id_allocator_batch_size) and then serves the
-// requests without touching the log until the batch is exhausted.
+// in terms of latency so the ids are leased in ranges using "+1000"
+// commands (the actual value comes from the configuration see
+// id_allocator_batch_size); the id_allocator_frontend on each node
+// holds a leased range and serves the requests without touching the
+// log until the range is exhausted.
 //
 // sequence_id is 3-tuple, first component is a node-unique id generated
 // on the app start (we use kvstore to persist the value and guarantee
@@ -80,7 +81,8 @@ namespace cluster {
 class id_allocator_stm final : public raft::state_machine {
 public:
     struct stm_allocation_result {
-        int64_t id;
+        int64_t base;
+        int64_t range;
         raft::errc raft_status{raft::errc::success};
     };
 
@@ -89,8 +91,10 @@ public:
 
     ss::future<> start() final;
 
-    ss::future<stm_allocation_result>
-    allocate_id_and_wait(model::timeout_clock::time_point timeout);
+    /// Reserves [base, base + range) with a single replication round. The
+    /// caller owns the whole range and hands the ids out locally.
+    ss::future<stm_allocation_result> allocate_id_range_and_wait(
+      int64_t range, model::timeout_clock::time_point timeout);
 
 private:
     struct sequence_id {
@@ -157,8 +161,6 @@ private:
 
     int64_t _state{0};
     int64_t _processed{0};
-    int64_t _last_allocated_base{0};
-    int64_t _last_allocated_range{0};
     bool _should_cache{false};
     model::offset _prepare_offset{0};
     int64_t _prepare_state{0};
@@ -0,0 +1,175 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/leader_balancer.h"
+
+#include "cluster/logger.h"
+#include "cluster/partition.h"
+#include "cluster/partition_leaders_table.h"
+#include "cluster/partition_manager.h"
+#include "config/configuration.h"
+#include "model/namespace.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+
+#include <algorithm>
+
+namespace cluster {
+
+leader_balancer::leader_balancer(
+  ss::sharded<partition_leaders_table>& leaders,
+  ss::sharded<partition_manager>& partition_manager)
+  : _leaders(leaders)
+  , _partition_manager(partition_manager)
+  , _self(config::shard_local_cfg().node_id()) {
+    _timer.set_callback([this] { dispatch_balance(); });
+}
+
+ss::future<> leader_balancer::start() {
+    if (config::shard_local_cfg().enable_leader_balancer()) {
+        _timer.arm_periodic(
+          config::shard_local_cfg().leader_balancer_tick_interval_ms());
+    }
+    return ss::now();
+}
+
+ss::future<> leader_balancer::stop() {
+    _timer.cancel();
+    return _gate.close();
+}
+
+void leader_balancer::dispatch_balance() {
+    (void)ss::with_gate(_gate, [this] { return balance(); })
+      .handle_exception([](const std::exception_ptr& e) {
+          vlog(clusterlog.info, "Error during leadership balancing - {}", e);
+      });
+}
+
+std::vector<leader_balancer::candidate> leader_balancer::local_candidates() {
+    std::vector<candidate> candidates;
+    absl::flat_hash_map<model::ntp, uint64_t> ops;
+    for (const auto& [ntp, p] : _partition_manager.local().partitions()) {
+        // internal groups (controller, consumer offsets, etc.) are kept out
+        // of automatic balancing
+        if (ntp.ns != model::kafka_namespace) {
+            continue;
+        }
+        const uint64_t total = p->probe().records_produced()
+                               + p->probe().records_fetched();
+        ops.emplace(ntp, total);
+        if (!p->is_leader()) {
+            continue;
+        }
+        auto it = _last_ops.find(ntp);
+        const uint64_t delta = it == _last_ops.end() ? total
+                                                     : total - it->second;
+        candidates.push_back(candidate{p, delta});
+    }
+    // rebuilding the snapshot drops counters of partitions that moved away
+    // from this shard
+    _last_ops = std::move(ops);
+    // hottest first, so an overloaded node sheds real load and not just
+    // raw leader counts
+    std::sort(
+      candidates.begin(),
+      candidates.end(),
+      [](const candidate& a, const candidate& b) {
+          return a.recent_ops > b.recent_ops;
+      });
+    return candidates;
+}
+
+ss::future<> leader_balancer::balance() {
+    // cluster wide leader counts, as seen by this shard's copy of the
+    // leaders table. all shards of a node count toward that node
+    absl::flat_hash_map<model::node_id, size_t> leaders_per_node;
+    size_t total_leaders = 0;
+    _leaders.local().for_each_leader(
+      [&leaders_per_node, &total_leaders](
+        model::topic_namespace_view,
+        model::partition_id,
+        std::optional<model::node_id> leader,
+        model::term_id) {
+          if (leader) {
+              ++leaders_per_node[*leader];
+              ++total_leaders;
+          }
+      });
+    if (leaders_per_node.size() <= 1) {
+        co_return;
+    }
+    const size_t fair_share = (total_leaders + leaders_per_node.size() - 1)
+                              / leaders_per_node.size();
+    auto self_it = leaders_per_node.find(_self);
+    if (
+      self_it == leaders_per_node.end()
+      || self_it->second <= fair_share + min_imbalance) {
+        co_return;
+    }
+    size_t self_leaders = self_it->second;
+    vlog(
+      clusterlog.debug,
+      "Node leads {} groups with a fair share of {} - rebalancing",
+      self_leaders,
+      fair_share);
+
+    auto candidates = local_candidates();
+    size_t budget
+      = config::shard_local_cfg().leader_balancer_transfers_per_tick();
+    for (auto& c : candidates) {
+        if (budget == 0 || self_leaders <= fair_share) {
+            break;
+        }
+        // hand the candidate to its follower on the least loaded node, as
+        // long as that actually improves the distribution
+        std::optional<model::node_id> target;
+        size_t target_leaders = 0;
+        auto group_cfg = c.partition->group_configuration_snapshot();
+        for (const auto& b : group_cfg->brokers()) {
+            if (b.id() == _self) {
+                continue;
+            }
+            auto it = leaders_per_node.find(b.id());
+            const size_t count = it == leaders_per_node.end() ? 0
+                                                              : it->second;
+            if (count + 1 >= self_leaders) {
+                continue;
+            }
+            if (!target || count < target_leaders) {
+                target = b.id();
+                target_leaders = count;
+            }
+        }
+        if (!target) {
+            continue;
+        }
+        auto ec = co_await c.partition->transfer_leadership(target);
+        if (ec) {
+            vlog(
+              clusterlog.debug,
+              "Unable to transfer leadership of {} to node {} - {}",
+              c.partition->ntp(),
+              *target,
+              ec.message());
+            continue;
+        }
+        vlog(
+          clusterlog.info,
+          "Transferred leadership of {} to node {} to even out leadership "
+          "distribution",
+          c.partition->ntp(),
+          *target);
+        --budget;
+        --self_leaders;
+        ++leaders_per_node[*target];
+    }
+}
+
+} // namespace cluster
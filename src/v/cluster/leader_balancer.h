@@ -0,0 +1,72 @@
+/*
+ * Copyright 2020 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "cluster/fwd.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+namespace cluster {
+
+/// Periodically evens out raft leadership across the cluster. After a
+/// restart or an incident the leadership distribution can skew badly and
+/// stays skewed until someone intervenes, leaving a few nodes cpu and
+/// fsync bound.
+///
+/// The balancer is decentralized: every shard inspects the cluster wide
+/// leader counts from its local partition_leaders_table copy and, when this
+/// node leads more than its fair share, transfers leadership of partitions
+/// hosted on this shard toward the least loaded follower nodes. Transfers
+/// are bounded per round so rebalancing never turns into a leadership
+/// storm, and candidates are ordered by recent throughput taken from the
+/// partition probes so an overloaded node sheds real load first, not just
+/// raw counts.
+class leader_balancer {
+public:
+    leader_balancer(
+      ss::sharded<partition_leaders_table>&, ss::sharded<partition_manager>&);
+
+    ss::future<> start();
+    ss::future<> stop();
+
+private:
+    // do not bother shedding leaders unless we exceed the fair share by
+    // more than this - constant churn around the average is worse than a
+    // slightly uneven distribution
+    static constexpr size_t min_imbalance = 2;
+
+    struct candidate {
+        ss::lw_shared_ptr<partition> partition;
+        uint64_t recent_ops;
+    };
+
+    void dispatch_balance();
+    ss::future<> balance();
+    std::vector<candidate> local_candidates();
+
+    ss::sharded<partition_leaders_table>& _leaders;
+    ss::sharded<partition_manager>& _partition_manager;
+    model::node_id _self;
+    // per ntp operation counters from the previous round, used to compute
+    // the throughput each candidate has seen since then
+    absl::flat_hash_map<model::ntp, uint64_t> _last_ops;
+    ss::timer<> _timer;
+    ss::gate _gate;
+};
+
+} // namespace cluster
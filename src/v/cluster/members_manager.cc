@@ -133,7 +133,8 @@ members_manager::handle_raft0_cfg_update(raft::group_configuration cfg) {
             cfg.for_each_broker([&allocator](const model::broker& n) {
                 if (!allocator.contains_node(n.id())) {
                     allocator.register_node(std::make_unique<allocation_node>(
-                      allocation_node(n.id(), n.properties().cores, {})));
+                      allocation_node(
+                        n.id(), n.properties().cores, {}, n.rack())));
                 }
             });
         })
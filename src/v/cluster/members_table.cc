@@ -44,6 +44,9 @@ std::optional<broker_ptr> members_table::get_broker(model::node_id id) const {
 }
 
 void members_table::update_brokers(patch<broker_ptr> patch) {
+    if (!patch.additions.empty() || !patch.deletions.empty()) {
+        ++_version;
+    }
     for (auto& br : patch.additions) {
         _brokers.insert_or_assign(br->id(), br);
     }
@@ -34,8 +34,12 @@ public:
 
     void update_brokers(patch<broker_ptr>);
 
+    /// Monotonic counter bumped every time this shard's broker set changes
+    uint64_t version() const { return _version; }
+
 private:
     using broker_cache_t = absl::flat_hash_map<model::node_id, broker_ptr>;
     broker_cache_t _brokers;
+    uint64_t _version{0};
 };
 } // namespace cluster
\ No newline at end of file
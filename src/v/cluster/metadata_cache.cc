@@ -68,7 +68,11 @@ metadata_cache::get_topic_timestamp_type(model::topic_namespace_view tp) const {
 }
 
 std::vector<model::topic_metadata> metadata_cache::all_topics_metadata() const {
-    auto all_md = _topics_state.local().all_topics_metadata();
+    // copy from the shared snapshot instead of re-materializing the
+    // metadata out of the assignment maps; leaders are filled per call as
+    // they change independently of the topic table
+    auto snapshot = _topics_state.local().topic_metadata_snapshot();
+    auto all_md = *snapshot;
     for (auto& md : all_md) {
         fill_partition_leaders(_leaders.local(), md);
     }
@@ -104,4 +108,10 @@ std::optional<model::node_id> metadata_cache::get_controller_leader_id() {
     return _leaders.local().get_leader(model::controller_ntp);
 }
 
+uint64_t metadata_cache::version() const {
+    // each term only ever grows, so the sum changes with every update
+    return _topics_state.local().version() + _members_table.local().version()
+           + _leaders.local().version();
+}
+
 } // namespace cluster
@@ -110,6 +110,12 @@ public:
     /// If present returns a leader of raft0 group
     std::optional<model::node_id> get_controller_leader_id();
 
+    /// Monotonic counter that changes whenever any of the underlying state
+    /// (topics, brokers, leaders) is updated on this shard. Consumers may
+    /// compare snapshots of it to decide if state derived from the cache,
+    /// e.g. an encoded metadata response, is still valid.
+    uint64_t version() const;
+
 private:
     ss::sharded<topic_table>& _topics_state;
     ss::sharded<members_table>& _members_table;
@@ -51,21 +51,23 @@ metadata_dissemination_handler::do_update_leadership(
       .then([] { return ss::make_ready_future<update_leadership_reply>(); });
 }
 
-static get_leadership_reply
-make_get_leadership_reply(const partition_leaders_table& leaders) {
+static get_leadership_reply make_get_leadership_reply(
+  const partition_leaders_table& leaders, uint64_t since_version) {
     ntp_leaders ret;
-    leaders.for_each_leader([&ret](
-                              model::topic_namespace_view tp_ns,
-                              model::partition_id pid,
-                              std::optional<model::node_id> leader,
-                              model::term_id term) mutable {
-        ret.emplace_back(ntp_leader{
-          .ntp = model::ntp(tp_ns.ns, tp_ns.tp, pid),
-          .term = term,
-          .leader_id = leader});
-    });
+    leaders.for_each_leader_since(
+      since_version,
+      [&ret](
+        model::topic_namespace_view tp_ns,
+        model::partition_id pid,
+        std::optional<model::node_id> leader,
+        model::term_id term) mutable {
+          ret.emplace_back(ntp_leader{
+            .ntp = model::ntp(tp_ns.ns, tp_ns.tp, pid),
+            .term = term,
+            .leader_id = leader});
+      });
 
-    return get_leadership_reply{std::move(ret)};
+    return get_leadership_reply{std::move(ret), leaders.version()};
 }
 
 ss::future<get_leadership_reply> metadata_dissemination_handler::get_leadership(
@@ -73,7 +75,7 @@ ss::future<get_leadership_reply> metadata_dissemination_handler::get_leadership(
     return ss::with_scheduling_group(
       get_scheduling_group(), [this, req = std::move(req)]() mutable {
           return ss::make_ready_future<get_leadership_reply>(
-            make_get_leadership_reply(_leaders.local()));
+            make_get_leadership_reply(_leaders.local(), req.version));
       });
 }
 
@@ -156,22 +156,39 @@ ss::future<> metadata_dissemination_service::apply_leadership_notification(
     // the gate also needs to be taken on the destination core.
     return ss::with_gate(
       _bg, [this, ntp = std::move(ntp), lid, term]() mutable {
-          // the lock sequences the updates from raft
-          return _lock.with([this, ntp = std::move(ntp), lid, term]() mutable {
-              // update partition leaders
-              auto f = _leaders.invoke_on_all(
-                [ntp, lid, term](partition_leaders_table& leaders) {
-                    leaders.update_partition_leader(ntp, term, lid);
-                });
-              if (lid == _self.id()) {
+          _pending_leader_updates.push_back(
+            ntp_leader{std::move(ntp), term, lid});
+          // the lock sequences the updates from raft. during leadership
+          // churn notifications pile up behind the lock and the next holder
+          // applies all of them with a single cross-shard invoke instead of
+          // one invoke per partition
+          return _lock.with([this] { return apply_pending_notifications(); });
+      });
+}
+
+ss::future<> metadata_dissemination_service::apply_pending_notifications() {
+    if (_pending_leader_updates.empty()) {
+        return ss::make_ready_future<>();
+    }
+    auto batch = std::exchange(_pending_leader_updates, {});
+    return ss::do_with(std::move(batch), [this](ntp_leaders& batch) {
+        return _leaders
+          .invoke_on_all([&batch](partition_leaders_table& leaders) {
+              for (auto& update : batch) {
+                  leaders.update_partition_leader(
+                    update.ntp, update.term, update.leader_id);
+              }
+          })
+          .then([this, &batch] {
+              for (auto& update : batch) {
                   // only disseminate from current leader
-                  f = f.then([this, ntp = std::move(ntp), term, lid]() mutable {
-                      return disseminate_leadership(std::move(ntp), term, lid);
-                  });
+                  if (update.leader_id == _self.id()) {
+                      disseminate_leadership(
+                        std::move(update.ntp), update.term, update.leader_id);
+                  }
               }
-              return f;
           });
-      });
+    });
 }
 
 static inline ss::future<>
@@ -273,10 +290,12 @@ void metadata_dissemination_service::collect_pending_updates() {
         auto non_overlapping = calculate_non_overlapping_nodes(
           get_partition_members(ntp_leader.ntp.tp.partition, *tp_md), brokers);
         for (auto& id : non_overlapping) {
-            if (!_pending_updates.contains(id)) {
-                _pending_updates.emplace(id, update_retry_meta{ntp_leaders{}});
+            auto& meta = _pending_updates[id];
+            auto [it, inserted] = meta.updates.try_emplace(
+              ntp_leader.ntp, ntp_leader);
+            if (!inserted && it->second.term < ntp_leader.term) {
+                it->second = ntp_leader;
             }
-            _pending_updates[id].updates.push_back(ntp_leader);
         }
     }
     _requests.clear();
@@ -308,22 +327,29 @@ ss::future<> metadata_dissemination_service::dispatch_disseminate_leadership() {
 
 ss::future<> metadata_dissemination_service::dispatch_one_update(
   model::node_id target_id, update_retry_meta& meta) {
+    // snapshot the deduplicated updates into the wire format order, the
+    // map itself stays behind as the per-peer retry state
+    ntp_leaders updates;
+    updates.reserve(meta.updates.size());
+    for (auto& [ntp, leader] : meta.updates) {
+        updates.push_back(leader);
+    }
     return _clients.local()
       .with_node_client<metadata_dissemination_rpc_client_protocol>(
         _self.id(),
         ss::this_shard_id(),
         target_id,
         _dissemination_interval,
-        [this, &meta, target_id](
+        [this, updates = std::move(updates), target_id](
           metadata_dissemination_rpc_client_protocol proto) mutable {
             vlog(
               clusterlog.trace,
               "Sending {} metadata updates to {}",
-              meta.updates.size(),
+              updates.size(),
               target_id);
             return proto
               .update_leadership(
-                update_leadership_request{meta.updates},
+                update_leadership_request{std::move(updates)},
                 rpc::client_opts(
                   _dissemination_interval + rpc::clock_type::now()))
               .then(&rpc::get_ctx_data<update_leadership_reply>);
@@ -92,7 +92,11 @@ private:
     // When update was delivered successfully the finished flag is set to true
     // and object is removed from pending updates map
     struct update_retry_meta {
-        ntp_leaders updates;
+        /// pending updates for one peer deduplicated by ntp with the
+        /// freshest term winning, so a peer that missed several intervals
+        /// of leadership churn receives one row per partition instead of
+        /// the whole election history
+        absl::flat_hash_map<model::ntp, ntp_leader> updates;
         bool finished = false;
     };
     // Used to track the process of requesting update when redpanda starts
@@ -113,6 +117,7 @@ private:
       model::ntp, model::term_id, std::optional<model::node_id>);
     ss::future<> apply_leadership_notification(
       model::ntp, model::term_id, std::optional<model::node_id>);
+    ss::future<> apply_pending_notifications();
 
     void collect_pending_updates();
     void cleanup_finished_updates();
@@ -136,6 +141,9 @@ private:
     std::chrono::milliseconds _dissemination_interval;
     config::tls_config _rpc_tls_config;
     std::vector<ntp_leader> _requests;
+    // notifications waiting to be applied to all shards, drained in batches
+    // under _lock by apply_pending_notifications()
+    ntp_leaders _pending_leader_updates;
     std::vector<unresolved_address> _seed_servers;
     broker_updates_t _pending_updates;
     mutex _lock;
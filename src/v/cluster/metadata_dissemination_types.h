@@ -31,10 +31,17 @@ struct update_leadership_request {
 
 struct update_leadership_reply {};
 
-struct get_leadership_request {};
+struct get_leadership_request {
+    // only leaders updated after this version of the responder's leaders
+    // table are returned, version 0 requests the full set
+    uint64_t version{0};
+};
 
 struct get_leadership_reply {
     ntp_leaders leaders;
+    // responder's leaders table version at reply time, echo it in the next
+    // request to only receive newer updates
+    uint64_t version{0};
 };
 
 inline std::ostream& operator<<(std::ostream& o, const ntp_leader& l) {
@@ -14,17 +14,16 @@
 #include "cluster/errc.h"
 #include "model/fundamental.h"
 #include "model/timeout_clock.h"
-#include "utils/expiring_promise.h"
-
-#include <absl/container/flat_hash_map.h>
+#include "utils/waiter_queue.h"
 
 namespace cluster {
-/// Cache notifications
+/// Cache notifications. Waits are registered in an intrusive queue sorted
+/// by offset; notify(o) wakes every waiter at or below o, so a burst of
+/// batched controller operations resolves in one pass without a promise
+/// allocation per outstanding offset.
 class notification_latch {
 private:
-    using promise_t = expiring_promise<errc, model::timeout_clock>;
-    using promise_ptr = std::unique_ptr<promise_t>;
-    using underlying_t = absl::flat_hash_map<model::offset, promise_ptr>;
+    using queue_t = waiter_queue<model::offset, errc, model::timeout_clock>;
 
 public:
     ss::future<errc> wait_for(model::offset, model::timeout_clock::time_point);
@@ -32,6 +31,6 @@ public:
     void stop();
 
 private:
-    underlying_t _promises;
+    queue_t _waiters;
 };
-} // namespace cluster
\ No newline at end of file
+} // namespace cluster
@@ -38,6 +38,11 @@ partition::partition(consensus_ptr r)
               clusterlog, _raft.get(), config::shard_local_cfg());
             stm_manager->add_stm(_seq_stm);
         }
+        if (_raft->ntp().ns == model::kafka_namespace) {
+            _offset_translator
+              = ss::make_lw_shared<raft::offset_translator_stm>(
+                clusterlog, _raft.get());
+        }
     }
 }
 
@@ -84,6 +89,10 @@ ss::future<> partition::start() {
         f = f.then([this] { return _seq_stm->start(); });
     }
 
+    if (_offset_translator) {
+        f = f.then([this] { return _offset_translator->start(); });
+    }
+
     return f;
 }
 
@@ -104,6 +113,10 @@ ss::future<> partition::stop() {
         f = f.then([this] { return _seq_stm->stop(); });
     }
 
+    if (_offset_translator) {
+        f = f.then([this] { return _offset_translator->stop(); });
+    }
+
     // no state machine
     return f;
 }
@@ -22,6 +22,7 @@
 #include "raft/consensus_utils.h"
 #include "raft/group_configuration.h"
 #include "raft/log_eviction_stm.h"
+#include "raft/offset_translator_stm.h"
 #include "raft/types.h"
 #include "storage/types.h"
 
@@ -121,10 +122,17 @@ public:
         return _raft->config();
     }
 
+    /// shared immutable snapshot of the configuration, avoids the broker
+    /// list copy group_configuration() makes on every call
+    ss::lw_shared_ptr<const raft::group_configuration>
+    group_configuration_snapshot() const {
+        return _raft->config_snapshot();
+    }
+
     partition_probe& probe() { return _probe; }
 
     model::revision_id get_revision_id() const {
-        return _raft->config().revision_id();
+        return _raft->config_snapshot()->revision_id();
     }
 
     model::offset get_latest_configuration_offset() const {
@@ -135,6 +143,14 @@ public:
         return _id_allocator_stm;
     }
 
+    /**
+     * Maps between raft log offsets and offsets visible to kafka clients,
+     * present on all partitions backing kafka topics.
+     */
+    ss::lw_shared_ptr<raft::offset_translator_stm>& offset_translator() {
+        return _offset_translator;
+    }
+
 private:
     friend partition_manager;
 
@@ -143,6 +159,7 @@ private:
 private:
     consensus_ptr _raft;
     ss::lw_shared_ptr<raft::log_eviction_stm> _nop_stm;
+    ss::lw_shared_ptr<raft::offset_translator_stm> _offset_translator;
     ss::lw_shared_ptr<cluster::id_allocator_stm> _id_allocator_stm;
     ss::shared_ptr<seq_stm> _seq_stm;
     ss::abort_source _as;
@@ -63,6 +63,46 @@ static bool is_machine_in_replicas(
       });
 }
 
+bool partition_allocator::is_rack_in_replicas(
+  const std::optional<ss::sstring>& rack,
+  const std::vector<model::broker_shard>& replicas) {
+    if (!rack) {
+        return false;
+    }
+    return std::any_of(
+      replicas.begin(),
+      replicas.end(),
+      [this, &rack](const model::broker_shard& bs) {
+          auto it = find_node(bs.node_id);
+          return it != _machines.end() && it->second->rack() == rack;
+      });
+}
+
+allocation_node* partition_allocator::find_best_fit(
+  const std::vector<model::broker_shard>& replicas) {
+    allocation_node* best = nullptr;
+    bool best_rack_conflict = true;
+    double best_fill = 0;
+    for (auto& machine : _available_machines) {
+        if (is_machine_in_replicas(machine, replicas)) {
+            continue;
+        }
+        const bool rack_conflict = is_rack_in_replicas(
+          machine.rack(), replicas);
+        const double fill = machine.fill_factor();
+        // rack diversity trumps balance, ties are broken by the lower fill
+        if (
+          best == nullptr
+          || std::make_pair(rack_conflict, fill)
+               < std::make_pair(best_rack_conflict, best_fill)) {
+            best = &machine;
+            best_rack_conflict = rack_conflict;
+            best_fill = fill;
+        }
+    }
+    return best;
+}
+
 std::optional<std::vector<model::broker_shard>>
 partition_allocator::allocate_replicas(int16_t replication_factor) {
     std::vector<model::broker_shard> replicas;
@@ -74,17 +114,17 @@ partition_allocator::allocate_replicas(int16_t replication_factor) {
             rollback(replicas);
             return std::nullopt;
         }
-        auto& rr = round_robin_ptr();
-        auto& machine = *rr;
-        rr++;
-        if (is_machine_in_replicas(machine, replicas)) {
-            continue;
+        auto* machine = find_best_fit(replicas);
+        if (machine == nullptr) {
+            rollback(replicas);
+            return std::nullopt;
         }
-        const uint32_t cpu = machine.allocate();
-        model::broker_shard bs{.node_id = machine.id(), .shard = cpu};
+        const uint32_t cpu = machine->allocate();
+        model::broker_shard bs{.node_id = machine->id(), .shard = cpu};
         replicas.push_back(bs);
-        if (machine.is_full()) {
-            _available_machines.erase(_available_machines.iterator_to(machine));
+        if (machine->is_full()) {
+            _available_machines.erase(
+              _available_machines.iterator_to(*machine));
         }
     }
     if (!valid_machine_fault_domain_diversity(replicas)) {
@@ -94,7 +134,6 @@ partition_allocator::allocate_replicas(int16_t replication_factor) {
     return replicas;
 }
 
-// FIXME: take into account broker.rack diversity & other constraints
 std::optional<partition_allocator::allocation_units>
 partition_allocator::allocate(const topic_configuration& cfg) {
     if (_available_machines.empty()) {
@@ -205,6 +244,23 @@ partition_allocator::find_node(model::node_id id) {
     return _machines.find(id);
 }
 
+std::vector<partition_allocator::node_load>
+partition_allocator::load_report() const {
+    std::vector<node_load> report;
+    report.reserve(_machines.size());
+    for (auto& [id, machine] : _machines) {
+        report.push_back(node_load{
+          .id = id,
+          .fill_factor = machine->fill_factor(),
+          .rack = machine->rack()});
+    }
+    std::sort(
+      report.begin(), report.end(), [](const node_load& a, const node_load& b) {
+          return a.fill_factor > b.fill_factor;
+      });
+    return report;
+}
+
 void partition_allocator::test_only_saturate_all_machines() {
     for (auto& [id, m] : _machines) {
         m->_partition_capacity = 0;
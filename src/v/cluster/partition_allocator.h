@@ -32,10 +32,12 @@ public:
     allocation_node(
       model::node_id id,
       uint32_t cpus,
-      std::unordered_map<ss::sstring, ss::sstring> labels)
+      std::unordered_map<ss::sstring, ss::sstring> labels,
+      std::optional<ss::sstring> rack = std::nullopt)
       : _id(id)
       , _weights(cpus)
-      , _machine_labels(std::move(labels)) {
+      , _machine_labels(std::move(labels))
+      , _rack(std::move(rack)) {
         // add extra weights to core 0
         _weights[0] = core0_extra_weight;
         _partition_capacity = (cpus * max_allocations_per_core)
@@ -46,7 +48,8 @@ public:
       : _id(o._id)
       , _weights(std::move(o._weights))
       , _partition_capacity(o._partition_capacity)
-      , _machine_labels(std::move(o._machine_labels)) {
+      , _machine_labels(std::move(o._machine_labels))
+      , _rack(std::move(o._rack)) {
         _hook.swap_nodes(o._hook);
     }
 
@@ -57,6 +60,15 @@ public:
     uint32_t cpus() const { return _weights.size(); }
     model::node_id id() const { return _id; }
     uint32_t partition_capacity() const { return _partition_capacity; }
+    const std::optional<ss::sstring>& rack() const { return _rack; }
+
+    /// fraction of the node's partition capacity that is already allocated.
+    /// allocation counts are the load signal available to the allocator; the
+    /// score is relative to capacity so heterogeneous nodes compare fairly.
+    double fill_factor() const {
+        const auto total = cpus() * max_allocations_per_core;
+        return double(total - _partition_capacity) / double(total);
+    }
 
 private:
     friend partition_allocator;
@@ -103,6 +115,8 @@ private:
     uint32_t _partition_capacity{0};
     /// generated by `rpk` usually in /etc/redpanda/machine_labels.json
     std::unordered_map<ss::sstring, ss::sstring> _machine_labels;
+    /// failure domain, from broker configuration
+    std::optional<ss::sstring> _rack;
 
     // for partition_allocator
     safe_intrusive_list_hook _hook;
@@ -150,13 +164,18 @@ public:
     using iterator = underlying_t::iterator;
     using cil_t = counted_intrusive_list<value_type, &allocation_node::_hook>;
 
+    /// per node load snapshot entry, see load_report()
+    struct node_load {
+        model::node_id id;
+        double fill_factor;
+        std::optional<ss::sstring> rack;
+    };
+
     /// should only be initialized _after_ we become the leader so we know we
     /// are up to date, and have the highest known group_id ever assigned
     /// reset to nullptr when no longer leader
     explicit partition_allocator(raft::group_id highest_known_group)
-      : _highest_group(highest_known_group) {
-        _rr = _available_machines.end();
-    }
+      : _highest_group(highest_known_group) {}
     void register_node(ptr n) {
         _available_machines.push_back(*n);
         _machines.emplace(n->id(), std::move(n));
@@ -182,10 +201,12 @@ public:
 
     const underlying_t& allocation_nodes() { return _machines; }
 
-    ~partition_allocator() {
-        _available_machines.clear();
-        _rr = _available_machines.end();
-    }
+    /// snapshot of per node fill factors, most loaded first. intended for
+    /// operator tooling that proposes partition moves; allocation counts are
+    /// the only load signal available here until a health feed exists
+    std::vector<node_load> load_report() const;
+
+    ~partition_allocator() { _available_machines.clear(); }
 
 private:
     friend partition_allocator_tester;
@@ -199,15 +220,18 @@ private:
     allocate_replicas(int16_t replication_factor);
     iterator find_node(model::node_id id);
 
-    [[gnu::always_inline]] inline cil_t::iterator& round_robin_ptr() {
-        if (_rr == _available_machines.end()) {
-            _rr = _available_machines.begin();
-        }
-        return _rr;
-    }
+    /// true when any of the already selected replicas lives in the given rack
+    bool is_rack_in_replicas(
+      const std::optional<ss::sstring>& rack,
+      const std::vector<model::broker_shard>& replicas);
+
+    /// scoring selection: the least filled machine that is not already a
+    /// replica, preferring machines from racks that do not hold one yet
+    allocation_node*
+    find_best_fit(const std::vector<model::broker_shard>& replicas);
+
     raft::group_id _highest_group;
 
-    cil_t::iterator _rr; // round robin
     cil_t _available_machines;
     underlying_t _machines;
 
@@ -67,6 +67,7 @@ void partition_leaders_table::update_partition_leader(
     // existing partition
     it->second.id = leader_id;
     it->second.update_term = term;
+    it->second.update_version = ++_version;
 
     // notify waiters if update is setting the leader
     if (!leader_id) {
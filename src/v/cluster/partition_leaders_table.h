@@ -59,14 +59,42 @@ public:
         }
     }
 
+    // clang-format off
+    template<typename Func>
+    CONCEPT(requires requires(
+      Func f,
+      model::topic_namespace_view tp_ns,
+      model::partition_id pid,
+      std::optional<model::node_id> leader,
+      model::term_id term) {
+            { f(tp_ns, pid, leader, term) } -> std::same_as<void>;
+    })
+    // clang-format on
+    /// Visits only the leaders updated after the given table version,
+    /// version 0 therefore visits every leader. Deletions are not tracked,
+    /// callers needing them must start over from version 0.
+    void for_each_leader_since(uint64_t version, Func&& f) const {
+        for (auto& [k, v] : _leaders) {
+            if (v.update_version > version) {
+                f(k.tp_ns, k.pid, v.id, v.update_term);
+            }
+        }
+    }
+
     void remove_leader(const model::ntp& ntp) {
-        _leaders.erase(
+        auto erased = _leaders.erase(
           leader_key_view{model::topic_namespace_view(ntp), ntp.tp.partition});
+        if (erased > 0) {
+            ++_version;
+        }
     }
 
     void update_partition_leader(
       const model::ntp&, model::term_id, std::optional<model::node_id>);
 
+    /// Monotonic counter bumped every time this shard's leader view changes
+    uint64_t version() const { return _version; }
+
 private:
     // optimized to reduce number of ntp copies
     struct leader_key {
@@ -127,6 +155,8 @@ private:
     struct leader_meta {
         std::optional<model::node_id> id;
         model::term_id update_term;
+        // table version at which this entry was last updated
+        uint64_t update_version{0};
     };
 
     absl::flat_hash_map<leader_key, leader_meta, leader_key_hash, leader_key_eq>
@@ -141,6 +171,8 @@ private:
       absl::node_hash_map<int32_t, expiring_promise<model::node_id>>>;
 
     promises_t _leader_promises;
+
+    uint64_t _version{0};
 };
 
 } // namespace cluster
@@ -10,6 +10,7 @@
 #include "cluster/partition_manager.h"
 
 #include "cluster/logger.h"
+#include "likely.h"
 #include "config/configuration.h"
 #include "model/metadata.h"
 #include "raft/consensus.h"
@@ -19,6 +20,7 @@
 #include "resource_mgmt/io_priority.h"
 #include "vlog.h"
 
+#include <seastar/core/future-util.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
@@ -34,25 +36,38 @@ ss::future<consensus_ptr> partition_manager::manage(
   storage::ntp_config ntp_cfg,
   raft::group_id group,
   std::vector<model::broker> initial_nodes) {
-    return _storage.log_mgr()
-      .manage(std::move(ntp_cfg))
-      .then([this, group, nodes = std::move(initial_nodes)](
-              storage::log&& log) mutable {
-          return _raft_manager.local()
-            .create_group(group, std::move(nodes), log)
-            .then([this, log, group](ss::lw_shared_ptr<raft::consensus> c) {
-                auto p = ss::make_lw_shared<partition>(c);
-                _ntp_table.emplace(log.config().ntp(), p);
-                _raft_table.emplace(group, p);
-                _manage_watchers.notify(p->ntp(), p);
-                return p->start().then([c] { return c; });
+    return ss::with_semaphore(
+      _lifecycle_sem,
+      1,
+      [this,
+       ntp_cfg = std::move(ntp_cfg),
+       group,
+       nodes = std::move(initial_nodes)]() mutable {
+          return _storage.log_mgr()
+            .manage(std::move(ntp_cfg))
+            .then([this, group, nodes = std::move(nodes)](
+                    storage::log&& log) mutable {
+                return _raft_manager.local()
+                  .create_group(group, std::move(nodes), log)
+                  .then(
+                    [this, log, group](ss::lw_shared_ptr<raft::consensus> c) {
+                        auto p = ss::make_lw_shared<partition>(c);
+                        _ntp_table.emplace(log.config().ntp(), p);
+                        _raft_table.emplace(group, p);
+                        _manage_watchers.notify(p->ntp(), p);
+                        return p->start().then([c] { return c; });
+                    });
             });
       });
 }
 
 ss::future<> partition_manager::stop() {
-    return ss::parallel_for_each(
-      _ntp_table, [](auto& p) { return p.second->stop(); });
+    // fan out, but under the lifecycle limit: every stop flushes the
+    // partition's log to disk
+    return ss::parallel_for_each(_ntp_table, [this](auto& p) {
+        return ss::with_semaphore(
+          _lifecycle_sem, 1, [&p] { return p.second->stop(); });
+    });
 }
 
 ss::future<> partition_manager::remove(const model::ntp& ntp) {
@@ -77,6 +92,43 @@ ss::future<> partition_manager::remove(const model::ntp& ntp) {
       .finally([partition] {}); // in the end remove partition
 }
 
+ss::future<std::vector<checked<raft::replicate_result, kafka::error_code>>>
+partition_manager::replicate(std::vector<ntp_replicate> items) {
+    using ret_t = checked<raft::replicate_result, kafka::error_code>;
+    std::vector<ss::future<ret_t>> futures;
+    futures.reserve(items.size());
+    for (auto& item : items) {
+        auto partition = get(item.ntp);
+        if (unlikely(!partition)) {
+            futures.push_back(ss::make_ready_future<ret_t>(
+              kafka::error_code::unknown_topic_or_partition));
+            continue;
+        }
+        if (unlikely(!partition->is_leader())) {
+            futures.push_back(ss::make_ready_future<ret_t>(
+              kafka::error_code::not_leader_for_partition));
+            continue;
+        }
+        futures.push_back(
+          partition->replicate(item.bid, std::move(item.reader), item.opts)
+            .then([partition,
+                   num_records = item.num_records,
+                   num_bytes = item.num_bytes](ret_t r) {
+                if (r.has_value()) {
+                    partition->probe().add_records_produced(num_records);
+                    partition->probe().add_bytes_produced(num_bytes);
+                }
+                return r;
+            })
+            .handle_exception(
+              [ntp = item.ntp](const std::exception_ptr& e) {
+                  vlog(clusterlog.warn, "replicating {} failed - {}", ntp, e);
+                  return ret_t(kafka::error_code::unknown_server_error);
+              }));
+    }
+    return ss::when_all_succeed(futures.begin(), futures.end());
+}
+
 std::ostream& operator<<(std::ostream& o, const partition_manager& pm) {
     return o << "{shard:" << ss::this_shard_id() << ", mngr:{}"
              << pm._storage.log_mgr()
@@ -20,6 +20,8 @@
 #include "storage/api.h"
 #include "utils/named_type.h"
 
+#include <seastar/core/semaphore.hh>
+
 #include <absl/container/flat_hash_map.h>
 
 namespace cluster {
@@ -54,6 +56,11 @@ public:
         return nullptr;
     }
 
+    const absl::flat_hash_map<model::ntp, ss::lw_shared_ptr<partition>>&
+    partitions() const {
+        return _ntp_table;
+    }
+
     ss::future<> start() { return ss::now(); }
     ss::future<> stop();
     ss::future<consensus_ptr>
@@ -61,6 +68,27 @@ public:
 
     ss::future<> remove(const model::ntp& ntp);
 
+    /// one partition's slice of a multi-partition replicate() call
+    struct ntp_replicate {
+        model::ntp ntp;
+        model::batch_identity bid;
+        model::record_batch_reader reader;
+        raft::replicate_options opts;
+        /// applied to the partition probe when the item succeeds
+        int32_t num_records{0};
+        size_t num_bytes{0};
+    };
+
+    /*
+     * Replicate a set of items, typically every partition of one produce
+     * request that lives on this shard, behind a single cross-shard hop.
+     * Results come back in item order; a missing partition, a follower
+     * replica or a failed replication is reported in-band through the
+     * item's error code, never as an exceptional future.
+     */
+    ss::future<std::vector<checked<raft::replicate_result, kafka::error_code>>>
+    replicate(std::vector<ntp_replicate>);
+
     std::optional<storage::log> log(const model::ntp& ntp) {
         return _storage.log_mgr().get(ntp);
     }
@@ -98,9 +126,18 @@ public:
     }
 
 private:
+    /// bound on simultaneous partition starts and stops. every lifecycle
+    /// operation opens or flushes log segments, so an unbounded fan-out
+    /// over thousands of partitions at startup or shutdown spikes open
+    /// file descriptors and disk bandwidth; a bounded pipeline keeps the
+    /// disk saturated without the spike. starts arriving from controller
+    /// reconciliation and the shutdown stop fan-out share the same limit.
+    static constexpr size_t max_concurrent_lifecycle_ops = 64;
+
     storage::api& _storage;
     /// used to wait for concurrent recoveries
     ss::sharded<raft::group_manager>& _raft_manager;
+    ss::semaphore _lifecycle_sem{max_concurrent_lifecycle_ops};
 
     ntp_callbacks<manage_cb_t> _manage_watchers;
     // XXX use intrusive containers here
@@ -15,7 +15,36 @@
 
 #include <seastar/core/metrics.hh>
 
+#include <algorithm>
+
 namespace cluster {
+
+bool partition_probe::is_leader() const { return _partition.is_leader(); }
+
+void partition_probe::add_bytes_produced(uint64_t bytes) {
+    _bytes_produced += bytes;
+    partition_load_tracker::local().add_bytes_produced(
+      _partition.ntp(), bytes);
+}
+
+void partition_probe::add_bytes_fetched(uint64_t bytes) {
+    _bytes_fetched += bytes;
+    partition_load_tracker::local().add_bytes_fetched(_partition.ntp(), bytes);
+}
+
+partition_probe::~partition_probe() {
+    if (_aggregated_as) {
+        topic_metrics_registry::local().remove(*_aggregated_as, this);
+    }
+}
+
+static bool wants_partition_detail(const model::ntp& ntp) {
+    const auto& topics
+      = config::shard_local_cfg().per_partition_metrics_topics();
+    return std::find(topics.begin(), topics.end(), ntp.tp.topic())
+           != topics.end();
+}
+
 void partition_probe::setup_metrics(const model::ntp& ntp) {
     namespace sm = ss::metrics;
 
@@ -23,6 +52,13 @@ void partition_probe::setup_metrics(const model::ntp& ntp) {
         return;
     }
 
+    if (!wants_partition_detail(ntp)) {
+        auto tp_ns = model::topic_namespace(ntp.ns, ntp.tp.topic);
+        topic_metrics_registry::local().add(tp_ns, this);
+        _aggregated_as = std::move(tp_ns);
+        return;
+    }
+
     auto ns_label = sm::label("namespace");
     auto topic_label = sm::label("topic");
     auto partition_label = sm::label("partition");
@@ -64,4 +100,95 @@ void partition_probe::setup_metrics(const model::ntp& ntp) {
           labels),
       });
 }
+
+partition_load_tracker& partition_load_tracker::local() {
+    static thread_local partition_load_tracker tracker;
+    return tracker;
+}
+
+topic_metrics_registry& topic_metrics_registry::local() {
+    static thread_local topic_metrics_registry registry;
+    return registry;
+}
+
+void topic_metrics_registry::add(
+  const model::topic_namespace& tp_ns, const partition_probe* probe) {
+    auto& entry = _topics[tp_ns];
+    entry.probes.push_back(probe);
+    if (entry.probes.size() == 1) {
+        setup_topic_metrics(tp_ns, entry);
+    }
+}
+
+void topic_metrics_registry::remove(
+  const model::topic_namespace& tp_ns, const partition_probe* probe) {
+    auto it = _topics.find(tp_ns);
+    if (it == _topics.end()) {
+        return;
+    }
+    auto& probes = it->second.probes;
+    probes.erase(
+      std::remove(probes.begin(), probes.end(), probe), probes.end());
+    if (probes.empty()) {
+        _topics.erase(it);
+    }
+}
+
+void topic_metrics_registry::setup_topic_metrics(
+  const model::topic_namespace& tp_ns, topic_metrics& entry) {
+    namespace sm = ss::metrics;
+
+    auto ns_label = sm::label("namespace");
+    auto topic_label = sm::label("topic");
+
+    const std::vector<sm::label_instance> labels = {
+      ns_label(tp_ns.ns()),
+      topic_label(tp_ns.tp()),
+    };
+
+    entry.metrics.add_group(
+      prometheus_sanitize::metrics_name("cluster:topic"),
+      {
+        sm::make_gauge(
+          "partitions",
+          [&entry] { return entry.probes.size(); },
+          sm::description(
+            "Number of partition replicas of this topic on this shard"),
+          labels),
+        sm::make_gauge(
+          "leaders",
+          [&entry] {
+              return std::count_if(
+                entry.probes.begin(),
+                entry.probes.end(),
+                [](const partition_probe* p) { return p->is_leader(); });
+          },
+          sm::description(
+            "Number of leader partitions of this topic on this shard"),
+          labels),
+        sm::make_derive(
+          "records_produced",
+          [&entry] {
+              uint64_t total = 0;
+              for (const auto* p : entry.probes) {
+                  total += p->records_produced();
+              }
+              return total;
+          },
+          sm::description("Total number of records produced"),
+          labels),
+        sm::make_derive(
+          "records_fetched",
+          [&entry] {
+              uint64_t total = 0;
+              for (const auto* p : entry.probes) {
+                  total += p->records_fetched();
+              }
+              return total;
+          },
+          sm::description("Total number of records fetched"),
+          labels),
+      });
+}
+
 } // namespace cluster
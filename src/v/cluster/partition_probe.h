@@ -11,10 +11,16 @@
 
 #pragma once
 #include "model/fundamental.h"
+#include "model/metadata.h"
+#include "utils/space_saving.h"
 
 #include <seastar/core/metrics_registration.hh>
 
+#include <absl/container/node_hash_map.h>
+
 #include <cstdint>
+#include <optional>
+#include <vector>
 
 namespace cluster {
 
@@ -25,6 +31,12 @@ public:
     explicit partition_probe(partition& partition)
       : _partition(partition) {}
 
+    partition_probe(const partition_probe&) = delete;
+    partition_probe& operator=(const partition_probe&) = delete;
+    partition_probe(partition_probe&&) = delete;
+    partition_probe& operator=(partition_probe&&) = delete;
+    ~partition_probe();
+
     void setup_metrics(const model::ntp&);
 
     void add_records_produced(uint64_t num_records) {
@@ -35,10 +47,84 @@ public:
         _records_fetched += num_records;
     }
 
+    // besides the counter these feed the shard's hot partition sketch,
+    // so they live in the translation unit where partition is complete
+    void add_bytes_produced(uint64_t bytes);
+    void add_bytes_fetched(uint64_t bytes);
+
+    uint64_t records_produced() const { return _records_produced; }
+    uint64_t records_fetched() const { return _records_fetched; }
+    bool is_leader() const;
+
 private:
     partition& _partition;
     uint64_t _records_produced = 0;
     uint64_t _records_fetched = 0;
+    uint64_t _bytes_produced = 0;
+    uint64_t _bytes_fetched = 0;
     ss::metrics::metric_groups _metrics;
+    // set when this probe reports through the shard's topic-level
+    // aggregate instead of its own series
+    std::optional<model::topic_namespace> _aggregated_as;
+};
+
+/// Shard-local registry exposing one aggregated series set per topic.
+///
+/// By default partition probes only keep raw counters and report here, so
+/// a scrape reads a handful of topic-level sums instead of per-partition
+/// series for every partition on the shard. Per-partition detail remains
+/// available by listing a topic in 'per_partition_metrics_topics'.
+class topic_metrics_registry {
+public:
+    void add(const model::topic_namespace&, const partition_probe*);
+    void remove(const model::topic_namespace&, const partition_probe*);
+
+    static topic_metrics_registry& local();
+
+private:
+    struct topic_metrics {
+        std::vector<const partition_probe*> probes;
+        ss::metrics::metric_groups metrics;
+    };
+
+    void setup_topic_metrics(const model::topic_namespace&, topic_metrics&);
+
+    // node map: metric lambdas capture references to the mapped values
+    absl::node_hash_map<
+      model::topic_namespace,
+      topic_metrics,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _topics;
 };
+
+/// Shard-local top-k sketches over per-partition produce and fetch bytes,
+/// fed by partition probes and read out through the admin API under
+/// /v1/debug/hot_keys. Answers "which partition is making this node hot"
+/// at any cardinality for a fixed few KiB per shard, where per-partition
+/// prometheus series would not.
+class partition_load_tracker {
+public:
+    /// partitions tracked per sketch per shard
+    static constexpr size_t capacity = 128;
+
+    using sketch_type = space_saving<model::ntp>;
+
+    void add_bytes_produced(const model::ntp& ntp, uint64_t bytes) {
+        _produce_bytes.record(ntp, bytes);
+    }
+    void add_bytes_fetched(const model::ntp& ntp, uint64_t bytes) {
+        _fetch_bytes.record(ntp, bytes);
+    }
+
+    const sketch_type& produce_bytes() const { return _produce_bytes; }
+    const sketch_type& fetch_bytes() const { return _fetch_bytes; }
+
+    static partition_load_tracker& local();
+
+private:
+    sketch_type _produce_bytes{capacity};
+    sketch_type _fetch_bytes{capacity};
+};
+
 } // namespace cluster
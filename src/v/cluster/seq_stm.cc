@@ -16,6 +16,7 @@
 
 #include <seastar/core/future.hh>
 
+#include <algorithm>
 #include <filesystem>
 
 namespace cluster {
@@ -29,7 +30,19 @@ seq_stm::seq_stm(
       "seq",
       ss::default_priority_class())
   , _log(logger)
-  , _config(config) {}
+  , _config(config) {
+    _snapshot_timer.set_callback([this] {
+        if (_gate.is_closed()) {
+            return;
+        }
+        (void)ss::with_gate(_gate, [this] {
+            if (_insync_offset <= _last_snapshot_offset) {
+                return ss::now();
+            }
+            return make_snapshot();
+        });
+    });
+}
 
 ss::future<> seq_stm::hydrate_snapshot(storage::snapshot_reader& reader) {
     return reader.read_metadata().then([this, &reader](iobuf meta_buf) {
@@ -46,12 +59,23 @@ ss::future<> seq_stm::hydrate_snapshot(storage::snapshot_reader& reader) {
           .then([this](iobuf data_buf) {
               iobuf_parser data_parser(std::move(data_buf));
               auto data = reflection::adl<snapshot>{}.from(data_parser);
+              // rebuild the lru list in write order so expiry still pops
+              // the oldest sessions first
+              std::sort(
+                data.entries.begin(),
+                data.entries.end(),
+                [](const seq_entry& a, const seq_entry& b) {
+                    return a.last_write_timestamp < b.last_write_timestamp;
+                });
               for (auto& entry : data.entries) {
                   auto pid_seq = _seq_table.find(entry.pid);
                   if (pid_seq == _seq_table.end()) {
-                      _seq_table.emplace(entry.pid, entry);
-                  } else if (pid_seq->second.seq < entry.seq) {
-                      pid_seq->second = entry;
+                      auto& session = track_session(entry.pid);
+                      session.entry = entry;
+                      touch_session(session);
+                  } else if (pid_seq->second.entry.seq < entry.seq) {
+                      pid_seq->second.entry = entry;
+                      touch_session(pid_seq->second);
                   }
               }
               _last_snapshot_offset = data.offset;
@@ -137,7 +161,7 @@ ss::future<> seq_stm::do_make_snapshot() {
     snapshot data;
     data.offset = _insync_offset;
     for (auto& entry : _seq_table) {
-        data.entries.push_back(entry.second);
+        data.entries.push_back(entry.second.entry);
     }
 
     iobuf v_buf;
@@ -151,7 +175,6 @@ ss::future<> seq_stm::do_make_snapshot() {
 }
 
 ss::future<> seq_stm::start() {
-    _oldest_session = model::timestamp::now();
     return _snapshot_mgr.open_snapshot().then(
       [this](std::optional<storage::snapshot_reader> reader) {
           auto f = ss::now();
@@ -178,6 +201,7 @@ ss::future<> seq_stm::start() {
 
           return f.then([this]() { return state_machine::start(); })
             .then([this]() {
+                _snapshot_timer.arm_periodic(periodic_snapshot_interval);
                 auto offset = _c->meta().commit_index;
                 if (offset >= model::offset(0)) {
                     (void)ss::with_gate(_gate, [this, offset] {
@@ -227,24 +251,21 @@ seq_stm::replicate(
                   checked<raft::replicate_result, kafka::error_code>>(
                   kafka::error_code::out_of_order_sequence_number);
             }
-            seq_entry entry{
+            auto& session = track_session(bid.pid);
+            session.entry = seq_entry{
               .pid = bid.pid,
               .seq = bid.last_seq,
               .last_write_timestamp = last_write_timestamp};
-            _oldest_session = std::min(
-              _oldest_session, model::timestamp(entry.last_write_timestamp));
-            _seq_table.emplace(entry.pid, entry);
+            touch_session(session);
         } else {
-            if (!is_sequence(pid_seq->second.seq, bid.first_seq)) {
+            if (!is_sequence(pid_seq->second.entry.seq, bid.first_seq)) {
                 return seastar::make_ready_future<
                   checked<raft::replicate_result, kafka::error_code>>(
                   kafka::error_code::out_of_order_sequence_number);
             }
-            pid_seq->second.seq += bid.last_seq;
-            pid_seq->second.last_write_timestamp = last_write_timestamp;
-            _oldest_session = std::min(
-              _oldest_session,
-              model::timestamp(pid_seq->second.last_write_timestamp));
+            pid_seq->second.entry.seq += bid.last_seq;
+            pid_seq->second.entry.last_write_timestamp = last_write_timestamp;
+            touch_session(pid_seq->second);
         }
         return _c->replicate(_insync_term, std::move(r), opts)
           .then([](result<raft::replicate_result> r) {
@@ -293,23 +314,29 @@ seq_stm::catchup(model::term_id last_term, model::offset last_offset) {
       });
 }
 
-void seq_stm::compact_snapshot() {
+seq_stm::seq_session& seq_stm::track_session(model::producer_identity pid) {
+    return _seq_table.try_emplace(pid).first->second;
+}
+
+void seq_stm::touch_session(seq_session& session) {
+    if (session.is_linked()) {
+        _lru.erase(_lru.iterator_to(session));
+    }
+    _lru.push_back(session);
+}
+
+void seq_stm::expire_stale_sessions() {
     auto cutoff_timestamp
       = model::timestamp::now().value()
         - _config.transactional_id_expiration_ms.value().count();
-    if (_oldest_session.value() < cutoff_timestamp) {
-        auto next_oldest_session = model::timestamp::now();
-        for (auto it = _seq_table.cbegin(); it != _seq_table.cend();) {
-            if (it->second.last_write_timestamp < cutoff_timestamp) {
-                _seq_table.erase(it++);
-            } else {
-                next_oldest_session = std::min(
-                  next_oldest_session,
-                  model::timestamp(it->second.last_write_timestamp));
-                ++it;
-            }
-        }
-        _oldest_session = next_oldest_session;
+    // the list is ordered by last write so expiry stops at the first live
+    // session; cost is proportional to the expired sessions, not the table
+    while (!_lru.empty()
+           && _lru.front().entry.last_write_timestamp < cutoff_timestamp) {
+        // the auto_unlink hook removes the session from the list when the
+        // table destroys it
+        auto pid = _lru.front().entry.pid;
+        _seq_table.erase(pid);
     }
 }
 
@@ -322,19 +349,19 @@ ss::future<> seq_stm::apply(model::record_batch b) {
       && bid.first_seq <= bid.last_seq) {
         auto pid_seq = _seq_table.find(bid.pid);
         if (pid_seq == _seq_table.end()) {
-            seq_entry entry{
+            auto& session = track_session(bid.pid);
+            session.entry = seq_entry{
               .pid = bid.pid,
               .seq = bid.last_seq,
               .last_write_timestamp = hdr.max_timestamp.value()};
-            _seq_table.emplace(bid.pid, entry);
-            _oldest_session = std::min(
-              _oldest_session, model::timestamp(entry.last_write_timestamp));
-        } else if (pid_seq->second.seq < bid.last_seq) {
-            pid_seq->second.seq = bid.last_seq;
-            pid_seq->second.last_write_timestamp = hdr.max_timestamp.value();
-            _oldest_session = std::min(_oldest_session, hdr.max_timestamp);
+            touch_session(session);
+        } else if (pid_seq->second.entry.seq < bid.last_seq) {
+            pid_seq->second.entry.seq = bid.last_seq;
+            pid_seq->second.entry.last_write_timestamp
+              = hdr.max_timestamp.value();
+            touch_session(pid_seq->second);
         }
-        compact_snapshot();
+        expire_stale_sessions();
     }
 
     _insync_offset = b.last_offset();
@@ -24,7 +24,10 @@
 #include "utils/expiring_promise.h"
 #include "utils/mutex.h"
 
-#include <absl/container/flat_hash_map.h>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/node_hash_map.h>
+#include <boost/intrusive/list.hpp>
 
 namespace cluster {
 
@@ -74,12 +77,25 @@ public:
       raft::replicate_options);
 
 private:
+    // on-disk snapshot entry, do not add non-serializable members here
     struct seq_entry {
         model::producer_identity pid;
         int32_t seq;
         model::timestamp::type last_write_timestamp;
     };
 
+    // in-memory session: a snapshot entry threaded on the lru list. the
+    // sessions live in a node hash map so the list hooks stay valid across
+    // rehashes
+    struct seq_session
+      : public boost::intrusive::list_base_hook<
+          boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
+        seq_entry entry;
+    };
+
+    using lru_list_t = boost::intrusive::
+      list<seq_session, boost::intrusive::constant_time_size<false>>;
+
     struct snapshot {
         model::offset offset;
         std::vector<seq_entry> entries;
@@ -112,15 +128,28 @@ private:
      */
     ss::future<> wait_for_snapshot_hydrated();
     ss::future<> persist_snapshot(iobuf&& data);
-    void compact_snapshot();
+    seq_session& track_session(model::producer_identity);
+    void touch_session(seq_session&);
+    void expire_stale_sessions();
 
     ss::future<> catchup(model::term_id, model::offset);
 
+    // snapshots taken on a timer keep leadership failover cheap: recovery
+    // replays only the log suffix after the latest snapshot instead of the
+    // whole partition history
+    static constexpr std::chrono::seconds periodic_snapshot_interval
+      = std::chrono::seconds(60);
+
     model::offset _last_snapshot_offset;
-    absl::flat_hash_map<model::producer_identity, seq_entry> _seq_table;
+    // open addressing with stable nodes; a dedup lookup is a single probe
+    // and the sessions can be threaded on the lru list across rehashes
+    absl::node_hash_map<model::producer_identity, seq_session> _seq_table;
+    // least recently written producer first; expiry pops from the front
+    // instead of scanning the whole table
+    lru_list_t _lru;
+    ss::timer<> _snapshot_timer;
     mutex _op_lock;
     ss::shared_promise<> _resolved_when_snapshot_hydrated;
-    model::timestamp _oldest_session;
     bool _is_catching_up{false};
     model::term_id _insync_term{-1};
     model::offset _insync_offset{-1};
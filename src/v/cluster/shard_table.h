@@ -12,17 +12,43 @@
 #pragma once
 
 #include "model/fundamental.h"
+#include "model/metadata.h"
 #include "raft/types.h"
 #include "seastarx.h"
+#include "utils/intrusive_list_helpers.h"
 
 #include <seastar/core/reactor.hh> // shard_id
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/node_hash_map.h>
+
+#include <vector>
 
 namespace cluster {
 /// \brief this is populated by consensus::controller
 /// every core will have a _full_ copy of all indexes
 class shard_table final {
+private:
+    /**
+     * Entry for a single ntp. Entries live in a node hash map so that their
+     * addresses are stable and they can be linked into the by-topic and
+     * by-shard secondary indexes with intrusive hooks, making those scans
+     * proportional to the result size instead of the whole table.
+     */
+    struct ntp_entry {
+        ntp_entry(model::ntp n, ss::shard_id s)
+          : ntp(std::move(n))
+          , shard(s) {}
+        model::ntp ntp;
+        ss::shard_id shard;
+        safe_intrusive_list_hook _topic_hook;
+        safe_intrusive_list_hook _shard_hook;
+    };
+    using topic_list_t
+      = counted_intrusive_list<ntp_entry, &ntp_entry::_topic_hook>;
+    using shard_list_t
+      = counted_intrusive_list<ntp_entry, &ntp_entry::_shard_hook>;
+
 public:
     bool contains(const raft::group_id& group) {
         return _group_idx.find(group) != _group_idx.end();
@@ -36,24 +62,110 @@ public:
      */
     std::optional<ss::shard_id> shard_for(const model::ntp& ntp) {
         if (auto it = _ntp_idx.find(ntp); it != _ntp_idx.end()) {
-            return it->second;
+            return it->second.shard;
         }
         return std::nullopt;
     }
+
+    /**
+     * Visits (ntp, shard) for every partition of the given topic.
+     */
+    template<typename Func>
+    void
+    for_each_topic_partition(model::topic_namespace_view tp_ns, Func f) const {
+        if (auto it = _topic_idx.find(tp_ns); it != _topic_idx.end()) {
+            for (const ntp_entry& e : it->second) {
+                f(e.ntp, e.shard);
+            }
+        }
+    }
+
+    /**
+     * Visits every ntp placed on the given shard.
+     */
+    template<typename Func>
+    void for_each_ntp_on_shard(ss::shard_id shard, Func f) const {
+        if (shard < _shard_idx.size()) {
+            for (const ntp_entry& e : _shard_idx[shard]) {
+                f(e.ntp);
+            }
+        }
+    }
+
+    /// Number of partitions placed on the given shard, O(1)
+    size_t partition_count(ss::shard_id shard) const {
+        return shard < _shard_idx.size() ? _shard_idx[shard].size() : 0;
+    }
+
+    /**
+     * Monotonically increasing counter bumped by every mutation. Lets
+     * callers cache lookup results and validate them with a single
+     * comparison instead of re-resolving through the table.
+     */
+    int64_t version() const { return _version; }
+
     void insert(model::ntp ntp, ss::shard_id i) {
-        _ntp_idx.insert({std::move(ntp), i});
+        ++_version;
+        if (auto it = _ntp_idx.find(ntp); it != _ntp_idx.end()) {
+            // partition was moved to a different core, relink the by-shard
+            // index
+            auto& e = it->second;
+            auto& old_list = shard_list(e.shard);
+            old_list.erase(old_list.iterator_to(e));
+            e.shard = i;
+            shard_list(i).push_back(e);
+            return;
+        }
+        auto [it, _] = _ntp_idx.emplace(
+          std::piecewise_construct,
+          std::forward_as_tuple(ntp),
+          std::forward_as_tuple(ntp, i));
+        auto& e = it->second;
+        _topic_idx[model::topic_namespace(ntp.ns, ntp.tp.topic)].push_back(e);
+        shard_list(i).push_back(e);
+    }
+
+    void insert(raft::group_id g, ss::shard_id i) {
+        ++_version;
+        _group_idx.insert_or_assign(g, i);
     }
-    void insert(raft::group_id g, ss::shard_id i) { _group_idx.insert({g, i}); }
 
     void erase(const model::ntp& ntp, raft::group_id g) {
-        _ntp_idx.erase(ntp);
+        ++_version;
+        if (auto it = _ntp_idx.find(ntp); it != _ntp_idx.end()) {
+            auto& e = it->second;
+            auto t_it = _topic_idx.find(model::topic_namespace_view(e.ntp));
+            t_it->second.erase(t_it->second.iterator_to(e));
+            if (t_it->second.empty()) {
+                _topic_idx.erase(t_it);
+            }
+            auto& s_list = shard_list(e.shard);
+            s_list.erase(s_list.iterator_to(e));
+            _ntp_idx.erase(it);
+        }
         _group_idx.erase(g);
     }
 
 private:
-    // kafka index
-    absl::flat_hash_map<model::ntp, ss::shard_id> _ntp_idx;
+    shard_list_t& shard_list(ss::shard_id i) {
+        if (_shard_idx.size() <= i) {
+            _shard_idx.resize(i + 1);
+        }
+        return _shard_idx[i];
+    }
+
+    // kafka index, node map for entry address stability
+    absl::node_hash_map<model::ntp, ntp_entry> _ntp_idx;
     // raft index
     absl::flat_hash_map<raft::group_id, ss::shard_id> _group_idx;
+    // secondary indexes over _ntp_idx entries
+    absl::node_hash_map<
+      model::topic_namespace,
+      topic_list_t,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _topic_idx;
+    std::vector<shard_list_t> _shard_idx;
+    int64_t _version{0};
 };
 } // namespace cluster
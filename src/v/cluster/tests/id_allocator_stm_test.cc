@@ -56,12 +56,13 @@ FIXTURE_TEST(stm_monotonicity_test, mux_state_machine_fixture) {
 
     for (int i = 0; i < 5; i++) {
         auto result
-          = stm.allocate_id_and_wait(model::timeout_clock::now() + 1s).get0();
+          = stm.allocate_id_range_and_wait(1, model::timeout_clock::now() + 1s)
+              .get0();
 
         BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
-        BOOST_REQUIRE_LT(last_id, result.id);
+        BOOST_REQUIRE_LT(last_id, result.base);
 
-        last_id = result.id;
+        last_id = result.base;
     }
 }
 
@@ -80,12 +81,13 @@ FIXTURE_TEST(stm_restart_test, mux_state_machine_fixture) {
 
     for (int i = 0; i < 5; i++) {
         auto result
-          = stm1.allocate_id_and_wait(model::timeout_clock::now() + 1s).get0();
+          = stm1.allocate_id_range_and_wait(1, model::timeout_clock::now() + 1s)
+              .get0();
 
         BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
-        BOOST_REQUIRE_LT(last_id, result.id);
+        BOOST_REQUIRE_LT(last_id, result.base);
 
-        last_id = result.id;
+        last_id = result.base;
     }
     stm1.stop().get0();
 
@@ -93,12 +95,13 @@ FIXTURE_TEST(stm_restart_test, mux_state_machine_fixture) {
     stm2.start().get0();
     for (int i = 0; i < 5; i++) {
         auto result
-          = stm2.allocate_id_and_wait(model::timeout_clock::now() + 1s).get0();
+          = stm2.allocate_id_range_and_wait(1, model::timeout_clock::now() + 1s)
+              .get0();
 
         BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
-        BOOST_REQUIRE_LT(last_id, result.id);
+        BOOST_REQUIRE_LT(last_id, result.base);
 
-        last_id = result.id;
+        last_id = result.base;
     }
     stm2.stop().get0();
 }
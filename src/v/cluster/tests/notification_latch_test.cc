@@ -26,6 +26,17 @@ SEASTAR_THREAD_TEST_CASE(test_notify_before_timeout) {
     BOOST_REQUIRE_EQUAL(r, cluster::errc::success);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_notify_wakes_earlier_offsets) {
+    cluster::notification_latch latch;
+    auto f_5 = latch.wait_for(model::offset(5), model::no_timeout);
+    auto f_10 = latch.wait_for(model::offset(10), model::no_timeout);
+    // applied offsets advance monotonically, one notification resolves
+    // every waiter at or below it
+    latch.notify(model::offset(10));
+    BOOST_REQUIRE_EQUAL(f_5.get0(), cluster::errc::success);
+    BOOST_REQUIRE_EQUAL(f_10.get0(), cluster::errc::success);
+}
+
 SEASTAR_THREAD_TEST_CASE(test_notify_after_timeout) {
     cluster::notification_latch latch;
     ss::timer<> timer;
@@ -12,6 +12,8 @@
 #include "raft/types.h"
 #include "test_utils/fixture.h"
 
+#include <absl/container/flat_hash_set.h>
+
 using namespace cluster; // NOLINT
 
 uint allocated_nodes_count(const std::vector<partition_assignment>& allocs) {
@@ -197,4 +199,35 @@ FIXTURE_TEST(allocation_units_test, partition_allocator_tester) {
       machines().at(model::node_id(2))->partition_capacity(), max);
     // we do not decrement the highest raft group
     BOOST_REQUIRE_EQUAL(highest_group()(), partitions);
+}
+
+BOOST_AUTO_TEST_CASE(rack_aware_assignment) {
+    cluster::partition_allocator pa(raft::group_id(0));
+    // two nodes in each of racks a and b, one node in rack c
+    static const std::vector<std::pair<int, ss::sstring>> racks = {
+      {0, "rack-a"}, {1, "rack-a"}, {2, "rack-b"}, {3, "rack-b"}, {4, "rack-c"}};
+    for (auto& [id, rack] : racks) {
+        pa.register_node(std::make_unique<allocation_node>(
+          model::node_id(id),
+          4,
+          std::unordered_map<ss::sstring, ss::sstring>{},
+          rack));
+    }
+
+    topic_configuration cfg(
+      model::ns("test_ns"), model::topic("racked"), 12, 3);
+    auto allocs = pa.allocate(cfg).value();
+
+    for (auto& assignment : allocs.get_assignments()) {
+        absl::flat_hash_set<ss::sstring> replica_racks;
+        for (auto& bs : assignment.replicas) {
+            for (auto& [id, rack] : racks) {
+                if (model::node_id(id) == bs.node_id) {
+                    replica_racks.insert(rack);
+                }
+            }
+        }
+        // with three racks available every replica lands in a distinct rack
+        BOOST_REQUIRE_EQUAL(replica_racks.size(), 3);
+    }
 }
\ No newline at end of file
@@ -251,6 +251,69 @@ FIXTURE_TEST(test_seq_stm_prevents_gaps, mux_state_machine_fixture) {
         kafka::error_code::out_of_order_sequence_number));
 }
 
+FIXTURE_TEST(test_seq_stm_expires_stale_sessions, mux_state_machine_fixture) {
+    start_raft();
+
+    config::configuration cfg;
+    cfg.transactional_id_expiration_ms.set_value(std::chrono::milliseconds(0));
+
+    cluster::seq_stm stm(logger, _raft.get(), cfg);
+
+    stm.start().get0();
+    auto stop = ss::defer([&stm] { stm.stop().get0(); });
+
+    wait_for_leader();
+    wait_for_meta_initialized();
+
+    stm.catchup().get0();
+
+    auto count = 5;
+    auto rdr1 = random_batch_reader(storage::test::record_batch_spec{
+      .offset = model::offset(0),
+      .allow_compression = true,
+      .count = count,
+      .producer_id = 1,
+      .base_sequence = 0});
+    auto bid1 = model::batch_identity{
+      .pid = model::producer_identity{.id = 1, .epoch = 0},
+      .first_seq = 0,
+      .last_seq = count - 1};
+    auto r1 = stm
+                .replicate(
+                  bid1,
+                  std::move(rdr1),
+                  raft::replicate_options(raft::consistency_level::quorum_ack))
+                .get0();
+    BOOST_REQUIRE((bool)r1);
+
+    // with a zero expiration the session is dropped as soon as the batch is
+    // applied, so restarting the producer from sequence zero must eventually
+    // pass the dedup check instead of failing as out of order
+    tests::cooperative_spin_wait_with_timeout(
+      std::chrono::seconds(10),
+      [&stm, count] {
+          auto rdr = random_batch_reader(storage::test::record_batch_spec{
+            .offset = model::offset(count),
+            .allow_compression = true,
+            .count = count,
+            .producer_id = 1,
+            .base_sequence = 0});
+          auto bid = model::batch_identity{
+            .pid = model::producer_identity{.id = 1, .epoch = 0},
+            .first_seq = 0,
+            .last_seq = count - 1};
+          return stm
+            .replicate(
+              bid,
+              std::move(rdr),
+              raft::replicate_options(raft::consistency_level::quorum_ack))
+            .then([](checked<raft::replicate_result, kafka::error_code> r) {
+                return (bool)r;
+            });
+      })
+      .get0();
+}
+
 FIXTURE_TEST(
   test_seq_stm_prevents_odd_session_start_off, mux_state_machine_fixture) {
     start_raft();
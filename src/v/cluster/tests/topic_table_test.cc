@@ -105,6 +105,29 @@ FIXTURE_TEST(get_getting_config, topic_table_fixture) {
       tristate(std::make_optional(std::chrono::milliseconds(3600000))));
 }
 
+FIXTURE_TEST(test_metadata_snapshot, topic_table_fixture) {
+    create_topics();
+    auto snap_1 = table.local().topic_metadata_snapshot();
+    auto snap_2 = table.local().topic_metadata_snapshot();
+    // unchanged table shares the same materialized snapshot
+    BOOST_REQUIRE_EQUAL(snap_1.get(), snap_2.get());
+    BOOST_REQUIRE_EQUAL(snap_1->size(), 3);
+
+    auto res = table.local()
+                 .apply(
+                   cluster::delete_topic_cmd(
+                     make_tp_ns("test_tp_2"), make_tp_ns("test_tp_2")),
+                   model::offset(0))
+                 .get0();
+    BOOST_REQUIRE_EQUAL(res, cluster::errc::success);
+
+    auto snap_3 = table.local().topic_metadata_snapshot();
+    BOOST_REQUIRE(snap_1.get() != snap_3.get());
+    BOOST_REQUIRE_EQUAL(snap_3->size(), 2);
+    // the old snapshot is immutable and still valid for its holders
+    BOOST_REQUIRE_EQUAL(snap_1->size(), 3);
+}
+
 FIXTURE_TEST(test_wait_aborted, topic_table_fixture) {
     ss::abort_source local_as;
     ss::timer<> timer;
@@ -152,6 +152,8 @@ topic_table::apply(finish_moving_partition_replicas_cmd cmd, model::offset o) {
 }
 
 void topic_table::notify_waiters() {
+    // every successful apply funnels through here after mutating the table
+    ++_version;
     if (_waiters.empty()) {
         return;
     }
@@ -235,6 +237,22 @@ std::vector<model::topic_metadata> topic_table::all_topics_metadata() const {
     });
 }
 
+std::vector<topic_configuration_assignment>
+topic_table::all_topic_assignments() const {
+    return transform_topics(
+      [](const topic_configuration_assignment& td) { return td; });
+}
+
+ss::lw_shared_ptr<const std::vector<model::topic_metadata>>
+topic_table::topic_metadata_snapshot() const {
+    if (!_metadata_snapshot || _snapshot_version != _version) {
+        _metadata_snapshot = ss::make_lw_shared<
+          const std::vector<model::topic_metadata>>(all_topics_metadata());
+        _snapshot_version = _version;
+    }
+    return _metadata_snapshot;
+}
+
 bool topic_table::contains(
   model::topic_namespace_view topic, model::partition_id pid) const {
     if (auto it = _topics.find(topic); it != _topics.end()) {
@@ -17,6 +17,8 @@
 #include "model/fundamental.h"
 #include "utils/expiring_promise.h"
 
+#include <seastar/core/shared_ptr.hh>
+
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
@@ -125,12 +127,28 @@ public:
     /// Returns metadata of all topics.
     std::vector<model::topic_metadata> all_topics_metadata() const;
 
+    /// Returns a copy of every topic's configuration and current partition
+    /// assignments, i.e. the full replicated state of this table, for
+    /// persisting a snapshot of it
+    std::vector<topic_configuration_assignment> all_topic_assignments() const;
+
+    /// Returns an immutable snapshot of all topics metadata. The snapshot
+    /// is materialized at most once per table update and shared between
+    /// readers, so the steady-state read is a shared pointer copy and a
+    /// scan of a flat vector instead of a map walk
+    ss::lw_shared_ptr<const std::vector<model::topic_metadata>>
+    topic_metadata_snapshot() const;
+
     /// Checks if it has given partition
     bool contains(model::topic_namespace_view, model::partition_id) const;
 
     /// Returns partition leader
     std::optional<model::node_id> get_leader(const model::ntp&) const;
 
+    /// Monotonic counter bumped every time this shard's copy of the table
+    /// changes, letting consumers detect staleness of derived state
+    uint64_t version() const { return _version; }
+
     /// Updates partition leader and notify waiters if needed
     void update_partition_leader(
       const model::ntp&, model::term_id, std::optional<model::node_id>);
@@ -169,5 +187,11 @@ private:
     std::vector<std::pair<cluster::notification_id_type, delta_cb_t>>
       _notifications;
     uint64_t _waiter_id{0};
+    uint64_t _version{0};
+
+    // lazily rebuilt by topic_metadata_snapshot() when it lags _version
+    mutable ss::lw_shared_ptr<const std::vector<model::topic_metadata>>
+      _metadata_snapshot;
+    mutable uint64_t _snapshot_version{0};
 };
 } // namespace cluster
@@ -87,6 +87,30 @@ topic_updates_dispatcher::apply_update(model::record_batch b) {
       });
 }
 
+ss::future<> topic_updates_dispatcher::apply_snapshot(
+  model::offset offset, std::vector<topic_configuration_assignment> topics) {
+    return ss::do_with(
+      std::move(topics),
+      [this, offset](std::vector<topic_configuration_assignment>& topics) {
+          return ss::do_for_each(
+            topics, [this, offset](topic_configuration_assignment& t) {
+                return ss::do_with(
+                  create_topic_cmd(t.cfg.tp_ns, std::move(t)),
+                  [this, offset](create_topic_cmd& cmd) {
+                      return dispatch_updates_to_cores(cmd, offset)
+                        .then([this, &cmd](std::error_code ec) {
+                            vassert(
+                              ec == errc::success,
+                              "Unable to seed topic {} from snapshot - {}",
+                              cmd.key,
+                              ec.message());
+                            update_allocations(cmd);
+                        });
+                  });
+            });
+      });
+}
+
 template<typename Cmd>
 ss::future<std::error_code> do_apply(
   ss::shard_id shard,
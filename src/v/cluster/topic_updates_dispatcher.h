@@ -53,6 +53,12 @@ public:
 
     ss::future<std::error_code> apply_update(model::record_batch);
 
+    /// Seeds the topic tables and the allocation state from a snapshot of
+    /// topic assignments, equivalent to replaying the commands that
+    /// produced them. Used at bootstrap before replaying the log suffix.
+    ss::future<>
+      apply_snapshot(model::offset, std::vector<topic_configuration_assignment>);
+
     static constexpr auto commands = make_commands_list<
       create_topic_cmd,
       delete_topic_cmd,
@@ -260,21 +260,30 @@ ss::future<std::vector<topic_result>> topics_frontend::autocreate_topics(
   model::timeout_clock::duration timeout) {
     vlog(clusterlog.trace, "Auto create topics {}", topics);
 
-    auto leader = _leaders.local().get_leader(model::controller_ntp);
-
-    // no leader available
-    if (!leader) {
-        return ss::make_ready_future<std::vector<topic_result>>(
-          create_topic_results(topics, errc::no_leader_controller));
-    }
-    // current node is a leader controller
-    if (leader == _self) {
-        return create_topics(
-          std::move(topics), model::timeout_clock::now() + timeout);
-    }
-    // dispatch to leader
-    return dispatch_create_to_leader(
-      leader.value(), std::move(topics), timeout);
+    // subscribe for controller leadership instead of failing immediately,
+    // during an election the future resolves as soon as the new leader is
+    // disseminated
+    return _leaders.local()
+      .wait_for_leader(
+        model::controller_ntp, model::timeout_clock::now() + timeout, {})
+      .then_wrapped([this, topics = std::move(topics), timeout](
+                      ss::future<model::node_id> f) mutable {
+          try {
+              auto leader = f.get0();
+              // current node is a leader controller
+              if (leader == _self) {
+                  return create_topics(
+                    std::move(topics), model::timeout_clock::now() + timeout);
+              }
+              // dispatch to leader
+              return dispatch_create_to_leader(
+                leader, std::move(topics), timeout);
+          } catch (...) {
+              // no leader elected within the timeout
+              return ss::make_ready_future<std::vector<topic_result>>(
+                create_topic_results(topics, errc::no_leader_controller));
+          }
+      });
 }
 
 ss::future<std::vector<topic_result>>
@@ -328,26 +337,45 @@ ss::future<std::error_code> topics_frontend::finish_moving_partition_replicas(
   model::ntp ntp,
   std::vector<model::broker_shard> new_replica_set,
   model::timeout_clock::time_point tout) {
-    auto leader = _leaders.local().get_leader(model::controller_ntp);
-
-    // no leader available
-    if (!leader) {
-        return ss::make_ready_future<std::error_code>(
-          errc::no_leader_controller);
-    }
-    // current node is a leader, just replicate
-    if (leader == _self) {
-        finish_moving_partition_replicas_cmd cmd(
-          std::move(ntp), std::move(new_replica_set));
+    // wait out a controller election instead of failing right away, the
+    // backend retries this operation on whole reconciliation loop intervals
+    return _leaders.local()
+      .wait_for_leader(model::controller_ntp, tout, {})
+      .then_wrapped(
+        [this,
+         ntp = std::move(ntp),
+         new_replica_set = std::move(new_replica_set),
+         tout](ss::future<model::node_id> f) mutable {
+            model::node_id leader;
+            try {
+                leader = f.get0();
+            } catch (...) {
+                // no leader elected within the timeout
+                return ss::make_ready_future<std::error_code>(
+                  errc::no_leader_controller);
+            }
+            // current node is a leader, just replicate
+            if (leader == _self) {
+                finish_moving_partition_replicas_cmd cmd(
+                  std::move(ntp), std::move(new_replica_set));
 
-        return replicate_and_wait(std::move(cmd), tout);
-    }
+                return replicate_and_wait(std::move(cmd), tout);
+            }
+            return dispatch_finish_moving_to_leader(
+              leader, std::move(ntp), std::move(new_replica_set), tout);
+        });
+}
 
+ss::future<std::error_code> topics_frontend::dispatch_finish_moving_to_leader(
+  model::node_id leader,
+  model::ntp ntp,
+  std::vector<model::broker_shard> new_replica_set,
+  model::timeout_clock::time_point tout) {
     return _connections.local()
       .with_node_client<controller_client_protocol>(
         _self,
         ss::this_shard_id(),
-        *leader,
+        leader,
         tout,
         [ntp = std::move(ntp), replicas = std::move(new_replica_set), tout](
           controller_client_protocol client) mutable {
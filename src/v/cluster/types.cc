@@ -36,7 +36,9 @@ storage::ntp_config topic_configuration::make_ntp_config(
                          || segment_size || retention_bytes.has_value()
                          || retention_bytes.is_disabled()
                          || retention_duration.has_value()
-                         || retention_duration.is_disabled() || is_internal();
+                         || retention_duration.is_disabled() || flush_interval
+                         || flush_bytes || compression || in_memory
+                         || is_internal();
     std::unique_ptr<storage::ntp_config::default_overrides> overrides = nullptr;
 
     if (has_overrides) {
@@ -48,8 +50,14 @@ storage::ntp_config topic_configuration::make_ntp_config(
             .retention_bytes = retention_bytes,
             .retention_time = retention_duration,
             // we disable cache for internal topics as they are read only once
-            // during bootstrap.
-            .cache_enabled = storage::with_cache(!is_internal())});
+            // during bootstrap. in-memory topics are their own cache
+            .cache_enabled = storage::with_cache(!is_internal() && !in_memory),
+            .flush_interval = flush_interval,
+            .flush_bytes = flush_bytes,
+            // kafka compression.type - when a codec is configured the broker
+            // owns the on disk encoding and recompresses in the background
+            .recompression = compression,
+            .memory_backed = storage::in_memory_backed(in_memory)});
     }
     return storage::ntp_config(
       model::ntp(tp_ns.ns, tp_ns.tp, p_id),
@@ -84,7 +92,8 @@ std::ostream& operator<<(std::ostream& o, const topic_configuration& cfg) {
       "{{ topic: {}, partition_count: {}, replication_factor: {}, compression: "
       "{}, cleanup_policy_bitflags: {}, compaction_strategy: {}, "
       "retention_bytes: {}, "
-      "retention_duration_hours: {}, segment_size: {}, timestamp_type: {} }}",
+      "retention_duration_hours: {}, segment_size: {}, timestamp_type: {}, "
+      "flush_interval_ms: {}, flush_bytes: {}, in_memory: {} }}",
       cfg.tp_ns,
       cfg.partition_count,
       cfg.replication_factor,
@@ -94,7 +103,10 @@ std::ostream& operator<<(std::ostream& o, const topic_configuration& cfg) {
       cfg.retention_bytes,
       cfg.retention_duration,
       cfg.segment_size,
-      cfg.timestamp_type);
+      cfg.timestamp_type,
+      cfg.flush_interval ? cfg.flush_interval->count() : -1,
+      cfg.flush_bytes,
+      cfg.in_memory);
 
     return o;
 }
@@ -139,7 +151,10 @@ void adl<cluster::topic_configuration>::to(
       t.timestamp_type,
       t.segment_size,
       t.retention_bytes,
-      t.retention_duration);
+      t.retention_duration,
+      t.flush_interval,
+      t.flush_bytes,
+      t.in_memory);
 }
 
 cluster::topic_configuration
@@ -162,6 +177,10 @@ adl<cluster::topic_configuration>::from(iobuf_parser& in) {
     cfg.retention_bytes = adl<tristate<size_t>>{}.from(in);
     cfg.retention_duration = adl<tristate<std::chrono::milliseconds>>{}.from(
       in);
+    cfg.flush_interval
+      = adl<std::optional<std::chrono::milliseconds>>{}.from(in);
+    cfg.flush_bytes = adl<std::optional<size_t>>{}.from(in);
+    cfg.in_memory = adl<bool>{}.from(in);
 
     return cfg;
 }
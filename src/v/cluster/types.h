@@ -34,11 +34,15 @@ using broker_ptr = ss::lw_shared_ptr<model::broker>;
 
 struct allocate_id_request {
     model::timeout_clock::duration timeout;
+    // number of consecutive ids to lease with a single request
+    int64_t range{1};
 };
 
 struct allocate_id_reply {
+    // first id of the leased range, [id, id + range)
     int64_t id;
     errc ec;
+    int64_t range{1};
 };
 
 /// Join request sent by node to join raft-0
@@ -107,6 +111,13 @@ struct topic_configuration {
     std::optional<model::compaction_strategy> compaction_strategy;
     std::optional<model::timestamp_type> timestamp_type;
     std::optional<size_t> segment_size;
+    // relaxed-fsync durability thresholds, see
+    // storage::ntp_config::default_overrides
+    std::optional<std::chrono::milliseconds> flush_interval;
+    std::optional<size_t> flush_bytes;
+    // topic lives purely in memory: replicated but never persisted,
+    // bounded by the retention settings
+    bool in_memory{false};
 
     // Tristate fields
     // Mapped according to the following policy:
@@ -0,0 +1,107 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "compression/internal/ctx_pool.h"
+
+#include "resource_mgmt/memory_groups.h"
+
+#include <new>
+
+namespace compression::internal {
+
+ctx_pool::cctx_guard::~cctx_guard() noexcept {
+    if (_ctx) {
+        local_ctx_pool().add(std::move(_ctx));
+    }
+}
+
+ctx_pool::dctx_guard::~dctx_guard() noexcept {
+    if (_ctx) {
+        local_ctx_pool().add(std::move(_ctx));
+    }
+}
+
+ctx_pool::scratch_guard::~scratch_guard() noexcept {
+    if (!_buf.empty()) {
+        local_ctx_pool().add(std::move(_buf));
+    }
+}
+
+ctx_pool::ctx_pool() noexcept
+  : _max_cached_bytes(memory_groups::compression_reserved_memory()) {}
+
+ctx_pool::cctx_guard ctx_pool::checkout_cctx() {
+    if (!_cctx.empty()) {
+        auto ctx = std::move(_cctx.back());
+        _cctx.pop_back();
+        _cached_bytes -= ZSTD_sizeof_CCtx(ctx.get());
+        return cctx_guard(std::move(ctx));
+    }
+    zstd_compress_ctx ctx(ZSTD_createCCtx());
+    if (!ctx) {
+        throw std::bad_alloc{};
+    }
+    return cctx_guard(std::move(ctx));
+}
+
+ctx_pool::dctx_guard ctx_pool::checkout_dctx() {
+    if (!_dctx.empty()) {
+        auto ctx = std::move(_dctx.back());
+        _dctx.pop_back();
+        _cached_bytes -= ZSTD_sizeof_DCtx(ctx.get());
+        return dctx_guard(std::move(ctx));
+    }
+    zstd_decompress_ctx ctx(ZSTD_createDCtx());
+    if (!ctx) {
+        throw std::bad_alloc{};
+    }
+    return dctx_guard(std::move(ctx));
+}
+
+ctx_pool::scratch_guard ctx_pool::checkout_scratch(size_t size) {
+    for (auto it = _scratch.begin(); it != _scratch.end(); ++it) {
+        if (it->size() >= size) {
+            auto buf = std::move(*it);
+            _scratch.erase(it);
+            _cached_bytes -= buf.size();
+            return scratch_guard(std::move(buf), size);
+        }
+    }
+    return scratch_guard(ss::temporary_buffer<char>(size), size);
+}
+
+void ctx_pool::add(zstd_compress_ctx ctx) {
+    const auto sz = ZSTD_sizeof_CCtx(ctx.get());
+    if (_cached_bytes + sz > _max_cached_bytes) {
+        return;
+    }
+    ZSTD_CCtx_reset(ctx.get(), ZSTD_reset_session_and_parameters);
+    _cached_bytes += sz;
+    _cctx.push_back(std::move(ctx));
+}
+
+void ctx_pool::add(zstd_decompress_ctx ctx) {
+    const auto sz = ZSTD_sizeof_DCtx(ctx.get());
+    if (_cached_bytes + sz > _max_cached_bytes) {
+        return;
+    }
+    ZSTD_DCtx_reset(ctx.get(), ZSTD_reset_session_and_parameters);
+    _cached_bytes += sz;
+    _dctx.push_back(std::move(ctx));
+}
+
+void ctx_pool::add(ss::temporary_buffer<char> buf) {
+    if (_cached_bytes + buf.size() > _max_cached_bytes) {
+        return;
+    }
+    _cached_bytes += buf.size();
+    _scratch.push_back(std::move(buf));
+}
+
+} // namespace compression::internal
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+#include "static_deleter_fn.h"
+
+#include <seastar/core/temporary_buffer.hh>
+
+#include <memory>
+#include <vector>
+#include <zstd.h>
+
+namespace compression::internal {
+
+/// Per-shard cache of reusable compression working state. A zstd context
+/// allocates a large workspace on creation and we used to recreate one for
+/// every batch on the produce path; the same goes for the scratch buffers
+/// used to linearize fragmented iobufs. Contexts and buffers are checked
+/// out RAII-style and returned to the pool reset, ready for the next
+/// caller. The amount of memory retained by the pool is bounded by
+/// memory_groups::compression_reserved_memory().
+class ctx_pool {
+public:
+    using zstd_compress_ctx = std::unique_ptr<
+      ZSTD_CCtx,
+      // wrap ZSTD C API
+      static_sized_deleter_fn<ZSTD_CCtx, &ZSTD_freeCCtx>>;
+    using zstd_decompress_ctx = std::unique_ptr<
+      ZSTD_DCtx,
+      // wrap ZSTD C API
+      static_sized_deleter_fn<ZSTD_DCtx, &ZSTD_freeDCtx>>;
+
+    class cctx_guard {
+    public:
+        explicit cctx_guard(zstd_compress_ctx ctx)
+          : _ctx(std::move(ctx)) {}
+        cctx_guard(const cctx_guard&) = delete;
+        cctx_guard& operator=(const cctx_guard&) = delete;
+        cctx_guard(cctx_guard&&) noexcept = default;
+        cctx_guard& operator=(cctx_guard&&) noexcept = default;
+        ~cctx_guard() noexcept;
+
+        ZSTD_CCtx* get() { return _ctx.get(); }
+
+    private:
+        zstd_compress_ctx _ctx;
+    };
+
+    class dctx_guard {
+    public:
+        explicit dctx_guard(zstd_decompress_ctx ctx)
+          : _ctx(std::move(ctx)) {}
+        dctx_guard(const dctx_guard&) = delete;
+        dctx_guard& operator=(const dctx_guard&) = delete;
+        dctx_guard(dctx_guard&&) noexcept = default;
+        dctx_guard& operator=(dctx_guard&&) noexcept = default;
+        ~dctx_guard() noexcept;
+
+        ZSTD_DCtx* get() { return _ctx.get(); }
+
+    private:
+        zstd_decompress_ctx _ctx;
+    };
+
+    class scratch_guard {
+    public:
+        scratch_guard(ss::temporary_buffer<char> buf, size_t size)
+          : _buf(std::move(buf))
+          , _size(size) {}
+        scratch_guard(const scratch_guard&) = delete;
+        scratch_guard& operator=(const scratch_guard&) = delete;
+        scratch_guard(scratch_guard&&) noexcept = default;
+        scratch_guard& operator=(scratch_guard&&) noexcept = default;
+        ~scratch_guard() noexcept;
+
+        char* data() { return _buf.get_write(); }
+        /// Requested size, may be smaller than the underlying buffer
+        size_t size() const { return _size; }
+
+    private:
+        ss::temporary_buffer<char> _buf;
+        size_t _size;
+    };
+
+    ctx_pool() noexcept;
+
+    ctx_pool(ctx_pool&&) = delete;
+    ctx_pool& operator=(ctx_pool&&) = delete;
+    ctx_pool(const ctx_pool&) = delete;
+    ctx_pool& operator=(const ctx_pool&) = delete;
+    ~ctx_pool() noexcept = default;
+
+    cctx_guard checkout_cctx();
+    dctx_guard checkout_dctx();
+    scratch_guard checkout_scratch(size_t size);
+
+private:
+    friend class cctx_guard;
+    friend class dctx_guard;
+    friend class scratch_guard;
+
+    void add(zstd_compress_ctx);
+    void add(zstd_decompress_ctx);
+    void add(ss::temporary_buffer<char>);
+
+    size_t _cached_bytes{0};
+    const size_t _max_cached_bytes;
+    std::vector<zstd_compress_ctx> _cctx;
+    std::vector<zstd_decompress_ctx> _dctx;
+    std::vector<ss::temporary_buffer<char>> _scratch;
+};
+
+inline ctx_pool& local_ctx_pool() {
+    static thread_local ctx_pool pool;
+    return pool;
+}
+
+} // namespace compression::internal
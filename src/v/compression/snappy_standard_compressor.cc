@@ -10,6 +10,7 @@
 #include "compression/snappy_standard_compressor.h"
 
 #include "bytes/bytes.h"
+#include "compression/internal/ctx_pool.h"
 #include "likely.h"
 
 #include <fmt/format.h>
@@ -18,6 +19,15 @@
 
 namespace compression {
 
+// linearize a fragmented buffer into pooled scratch memory instead of
+// allocating a fresh copy on every call
+static internal::ctx_pool::scratch_guard linearize(const iobuf& b) {
+    auto scratch = internal::local_ctx_pool().checkout_scratch(b.size_bytes());
+    auto consumer = iobuf::iterator_consumer(b.cbegin(), b.cend());
+    consumer.consume_to(b.size_bytes(), scratch.data());
+    return scratch;
+}
+
 inline iobuf do_compress(const char* src, size_t src_size) {
     size_t max = snappy::MaxCompressedLength(src_size);
     iobuf ret;
@@ -33,11 +43,8 @@ iobuf snappy_standard_compressor::compress(const iobuf& b) {
         return do_compress(b.begin()->get(), b.size_bytes());
     }
     // TODO: use snappy::Source interface instead
-    auto linearized = iobuf_to_bytes(b);
-    return do_compress(
-      // NOLINTNEXTLINE
-      reinterpret_cast<const char*>(linearized.data()),
-      linearized.size());
+    auto scratch = linearize(b);
+    return do_compress(scratch.data(), scratch.size());
 }
 
 iobuf do_uncompressed(const char* src, size_t src_size) {
@@ -70,10 +77,7 @@ iobuf snappy_standard_compressor::uncompress(const iobuf& b) {
     }
     // linearize buffer
     // TODO: use snappy::Sink interface instead
-    auto linearized = iobuf_to_bytes(b);
-    return do_uncompressed(
-      // NOLINTNEXTLINE
-      reinterpret_cast<const char*>(linearized.data()),
-      linearized.size());
+    auto scratch = linearize(b);
+    return do_uncompressed(scratch.data(), scratch.size());
 }
 } // namespace compression
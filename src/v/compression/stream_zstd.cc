@@ -11,6 +11,7 @@
 
 #include "bytes/bytes.h"
 #include "bytes/details/io_allocation_size.h"
+#include "compression/internal/ctx_pool.h"
 #include "compression/logger.h"
 #include "likely.h"
 #include "units.h"
@@ -19,6 +20,7 @@
 #include <fmt/format.h>
 
 #include <array>
+#include <zdict.h>
 #include <zstd.h>
 #include <zstd_errors.h>
 
@@ -33,36 +35,64 @@ static void throw_if_error(size_t rc) {
     }
 }
 
-void stream_zstd::reset_compressor() {
-    _compress.reset(ZSTD_createCCtx());
-    if (!_compress) {
-        throw std::bad_alloc{};
-    }
-}
-stream_zstd::zstd_compress_ctx& stream_zstd::compressor() {
-    if (!_compress) {
-        reset_compressor();
+zstd_dictionary::zstd_dictionary(const iobuf& raw_dict) {
+    // the dictionary APIs need linearized memory
+    auto linearized = iobuf_to_bytes(raw_dict);
+    _cdict.reset(ZSTD_createCDict(
+      linearized.data(), linearized.size(), ZSTD_CLEVEL_DEFAULT));
+    _ddict.reset(ZSTD_createDDict(linearized.data(), linearized.size()));
+    if (!_cdict || !_ddict) {
+        throw std::runtime_error(fmt::format(
+          "Cannot load zstd dictionary from {} bytes", linearized.size()));
     }
-    return _compress;
 }
 
-void stream_zstd::reset_decompressor() {
-    _decompress.reset(ZSTD_createDCtx());
-    if (!_decompress) {
-        throw std::bad_alloc{};
+zstd_dictionary zstd_dictionary::train(
+  const std::vector<iobuf>& samples, size_t max_dict_size) {
+    iobuf flat;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        for (const auto& frag : sample) {
+            flat.append(frag.get(), frag.size());
+        }
+        sample_sizes.push_back(sample.size_bytes());
     }
+    auto linearized = iobuf_to_bytes(flat);
+    bytes dict(bytes::initialized_later{}, max_dict_size);
+    auto rc = ZDICT_trainFromBuffer(
+      dict.data(),
+      dict.size(),
+      linearized.data(),
+      sample_sizes.data(),
+      sample_sizes.size());
+    if (unlikely(ZDICT_isError(rc))) {
+        throw std::runtime_error(
+          fmt::format("ZDICT error:{}", ZDICT_getErrorName(rc)));
+    }
+    iobuf raw;
+    raw.append(reinterpret_cast<const char*>(dict.data()), rc);
+    return zstd_dictionary(raw);
 }
 
-stream_zstd::zstd_decompress_ctx& stream_zstd::decompressor() {
-    if (!_decompress) {
-        reset_decompressor();
-    }
-    return _decompress;
+uint32_t zstd_dictionary::id() const {
+    return ZSTD_getDictID_fromDDict(_ddict.get());
 }
 
 iobuf stream_zstd::do_compress(const iobuf& x) {
-    reset_compressor();
-    ZSTD_CCtx* ctx = compressor().get();
+    auto guard = internal::local_ctx_pool().checkout_cctx();
+    ZSTD_CCtx* ctx = guard.get();
+    if (_dict) {
+        throw_if_error(ZSTD_CCtx_refCDict(ctx, _dict->cdict()));
+    }
+    if (_long_range) {
+        throw_if_error(
+          ZSTD_CCtx_setParameter(ctx, ZSTD_c_enableLongDistanceMatching, 1));
+        if (_window_log > 0) {
+            throw_if_error(
+              ZSTD_CCtx_setParameter(ctx, ZSTD_c_windowLog, _window_log));
+        }
+    }
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
     // zstd requires linearized memory
@@ -133,8 +163,17 @@ iobuf stream_zstd::do_uncompress(const iobuf& x) {
         throw std::runtime_error(
           "Asked to stream_zstd::uncompress empty buffer");
     }
-    reset_decompressor();
-    ZSTD_DCtx* dctx = decompressor().get();
+    auto guard = internal::local_ctx_pool().checkout_dctx();
+    ZSTD_DCtx* dctx = guard.get();
+    if (_dict) {
+        throw_if_error(ZSTD_DCtx_refDDict(dctx, _dict->ddict()));
+    }
+    if (_long_range) {
+        // frames produced with a widened match window are rejected by the
+        // decoder's default window cap
+        throw_if_error(
+          ZSTD_DCtx_setParameter(dctx, ZSTD_d_windowLogMax, ZSTD_WINDOWLOG_MAX));
+    }
     iobuf ret;
     ss::temporary_buffer<char> obuf(decompression_step(x));
     ZSTD_outBuffer out = {
@@ -157,4 +196,65 @@ iobuf stream_zstd::do_uncompress(const iobuf& x) {
     return ret;
 }
 
+// compressed output lands in fragments of this size, so a frame never needs
+// one large contiguous allocation no matter how big the input is
+static constexpr size_t frame_compressor_output_step = 128_KiB;
+
+zstd_frame_compressor::zstd_frame_compressor(bool long_range, int window_log)
+  : _ctx(ZSTD_createCCtx()) {
+    if (unlikely(!_ctx)) {
+        throw std::runtime_error("Cannot allocate ZSTD_CCtx");
+    }
+    if (long_range) {
+        throw_if_error(ZSTD_CCtx_setParameter(
+          _ctx.get(), ZSTD_c_enableLongDistanceMatching, 1));
+        if (window_log > 0) {
+            throw_if_error(ZSTD_CCtx_setParameter(
+              _ctx.get(), ZSTD_c_windowLog, window_log));
+        }
+    }
+}
+
+ZSTD_outBuffer zstd_frame_compressor::output_window() {
+    if (_out_buf.size() == _out_pos) {
+        if (_out_buf.size() != 0) {
+            // full fragment, hand it over without copying
+            _out.append_take_ownership(new iobuf::fragment(
+              std::move(_out_buf), iobuf::fragment::full{}));
+        }
+        _out_buf = ss::temporary_buffer<char>(frame_compressor_output_step);
+        _out_pos = 0;
+    }
+    return ZSTD_outBuffer{
+      .dst = _out_buf.get_write(), .size = _out_buf.size(), .pos = _out_pos};
+}
+
+void zstd_frame_compressor::append(const char* src, size_t size) {
+    ZSTD_inBuffer in = {.src = src, .size = size, .pos = 0};
+    while (in.pos != in.size) {
+        auto out = output_window();
+        throw_if_error(
+          ZSTD_compressStream2(_ctx.get(), &out, &in, ZSTD_e_continue));
+        _out_pos = out.pos;
+    }
+}
+
+iobuf zstd_frame_compressor::take() {
+    size_t remaining = 0;
+    do {
+        auto out = output_window();
+        ZSTD_inBuffer in = {.src = nullptr, .size = 0, .pos = 0};
+        remaining = ZSTD_compressStream2(_ctx.get(), &out, &in, ZSTD_e_end);
+        throw_if_error(remaining);
+        _out_pos = out.pos;
+    } while (remaining != 0);
+    if (_out_pos != 0) {
+        _out_buf.trim(_out_pos);
+        _out.append(std::move(_out_buf));
+    }
+    _out_buf = ss::temporary_buffer<char>();
+    _out_pos = 0;
+    return std::move(_out);
+}
+
 } // namespace compression
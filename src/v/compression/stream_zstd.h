@@ -13,37 +13,115 @@
 #include "bytes/iobuf.h"
 #include "static_deleter_fn.h"
 
+#include <seastar/core/shared_ptr.hh>
+
 #include <memory>
+#include <vector>
 #include <zstd.h>
 
 namespace compression {
-class stream_zstd {
+
+/// Shared zstd dictionary. Small payloads compress poorly on their own
+/// because zstd has no context to work with; a dictionary trained on
+/// samples of the data restores most of the ratio. The same dictionary
+/// instance can be referenced by many compression and decompression
+/// contexts without copying.
+class zstd_dictionary {
 public:
-    using zstd_compress_ctx = std::unique_ptr<
-      ZSTD_CCtx,
+    using zstd_cdict = std::unique_ptr<
+      ZSTD_CDict,
       // wrap ZSTD C API
-      static_sized_deleter_fn<ZSTD_CCtx, &ZSTD_freeCCtx>>;
-    using zstd_decompress_ctx = std::unique_ptr<
-      ZSTD_DCtx,
+      static_sized_deleter_fn<ZSTD_CDict, &ZSTD_freeCDict>>;
+    using zstd_ddict = std::unique_ptr<
+      ZSTD_DDict,
       // wrap ZSTD C API
-      static_sized_deleter_fn<ZSTD_DCtx, &ZSTD_freeDCtx>>;
+      static_sized_deleter_fn<ZSTD_DDict, &ZSTD_freeDDict>>;
+
+    /// Load a pre-trained dictionary from its serialized form
+    explicit zstd_dictionary(const iobuf& raw_dict);
+
+    /// Train a dictionary from content samples. \p max_dict_size caps the
+    /// size of the produced dictionary; zstd recommends ~100x smaller than
+    /// the total sample size
+    static zstd_dictionary
+    train(const std::vector<iobuf>& samples, size_t max_dict_size);
 
+    /// Identifier embedded in every frame compressed with this dictionary
+    uint32_t id() const;
+    const ZSTD_CDict* cdict() const { return _cdict.get(); }
+    const ZSTD_DDict* ddict() const { return _ddict.get(); }
+
+private:
+    zstd_cdict _cdict{nullptr};
+    zstd_ddict _ddict{nullptr};
+};
+
+class stream_zstd {
+public:
     iobuf compress(const iobuf& b) { return do_compress(b); }
     iobuf uncompress(const iobuf& b) { return do_uncompress(b); }
     iobuf compress(iobuf&& b) { return do_compress(b); }
     iobuf uncompress(iobuf&& b) { return do_uncompress(b); }
 
+    /// Use \p dict for all subsequent compress/uncompress calls.
+    /// Pass nullptr to go back to dictionary-less operation
+    void set_dictionary(ss::lw_shared_ptr<const zstd_dictionary> dict) {
+        _dict = std::move(dict);
+    }
+
+    /// Enable long distance matching with an optional explicit match window
+    /// (log2 of its size, 0 keeps the zstd default). Large payloads with
+    /// far-apart repetition - whole log segments, not single batches -
+    /// compress considerably better with a wide window. On the uncompress
+    /// side this lifts the decoder's window cap so such frames are accepted
+    void set_long_range(bool enabled, int window_log = 0) {
+        _long_range = enabled;
+        _window_log = window_log;
+    }
+
 private:
     iobuf do_compress(const iobuf&);
     iobuf do_uncompress(const iobuf&);
 
-    void reset_compressor();
-    void reset_decompressor();
-    zstd_compress_ctx& compressor();
-    zstd_decompress_ctx& decompressor();
+    ss::lw_shared_ptr<const zstd_dictionary> _dict{nullptr};
+    bool _long_range{false};
+    int _window_log{0};
+};
+
+/// Incremental zstd frame compressor for payloads that arrive chunk by
+/// chunk, e.g. a segment streamed off disk during an archival upload.
+/// Unlike 'stream_zstd' it never needs the whole input at once: append()
+/// extends the current frame and the compressed output accumulates in
+/// bounded fragments until take() finishes the frame. Owns a private
+/// compression context instead of borrowing a pooled one because the
+/// instance typically lives across scheduling points
+class zstd_frame_compressor {
+public:
+    /// \param long_range enables long distance matching
+    /// \param window_log log2 of the match window, 0 keeps the default
+    explicit zstd_frame_compressor(bool long_range = false, int window_log = 0);
+
+    /// Add \p size bytes at \p src to the frame
+    void append(const char* src, size_t size);
+
+    /// Finish the frame and return the compressed payload. The compressor
+    /// must not be reused afterwards
+    iobuf take();
+
+private:
+    using zstd_cctx = std::unique_ptr<
+      ZSTD_CCtx,
+      // wrap ZSTD C API
+      static_sized_deleter_fn<ZSTD_CCtx, &ZSTD_freeCCtx>>;
+
+    /// Window over the current output fragment, rolling over to a fresh
+    /// fragment once the previous one fills up
+    ZSTD_outBuffer output_window();
 
-    zstd_compress_ctx _compress{nullptr};
-    zstd_decompress_ctx _decompress{nullptr};
+    zstd_cctx _ctx{nullptr};
+    iobuf _out;
+    ss::temporary_buffer<char> _out_buf;
+    size_t _out_pos{0};
 };
 
 } // namespace compression
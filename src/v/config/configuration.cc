@@ -79,12 +79,25 @@ configuration::configuration()
       "Maximum amount of bytes to read from one topic read",
       required::no,
       32_KiB)
+  , coproc_max_script_inflight_bytes(
+      *this,
+      "coproc_max_script_inflight_bytes",
+      "Maximum amount of bytes a single script may have in flight to the "
+      "wasm engine",
+      required::no,
+      512_KiB)
   , coproc_offset_flush_interval_ms(
       *this,
       "coproc_offset_flush_interval_ms",
       "Interval for which all coprocessor offsets are flushed to disk",
       required::no,
       300000ms) // five minutes
+  , coproc_offset_flush_bytes(
+      *this,
+      "coproc_offset_flush_bytes",
+      "Bytes of input to process before flushing coprocessor offsets early",
+      required::no,
+      32_MiB)
   , node_id(
       *this,
       "node_id",
@@ -154,6 +167,15 @@ configuration::configuration()
       "Admin API doc directory",
       required::no,
       "/usr/share/redpanda/admin-api-doc")
+  , metrics_snapshot_interval_ms(
+      *this,
+      "metrics_snapshot_interval_ms",
+      "How often the prebuilt /metrics response served to prometheus "
+      "scrapes is refreshed in the background. Scrapes observe values up "
+      "to this much older. 0 serializes metrics synchronously on every "
+      "scrape",
+      required::no,
+      5s)
   , default_num_windows(
       *this,
       "default_num_windows",
@@ -191,6 +213,50 @@ configuration::configuration()
       "Disable registering metrics",
       required::no,
       false)
+  , enable_per_shard_rpc_clients(
+      *this,
+      "enable_per_shard_rpc_clients",
+      "Open a dedicated RPC connection to every peer from each shard instead "
+      "of sharing hashed connections between shards. Removes the cross-shard "
+      "hop from the replication path at the cost of more sockets per node "
+      "pair",
+      required::no,
+      false)
+  , rpc_client_connection_maintenance_interval_ms(
+      *this,
+      "rpc_client_connection_maintenance_interval_ms",
+      "How often the internal RPC clients check their connections to peers "
+      "and re-establish dropped ones in the background, so the first request "
+      "after a network blip does not pay connect and TLS latency. Redials "
+      "are jittered around this interval. 0 disables background connection "
+      "maintenance",
+      required::no,
+      5s)
+  , rpc_client_warm_standby_connections(
+      *this,
+      "rpc_client_warm_standby_connections",
+      "Keep a warm standby connection next to the primary connection of "
+      "every internal RPC client and promote it instantly when the primary "
+      "dies, at the cost of twice the sockets per node pair",
+      required::no,
+      false)
+  , per_partition_metrics_topics(
+      *this,
+      "per_partition_metrics_topics",
+      "Topics for which per-partition metric series are exported. Other "
+      "topics only export shard-level aggregates, keeping scrape "
+      "cardinality bounded on nodes with many partitions",
+      required::no,
+      {})
+  , iobuf_allocation_table(
+      *this,
+      "iobuf_allocation_table",
+      "Buffer sizes, in bytes and strictly ascending, used as the iobuf "
+      "growth progression instead of the built-in 1.5x table. Fit it to a "
+      "measured fragment size distribution (see the iobuf metrics) to cut "
+      "internal fragmentation. Empty keeps the built-in progression",
+      required::no,
+      {})
   , group_min_session_timeout_ms(
       *this,
       "group_min_session_timeout_ms",
@@ -221,6 +287,20 @@ configuration::configuration()
       "Timeout for new member joins",
       required::no,
       30'000ms)
+  , group_offset_commit_flush_delay_ms(
+      *this,
+      "group_offset_commit_flush_delay_ms",
+      "Time to accumulate consumer offset commits before replicating them to "
+      "the group coordinator partition as a single batch",
+      required::no,
+      2ms)
+  , group_offset_commit_max_buffered_bytes(
+      *this,
+      "group_offset_commit_max_buffered_bytes",
+      "Maximum bytes of consumer offset commits buffered per group before an "
+      "immediate flush to the group coordinator partition",
+      required::no,
+      128_KiB)
   , metadata_dissemination_interval_ms(
       *this,
       "metadata_dissemination_interval_ms",
@@ -234,6 +314,14 @@ configuration::configuration()
       "wasn't reached",
       required::no,
       1ms)
+  , enable_follower_fetching(
+      *this,
+      "enable_follower_fetching",
+      "Allow fetch requests to be served by any replica of a partition "
+      "instead of only the leader. Follower reads are bounded by the "
+      "replica's raft committed offset",
+      required::no,
+      false)
   , transactional_id_expiration_ms(
       *this,
       "transactional_id_expiration_ms",
@@ -332,6 +420,13 @@ configuration::configuration()
       "Max size of requests cached for replication",
       required::no,
       1_MiB)
+  , raft_replicate_batcher_max_linger_ms(
+      *this,
+      "raft_replicate_batcher_max_linger_ms",
+      "Upper bound on how long the replicate batcher may hold a flush "
+      "waiting for more data on a busy partition. 0 flushes immediately",
+      required::no,
+      2ms)
   , reclaim_min_size(
       *this,
       "reclaim_min_size",
@@ -380,6 +475,14 @@ configuration::configuration()
       "Key-value maximum segment size (bytes)",
       required::no,
       16_MiB)
+  , kvstore_snapshot_interval_segments(
+      *this,
+      "kvstore_snapshot_interval_segments",
+      "Number of rolled key-value store segments accumulated before the "
+      "database is snapshotted and the segments removed. Higher values trade "
+      "recovery replay time for less snapshot write amplification",
+      required::no,
+      (size_t)4)
   , max_kafka_throttle_delay_ms(
       *this,
       "max_kafka_throttle_delay_ms",
@@ -406,18 +509,110 @@ configuration::configuration()
       "Timeout waiting for follower recovery when transferring leadership",
       required::no,
       10s)
+  , enable_leader_balancer(
+      *this,
+      "enable_leader_balancer",
+      "Enable automatic leadership rebalancing across nodes",
+      required::no,
+      true)
+  , leader_balancer_tick_interval_ms(
+      *this,
+      "leader_balancer_tick_interval_ms",
+      "Interval between leadership balancing rounds",
+      required::no,
+      30s)
+  , leader_balancer_transfers_per_tick(
+      *this,
+      "leader_balancer_transfers_per_tick",
+      "Upper bound on leadership transfers issued per shard in one balancing "
+      "round",
+      required::no,
+      5)
   , release_cache_on_segment_roll(
       *this,
       "release_cache_on_segment_roll",
       "Free cache when segments roll",
       required::no,
       false)
+  , segment_reader_handle_cache_size(
+      *this,
+      "segment_reader_handle_cache_size",
+      "Maximum number of open segment data file handles kept per shard. "
+      "Segments beyond the bound are closed when idle and reopened "
+      "transparently on the next read",
+      required::no,
+      4096)
   , segment_appender_flush_timeout_ms(
       *this,
       "segment_appender_flush_timeout_ms",
       "Maximum delay until buffered data is written",
       required::no,
       std::chrono::milliseconds(1s))
+  , segment_appender_chained_flushes(
+      *this,
+      "segment_appender_chained_flushes",
+      "Link segment flushes to outstanding writes instead of quiescing the "
+      "appender, reducing produce tail latency for acks=all",
+      required::no,
+      false)
+  , segment_fallocation_pool_size(
+      *this,
+      "segment_fallocation_pool_size",
+      "Number of pre-created, pre-fallocated blank segment files kept per "
+      "shard to hide segment roll latency. 0 disables the pool",
+      required::no,
+      (size_t)0)
+  , segment_fallocation_step(
+      *this,
+      "segment_fallocation_step",
+      "Size in bytes by which segment files are fallocated ahead of the "
+      "write offset. 0 derives the step from the startup io probe",
+      required::no,
+      (size_t)0)
+  , raft_flush_coalescing_window_us(
+      *this,
+      "raft_flush_coalescing_window_us",
+      "Length in microseconds of the shared window that aligns log flushes "
+      "of all raft groups on a shard (group commit across groups). 0 "
+      "disables coalescing",
+      required::no,
+      (int64_t)0)
+  , raft_recovery_read_size(
+      *this,
+      "raft_recovery_read_size",
+      "Byte budget of a single follower recovery read. Larger values speed "
+      "up recovery of large partitions at the cost of memory while many "
+      "groups recover concurrently",
+      required::no,
+      32_KiB)
+  , raft_learner_recovery_rate(
+      *this,
+      "raft_learner_recovery_rate",
+      "Node wide byte per second budget for follower and learner recovery "
+      "reads, split evenly across shards. Keeps background catch up (e.g. "
+      "during partition movement) from starving foreground traffic",
+      required::no,
+      100_MiB)
+  , raft_recovery_snapshot_chunk_size(
+      *this,
+      "raft_recovery_snapshot_chunk_size",
+      "Size of a single snapshot chunk shipped to a recovering follower",
+      required::no,
+      32_KiB)
+  , raft_recovery_snapshot_rate_bytes(
+      *this,
+      "raft_recovery_snapshot_rate_bytes",
+      "Shard wide limit on snapshot bytes shipped to recovering followers "
+      "per second. 0 disables throttling",
+      required::no,
+      64_MiB)
+  , storage_recovery_concurrency(
+      *this,
+      "storage_recovery_concurrency",
+      "Shard wide bound on segment files opened and verified in parallel "
+      "while logs are brought under management at startup",
+      required::no,
+      (size_t)16)
   , fetch_session_eviction_timeout_ms(
       *this,
       "fetch_session_eviction_timeout_ms",
@@ -427,12 +622,36 @@ configuration::configuration()
       "cache",
       required::no,
       60s)
+  , kafka_fetch_api_shares(
+      *this,
+      "kafka_fetch_api_shares",
+      "CPU scheduler shares of the scheduling group fetch requests execute "
+      "in, relative to the produce path's 1000 shares",
+      required::no,
+      1000U)
+  , kafka_admin_api_shares(
+      *this,
+      "kafka_admin_api_shares",
+      "CPU scheduler shares of the scheduling group kafka admin and "
+      "metadata requests execute in, relative to the produce path's 1000 "
+      "shares",
+      required::no,
+      100U)
   , max_compacted_log_segment_size(
       *this,
       "max_compacted_log_segment_size",
       "Max compacted segment size after consolidation",
       required::no,
       5_GiB)
+  , segment_scrub_bytes_per_interval(
+      *this,
+      "segment_scrub_bytes_per_interval",
+      "Number of bytes of sealed log segments the background checksum "
+      "scrubber may read per log_compaction_interval_ms. Batches of scrubbed "
+      "segments are served without checksum re-verification on the read "
+      "path. Set to 0 to disable background scrubbing",
+      required::no,
+      512_MiB)
   , id_allocator_log_capacity(
       *this,
       "id_allocator_log_capacity",
@@ -514,6 +733,55 @@ configuration::configuration()
       "Max number of simultaneous uploads to S3",
       required::no,
       20)
+  , archival_storage_upload_part_size(
+      *this,
+      "archival_storage_upload_part_size",
+      "Size of a single part of the multipart segment upload to S3",
+      required::no,
+      32_MiB)
+  , archival_storage_max_part_uploads_per_segment(
+      *this,
+      "archival_storage_max_part_uploads_per_segment",
+      "Max number of parts of a single segment that are uploaded to S3 in "
+      "parallel",
+      required::no,
+      4)
+  , archival_storage_max_segment_uploads(
+      *this,
+      "archival_storage_max_segment_uploads",
+      "Max number of segments that are uploaded to S3 in parallel per "
+      "partition",
+      required::no,
+      4)
+  , archival_storage_read_cache_size(
+      *this,
+      "archival_storage_read_cache_size",
+      "Size of the cache that stores segments downloaded from S3 to serve "
+      "historical fetch requests",
+      required::no,
+      128_MiB)
+  , archival_storage_min_upload_size(
+      *this,
+      "archival_storage_min_upload_size",
+      "Desired lower bound on the size of an object uploaded to S3. "
+      "Consecutive segments smaller than this are coalesced into one "
+      "object. 0 disables coalescing",
+      required::no,
+      0)
+  , archival_storage_compress_uploads(
+      *this,
+      "archival_storage_compress_uploads",
+      "Compress segments with long-range zstd before uploading them to S3. "
+      "Only segments that fit into a single upload part are compressed",
+      required::no,
+      false)
+  , archival_storage_compression_window_log(
+      *this,
+      "archival_storage_compression_window_log",
+      "Log2 of the zstd match window used when compressing segments for "
+      "upload",
+      required::no,
+      27)
   , _advertised_kafka_api(
       *this,
       "advertised_kafka_api",
@@ -45,7 +45,9 @@ struct configuration final : public config_store {
     property<std::size_t> coproc_max_inflight_bytes;
     property<std::size_t> coproc_max_ingest_bytes;
     property<std::size_t> coproc_max_batch_size;
+    property<std::size_t> coproc_max_script_inflight_bytes;
     property<std::chrono::milliseconds> coproc_offset_flush_interval_ms;
+    property<std::size_t> coproc_offset_flush_bytes;
 
     // Raft
     property<int32_t> node_id;
@@ -62,6 +64,7 @@ struct configuration final : public config_store {
     property<tls_config> admin_api_tls;
     property<bool> enable_admin_api;
     property<ss::sstring> admin_api_doc_dir;
+    property<std::chrono::milliseconds> metrics_snapshot_interval_ms;
     property<int16_t> default_num_windows;
     property<std::chrono::milliseconds> default_window_sec;
     property<std::chrono::milliseconds> quota_manager_gc_sec;
@@ -69,12 +72,21 @@ struct configuration final : public config_store {
     property<std::optional<ss::sstring>> rack;
     property<std::optional<ss::sstring>> dashboard_dir;
     property<bool> disable_metrics;
+    property<bool> enable_per_shard_rpc_clients;
+    property<std::chrono::milliseconds>
+      rpc_client_connection_maintenance_interval_ms;
+    property<bool> rpc_client_warm_standby_connections;
+    property<std::vector<ss::sstring>> per_partition_metrics_topics;
+    property<std::vector<uint32_t>> iobuf_allocation_table;
     property<std::chrono::milliseconds> group_min_session_timeout_ms;
     property<std::chrono::milliseconds> group_max_session_timeout_ms;
     property<std::chrono::milliseconds> group_initial_rebalance_delay;
     property<std::chrono::milliseconds> group_new_member_join_timeout;
+    property<std::chrono::milliseconds> group_offset_commit_flush_delay_ms;
+    property<size_t> group_offset_commit_max_buffered_bytes;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> fetch_reads_debounce_timeout;
+    property<bool> enable_follower_fetching;
     // same as transactional.id.expiration.ms in kafka
     property<std::chrono::milliseconds> transactional_id_expiration_ms;
     property<bool> enable_idempotence;
@@ -94,6 +106,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> replicate_append_timeout_ms;
     property<std::chrono::milliseconds> recovery_append_timeout_ms;
     property<size_t> raft_replicate_batch_window_size;
+    property<std::chrono::milliseconds> raft_replicate_batcher_max_linger_ms;
 
     property<size_t> reclaim_min_size;
     property<size_t> reclaim_max_size;
@@ -103,16 +116,33 @@ struct configuration final : public config_store {
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
     property<size_t> kvstore_max_segment_size;
+    property<size_t> kvstore_snapshot_interval_segments;
     property<std::chrono::milliseconds> max_kafka_throttle_delay_ms;
     property<std::chrono::milliseconds> raft_io_timeout_ms;
     property<std::chrono::milliseconds> join_retry_timeout_ms;
     property<std::chrono::milliseconds> raft_timeout_now_timeout_ms;
     property<std::chrono::milliseconds>
       raft_transfer_leader_recovery_timeout_ms;
+    property<bool> enable_leader_balancer;
+    property<std::chrono::milliseconds> leader_balancer_tick_interval_ms;
+    property<size_t> leader_balancer_transfers_per_tick;
     property<bool> release_cache_on_segment_roll;
+    property<size_t> segment_reader_handle_cache_size;
     property<std::chrono::milliseconds> segment_appender_flush_timeout_ms;
+    property<bool> segment_appender_chained_flushes;
+    property<size_t> segment_fallocation_pool_size;
+    property<size_t> segment_fallocation_step;
+    property<int64_t> raft_flush_coalescing_window_us;
+    property<size_t> raft_recovery_read_size;
+    property<size_t> raft_learner_recovery_rate;
+    property<size_t> raft_recovery_snapshot_chunk_size;
+    property<size_t> raft_recovery_snapshot_rate_bytes;
+    property<size_t> storage_recovery_concurrency;
     property<std::chrono::milliseconds> fetch_session_eviction_timeout_ms;
+    property<unsigned> kafka_fetch_api_shares;
+    property<unsigned> kafka_admin_api_shares;
     property<size_t> max_compacted_log_segment_size;
+    property<size_t> segment_scrub_bytes_per_interval;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
     property<bool> enable_sasl;
@@ -128,6 +158,13 @@ struct configuration final : public config_store {
     property<std::optional<ss::sstring>> archival_storage_api_endpoint;
     property<std::chrono::milliseconds> archival_storage_reconciliation_ms;
     property<int16_t> archival_storage_max_connections;
+    property<size_t> archival_storage_upload_part_size;
+    property<int16_t> archival_storage_max_part_uploads_per_segment;
+    property<int16_t> archival_storage_max_segment_uploads;
+    property<size_t> archival_storage_read_cache_size;
+    property<size_t> archival_storage_min_upload_size;
+    property<bool> archival_storage_compress_uploads;
+    property<int> archival_storage_compression_window_log;
 
     configuration();
 
@@ -16,11 +16,82 @@
 
 #include <seastar/util/noncopyable_function.hh>
 
+#include <boost/intrusive/list.hpp>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <optional>
+#include <type_traits>
+#include <utility>
+
 namespace config {
 
+template<class T>
+class property;
+
+namespace detail {
+
+template<typename T, typename = void>
+struct is_equality_comparable : std::false_type {};
+
+template<typename T>
+struct is_equality_comparable<
+  T,
+  std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+  : std::true_type {};
+
+} // namespace detail
+
+/// A copy of a property's value that is kept up to date as the property
+/// changes. Steady-state reads are a plain member load with none of the
+/// config_store map or virtual accessor indirection, and a watch callback
+/// lets the owner react to runtime updates without polling.
+///
+/// Bindings are created via property<T>::bind() and are movable but not
+/// copyable; they deregister themselves on destruction.
+template<typename T>
+class binding
+  : public boost::intrusive::list_base_hook<
+      boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
+public:
+    binding(binding&& rhs) noexcept;
+    binding& operator=(binding&& rhs) noexcept;
+    binding(const binding&) = delete;
+    binding& operator=(const binding&) = delete;
+    ~binding() = default;
+
+    const T& value() const { return _value; }
+    const T& operator()() const { return value(); }
+
+    /// Register a callback invoked whenever the bound property's value
+    /// changes. Only one callback is kept; the last one wins.
+    void watch(ss::noncopyable_function<void()> f) {
+        _on_change = std::move(f);
+    }
+
+private:
+    friend class property<T>;
+
+    explicit binding(property<T>& parent);
+
+    void update(const T& v) {
+        // types without equality (e.g. tls_config) conservatively notify on
+        // every write
+        bool changed = true;
+        if constexpr (detail::is_equality_comparable<T>::value) {
+            changed = !(_value == v);
+        }
+        _value = v;
+        if (changed && _on_change) {
+            (*_on_change)();
+        }
+    }
+
+    property<T>* _parent;
+    T _value;
+    std::optional<ss::noncopyable_function<void()>> _on_change;
+};
+
 template<class T>
 class property : public base_property {
 public:
@@ -48,6 +119,11 @@ public:
 
     operator T() const { return value(); } // NOLINT
 
+    /// Take a cached handle to this property's value. The binding tracks
+    /// updates to the property, so the caller reads a plain member instead
+    /// of going back through the config_store on every use.
+    binding<T> bind() { return binding<T>(*this); }
+
     void print(std::ostream& o) const override { o << name() << ":" << _value; }
 
     // serialize the value. the key is taken from the property name at the
@@ -65,31 +141,85 @@ public:
     }
 
     void set_value(std::any v) override {
-        _value = std::any_cast<T>(std::move(v));
+        update_value(std::any_cast<T>(std::move(v)));
     }
 
-    void set_value(YAML::Node n) override { _value = std::move(n.as<T>()); }
+    void set_value(YAML::Node n) override { update_value(std::move(n.as<T>())); }
 
     property<T>& operator()(T v) {
-        _value = std::move(v);
+        update_value(std::move(v));
         return *this;
     }
 
     base_property& operator=(const base_property& pr) override {
-        _value = dynamic_cast<const property<T>&>(pr)._value;
+        update_value(T(dynamic_cast<const property<T>&>(pr)._value));
         return *this;
     }
 
+    ~property() override {
+        for (auto& b : _bindings) {
+            b._parent = nullptr;
+        }
+        _bindings.clear();
+    }
+
 protected:
+    void update_value(T&& new_value) {
+        _value = std::move(new_value);
+        for (auto& b : _bindings) {
+            b.update(_value);
+        }
+    }
+
     T _value;
 
 private:
+    friend class binding<T>;
+
+    using binding_list = boost::intrusive::
+      list<binding<T>, boost::intrusive::constant_time_size<false>>;
+
+    binding_list _bindings;
+
     validator _validator;
     constexpr static auto noop_validator = [](const auto&) {
         return std::nullopt;
     };
 };
 
+template<typename T>
+binding<T>::binding(property<T>& parent)
+  : _parent(&parent)
+  , _value(parent.value()) {
+    _parent->_bindings.push_back(*this);
+}
+
+template<typename T>
+binding<T>::binding(binding&& rhs) noexcept
+  : _parent(std::exchange(rhs._parent, nullptr))
+  , _value(std::move(rhs._value))
+  , _on_change(std::move(rhs._on_change)) {
+    if (_parent) {
+        rhs.unlink();
+        _parent->_bindings.push_back(*this);
+    }
+}
+
+template<typename T>
+binding<T>& binding<T>::operator=(binding&& rhs) noexcept {
+    if (this != &rhs) {
+        this->unlink();
+        _parent = std::exchange(rhs._parent, nullptr);
+        _value = std::move(rhs._value);
+        _on_change = std::move(rhs._on_change);
+        if (_parent) {
+            rhs.unlink();
+            _parent->_bindings.push_back(*this);
+        }
+    }
+    return *this;
+}
+
 /*
  * Same as property<std::vector<T>> but will also decode a single T. This can be
  * useful for dealing with backwards compatibility or creating easier yaml
@@ -109,7 +239,7 @@ public:
         } else {
             value.push_back(std::move(n.as<T>()));
         }
-        this->_value = std::move(value);
+        this->update_value(std::move(value));
     }
 };
 
@@ -142,6 +142,31 @@ SEASTAR_THREAD_TEST_CASE(update_property_value) {
     BOOST_TEST(cfg.required_string() == "new_string_value");
 };
 
+SEASTAR_THREAD_TEST_CASE(property_binding) {
+    auto cfg = test_config();
+    cfg.read_yaml(minimal_valid_configuration());
+
+    auto bound_int = cfg.optional_int.bind();
+    BOOST_TEST(bound_int() == 100);
+
+    int notifications = 0;
+    bound_int.watch([&notifications]() { ++notifications; });
+
+    cfg.get("optional_int").set_value(42);
+    BOOST_TEST(bound_int() == 42);
+    BOOST_TEST(notifications == 1);
+
+    // setting the same value again does not notify
+    cfg.get("optional_int").set_value(42);
+    BOOST_TEST(notifications == 1);
+
+    // a moved binding keeps tracking updates
+    auto moved_int = std::move(bound_int);
+    cfg.get("optional_int").set_value(43);
+    BOOST_TEST(moved_int() == 43);
+    BOOST_TEST(notifications == 2);
+}
+
 SEASTAR_THREAD_TEST_CASE(validate_valid_configuration) {
     auto cfg = test_config();
     cfg.read_yaml(valid_configuration());
@@ -19,8 +19,10 @@
 #include "storage/log.h"
 #include "utils/mutex.h"
 
+#include <seastar/core/circular_buffer.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <absl/container/btree_map.h>
 #include <absl/container/node_hash_map.h>
@@ -54,6 +56,9 @@ struct ntp_context {
     struct offset_pair {
         model::offset last_read{};
         model::offset last_acked{};
+        /// Bumped when reads rewind to last_acked; replies in flight from
+        /// before the rewind are ignored. In-memory only, not checkpointed.
+        uint64_t generation{0};
     };
 
     using offset_tracker = absl::btree_map<script_id, offset_pair>;
@@ -61,12 +66,24 @@ struct ntp_context {
     explicit ntp_context(storage::log lg)
       : log(std::move(lg)) {}
 
+    /// The most recent window read from the log. Scripts whose next read
+    /// offset falls inside the window share these batches instead of
+    /// re-reading them; stragglers behind the window fall back to private
+    /// reads. Holds at most one read's worth of batches per input ntp.
+    struct read_window {
+        model::offset start;
+        model::offset last;
+        ss::circular_buffer<model::record_batch> batches;
+    };
+
     const model::ntp& ntp() const { return log.config().ntp(); }
 
     /// Reference to the storage layer for reading from the input ntp
     storage::log log;
     /// Interested scripts write their last read offset of the input ntp
     offset_tracker offsets;
+    /// Shared across scripts; refreshed by whichever script reads first
+    std::optional<read_window> window;
 };
 
 using ntp_context_cache
@@ -84,6 +101,14 @@ struct shared_script_resources {
     ss::semaphore read_sem{
       config::shard_local_cfg().coproc_max_ingest_bytes.value()};
 
+    /// Bytes of input processed since the last offset checkpoint. The
+    /// pacemaker skips checkpoints while this is zero and flushes early once
+    /// it crosses coproc_offset_flush_bytes.
+    std::size_t checkpoint_bytes{0};
+
+    /// Set by the pacemaker; pulls the next offset checkpoint forward
+    ss::noncopyable_function<void()> request_checkpoint{[]() {}};
+
     /// Underlying transport connection to the wasm engine
     rpc::reconnect_transport transport;
 
@@ -57,20 +57,37 @@ pacemaker::pacemaker(ss::socket_address addr, ss::sharded<storage::api>& api)
 
 ss::future<> pacemaker::start() {
     _offs.timer.set_callback([this] {
-        (void)ss::with_gate(_gate, [this] {
-            return save_offsets(_offs.snap, _ntps).then([this] {
-                if (!_offs.timer.armed()) {
-                    _offs.timer.arm(_offs.duration);
-                }
-            });
-        });
+        (void)ss::with_gate(_gate, [this] { return do_checkpoint(); });
     });
+    _shared_res.request_checkpoint = [this] {
+        /// Pull the next flush forward; do_checkpoint rearms the interval
+        if (_offs.timer.armed()) {
+            _offs.timer.rearm(ss::lowres_clock::now());
+        }
+    };
     co_await ss::recursive_touch_directory(offsets_snapshot_path().string());
     auto ncc = co_await recover_offsets(_offs.snap, _shared_res.api.log_mgr());
     _ntps = std::move(ncc);
     _offs.timer.arm(_offs.duration);
 }
 
+ss::future<> pacemaker::do_checkpoint() {
+    if (_shared_res.checkpoint_bytes == 0) {
+        /// No script made progress since the last checkpoint; skip the
+        /// write, the snapshot on disk is already up to date
+        if (!_offs.timer.armed()) {
+            _offs.timer.arm(_offs.duration);
+        }
+        return ss::now();
+    }
+    _shared_res.checkpoint_bytes = 0;
+    return save_offsets(_offs.snap, _ntps).then([this] {
+        if (!_offs.timer.armed()) {
+            _offs.timer.arm(_offs.duration);
+        }
+    });
+}
+
 ss::future<> pacemaker::stop() {
     /// Ensure no more timers are fired
     _offs.timer.cancel();
@@ -95,6 +95,10 @@ public:
     shared_script_resources& resources() { return _shared_res; }
 
 private:
+    /// Merge all scripts' offset progress on this shard into one snapshot
+    /// write, skipping it entirely when no offsets moved since the last one
+    ss::future<> do_checkpoint();
+
     void do_add_source(
       script_id,
       ntp_context_cache&,
@@ -29,12 +29,6 @@
 
 namespace coproc {
 
-struct batch_info {
-    model::offset last;
-    std::size_t total_size_bytes;
-    model::record_batch_reader rbr;
-};
-
 std::optional<batch_info>
 extract_batch_info(model::record_batch_reader::data_t data) {
     if (data.empty()) {
@@ -56,6 +50,76 @@ extract_batch_info(model::record_batch_reader::data_t data) {
       .rbr = model::make_memory_record_batch_reader(std::move(data))};
 }
 
+/// Next offset a script would read, i.e. one past its last read offset. Reads
+/// run ahead of acks so engine processing overlaps the next read; a failed
+/// reply rewinds last_read to last_acked (see script_context::rewind)
+static model::offset
+get_next_read(script_id id, const ss::lw_shared_ptr<ntp_context>& ntp_ctx) {
+    auto found = ntp_ctx->offsets.find(id);
+    vassert(
+      found != ntp_ctx->offsets.end(),
+      "script_id must exist: {} for ntp: {}",
+      id,
+      ntp_ctx->ntp());
+    const ntp_context::offset_pair& cp_offsets = found->second;
+    return (unlikely(cp_offsets.last_read == model::offset{}))
+             ? model::offset(0)
+             : cp_offsets.last_read + model::offset(1);
+}
+
+/// Serve a read from the shared window, sharing the underlying batches with
+/// whichever script read them off disk. Returns std::nullopt when the window
+/// doesn't cover the script's next offset, i.e. a private read is needed.
+static std::optional<batch_info> read_from_window(
+  script_id id, const ss::lw_shared_ptr<ntp_context>& ntp_ctx) {
+    if (!ntp_ctx->window) {
+        return std::nullopt;
+    }
+    auto& window = *ntp_ctx->window;
+    const model::offset next_read = get_next_read(id, ntp_ctx);
+    if (next_read < window.start || next_read > window.last) {
+        return std::nullopt;
+    }
+    model::record_batch_reader::data_t data;
+    std::size_t total_size = 0;
+    for (auto& b : window.batches) {
+        if (b.base_offset() < next_read) {
+            continue;
+        }
+        total_size += b.size_bytes();
+        data.push_back(b.share());
+    }
+    if (data.empty()) {
+        return std::nullopt;
+    }
+    const model::offset last_offset = data.back().last_offset();
+    return batch_info{
+      .last = last_offset,
+      .total_size_bytes = total_size,
+      .rbr = model::make_memory_record_batch_reader(std::move(data))};
+}
+
+/// Stash the window just read so that other scripts at the same offsets can
+/// share it. Private reads by stragglers don't regress the window.
+static void update_window(
+  const ss::lw_shared_ptr<ntp_context>& ntp_ctx,
+  model::offset start,
+  model::record_batch_reader::data_t& data) {
+    if (data.empty()) {
+        return;
+    }
+    if (ntp_ctx->window && start < ntp_ctx->window->start) {
+        return;
+    }
+    ntp_context::read_window window{
+      .start = start, .last = data.back().last_offset()};
+    window.batches.reserve(data.size());
+    for (auto& b : data) {
+        window.batches.push_back(b.share());
+    }
+    ntp_ctx->window.emplace(std::move(window));
+}
+
 script_context::script_context(
   script_id id,
   shared_script_resources& resources,
@@ -108,18 +172,43 @@ ss::future<> script_context::do_execute() {
               }
               supervisor_client_protocol client(*transport.value());
               return read().then(
-                [this, client = std::move(client)](
-                  std::vector<process_batch_request::data> requests) mutable {
-                    if (requests.empty()) {
+                [this, client = std::move(client)](read_set rs) mutable {
+                    if (rs.requests.empty()) {
                         /// No data to read from all inputs, no need to
-                        /// incessently loop, can exit to yield
+                        /// incessently loop, can exit to yield. Replies in
+                        /// flight are applied as they return.
                         return ss::make_ready_future<ss::stop_iteration>(
                           ss::stop_iteration::yes);
                     }
-                    /// Send request to wasm engine
-                    process_batch_request req{.reqs = std::move(requests)};
-                    return send_request(std::move(client), std::move(req))
-                      .then([] { return ss::stop_iteration::no; });
+                    /// Wait for in-flight budget, then dispatch to the wasm
+                    /// engine in the background and read the next window.
+                    /// Capped at the budget so one oversized read set cannot
+                    /// block the semaphore forever.
+                    const std::size_t units = std::min(
+                      rs.size_bytes,
+                      config::shard_local_cfg()
+                        .coproc_max_script_inflight_bytes.value());
+                    return ss::get_units(_inflight_sem, units)
+                      .then([this, client = std::move(client),
+                             rs = std::move(rs)](
+                              ss::semaphore_units<> units) mutable {
+                          (void)ss::with_gate(
+                            _gate,
+                            [this,
+                             client = std::move(client),
+                             rs = std::move(rs),
+                             units = std::move(units)]() mutable {
+                                return send_request(
+                                         std::move(client), std::move(rs))
+                                  .finally([units = std::move(units)] {});
+                            });
+                          return ss::stop_iteration::no;
+                      })
+                      .handle_exception_type(
+                        [](const ss::broken_semaphore&) {
+                            /// Shutdown broke the in-flight window
+                            return ss::stop_iteration::yes;
+                        });
                 });
           });
     });
@@ -127,68 +216,69 @@ ss::future<> script_context::do_execute() {
 
 ss::future<> script_context::shutdown() {
     _abort_source.request_abort();
+    /// Wake the read loop if it is blocked on the in-flight window
+    _inflight_sem.broken();
     return _gate.close().then([this] { _ntp_ctxs.clear(); });
 }
 
 ss::future<> script_context::send_request(
-  supervisor_client_protocol client, process_batch_request r) {
+  supervisor_client_protocol client, read_set rs) {
     using reply_t = result<rpc::client_context<process_batch_reply>>;
-    return client
-      .process_batch(
-        std::move(r), rpc::client_opts(rpc::clock_type::now() + 5s))
-      .then([this](reply_t reply) {
-          if (reply) {
-              return process_reply(std::move(reply.value().data));
-          }
-          vlog(
-            coproclog.warn,
-            "Error upon attempting to perform RPC to wasm engine, code: {}",
-            reply.error());
-          return ss::now();
+    process_batch_request req{.reqs = std::move(rs.requests)};
+    return ss::do_with(
+      std::move(rs.acks),
+      [this, client = std::move(client), req = std::move(req)](
+        acks_t& acks) mutable {
+          return client
+            .process_batch(
+              std::move(req), rpc::client_opts(rpc::clock_type::now() + 5s))
+            .then([this, &acks](reply_t reply) {
+                if (reply) {
+                    return process_reply(std::move(reply.value().data), acks);
+                }
+                vlog(
+                  coproclog.warn,
+                  "Error upon attempting to perform RPC to wasm engine, code: "
+                  "{}",
+                  reply.error());
+                /// The reply (and its acks) are lost, re-read the inputs
+                rewind(acks);
+                return ss::now();
+            });
       });
 }
 
-ss::future<std::vector<process_batch_request::data>> script_context::read() {
-    std::vector<process_batch_request::data> requests;
-    requests.reserve(_ntp_ctxs.size());
-    return ss::do_with(
-      std::move(requests),
-      [this](std::vector<process_batch_request::data>& requests) {
-          return ss::parallel_for_each(
-                   _ntp_ctxs,
-                   [this, &requests](const ntp_context_cache::value_type& p) {
-                       return read_ntp(p.second).then(
-                         [&requests](
-                           std::optional<process_batch_request::data> r) {
-                             if (r) {
-                                 requests.push_back(std::move(*r));
-                             }
-                         });
-                   })
-            .then([&requests] { return std::move(requests); });
-      });
+void script_context::rewind(const acks_t& acks) {
+    for (const auto& [ntp, info] : acks) {
+        auto found = _ntp_ctxs.find(ntp);
+        if (found == _ntp_ctxs.end()) {
+            continue;
+        }
+        auto& offsets = found->second->offsets[_id];
+        if (offsets.generation != info.generation) {
+            /// Already rewound since this request was read
+            continue;
+        }
+        offsets.last_read = offsets.last_acked;
+        offsets.generation++;
+    }
+}
+
+ss::future<script_context::read_set> script_context::read() {
+    return ss::do_with(read_set(), [this](read_set& rs) {
+        rs.requests.reserve(_ntp_ctxs.size());
+        return ss::parallel_for_each(
+                 _ntp_ctxs,
+                 [this, &rs](const ntp_context_cache::value_type& p) {
+                     return read_ntp(p.second, rs);
+                 })
+          .then([&rs] { return std::move(rs); });
+    });
 }
 
 storage::log_reader_config
 script_context::get_reader(const ss::lw_shared_ptr<ntp_context>& ntp_ctx) {
-    auto found = ntp_ctx->offsets.find(_id);
-    vassert(
-      found != ntp_ctx->offsets.end(),
-      "script_id must exist: {} for ntp: {}",
-      _id,
-      ntp_ctx->ntp());
-    const ntp_context::offset_pair& cp_offsets = found->second;
-    const model::offset next_read
-      = (unlikely(cp_offsets.last_acked == model::offset{}))
-          ? model::offset(0)
-          : cp_offsets.last_acked + model::offset(1);
-    if (next_read <= cp_offsets.last_acked) {
-        vlog(
-          coproclog.info,
-          "Replaying read on ntp: {} at offset: {}",
-          ntp_ctx->ntp(),
-          cp_offsets.last_read);
-    }
+    const model::offset next_read = get_next_read(_id, ntp_ctx);
     const storage::offset_stats os = ntp_ctx->log.offsets();
     return storage::log_reader_config(
       next_read,
@@ -201,44 +291,60 @@ script_context::get_reader(const ss::lw_shared_ptr<ntp_context>& ntp_ctx) {
       _abort_source);
 }
 
-ss::future<std::optional<process_batch_request::data>>
-script_context::read_ntp(ss::lw_shared_ptr<ntp_context> ntp_ctx) {
+ss::future<> script_context::read_ntp(
+  ss::lw_shared_ptr<ntp_context> ntp_ctx, read_set& rs) {
     return ss::with_semaphore(
-      _resources.read_sem, max_batch_size(), [this, ntp_ctx]() {
+      _resources.read_sem, max_batch_size(), [this, ntp_ctx, &rs]() {
+          if (auto shared = read_from_window(_id, ntp_ctx); shared) {
+              stage_read(ntp_ctx, std::move(*shared), rs);
+              return ss::now();
+          }
           storage::log_reader_config cfg = get_reader(ntp_ctx);
           return ntp_ctx->log.make_reader(cfg)
             .then([](model::record_batch_reader rbr) {
                 return model::consume_reader_to_memory(
                   std::move(rbr), model::no_timeout);
             })
-            .then([](model::record_batch_reader::data_t data) {
+            .then([ntp_ctx, start = cfg.start_offset](
+                    model::record_batch_reader::data_t data) {
+                update_window(ntp_ctx, start, data);
                 return extract_batch_info(std::move(data));
             })
-            .then(
-              [this, ntp_ctx](std::optional<batch_info> obatch_info)
-                -> std::optional<process_batch_request::data> {
-                  if (!obatch_info) {
-                      return std::nullopt;
-                  }
-                  ntp_ctx->offsets[_id].last_read = obatch_info->last;
-                  return process_batch_request::data{
-                    .ids = std::vector<script_id>{_id},
-                    .ntp = ntp_ctx->ntp(),
-                    .reader = std::move(obatch_info->rbr)};
-              });
+            .then([this, ntp_ctx, &rs](std::optional<batch_info> obatch_info) {
+                if (obatch_info) {
+                    stage_read(ntp_ctx, std::move(*obatch_info), rs);
+                }
+            });
       });
 }
 
-ss::future<> script_context::process_reply(process_batch_reply reply) {
-    return ss::do_with(std::move(reply), [this](process_batch_reply& reply) {
-        return ss::do_for_each(
-          reply.resps, [this](process_batch_reply::data& e) {
-              return process_one_reply(std::move(e));
-          });
-    });
+void script_context::stage_read(
+  const ss::lw_shared_ptr<ntp_context>& ntp_ctx, batch_info info, read_set& rs) {
+    auto& offsets = ntp_ctx->offsets[_id];
+    offsets.last_read = info.last;
+    account_progress(info.total_size_bytes);
+    rs.acks[ntp_ctx->ntp()] = ack_info{
+      .last = info.last, .generation = offsets.generation};
+    rs.size_bytes += info.total_size_bytes;
+    rs.requests.push_back(process_batch_request::data{
+      .ids = std::vector<script_id>{_id},
+      .ntp = ntp_ctx->ntp(),
+      .reader = std::move(info.rbr)});
+}
+
+ss::future<> script_context::process_reply(
+  process_batch_reply reply, const acks_t& acks) {
+    return ss::do_with(
+      std::move(reply), [this, &acks](process_batch_reply& reply) {
+          return ss::do_for_each(
+            reply.resps, [this, &acks](process_batch_reply::data& e) {
+                return process_one_reply(std::move(e), acks);
+            });
+      });
 }
 
-ss::future<> script_context::process_one_reply(process_batch_reply::data e) {
+ss::future<> script_context::process_one_reply(
+  process_batch_reply::data e, const acks_t& acks) {
     /// Ensure this 'script_context' instance is handling the correct reply
     if (e.id != _id) {
         /// TODO: Maybe in the future errors of these type should mean redpanda
@@ -272,20 +378,39 @@ ss::future<> script_context::process_one_reply(process_batch_reply::data e) {
         return ss::now();
     }
     auto ntp_ctx = found->second;
+    auto ack = acks.find(ntp_ctx->ntp());
+    if (ack == acks.end()) {
+        vlog(
+          coproclog.warn,
+          "script {} reply for ntp not in request: {}",
+          _id,
+          ntp_ctx->ntp());
+        return ss::now();
+    }
     return write_materialized(materialized_ntp, std::move(*e.reader))
-      .then([this, ntp_ctx](bool crc_parse_failure) {
-          if (crc_parse_failure) {
-              vlog(coproclog.warn, "record_batch failed to pass crc checks");
-              return;
-          }
+      .then([this, ntp_ctx, ack_info = ack->second](bool crc_parse_failure) {
           auto ofound = ntp_ctx->offsets.find(_id);
           vassert(
             ofound != ntp_ctx->offsets.end(),
             "Offset not found for script id {} for ntp owning context: {}",
             _id,
             ntp_ctx->ntp());
-          /// Reset the acked offset so that progress can be made
-          ofound->second.last_acked = ofound->second.last_read;
+          if (ofound->second.generation != ack_info.generation) {
+              /// Reads were rewound while this reply was in flight; the
+              /// window it acks will be re-read and re-sent
+              return;
+          }
+          if (crc_parse_failure) {
+              vlog(coproclog.warn, "record_batch failed to pass crc checks");
+              /// Re-read this window so the input isn't silently skipped
+              ofound->second.last_read = ofound->second.last_acked;
+              ofound->second.generation++;
+              return;
+          }
+          /// Advance the acked offset so the checkpoint can make progress;
+          /// replies may return out of order, acks are monotonic
+          ofound->second.last_acked = std::max(
+            ofound->second.last_acked, ack_info.last);
       });
 }
 
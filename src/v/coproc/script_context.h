@@ -14,6 +14,7 @@
 #include "coproc/ntp_context.h"
 #include "coproc/supervisor.h"
 #include "coproc/types.h"
+#include "model/record_batch_reader.h"
 #include "random/simple_time_jitter.h"
 #include "utils/mutex.h"
 
@@ -23,15 +24,24 @@
 
 namespace coproc {
 
+/// Offsets and size of one read window, plus a reader over its batches
+struct batch_info {
+    model::offset last;
+    std::size_t total_size_bytes;
+    model::record_batch_reader rbr;
+};
+
 /**
  * The script_context is the smallest schedulable unit in the coprocessor
  * framework. One context is created per registered coprocessor script,
  * representing one fiber.
  *
  * Important to note is the level of concurrency provided. Within a
- * script_context there is one fiber for which scheduled asynchronous work is
- * performed in sync, meaning that for each read -> send -> write that occurs
- * within the run loop, those actions will occur in order.
+ * script_context one fiber drives the read loop; requests are dispatched to
+ * the wasm engine as reads complete and their replies are applied to
+ * materialized logs as they return, so reads overlap engine processing. The
+ * loop is backpressured by a per-script bound on bytes in flight to the
+ * engine rather than by waiting on individual replies.
  *
  * Since each script_context has one of these fibers of its own, no one context
  * will wait for work to be finished by another in order to continue making
@@ -69,21 +79,42 @@ public:
     ss::future<> shutdown();
 
 private:
+    /// \brief Offset and generation to ack per input ntp once the engine's
+    /// reply for a request has been processed
+    struct ack_info {
+        model::offset last;
+        uint64_t generation;
+    };
+    using acks_t = absl::node_hash_map<model::ntp, ack_info>;
+
+    /// \brief One read across all input ntps, dispatched to the engine as a
+    /// single request
+    struct read_set {
+        std::vector<process_batch_request::data> requests;
+        acks_t acks;
+        std::size_t size_bytes{0};
+    };
+
     ss::future<> do_execute();
 
-    ss::future<>
-      send_request(supervisor_client_protocol, process_batch_request);
+    ss::future<> send_request(supervisor_client_protocol, read_set);
 
     storage::log_reader_config
     get_reader(const ss::lw_shared_ptr<ntp_context>&);
 
-    ss::future<std::vector<process_batch_request::data>> read();
+    ss::future<read_set> read();
+
+    ss::future<> read_ntp(ss::lw_shared_ptr<ntp_context>, read_set&);
 
-    ss::future<std::optional<process_batch_request::data>>
-      read_ntp(ss::lw_shared_ptr<ntp_context>);
+    /// Track offsets for a completed read and add it to the read_set
+    void
+    stage_read(const ss::lw_shared_ptr<ntp_context>&, batch_info, read_set&);
 
-    ss::future<> process_reply(process_batch_reply);
-    ss::future<> process_one_reply(process_batch_reply::data);
+    ss::future<> process_reply(process_batch_reply, const acks_t&);
+    ss::future<> process_one_reply(process_batch_reply::data, const acks_t&);
+
+    /// Re-read inputs from their acked offsets after a lost or failed reply
+    void rewind(const acks_t&);
     ss::future<bool> write_materialized(
       const model::materialized_ntp&, model::record_batch_reader);
 
@@ -91,10 +122,25 @@ private:
         return config::shard_local_cfg().coproc_max_batch_size.value();
     }
 
+    /// Record progress towards the next offset checkpoint
+    void account_progress(std::size_t bytes) {
+        _resources.checkpoint_bytes += bytes;
+        if (
+          _resources.checkpoint_bytes
+          >= config::shard_local_cfg().coproc_offset_flush_bytes.value()) {
+            _resources.request_checkpoint();
+        }
+    }
+
 private:
     /// Killswitch for in-process reads
     ss::abort_source _abort_source;
 
+    /// Bounds the bytes this script may have in flight to the wasm engine;
+    /// the read loop waits here instead of waiting on individual replies
+    ss::semaphore _inflight_sem{
+      config::shard_local_cfg().coproc_max_script_inflight_bytes.value()};
+
     /// Manages async fiber that begins when calling 'start()'
     ss::gate _gate;
 
@@ -13,6 +13,7 @@
 
 #include "seastarx.h"
 
+#include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sstring.hh>
 
@@ -26,7 +27,11 @@ struct probe {
     virtual std::vector<ss::sstring> points() = 0;
     virtual int8_t method_for_point(std::string_view point) const = 0;
 
-    [[gnu::always_inline]] bool operator()() const {
+    /// build-time master switch for failure injection. call sites can
+    /// guard with `if constexpr (finjector::probe::is_active())` so a
+    /// production binary carries no branch and no future chain for the
+    /// testing machinery
+    static constexpr bool is_active() {
 #ifndef NDEBUG
         // debug
         return true;
@@ -36,6 +41,8 @@ struct probe {
 #endif
     }
 
+    [[gnu::always_inline]] bool operator()() const { return is_active(); }
+
     bool is_enabled() const { return operator()(); }
     void set_exception(std::string_view point) {
         _exception_methods |= method_for_point(point);
@@ -77,4 +84,17 @@ private:
 
 honey_badger& shard_local_badger();
 
+/// chains the injection hook in front of op in builds with injection
+/// compiled in; in a production build the hook is discarded at compile
+/// time and op runs directly, with no branch or continuation in front
+template<typename Hook, typename Op>
+[[gnu::always_inline]] inline auto
+maybe_inject([[maybe_unused]] Hook&& hook, Op&& op) {
+    if constexpr (probe::is_active()) {
+        return hook().then(std::forward<Op>(op));
+    } else {
+        return op();
+    }
+}
+
 } // namespace finjector
@@ -9,6 +9,8 @@
 
 #include "hashing/murmur.h"
 
+#include <cstring>
+
 // adapted from original:
 // https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.h
 
@@ -51,6 +53,44 @@ getblock64(const uint64_t* p, int i) {
     return p[i];
 }
 
+// murmur2 mixing constants
+constexpr uint32_t m2_mult = 0x5bd1e995;
+constexpr int m2_rot = 24;
+
+// fragment data is not 4 byte aligned; memcpy compiles to a plain load
+inline __attribute__((always_inline)) uint32_t read_le32(const uint8_t* p) {
+    uint32_t k;
+    std::memcpy(&k, p, sizeof(k));
+    return k;
+}
+
+inline __attribute__((always_inline)) uint32_t
+murmur2_mix(uint32_t h, uint32_t k) {
+    k *= m2_mult;
+    k ^= k >> m2_rot;
+    k *= m2_mult;
+    h *= m2_mult;
+    h ^= k;
+    return h;
+}
+
+// tail bytes assembled little-endian into the low bits of k
+inline __attribute__((always_inline)) uint32_t
+murmur2_tail(uint32_t h, uint32_t k, std::size_t n) {
+    if (n > 0) {
+        h ^= k;
+        h *= m2_mult;
+    }
+    return h;
+}
+
+inline __attribute__((always_inline)) uint32_t murmur2_fmix(uint32_t h) {
+    h ^= h >> 13;
+    h *= m2_mult;
+    h ^= h >> 15;
+    return h;
+}
+
 } // namespace internal
 
 uint32_t murmurhash3_x86_32(const void* key, std::size_t len, uint32_t seed) {
@@ -378,3 +418,139 @@ void murmurhash3_x64_128(
     ((uint64_t*)out)[0] = h1;
     ((uint64_t*)out)[1] = h2;
 }
+
+//-----------------------------------------------------------------------------
+
+uint32_t murmur2(const void* key, std::size_t len, uint32_t seed) {
+    const uint8_t* data = (const uint8_t*)key;
+    const std::size_t nblocks = len / 4;
+
+    uint32_t h = seed ^ uint32_t(len);
+
+    //----------
+    // body
+
+    for (std::size_t i = 0; i < nblocks; i++) {
+        h = internal::murmur2_mix(h, internal::read_le32(data + i * 4));
+    }
+
+    //----------
+    // tail
+
+    const uint8_t* tail = data + nblocks * 4;
+
+    uint32_t k = 0;
+
+    switch (len & 3) {
+    case 3:
+        k ^= tail[2] << 16;
+    case 2:
+        k ^= tail[1] << 8;
+    case 1:
+        k ^= tail[0];
+    };
+    h = internal::murmur2_tail(h, k, len & 3);
+
+    //----------
+    // finalization
+
+    return internal::murmur2_fmix(h);
+}
+
+uint32_t murmur2(const iobuf& key, uint32_t seed) {
+    uint32_t h = seed ^ uint32_t(key.size_bytes());
+
+    // a 4 byte block split across a fragment boundary is assembled here,
+    // little-endian, before it is mixed
+    uint32_t carry = 0;
+    std::size_t carry_n = 0;
+
+    for (const auto& frag : key) {
+        const uint8_t* data = (const uint8_t*)frag.get();
+        std::size_t left = frag.size();
+
+        // top up a block the previous fragment left unfinished
+        while (carry_n > 0 && carry_n < 4 && left > 0) {
+            carry |= uint32_t(*data++) << (8 * carry_n);
+            ++carry_n;
+            --left;
+        }
+        if (carry_n == 4) {
+            h = internal::murmur2_mix(h, carry);
+            carry = 0;
+            carry_n = 0;
+        }
+
+        const std::size_t nblocks = left / 4;
+        for (std::size_t i = 0; i < nblocks; i++) {
+            h = internal::murmur2_mix(h, internal::read_le32(data + i * 4));
+        }
+        data += nblocks * 4;
+        left -= nblocks * 4;
+
+        while (left > 0) {
+            carry |= uint32_t(*data++) << (8 * carry_n);
+            ++carry_n;
+            --left;
+        }
+    }
+
+    h = internal::murmur2_tail(h, carry, carry_n);
+
+    return internal::murmur2_fmix(h);
+}
+
+void murmur2_batch(
+  const std::string_view* keys, uint32_t* hashes, std::size_t n,
+  uint32_t seed) {
+    constexpr std::size_t lanes = 4;
+
+    std::size_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        const uint8_t* data[lanes]; // NOLINT
+        std::size_t len[lanes];     // NOLINT
+        uint32_t h[lanes];          // NOLINT
+        std::size_t min_blocks = std::size_t(-1);
+        for (std::size_t l = 0; l < lanes; l++) {
+            data[l] = (const uint8_t*)keys[i + l].data();
+            len[l] = keys[i + l].size();
+            h[l] = seed ^ uint32_t(len[l]);
+            min_blocks = std::min(min_blocks, len[l] / 4);
+        }
+
+        // mix the block prefix all four keys share; the inner loop carries
+        // no cross-lane dependency so it vectorizes
+        for (std::size_t b = 0; b < min_blocks; b++) {
+            for (std::size_t l = 0; l < lanes; l++) {
+                h[l] = internal::murmur2_mix(
+                  h[l], internal::read_le32(data[l] + b * 4));
+            }
+        }
+
+        // finish the uneven remainders one lane at a time
+        for (std::size_t l = 0; l < lanes; l++) {
+            const uint8_t* tail = data[l] + min_blocks * 4;
+            std::size_t left = len[l] - min_blocks * 4;
+            uint32_t hh = h[l];
+            while (left >= 4) {
+                hh = internal::murmur2_mix(hh, internal::read_le32(tail));
+                tail += 4;
+                left -= 4;
+            }
+            uint32_t k = 0;
+            switch (left) {
+            case 3:
+                k ^= tail[2] << 16;
+            case 2:
+                k ^= tail[1] << 8;
+            case 1:
+                k ^= tail[0];
+            };
+            hh = internal::murmur2_tail(hh, k, left);
+            hashes[i + l] = internal::murmur2_fmix(hh);
+        }
+    }
+    for (; i < n; i++) {
+        hashes[i] = murmur2(keys[i].data(), keys[i].size(), seed);
+    }
+}
@@ -11,8 +11,11 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 // adapted from original:
 // https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.h
@@ -20,6 +23,31 @@
 // bloom filter magic seed in bitcoin core
 constexpr static const uint32_t kDefaultHashingSeed = 0xFBA4C795;
 
+// seed the apache kafka java client uses for murmur2 key partitioning;
+// keyed records must hash identically across clients to land on the same
+// partition
+constexpr static const uint32_t kKafkaHashingSeed = 0x9747B28C;
+
+/// MurmurHash2, the hash kafka's default partitioner applies to record
+/// keys. Bit-compatible with org.apache.kafka.common.utils.Utils#murmur2.
+uint32_t
+murmur2(const void* key, std::size_t len, uint32_t seed = kKafkaHashingSeed);
+
+/// murmur2 of a possibly fragmented buffer. Walks the fragments carrying
+/// split blocks across the boundaries, so the key does not have to be
+/// copied out to contiguous storage first.
+uint32_t murmur2(const iobuf& key, uint32_t seed = kKafkaHashingSeed);
+
+/// murmur2 of a batch of keys in one call. The hash state of four keys at
+/// a time is interleaved so the block mixing runs lane-parallel (the loop
+/// carries no cross-lane dependencies and auto-vectorizes); tails and
+/// finalization are table-free per-lane scalar code.
+void murmur2_batch(
+  const std::string_view* keys,
+  uint32_t* hashes,
+  std::size_t n,
+  uint32_t seed = kKafkaHashingSeed);
+
 uint32_t murmurhash3_x86_32(
   const void* key, std::size_t len, uint32_t seed = kDefaultHashingSeed);
 
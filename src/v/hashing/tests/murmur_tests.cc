@@ -0,0 +1,67 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+
+#include <seastar/core/temporary_buffer.hh>
+
+#include <cstring>
+#define BOOST_TEST_MODULE murmur
+#include "hashing/murmur.h"
+#include "random/generators.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string_view>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(murmur2_kafka_compatibility) {
+    // values computed with org.apache.kafka.common.utils.Utils#murmur2; a
+    // change here breaks cross-client key partitioning
+    BOOST_CHECK_EQUAL(murmur2(nullptr, 0), 275646681);
+    BOOST_CHECK_EQUAL(murmur2("a", 1), 2731586172);
+    BOOST_CHECK_EQUAL(murmur2("21", 2), 3321034988);
+    BOOST_CHECK_EQUAL(murmur2("abcd", 4), 2971317748);
+    BOOST_CHECK_EQUAL(murmur2("kafka", 5), 3496464228);
+    const std::string_view longer = "lorem ipsum dolor sit amet";
+    BOOST_CHECK_EQUAL(murmur2(longer.data(), longer.size()), 3699534022);
+}
+
+BOOST_AUTO_TEST_CASE(murmur2_iobuf_fragmentation_invariance) {
+    const auto data = random_generators::gen_alphanum_string(61);
+    const auto contiguous = murmur2(data.data(), data.size());
+    // the digest must not depend on where the fragments split, 4 byte
+    // blocks straddling a boundary included
+    for (size_t split : {1, 2, 3, 4, 7, 32, 60}) {
+        iobuf buf;
+        buf.prepend(ss::temporary_buffer<char>(
+          data.data() + split, data.size() - split));
+        buf.prepend(ss::temporary_buffer<char>(data.data(), split));
+        BOOST_CHECK_EQUAL(murmur2(buf), contiguous);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(murmur2_batch_same_as_one_at_a_time) {
+    std::vector<ss::sstring> keys;
+    // uneven lengths exercise the per-lane remainders past the shared
+    // block prefix, the odd count exercises the scalar epilogue
+    for (size_t len = 0; len < 23; ++len) {
+        keys.push_back(random_generators::gen_alphanum_string(len));
+    }
+    std::vector<std::string_view> views;
+    views.reserve(keys.size());
+    for (const auto& k : keys) {
+        views.emplace_back(k.data(), k.size());
+    }
+    std::vector<uint32_t> hashes(keys.size());
+    murmur2_batch(views.data(), hashes.data(), views.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        BOOST_CHECK_EQUAL(hashes[i], murmur2(keys[i].data(), keys[i].size()));
+    }
+}
@@ -47,6 +47,23 @@ BOOST_AUTO_TEST_CASE(digest_idempotency) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(xxh3_incremental_same_as_one_shot) {
+    const std::string_view data = "the quick brown fox jumps over the lazy dog";
+    incremental_xxh3 inc;
+    // feed in uneven chunks, the digest must not depend on the split
+    inc.update(data.substr(0, 7));
+    inc.update(data.substr(7, 13));
+    inc.update(data.substr(20));
+    BOOST_CHECK_EQUAL(inc.digest(), xxh3_64(data.data(), data.size()));
+}
+
+BOOST_AUTO_TEST_CASE(xxh3_distinct_inputs) {
+    const std::string_view a = "topic-a";
+    const std::string_view b = "topic-b";
+    BOOST_CHECK_NE(
+      xxh3_64(a.data(), a.size()), xxh3_64(b.data(), b.size()));
+}
+
 template<typename T, typename V>
 void test_incremental_hash(T test, V expected) {
     incremental_xxhash64 hash;
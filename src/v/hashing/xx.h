@@ -19,6 +19,31 @@
 #include <string_view>
 #include <xxhash.h>
 
+/*
+ * XXH3 is a drop-in upgrade of XXH64 with runtime SIMD dispatch; it is
+ * roughly twice as fast on the short keys we hash in hot paths. It became
+ * part of the stable xxhash API in 0.8.0 - on older system libraries the
+ * xxh3 entry points below degrade to XXH64 so callers never have to care.
+ */
+#if defined(XXH_VERSION_NUMBER) && XXH_VERSION_NUMBER >= 800
+#define XXH3_AVAILABLE 1
+#endif
+
+inline uint64_t xxh3_64(const char* data, size_t length) {
+#ifdef XXH3_AVAILABLE
+    return XXH3_64bits(data, length);
+#else
+    return XXH64(data, length, 0);
+#endif
+}
+inline uint64_t xxh3_64(const unsigned char* data, size_t length) {
+#ifdef XXH3_AVAILABLE
+    return XXH3_64bits(data, length);
+#else
+    return XXH64(data, length, 0);
+#endif
+}
+
 inline uint64_t xxhash_64(const unsigned char* data, size_t length) {
     return XXH64(data, length, 0);
 }
@@ -74,6 +99,51 @@ private:
     XXH64_state_t _state{};
 };
 
+class incremental_xxh3 {
+public:
+    explicit incremental_xxh3(uint64_t seed = 0) {
+#ifdef XXH3_AVAILABLE
+        XXH3_64bits_reset_withSeed(&_state, seed);
+#else
+        XXH64_reset(&_state, seed);
+#endif
+    }
+    incremental_xxh3(incremental_xxh3&&) noexcept = default;
+    incremental_xxh3& operator=(incremental_xxh3&&) noexcept = default;
+
+    void update(const char* src, const std::size_t sz) {
+#ifdef XXH3_AVAILABLE
+        XXH3_64bits_update(&_state, src, sz);
+#else
+        XXH64_update(&_state, src, sz);
+#endif
+    }
+
+    void update(std::string_view str) { update(str.data(), str.size()); }
+
+    template<
+      typename T,
+      typename std::enable_if_t<std::is_integral_v<T>>* = nullptr>
+    void update(T t) {
+        update((const char*)&t, sizeof(T));
+    }
+
+    uint64_t digest() {
+#ifdef XXH3_AVAILABLE
+        return XXH3_64bits_digest(&_state);
+#else
+        return XXH64_digest(&_state);
+#endif
+    }
+
+private:
+#ifdef XXH3_AVAILABLE
+    XXH3_state_t _state{};
+#else
+    XXH64_state_t _state{};
+#endif
+};
+
 template<
   typename T,
   std::size_t N,
@@ -37,6 +37,18 @@ void chunked_encoder::append_chunk_body(
     }
 }
 
+void chunked_encoder::append_chunk_body(iobuf& seq, iobuf&& payload) {
+    boost::beast::http::chunk_header header(payload.size_bytes());
+    for (const auto& buf : header) {
+        seq.append(static_cast<const uint8_t*>(buf.data()), buf.size());
+    }
+    seq.append(std::move(payload));
+    boost::beast::http::chunk_crlf crlf;
+    for (const auto& buf : crlf) {
+        seq.append(static_cast<const uint8_t*>(buf.data()), buf.size());
+    }
+}
+
 void chunked_encoder::encode_impl(
   iobuf& seq, ss::temporary_buffer<char>&& buf) const {
     for (size_t pos = 0; pos < buf.size(); pos += _max_chunk_size) {
@@ -60,14 +72,18 @@ iobuf chunked_encoder::encode(ss::temporary_buffer<char>&& buf) const {
     return seq;
 }
 
-iobuf chunked_encoder::encode(iobuf&& inp) {
+iobuf chunked_encoder::encode(iobuf&& inp) const {
     if (_bypass) {
         return std::move(inp);
     }
+    // Frame max_chunk_size windows of the input regardless of how it is
+    // fragmented; the payload fragments are shared into the output, so a
+    // finely fragmented input doesn't degrade into one frame per fragment.
     iobuf out;
-    for (auto& frag : inp) {
-        auto tmp = frag.share();
-        encode_impl(out, std::move(tmp));
+    const size_t total = inp.size_bytes();
+    for (size_t pos = 0; pos < total; pos += _max_chunk_size) {
+        const size_t chunk_size = std::min(_max_chunk_size, total - pos);
+        append_chunk_body(out, inp.share(pos, chunk_size));
     }
     return out;
 }
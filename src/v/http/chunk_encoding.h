@@ -33,8 +33,8 @@ public:
     iobuf encode(ss::temporary_buffer<char>&& buf) const;
 
     /// Transform an iobuf into a series of chunks represented
-    /// as another iobuf.
-    iobuf encode(iobuf&& inp);
+    /// as another iobuf. Payload bytes are shared, not copied.
+    iobuf encode(iobuf&& inp) const;
 
     /// Put zero size chunk header to indicate EOF
     iobuf encode_eof() const;
@@ -53,6 +53,7 @@ private:
     ///     - crlf
     static void
     append_chunk_body(iobuf& seq, ss::temporary_buffer<char>&& payload);
+    static void append_chunk_body(iobuf& seq, iobuf&& payload);
 
     void encode_impl(iobuf& seq, ss::temporary_buffer<char>&& buf) const;
 
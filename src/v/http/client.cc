@@ -9,7 +9,6 @@
 
 #include "http/client.h"
 
-#include "bytes/details/io_iterator_consumer.h"
 #include "bytes/iobuf.h"
 
 #include <seastar/core/condition-variable.hh>
@@ -287,23 +286,11 @@ bool client::request_stream::is_done() { return _serializer.is_done(); }
 // Wait until remaining data will be transmitted
 ss::future<> client::request_stream::send_eof() { return _gate.close(); }
 
-static ss::temporary_buffer<char> iobuf_as_tmpbuf(iobuf&& buf) {
-    if (buf.begin() == buf.end()) {
-        // empty buf
-        return ss::temporary_buffer<char>();
-    }
-    auto full_size_bytes = buf.size_bytes();
-    if (auto it = buf.begin(); full_size_bytes == it->size()) {
-        // fast path
-        return std::move(*it).release();
-    }
-    // linearize the iobuf
-    auto consumer = iobuf::iterator_consumer(buf.begin(), buf.end());
-    ss::temporary_buffer<char> res(full_size_bytes);
-    consumer.consume_to(full_size_bytes, res.get_write());
-    return res;
-}
 /// Represents response body as a data source for ss::input_stream
+///
+/// The body arrives from the parser as shared iobuf fragments; they are
+/// handed to the stream one at a time without linearizing, so multi-MB
+/// bodies never go through an intermediate copy.
 struct response_data_source final : ss::data_source_impl {
     explicit response_data_source(client::response_stream_ref resp)
       : _io(std::move(resp)) {}
@@ -316,39 +303,49 @@ struct response_data_source final : ss::data_source_impl {
         return get();
     }
     ss::future<ss::temporary_buffer<char>> get() final {
-        return ss::do_with(
-          ss::temporary_buffer<char>(),
-          [this](ss::temporary_buffer<char>& result) {
-              return ss::repeat([this, &result] {
-                         if (_done || _io->is_done()) {
-                             return ss::make_ready_future<ss::stop_iteration>(
-                               ss::stop_iteration::yes);
-                         }
-                         return _io->recv_some().then([this, &result](
-                                                        iobuf&& bufseq) {
-                             if (_skip) {
-                                 auto n = std::min(bufseq.size_bytes(), _skip);
-                                 bufseq.trim_front(n);
-                                 _skip -= n;
-                             }
-                             if (bufseq.begin() == bufseq.end()) {
-                                 return ss::make_ready_future<
-                                   ss::stop_iteration>(
-                                   _io->is_done() ? ss::stop_iteration::yes
-                                                  : ss::stop_iteration::no);
-                             }
-                             result = iobuf_as_tmpbuf(std::move(bufseq));
-                             return ss::make_ready_future<ss::stop_iteration>(
-                               ss::stop_iteration::yes);
-                         });
-                     })
-                .then([&result] {
-                    return ss::make_ready_future<ss::temporary_buffer<char>>(
-                      std::move(result));
-                });
+        if (_pending.begin() != _pending.end()) {
+            return ss::make_ready_future<ss::temporary_buffer<char>>(
+              pop_fragment());
+        }
+        return ss::repeat([this] {
+                   if (_done || _io->is_done()) {
+                       return ss::make_ready_future<ss::stop_iteration>(
+                         ss::stop_iteration::yes);
+                   }
+                   return _io->recv_some().then([this](iobuf&& bufseq) {
+                       if (_skip) {
+                           auto n = std::min(bufseq.size_bytes(), _skip);
+                           bufseq.trim_front(n);
+                           _skip -= n;
+                       }
+                       if (bufseq.begin() == bufseq.end()) {
+                           return ss::make_ready_future<ss::stop_iteration>(
+                             _io->is_done() ? ss::stop_iteration::yes
+                                            : ss::stop_iteration::no);
+                       }
+                       _pending = std::move(bufseq);
+                       return ss::make_ready_future<ss::stop_iteration>(
+                         ss::stop_iteration::yes);
+                   });
+               })
+          .then([this] {
+              if (_pending.begin() == _pending.end()) {
+                  // EOF
+                  return ss::make_ready_future<ss::temporary_buffer<char>>(
+                    ss::temporary_buffer<char>());
+              }
+              return ss::make_ready_future<ss::temporary_buffer<char>>(
+                pop_fragment());
           });
     }
+    /// Detach the first pending fragment, sharing its underlying buffer
+    ss::temporary_buffer<char> pop_fragment() {
+        auto buf = _pending.begin()->share();
+        _pending.pop_front();
+        return buf;
+    }
     client::response_stream_ref _io;
+    iobuf _pending;
     size_t _skip{0};
     bool _done{false};
 };
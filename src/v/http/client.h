@@ -112,7 +112,8 @@ public:
         ss::future<iobuf> recv_some();
 
         /// Returns input_stream that can be used to fetch response body.
-        /// Can be used instead of 'recv_some'.
+        /// Can be used instead of 'recv_some'. The stream yields the body as
+        /// the parser's shared iobuf fragments, without copying.
         ss::input_stream<char> as_input_stream();
 
     private:
@@ -0,0 +1,192 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "http/ranged_download.h"
+
+#include "http/logger.h"
+#include "likely.h"
+#include "vassert.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/semaphore.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace http {
+
+ss::future<iobuf> get_range(
+  client& cl, client::request_header header, uint64_t first, uint64_t last) {
+    vassert(first <= last, "invalid byte range [{}, {}]", first, last);
+    header.set(
+      boost::beast::http::field::range,
+      fmt::format("bytes={}-{}", first, last));
+    auto resp = co_await cl.request(std::move(header));
+    co_await resp->prefetch_headers();
+    const auto status = resp->get_headers().result();
+    if (
+      status != boost::beast::http::status::partial_content
+      && status != boost::beast::http::status::ok) {
+        throw std::runtime_error(fmt::format(
+          "range [{}, {}] request failed with status {}",
+          first,
+          last,
+          resp->get_headers().result_int()));
+    }
+    iobuf body;
+    while (!resp->is_done()) {
+        body.append(co_await resp->recv_some());
+    }
+    // a 200 from a server that ignored the Range field is only acceptable
+    // when the full body happens to be the requested span, the length check
+    // covers both statuses
+    const uint64_t expected = last - first + 1;
+    if (body.size_bytes() != expected) {
+        throw std::runtime_error(fmt::format(
+          "range [{}, {}] returned {} bytes, expected {}",
+          first,
+          last,
+          body.size_bytes(),
+          expected));
+    }
+    co_return body;
+}
+
+ranged_download::ranged_download(
+  range_fetch_function fetch, ranged_download_options opts)
+  : _fetch(std::move(fetch))
+  , _opts(opts)
+  , _num_parts((opts.object_size + opts.part_size - 1) / opts.part_size)
+  , _buffer_sem(opts.max_buffered_parts) {
+    vassert(_opts.part_size > 0, "part_size can't be zero");
+    vassert(_opts.concurrency > 0, "concurrency can't be zero");
+    vassert(_opts.max_buffered_parts > 0, "max_buffered_parts can't be zero");
+}
+
+ss::future<> ranged_download::worker() {
+    while (!_error && _next_fetch < _num_parts) {
+        // claim the range up front so no two fibers fetch the same part
+        const auto index = _next_fetch++;
+        const uint64_t first = uint64_t(index) * _opts.part_size;
+        const uint64_t last
+          = std::min(first + _opts.part_size, _opts.object_size) - 1;
+        try {
+            auto units = co_await ss::get_units(_buffer_sem, 1);
+            if (_error) {
+                co_return;
+            }
+            vlog(
+              http_log.trace,
+              "fetching part {}/{}, range [{}, {}]",
+              index,
+              _num_parts,
+              first,
+              last);
+            auto data = co_await _fetch(first, last);
+            if (unlikely(data.size_bytes() != last - first + 1)) {
+                throw std::runtime_error(fmt::format(
+                  "range [{}, {}] produced {} bytes",
+                  first,
+                  last,
+                  data.size_bytes()));
+            }
+            _ready.emplace(index, part{std::move(data), std::move(units)});
+            _cvar.signal();
+        } catch (...) {
+            if (!_error) {
+                _error = std::current_exception();
+            }
+            _cvar.broadcast();
+            co_return;
+        }
+    }
+}
+
+ss::future<iobuf> ranged_download::pop_part() {
+    const auto index = _next_consume;
+    while (!_error && !_ready.contains(index)) {
+        co_await _cvar.wait();
+    }
+    if (_error) {
+        std::rethrow_exception(_error);
+    }
+    auto it = _ready.find(index);
+    auto data = std::move(it->second.data);
+    // dropping the entry releases its buffer units and lets a fetch fiber
+    // move on to the next range
+    _ready.erase(it);
+    _next_consume++;
+    co_return data;
+}
+
+/// Represents the re-assembled object as a data source for ss::input_stream.
+/// Parts arrive as iobufs; their fragments are handed to the stream one at a
+/// time without copying, mirroring response_data_source.
+struct ranged_download_data_source final : ss::data_source_impl {
+    explicit ranged_download_data_source(ranged_download* dl)
+      : _dl(dl) {}
+    ss::future<> close() final {
+        _done = true;
+        return ss::now();
+    }
+    ss::future<ss::temporary_buffer<char>> get() final {
+        if (_pending.begin() != _pending.end()) {
+            return ss::make_ready_future<ss::temporary_buffer<char>>(
+              pop_fragment());
+        }
+        if (_done || _dl->_next_consume == _dl->_num_parts) {
+            // EOF
+            return ss::make_ready_future<ss::temporary_buffer<char>>(
+              ss::temporary_buffer<char>());
+        }
+        return _dl->pop_part().then([this](iobuf&& data) {
+            _pending = std::move(data);
+            return pop_fragment();
+        });
+    }
+    ss::temporary_buffer<char> pop_fragment() {
+        auto buf = _pending.begin()->share();
+        _pending.pop_front();
+        return buf;
+    }
+    ranged_download* _dl;
+    iobuf _pending;
+    bool _done{false};
+};
+
+ss::input_stream<char> ranged_download::as_input_stream() {
+    vassert(!_started, "ranged download can only be consumed once");
+    _started = true;
+    const auto fibers = std::min(_opts.concurrency, _num_parts);
+    for (size_t i = 0; i < fibers; i++) {
+        // the loop body never lets an exception escape, failures are
+        // recorded in _error and surfaced through the stream
+        (void)ss::with_gate(_gate, [this] { return worker(); });
+    }
+    auto ds = ss::data_source(
+      std::make_unique<ranged_download_data_source>(this));
+    return ss::input_stream<char>(std::move(ds));
+}
+
+ss::future<> ranged_download::stop() {
+    if (!_error) {
+        _error = std::make_exception_ptr(
+          std::runtime_error("ranged download stopped"));
+    }
+    // wake fetch fibers queued on the buffer and the consumer, fetches that
+    // are already on the wire are awaited by the gate
+    _buffer_sem.broken();
+    _cvar.broadcast();
+    return _gate.close();
+}
+
+} // namespace http
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "http/client.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/semaphore.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <exception>
+
+namespace http {
+
+/// Tuning knobs for a ranged GET fan-out
+struct ranged_download_options {
+    /// total object size in bytes (e.g. from a HEAD request or a listing)
+    uint64_t object_size;
+    /// bytes requested per Range GET
+    size_t part_size = 16_MiB;
+    /// ranges fetched in parallel; a single connection is limited to one
+    /// bandwidth-delay product, fetching several ranges over separate
+    /// connections is what lets a large object download saturate the link
+    size_t concurrency = 4;
+    /// completed parts buffered ahead of the consumer; bounds memory use
+    /// at roughly (max_buffered_parts + concurrency) * part_size
+    size_t max_buffered_parts = 8;
+};
+
+/// Fetches the inclusive byte range [first, last] of the object and returns
+/// its octets. Invoked concurrently from up to `concurrency` fibers; every
+/// invocation has to run on its own connection (e.g. a pooled client lease).
+/// Implementations talking raw http can delegate to `get_range()`.
+using range_fetch_function
+  = ss::noncopyable_function<ss::future<iobuf>(uint64_t, uint64_t)>;
+
+/// Perform one GET for the inclusive byte range [first, last] using the
+/// supplied client. A Range field is added to the header. The response has
+/// to carry status 206 (or 200 from servers that ignore the Range field)
+/// and exactly the requested number of octets, anything else fails the
+/// returned future.
+ss::future<iobuf> get_range(
+  client& cl, client::request_header header, uint64_t first, uint64_t last);
+
+/// Hydrates an object of known size by splitting it into part_size byte
+/// ranges, fetching up to `concurrency` of them in parallel and
+/// re-assembling the parts in order into an input stream.
+///
+/// Buffering is bounded: a fetch fiber only starts on the next range once
+/// the consumer is fewer than max_buffered_parts parts behind, so a slow
+/// consumer throttles the downloads instead of accumulating the object in
+/// memory.
+///
+/// The downloader must outlive the stream returned by as_input_stream()
+/// and stop() must be called before destruction.
+class ranged_download {
+public:
+    ranged_download(range_fetch_function fetch, ranged_download_options opts);
+
+    ranged_download(ranged_download&&) = delete;
+    ranged_download(const ranged_download&) = delete;
+    ranged_download& operator=(ranged_download&&) = delete;
+    ranged_download& operator=(const ranged_download&) = delete;
+    ~ranged_download() = default;
+
+    /// Stream yielding object bytes [0, object_size) in order. The range
+    /// fetches start when this is called. Can only be called once.
+    ss::input_stream<char> as_input_stream();
+
+    /// Stop the fan-out. Fetches that are already in flight are awaited,
+    /// queued ranges are abandoned.
+    ss::future<> stop();
+
+    size_t num_parts() const { return _num_parts; }
+
+private:
+    friend struct ranged_download_data_source;
+
+    /// One fetch fiber: claims range indexes and downloads them until the
+    /// object is exhausted or the download failed
+    ss::future<> worker();
+
+    /// Wait for part `_next_consume` to arrive and detach it. Called
+    /// sequentially by the data source.
+    ss::future<iobuf> pop_part();
+
+    /// completed part awaiting the consumer; holding the buffer units
+    /// until consumption is what bounds the fetch-ahead
+    struct part {
+        iobuf data;
+        ss::semaphore_units<> units;
+    };
+
+    range_fetch_function _fetch;
+    ranged_download_options _opts;
+    size_t _num_parts;
+    /// next range index to be claimed by a fetch fiber
+    size_t _next_fetch{0};
+    /// next range index the consumer is waiting for
+    size_t _next_consume{0};
+    bool _started{false};
+    /// first failure; set once, fails every subsequent read
+    std::exception_ptr _error;
+    absl::flat_hash_map<size_t, part> _ready;
+    ss::condition_variable _cvar;
+    ss::semaphore _buffer_sem;
+    ss::gate _gate;
+};
+
+} // namespace http
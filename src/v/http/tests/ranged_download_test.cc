@@ -0,0 +1,281 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "http/client.h"
+#include "http/ranged_download.h"
+#include "rpc/transport.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/net/api.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+
+static const uint16_t httpd_port_number = 8129;
+static const char* httpd_host_name = "127.0.0.1";
+
+static rpc::base_transport::configuration transport_configuration() {
+    ss::ipv4_addr ip_addr = {httpd_host_name, httpd_port_number};
+    ss::socket_address server_addr(ip_addr);
+    rpc::base_transport::configuration conf{.server_addr = server_addr};
+    return conf;
+}
+
+static ss::sstring make_payload(size_t size) {
+    ss::sstring payload = ss::uninitialized_string(size);
+    std::mt19937 rng(42); // NOLINT
+    std::uniform_int_distribution<int> dist('a', 'z');
+    for (auto& c : payload) {
+        c = static_cast<char>(dist(rng));
+    }
+    return payload;
+}
+
+/// Minimal http server that stores one object and answers GET requests
+/// carrying a Range header with a 206 and the requested slice. Accepts many
+/// concurrent connections, which seastar httpd's function handlers can't be
+/// coaxed into for 206 responses. Supposed to be used with async.
+class range_server {
+public:
+    explicit range_server(ss::sstring object)
+      : _object(std::move(object)) {}
+
+    void listen(ss::socket_address server_addr) {
+        ss::listen_options lo{};
+        lo.reuse_address = true;
+        _listener = ss::engine().listen(server_addr, lo);
+        (void)ss::with_gate(_gate, [this] { return accept_loop(); });
+    }
+
+    void stop() {
+        _listener.abort_accept();
+        _gate.close().get();
+    }
+
+private:
+    ss::future<> accept_loop() {
+        return ss::repeat([this] {
+            return _listener.accept().then_wrapped([this](auto f) {
+                if (f.failed()) {
+                    f.ignore_ready_future();
+                    return ss::stop_iteration::yes;
+                }
+                auto [conn, addr] = f.get0();
+                (void)addr;
+                auto sock = std::move(conn);
+                (void)ss::with_gate(
+                  _gate, [this, sock = std::move(sock)]() mutable {
+                      return serve(std::move(sock));
+                  });
+                return ss::stop_iteration::no;
+            });
+        });
+    }
+
+    ss::future<> serve(ss::connected_socket conn) {
+        return ss::do_with(
+          std::move(conn),
+          iobuf(),
+          [this](ss::connected_socket& conn, iobuf& buffer) {
+              auto in = conn.input();
+              auto out = conn.output();
+              return ss::do_with(
+                std::move(in),
+                std::move(out),
+                [this, &buffer](
+                  ss::input_stream<char>& in, ss::output_stream<char>& out) {
+                    return ss::repeat([this, &in, &out, &buffer] {
+                               return handle_one(in, out, buffer);
+                           })
+                      .finally([&out] { return out.close(); });
+                });
+          });
+    }
+
+    ss::future<ss::stop_iteration>
+    handle_one(ss::input_stream<char>& in, ss::output_stream<char>& out, iobuf& buffer) {
+        return in.read().then(
+          [this, &out, &buffer](ss::temporary_buffer<char> chunk) {
+              if (chunk.empty()) {
+                  return ss::make_ready_future<ss::stop_iteration>(
+                    ss::stop_iteration::yes);
+              }
+              buffer.append(std::move(chunk));
+              iobuf_parser parser(buffer.copy());
+              auto request = parser.read_string(parser.bytes_left());
+              auto end_of_header = request.find("\r\n\r\n");
+              if (end_of_header == ss::sstring::npos) {
+                  // wait for the rest of the header
+                  return ss::make_ready_future<ss::stop_iteration>(
+                    ss::stop_iteration::no);
+              }
+              buffer.clear();
+              return send_range(out, request).then([] {
+                  return ss::stop_iteration::no;
+              });
+          });
+    }
+
+    ss::future<> send_range(
+      ss::output_stream<char>& out, const ss::sstring& request) {
+        auto pos = request.find("Range: bytes=");
+        BOOST_REQUIRE(pos != ss::sstring::npos);
+        uint64_t first = 0;
+        uint64_t last = 0;
+        auto matched = std::sscanf(
+          request.c_str() + pos, // NOLINT
+          "Range: bytes=%lu-%lu",
+          &first,
+          &last);
+        BOOST_REQUIRE_EQUAL(matched, 2);
+        BOOST_REQUIRE(first <= last);
+        BOOST_REQUIRE(last < _object.size());
+        auto body = _object.substr(first, last - first + 1);
+        auto response = fmt::format(
+          "HTTP/1.1 206 Partial Content\r\n"
+          "Content-Length: {}\r\n"
+          "Content-Range: bytes {}-{}/{}\r\n"
+          "\r\n"
+          "{}",
+          body.size(),
+          first,
+          last,
+          _object.size(),
+          body);
+        return ss::do_with(
+          std::move(response), [&out](const ss::sstring& response) {
+              return out.write(response.data(), response.size()).then([&out] {
+                  return out.flush();
+              });
+          });
+    }
+
+    ss::sstring _object;
+    ss::server_socket _listener;
+    ss::gate _gate;
+    bool _stopped{false};
+};
+
+/// Fetch function that runs every range GET on its own short-lived
+/// connection, the way the fan-out expects pooled clients to be used
+static http::range_fetch_function
+make_fetch_fn(const rpc::base_transport::configuration& conf) {
+    return [conf](uint64_t first, uint64_t last) -> ss::future<iobuf> {
+        auto client = ss::make_shared<http::client>(conf);
+        http::client::request_header header;
+        header.method(boost::beast::http::verb::get);
+        header.target("/object");
+        header.insert(
+          boost::beast::http::field::host,
+          fmt::format("{}", conf.server_addr));
+        return http::get_range(*client, std::move(header), first, last)
+          .finally([client] { return client->shutdown(); });
+    };
+}
+
+static iobuf drain_stream(ss::input_stream<char>& stream) {
+    iobuf out;
+    while (!stream.eof()) {
+        auto buf = stream.read().get0();
+        out.append(std::move(buf));
+    }
+    return out;
+}
+
+SEASTAR_THREAD_TEST_CASE(test_ranged_download_reassembles_in_order) {
+    auto conf = transport_configuration();
+    auto payload = make_payload(64_KiB + 1234);
+    range_server server(payload);
+    server.listen(conf.server_addr);
+
+    http::ranged_download download(
+      make_fetch_fn(conf),
+      http::ranged_download_options{
+        .object_size = payload.size(),
+        .part_size = 4_KiB,
+        .concurrency = 3,
+        .max_buffered_parts = 2,
+      });
+    BOOST_REQUIRE_EQUAL(download.num_parts(), 17);
+
+    auto stream = download.as_input_stream();
+    auto body = drain_stream(stream);
+    stream.close().get();
+    download.stop().get();
+    server.stop();
+
+    iobuf_parser parser(std::move(body));
+    auto actual = parser.read_string(parser.bytes_left());
+    BOOST_REQUIRE_EQUAL(actual.size(), payload.size());
+    BOOST_REQUIRE(actual == payload);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_ranged_download_single_part) {
+    auto conf = transport_configuration();
+    auto payload = make_payload(100);
+    range_server server(payload);
+    server.listen(conf.server_addr);
+
+    http::ranged_download download(
+      make_fetch_fn(conf),
+      http::ranged_download_options{
+        .object_size = payload.size(),
+        .part_size = 4_KiB,
+      });
+    BOOST_REQUIRE_EQUAL(download.num_parts(), 1);
+
+    auto stream = download.as_input_stream();
+    auto body = drain_stream(stream);
+    stream.close().get();
+    download.stop().get();
+    server.stop();
+
+    iobuf_parser parser(std::move(body));
+    auto actual = parser.read_string(parser.bytes_left());
+    BOOST_REQUIRE(actual == payload);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_ranged_download_fetch_failure) {
+    http::ranged_download download(
+      [](uint64_t first, uint64_t) -> ss::future<iobuf> {
+          if (first >= 8_KiB) {
+              return ss::make_exception_future<iobuf>(
+                std::runtime_error("fetch failed"));
+          }
+          iobuf buf;
+          auto data = make_payload(4_KiB);
+          buf.append(data.data(), data.size());
+          return ss::make_ready_future<iobuf>(std::move(buf));
+      },
+      http::ranged_download_options{
+        .object_size = 64_KiB,
+        .part_size = 4_KiB,
+        .concurrency = 2,
+        .max_buffered_parts = 2,
+      });
+
+    auto stream = download.as_input_stream();
+    BOOST_REQUIRE_THROW(drain_stream(stream), std::runtime_error);
+    stream.close().get();
+    download.stop().get();
+}
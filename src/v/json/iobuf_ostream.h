@@ -0,0 +1,63 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "seastarx.h"
+
+#include <seastar/core/temporary_buffer.hh>
+
+#include <cstddef>
+
+namespace json {
+
+/// rapidjson output stream that appends into an iobuf.
+///
+/// Output is staged in fixed-size buffers that are moved into the iobuf
+/// once full, so serializing a large document performs no growth copies
+/// and the result needs no final linearization into a string.
+class iobuf_ostream {
+public:
+    using Ch = char;
+
+    explicit iobuf_ostream(iobuf& buf)
+      : _buf(buf) {}
+
+    iobuf_ostream(const iobuf_ostream&) = delete;
+    iobuf_ostream& operator=(const iobuf_ostream&) = delete;
+
+    void Put(Ch c) {
+        if (_pos == _chunk.size()) {
+            Flush();
+            _chunk = ss::temporary_buffer<char>(chunk_size);
+        }
+        _chunk.get_write()[_pos++] = c;
+    }
+
+    void Flush() {
+        if (_pos == 0) {
+            return;
+        }
+        _chunk.trim(_pos);
+        _buf.append(std::move(_chunk));
+        _pos = 0;
+    }
+
+private:
+    static constexpr size_t chunk_size = 4096;
+
+    iobuf& _buf;
+    ss::temporary_buffer<char> _chunk;
+    size_t _pos{0};
+};
+
+} // namespace json
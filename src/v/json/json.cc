@@ -11,46 +11,6 @@
 
 namespace json {
 
-void rjson_serialize(rapidjson::Writer<rapidjson::StringBuffer>& w, short v) {
-    w.Int(v);
-}
-
-void rjson_serialize(rapidjson::Writer<rapidjson::StringBuffer>& w, bool v) {
-    w.Bool(v);
-}
-
-void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w, long long v) {
-    w.Int64(v);
-}
-
-void rjson_serialize(rapidjson::Writer<rapidjson::StringBuffer>& w, int v) {
-    w.Int(v);
-}
-
-void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w, unsigned int v) {
-    w.Uint(v);
-}
-
-void rjson_serialize(rapidjson::Writer<rapidjson::StringBuffer>& w, long v) {
-    w.Int64(v);
-}
-
-void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w, unsigned long v) {
-    w.Uint64(v);
-}
-
-void rjson_serialize(rapidjson::Writer<rapidjson::StringBuffer>& w, double v) {
-    w.Double(v);
-}
-
-void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w, std::string_view v) {
-    w.String(v.data(), v.size());
-}
-
 void rjson_serialize(
   rapidjson::Writer<rapidjson::StringBuffer>& w, const ss::socket_address& v) {
     w.StartObject();
@@ -85,13 +45,6 @@ void rjson_serialize(
     w.EndObject();
 }
 
-void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w,
-  const std::chrono::milliseconds& v) {
-    uint64_t _tmp = v.count();
-    rjson_serialize(w, _tmp);
-}
-
 void rjson_serialize(
   rapidjson::Writer<rapidjson::StringBuffer>& w,
   const model::broker_endpoint& ep) {
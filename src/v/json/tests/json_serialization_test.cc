@@ -7,6 +7,8 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/iobuf_parser.h"
+#include "json/iobuf_ostream.h"
 #include "json/json.h"
 #include "seastarx.h"
 
@@ -134,3 +136,23 @@ SEASTAR_THREAD_TEST_CASE(json_serialization_test) {
 
     BOOST_TEST(res_doc["obj"].IsObject());
 }
+
+SEASTAR_THREAD_TEST_CASE(json_iobuf_ostream_test) {
+    // the last entry spans several staging chunks of the stream
+    std::vector<ss::sstring> names = {
+      ss::sstring{"foo"}, ss::sstring{"bar"}, ss::sstring(8192, 'x')};
+
+    rapidjson::StringBuffer sb;
+    rapidjson::Writer<rapidjson::StringBuffer> sb_writer(sb);
+    json::rjson_serialize(sb_writer, names);
+    const ss::sstring expected(sb.GetString(), sb.GetSize());
+
+    iobuf buf;
+    json::iobuf_ostream os{buf};
+    rapidjson::Writer<json::iobuf_ostream> writer(os);
+    json::rjson_serialize(writer, names);
+    os.Flush();
+
+    iobuf_parser parser(std::move(buf));
+    BOOST_TEST(parser.read_string(parser.bytes_left()) == expected);
+}
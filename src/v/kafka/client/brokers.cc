@@ -10,33 +10,48 @@
 #include "kafka/client/brokers.h"
 
 #include "kafka/protocol/metadata.h"
-#include "ssx/future-util.h"
+
+#include <seastar/core/future-util.hh>
 
 namespace kafka::client {
 
 ss::future<> brokers::stop() {
-    return ss::parallel_for_each(
-      std::move(_brokers),
-      [](const shared_broker_t& broker) { return broker->stop(); });
+    // settle connection attempts in flight; the ones that succeed land in
+    // _brokers and are stopped below
+    std::vector<ss::future<>> pending;
+    pending.reserve(_pending.size());
+    for (auto& p : _pending) {
+        pending.push_back(p.second.get_future()
+                            .then([](shared_broker_t) {})
+                            .handle_exception([](std::exception_ptr) {}));
+    }
+    return ss::when_all(pending.begin(), pending.end())
+      .discard_result()
+      .then([this]() {
+          return ss::parallel_for_each(
+            std::move(_brokers),
+            [](const shared_broker_t& broker) { return broker->stop(); });
+      });
 }
 
 ss::future<shared_broker_t> brokers::any() {
-    if (_brokers.empty()) {
+    if (_endpoints.empty()) {
         return ss::make_exception_future<shared_broker_t>(
           broker_error(unknown_node_id, error_code::broker_not_available));
     }
 
-    return ss::make_ready_future<shared_broker_t>(
-      *std::next(_brokers.begin(), _next_broker++ % _brokers.size()));
+    auto e_it = std::next(
+      _endpoints.begin(), _next_broker++ % _endpoints.size());
+    return get_or_connect(e_it->first, e_it->second);
 }
 
 ss::future<shared_broker_t> brokers::find(model::node_id id) {
-    auto b_it = _brokers.find(id);
-    if (b_it == _brokers.end()) {
+    auto e_it = _endpoints.find(id);
+    if (e_it == _endpoints.end()) {
         return ss::make_exception_future<shared_broker_t>(
           broker_error(id, error_code::broker_not_available));
     }
-    return ss::make_ready_future<shared_broker_t>(*b_it);
+    return get_or_connect(id, e_it->second);
 }
 
 ss::future<shared_broker_t> brokers::find(model::topic_partition tp) {
@@ -49,6 +64,39 @@ ss::future<shared_broker_t> brokers::find(model::topic_partition tp) {
     return find(l_it->second);
 }
 
+ss::future<size_t> brokers::partition_count(const model::topic& t) const {
+    auto p_it = _partitions.find(t);
+    if (p_it == _partitions.end()) {
+        return ss::make_exception_future<size_t>(partition_error(
+          model::topic_partition(t, model::partition_id(-1)),
+          error_code::unknown_topic_or_partition));
+    }
+    return ss::make_ready_future<size_t>(p_it->second);
+}
+
+ss::future<shared_broker_t>
+brokers::get_or_connect(model::node_id id, const unresolved_address& addr) {
+    if (auto b_it = _brokers.find(id); b_it != _brokers.end()) {
+        return ss::make_ready_future<shared_broker_t>(*b_it);
+    }
+
+    if (auto p_it = _pending.find(id); p_it != _pending.end()) {
+        return p_it->second.get_future();
+    }
+
+    auto fut = make_broker(id, addr)
+                 .then([this, id](shared_broker_t broker) {
+                     // metadata may have dropped the node while connecting
+                     if (_endpoints.count(id) != 0) {
+                         _brokers.emplace(broker);
+                     }
+                     return broker;
+                 })
+                 .finally([this, id]() { _pending.erase(id); });
+    auto p_it = _pending.emplace(id, std::move(fut)).first;
+    return p_it->second.get_future();
+}
+
 ss::future<> brokers::erase(model::node_id node_id) {
     if (auto b_it = _brokers.find(node_id); b_it != _brokers.end()) {
         auto broker = *b_it;
@@ -59,56 +107,43 @@ ss::future<> brokers::erase(model::node_id node_id) {
 }
 
 ss::future<> brokers::apply(metadata_response&& res) {
-    return ss::do_with(std::move(res), [this](metadata_response& res) {
-        auto new_brokers_begin = std::partition(
-          res.brokers.begin(),
-          res.brokers.end(),
-          [this](const metadata_response::broker& broker) {
-              return _brokers.count(broker.node_id);
-          });
-
-        return ssx::parallel_transform(
-                 new_brokers_begin,
-                 res.brokers.end(),
-                 [](const metadata_response::broker& b) {
-                     return make_broker(
-                       b.node_id, unresolved_address(b.host, b.port));
-                 })
-          .then([this, &res, new_brokers_begin, topics{std::move(res.topics)}](
-                  std::vector<shared_broker_t> broker_endpoints) mutable {
-              brokers_t brokers;
-              brokers.reserve(
-                broker_endpoints.size()
-                + std::distance(res.brokers.begin(), new_brokers_begin));
-              // Insert new brokers
-              for (auto& b : broker_endpoints) {
-                  brokers.emplace(std::move(b));
-              }
-              // Insert existing brokers
-              for (auto it = res.brokers.begin(); it != new_brokers_begin;
-                   ++it) {
-                  auto b = _brokers.find(it->node_id);
-                  if (b != _brokers.end()) {
-                      brokers.emplace(*b);
-                  }
-              }
-
-              leaders_t leaders;
-              for (const auto& t : topics) {
-                  for (auto const& p : t.partitions) {
-                      leaders.emplace(
-                        model::topic_partition(t.name, p.index), p.leader);
-                  }
-              }
-
-              std::swap(brokers, _brokers);
-              std::swap(leaders, _leaders);
-          });
-    });
+    endpoints_t endpoints;
+    endpoints.reserve(res.brokers.size());
+    for (const auto& b : res.brokers) {
+        endpoints.emplace(b.node_id, unresolved_address(b.host, b.port));
+    }
+
+    leaders_t leaders;
+    partitions_t partitions;
+    partitions.reserve(res.topics.size());
+    for (const auto& t : res.topics) {
+        partitions.emplace(t.name, t.partitions.size());
+        for (const auto& p : t.partitions) {
+            leaders.emplace(model::topic_partition(t.name, p.index), p.leader);
+        }
+    }
+
+    std::swap(endpoints, _endpoints);
+    std::swap(leaders, _leaders);
+    std::swap(partitions, _partitions);
+
+    // drop connections to nodes that left the cluster
+    std::vector<shared_broker_t> removed;
+    for (const auto& b : _brokers) {
+        if (_endpoints.count(b->id()) == 0) {
+            removed.push_back(b);
+        }
+    }
+    for (const auto& b : removed) {
+        _brokers.erase(b);
+    }
+    return ss::parallel_for_each(
+      std::move(removed),
+      [](const shared_broker_t& broker) { return broker->stop(); });
 }
 
 ss::future<bool> brokers::empty() const {
-    return ss::make_ready_future<bool>(_brokers.empty());
+    return ss::make_ready_future<bool>(_endpoints.empty());
 }
 
 } // namespace kafka::client
@@ -14,8 +14,10 @@
 #include "kafka/client/broker.h"
 #include "model/fundamental.h"
 #include "seastarx.h"
+#include "utils/unresolved_address.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/shared_future.hh>
 
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
@@ -25,11 +27,20 @@ namespace kafka::client {
 /// \brief during connection, the node_id isn't known.
 const model::node_id unknown_node_id{-1};
 
+/// \brief Shard-local set of broker connections.
+///
+/// Metadata only records broker endpoints; a transport is established the
+/// first time this shard talks to the broker, so every connection is owned
+/// by the shard that uses it and requests never hop cores to reach one.
 class brokers {
     using brokers_t
       = absl::flat_hash_set<shared_broker_t, broker_hash, broker_eq>;
+    using endpoints_t = absl::flat_hash_map<model::node_id, unresolved_address>;
+    using pending_t
+      = absl::flat_hash_map<model::node_id, ss::shared_future<shared_broker_t>>;
     using leaders_t
       = absl::flat_hash_map<model::topic_partition, model::node_id>;
+    using partitions_t = absl::flat_hash_map<model::topic, size_t>;
 
 public:
     brokers() = default;
@@ -53,6 +64,9 @@ public:
     /// \brief Retrieve the broker for the given topic_partition.
     ss::future<shared_broker_t> find(model::topic_partition tp);
 
+    /// \brief Retrieve the number of partitions of the given topic.
+    ss::future<size_t> partition_count(const model::topic& t) const;
+
     /// \brief Remove a broker.
     ss::future<> erase(model::node_id id);
 
@@ -63,12 +77,23 @@ public:
     ss::future<bool> empty() const;
 
 private:
+    /// \brief Return the connection for the node, establishing it on first
+    /// use. Concurrent callers share one connection attempt.
+    ss::future<shared_broker_t>
+    get_or_connect(model::node_id id, const unresolved_address& addr);
+
     /// \brief Brokers map a model::node_id to a client.
     brokers_t _brokers;
+    /// \brief Known broker endpoints from the last metadata update.
+    endpoints_t _endpoints;
+    /// \brief Connection attempts in flight, deduplicated per node.
+    pending_t _pending;
     /// \brief Next broker to select with round-robin
     size_t _next_broker{0};
     /// \brief Leaders map a partition to a model::node_id.
     leaders_t _leaders;
+    /// \brief Partition counts from the last metadata update.
+    partitions_t _partitions;
 };
 
 } // namespace kafka::client
@@ -152,6 +152,12 @@ ss::future<produce_response::partition> client::produce_record_batch(
       });
 }
 
+ss::future<size_t> client::topic_partition_count(model::topic topic) {
+    return gated_retry_with_mitigation([this, topic{std::move(topic)}]() {
+        return _brokers.partition_count(topic);
+    });
+}
+
 ss::future<fetch_response> client::fetch_partition(
   model::topic_partition tp,
   model::offset offset,
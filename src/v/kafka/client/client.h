@@ -101,6 +101,10 @@ public:
     ss::future<produce_response::partition> produce_record_batch(
       model::topic_partition tp, model::record_batch&& batch);
 
+    /// \brief Number of partitions of a topic, from the last metadata
+    /// update. An unknown topic triggers a refresh and a retry.
+    ss::future<size_t> topic_partition_count(model::topic topic);
+
     ss::future<fetch_response> fetch_partition(
       model::topic_partition tp,
       model::offset offset,
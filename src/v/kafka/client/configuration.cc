@@ -61,12 +61,26 @@ configuration::configuration()
       "Number of bytes to batch before sending to broker",
       config::required::no,
       1048576)
+  , produce_batch_total_size_bytes(
+      *this,
+      "produce_batch_total_size_bytes",
+      "Number of bytes to batch across all partitions before flushing the "
+      "largest batches",
+      config::required::no,
+      33554432)
   , produce_batch_delay(
       *this,
       "produce_batch_delay_ms",
       "Delay (in milliseconds) to wait before sending batch",
       config::required::no,
       100ms)
+  , produce_compression_type(
+      *this,
+      "produce_compression_type",
+      "Compression to apply to batches before sending to broker: none, gzip, "
+      "snappy, lz4, zstd",
+      config::required::no,
+      "none")
   , consumer_session_timeout(
       *this,
       "consumer_session_timeout_ms",
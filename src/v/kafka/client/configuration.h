@@ -32,7 +32,9 @@ struct configuration final : public config::config_store {
     config::property<std::chrono::milliseconds> retry_base_backoff;
     config::property<int32_t> produce_batch_record_count;
     config::property<int32_t> produce_batch_size_bytes;
+    config::property<int32_t> produce_batch_total_size_bytes;
     config::property<std::chrono::milliseconds> produce_batch_delay;
+    config::property<ss::sstring> produce_compression_type;
     config::property<std::chrono::milliseconds> consumer_session_timeout;
     config::property<std::chrono::milliseconds> consumer_rebalance_timeout;
     config::property<std::chrono::milliseconds> consumer_heartbeat_interval;
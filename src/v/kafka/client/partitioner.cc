@@ -0,0 +1,76 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/partitioner.h"
+
+#include "hashing/murmur.h"
+#include "vassert.h"
+
+#include <string_view>
+
+namespace kafka::client {
+
+// kafka maps the hash to a non-negative value before taking the modulus
+static model::partition_id
+to_partition(uint32_t hash, size_t partition_count) {
+    return model::partition_id(
+      int32_t((hash & 0x7fffffff) % partition_count));
+}
+
+model::partition_id
+partition_for_key(const iobuf& key, size_t partition_count) {
+    vassert(partition_count > 0, "topic without partitions");
+    return to_partition(murmur2(key), partition_count);
+}
+
+std::vector<std::optional<model::partition_id>> partitions_for_keys(
+  const std::vector<const iobuf*>& keys, size_t partition_count) {
+    std::vector<std::optional<model::partition_id>> partitions(keys.size());
+
+    std::vector<uint32_t> hashes(keys.size());
+    // small keys are overwhelmingly single-fragment; gather their views so
+    // they are hashed lane-parallel, the fragmented stragglers walk their
+    // fragments without being copied out
+    std::vector<std::string_view> views;
+    std::vector<size_t> view_idx;
+    views.reserve(keys.size());
+    view_idx.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const auto* key = keys[i];
+        if (key == nullptr) {
+            continue;
+        }
+        if (key->empty()) {
+            views.emplace_back();
+            view_idx.push_back(i);
+        } else if (std::next(key->begin()) == key->end()) {
+            const auto& frag = *key->begin();
+            views.emplace_back(frag.get(), frag.size());
+            view_idx.push_back(i);
+        } else {
+            hashes[i] = murmur2(*key);
+        }
+    }
+    std::vector<uint32_t> batched(views.size());
+    murmur2_batch(views.data(), batched.data(), views.size());
+    for (size_t j = 0; j < views.size(); ++j) {
+        hashes[view_idx[j]] = batched[j];
+    }
+
+    vassert(
+      keys.empty() || partition_count > 0, "topic without partitions");
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i] != nullptr) {
+            partitions[i] = to_partition(hashes[i], partition_count);
+        }
+    }
+    return partitions;
+}
+
+} // namespace kafka::client
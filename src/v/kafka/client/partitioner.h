@@ -0,0 +1,39 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "model/fundamental.h"
+
+#include <optional>
+#include <vector>
+
+namespace kafka::client {
+
+/// \brief Select the partition for a keyed record.
+///
+/// Kafka's default partitioning: murmur2 of the serialized key modulo the
+/// partition count. Matches the Java client so keyed records land on the
+/// same partition no matter which client produced them.
+model::partition_id
+partition_for_key(const iobuf& key, size_t partition_count);
+
+/// \brief Select partitions for a batch of record keys in one call.
+///
+/// Contiguous keys are hashed with the lane-parallel murmur2_batch;
+/// fragmented ones take the per-fragment walk. A nullptr entry stands for
+/// a record without a key and maps to std::nullopt; the caller places
+/// those with its own strategy (e.g. round-robin).
+std::vector<std::optional<model::partition_id>> partitions_for_keys(
+  const std::vector<const iobuf*>& keys, size_t partition_count);
+
+} // namespace kafka::client
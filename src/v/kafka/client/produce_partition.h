@@ -51,6 +51,14 @@ public:
         try_consume(false);
     }
 
+    /// \brief Bytes buffered for the next broker request.
+    int32_t size_bytes() const { return _size_bytes; }
+
+    /// \brief Flush buffered records without waiting for a threshold.
+    ///
+    /// Returns false if there is nothing to flush or a request is in flight.
+    bool flush() { return try_consume(true); }
+
     ss::future<> stop() {
         try_consume(true);
         _timer.cancel();
@@ -64,6 +72,7 @@ private:
         _in_flight = true;
         _record_count = 0;
         _size_bytes = 0;
+        _timer.cancel();
         return _batcher.consume();
     }
 
@@ -79,8 +88,11 @@ private:
                              || _size_bytes >= batch_size_bytes;
 
         if (!timed_out && !threshold_met) {
-            _timer.cancel();
-            _timer.arm(_config.produce_batch_delay());
+            // The first buffered record sets the linger deadline; later
+            // records join the batch without pushing it out.
+            if (!_timer.armed()) {
+                _timer.arm(_config.produce_batch_delay());
+            }
             return false;
         }
 
@@ -16,26 +16,29 @@
 #include "kafka/client/retry_with_mitigation.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/produce.h"
+#include "model/compression.h"
 #include "model/fundamental.h"
+#include "storage/parser_utils.h"
 
+#include <seastar/core/future-util.hh>
 #include <seastar/core/gate.hh>
 
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
 #include <exception>
 
 namespace kafka::client {
 
-produce_request
-make_produce_request(model::topic_partition tp, model::record_batch&& batch) {
-    std::vector<produce_request::partition> partitions;
-    partitions.emplace_back(produce_request::partition{
-      .id{tp.partition},
-      .data{},
-      .adapter = kafka_batch_adapter{
-        .v2_format = true, .valid_crc = true, .batch{std::move(batch)}}});
-
+produce_request make_produce_request(
+  absl::flat_hash_map<model::topic, std::vector<produce_request::partition>>&&
+    topic_partitions) {
     std::vector<produce_request::topic> topics;
-    topics.emplace_back(produce_request::topic{
-      .name{std::move(tp.topic)}, .partitions{std::move(partitions)}});
+    topics.reserve(topic_partitions.size());
+    for (auto& t : topic_partitions) {
+        topics.emplace_back(produce_request::topic{
+          .name{t.first}, .partitions{std::move(t.second)}});
+    }
     std::optional<ss::sstring> t_id;
     int16_t acks = -1;
     return produce_request(t_id, acks, std::move(topics));
@@ -70,28 +73,129 @@ make_produce_response(model::partition_id p_id, std::exception_ptr ex) {
 
 ss::future<produce_response::partition>
 producer::produce(model::topic_partition tp, model::record_batch&& batch) {
-    return get_context(std::move(tp))->produce(std::move(batch));
+    auto fut = get_context(std::move(tp))->produce(std::move(batch));
+    check_buffer_budget();
+    return fut;
+}
+
+void producer::check_buffer_budget() {
+    auto budget = int64_t(_config.produce_batch_total_size_bytes());
+    int64_t buffered = 0;
+    for (const auto& p : _partitions) {
+        buffered += p.second->size_bytes();
+    }
+    if (buffered <= budget) {
+        return;
+    }
+
+    // Flush the largest buffers first. A partition with a request in flight
+    // keeps its buffer until the response arrives.
+    std::vector<shared_produce_partition> pending;
+    for (const auto& p : _partitions) {
+        if (p.second->size_bytes() > 0) {
+            pending.push_back(p.second);
+        }
+    }
+    std::sort(
+      pending.begin(),
+      pending.end(),
+      [](const shared_produce_partition& lhs,
+         const shared_produce_partition& rhs) {
+          return lhs->size_bytes() > rhs->size_bytes();
+      });
+    for (const auto& p : pending) {
+        if (buffered <= budget) {
+            break;
+        }
+        auto size_bytes = p->size_bytes();
+        if (p->flush()) {
+            buffered -= size_bytes;
+        }
+    }
 }
 
 ss::future<produce_response::partition>
 producer::do_send(model::topic_partition tp, model::record_batch&& batch) {
-    return _brokers.find(tp)
-      .then([tp{std::move(tp)},
-             batch{std::move(batch)}](shared_broker_t broker) mutable {
-          return broker->dispatch(
-            make_produce_request(std::move(tp), std::move(batch)));
-      })
-      .then([](produce_response res) mutable {
-          auto topic = std::move(res.topics[0]);
-          auto partition = std::move(topic.partitions[0]);
-          if (partition.error != error_code::none) {
-              return ss::make_exception_future<produce_response::partition>(
-                partition_error(
-                  model::topic_partition(topic.name, partition.id),
-                  partition.error));
+    return _brokers.find(tp).then(
+      [this, tp{std::move(tp)},
+       batch{std::move(batch)}](shared_broker_t broker) mutable {
+          auto& staged = _staged[broker];
+          staged.emplace_back(staged_send{
+            .tp{std::move(tp)}, .batch{std::move(batch)}, .promise{}});
+          auto fut = staged.back().promise.get_future();
+          if (!std::exchange(_dispatch_scheduled, true)) {
+              // Batches staged before the dispatch task runs are consolidated
+              // into one request per broker.
+              (void)ss::later().then([this]() { dispatch_staged(); });
           }
-          return ss::make_ready_future<produce_response::partition>(
-            std::move(partition));
+          return fut;
+      });
+}
+
+void producer::dispatch_staged() {
+    _dispatch_scheduled = false;
+    auto staged = std::exchange(_staged, {});
+    for (auto& s : staged) {
+        // do_dispatch settles every staged promise; it never fails.
+        (void)do_dispatch(s.first, std::move(s.second));
+    }
+}
+
+ss::future<> producer::do_dispatch(
+  shared_broker_t broker, std::vector<staged_send> sends) {
+    absl::flat_hash_map<model::topic, std::vector<produce_request::partition>>
+      topic_partitions;
+    absl::
+      flat_hash_map<model::topic_partition, ss::promise<produce_response::partition>>
+        promises;
+    promises.reserve(sends.size());
+    for (auto& s : sends) {
+        topic_partitions[s.tp.topic].emplace_back(produce_request::partition{
+          .id{s.tp.partition},
+          .data{},
+          .adapter = kafka_batch_adapter{
+            .v2_format = true, .valid_crc = true, .batch{std::move(s.batch)}}});
+        promises.emplace(std::move(s.tp), std::move(s.promise));
+    }
+
+    return ss::do_with(
+      std::move(promises),
+      [broker{std::move(broker)},
+       req{make_produce_request(std::move(topic_partitions))}](
+        auto& promises) mutable {
+          return broker->dispatch(std::move(req))
+            .then([&promises](produce_response res) {
+                for (auto& t : res.topics) {
+                    for (auto& p : t.partitions) {
+                        auto tp = model::topic_partition(t.name, p.id);
+                        auto p_it = promises.find(tp);
+                        if (p_it == promises.end()) {
+                            vlog(
+                              kclog.error,
+                              "produce response for unstaged partition: {}",
+                              tp);
+                            continue;
+                        }
+                        if (p.error != error_code::none) {
+                            p_it->second.set_exception(
+                              partition_error(std::move(tp), p.error));
+                        } else {
+                            p_it->second.set_value(std::move(p));
+                        }
+                        promises.erase(p_it);
+                    }
+                }
+                // partitions the broker failed to echo back
+                for (auto& p : promises) {
+                    p.second.set_exception(partition_error(
+                      p.first, error_code::unknown_server_error));
+                }
+            })
+            .handle_exception([&promises](std::exception_ptr ex) {
+                for (auto& p : promises) {
+                    p.second.set_exception(ex);
+                }
+            });
       });
 }
 
@@ -104,24 +208,37 @@ producer::send(model::topic_partition tp, model::record_batch&& batch) {
       tp,
       record_count);
     auto p_id = tp.partition;
-    return ss::do_with(
-             std::move(batch),
-             [this, tp](model::record_batch& batch) mutable {
-                 return retry_with_mitigation(
-                   _config.retries(),
-                   _config.retry_base_backoff(),
-                   [this, tp{std::move(tp)}, &batch]() {
-                       return do_send(tp, batch.share());
-                   },
-                   [this](std::exception_ptr ex) {
-                       return _error_handler(std::move(ex))
-                         .handle_exception([](std::exception_ptr ex) {
-                             vlog(
-                               kclog.trace, "Error during mitigation: {}", ex);
-                             // ignore failed mitigation
-                         });
-                   });
-             })
+    return ss::futurize_invoke([this, batch{std::move(batch)}]() mutable {
+               auto type = boost::lexical_cast<model::compression>(
+                 _config.produce_compression_type());
+               if (type == model::compression::none) {
+                   return ss::make_ready_future<model::record_batch>(
+                     std::move(batch));
+               }
+               // compress once here so that retries resend the compressed
+               // payload
+               return storage::internal::compress_batch(
+                 type, std::move(batch));
+           })
+      .then([this, tp](model::record_batch batch) mutable {
+          return ss::do_with(
+            std::move(batch), [this, tp](model::record_batch& batch) mutable {
+                return retry_with_mitigation(
+                  _config.retries(),
+                  _config.retry_base_backoff(),
+                  [this, tp{std::move(tp)}, &batch]() {
+                      return do_send(tp, batch.share());
+                  },
+                  [this](std::exception_ptr ex) {
+                      return _error_handler(std::move(ex))
+                        .handle_exception([](std::exception_ptr ex) {
+                            vlog(
+                              kclog.trace, "Error during mitigation: {}", ex);
+                            // ignore failed mitigation
+                        });
+                  });
+            });
+      })
       .handle_exception([p_id](std::exception_ptr ex) {
           return make_produce_response(p_id, std::move(ex));
       })
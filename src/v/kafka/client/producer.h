@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "kafka/client/broker.h"
 #include "kafka/client/produce_batcher.h"
 #include "kafka/client/produce_partition.h"
 #include "model/fundamental.h"
@@ -49,11 +50,33 @@ public:
     }
 
 private:
+    /// \brief A partition batch awaiting a consolidated broker request.
+    struct staged_send {
+        model::topic_partition tp;
+        model::record_batch batch;
+        ss::promise<produce_response::partition> promise;
+    };
+    using staged_t = absl::flat_hash_map<
+      shared_broker_t,
+      std::vector<staged_send>,
+      broker_hash,
+      broker_eq>;
+
     ss::future<> send(model::topic_partition tp, model::record_batch&& batch);
 
     ss::future<produce_response::partition>
     do_send(model::topic_partition tp, model::record_batch&& batch);
 
+    /// \brief Flush the largest partition buffers while the bytes buffered
+    /// across all partitions exceed produce_batch_total_size_bytes.
+    void check_buffer_budget();
+
+    /// \brief Send one produce request per broker for all staged batches.
+    void dispatch_staged();
+
+    ss::future<>
+    do_dispatch(shared_broker_t broker, std::vector<staged_send> sends);
+
     auto make_consumer(model::topic_partition tp) {
         return [this, tp](model::record_batch&& batch) {
             (void)send(tp, std::move(batch));
@@ -74,6 +97,9 @@ private:
     const configuration& _config;
     absl::flat_hash_map<model::topic_partition, shared_produce_partition>
       _partitions;
+    /// \brief Batches resolved to their leader, awaiting consolidation.
+    staged_t _staged;
+    bool _dispatch_scheduled{false};
     error_handler _error_handler;
     brokers& _brokers;
 };
@@ -0,0 +1,71 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/client/partitioner.h"
+
+#include "bytes/iobuf.h"
+#include "hashing/murmur.h"
+#include "random/generators.h"
+
+#include <seastar/core/temporary_buffer.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+namespace kc = kafka::client;
+
+namespace {
+
+iobuf make_key(std::string_view data) {
+    iobuf key;
+    key.append(data.data(), data.size());
+    return key;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_partition_for_key) {
+    auto key = make_key("consumer-group-21");
+    const size_t n_partitions = 12;
+    auto expected = model::partition_id(
+      int32_t((murmur2(key) & 0x7fffffff) % n_partitions));
+    BOOST_REQUIRE_EQUAL(kc::partition_for_key(key, n_partitions), expected);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_partitions_for_keys) {
+    const size_t n_partitions = 7;
+
+    std::vector<iobuf> keys;
+    for (size_t len = 0; len < 9; ++len) {
+        keys.push_back(
+          make_key(random_generators::gen_alphanum_string(len)));
+    }
+    // a fragmented key must take the fragment walk and still agree with
+    // the single key path
+    auto data = random_generators::gen_alphanum_string(24);
+    iobuf fragmented;
+    fragmented.prepend(
+      ss::temporary_buffer<char>(data.data() + 3, data.size() - 3));
+    fragmented.prepend(ss::temporary_buffer<char>(data.data(), 3));
+    keys.push_back(std::move(fragmented));
+
+    std::vector<const iobuf*> ptrs;
+    for (const auto& k : keys) {
+        ptrs.push_back(&k);
+    }
+    // a keyless record maps to nullopt
+    ptrs.push_back(nullptr);
+
+    auto selected = kc::partitions_for_keys(ptrs, n_partitions);
+    BOOST_REQUIRE_EQUAL(selected.size(), ptrs.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        BOOST_REQUIRE(selected[i].has_value());
+        BOOST_REQUIRE_EQUAL(
+          *selected[i], kc::partition_for_key(keys[i], n_partitions));
+    }
+    BOOST_REQUIRE(!selected.back().has_value());
+}
@@ -65,3 +65,47 @@ SEASTAR_THREAD_TEST_CASE(test_produce_partition_record_count) {
     auto c_res2 = c_res2_fut.get0();
     BOOST_REQUIRE_EQUAL(c_res2.base_offset, model::offset{3});
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_partition_flush) {
+    std::vector<model::record_batch> consumed_batches;
+    auto consumer = [&consumed_batches](model::record_batch&& batch) {
+        consumed_batches.push_back(std::move(batch));
+    };
+
+    auto cfg = kc::configuration{};
+    // large, so only an explicit flush consumes
+    cfg.produce_batch_size_bytes.set_value(1024 * 1024);
+    cfg.produce_batch_record_count.set_value(1000);
+
+    kc::produce_partition producer(cfg, consumer);
+
+    auto c_res0_fut = producer.produce(make_batch(model::offset(0), 2));
+    BOOST_REQUIRE_GT(producer.size_bytes(), 0);
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 0);
+
+    BOOST_REQUIRE(producer.flush());
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 1);
+    BOOST_REQUIRE_EQUAL(consumed_batches[0].record_count(), 2);
+    BOOST_REQUIRE_EQUAL(producer.size_bytes(), 0);
+
+    // a flush with a request in flight is deferred until the response
+    auto c_res1_fut = producer.produce(make_batch(model::offset(2), 1));
+    BOOST_REQUIRE(!producer.flush());
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 1);
+
+    producer.handle_response(kafka::produce_response::partition{
+      .id{model::partition_id{42}},
+      .error = kafka::error_code::none,
+      .base_offset{model::offset{0}}});
+    auto c_res0 = c_res0_fut.get0();
+    BOOST_REQUIRE_EQUAL(c_res0.base_offset, model::offset{0});
+
+    BOOST_REQUIRE(producer.flush());
+    BOOST_REQUIRE_EQUAL(consumed_batches.size(), 2);
+    producer.handle_response(kafka::produce_response::partition{
+      .id{model::partition_id{42}},
+      .error = kafka::error_code::none,
+      .base_offset{model::offset{2}}});
+    auto c_res1 = c_res1_fut.get0();
+    BOOST_REQUIRE_EQUAL(c_res1.base_offset, model::offset{2});
+}
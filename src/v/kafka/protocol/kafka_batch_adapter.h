@@ -16,6 +16,10 @@
 #include "model/record_batch_reader.h"
 #include "utils/vint.h"
 
+#include <seastar/core/circular_buffer.hh>
+
+#include <algorithm>
+
 namespace kafka {
 
 namespace internal {
@@ -36,6 +40,49 @@ constexpr size_t kafka_header_size = sizeof(int64_t) + // base offset
 
 } // namespace internal
 
+/**
+ * Identity of a batch that already passed validation. The batch CRC covers
+ * everything below the magic byte, so together with the base offset and the
+ * wire length it pins down the exact bytes a client sent. The partition
+ * leader epoch is not part of it because the adapter does not parse it.
+ */
+struct batch_fingerprint {
+    int32_t crc;
+    model::offset base_offset;
+    int32_t batch_length;
+
+    bool operator==(const batch_fingerprint&) const = default;
+};
+
+/**
+ * Bounded history of recently validated batch fingerprints, kept per
+ * connection. Clients retrying after an ack timeout resend byte-identical
+ * batches, and retry storms tend to hit exactly when the broker is already
+ * degraded - a fingerprint hit lets the adapter skip CRC verification and
+ * record materialization for the retry.
+ */
+class batch_validation_cache {
+public:
+    static constexpr size_t max_entries = 8;
+
+    bool contains(const batch_fingerprint& fp) const {
+        return std::find(_fps.begin(), _fps.end(), fp) != _fps.end();
+    }
+
+    void add(const batch_fingerprint& fp) {
+        if (contains(fp)) {
+            return;
+        }
+        if (_fps.size() == max_entries) {
+            _fps.pop_front();
+        }
+        _fps.push_back(fp);
+    }
+
+private:
+    ss::circular_buffer<batch_fingerprint> _fps;
+};
+
 /**
  * Usage:
  *
@@ -57,7 +104,10 @@ constexpr size_t kafka_header_size = sizeof(int64_t) + // base offset
  */
 class kafka_batch_adapter {
 public:
-    iobuf adapt(iobuf&&);
+    /// when a validation cache is passed, batches whose fingerprint is found
+    /// in it skip revalidation and their fingerprint is refreshed; freshly
+    /// validated batches are added to it
+    iobuf adapt(iobuf&&, batch_validation_cache* cache = nullptr);
 
     bool v2_format;
     bool valid_crc;
@@ -66,6 +116,7 @@ public:
 
 private:
     void verify_crc(int32_t, iobuf_parser);
+    bool validate_uncompressed(const model::record_batch_header&, const iobuf&);
     model::record_batch_header read_header(iobuf_parser&);
 };
 
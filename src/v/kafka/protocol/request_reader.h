@@ -26,6 +26,7 @@
 #include <fmt/format.h>
 
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 namespace kafka {
@@ -50,6 +51,24 @@ public:
 
     ss::sstring read_string() { return do_read_string(read_int16()); }
 
+    /// borrowed alternative to read_string for transient fields that are
+    /// only inspected during decode (comparisons, lookups) and never
+    /// stored. the view is valid until the next read_string_view call or
+    /// until the reader is destroyed, whichever comes first.
+    std::string_view read_string_view() {
+        auto n = read_int16();
+        if (unlikely(n < 0)) {
+            throw std::out_of_range("Asked to read a negative byte string");
+        }
+        if (auto v = _parser.read_string_view(n); likely(v)) {
+            return *v;
+        }
+        // the string straddles a fragment boundary; materialize it into a
+        // reusable stash so the caller still gets a stable view
+        _stash = _parser.read_string(n);
+        return {_stash.data(), _stash.size()};
+    }
+
     std::optional<ss::sstring> read_nullable_string() {
         auto n = read_int16();
         if (n < 0) {
@@ -130,6 +149,7 @@ private:
     }
 
     iobuf_parser _parser;
+    ss::sstring _stash;
 };
 
 } // namespace kafka
@@ -14,8 +14,11 @@
 #include "kafka/protocol/exceptions.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
 #include "model/fundamental.h"
+#include "random/generators.h"
 #include "redpanda/tests/fixture.h"
+#include "storage/record_batch_builder.h"
 #include "storage/tests/utils/random_batch.h"
+#include "units.h"
 
 #include <seastar/core/circular_buffer.hh>
 #include <seastar/core/sstring.hh>
@@ -145,6 +148,44 @@ SEASTAR_THREAD_TEST_CASE(consumer_records_consume_batch_fail_crc) {
     BOOST_REQUIRE(!kba.valid_crc);
 }
 
+SEASTAR_THREAD_TEST_CASE(batch_reader_incremental_slices) {
+    // build a record set comfortably larger than one decode slice
+    static constexpr size_t batch_count = 24;
+    static constexpr size_t value_size = 16_KiB;
+    ss::circular_buffer<model::record_batch> input;
+    auto offset = base_offset;
+    for (size_t i = 0; i < batch_count; ++i) {
+        storage::record_batch_builder builder(raft::data_batch_type, offset);
+        builder.add_raw_kv(
+          bytes_to_iobuf(random_generators::get_bytes(16)),
+          bytes_to_iobuf(random_generators::get_bytes(value_size)));
+        auto batch = std::move(builder).build();
+        offset = batch.last_offset() + model::offset(1);
+        input.push_back(std::move(batch));
+    }
+    const auto expected_last_offset = input.back().last_offset();
+
+    auto mem_res = model::make_memory_record_batch_reader(std::move(input))
+                     .consume(
+                       kafka::kafka_batch_serializer{}, model::no_timeout)
+                     .get();
+
+    auto crs = kafka::batch_reader(std::move(mem_res.data));
+    size_t slices = 0;
+    model::offset last_offset{};
+    while (!crs.is_end_of_stream()) {
+        auto st = crs.do_load_slice(model::no_timeout).get0();
+        auto& batches = std::get<model::record_batch_reader::data_t>(st);
+        BOOST_REQUIRE(!batches.empty());
+        last_offset = batches.back().last_offset();
+        ++slices;
+    }
+
+    // the response must have been delivered incrementally, in order
+    BOOST_REQUIRE_GE(slices, 2);
+    BOOST_REQUIRE_EQUAL(last_offset, expected_last_offset);
+}
+
 SEASTAR_THREAD_TEST_CASE(batch_reader_record_batch_reader_impl) {
     auto ctx = make_context(base_offset, many_batches);
 
@@ -0,0 +1,295 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/kafka_batch_adapter.h"
+#include "kafka/protocol/list_offsets.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/protocol/request_reader.h"
+#include "kafka/protocol/response_writer.h"
+#include "kafka/protocol/response_writer_utils.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "random/generators.h"
+#include "storage/tests/utils/random_batch.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <map>
+
+/*
+ * Codec benchmarks for the kafka wire protocol. The corpus is generated with
+ * the same writers that produce real wire payloads, so every measured decode
+ * consumes byte-exact kafka frames. Latency and allocations per request are
+ * reported per api and per version boundary - the interesting versions are
+ * the ones that change the wire layout.
+ */
+
+namespace {
+
+kafka::produce_request make_produce_request(model::record_batch batch) {
+    kafka::produce_request::partition p{.id = model::partition_id(0)};
+    p.adapter.batch = std::move(batch);
+    std::vector<kafka::produce_request::topic> topics;
+    topics.push_back(kafka::produce_request::topic{
+      .name = model::topic("bench-topic"),
+      .partitions = {},
+    });
+    topics.back().partitions.push_back(std::move(p));
+    return {std::nullopt, -1, std::move(topics)};
+}
+
+} // namespace
+
+/*
+ * produce - request encode plus the batch adapter, which dominates produce
+ * decode: crc verification and conversion of the client batch into the
+ * internal record batch.
+ */
+struct produce_bench {
+    static constexpr size_t records = 10;
+
+    produce_bench()
+      : _batch(storage::test::make_random_batch(
+        model::offset(0), records, false /*no compression*/)) {
+        kafka::response_writer w(_wire);
+        kafka::writer_serialize_batch(w, _batch.share());
+    }
+
+    model::record_batch _batch;
+    iobuf _wire;
+    kafka::batch_validation_cache _cache;
+};
+
+PERF_TEST_F(produce_bench, encode_request_v7) {
+    auto req = make_produce_request(_batch.share());
+    iobuf out;
+    kafka::response_writer w(out);
+    perf_tests::start_measuring_time();
+    req.encode(w, kafka::api_version(7));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(out);
+}
+
+PERF_TEST_F(produce_bench, adapt_batch) {
+    kafka::kafka_batch_adapter kba;
+    auto rem = kba.adapt(_wire.share(0, _wire.size_bytes()));
+    perf_tests::do_not_optimize(rem);
+    perf_tests::do_not_optimize(kba);
+}
+
+PERF_TEST_F(produce_bench, adapt_batch_retry_hit) {
+    // the first sample populates the cache, every subsequent one measures
+    // the fingerprint fast path a byte-identical client retry takes
+    kafka::kafka_batch_adapter kba;
+    auto rem = kba.adapt(_wire.share(0, _wire.size_bytes()), &_cache);
+    perf_tests::do_not_optimize(rem);
+    perf_tests::do_not_optimize(kba);
+}
+
+/*
+ * fetch - request encode at the version boundaries that change the layout:
+ * v4 (isolation level) and v10 (sessions, epochs and forgotten topics).
+ */
+struct fetch_bench {
+    static constexpr size_t topics = 10;
+    static constexpr size_t partitions = 4;
+
+    fetch_bench() {
+        _request.replica_id = model::node_id(-1);
+        _request.max_wait_time = std::chrono::milliseconds(500);
+        _request.min_bytes = 1;
+        for (size_t t = 0; t < topics; ++t) {
+            kafka::fetch_request::topic topic{
+              .name = model::topic(fmt::format("bench-topic-{}", t)),
+              .partitions = {},
+            };
+            for (size_t p = 0; p < partitions; ++p) {
+                topic.partitions.push_back(kafka::fetch_request::partition{
+                  .id = model::partition_id(p),
+                  .fetch_offset = model::offset(9999),
+                  .partition_max_bytes = 1 << 20,
+                });
+            }
+            _request.topics.push_back(std::move(topic));
+        }
+    }
+
+    kafka::fetch_request _request;
+};
+
+PERF_TEST_F(fetch_bench, encode_request_v4) {
+    iobuf out;
+    kafka::response_writer w(out);
+    perf_tests::start_measuring_time();
+    _request.encode(w, kafka::api_version(4));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(out);
+}
+
+PERF_TEST_F(fetch_bench, encode_request_v10) {
+    iobuf out;
+    kafka::response_writer w(out);
+    perf_tests::start_measuring_time();
+    _request.encode(w, kafka::api_version(10));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(out);
+}
+
+/*
+ * metadata - request encode for a full topic list, v1 and v8 (the
+ * authorized-operations flags).
+ */
+struct metadata_bench {
+    static constexpr size_t topics = 50;
+
+    metadata_bench() {
+        std::vector<model::topic> topic_list;
+        topic_list.reserve(topics);
+        for (size_t t = 0; t < topics; ++t) {
+            topic_list.emplace_back(fmt::format("bench-topic-{}", t));
+        }
+        _request.topics = std::move(topic_list);
+    }
+
+    kafka::metadata_request _request;
+};
+
+PERF_TEST_F(metadata_bench, encode_request_v1) {
+    iobuf out;
+    kafka::response_writer w(out);
+    perf_tests::start_measuring_time();
+    _request.encode(w, kafka::api_version(1));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(out);
+}
+
+PERF_TEST_F(metadata_bench, encode_request_v8) {
+    iobuf out;
+    kafka::response_writer w(out);
+    perf_tests::start_measuring_time();
+    _request.encode(w, kafka::api_version(8));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(out);
+}
+
+/*
+ * list_offsets - a schemata-generated codec, exercised on both sides. the
+ * decode corpus is encoded once per version in the fixture; v1 and v5 span
+ * the layout changes (isolation level at v2, leader epoch at v4).
+ */
+struct list_offsets_bench {
+    static constexpr size_t topics = 20;
+
+    list_offsets_bench() {
+        for (auto v : {kafka::api_version(1), kafka::api_version(5)}) {
+            auto req = make_request();
+            iobuf out;
+            kafka::response_writer w(out);
+            req.encode(w, v);
+            _corpus.emplace(v(), std::move(out));
+        }
+    }
+
+    static kafka::list_offsets_request make_request() {
+        kafka::list_offsets_request req;
+        req.data.replica_id = model::node_id(-1);
+        for (size_t t = 0; t < topics; ++t) {
+            kafka::list_offset_topic topic{
+              .name = model::topic(fmt::format("bench-topic-{}", t)),
+              .partitions = {},
+            };
+            topic.partitions.push_back(kafka::list_offset_partition{
+              .partition_index = model::partition_id(0),
+              .timestamp = kafka::list_offsets_request::latest_timestamp,
+            });
+            req.data.topics.push_back(std::move(topic));
+        }
+        return req;
+    }
+
+    size_t decode_one(kafka::api_version v) {
+        auto& wire = _corpus.at(v());
+        kafka::request_reader r(wire.share(0, wire.size_bytes()));
+        kafka::list_offsets_request req;
+        perf_tests::start_measuring_time();
+        req.decode(r, v);
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(req);
+        return 1;
+    }
+
+    size_t encode_one(kafka::api_version v) {
+        auto req = make_request();
+        iobuf out;
+        kafka::response_writer w(out);
+        perf_tests::start_measuring_time();
+        req.encode(w, v);
+        perf_tests::stop_measuring_time();
+        perf_tests::do_not_optimize(out);
+        return 1;
+    }
+
+    std::map<int16_t, iobuf> _corpus;
+};
+
+PERF_TEST_F(list_offsets_bench, encode_request_v1) {
+    return encode_one(kafka::api_version(1));
+}
+
+PERF_TEST_F(list_offsets_bench, encode_request_v5) {
+    return encode_one(kafka::api_version(5));
+}
+
+PERF_TEST_F(list_offsets_bench, decode_request_v1) {
+    return decode_one(kafka::api_version(1));
+}
+
+PERF_TEST_F(list_offsets_bench, decode_request_v5) {
+    return decode_one(kafka::api_version(5));
+}
+
+/*
+ * request_reader/response_writer primitives - the per-field floor every
+ * codec above is built out of.
+ */
+struct primitives_bench {
+    primitives_bench() {
+        kafka::response_writer w(_wire);
+        for (size_t i = 0; i < fields; ++i) {
+            w.write(int32_t(i));
+            w.write(ss::sstring("bench-string-value"));
+        }
+    }
+
+    static constexpr size_t fields = 64;
+    iobuf _wire;
+};
+
+PERF_TEST_F(primitives_bench, read_int32_and_string) {
+    kafka::request_reader r(_wire.share(0, _wire.size_bytes()));
+    for (size_t i = 0; i < fields; ++i) {
+        perf_tests::do_not_optimize(r.read_int32());
+        perf_tests::do_not_optimize(r.read_string());
+    }
+    return fields;
+}
+
+PERF_TEST_F(primitives_bench, write_int32_and_string) {
+    iobuf out;
+    kafka::response_writer w(out);
+    for (size_t i = 0; i < fields; ++i) {
+        w.write(int32_t(i));
+        w.write(ss::sstring("bench-string-value"));
+    }
+    perf_tests::do_not_optimize(out);
+    return fields;
+}
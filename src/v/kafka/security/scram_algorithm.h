@@ -15,6 +15,10 @@
 #include "kafka/server/logger.h"
 #include "random/generators.h"
 
+#include <seastar/core/do_with.hh>
+#include <seastar/core/future-util.hh>
+#include <seastar/core/future.hh>
+
 #include <absl/container/node_hash_map.h>
 
 /**
@@ -209,42 +213,82 @@ public:
     /**
      * helper for building credentials either for building test cases or
      * computing credentials to be stored based on client requests.
+     *
+     * The password derivation iterates the mac thousands of times, so it is
+     * futurized and periodically yields control back to the reactor rather
+     * than monopolizing the shard for the whole chain.
      */
-    static scram_credential
+    static ss::future<scram_credential>
     make_credentials(const ss::sstring& password, int iterations) {
         bytes salt = random_generators::get_bytes(SaltSize);
-        bytes salted_password = salt_password(password, salt, iterations);
-        auto clientkey = client_key(salted_password);
-        auto storedkey = stored_key(clientkey);
-        auto serverkey = server_key(salted_password);
-        return scram_credential(
-          std::move(salt),
-          std::move(serverkey),
-          std::move(storedkey),
-          iterations);
+        return salt_password(password, salt, iterations)
+          .then([salt, iterations](bytes salted_password) mutable {
+              auto clientkey = client_key(salted_password);
+              auto storedkey = stored_key(clientkey);
+              auto serverkey = server_key(salted_password);
+              return scram_credential(
+                std::move(salt),
+                std::move(serverkey),
+                std::move(storedkey),
+                iterations);
+          });
     }
 
 private:
-    static bytes hi(bytes_view str, bytes_view salt, int iterations) {
-        MacType mac(str);
-        mac.update(salt);
-        mac.update(std::array<char, 4>{0, 0, 0, 1});
-        auto u1 = mac.reset();
-        auto prev = u1;
-        auto result = u1;
-        for (int i = 2; i <= iterations; i++) {
-            mac.update(prev);
-            auto ui = mac.reset();
-            result = result ^ ui;
-            prev = ui;
-        }
-        return bytes(result.begin(), result.end());
+    using digest_type = decltype(std::declval<MacType&>().reset());
+
+    /*
+     * number of mac iterations computed per reactor task. each iteration is
+     * a single digest-sized hmac invocation, so a block stays well within
+     * the task quota.
+     */
+    static constexpr int hi_iterations_per_task = 256;
+
+    /*
+     * the Hi function from the rfc. each iteration depends on the previous
+     * one so the chain cannot be parallelized, but it is split into fixed
+     * size blocks with reactor preemption points in between.
+     */
+    static ss::future<bytes> hi(bytes str, bytes salt, int iterations) {
+        struct chain_state {
+            chain_state(bytes_view key, bytes_view salt)
+              : mac(key) {
+                mac.update(salt);
+                mac.update(std::array<char, 4>{0, 0, 0, 1});
+                result = mac.reset();
+                prev = result;
+            }
+            MacType mac;
+            digest_type prev;
+            digest_type result;
+            int i = 2;
+        };
+        auto state = std::make_unique<chain_state>(str, salt);
+        return ss::do_with(
+          std::move(state), [iterations](std::unique_ptr<chain_state>& st) {
+              return ss::do_until(
+                       [&st, iterations] { return st->i > iterations; },
+                       [&st, iterations] {
+                           const auto block_end = std::min(
+                             st->i + hi_iterations_per_task, iterations + 1);
+                           for (; st->i < block_end; ++st->i) {
+                               st->mac.update(st->prev);
+                               auto ui = st->mac.reset();
+                               st->result = st->result ^ ui;
+                               st->prev = ui;
+                           }
+                           return ss::now();
+                       })
+                .then([&st] {
+                    return bytes(st->result.begin(), st->result.end());
+                });
+          });
     }
 
-    static bytes salt_password(
-      const ss::sstring& password, bytes_view salt, int iterations) {
+    static ss::future<bytes> salt_password(
+      const ss::sstring& password, bytes salt, int iterations) {
         bytes password_bytes(password.begin(), password.end());
-        return hi(password_bytes, salt, iterations);
+        return hi(std::move(password_bytes), std::move(salt), iterations);
     }
 
     static bytes client_key(bytes_view salted_password) {
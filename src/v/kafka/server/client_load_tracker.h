@@ -0,0 +1,50 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+#include "utils/space_saving.h"
+
+#include <seastar/core/sstring.hh>
+
+namespace kafka {
+
+/// Shard-local top-k sketches over per-client-id request counts and
+/// request bytes, fed with one increment per dispatched request and read
+/// out through the admin API under /v1/debug/hot_keys. The counterpart of
+/// cluster::partition_load_tracker for the "which client is doing this"
+/// half of the question.
+class client_load_tracker {
+public:
+    /// client ids tracked per sketch per shard
+    static constexpr size_t capacity = 128;
+
+    using sketch_type = space_saving<ss::sstring>;
+
+    void record_request(const ss::sstring& client_id, uint64_t bytes) {
+        _requests.record(client_id);
+        _bytes.record(client_id, bytes);
+    }
+
+    const sketch_type& requests() const { return _requests; }
+    const sketch_type& bytes() const { return _bytes; }
+
+private:
+    sketch_type _requests{capacity};
+    sketch_type _bytes{capacity};
+};
+
+inline client_load_tracker& local_client_load_tracker() {
+    static thread_local client_load_tracker tracker;
+    return tracker;
+}
+
+} // namespace kafka
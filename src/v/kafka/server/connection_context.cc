@@ -11,38 +11,69 @@
 #include "kafka/server/connection_context.h"
 
 #include "config/configuration.h"
+#include "kafka/server/client_load_tracker.h"
 #include "kafka/server/protocol.h"
 #include "kafka/server/protocol_utils.h"
 #include "kafka/server/quota_manager.h"
 #include "kafka/server/request_context.h"
+#include "resource_mgmt/memory_groups.h"
 
 #include <seastar/core/scattered_message.hh>
 #include <seastar/core/sleep.hh>
+#include <seastar/core/when_all.hh>
+#include <seastar/core/with_scheduling_group.hh>
+
+#include <vector>
 
 namespace kafka {
 
 ss::future<> connection_context::process_one_request() {
-    return parse_size(_rs.conn->input())
-      .then([this](std::optional<size_t> sz) mutable {
-          if (!sz) {
-              return ss::make_ready_future<>();
-          }
-          return parse_header(_rs.conn->input())
-            .then(
-              [this, s = sz.value()](std::optional<request_header> h) mutable {
-                  _rs.probe().request_received();
-                  _rs.probe().add_bytes_received(s);
-                  if (!h) {
-                      vlog(
-                        klog.debug,
-                        "could not parse header from client: {}",
-                        _rs.conn->addr);
-                      _rs.probe().header_corrupted();
-                      return ss::make_ready_future<>();
-                  }
-                  return dispatch_method_once(std::move(h.value()), s);
-              });
-      });
+    return _recv.ensure(sizeof(int32_t)).then([this](bool have_size) {
+        if (!have_size) {
+            return ss::make_ready_future<>();
+        }
+        iobuf_parser size_parser(_recv.consume_shared(sizeof(int32_t)));
+        auto size = size_parser.consume_be_type<int32_t>();
+        if (unlikely(size < 0)) {
+            throw std::runtime_error("kafka request size is negative");
+        }
+        /*
+         * pull the whole frame into the receive buffer before dispatching.
+         * pipelined requests usually arrive in the same socket chunk, so
+         * the frame - header and payload alike - is sliced out as shared
+         * views with no per-request read or copy.
+         */
+        return _recv.ensure(size_t(size)).then([this,
+                                                s = size_t(size)](bool ok) {
+            _rs.probe().request_received();
+            _rs.probe().add_bytes_received(s);
+            _load.requests++;
+            _load.bytes_received += s;
+            if (!ok) {
+                vlog(
+                  klog.debug,
+                  "truncated request from client: {}",
+                  _rs.conn->addr);
+                _rs.probe().header_corrupted();
+                return ss::make_ready_future<>();
+            }
+            iobuf_parser frame(_recv.consume_shared(s));
+            auto h = parse_header(frame);
+            if (!h) {
+                vlog(
+                  klog.debug,
+                  "could not parse header from client: {}",
+                  _rs.conn->addr);
+                _rs.probe().header_corrupted();
+                return ss::make_ready_future<>();
+            }
+            // a complete header means the tls handshake, if any, is behind
+            // us - free the slot for the next accept
+            _rs.conn->release_handshake_units();
+            return dispatch_method_once(
+              std::move(h.value()), frame.share(frame.bytes_left()), s);
+        });
+    });
 }
 
 bool connection_context::is_finished_parsing() const {
@@ -67,8 +98,8 @@ connection_context::throttle_request(
       client_id, request_size);
 
     auto fut = ss::now();
-    if (!delay.first_violation) {
-        fut = ss::sleep_abortable(delay.duration, _rs.abort_source());
+    if (!delay.first_violation && delay.duration.count() > 0) {
+        fut = park_throttled(delay.duration);
     }
     return fut
       .then(
@@ -82,6 +113,40 @@ connection_context::throttle_request(
       });
 }
 
+/**
+ * Park a throttled request on the protocol's per-shard timing wheel until
+ * its delay elapses. A throttle storm - thousands of clients tripping their
+ * quota at once - then costs one list insert per request and a single
+ * periodic timer for the whole shard instead of a reactor timer apiece,
+ * and requests sharing a tick are released together so their responses
+ * flush in batches per connection.
+ */
+ss::future<> connection_context::park_throttled(ss::lowres_clock::duration d) {
+    struct parked_request {
+        ss::promise<> released;
+        timer_wheel<ss::lowres_clock>::entry entry;
+        std::optional<ss::abort_source::subscription> sub;
+    };
+    return ss::do_with(parked_request{}, [this, d](parked_request& p) {
+        // release early on shutdown so a long throttle delay cannot hold
+        // the connection open
+        auto op_sub = _rs.abort_source().subscribe([&p]() noexcept {
+            if (p.entry.armed()) {
+                p.entry.cancel();
+                p.released.set_value();
+            }
+        });
+        if (!op_sub) {
+            // already aborted
+            return ss::now();
+        }
+        p.sub = std::move(*op_sub);
+        p.entry.set_callback([&p] { p.released.set_value(); });
+        _proto.throttle_wheel().arm(p.entry, ss::lowres_clock::now() + d);
+        return p.released.get_future();
+    });
+}
+
 ss::future<ss::semaphore_units<>>
 connection_context::reserve_request_units(size_t size) {
     // Allow for extra copies and bookkeeping
@@ -93,48 +158,66 @@ connection_context::reserve_request_units(size_t size) {
           size,
           mem_estimate));
     }
-    auto fut = ss::get_units(_rs.memory(), mem_estimate);
-    if (_rs.memory().waiters()) {
-        _rs.probe().waiting_for_available_memory();
+    // a reservation larger than the shard budget can never be granted;
+    // clamp it so an oversized request drains the budget and runs alone
+    // instead of deadlocking its connection
+    mem_estimate = std::min(mem_estimate, memory_groups::kafka_total_memory());
+    if (auto units = ss::try_get_units(_rs.memory(), mem_estimate); units) {
+        return ss::make_ready_future<ss::semaphore_units<>>(
+          std::move(*units));
     }
-    return fut;
+    // over budget: queue for the reservation. the connection parses its
+    // next request only after this one is granted, so each connection has
+    // at most one waiter and the fifo grant order rotates fairly across
+    // connections
+    _rs.probe().waiting_for_available_memory();
+    auto start = ss::lowres_clock::now();
+    return ss::get_units(_rs.memory(), mem_estimate)
+      .then([this, start](ss::semaphore_units<> units) {
+          _rs.probe().add_memory_throttle_wait(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+              ss::lowres_clock::now() - start));
+          return units;
+      });
 }
 
-ss::future<>
-connection_context::dispatch_method_once(request_header hdr, size_t size) {
+ss::future<> connection_context::dispatch_method_once(
+  request_header hdr, iobuf buf, size_t size) {
+    {
+        auto client = hdr.client_id.value_or(
+          std::string_view("unset-client-id"));
+        local_client_load_tracker().record_request(
+          ss::sstring(client.data(), client.size()), size);
+    }
     return throttle_request(hdr.client_id, size)
-      .then([this, hdr = std::move(hdr), size](session_resources sres) mutable {
+      .then([this, hdr = std::move(hdr), buf = std::move(buf)](
+              session_resources sres) mutable {
           if (_rs.abort_requested()) {
               // protect against shutdown behavior
-              return ss::make_ready_future<>();
+              return;
           }
-          auto remaining = size - sizeof(raw_request_header)
-                           - hdr.client_id_buffer.size();
-          return read_iobuf_exactly(_rs.conn->input(), remaining)
-            .then([this, hdr = std::move(hdr), sres = std::move(sres)](
-                    iobuf buf) mutable {
-                if (_rs.abort_requested()) {
-                    // _proto._cntrl etc might not be alive
-                    return;
+          auto self = shared_from_this();
+          auto rctx = request_context(
+            self, std::move(hdr), std::move(buf), sres.backpressure_delay);
+          _dispatches_in_flight++;
+          // background process this one full request
+          (void)ss::with_gate(
+            _rs.conn_gate(),
+            [this, rctx = std::move(rctx)]() mutable {
+                return do_process(std::move(rctx));
+            })
+            .handle_exception([self](std::exception_ptr e) {
+                vlog(klog.info, "Detected error processing request: {}", e);
+                self->_rs.conn->shutdown_input();
+            })
+            .finally([s = std::move(sres), self] {
+                // with nothing in flight and every response flushed
+                // no pipelined request can reference arena memory
+                if (
+                  --self->_dispatches_in_flight == 0
+                  && self->_responses.empty()) {
+                    self->_request_arena.reset();
                 }
-                auto self = shared_from_this();
-                auto rctx = request_context(
-                  self,
-                  std::move(hdr),
-                  std::move(buf),
-                  sres.backpressure_delay);
-                // background process this one full request
-                (void)ss::with_gate(
-                  _rs.conn_gate(),
-                  [this, rctx = std::move(rctx)]() mutable {
-                      return do_process(std::move(rctx));
-                  })
-                  .handle_exception([self](std::exception_ptr e) {
-                      vlog(
-                        klog.info, "Detected error processing request: {}", e);
-                      self->_rs.conn->shutdown_input();
-                  })
-                  .finally([s = std::move(sres), self] {});
             });
       });
 }
@@ -143,10 +226,23 @@ ss::future<> connection_context::do_process(request_context ctx) {
     const auto correlation = ctx.header().correlation;
     const sequence_id seq = _seq_idx;
     _seq_idx = _seq_idx + sequence_id(1);
-    return kafka::process_request(std::move(ctx), _proto.smp_group())
+    // hop into the scheduling group of the request's api class; responses
+    // are sequenced below in the connection's own group
+    auto sg = _proto.scheduling_group_for(ctx.header().key);
+    return ss::with_scheduling_group(
+             sg,
+             [this, ctx = std::move(ctx)]() mutable {
+                 return kafka::process_request(
+                   std::move(ctx), _proto.smp_group());
+             })
       .then([this, seq, correlation](response_ptr r) mutable {
           r->set_correlation(correlation);
-          _responses.insert({seq, std::move(r)});
+          _responses.insert(
+            {seq,
+             sequenced_response{
+               .response = std::move(r),
+               .completed_at = ss::lowres_clock::now(),
+             }});
           return process_next_response();
       });
 }
@@ -161,7 +257,10 @@ ss::future<> connection_context::process_next_response() {
         // found one; increment counter
         _next_response = _next_response + sequence_id(1);
 
-        auto r = std::move(it->second);
+        auto r = std::move(it->second.response);
+        _rs.probe().add_response_ordering_wait(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            ss::lowres_clock::now() - it->second.completed_at));
         _responses.erase(it);
         _rs.probe().request_completed();
 
@@ -170,10 +269,8 @@ ss::future<> connection_context::process_next_response() {
               ss::stop_iteration::no);
         }
 
-        auto msg = response_as_scattered(std::move(r));
-        _rs.probe().add_bytes_sent(msg.size());
         try {
-            return _rs.conn->write(std::move(msg)).then([] {
+            return write_response(std::move(r)).then([] {
                 return ss::make_ready_future<ss::stop_iteration>(
                   ss::stop_iteration::no);
             });
@@ -188,4 +285,34 @@ ss::future<> connection_context::process_next_response() {
     });
 }
 
+ss::future<> connection_context::write_response(response_ptr r) {
+    const auto size = r->buf().size_bytes() + sizeof(raw_response_header);
+    _rs.probe().add_bytes_sent(size);
+    _load.bytes_sent += size;
+    if (
+      size <= response_write_chunk_bytes
+      || r.get_owner_shard() != ss::this_shard_id()) {
+        // a foreign response has to be destroyed on its home shard as one
+        // unit, which is what the scattered message's deleter does
+        return _rs.conn->write(response_as_scattered(std::move(r)));
+    }
+    /*
+     * a large response - a max-bytes fetch can run to 100MB - is broken
+     * into chunk-sized scattered messages, each owning only its share of
+     * the buffer, so the memory held for an in-flight response drains as
+     * the socket accepts it instead of staying at peak until the last
+     * byte is written. all chunks are queued in one batch here: the
+     * output stream's write semaphore is fifo, so a concurrently flushed
+     * response cannot interleave between them
+     */
+    auto chunks = response_as_write_chunks(
+      std::move(r), response_write_chunk_bytes);
+    std::vector<ss::future<>> writes;
+    writes.reserve(chunks.size());
+    for (auto& chunk : chunks) {
+        writes.push_back(_rs.conn->write(std::move(chunk)));
+    }
+    return ss::when_all_succeed(writes.begin(), writes.end());
+}
+
 } // namespace kafka
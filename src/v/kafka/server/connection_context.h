@@ -9,11 +9,14 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "kafka/protocol/kafka_batch_adapter.h"
 #include "kafka/security/sasl_authentication.h"
 #include "kafka/server/protocol.h"
+#include "kafka/server/recv_buffer.h"
 #include "kafka/server/response.h"
 #include "rpc/server.h"
 #include "seastarx.h"
+#include "utils/arena.h"
 #include "utils/hdr_hist.h"
 #include "utils/named_type.h"
 
@@ -38,7 +41,8 @@ public:
       protocol& p, rpc::server::resources&& r, sasl_server sasl) noexcept
       : _proto(p)
       , _rs(std::move(r))
-      , _sasl(std::move(sasl)) {}
+      , _sasl(std::move(sasl))
+      , _recv(_rs.conn->input()) {}
 
     ~connection_context() noexcept = default;
     connection_context(const connection_context&) = delete;
@@ -53,6 +57,28 @@ public:
     ss::future<> process_one_request();
     bool is_finished_parsing() const;
 
+    /// scratch space for per-request decode state; reset wholesale once
+    /// the connection has no requests in flight, which is the earliest
+    /// point where no pipelined request can still reference it
+    arena& request_arena() { return _request_arena; }
+
+    /// per-connection load accounting. connection cost is wildly unequal
+    /// across clients, so the shard-level aggregates alone can't explain a
+    /// hot shard; these counters identify the expensive connections
+    struct load_stats {
+        uint64_t requests{0};
+        uint64_t bytes_received{0};
+        uint64_t bytes_sent{0};
+        ss::lowres_clock::time_point established_at{ss::lowres_clock::now()};
+    };
+
+    /// fingerprints of batches this connection produced recently, so that a
+    /// retry after an ack timeout skips batch revalidation
+    batch_validation_cache& batch_validation() { return _batch_validation; }
+
+    const load_stats& load() const { return _load; }
+    const ss::socket_address& client_addr() const { return _rs.conn->addr; }
+
 private:
     // used to pass around some internal state
     struct session_resources {
@@ -64,17 +90,33 @@ private:
     /// called by throttle_request
     ss::future<ss::semaphore_units<>> reserve_request_units(size_t size);
 
+    /// park a throttled request on the protocol's timing wheel
+    ss::future<> park_throttled(ss::lowres_clock::duration);
+
     /// apply correct backpressure sequence
     ss::future<session_resources>
     throttle_request(std::optional<std::string_view>, size_t sz);
 
-    ss::future<> dispatch_method_once(request_header, size_t sz);
+    ss::future<> dispatch_method_once(request_header, iobuf, size_t sz);
     ss::future<> process_next_response();
     ss::future<> do_process(request_context);
 
+    /// write one response to the socket, streaming large responses in
+    /// bounded chunks so their memory is released as the socket drains
+    ss::future<> write_response(response_ptr);
+
 private:
     using sequence_id = named_type<uint64_t, struct kafka_protocol_sequence>;
-    using map_t = absl::flat_hash_map<sequence_id, response_ptr>;
+
+    // requests execute in parallel but responses must flush in request
+    // order; a response completed out of order parks here until its turn
+    // and the timestamp measures how long it was blocked behind slower
+    // requests ahead of it
+    struct sequenced_response {
+        response_ptr response;
+        ss::lowres_clock::time_point completed_at;
+    };
+    using map_t = absl::flat_hash_map<sequence_id, sequenced_response>;
 
     protocol& _proto;
     rpc::server::resources _rs;
@@ -82,6 +124,19 @@ private:
     sequence_id _seq_idx;
     map_t _responses;
     sasl_server _sasl;
+    arena _request_arena{max_request_arena_bytes};
+    batch_validation_cache _batch_validation;
+    size_t _dispatches_in_flight{0};
+    load_stats _load;
+    recv_buffer _recv;
+
+    static constexpr size_t max_request_arena_bytes = 128 * 1024;
+
+    /// responses larger than this stream out in chunks of this size. it
+    /// matches the output stream's zero-copy buffer so a chunk is still
+    /// handed to the tcp stack as one unit
+    static constexpr size_t response_write_chunk_bytes
+      = rpc::batched_output_stream::default_stream_buffer_size;
 };
 
 } // namespace kafka
@@ -28,6 +28,13 @@ struct fetch_partition {
     int32_t max_bytes;
     model::offset fetch_offset;
     model::offset high_watermark;
+    /*
+     * ntp (with the materialized source resolved) derived from topic and
+     * partition. it is computed once when the partition joins a fetch session
+     * so that incremental fetches reuse it instead of re-deriving it for
+     * every request. disengaged for sessionless fetches.
+     */
+    std::optional<model::materialized_ntp> ntp;
 };
 /**
  * Map of partitions that is kept by fetch session. This map is using intrusive
@@ -98,7 +105,9 @@ private:
 
     static auto make_partition_iterator(io_list_t::const_iterator it) {
         return boost::iterators::make_transform_iterator(
-          it, [](const entry& e) { return e.partition; });
+          it, [](const entry& e) -> const kafka::fetch_partition& {
+              return e.partition;
+          });
     }
 
 public:
@@ -221,6 +230,8 @@ private:
     model::timeout_clock::time_point _last_used;
     fetch_session_epoch _epoch;
     bool _locked;
+    // links the session into the cache lru list, auto unlinks on destruction
+    intrusive_list_hook _lru_hook;
 };
 
 using fetch_session_ptr = ss::lw_shared_ptr<fetch_session>;
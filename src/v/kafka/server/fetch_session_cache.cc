@@ -5,6 +5,7 @@
 #include "kafka/server/logger.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
+#include "model/namespace.h"
 #include "model/timeout_clock.h"
 #include "prometheus/prometheus_sanitize.h"
 
@@ -14,13 +15,17 @@ namespace kafka {
 
 static fetch_partition make_fetch_partition(
   const model::topic& tp, const fetch_request::partition& p) {
-    return fetch_partition{
+    fetch_partition fp{
       .topic = tp,
       .partition = p.id,
       .max_bytes = p.partition_max_bytes,
       .fetch_offset = p.fetch_offset,
       .high_watermark = model::offset(-1),
     };
+    // resolve the ntp once, here, so that every incremental fetch served from
+    // the session reuses it
+    fp.ntp.emplace(model::ntp(model::kafka_namespace, tp, p.id));
+    return fp;
 }
 
 void update_fetch_session(fetch_session& session, const fetch_request& req) {
@@ -104,6 +109,7 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
 
         vlog(klog.info, "fetch session created: {}", *new_id);
         _sessions_mem_usage += it->second->mem_usage();
+        _lru.push_back(*it->second);
         return fetch_session_ctx(it->second, true);
     }
     auto it = _sessions.find(session_id);
@@ -137,6 +143,7 @@ fetch_session_cache::maybe_get_session(const fetch_request& req) {
     }
 
     session->advance_epoch();
+    touch(*session);
     _sessions_mem_usage += session->mem_usage();
     return fetch_session_ctx(session, false);
 }
@@ -161,18 +168,20 @@ std::optional<fetch_session_id> fetch_session_cache::new_session_id() {
 
 void fetch_session_cache::gc_sessions() {
     auto now = model::timeout_clock::now();
-    for (auto it = _sessions.cbegin(); it != _sessions.cend();) {
-        // session is in use or was used recently skip
-        if (
-          it->second->is_locked()
-          || now - it->second->_last_used < _session_eviction_duration) {
-            // do nothing
-            ++it;
-        } else {
-            vlog(klog.debug, "evicting session {}", it->second->id());
-            _sessions_mem_usage -= it->second->mem_usage();
-            _sessions.erase(it++);
+    // sessions are kept in lru order, eviction stops at the first session
+    // that was used recently, everything behind it is fresher
+    auto it = _lru.begin();
+    while (it != _lru.end()
+           && now - it->_last_used >= _session_eviction_duration) {
+        auto& session = *it;
+        ++it;
+        if (session.is_locked()) {
+            // session is in use, skip
+            continue;
         }
+        vlog(klog.debug, "evicting session {}", session.id());
+        _sessions_mem_usage -= session.mem_usage();
+        _sessions.erase(session.id());
     }
 }
 
@@ -56,6 +56,12 @@ private:
     std::optional<fetch_session_id> new_session_id();
     void gc_sessions();
 
+    // move the session to the most recently used end of the lru list
+    void touch(fetch_session& session) {
+        session._lru_hook.unlink();
+        _lru.push_back(session);
+    }
+
     size_t mem_usage() const {
         using debug = absl::container_internal::hashtable_debug_internal::
           HashtableDebugAccess<underlying_t>;
@@ -65,6 +71,10 @@ private:
     void register_metrics();
 
     underlying_t _sessions;
+    // sessions ordered by last use. the least recently used session is at the
+    // front, so eviction stops at the first session that is still fresh
+    // instead of scanning the whole cache
+    intrusive_list<fetch_session, &fetch_session::_lru_hook> _lru;
     const fetch_session_id _min_session_id;
     const fetch_session_id _max_session_id;
     fetch_session_id _last_session_id;
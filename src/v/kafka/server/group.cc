@@ -18,6 +18,7 @@
 #include "kafka/server/group_manager.h"
 #include "kafka/server/logger.h"
 #include "likely.h"
+#include "raft/errc.h"
 #include "utils/to_string.h"
 #include "vassert.h"
 
@@ -25,6 +26,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/print.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/util/later.hh>
 
 #include <absl/container/flat_hash_set.h>
 #include <boost/uuid/random_generator.hpp>
@@ -50,7 +52,8 @@ group::group(
   kafka::group_id id,
   group_state s,
   config::configuration& conf,
-  ss::lw_shared_ptr<cluster::partition> partition)
+  ss::lw_shared_ptr<cluster::partition> partition,
+  timer_wheel<clock_type>& timeouts)
   : _id(std::move(id))
   , _state(s)
   , _state_timestamp(clock_type::now())
@@ -58,18 +61,23 @@ group::group(
   , _num_members_joining(0)
   , _new_member_added(false)
   , _conf(conf)
-  , _partition(std::move(partition)) {}
+  , _partition(std::move(partition))
+  , _timeouts(timeouts) {
+    _offset_commit_flush_timer.set_callback([this] { flush_offset_commits(); });
+}
 
 group::group(
   kafka::group_id id,
   group_log_group_metadata& md,
   config::configuration& conf,
-  ss::lw_shared_ptr<cluster::partition> partition)
+  ss::lw_shared_ptr<cluster::partition> partition,
+  timer_wheel<clock_type>& timeouts)
   : _id(std::move(id))
   , _num_members_joining(0)
   , _new_member_added(false)
   , _conf(conf)
-  , _partition(std::move(partition)) {
+  , _partition(std::move(partition))
+  , _timeouts(timeouts) {
     _state = md.members.empty() ? group_state::empty : group_state::stable;
     _generation = md.generation;
     _protocol_type = md.protocol_type;
@@ -82,6 +90,15 @@ group::group(
         auto member = ss::make_lw_shared<group_member>(std::move(m), id);
         add_member_no_join(member);
     }
+
+    _offset_commit_flush_timer.set_callback([this] { flush_offset_commits(); });
+}
+
+group::~group() noexcept {
+    // fail commits that never made it into a replication batch
+    for (auto& item : _offset_commit_buffer) {
+        item->promise.set_value(raft::errc::shutting_down);
+    }
 }
 
 bool group::valid_previous_state(group_state s) const {
@@ -153,6 +170,11 @@ void group::add_member_no_join(member_ptr member) {
     for (auto& p : member->protocols()) {
         _supported_protocols[p.name]++;
     }
+
+    if (member->group_instance_id()) {
+        _static_members.insert_or_assign(
+          *member->group_instance_id(), member->id());
+    }
 }
 
 ss::future<join_group_response> group::add_member(member_ptr member) {
@@ -428,9 +450,22 @@ group::join_group_unknown_member(join_group_request&& r) {
 
     auto new_member_id = group::generate_member_id(r);
 
+    if (r.data.group_instance_id) {
+        if (contains_static_member(*r.data.group_instance_id)) {
+            // the instance was seen before, e.g. the process restarted. take
+            // over the previous registration rather than joining as a
+            // stranger, which in a stable group avoids a rebalance entirely.
+            return join_group_static_member_rejoin(
+              std::move(new_member_id), std::move(r));
+        }
+        // static members skip the member_id_required round trip below since
+        // the instance id already identifies them across restarts
+        return add_member_and_rebalance(std::move(new_member_id), std::move(r));
+    }
+
     // <kafka>Only return MEMBER_ID_REQUIRED error if joinGroupRequest version
     // is >= 4 and groupInstanceId is configured to unknown.</kafka>
-    if (r.version >= api_version(4) && !r.data.group_instance_id) {
+    if (r.version >= api_version(4)) {
         // <kafka>If member id required (dynamic membership), register the
         // member in the pending member list and send back a response to
         // call for another join group request with allocated member id.
@@ -443,6 +478,95 @@ group::join_group_unknown_member(join_group_request&& r) {
     }
 }
 
+member_ptr group::replace_static_member(
+  const kafka::group_instance_id& instance_id,
+  const kafka::member_id& old_member_id,
+  const kafka::member_id& new_member_id) {
+    auto it = _members.find(old_member_id);
+    vassert(
+      it != _members.end(),
+      "static instance {} maps to unknown member {}",
+      instance_id,
+      old_member_id);
+    auto old_member = it->second;
+    _members.erase(it);
+
+    // a join in flight for the previous incarnation belongs to a client that
+    // has been superseded - have it back off and rediscover its fencing
+    try_finish_joining_member(
+      old_member, _make_join_error(no_member, error_code::fenced_instance_id));
+
+    // the previous incarnation's session must not expire the new one
+    old_member->expire_entry().cancel();
+
+    // carry the old state over to the new id. the assignment in particular
+    // survives so that a stable group can hand it back without a rebalance.
+    auto state = old_member->state().copy();
+    state.id = new_member_id;
+    auto member = ss::make_lw_shared<group_member>(std::move(state), id());
+    _members.emplace(new_member_id, member);
+
+    if (is_leader(old_member_id)) {
+        _leader = new_member_id;
+    }
+    _static_members.insert_or_assign(instance_id, new_member_id);
+
+    // protocol counts are unchanged: the new member inherits the old
+    // member's protocols one for one
+    return member;
+}
+
+ss::future<join_group_response> group::join_group_static_member_rejoin(
+  kafka::member_id new_member_id, join_group_request&& r) {
+    const auto& instance_id = *r.data.group_instance_id;
+    auto old_member_id = _static_members.at(instance_id);
+    klog.trace(
+      "static instance {} rejoining: replacing member {} with {}",
+      instance_id,
+      old_member_id,
+      new_member_id);
+
+    auto member = replace_static_member(
+      instance_id, old_member_id, new_member_id);
+
+    if (
+      in_state(group_state::stable)
+      && r.data.protocols == member->protocols()) {
+        /*
+         * the restarted instance came back with unchanged subscription
+         * metadata while the group is stable. its assignment was preserved
+         * across the member id swap above, so reply with the current
+         * generation and let the follow-up sync hand the old assignment
+         * right back. the rest of the group keeps consuming, undisturbed.
+         *
+         * the swap is not checkpointed here; if the coordinator moves before
+         * the next rebalance the recovered group still holds the old member
+         * id and the client falls back to a full (dynamic-style) rejoin.
+         */
+        schedule_next_heartbeat_expiration(member);
+
+        // the leader receives group member metadata
+        std::vector<member_config> members;
+        if (is_leader(new_member_id)) {
+            members = member_metadata();
+        }
+
+        join_group_response response(
+          error_code::none,
+          generation(),
+          protocol().value_or(protocol_name("")),
+          leader().value_or(member_id("")),
+          std::move(new_member_id),
+          std::move(members));
+
+        return ss::make_ready_future<join_group_response>(std::move(response));
+    }
+
+    // changed metadata, or a rebalance is already under way: rejoin like any
+    // other member, under the new id
+    return update_member_and_rebalance(member, std::move(r));
+}
+
 ss::future<join_group_response>
 group::join_group_known_member(join_group_request&& r) {
     klog.trace("member {} joining group {}", r.data.member_id, *this);
@@ -469,6 +593,20 @@ group::join_group_known_member(join_group_request&& r) {
 
     auto member = get_member(r.data.member_id);
 
+    if (r.data.group_instance_id) {
+        // the member id must be the one currently registered for the
+        // instance - anything else is a zombie from before a restart
+        auto it = _static_members.find(*r.data.group_instance_id);
+        if (it == _static_members.end() || it->second != r.data.member_id) {
+            klog.trace(
+              "member {} does not own static instance {}",
+              r.data.member_id,
+              *r.data.group_instance_id);
+            return make_join_error(
+              r.data.member_id, error_code::fenced_instance_id);
+        }
+    }
+
     switch (state()) {
     case group_state::preparing_rebalance:
         return update_member_and_rebalance(member, std::move(r));
@@ -589,15 +727,14 @@ ss::future<join_group_response> group::add_member_and_rebalance(
     // to a lot of defunct members in the rebalance. To prevent this going on
     // indefinitely, we timeout JoinGroup requests for new members. If the new
     // member is still there, we expect it to retry.</kafka>
-    member->expire_timer().cancel();
     auto now = clock_type::now();
     member->set_latest_heartbeat(now);
     auto deadline = now + _conf.group_new_member_join_timeout();
-    member->expire_timer().set_callback(
+    member->expire_entry().set_callback(
       [this, deadline, member_id = member->id()]() {
           heartbeat_expire(member_id, deadline);
       });
-    member->expire_timer().arm(deadline);
+    _timeouts.arm(member->expire_entry(), deadline);
 
     try_prepare_rebalance();
     return response;
@@ -695,8 +832,8 @@ void group::complete_join() {
         if (!it->second->is_joining()) {
             vlog(klog.trace, "removing unjoined member {}", it->first);
 
-            // cancel the heartbeat timer
-            it->second->expire_timer().cancel();
+            // cancel the heartbeat timeout
+            it->second->expire_entry().cancel();
 
             // update supported protocols count
             for (auto& p : it->second->protocols()) {
@@ -822,15 +959,14 @@ void group::try_finish_joining_member(
 }
 
 void group::schedule_next_heartbeat_expiration(member_ptr member) {
-    member->expire_timer().cancel();
     auto now = clock_type::now();
     member->set_latest_heartbeat(now);
     auto deadline = now + member->session_timeout();
-    member->expire_timer().set_callback(
+    member->expire_entry().set_callback(
       [this, deadline, member_id = member->id()]() {
           heartbeat_expire(member_id, deadline);
       });
-    member->expire_timer().arm(deadline);
+    _timeouts.arm(member->expire_entry(), deadline);
 }
 
 void group::remove_pending_member(const kafka::member_id& member_id) {
@@ -865,6 +1001,12 @@ void group::remove_member(member_ptr member) {
                 vassert(_num_members_joining >= 0, "negative members joining");
             }
         }
+        if (member->group_instance_id()) {
+            auto s_it = _static_members.find(*member->group_instance_id());
+            if (s_it != _static_members.end() && s_it->second == member->id()) {
+                _static_members.erase(s_it);
+            }
+        }
         vlog(klog.trace, "removing member {}", member->id());
         _members.erase(it);
     }
@@ -1138,7 +1280,7 @@ group::handle_leave_group(leave_group_request&& r) {
     } else {
         vlog(klog.trace, "member has left {}", r.data.member_id);
         auto member = get_member(r.data.member_id);
-        member->expire_timer().cancel();
+        member->expire_entry().cancel();
         remove_member(member);
         return make_leave_error(error_code::none);
     }
@@ -1151,9 +1293,10 @@ void group::complete_offset_commit(
     if (p_it != _pending_offset_commits.end()) {
         // save the tp commit if it hasn't yet been seen, or we are completing
         // for an instance that is newer based on log offset
-        auto o_it = _offsets.find(tp);
-        if (o_it == _offsets.end() || o_it->second.log_offset < md.log_offset) {
-            _offsets[tp] = md;
+        auto o_it = _offsets->find(tp);
+        if (
+          o_it == _offsets->end() || o_it->second.log_offset < md.log_offset) {
+            mutable_offsets()[tp] = md;
         }
 
         // clear pending for this tp
@@ -1174,6 +1317,73 @@ void group::fail_offset_commit(
     }
 }
 
+ss::future<result<raft::replicate_result>>
+group::replicate_offset_commits(model::record_batch batch) {
+    auto item = ss::make_lw_shared<offset_commit_item>(std::move(batch));
+    auto f = item->promise.get_future();
+    _offset_commit_buffered_bytes += item->batch.size_bytes();
+    _offset_commit_buffer.push_back(std::move(item));
+
+    if (
+      _offset_commit_buffered_bytes
+      >= _conf.group_offset_commit_max_buffered_bytes()) {
+        _offset_commit_flush_timer.cancel();
+        flush_offset_commits();
+    } else if (!_offset_commit_flush_timer.armed()) {
+        _offset_commit_flush_timer.arm(
+          _conf.group_offset_commit_flush_delay_ms());
+    }
+
+    return f;
+}
+
+void group::flush_offset_commits() {
+    if (_offset_commit_buffer.empty()) {
+        return;
+    }
+    auto items = std::exchange(_offset_commit_buffer, {});
+    _offset_commit_buffered_bytes = 0;
+
+    ss::circular_buffer<model::record_batch> batches;
+    batches.reserve(items.size());
+    for (auto& item : items) {
+        batches.push_back(std::move(item->batch));
+    }
+    auto reader = model::make_memory_record_batch_reader(std::move(batches));
+
+    // the continuation owns the items and captures no group state, so an
+    // in-flight flush does not have to outlive the group itself
+    (void)_partition
+      ->replicate(
+        std::move(reader),
+        raft::replicate_options(raft::consistency_level::quorum_ack))
+      .then_wrapped(
+        [items = std::move(items)](
+          ss::future<result<raft::replicate_result>> f) mutable {
+            if (f.failed()) {
+                auto ex = f.get_exception();
+                for (auto& item : items) {
+                    item->promise.set_exception(ex);
+                }
+                return;
+            }
+            auto r = f.get0();
+            if (!r) {
+                for (auto& item : items) {
+                    item->promise.set_value(r.error());
+                }
+                return;
+            }
+            // iterate backward to calculate per item last offsets, mirroring
+            // raft::replicate_batcher::propagate_result
+            auto last_offset = r.value().last_offset;
+            for (auto it = items.rbegin(); it != items.rend(); ++it) {
+                (*it)->promise.set_value(raft::replicate_result{last_offset});
+                last_offset = last_offset - model::offset((*it)->record_count);
+            }
+        });
+}
+
 ss::future<offset_commit_response>
 group::store_offsets(offset_commit_request&& r) {
     cluster::simple_batch_builder builder(
@@ -1214,12 +1424,8 @@ group::store_offsets(offset_commit_request&& r) {
     }
 
     auto batch = std::move(builder).build();
-    auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
-    return _partition
-      ->replicate(
-        std::move(reader),
-        raft::replicate_options(raft::consistency_level::quorum_ack))
+    return replicate_offset_commits(std::move(batch))
       .then([this, req = std::move(r), commits = std::move(offset_commits)](
               result<raft::replicate_result> r) mutable {
           error_code error = r ? error_code::none : error_code::not_coordinator;
@@ -1288,27 +1494,53 @@ group::handle_offset_fetch(offset_fetch_request&& r) {
     offset_fetch_response resp;
     resp.data.error_code = error_code::none;
 
-    // retrieve all topics available
+    // retrieve all topics available. stream processors fetch every owned
+    // partition at startup, so the walk runs over the immutable offsets
+    // snapshot and yields periodically; commit batches applying in the
+    // meantime copy-on-write instead of mutating the map being iterated
     if (!r.data.topics) {
-        absl::flat_hash_map<
+        using tmp_t = absl::flat_hash_map<
           model::topic,
-          std::vector<offset_fetch_response_partition>>
-          tmp;
-        for (const auto& e : _offsets) {
-            offset_fetch_response_partition p = {
-              .partition_index = e.first.partition,
-              .committed_offset = e.second.offset,
-              .metadata = e.second.metadata,
-              .error_code = error_code::none,
-            };
-            tmp[e.first.topic].push_back(std::move(p));
-        }
-        for (auto& e : tmp) {
-            resp.data.topics.push_back(
-              {.name = e.first, .partitions = std::move(e.second)});
-        }
-
-        return ss::make_ready_future<offset_fetch_response>(std::move(resp));
+          std::vector<offset_fetch_response_partition>>;
+        auto snapshot = _offsets;
+        auto it = snapshot->cbegin();
+        return ss::do_with(
+          std::move(resp),
+          std::move(snapshot),
+          it,
+          tmp_t{},
+          size_t(0),
+          [](
+            offset_fetch_response& resp,
+            ss::lw_shared_ptr<offsets_map_t>& snapshot,
+            offsets_map_t::const_iterator& it,
+            tmp_t& tmp,
+            size_t& processed) {
+              return ss::do_until(
+                       [&it, &snapshot] { return it == snapshot->cend(); },
+                       [&it, &tmp, &processed] {
+                           const auto& e = *it;
+                           offset_fetch_response_partition p = {
+                             .partition_index = e.first.partition,
+                             .committed_offset = e.second.offset,
+                             .metadata = e.second.metadata,
+                             .error_code = error_code::none,
+                           };
+                           tmp[e.first.topic].push_back(std::move(p));
+                           ++it;
+                           if (unlikely(++processed % 512 == 0)) {
+                               return ss::later();
+                           }
+                           return ss::now();
+                       })
+                .then([&resp, &tmp] {
+                    for (auto& e : tmp) {
+                        resp.data.topics.push_back(
+                          {.name = e.first, .partitions = std::move(e.second)});
+                    }
+                    return std::move(resp);
+                });
+          });
     }
 
     // retrieve for the topics specified in the request
@@ -1393,7 +1625,7 @@ ss::future<error_code> group::remove() {
     storage::record_batch_builder builder(
       raft::data_batch_type, model::offset(0));
 
-    for (auto& offset : _offsets) {
+    for (auto& offset : *_offsets) {
         group_log_record_key key{
           .record_type = group_log_record_key::type::offset_commit,
           .key = reflection::to_iobuf(group_log_offset_key{
@@ -1450,9 +1682,10 @@ ss::future<error_code> group::remove() {
 ss::future<>
 group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
     std::vector<std::pair<model::topic_partition, offset_metadata>> removed;
+    auto& offsets = mutable_offsets();
     for (const auto& tp : tps) {
         _pending_offset_commits.erase(tp);
-        if (auto offset = _offsets.extract(tp); offset) {
+        if (auto offset = offsets.extract(tp); offset) {
             removed.emplace_back(
               std::move(offset.key()), std::move(offset.mapped()));
         }
@@ -1461,7 +1694,7 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
     // if no members and no offsets
     if (
       in_state(group_state::empty) && _pending_offset_commits.empty()
-      && _offsets.empty()) {
+      && offsets.empty()) {
         vlog(
           klog.debug,
           "Marking group {} as dead at {} generation",
@@ -1475,7 +1708,7 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
         co_return;
     }
 
-    _offsets.rehash(0);
+    offsets.rehash(0);
     _pending_offset_commits.rehash(0);
 
     // build offset tombstones
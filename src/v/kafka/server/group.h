@@ -19,6 +19,7 @@
 #include "model/fundamental.h"
 #include "model/record.h"
 #include "seastarx.h"
+#include "utils/timer_wheel.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -113,14 +114,18 @@ public:
       kafka::group_id id,
       group_state s,
       config::configuration& conf,
-      ss::lw_shared_ptr<cluster::partition> partition);
+      ss::lw_shared_ptr<cluster::partition> partition,
+      timer_wheel<clock_type>& timeouts);
 
     // constructor used when loading state from log
     group(
       kafka::group_id id,
       group_log_group_metadata& md,
       config::configuration& conf,
-      ss::lw_shared_ptr<cluster::partition> partition);
+      ss::lw_shared_ptr<cluster::partition> partition,
+      timer_wheel<clock_type>& timeouts);
+
+    ~group() noexcept;
 
     /// Get the group id.
     const kafka::group_id& id() const { return _id; }
@@ -178,6 +183,12 @@ public:
         return _pending_members.find(member) != _pending_members.end();
     }
 
+    /// Check if a static member is registered for the instance.
+    bool
+    contains_static_member(const kafka::group_instance_id& instance) const {
+        return _static_members.find(instance) != _static_members.end();
+    }
+
     /// Reschedule all members' heartbeat expiration
     void reschedule_all_member_heartbeats() {
         for (auto& e : _members) {
@@ -335,6 +346,17 @@ public:
     ss::future<join_group_response>
     join_group_known_member(join_group_request&& request);
 
+    /// Handle rejoin of a recognized static member under a new member id.
+    ss::future<join_group_response> join_group_static_member_rejoin(
+      kafka::member_id new_member_id, join_group_request&& request);
+
+    /// Re-register a static member under a new member id, carrying over its
+    /// state (most importantly its assignment) from the old registration.
+    member_ptr replace_static_member(
+      const kafka::group_instance_id& instance_id,
+      const kafka::member_id& old_member_id,
+      const kafka::member_id& new_member_id);
+
     /// Add a new member and initiate a rebalance.
     ss::future<join_group_response> add_member_and_rebalance(
       kafka::member_id member_id, join_group_request&& request);
@@ -382,7 +404,7 @@ public:
 
     std::optional<offset_metadata>
     offset(const model::topic_partition& tp) const {
-        if (auto it = _offsets.find(tp); it != _offsets.end()) {
+        if (auto it = _offsets->find(tp); it != _offsets->end()) {
             return it->second;
         }
         return std::nullopt;
@@ -403,7 +425,7 @@ public:
     handle_offset_fetch(offset_fetch_request&& r);
 
     void insert_offset(model::topic_partition tp, offset_metadata md) {
-        _offsets[std::move(tp)] = std::move(md);
+        mutable_offsets()[std::move(tp)] = std::move(md);
     }
 
     // helper for the kafka api: describe groups
@@ -420,11 +442,55 @@ public:
 private:
     using member_map = absl::node_hash_map<kafka::member_id, member_ptr>;
     using protocol_support = absl::node_hash_map<kafka::protocol_name, int>;
+    using offsets_map_t
+      = absl::node_hash_map<model::topic_partition, offset_metadata>;
+
+    /*
+     * copy-on-write handle for committers. the committed offsets map is
+     * published as an immutable snapshot: offset_fetch takes a reference
+     * and may iterate it across scheduling points; when that happens a
+     * commit batch applying concurrently clones the map and swaps the
+     * pointer instead of mutating what the fetch is reading. with no
+     * snapshot held (the common case) this mutates in place.
+     */
+    offsets_map_t& mutable_offsets() {
+        if (!_offsets.owned()) {
+            _offsets = ss::make_lw_shared<offsets_map_t>(*_offsets);
+        }
+        return *_offsets;
+    }
 
     friend std::ostream& operator<<(std::ostream&, const group&);
 
     model::record_batch checkpoint(const assignments_type& assignments);
 
+    /*
+     * offset commit batches waiting to be replicated to the group coordinator
+     * partition. each item resolves its promise with the replication result
+     * limited to the item's own records.
+     */
+    struct offset_commit_item {
+        explicit offset_commit_item(model::record_batch b)
+          : batch(std::move(b))
+          , record_count(batch.record_count()) {}
+
+        model::record_batch batch;
+        int32_t record_count;
+        ss::promise<result<raft::replicate_result>> promise;
+    };
+    using offset_commit_item_ptr = ss::lw_shared_ptr<offset_commit_item>;
+
+    /*
+     * write-behind buffer for offset commits. commits are accumulated for a
+     * short, configurable window (bounded in time and bytes) and replicated
+     * with a single call to partition::replicate. callers observe completion
+     * only after their records are quorum replicated.
+     */
+    ss::future<result<raft::replicate_result>>
+    replicate_offset_commits(model::record_batch);
+
+    void flush_offset_commits();
+
     kafka::group_id _id;
     group_state _state;
     clock_type::time_point _state_timestamp;
@@ -433,6 +499,9 @@ private:
     member_map _members;
     int _num_members_joining;
     absl::node_hash_set<kafka::member_id> _pending_members;
+    // static membership (group.instance.id): instance -> active member id
+    absl::node_hash_map<kafka::group_instance_id, kafka::member_id>
+      _static_members;
     std::optional<kafka::protocol_type> _protocol_type;
     std::optional<kafka::protocol_name> _protocol;
     std::optional<kafka::member_id> _leader;
@@ -440,9 +509,18 @@ private:
     bool _new_member_added;
     config::configuration& _conf;
     ss::lw_shared_ptr<cluster::partition> _partition;
-    absl::node_hash_map<model::topic_partition, offset_metadata> _offsets;
+    // per-shard wheel owned by the group manager; member session expiry
+    // entries are armed on it instead of one reactor timer per member
+    timer_wheel<clock_type>& _timeouts;
+    // latest committed offsets snapshot; swapped wholesale on conflicting
+    // writes, see mutable_offsets()
+    ss::lw_shared_ptr<offsets_map_t> _offsets
+      = ss::make_lw_shared<offsets_map_t>();
     absl::node_hash_map<model::topic_partition, offset_metadata>
       _pending_offset_commits;
+    std::vector<offset_commit_item_ptr> _offset_commit_buffer;
+    size_t _offset_commit_buffered_bytes{0};
+    ss::timer<clock_type> _offset_commit_flush_timer;
 };
 
 using group_ptr = ss::lw_shared_ptr<group>;
@@ -9,6 +9,7 @@
 
 #include "kafka/server/group_manager.h"
 
+#include "bytes/bytes.h"
 #include "cluster/cluster_utils.h"
 #include "cluster/partition_manager.h"
 #include "cluster/simple_batch_builder.h"
@@ -30,10 +31,12 @@ namespace kafka {
 group_manager::group_manager(
   ss::sharded<raft::group_manager>& gm,
   ss::sharded<cluster::partition_manager>& pm,
+  ss::sharded<storage::api>& storage,
   ss::sharded<cluster::topic_table>& topic_table,
   config::configuration& conf)
   : _gm(gm)
   , _pm(pm)
+  , _storage(storage)
   , _topic_table(topic_table)
   , _conf(conf)
   , _self(cluster::make_self_broker(config::shard_local_cfg())) {}
@@ -204,6 +207,127 @@ ss::future<> group_manager::inject_noop(
       .discard_result();
 }
 
+/*
+ * tags for keys stored by the kafka sub-system in the kvstore key space,
+ * so future kafka kvstore users can share the space.
+ */
+enum class kafka_kvstore_key_type : int8_t {
+    group_recovery_snapshot = 0,
+};
+
+bytes group_manager::recovery_snapshot_key(const model::ntp& ntp) {
+    iobuf buf;
+    reflection::serialize(
+      buf,
+      kafka_kvstore_key_type::group_recovery_snapshot,
+      ntp.ns,
+      ntp.tp.topic,
+      ntp.tp.partition);
+    return iobuf_to_bytes(buf);
+}
+
+static group_log_group_metadata
+copy_group_metadata(const group_log_group_metadata& md) {
+    group_log_group_metadata copy;
+    copy.protocol_type = md.protocol_type;
+    copy.generation = md.generation;
+    copy.protocol = md.protocol;
+    copy.leader = md.leader;
+    copy.state_timestamp = md.state_timestamp;
+    copy.members.reserve(md.members.size());
+    for (const auto& member : md.members) {
+        copy.members.push_back(member.copy());
+    }
+    return copy;
+}
+
+std::optional<recovery_batch_consumer_state>
+group_manager::load_recovery_snapshot(
+  const ss::lw_shared_ptr<cluster::partition>& p) {
+    auto buf = _storage.local().kvs().get(
+      storage::kvstore::key_space::kafka, recovery_snapshot_key(p->ntp()));
+    if (!buf) {
+        return std::nullopt;
+    }
+
+    auto snap = reflection::from_iobuf<group_recovery_snapshot>(
+      std::move(*buf));
+    if (snap.version != group_recovery_snapshot::current_version) {
+        vlog(
+          klog.info,
+          "Ignoring group recovery snapshot for {} with version {}",
+          p->ntp(),
+          snap.version);
+        return std::nullopt;
+    }
+
+    /*
+     * a snapshot only ever captures committed state, so it running ahead of
+     * the committed offset indicates the log shrank underneath it (e.g. data
+     * loss recovery). fall back to a full replay.
+     */
+    if (snap.next_offset > p->committed_offset() + model::offset(1)) {
+        vlog(
+          klog.warn,
+          "Ignoring group recovery snapshot for {}: snapshot offset {} is "
+          "ahead of committed offset {}",
+          p->ntp(),
+          snap.next_offset,
+          p->committed_offset());
+        return std::nullopt;
+    }
+
+    recovery_batch_consumer_state st;
+    st.next_offset = snap.next_offset;
+    st.loaded_groups.reserve(snap.groups.size());
+    for (auto& group : snap.groups) {
+        st.loaded_groups.emplace(
+          std::move(group.id), std::move(group.metadata));
+    }
+    for (auto& group_id : snap.removed_groups) {
+        st.removed_groups.emplace(std::move(group_id));
+    }
+    st.loaded_offsets.reserve(snap.offsets.size());
+    for (auto& offset : snap.offsets) {
+        st.loaded_offsets.emplace(
+          std::move(offset.key),
+          std::make_pair(offset.log_offset, std::move(offset.metadata)));
+    }
+
+    vlog(
+      klog.debug,
+      "Seeding recovery of {} from snapshot covering offsets below {}",
+      p->ntp(),
+      st.next_offset);
+
+    return st;
+}
+
+ss::future<> group_manager::store_recovery_snapshot(
+  const model::ntp& ntp, const recovery_batch_consumer_state& st) {
+    group_recovery_snapshot snap;
+    snap.next_offset = st.next_offset;
+    snap.groups.reserve(st.loaded_groups.size());
+    for (const auto& e : st.loaded_groups) {
+        snap.groups.push_back(group_recovery_snapshot_group{
+          e.first, copy_group_metadata(e.second)});
+    }
+    snap.removed_groups.reserve(st.removed_groups.size());
+    for (const auto& group_id : st.removed_groups) {
+        snap.removed_groups.push_back(group_id);
+    }
+    snap.offsets.reserve(st.loaded_offsets.size());
+    for (const auto& e : st.loaded_offsets) {
+        snap.offsets.push_back(group_recovery_snapshot_offset{
+          e.first, e.second.first, e.second.second});
+    }
+
+    return _storage.local().kvs().put(
+      storage::kvstore::key_space::kafka,
+      recovery_snapshot_key(ntp),
+      reflection::to_iobuf(std::move(snap)));
+}
+
 ss::future<> group_manager::handle_partition_leader_change(
   ss::lw_shared_ptr<attached_partition> p,
   std::optional<model::node_id> leader_id) {
@@ -224,13 +348,25 @@ ss::future<> group_manager::handle_partition_leader_change(
          */
         return inject_noop(p->partition, timeout).then([this, timeout, p] {
             /*
-             * the full log is read and deduplicated. the dedupe processing is
+             * the log is read and deduplicated. the dedupe processing is
              * based on the record keys, so this code should be ready to
              * transparently take advantage of key-based compaction in the
              * future.
+             *
+             * when a recovery snapshot is available the consumer is seeded
+             * with its materialized state and replay starts at the first
+             * offset the snapshot does not cover, instead of the partition
+             * start offset.
              */
+            auto start_offset = p->partition->start_offset();
+            recovery_batch_consumer_state seed;
+            if (auto snap = load_recovery_snapshot(p->partition); snap) {
+                start_offset = std::max(start_offset, snap->next_offset);
+                seed = std::move(*snap);
+            }
+
             storage::log_reader_config reader_config(
-              p->partition->start_offset(),
+              start_offset,
               model::model_limits<model::offset>::max(),
               0,
               std::numeric_limits<size_t>::max(),
@@ -240,17 +376,24 @@ ss::future<> group_manager::handle_partition_leader_change(
               std::nullopt);
 
             return p->partition->make_reader(reader_config)
-              .then([this, p, timeout](model::record_batch_reader reader) {
+              .then([this, p, timeout, seed = std::move(seed)](
+                      model::record_batch_reader reader) mutable {
                   return std::move(reader)
-                    .consume(recovery_batch_consumer(p->as), timeout)
+                    .consume(
+                      recovery_batch_consumer(std::move(seed), p->as), timeout)
                     .then([this, p](recovery_batch_consumer_state state) {
                         // avoid trying to recover if we stopped the reader
                         // because an abort was requested
                         if (p->as.abort_requested()) {
                             return ss::make_ready_future<>();
                         }
-                        return recover_partition(p->partition, std::move(state))
-                          .then([p] { p->loading = false; });
+                        return store_recovery_snapshot(
+                                 p->partition->ntp(), state)
+                          .then([this, p, state = std::move(state)]() mutable {
+                              return recover_partition(
+                                       p->partition, std::move(state))
+                                .then([p] { p->loading = false; });
+                          });
                     });
               });
         });
@@ -304,7 +447,8 @@ ss::future<> group_manager::recover_partition(
             continue;
         }
 
-        group = ss::make_lw_shared<kafka::group>(e.first, e.second, _conf, p);
+        group = ss::make_lw_shared<kafka::group>(
+          e.first, e.second, _conf, p, _timeouts);
 
         for (auto& e : offsets) {
             group->insert_offset(
@@ -328,7 +472,7 @@ ss::future<> group_manager::recover_partition(
         }
 
         group = ss::make_lw_shared<kafka::group>(
-          e.first, group_state::empty, _conf, p);
+          e.first, group_state::empty, _conf, p, _timeouts);
 
         for (auto& e : e.second) {
             group->insert_offset(
@@ -376,6 +520,7 @@ recovery_batch_consumer::operator()(model::record_batch batch) {
           ss::stop_iteration::yes);
     }
     batch_base_offset = batch.base_offset();
+    st.next_offset = batch.last_offset() + model::offset(1);
     return ss::do_with(
              std::move(batch),
              [this](model::record_batch& batch) {
@@ -501,7 +646,7 @@ group_manager::join_group(join_group_request&& r) {
         }
         auto p = it->second->partition;
         group = ss::make_lw_shared<kafka::group>(
-          r.data.group_id, group_state::empty, _conf, p);
+          r.data.group_id, group_state::empty, _conf, p, _timeouts);
         _groups.emplace(r.data.group_id, group);
         _groups.rehash(0);
         klog.trace("created new group {}", group);
@@ -611,7 +756,7 @@ group_manager::offset_commit(offset_commit_request&& r) {
             // allow the commit</kafka>
             auto p = _partitions.find(r.ntp)->second->partition;
             group = ss::make_lw_shared<kafka::group>(
-              r.data.group_id, group_state::empty, _conf, p);
+              r.data.group_id, group_state::empty, _conf, p, _timeouts);
             _groups.emplace(r.data.group_id, group);
             _groups.rehash(0);
         } else {
@@ -26,6 +26,7 @@
 #include "model/namespace.h"
 #include "raft/group_manager.h"
 #include "seastarx.h"
+#include "storage/api.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/future.hh>
@@ -112,6 +113,7 @@ public:
     group_manager(
       ss::sharded<raft::group_manager>& gm,
       ss::sharded<cluster::partition_manager>& pm,
+      ss::sharded<storage::api>& storage,
       ss::sharded<cluster::topic_table>&,
       config::configuration& conf);
 
@@ -200,14 +202,26 @@ private:
     ss::future<> recover_partition(
       ss ::lw_shared_ptr<cluster::partition>, recovery_batch_consumer_state);
 
+    static bytes recovery_snapshot_key(const model::ntp&);
+
+    std::optional<recovery_batch_consumer_state>
+    load_recovery_snapshot(const ss::lw_shared_ptr<cluster::partition>&);
+
+    ss::future<> store_recovery_snapshot(
+      const model::ntp&, const recovery_batch_consumer_state&);
+
     ss::future<> inject_noop(
       ss::lw_shared_ptr<cluster::partition> p,
       ss::lowres_clock::time_point timeout);
 
     ss::sharded<raft::group_manager>& _gm;
     ss::sharded<cluster::partition_manager>& _pm;
+    ss::sharded<storage::api>& _storage;
     ss::sharded<cluster::topic_table>& _topic_table;
     config::configuration& _conf;
+    // one wheel per shard for all member session timeouts; must be
+    // declared before _groups so it outlives the entries armed on it
+    timer_wheel<group::clock_type> _timeouts;
     absl::node_hash_map<group_id, group_ptr> _groups;
     model::broker _self;
 };
@@ -297,12 +311,52 @@ struct recovery_batch_consumer_state {
       group_log_offset_key,
       std::pair<model::offset, group_log_offset_metadata>>
       loaded_offsets;
+
+    // the first log offset not yet folded into this state. replay of the
+    // group metadata partition resumes at this offset when the state was
+    // seeded from a recovery snapshot.
+    model::offset next_offset;
+};
+
+/*
+ * A durable image of a fully recovered recovery_batch_consumer_state,
+ * persisted in the kvstore after a partition is recovered. On a subsequent
+ * leadership change the snapshot seeds the consumer so replay starts at
+ * `next_offset` instead of the partition start offset.
+ *
+ * The hash maps above are flattened into vectors because the snapshot is
+ * serialized with the same adl encoding used for the log records it holds.
+ */
+struct group_recovery_snapshot_group {
+    kafka::group_id id;
+    group_log_group_metadata metadata;
+};
+
+struct group_recovery_snapshot_offset {
+    group_log_offset_key key;
+    model::offset log_offset;
+    group_log_offset_metadata metadata;
+};
+
+struct group_recovery_snapshot {
+    static constexpr int8_t current_version = 0;
+
+    int8_t version{current_version};
+    model::offset next_offset;
+    std::vector<group_recovery_snapshot_group> groups;
+    std::vector<kafka::group_id> removed_groups;
+    std::vector<group_recovery_snapshot_offset> offsets;
 };
 
 struct recovery_batch_consumer {
     explicit recovery_batch_consumer(ss::abort_source& as)
       : as(as) {}
 
+    recovery_batch_consumer(
+      recovery_batch_consumer_state seed, ss::abort_source& as)
+      : st(std::move(seed))
+      , as(as) {}
+
     ss::future<ss::stop_iteration> operator()(model::record_batch batch);
 
     ss::future<> handle_record(model::record);
@@ -30,6 +30,8 @@
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <type_traits>
 
 namespace kafka {
@@ -146,10 +148,33 @@ private:
     using sharded_groups = absl::
       node_hash_map<ss::shard_id, std::vector<std::pair<model::ntp, group_id>>>;
 
+    /**
+     * Resolving group -> ntp -> shard walks the metadata cache and the
+     * shard table on every heartbeat/commit/join, although coordinatorship
+     * rarely moves. Resolved routes are cached per shard and validated
+     * against the shard table version, so the steady state is a single
+     * hash probe. A stale route that survives validation (e.g. the group
+     * topic grew partitions on another node) is harmless: the target group
+     * manager rejects requests for partitions it no longer leads with
+     * not_coordinator and the client rediscovers.
+     */
     std::optional<std::pair<model::ntp, ss::shard_id>>
     shard_for(const group_id& group) {
+        const auto version = _shards.local().version();
+        if (auto it = _route_cache.find(group); it != _route_cache.end()) {
+            if (it->second.version == version) {
+                return std::make_pair(it->second.ntp, it->second.shard);
+            }
+            _route_cache.erase(it);
+        }
         if (auto ntp = _coordinators.local().ntp_for(group); ntp) {
             if (auto shard_id = _shards.local().shard_for(*ntp); shard_id) {
+                if (_route_cache.size() >= max_cached_routes) {
+                    // rare - reset in bulk instead of tracking lru order
+                    _route_cache.clear();
+                }
+                _route_cache.emplace(
+                  group, cached_route{*ntp, *shard_id, version});
                 return std::make_pair(std::move(*ntp), *shard_id);
             }
         }
@@ -162,11 +187,19 @@ private:
     ss::future<> parallel_route_delete_groups(
       std::vector<deletable_group_result>&, sharded_groups&);
 
+    struct cached_route {
+        model::ntp ntp;
+        ss::shard_id shard;
+        int64_t version;
+    };
+    static constexpr size_t max_cached_routes = 64 * 1024;
+
     ss::scheduling_group _sg;
     ss::smp_service_group _ssg;
     ss::sharded<group_manager>& _group_manager;
     ss::sharded<cluster::shard_table>& _shards;
     ss::sharded<coordinator_ntp_mapper>& _coordinators;
+    absl::flat_hash_map<group_id, cached_route> _route_cache;
 };
 
 } // namespace kafka
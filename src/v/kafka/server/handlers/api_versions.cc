@@ -13,6 +13,8 @@
 #include "kafka/server/request_context.h"
 #include "kafka/server/response.h"
 
+#include <array>
+
 namespace kafka {
 
 std::ostream& operator<<(std::ostream& os, const api_versions_response& r) {
@@ -103,8 +105,49 @@ api_versions_response api_versions_handler::handle_raw(request_context& ctx) {
     return r;
 }
 
+/**
+ * The supported api table is a compile-time constant and the response
+ * carries no per-request state unless a throttle delay is being applied.
+ * Every fresh connection opens with an ApiVersions request, so a reconnect
+ * storm re-encodes the identical body thousands of times; keep one
+ * pre-encoded template per request version and serve shared copies.
+ */
+namespace {
+
+std::array<iobuf, size_t(api_versions_handler::max_supported()) + 1>&
+local_response_templates() {
+    static thread_local std::
+      array<iobuf, size_t(api_versions_handler::max_supported()) + 1>
+        templates;
+    return templates;
+}
+
+} // namespace
+
 ss::future<response_ptr>
 api_versions_handler::handle(request_context&& ctx, ss::smp_service_group) {
+    const auto version = ctx.header().version;
+    if (
+      version >= min_supported && version <= max_supported
+      && ctx.throttle_delay_ms() == 0) {
+        // consume the request body before responding
+        api_versions_request request;
+        request.decode(ctx.reader(), version);
+
+        auto& templ = local_response_templates().at(version());
+        if (templ.empty()) {
+            api_versions_response r;
+            r.data.error_code = error_code::none;
+            r.data.api_keys = get_supported_apis();
+            response resp;
+            r.encode(ctx, resp);
+            templ = std::move(resp).release();
+        }
+        auto resp = std::make_unique<response>();
+        resp->buf() = templ.share(0, templ.size_bytes());
+        return ss::make_ready_future<response_ptr>(std::move(resp));
+    }
+
     auto response = handle_raw(ctx);
     return ctx.respond(std::move(response));
 }
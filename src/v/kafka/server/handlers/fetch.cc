@@ -9,12 +9,14 @@
 
 #include "kafka/server/handlers/fetch.h"
 
+#include "archival/service.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "config/configuration.h"
 #include "kafka/protocol/batch_consumer.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/server/fetch_session.h"
+#include "kafka/server/logger.h"
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -24,11 +26,15 @@
 #include "storage/parser_utils.h"
 #include "utils/to_string.h"
 
+#include <seastar/core/abort_source.hh>
 #include <seastar/core/do_with.hh>
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <boost/functional/hash.hpp>
 #include <boost/range/irange.hpp>
 #include <fmt/ostream.h>
 
@@ -347,13 +353,33 @@ model::record_batch adapt_fetch_batch(model::record_batch&& batch) {
       header, std::move(records), model::record_batch::tag_ctor_ng{});
 }
 
+/**
+ * A record batch reader consumer that adapts batches for kafka clients and
+ * serializes them to the wire format in a single pass. Running it on the
+ * partition's home core lets the fetch path skip the intermediate in-memory
+ * batch reader entirely - the resulting iobuf is spliced straight into the
+ * response, and its fragments are safe to release on the connection's core.
+ */
+class fetch_batch_serializer {
+public:
+    ss::future<ss::stop_iteration> operator()(model::record_batch&& batch) {
+        return _serializer(adapt_fetch_batch(std::move(batch)));
+    }
+
+    kafka_batch_serializer::result end_of_stream() {
+        return _serializer.end_of_stream();
+    }
+
+private:
+    kafka_batch_serializer _serializer;
+};
+
 /**
  * Low-level handler for reading from an ntp. Runs on ntp's home core.
  */
-static ss::future<read_result> read_from_partition(
+static ss::future<read_result> do_read_from_partition(
   partition_wrapper pw,
   fetch_config config,
-  bool foreign_read,
   std::optional<model::timeout_clock::time_point> deadline) {
     auto hw = pw.high_watermark();
     auto lso = pw.last_stable_offset();
@@ -374,24 +400,198 @@ static ss::future<read_result> read_from_partition(
 
     reader_config.strict_max_bytes = config.strict_max_bytes;
     return pw.make_reader(reader_config)
-      .then([hw, lso, foreign_read, deadline](model::record_batch_reader rdr) {
-          return model::transform_reader_to_memory(
-                   std::move(rdr),
-                   deadline.value_or(model::no_timeout),
-                   adapt_fetch_batch)
-            .then([foreign_read](
-                    ss::circular_buffer<model::record_batch> data) {
-                // if we are on remote core, we MUST use foreign record batch
-                // reader.
-                if (foreign_read) {
-                    return model::make_foreign_memory_record_batch_reader(
-                      std::move(data));
-                }
-                return model::make_memory_record_batch_reader(std::move(data));
+      .then([hw, lso, deadline](model::record_batch_reader rdr) {
+          return std::move(rdr)
+            .consume(
+              fetch_batch_serializer(), deadline.value_or(model::no_timeout))
+            .then([hw, lso](kafka_batch_serializer::result res) {
+                return read_result(std::move(res.data), hw, lso);
             })
-            .then([hw, lso](model::record_batch_reader rdr) {
-                return read_result(std::move(rdr), hw, lso);
+            .handle_exception([hw, lso](const std::exception_ptr&) {
+                /*
+                 * TODO: this is where we will want to handle any storage
+                 * specific errors and translate them into kafka response
+                 * error codes.
+                 */
+                auto res = read_result(error_code::unknown_server_error);
+                res.high_watermark = hw;
+                res.last_stable_offset = lso;
+                return res;
+            });
+      });
+}
+
+/**
+ * Topics with tens of consumer groups all tailing one partition generate
+ * bursts of identical reads: same ntp, same start offset, same budget. Having
+ * every one of them walk the log reader and the batch cache multiplies the
+ * cpu cost by the number of groups, so concurrent identical reads on a shard
+ * attach to the first one in flight and receive the already serialized
+ * batches as shared iobuf fragments.
+ */
+struct shared_read_key {
+    model::ntp ntp;
+    model::offset start_offset;
+    size_t max_bytes;
+    bool strict_max_bytes;
+
+    bool operator==(const shared_read_key& o) const {
+        return ntp == o.ntp && start_offset == o.start_offset
+               && max_bytes == o.max_bytes
+               && strict_max_bytes == o.strict_max_bytes;
+    }
+};
+
+struct shared_read_key_hash {
+    size_t operator()(const shared_read_key& key) const {
+        size_t h = std::hash<model::ntp>()(key.ntp);
+        boost::hash_combine(h, std::hash<model::offset>()(key.start_offset));
+        boost::hash_combine(h, key.max_bytes);
+        boost::hash_combine(h, key.strict_max_bytes);
+        return h;
+    }
+};
+
+struct shared_read {
+    ss::shared_promise<> done;
+    std::optional<read_result> result;
+};
+
+static absl::flat_hash_map<
+  shared_read_key,
+  ss::lw_shared_ptr<shared_read>,
+  shared_read_key_hash>&
+shared_reads() {
+    static thread_local absl::flat_hash_map<
+      shared_read_key,
+      ss::lw_shared_ptr<shared_read>,
+      shared_read_key_hash>
+      map;
+    return map;
+}
+
+/**
+ * Completed reads are kept around beyond the in-flight window above. A hot
+ * tail fragment polled by many sessions gets serialized once and the shared
+ * iobuf is handed out until the partition takes a write: the watermarks pin
+ * the offset range the bytes were built from, so an entry is only reused
+ * while both match the partition's current state. The map is bounded and
+ * reset in bulk when full rather than tracking lru order.
+ */
+static constexpr size_t max_completed_reads = 1024;
+
+static absl::flat_hash_map<shared_read_key, read_result, shared_read_key_hash>&
+completed_reads() {
+    static thread_local absl::
+      flat_hash_map<shared_read_key, read_result, shared_read_key_hash>
+        map;
+    return map;
+}
+
+static read_result share_read_result(read_result& res) {
+    auto copy = read_result(res.error);
+    copy.high_watermark = res.high_watermark;
+    copy.last_stable_offset = res.last_stable_offset;
+    if (res.record_data) {
+        copy.record_data = res.record_data->share(
+          0, res.record_data->size_bytes());
+    }
+    return copy;
+}
+
+static ss::future<read_result> read_from_partition(
+  partition_wrapper pw,
+  fetch_config config,
+  const model::ntp& ntp,
+  std::optional<model::timeout_clock::time_point> deadline) {
+    // nothing to read, resolve without touching the shared read map
+    auto hw = pw.high_watermark();
+    if (hw < config.start_offset) {
+        return ss::make_ready_future<read_result>(
+          hw, pw.last_stable_offset());
+    }
+    shared_read_key key{
+      ntp, config.start_offset, config.max_bytes, config.strict_max_bytes};
+    if (auto it = completed_reads().find(key); it != completed_reads().end()) {
+        if (
+          it->second.high_watermark == hw
+          && it->second.last_stable_offset == pw.last_stable_offset()) {
+            return ss::make_ready_future<read_result>(
+              share_read_result(it->second));
+        }
+        // the partition advanced since the entry was built - a fresh read
+        // would return different bytes
+        completed_reads().erase(it);
+    }
+    if (auto it = shared_reads().find(key); it != shared_reads().end()) {
+        auto read = it->second;
+        return read->done.get_shared_future().then(
+          [read] { return share_read_result(*read->result); });
+    }
+    auto read = ss::make_lw_shared<shared_read>();
+    shared_reads().emplace(key, read);
+    return do_read_from_partition(pw, config, deadline)
+      .then_wrapped([read, key = std::move(key)](ss::future<read_result> f) {
+          // a fetch arriving from here on may observe fresh data, it must
+          // start its own read instead of attaching to this one
+          shared_reads().erase(key);
+          if (f.failed()) {
+              vlog(klog.error, "shared fetch read error: {}", f.get_exception());
+              read->result = read_result(error_code::unknown_server_error);
+          } else {
+              read->result = f.get0();
+              if (
+                read->result->error == error_code::none
+                && read->result->record_data) {
+                  if (completed_reads().size() >= max_completed_reads) {
+                      completed_reads().clear();
+                  }
+                  completed_reads().emplace(
+                    key, share_read_result(*read->result));
+              }
+          }
+          read->done.set_value();
+          return share_read_result(*read->result);
+      });
+}
+
+/**
+ * Serve a fetch that targets offsets below the local log start from the
+ * archived portion of the log. The archival service hydrates the batches
+ * from S3 and they are consumed by the same serializer as a local read.
+ */
+static ss::future<read_result> read_from_remote(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  fetch_config config,
+  std::optional<model::timeout_clock::time_point> deadline) {
+    auto hw = partition->high_watermark();
+    auto lso = partition->last_stable_offset();
+    // don't overlap with the locally available offsets
+    auto max_offset = partition->start_offset() - model::offset(1);
+    return archival::read_remote_segments(
+             partition->ntp(),
+             config.start_offset,
+             max_offset,
+             config.max_bytes)
+      .then([hw, lso, deadline](std::optional<model::record_batch_reader> rdr) {
+          if (!rdr) {
+              auto res = read_result(error_code::offset_out_of_range);
+              res.high_watermark = hw;
+              res.last_stable_offset = lso;
+              return ss::make_ready_future<read_result>(std::move(res));
+          }
+          return std::move(*rdr)
+            .consume(
+              fetch_batch_serializer(), deadline.value_or(model::no_timeout))
+            .then([hw, lso](kafka_batch_serializer::result res) {
+                return read_result(std::move(res.data), hw, lso);
             });
+      })
+      .handle_exception([hw, lso](const std::exception_ptr&) {
+          auto res = read_result(error_code::unknown_server_error);
+          res.high_watermark = hw;
+          res.last_stable_offset = lso;
+          return res;
       });
 }
 
@@ -408,6 +608,17 @@ std::optional<partition_wrapper> make_partition_wrapper(
     return partition_wrapper(partition);
 }
 
+/**
+ * Fetches are normally served by the leader. With follower fetching enabled
+ * any replica may serve them: the reader built on top of raft is clamped to
+ * the group's committed offset, so a follower never hands out records that
+ * could still be truncated away.
+ */
+static bool can_serve_fetch(const cluster::partition& p) {
+    return p.is_leader()
+           || config::shard_local_cfg().enable_follower_fetching();
+}
+
 /**
  * Entry point for reading from an ntp. This is executed on NTP home core and
  * build error responses if anything goes wrong.
@@ -416,7 +627,6 @@ ss::future<read_result> read_from_ntp(
   cluster::partition_manager& mgr,
   const model::materialized_ntp& ntp,
   fetch_config config,
-  bool foreign_read,
   std::optional<model::timeout_clock::time_point> deadline) {
     /*
      * lookup the ntp's partition
@@ -426,7 +636,7 @@ ss::future<read_result> read_from_ntp(
         return ss::make_ready_future<read_result>(
           error_code::unknown_topic_or_partition);
     }
-    if (unlikely(!partition->is_leader())) {
+    if (unlikely(!can_serve_fetch(*partition))) {
         return ss::make_ready_future<read_result>(
           error_code::not_leader_for_partition);
     }
@@ -439,96 +649,86 @@ ss::future<read_result> read_from_ntp(
     auto high_watermark = partition->high_watermark();
     auto max_offset = high_watermark < model::offset(0) ? model::offset(0)
                                                         : high_watermark;
-    if (
-      config.start_offset < partition->start_offset()
-      || config.start_offset > max_offset) {
+    if (config.start_offset > max_offset) {
         return ss::make_ready_future<read_result>(
           error_code::offset_out_of_range);
     }
+    // feeds the shard's hot partition sketch with the bytes actually
+    // served, shared reads included - every consumer that receives the
+    // data counts
+    auto record_bytes = [partition](read_result res) {
+        if (res.record_data) {
+            partition->probe().add_bytes_fetched(
+              res.record_data->size_bytes());
+        }
+        return res;
+    };
 
-    return read_from_partition(*partition_wpr, config, foreign_read, deadline);
+    if (config.start_offset < partition->start_offset()) {
+        // the offsets were trimmed by the local retention policy but the
+        // data may still be available in the archival storage
+        return read_from_remote(partition, config, deadline)
+          .then(record_bytes);
+    }
+
+    return read_from_partition(
+             *partition_wpr, config, ntp.input_ntp(), deadline)
+      .then(record_bytes);
 }
 
-static ss::future<> do_fill_fetch_responses(
+static void do_fill_fetch_responses(
   std::vector<read_result>& results,
   std::vector<op_context::response_iterator>& responses) {
     auto range = boost::irange<size_t>(0, results.size());
-    return ss::parallel_for_each(range, [&results, &responses](size_t idx) {
+    for (auto idx : range) {
         auto& res = results[idx];
         auto& resp_it = responses[idx];
-        vlog(klog.trace, "fetch reader {}", res.reader);
         // error case
-        if (!res.reader) {
+        if (!res.record_data) {
             resp_it.set(
               make_partition_response_error(res.partition, res.error));
             resp_it->partition_response->high_watermark = res.high_watermark;
             resp_it->partition_response->last_stable_offset
               = res.last_stable_offset;
-            return ss::now();
+            continue;
         }
-        return std::move(*res.reader)
-          .consume(kafka_batch_serializer(), model::no_timeout)
-          .then(
-            [hw = res.high_watermark,
-             lso = res.last_stable_offset,
-             pid = res.partition,
-             resp_it = resp_it](kafka_batch_serializer::result res) mutable {
-                fetch_response::partition_response resp{
-                  .id = pid,
-                  .error = error_code::none,
-                  .record_set = batch_reader(std::move(res.data)),
-                };
-                resp_it.set(std::move(resp));
-                resp_it->partition_response->high_watermark = hw;
-                resp_it->partition_response->last_stable_offset = lso;
-            })
-          .handle_exception(
-            [hw = res.high_watermark,
-             lso = res.last_stable_offset,
-             pid = res.partition,
-             resp_it = resp_it](const std::exception_ptr&) mutable {
-                /*
-                 * TODO: this is where we will want to
-                 * handle any storage specific errors and
-                 * translate them into kafka response
-                 * error codes.
-                 */
-                resp_it.set(make_partition_response_error(
-                  pid, error_code::unknown_server_error));
-                resp_it->partition_response->high_watermark = hw;
-                resp_it->partition_response->last_stable_offset = lso;
-            });
-    });
+        /*
+         * the record data was already serialized to the wire format on the
+         * partition's home core and shared foreign-aware; adopt it on this
+         * shard and splice it into the response
+         */
+        fetch_response::partition_response resp{
+          .id = res.partition,
+          .error = error_code::none,
+          .record_set = batch_reader(
+            iobuf::foreign_adopt(std::move(*res.record_data))),
+        };
+        resp_it.set(std::move(resp));
+        resp_it->partition_response->high_watermark = res.high_watermark;
+        resp_it->partition_response->last_stable_offset
+          = res.last_stable_offset;
+    }
 }
 
 static ss::future<> fill_fetch_responsens(
   std::vector<read_result> results,
   std::vector<op_context::response_iterator> responses) {
-    return ss::do_with(
-      std::move(responses),
-      std::move(results),
-      [](
-        std::vector<op_context::response_iterator>& responses,
-        std::vector<read_result>& results) {
-          return do_fill_fetch_responses(results, responses);
-      });
+    do_fill_fetch_responses(results, responses);
+    return ss::now();
 }
 
 static ss::future<std::vector<read_result>> fetch_ntps_in_parallel(
   cluster::partition_manager& mgr,
   std::vector<ntp_fetch_config> ntp_fetch_configs,
-  bool foreign_read,
   std::optional<model::timeout_clock::time_point> deadline) {
     return ss::do_with(
       std::move(ntp_fetch_configs),
-      [&mgr, deadline, foreign_read](
-        std::vector<ntp_fetch_config>& ntp_fetch_configs) {
+      [&mgr, deadline](std::vector<ntp_fetch_config>& ntp_fetch_configs) {
           return ssx::async_transform(
             ntp_fetch_configs,
-            [&mgr, deadline, foreign_read](ntp_fetch_config cfg) {
+            [&mgr, deadline](ntp_fetch_config cfg) {
                 auto p_id = cfg.first.source_ntp().tp.partition;
-                return read_from_ntp(
-                         mgr, cfg.first, cfg.second, foreign_read, deadline)
+                return read_from_ntp(mgr, cfg.first, cfg.second, deadline)
                   .then([p_id](read_result res) {
                       res.partition = p_id;
                       return res;
@@ -555,19 +755,26 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
         return ss::now();
     }
 
-    bool foreign_read = shard != ss::this_shard_id();
-
     // dispatch to remote core
     return octx.rctx.partition_manager()
       .invoke_on(
         shard,
         octx.ssg,
-        [foreign_read,
-         deadline = octx.deadline,
-         configs = std::move(fetch.requests)](
+        [deadline = octx.deadline, configs = std::move(fetch.requests)](
           cluster::partition_manager& mgr) mutable {
-            return fetch_ntps_in_parallel(
-              mgr, std::move(configs), foreign_read, deadline);
+            return fetch_ntps_in_parallel(mgr, std::move(configs), deadline)
+              .then([](std::vector<read_result> results) {
+                  // the serialized record data crosses back to the
+                  // connection's shard; share it foreign-aware so the pages
+                  // move without a copy and release back to this shard in
+                  // batches
+                  for (auto& res : results) {
+                      if (res.record_data) {
+                          res.record_data = res.record_data->foreign_share();
+                      }
+                  }
+                  return results;
+              });
         })
       .then([responses = std::move(fetch.responses)](
               std::vector<read_result> results) mutable {
@@ -576,14 +783,56 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
       });
 }
 
+// every partition of a wide fetch keeps at least this much of the byte
+// budget so the request makes progress even when bytes_left / partitions
+// rounds down to nothing
+static constexpr size_t min_partition_fetch_budget = 4096;
+
+/**
+ * Number of partitions the next plan execution will read from, i.e. the
+ * ones group_requests_by_shard() will not skip. Determines the per
+ * partition share of the fetch byte budget up front, so the per shard
+ * fetches can execute concurrently without sequentially drawing from a
+ * shared budget.
+ */
+static size_t count_fetchable_partitions(op_context& octx) {
+    size_t count = 0;
+    auto resp_it = octx.response_begin();
+    octx.for_each_fetch_partition(
+      [&resp_it, &octx, &count](const fetch_partition&) {
+          if (!octx.initial_fetch) {
+              bool has_enough_data
+                = !resp_it->partition_response->record_set->empty()
+                  && octx.over_min_bytes();
+              if (resp_it->partition_response->has_error() || has_enough_data) {
+                  ++resp_it;
+                  return;
+              }
+          }
+          ++count;
+          ++resp_it;
+      });
+    return count;
+}
+
 static std::vector<shard_fetch> group_requests_by_shard(op_context& octx) {
     std::vector<shard_fetch> shard_fetches(ss::smp::count);
     auto resp_it = octx.response_begin();
+    /*
+     * divide the remaining budget across the partitions that will be read,
+     * shards executing in parallel then cannot collectively overshoot it
+     */
+    size_t partition_budget = octx.bytes_left;
+    if (auto fetchable = count_fetchable_partitions(octx); fetchable > 1) {
+        partition_budget = std::max(
+          octx.bytes_left / fetchable, min_partition_fetch_budget);
+    }
     /**
      * group fetch requests by shard
      */
     octx.for_each_fetch_partition(
-      [&resp_it, &octx, &shard_fetches](const fetch_partition& fp) {
+      [&resp_it, &octx, &shard_fetches, partition_budget](
+        const fetch_partition& fp) {
           // if this is not an initial fetch we are allowed to skip
           // partions that aleready have an error or we have enough data
           if (!octx.initial_fetch) {
@@ -597,8 +846,13 @@ static std::vector<shard_fetch> group_requests_by_shard(op_context& octx) {
               }
           }
 
-          auto ntp = model::ntp(model::kafka_namespace, fp.topic, fp.partition);
-          auto materialized_ntp = model::materialized_ntp(std::move(ntp));
+          // session partitions carry the resolved ntp, only sessionless
+          // fetches have to derive it per request
+          auto materialized_ntp = fp.ntp ? *fp.ntp
+                                         : model::materialized_ntp(model::ntp(
+                                           model::kafka_namespace,
+                                           fp.topic,
+                                           fp.partition));
 
           auto shard = octx.rctx.shards().shard_for(
             materialized_ntp.source_ntp());
@@ -612,7 +866,7 @@ static std::vector<shard_fetch> group_requests_by_shard(op_context& octx) {
 
           fetch_config config{
             .start_offset = fp.fetch_offset,
-            .max_bytes = std::min(octx.bytes_left, size_t(fp.max_bytes)),
+            .max_bytes = std::min(partition_budget, size_t(fp.max_bytes)),
             .timeout = octx.deadline.value_or(model::no_timeout),
             .strict_max_bytes = octx.response_size > 0,
           };
@@ -623,6 +877,113 @@ static std::vector<shard_fetch> group_requests_by_shard(op_context& octx) {
     return shard_fetches;
 }
 
+// partition and offset a debounced fetch is waiting on
+struct wake_config {
+    model::ntp ntp;
+    model::offset offset;
+};
+
+/**
+ * Waits, on the partitions' home core, until one of the given partitions
+ * commits a batch at or past the offset a fetch is blocked on, or the timeout
+ * expires. The first wake up aborts the remaining waiters. Errors are
+ * swallowed here - a partition that disappears or loses leadership simply
+ * wakes the fetch and the next poll pass surfaces the proper error code.
+ */
+static ss::future<> wait_for_shard_data(
+  cluster::partition_manager& mgr,
+  std::vector<wake_config> configs,
+  model::timeout_clock::time_point timeout) {
+    return ss::do_with(
+      ss::abort_source{},
+      std::move(configs),
+      [&mgr, timeout](ss::abort_source& as, std::vector<wake_config>& configs) {
+          std::vector<ss::future<>> waits;
+          waits.reserve(configs.size());
+          for (auto& cfg : configs) {
+              auto partition = mgr.get(cfg.ntp);
+              if (unlikely(!partition || !can_serve_fetch(*partition))) {
+                  // state changed since the partition was polled, wake
+                  // immediately
+                  return ss::now();
+              }
+              waits.push_back(
+                partition->raft()
+                  ->events()
+                  .wait(cfg.offset, timeout, as)
+                  .then([&as] {
+                      if (!as.abort_requested()) {
+                          as.request_abort();
+                      }
+                  })
+                  .handle_exception([](const std::exception_ptr&) {}));
+          }
+          return ss::when_all_succeed(waits.begin(), waits.end());
+      });
+}
+
+/**
+ * Waits until new data is committed to one of the partitions the current
+ * fetch plan came up empty for. Waiting on raft commit index notifications
+ * instead of unconditionally sleeping lets a blocked fetch wake as soon as
+ * data arrives; the wait is still bounded by the debounce timeout so the
+ * plan is periodically re-evaluated for leadership and metadata changes
+ * that don't generate commit notifications.
+ */
+static ss::future<> wait_for_partition_data(op_context& octx) {
+    auto timeout = model::timeout_clock::now()
+                   + config::shard_local_cfg().fetch_reads_debounce_timeout();
+    if (octx.deadline) {
+        timeout = std::min(timeout, *octx.deadline);
+    }
+
+    auto done = ss::make_lw_shared<ss::promise<>>();
+    auto signaled = ss::make_lw_shared<bool>(false);
+    size_t pending = 0;
+
+    ss::shard_id shard = 0;
+    for (auto& fetch : group_requests_by_shard(octx)) {
+        auto shard_id = shard++;
+        if (fetch.empty()) {
+            continue;
+        }
+        std::vector<wake_config> configs;
+        configs.reserve(fetch.requests.size());
+        for (auto& [ntp, cfg] : fetch.requests) {
+            configs.push_back(
+              wake_config{ntp.source_ntp(), cfg.start_offset});
+        }
+        auto f = octx.rctx.partition_manager().invoke_on(
+          shard_id,
+          octx.ssg,
+          [configs = std::move(configs),
+           timeout](cluster::partition_manager& mgr) mutable {
+              return wait_for_shard_data(mgr, std::move(configs), timeout);
+          });
+        ++pending;
+        /*
+         * wake on the first shard reporting data. the remaining waits are
+         * bounded by the timeout and only capture shared wake state, so they
+         * are safe to leave running in the background.
+         */
+        (void)f.then_wrapped([done, signaled](ss::future<> f) {
+            f.ignore_ready_future();
+            if (!*signaled) {
+                *signaled = true;
+                done->set_value();
+            }
+        });
+    }
+
+    if (pending == 0) {
+        // nothing to wait on, fall back to the debounce sleep
+        return ss::sleep(std::min(
+          config::shard_local_cfg().fetch_reads_debounce_timeout(),
+          octx.request.max_wait_time));
+    }
+    return done->get_future();
+}
+
 /**
  * Process partition fetch requests.
  *
@@ -665,10 +1026,9 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
                     return ss::now();
                 }
                 octx.reset_context();
-                // debounce next read retry
-                return ss::sleep(std::min(
-                  config::shard_local_cfg().fetch_reads_debounce_timeout(),
-                  octx.request.max_wait_time));
+                // block until data arrives on one of the polled partitions
+                // (bounded by the debounce timeout) instead of sleeping
+                return wait_for_partition_data(octx);
             });
       });
 }
@@ -17,21 +17,90 @@
 
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <fmt/ostream.h>
 
 #include <string_view>
 
 namespace kafka {
 
+/*
+ * A coordinator lookup resolves to one advertised endpoint per leader
+ * node, and a reconnecting fleet re-issues the lookup for every group at
+ * once. The encoded body depends only on the leader's endpoint for the
+ * connection's listener and the request version (the handler never sets a
+ * throttle time), so cache it per leader and validate the entry against
+ * the metadata version, which bumps on any configuration or membership
+ * change.
+ */
+namespace {
+
+struct coordinator_cache_key {
+    model::node_id node;
+    ss::sstring listener;
+    api_version version;
+
+    friend bool operator==(
+      const coordinator_cache_key&, const coordinator_cache_key&)
+      = default;
+
+    template<typename H>
+    friend H AbslHashValue(H h, const coordinator_cache_key& k) {
+        return H::combine(
+          std::move(h), k.node(), std::string_view(k.listener), k.version());
+    }
+};
+
+struct cached_coordinator {
+    const cluster::metadata_cache* owner;
+    uint64_t metadata_version;
+    iobuf body;
+};
+
+absl::flat_hash_map<coordinator_cache_key, cached_coordinator>&
+local_coordinator_cache() {
+    static thread_local absl::
+      flat_hash_map<coordinator_cache_key, cached_coordinator>
+        cache;
+    return cache;
+}
+
+} // namespace
+
 static ss::future<response_ptr>
 handle_leader(request_context& ctx, model::node_id leader) {
+    coordinator_cache_key key{leader, ctx.listener(), ctx.header().version};
+    // snapshot before reading broker metadata so an update racing with the
+    // rebuild leaves a stale entry that misses, never a wrong hit
+    const uint64_t metadata_version = ctx.metadata_cache().version();
+    if (auto it = local_coordinator_cache().find(key);
+        it != local_coordinator_cache().end()
+        && it->second.owner == &ctx.metadata_cache()
+        && it->second.metadata_version == metadata_version) {
+        auto resp = std::make_unique<response>();
+        resp->buf() = it->second.body.share(0, it->second.body.size_bytes());
+        return ss::make_ready_future<response_ptr>(std::move(resp));
+    }
+
     auto broker = ctx.metadata_cache().get_broker(leader);
     if (broker) {
         auto& b = *broker;
         for (const auto& listener : b->kafka_advertised_listeners()) {
             if (listener.name == ctx.listener()) {
-                return ctx.respond(find_coordinator_response(
-                  b->id(), listener.address.host(), listener.address.port()));
+                find_coordinator_response r(
+                  b->id(), listener.address.host(), listener.address.port());
+                response resp;
+                r.encode(ctx, resp);
+                auto body = std::move(resp).release();
+                local_coordinator_cache().insert_or_assign(
+                  std::move(key),
+                  cached_coordinator{
+                    &ctx.metadata_cache(),
+                    metadata_version,
+                    body.share(0, body.size_bytes())});
+                auto out = std::make_unique<response>();
+                out->buf() = std::move(body);
+                return ss::make_ready_future<response_ptr>(std::move(out));
             }
         }
     }
@@ -66,132 +66,185 @@ struct list_offsets_ctx {
       , ssg(ssg) {}
 };
 
+/*
+ * a batch of partition offset queries destined for one shard together with
+ * the response slots their results are written into. queries are grouped by
+ * shard (mirroring the fetch plan) so each shard is entered once per request
+ * instead of once per partition - monitoring tools that list offsets across
+ * every partition of every topic otherwise pay one cross-core hop apiece.
+ */
+struct shard_list_offsets {
+    struct query {
+        model::ntp ntp;
+        model::timestamp timestamp;
+    };
+
+    void push_back(
+      model::ntp ntp, model::timestamp ts, size_t topic, size_t partition) {
+        queries.push_back(query{std::move(ntp), ts});
+        slots.emplace_back(topic, partition);
+    }
+
+    bool empty() const { return queries.empty(); }
+
+    std::vector<query> queries;
+    // (topic, partition) indexes into the response placeholders
+    std::vector<std::pair<size_t, size_t>> slots;
+};
+
+/**
+ * Answer a single offset query. Runs on the partition's home core.
+ */
 static ss::future<list_offset_partition_response> list_offsets_partition(
-  list_offsets_ctx& octx,
+  cluster::partition_manager& mgr,
+  model::ntp ntp,
   model::timestamp timestamp,
-  list_offset_topic& topic,
-  list_offset_partition& part) {
-    auto ntp = model::ntp(
-      model::kafka_namespace,
-      model::get_source_topic(topic.name),
-      part.partition_index);
-
-    auto shard = octx.rctx.shards().shard_for(ntp);
-    if (!shard) {
+  model::isolation_level isolation_lvl) {
+    auto partition = mgr.get(ntp);
+    if (!partition) {
         return ss::make_ready_future<list_offset_partition_response>(
           list_offsets_response::make_partition(
             ntp.tp.partition, error_code::unknown_topic_or_partition));
     }
 
-    return octx.rctx.partition_manager().invoke_on(
-      *shard,
-      octx.ssg,
-      [timestamp,
-       ntp = std::move(ntp),
-       isolation_lvl = model::isolation_level(
-         octx.request.data.isolation_level)](cluster::partition_manager& mgr) {
-          auto partition = mgr.get(ntp);
-          if (!partition) {
-              return ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  ntp.tp.partition, error_code::unknown_topic_or_partition));
-          }
+    if (!partition->is_leader()) {
+        return ss::make_ready_future<list_offset_partition_response>(
+          list_offsets_response::make_partition(
+            ntp.tp.partition, error_code::not_leader_for_partition));
+    }
 
-          if (!partition->is_leader()) {
-              return ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  ntp.tp.partition, error_code::not_leader_for_partition));
-          }
+    /*
+     * the responses for earliest/latest timestamp queries do not require
+     * that the actual timestamp be returned. only the offset is required.
+     */
+    if (timestamp == list_offsets_request::earliest_timestamp) {
+        return ss::make_ready_future<list_offset_partition_response>(
+          list_offsets_response::make_partition(
+            ntp.tp.partition, model::timestamp(-1), partition->start_offset()));
 
-          /*
-           * the responses for earliest/latest timestamp queries do not require
-           * that the actual timestamp be returned. only the offset is required.
-           */
-          if (timestamp == list_offsets_request::earliest_timestamp) {
-              return ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  ntp.tp.partition,
-                  model::timestamp(-1),
-                  partition->start_offset()));
+    } else if (timestamp == list_offsets_request::latest_timestamp) {
+        const auto offset = isolation_lvl
+                                == model::isolation_level::read_committed
+                              ? partition->last_stable_offset()
+                              : partition->high_watermark();
 
-          } else if (timestamp == list_offsets_request::latest_timestamp) {
-              const auto offset = isolation_lvl
-                                      == model::isolation_level::read_committed
-                                    ? partition->last_stable_offset()
-                                    : partition->high_watermark();
+        return ss::make_ready_future<list_offset_partition_response>(
+          list_offsets_response::make_partition(
+            ntp.tp.partition, model::timestamp(-1), offset));
+    }
 
+    return partition->timequery(timestamp, kafka_read_priority())
+      .then([partition, id = ntp.tp.partition](
+              std::optional<storage::timequery_result> res) {
+          if (res) {
               return ss::make_ready_future<list_offset_partition_response>(
                 list_offsets_response::make_partition(
-                  ntp.tp.partition, model::timestamp(-1), offset));
+                  id, res->time, res->offset));
           }
-
-          return partition->timequery(timestamp, kafka_read_priority())
-            .then([partition, id = ntp.tp.partition](
-                    std::optional<storage::timequery_result> res) {
-                if (res) {
-                    return ss::make_ready_future<
-                      list_offset_partition_response>(
-                      list_offsets_response::make_partition(
-                        id, res->time, res->offset));
-                }
-                return ss::make_ready_future<list_offset_partition_response>(
-                  list_offsets_response::make_partition(
-                    id, model::timestamp(-1), partition->last_stable_offset()));
-            });
+          return ss::make_ready_future<list_offset_partition_response>(
+            list_offsets_response::make_partition(
+              id, model::timestamp(-1), partition->last_stable_offset()));
       });
 }
 
-static ss::future<list_offset_topic_response>
-list_offsets_topic(list_offsets_ctx& octx, list_offset_topic& topic) {
-    std::vector<ss::future<list_offset_partition_response>> partitions;
-    partitions.reserve(topic.partitions.size());
+/**
+ * Build the per-shard query plan. Response placeholders are created for
+ * every requested partition; the ones that can be answered without leaving
+ * this core (duplicates, unknown topics, partitions with no home shard) are
+ * filled in immediately and everything else is bucketed by shard.
+ */
+static std::vector<shard_list_offsets>
+group_queries_by_shard(list_offsets_ctx& octx) {
+    std::vector<shard_list_offsets> shard_queries(ss::smp::count);
 
-    for (auto& part : topic.partitions) {
-        if (octx.request.duplicate_tp(topic.name, part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index, error_code::invalid_request)));
-            continue;
-        }
+    auto& topics = octx.request.data.topics;
+    octx.response.data.topics.reserve(topics.size());
 
-        if (!octx.rctx.metadata_cache().contains(
-              model::topic_namespace_view(
-                model::kafka_namespace, model::get_source_topic(topic.name)),
-              part.partition_index)) {
-            partitions.push_back(
-              ss::make_ready_future<list_offset_partition_response>(
-                list_offsets_response::make_partition(
-                  part.partition_index,
-                  error_code::unknown_topic_or_partition)));
-            continue;
+    for (size_t t = 0; t < topics.size(); ++t) {
+        auto& topic = topics[t];
+        list_offset_topic_response resp_topic{.name = topic.name};
+        resp_topic.partitions.resize(topic.partitions.size());
+
+        for (size_t p = 0; p < topic.partitions.size(); ++p) {
+            auto& part = topic.partitions[p];
+
+            if (octx.request.duplicate_tp(topic.name, part.partition_index)) {
+                resp_topic.partitions[p]
+                  = list_offsets_response::make_partition(
+                    part.partition_index, error_code::invalid_request);
+                continue;
+            }
+
+            if (!octx.rctx.metadata_cache().contains(
+                  model::topic_namespace_view(
+                    model::kafka_namespace,
+                    model::get_source_topic(topic.name)),
+                  part.partition_index)) {
+                resp_topic.partitions[p]
+                  = list_offsets_response::make_partition(
+                    part.partition_index,
+                    error_code::unknown_topic_or_partition);
+                continue;
+            }
+
+            auto ntp = model::ntp(
+              model::kafka_namespace,
+              model::get_source_topic(topic.name),
+              part.partition_index);
+
+            auto shard = octx.rctx.shards().shard_for(ntp);
+            if (!shard) {
+                resp_topic.partitions[p]
+                  = list_offsets_response::make_partition(
+                    part.partition_index,
+                    error_code::unknown_topic_or_partition);
+                continue;
+            }
+
+            shard_queries[*shard].push_back(
+              std::move(ntp), part.timestamp, t, p);
         }
 
-        auto pr = list_offsets_partition(octx, part.timestamp, topic, part);
-        partitions.push_back(std::move(pr));
+        octx.response.data.topics.push_back(std::move(resp_topic));
     }
 
-    return when_all_succeed(partitions.begin(), partitions.end())
-      .then([name = std::move(topic.name)](
-              std::vector<list_offset_partition_response> parts) mutable {
-          return list_offset_topic_response{
-            .name = std::move(name),
-            .partitions = std::move(parts),
-          };
-      });
+    return shard_queries;
 }
 
-static std::vector<ss::future<list_offset_topic_response>>
-list_offsets_topics(list_offsets_ctx& octx) {
-    std::vector<ss::future<list_offset_topic_response>> topics;
-    topics.reserve(octx.request.data.topics.size());
-
-    for (auto& topic : octx.request.data.topics) {
-        auto tr = list_offsets_topic(octx, topic);
-        topics.push_back(std::move(tr));
+/**
+ * Execute all of one shard's queries with a single cross-core dispatch and
+ * write the results into their response slots.
+ */
+static ss::future<> handle_shard_queries(
+  ss::shard_id shard, list_offsets_ctx& octx, shard_list_offsets queries) {
+    if (queries.empty()) {
+        return ss::now();
     }
 
-    return topics;
+    return octx.rctx.partition_manager()
+      .invoke_on(
+        shard,
+        octx.ssg,
+        [isolation_lvl = model::isolation_level(
+           octx.request.data.isolation_level),
+         queries = std::move(queries.queries)](
+          cluster::partition_manager& mgr) mutable {
+            std::vector<ss::future<list_offset_partition_response>> parts;
+            parts.reserve(queries.size());
+            for (auto& q : queries) {
+                parts.push_back(list_offsets_partition(
+                  mgr, std::move(q.ntp), q.timestamp, isolation_lvl));
+            }
+            return when_all_succeed(parts.begin(), parts.end());
+        })
+      .then([&octx, slots = std::move(queries.slots)](
+              std::vector<list_offset_partition_response> results) {
+          for (size_t i = 0; i < results.size(); ++i) {
+              auto [t, p] = slots[i];
+              octx.response.data.topics[t].partitions[p] = std::move(
+                results[i]);
+          }
+      });
 }
 
 template<>
@@ -205,10 +258,17 @@ list_offsets_handler::handle(request_context&& ctx, ss::smp_service_group ssg) {
     return ss::do_with(
       list_offsets_ctx(std::move(ctx), std::move(request), ssg),
       [](list_offsets_ctx& octx) {
-          auto topics = list_offsets_topics(octx);
-          return when_all_succeed(topics.begin(), topics.end())
-            .then([&octx](std::vector<list_offset_topic_response> topics) {
-                octx.response.data.topics = std::move(topics);
+          std::vector<ss::future<>> shards;
+          shards.reserve(ss::smp::count);
+
+          ss::shard_id shard = 0;
+          for (auto& queries : group_queries_by_shard(octx)) {
+              shards.push_back(
+                handle_shard_queries(shard++, octx, std::move(queries)));
+          }
+
+          return when_all_succeed(shards.begin(), shards.end())
+            .then([&octx] {
                 return octx.rctx.respond(std::move(octx.response));
             });
       });
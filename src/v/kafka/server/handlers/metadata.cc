@@ -22,6 +22,7 @@
 #include <seastar/core/future-util.hh>
 #include <seastar/core/thread.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <fmt/ostream.h>
 
 namespace kafka {
@@ -405,13 +406,90 @@ get_topic_metadata(request_context& ctx, metadata_request& request) {
       });
 }
 
+/**
+ * Clients with aggressive metadata refresh intervals all issue the same
+ * full-listing request, and its encoding only depends on the connection's
+ * listener, the api version and the cluster metadata itself. Cache the
+ * encoded response per (listener, version) and invalidate it by comparing
+ * metadata_cache::version() snapshots, so the steady state is an iobuf
+ * share instead of a rebuild and re-encode.
+ */
+namespace {
+
+struct response_cache_key {
+    ss::sstring listener;
+    api_version version;
+
+    friend bool
+    operator==(const response_cache_key& a, const response_cache_key& b) {
+        return a.listener == b.listener && a.version == b.version;
+    }
+
+    template<typename H>
+    friend H AbslHashValue(H h, const response_cache_key& k) {
+        return H::combine(
+          std::move(h), std::string_view(k.listener), k.version());
+    }
+};
+
+struct cached_response {
+    // the version counters restart with the application, so also remember
+    // which metadata_cache instance the entry was built against (a new
+    // instance in the same process, e.g. a test fixture, must miss)
+    const cluster::metadata_cache* owner;
+    uint64_t metadata_version;
+    iobuf body;
+};
+
+absl::flat_hash_map<response_cache_key, cached_response>&
+local_response_cache() {
+    static thread_local absl::flat_hash_map<
+      response_cache_key,
+      cached_response>
+      cache;
+    return cache;
+}
+
+ss::future<response_ptr> respond_from_cache(cached_response& cached) {
+    auto resp = std::make_unique<response>();
+    resp->buf() = cached.body.share(0, cached.body.size_bytes());
+    return ss::make_ready_future<response_ptr>(std::move(resp));
+}
+
+} // namespace
+
 template<>
 ss::future<response_ptr> metadata_handler::handle(
   request_context&& ctx, [[maybe_unused]] ss::smp_service_group g) {
+    metadata_request request;
+    request.decode(ctx);
+
+    // only full listings are cacheable: their encoding carries no
+    // per-request state (the handler never sets throttle time or the
+    // authorized-operations fields) and they cannot create topics
+    const bool cacheable = request.list_all_topics;
+    // snapshot before reading any metadata so that an update racing with
+    // the rebuild leaves a stale entry that misses, never a wrong hit
+    const uint64_t metadata_version = ctx.metadata_cache().version();
+    if (cacheable) {
+        auto it = local_response_cache().find(
+          response_cache_key{ctx.listener(), ctx.header().version});
+        if (
+          it != local_response_cache().end()
+          && it->second.owner == &ctx.metadata_cache()
+          && it->second.metadata_version == metadata_version) {
+            return respond_from_cache(it->second);
+        }
+    }
+
     return ss::do_with(
       std::move(ctx),
+      std::move(request),
       metadata_response{},
-      [](request_context& ctx, metadata_response& reply) {
+      [cacheable, metadata_version](
+        request_context& ctx,
+        metadata_request& request,
+        metadata_response& reply) {
           auto brokers = ctx.metadata_cache().all_brokers();
           for (const auto& broker : brokers) {
               for (const auto& listener :
@@ -433,13 +511,27 @@ ss::future<response_ptr> metadata_handler::handle(
           auto leader_id = ctx.metadata_cache().get_controller_leader_id();
           reply.controller_id = leader_id.value_or(model::node_id(-1));
 
-          metadata_request request;
-          request.decode(ctx);
           return get_topic_metadata(ctx, request)
             .then([&reply](std::vector<metadata_response::topic> topics) {
                 reply.topics = std::move(topics);
             })
-            .then([&ctx, &reply] { return ctx.respond(std::move(reply)); });
+            .then([&ctx, &reply, cacheable, metadata_version] {
+                return ctx.respond(std::move(reply))
+                  .then([&ctx, cacheable, metadata_version](
+                          response_ptr resp) {
+                      if (cacheable) {
+                          local_response_cache().insert_or_assign(
+                            response_cache_key{
+                              ctx.listener(), ctx.header().version},
+                            cached_response{
+                              &ctx.metadata_cache(),
+                              metadata_version,
+                              resp->buf().share(
+                                0, resp->buf().size_bytes())});
+                      }
+                      return resp;
+                  });
+            });
       });
 }
 
@@ -16,6 +16,7 @@
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
 #include "kafka/protocol/response_writer_utils.h"
+#include "kafka/server/produce_trace.h"
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -24,14 +25,17 @@
 #include "model/timestamp.h"
 #include "raft/types.h"
 #include "storage/shard_assignment.h"
+#include "utils/arena.h"
 #include "utils/remote.h"
 #include "utils/to_string.h"
+#include "vassert.h"
 #include "vlog.h"
 
 #include <seastar/core/execution_stage.hh>
 #include <seastar/core/future.hh>
 #include <seastar/util/log.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <boost/container_hash/extensions.hpp>
 #include <fmt/ostream.h>
 
@@ -76,7 +80,9 @@ void produce_request::decode(request_context& ctx) {
     for (auto& topic : topics) {
         for (auto& part : topic.partitions) {
             if (part.data) {
-                part.adapter.adapt(std::move(part.data.value()));
+                part.adapter.adapt(
+                  std::move(part.data.value()),
+                  &ctx.connection()->batch_validation());
                 if (part.adapter.batch) {
                     const auto& hdr = part.adapter.batch->header();
                     has_transactional = has_transactional
@@ -212,11 +218,31 @@ std::ostream& operator<<(std::ostream& os, const produce_response& r) {
     return os;
 }
 
+/*
+ * Per partition bookkeeping parked on the connection shard while the
+ * partition's slice of the request replicates on its home shard.
+ */
+struct pending_append {
+    model::partition_id id;
+    int32_t num_records{0};
+    produce_trace trace;
+    ss::promise<produce_response::partition> promise;
+};
+
+struct shard_batch {
+    std::vector<cluster::partition_manager::ntp_replicate> items;
+    // parallel to items
+    std::vector<pending_append> pending;
+};
+
 struct produce_ctx {
     request_context rctx;
     produce_request request;
     produce_response response;
     ss::smp_service_group ssg;
+    // every partition of the request destined for the same shard rides
+    // one cross-shard replicate call
+    absl::flat_hash_map<ss::shard_id, shard_batch> shard_batches;
 
     produce_ctx(
       request_context&& rctx,
@@ -252,53 +278,12 @@ reader_from_lcore_batch(model::record_batch&& batch) {
     return model::make_foreign_memory_record_batch_reader(std::move(batch));
 }
 
-static const failure_type<error_code>
-  not_leader_for_partition(error_code::not_leader_for_partition);
-static const failure_type<error_code>
-  out_of_order_sequence_number(error_code::out_of_order_sequence_number);
-
-/*
- * Caller is expected to catch errors that may be thrown while the kafka
- * batch is being deserialized (see reader_from_kafka_batch).
- */
-static ss::future<produce_response::partition> partition_append(
-  model::partition_id id,
-  ss::lw_shared_ptr<cluster::partition> partition,
-  model::batch_identity bid,
-  model::record_batch_reader reader,
-  int16_t acks,
-  int32_t num_records) {
-    return partition
-      ->replicate(bid, std::move(reader), acks_to_replicate_options(acks))
-      .then_wrapped(
-        [partition, id, num_records = num_records](
-          ss::future<checked<raft::replicate_result, kafka::error_code>> f) {
-            produce_response::partition p{.id = id};
-            try {
-                auto r = f.get0();
-                if (r.has_value()) {
-                    // have to subtract num_of_records - 1 as base_offset
-                    // is inclusive
-                    p.base_offset = model::offset(
-                      r.value().last_offset() - (num_records - 1));
-                    p.error = error_code::none;
-                    partition->probe().add_records_produced(num_records);
-                } else if (r == not_leader_for_partition) {
-                    p.error = error_code::not_leader_for_partition;
-                } else if (r == out_of_order_sequence_number) {
-                    p.error = error_code::out_of_order_sequence_number;
-                } else {
-                    p.error = error_code::unknown_server_error;
-                }
-            } catch (...) {
-                p.error = error_code::unknown_server_error;
-            }
-            return p;
-        });
-}
-
 /**
  * \brief handle writing to a single topic partition.
+ *
+ * The partition's batch is queued into its home shard's slice of the
+ * request; the returned future resolves once dispatch_shard_batches has
+ * routed the replicate result back to the connection shard.
  */
 static ss::future<produce_response::partition> produce_topic_partition(
   produce_ctx& octx,
@@ -340,36 +325,84 @@ static ss::future<produce_response::partition> produce_topic_partition(
     auto bid = model::batch_identity::from(hdr);
 
     auto num_records = batch.record_count();
+    auto num_bytes = batch.size_bytes();
     auto reader = reader_from_lcore_batch(std::move(batch));
-    return octx.rctx.partition_manager().invoke_on(
-      *shard,
-      octx.ssg,
-      [reader = std::move(reader),
-       ntp = std::move(ntp),
-       num_records,
-       bid,
-       acks = octx.request.acks](cluster::partition_manager& mgr) mutable {
-          auto partition = mgr.get(ntp);
-          if (!partition) {
-              return ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .id = ntp.tp.partition,
-                  .error = error_code::unknown_topic_or_partition});
-          }
-          if (unlikely(!partition->is_leader())) {
-              return ss::make_ready_future<produce_response::partition>(
-                produce_response::partition{
-                  .id = ntp.tp.partition,
-                  .error = error_code::not_leader_for_partition});
-          }
-          return partition_append(
-            ntp.tp.partition,
-            partition,
-            bid,
-            std::move(reader),
-            acks,
-            num_records);
-      });
+    auto trace = local_produce_tracer().maybe_trace(ntp);
+
+    auto& sb = octx.shard_batches[*shard];
+    sb.items.push_back(cluster::partition_manager::ntp_replicate{
+      .ntp = std::move(ntp),
+      .bid = bid,
+      .reader = std::move(reader),
+      .opts = acks_to_replicate_options(octx.request.acks),
+      .num_records = num_records,
+      .num_bytes = num_bytes});
+    sb.pending.push_back(pending_append{
+      .id = part.id,
+      .num_records = num_records,
+      .trace = std::move(trace)});
+    return sb.pending.back().promise.get_future();
+}
+
+/*
+ * Ship every shard's slice of the request in a single cross-shard
+ * replicate call. The continuation resolves the per-partition promises
+ * back on the connection shard; it owns everything it touches so the
+ * produce context is free to die once the last promise is set.
+ */
+static void dispatch_shard_batches(produce_ctx& octx) {
+    using results_t
+      = std::vector<checked<raft::replicate_result, kafka::error_code>>;
+    for (auto& e : octx.shard_batches) {
+        auto& batch = e.second;
+        for (auto& p : batch.pending) {
+            p.trace.record("replicate_begin");
+        }
+        (void)octx.rctx.partition_manager()
+          .invoke_on(
+            e.first,
+            octx.ssg,
+            [items = std::move(batch.items)](
+              cluster::partition_manager& mgr) mutable {
+                return mgr.replicate(std::move(items));
+            })
+          .then_wrapped([pending = std::move(batch.pending)](
+                          ss::future<results_t> f) mutable {
+              results_t results;
+              try {
+                  results = f.get0();
+              } catch (...) {
+                  for (auto& p : pending) {
+                      p.promise.set_value(produce_response::partition{
+                        .id = p.id,
+                        .error = error_code::unknown_server_error});
+                  }
+                  return;
+              }
+              vassert(
+                results.size() == pending.size(),
+                "replicate returned {} results for {} items",
+                results.size(),
+                pending.size());
+              for (size_t i = 0; i < results.size(); ++i) {
+                  auto& p = pending[i];
+                  p.trace.record("replicate_end");
+                  p.trace.finish();
+                  produce_response::partition resp{.id = p.id};
+                  if (results[i].has_value()) {
+                      // have to subtract num_of_records - 1 as base_offset
+                      // is inclusive
+                      resp.base_offset = model::offset(
+                        results[i].value().last_offset()
+                        - (p.num_records - 1));
+                      resp.error = error_code::none;
+                  } else {
+                      resp.error = results[i].error();
+                  }
+                  p.promise.set_value(std::move(resp));
+              }
+          });
+    }
 }
 
 /**
@@ -377,7 +410,10 @@ static ss::future<produce_response::partition> produce_topic_partition(
  */
 static ss::future<produce_response::topic>
 produce_topic(produce_ctx& octx, produce_request::topic& topic) {
-    std::vector<ss::future<produce_response::partition>> partitions;
+    // transient dispatch state, dies before the response flushes
+    arena_vector<ss::future<produce_response::partition>> partitions(
+      arena_allocator<ss::future<produce_response::partition>>(
+        octx.rctx.request_arena()));
     partitions.reserve(topic.partitions.size());
 
     for (auto& part : topic.partitions) {
@@ -429,9 +465,11 @@ produce_topic(produce_ctx& octx, produce_request::topic& topic) {
 /**
  * \brief Dispatch and collect topic produce responses
  */
-static std::vector<ss::future<produce_response::topic>>
+static arena_vector<ss::future<produce_response::topic>>
 produce_topics(produce_ctx& octx) {
-    std::vector<ss::future<produce_response::topic>> topics;
+    arena_vector<ss::future<produce_response::topic>> topics(
+      arena_allocator<ss::future<produce_response::topic>>(
+        octx.rctx.request_arena()));
     topics.reserve(octx.request.topics.size());
 
     for (auto& topic : octx.request.topics) {
@@ -485,6 +523,9 @@ produce_handler::handle(request_context&& ctx, ss::smp_service_group ssg) {
 
           // dispatch produce requests for each topic
           auto topics = produce_topics(octx);
+          // everything is bucketed by shard now - one replicate call per
+          // shard resolves the partition futures collected above
+          dispatch_shard_batches(octx);
 
           // collect topic responses
           return when_all_succeed(topics.begin(), topics.end())
@@ -93,6 +93,18 @@ cluster::topic_configuration to_cluster_type(const creatable_topic& t) {
       config_entries, "retention.bytes");
     cfg.retention_duration = get_tristate_value<std::chrono::milliseconds>(
       config_entries, "retention.ms");
+    // relaxed-fsync durability thresholds, writes to topics with either of
+    // them set are acknowledged before fdatasync
+    if (auto v = get_config_value<int64_t>(config_entries, "flush.ms"); v) {
+        cfg.flush_interval = std::chrono::milliseconds(*v);
+    }
+    cfg.flush_bytes = get_config_value<size_t>(config_entries, "flush.bytes");
+    // in-memory topics are replicated but never persisted; bound them with
+    // retention.bytes/retention.ms
+    if (auto it = config_entries.find("redpanda.in.memory");
+        it != config_entries.end()) {
+        cfg.in_memory = it->second == "true" || it->second == "1";
+    }
 
     return cfg;
 }
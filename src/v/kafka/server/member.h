@@ -17,6 +17,7 @@
 #include "kafka/protocol/sync_group.h"
 #include "kafka/types.h"
 #include "utils/concepts-enabled.h"
+#include "utils/timer_wheel.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -221,7 +222,9 @@ public:
         _latest_heartbeat = t;
     }
 
-    ss::timer<clock_type>& expire_timer() { return _expire_timer; }
+    /// session expiry slot on the group coordinator's timer wheel; armed
+    /// and cancelled by the owning group
+    timer_wheel<clock_type>::entry& expire_entry() { return _expire_entry; }
 
     // helper for kafka api: describe groups
     described_group_member describe(const kafka::protocol_name&) const;
@@ -238,7 +241,7 @@ private:
 
     bool _is_new;
     clock_type::time_point _latest_heartbeat;
-    ss::timer<clock_type> _expire_timer;
+    timer_wheel<clock_type>::entry _expire_entry;
 
     // external shutdown synchronization
     std::unique_ptr<sync_promise> _sync_promise;
@@ -0,0 +1,47 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/produce_trace.h"
+
+#include <seastar/core/lowres_clock.hh>
+
+namespace kafka {
+
+void produce_trace::finish() {
+    if (!_enabled) {
+        return;
+    }
+    _enabled = false;
+    auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+      ss::lowres_system_clock::now().time_since_epoch());
+    local_produce_tracer().publish(produce_tracer::completed_trace{
+      .ntp = std::move(_ntp),
+      .completed_at = model::timestamp(now.count()),
+      .stages = std::move(_stages),
+    });
+}
+
+void produce_tracer::publish(completed_trace trace) {
+    if (_traces.size() >= capacity) {
+        _traces.pop_front();
+    }
+    _traces.push_back(std::move(trace));
+}
+
+std::vector<produce_tracer::completed_trace>
+produce_tracer::snapshot() const {
+    std::vector<completed_trace> ret;
+    ret.reserve(_traces.size());
+    for (const auto& t : _traces) {
+        ret.push_back(t);
+    }
+    return ret;
+}
+
+} // namespace kafka
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "model/fundamental.h"
+#include "model/timestamp.h"
+#include "seastarx.h"
+
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/sstring.hh>
+
+#include <chrono>
+#include <vector>
+
+namespace kafka {
+
+/// Sampled end-to-end produce tracing. Roughly one in
+/// produce_tracer::sample_rate partition writes gets a trace; the trace
+/// records a timestamp per stage and the completed trace lands in a small
+/// per-shard ring buffer exposed by the admin API under
+/// /v1/kafka/produce_traces. Unsampled requests only pay a counter
+/// increment, sampled ones a handful of clock reads.
+///
+/// The trace is created on the shard that handles the kafka connection
+/// and travels with the write to the partition's home core; steady clock
+/// timestamps are comparable across cores so the stage durations stay
+/// meaningful.
+class produce_trace {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    struct stage {
+        ss::sstring name;
+        std::chrono::microseconds elapsed;
+    };
+
+    /// disabled trace, all operations are no-ops
+    produce_trace() = default;
+    explicit produce_trace(model::ntp ntp)
+      : _enabled(true)
+      , _ntp(std::move(ntp))
+      , _begin(clock_type::now()) {}
+
+    explicit operator bool() const { return _enabled; }
+
+    /// records the time elapsed since the trace was created
+    void record(const char* name) {
+        if (_enabled) {
+            _stages.push_back(stage{
+              .name = name,
+              .elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                clock_type::now() - _begin)});
+        }
+    }
+
+    /// publishes the trace to the current shard's ring buffer
+    void finish();
+
+private:
+    friend class produce_tracer;
+
+    bool _enabled{false};
+    model::ntp _ntp;
+    clock_type::time_point _begin;
+    std::vector<stage> _stages;
+};
+
+class produce_tracer {
+public:
+    /// one traced write per this many partition writes
+    static constexpr uint64_t sample_rate = 10000;
+    /// completed traces retained per shard
+    static constexpr size_t capacity = 64;
+
+    struct completed_trace {
+        model::ntp ntp;
+        model::timestamp completed_at;
+        std::vector<produce_trace::stage> stages;
+    };
+
+    /// returns an enabled trace for ~1/sample_rate calls, a disabled one
+    /// otherwise
+    produce_trace maybe_trace(const model::ntp& ntp) {
+        if (++_count % sample_rate == 0) {
+            return produce_trace(ntp);
+        }
+        return produce_trace();
+    }
+
+    void publish(completed_trace);
+
+    /// copy of the ring buffer contents, oldest first
+    std::vector<completed_trace> snapshot() const;
+
+private:
+    uint64_t _count{0};
+    ss::circular_buffer<completed_trace> _traces;
+};
+
+inline produce_tracer& local_produce_tracer() {
+    static thread_local produce_tracer tracer;
+    return tracer;
+}
+
+} // namespace kafka
@@ -34,6 +34,8 @@ namespace kafka {
 
 protocol::protocol(
   ss::smp_service_group smp,
+  ss::scheduling_group fetch_sg,
+  ss::scheduling_group admin_sg,
   ss::sharded<cluster::metadata_cache>& meta,
   ss::sharded<cluster::topics_frontend>& tf,
   ss::sharded<quota_manager>& quota,
@@ -45,6 +47,8 @@ protocol::protocol(
   ss::sharded<cluster::id_allocator_frontend>& id_allocator_frontend,
   ss::sharded<credential_store>& credentials) noexcept
   : _smp_group(smp)
+  , _fetch_sg(fetch_sg)
+  , _admin_sg(admin_sg)
   , _topics_frontend(tf)
   , _metadata_cache(meta)
   , _quota_mgr(quota)
@@ -74,7 +78,20 @@ ss::future<> protocol::apply(rpc::server::resources rs) {
     return ss::do_until(
              [ctx] { return ctx->is_finished_parsing(); },
              [ctx] { return ctx->process_one_request(); })
-      .finally([ctx] {});
+      .finally([ctx] {
+          const auto& load = ctx->load();
+          vlog(
+            klog.debug,
+            "Connection {} closed after {}ms: {} requests, {} bytes in, {} "
+            "bytes out",
+            ctx->client_addr(),
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+              ss::lowres_clock::now() - load.established_at)
+              .count(),
+            load.requests,
+            load.bytes_received,
+            load.bytes_sent);
+      });
 }
 
 } // namespace kafka
@@ -15,18 +15,26 @@
 #include "config/configuration.h"
 #include "kafka/security/credential_store.h"
 #include "kafka/server/fwd.h"
+#include "kafka/types.h"
 #include "rpc/server.h"
+#include "utils/timer_wheel.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
+#include <memory>
+
 namespace kafka {
 
 class protocol final : public rpc::server::protocol {
 public:
     protocol(
       ss::smp_service_group,
+      ss::scheduling_group fetch_sg,
+      ss::scheduling_group admin_sg,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<cluster::topics_frontend>&,
       ss::sharded<quota_manager>&,
@@ -50,6 +58,17 @@ public:
     ss::future<> apply(rpc::server::resources) final;
 
     ss::smp_service_group smp_group() const { return _smp_group; }
+
+    /**
+     * Scheduling group an api should execute in. Fetch and admin/metadata
+     * apis run in dedicated groups so metadata chattiness can't steal cpu
+     * from produce, and fetch churn can be throttled independently.
+     * Everything else (notably the group membership protocol) stays in the
+     * connection's group: heartbeats must not be starved behind a deflated
+     * admin group or consumer groups start expiring.
+     */
+    ss::scheduling_group scheduling_group_for(api_key) const;
+
     cluster::topics_frontend& topics_frontend() {
         return _topics_frontend.local();
     }
@@ -73,10 +92,21 @@ public:
     quota_manager& quota_mgr() { return _quota_mgr.local(); }
     bool is_idempotence_enabled() { return _is_idempotence_enabled; }
 
+    /**
+     * Per-shard wheel that connections park throttled requests on. One
+     * reactor timer drives all of a shard's throttle delays, so a throttle
+     * storm arms list entries rather than thousands of reactor timers.
+     * Delays quantize up to the tick, which for throttling only slows the
+     * offending client down a little more.
+     */
+    timer_wheel<ss::lowres_clock>& throttle_wheel() { return *_throttle_wheel; }
+
     credential_store& credentials() { return _credentials.local(); }
 
 private:
     ss::smp_service_group _smp_group;
+    ss::scheduling_group _fetch_sg;
+    ss::scheduling_group _admin_sg;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
     ss::sharded<cluster::metadata_cache>& _metadata_cache;
     ss::sharded<quota_manager>& _quota_mgr;
@@ -88,6 +118,10 @@ private:
     ss::sharded<cluster::id_allocator_frontend>& _id_allocator_frontend;
     bool _is_idempotence_enabled{false};
     ss::sharded<kafka::credential_store>& _credentials;
+    // indirection keeps the protocol movable; the wheel itself is pinned
+    std::unique_ptr<timer_wheel<ss::lowres_clock>> _throttle_wheel
+      = std::make_unique<timer_wheel<ss::lowres_clock>>(
+        std::chrono::milliseconds(10));
 };
 
 } // namespace kafka
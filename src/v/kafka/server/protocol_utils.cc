@@ -11,6 +11,7 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "vassert.h"
 
 #include <seastar/core/temporary_buffer.hh>
 
@@ -70,6 +71,43 @@ parse_header(ss::input_stream<char>& src) {
       });
 }
 
+std::optional<request_header> parse_header(iobuf_parser& parser) {
+    constexpr int16_t no_client_id = -1;
+    if (parser.bytes_left() < sizeof(raw_request_header)) {
+        return std::nullopt;
+    }
+    auto header = request_header{
+      .key = api_key(parser.consume_be_type<int16_t>()),
+      .version = api_version(parser.consume_be_type<int16_t>()),
+      .correlation = correlation_id(parser.consume_be_type<int32_t>())};
+    auto client_id_size = parser.consume_be_type<int16_t>();
+    if (client_id_size == 0) {
+        header.client_id = std::string_view();
+        return header;
+    }
+    if (client_id_size == no_client_id) {
+        return header;
+    }
+    if (unlikely(client_id_size < 0)) {
+        // header parsing error, force connection shutdown
+        throw std::runtime_error(
+          fmt::format("Invalid client_id size {}", client_id_size));
+    }
+    if (parser.bytes_left() < size_t(client_id_size)) {
+        throw std::runtime_error(
+          fmt::format("Unexpected EOF for client ID"));
+    }
+    // the client id is tiny and must be contiguous for the string_view, so
+    // it is the one part of the frame worth copying out
+    auto buf = ss::temporary_buffer<char>(client_id_size);
+    parser.consume_to(client_id_size, buf.get_write());
+    header.client_id_buffer = std::move(buf);
+    header.client_id = std::string_view(
+      header.client_id_buffer.get(), header.client_id_buffer.size());
+    validate_utf8(*header.client_id);
+    return header;
+}
+
 size_t parse_size_buffer(ss::temporary_buffer<char>& buf) {
     auto* raw = ss::unaligned_cast<const int32_t*>(buf.get());
     int32_t size = be_to_cpu(*raw);
@@ -120,4 +158,31 @@ ss::scattered_message<char> response_as_scattered(response_ptr response) {
     return msg;
 }
 
+std::vector<ss::scattered_message<char>>
+response_as_write_chunks(response_ptr response, size_t chunk_bytes) {
+    vassert(
+      response.get_owner_shard() == ss::this_shard_id(),
+      "chunked response write frees fragments on the writing shard and "
+      "requires a local response");
+    auto correlation = response->correlation();
+    auto buf = std::move(*response).release();
+    auto header = ss::temporary_buffer<char>(sizeof(raw_response_header));
+    // NOLINTNEXTLINE
+    auto* raw_header = reinterpret_cast<raw_response_header*>(
+      header.get_write());
+    auto size = int32_t(sizeof(correlation) + buf.size_bytes());
+    raw_header->size = ss::cpu_to_be(size);
+    raw_header->correlation = ss::cpu_to_be(correlation());
+    buf.prepend(std::move(header));
+    std::vector<ss::scattered_message<char>> chunks;
+    chunks.reserve(buf.size_bytes() / chunk_bytes + 1);
+    while (!buf.empty()) {
+        auto sz = std::min(buf.size_bytes(), chunk_bytes);
+        auto chunk = buf.share(0, sz);
+        buf.trim_front(sz);
+        chunks.push_back(iobuf_as_scattered(std::move(chunk)));
+    }
+    return chunks;
+}
+
 } // namespace kafka
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "bytes/iobuf_parser.h"
 #include "kafka/server/request_context.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
@@ -20,15 +21,29 @@
 #include <seastar/core/temporary_buffer.hh>
 
 #include <optional>
+#include <vector>
 
 namespace kafka {
 
 // TODO: move to iobuf_parser
 ss::future<std::optional<request_header>> parse_header(ss::input_stream<char>&);
 
+/// parse a request header out of an already buffered frame. returns
+/// std::nullopt when the frame is too short to hold a header
+std::optional<request_header> parse_header(iobuf_parser&);
+
 size_t parse_size_buffer(ss::temporary_buffer<char>&);
 ss::future<std::optional<size_t>> parse_size(ss::input_stream<char>&);
 
 ss::scattered_message<char> response_as_scattered(response_ptr response);
 
+/// the same wire image as response_as_scattered, broken into scattered
+/// messages of at most chunk_bytes. each chunk owns only its share of the
+/// response buffer, so writing the chunks back to back lets a large
+/// response release memory as the socket accepts it instead of staying
+/// pinned whole until the final byte is written. the response must live
+/// on this shard: the chunks free their fragments locally
+std::vector<ss::scattered_message<char>>
+response_as_write_chunks(response_ptr response, size_t chunk_bytes);
+
 } // namespace kafka
@@ -17,17 +17,9 @@ namespace kafka {
 using clock = quota_manager::clock;
 using throttle_delay = quota_manager::throttle_delay;
 
-quota_manager::~quota_manager() { _gc_timer.cancel(); }
+ss::future<> quota_manager::stop() { return ss::make_ready_future<>(); }
 
-ss::future<> quota_manager::stop() {
-    _gc_timer.cancel();
-    return ss::make_ready_future<>();
-}
-
-ss::future<> quota_manager::start() {
-    _gc_timer.arm_periodic(_gc_freq);
-    return ss::make_ready_future<>();
-}
+ss::future<> quota_manager::start() { return ss::make_ready_future<>(); }
 
 // record a new observation and return <previous delay, new delay>
 throttle_delay quota_manager::record_tp_and_throttle(
@@ -38,38 +30,44 @@ throttle_delay quota_manager::record_tp_and_throttle(
     // shares a default quota. the anonymous group is keyed on empty string.
     auto cid = client_id ? *client_id : "";
 
-    // find or create the throughput tracker for this client
-    //
-    // c++20: heterogeneous lookup for unordered_map can avoid creation of
-    // an sstring here but std::unordered_map::find isn't using an
-    // equal_to<> overload. this is a general issue we'll be looking at. for
-    // now, these client-name strings are small. This will be solved in
-    // c++20 via Hash::transparent_key_equal.
-    auto [it, inserted] = _quotas.try_emplace(
-      ss::sstring(cid),
-      quota{
-        now,
-        clock::duration(0),
-        {_default_num_windows, _default_window_width}});
-
-    // bump to prevent gc
-    if (!inserted) {
+    // find or create the throughput tracker for this client. the transparent
+    // hash/eq on the map lets the lookup run directly on the string_view, so
+    // an sstring is only materialized when a new client is first seen.
+    auto it = _quotas.find(cid);
+    if (it == _quotas.end()) {
+        // the table only grows here, so expiring stale clients before the
+        // insertion bounds its size without any work on the steady-state path
+        maybe_gc(now);
+        // the old windowed tracker averaged over num_windows * width, so
+        // the same product becomes the estimator's time constant and the
+        // two config knobs keep their meaning
+        it = _quotas
+               .emplace(
+                 ss::sstring(cid),
+                 quota{
+                   now,
+                   clock::duration(0),
+                   rate_estimator(
+                     _default_num_windows * _default_window_width)})
+               .first;
+    } else {
+        // bump to prevent gc
         it->second.last_seen = now;
     }
 
     auto rate = it->second.tp_rate.record_and_measure(bytes, now);
 
     uint64_t delay_ms = 0;
-    if (rate > _target_tp_rate) {
-        auto diff = rate - _target_tp_rate;
+    if (rate > _target_tp_rate()) {
+        auto diff = rate - _target_tp_rate();
         double delay
-          = (diff / _target_tp_rate)
+          = (diff / _target_tp_rate())
             * (double)std::chrono::duration_cast<std::chrono::milliseconds>(
-                it->second.tp_rate.window_size())
+                _default_window_width)
                 .count();
         delay_ms = static_cast<uint64_t>(delay);
     }
-    if (delay_ms > (uint64_t)_max_delay.count()) {
+    if (delay_ms > (uint64_t)_max_delay().count()) {
         vlog(
           klog.info,
           "Found data rate for window of: {} bytes. Client:{}, Estimated "
@@ -77,8 +75,8 @@ throttle_delay quota_manager::record_tp_and_throttle(
           rate,
           cid,
           delay_ms,
-          _max_delay.count());
-        delay_ms = _max_delay.count();
+          _max_delay().count());
+        delay_ms = _max_delay().count();
     }
 
     auto prev = it->second.delay;
@@ -90,10 +88,14 @@ throttle_delay quota_manager::record_tp_and_throttle(
     return res;
 }
 // erase inactive tracked quotas. windows are considered inactive if they
-// have not received any updates in ten window's worth of time.
-void quota_manager::gc(clock::duration full_window) {
-    auto now = clock::now();
-    auto expire_age = full_window * 10;
+// have not received any updates in ten window's worth of time. the sweep
+// runs at most once per gc period and only when a new client is inserted.
+void quota_manager::maybe_gc(clock::time_point now) {
+    if (now < _next_gc) {
+        return;
+    }
+    _next_gc = now + _gc_freq;
+    auto expire_age = _default_num_windows * _default_window_width * 10;
     // c++20: replace with std::erase_if
     absl::erase_if(
       _quotas, [now, expire_age](const std::pair<ss::sstring, quota>& q) {
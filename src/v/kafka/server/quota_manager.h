@@ -13,13 +13,14 @@
 #include "config/configuration.h"
 #include "resource_mgmt/rate.h"
 #include "seastarx.h"
+#include "utils/cached_clock.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/sstring.hh>
-#include <seastar/core/timer.hh>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
 
 #include <chrono>
 #include <optional>
@@ -56,19 +57,17 @@ public:
     quota_manager()
       : _default_num_windows(config::shard_local_cfg().default_num_windows())
       , _default_window_width(config::shard_local_cfg().default_window_sec())
-      , _target_tp_rate(config::shard_local_cfg().target_quota_byte_rate())
+      , _target_tp_rate(config::shard_local_cfg().target_quota_byte_rate.bind())
       , _gc_freq(config::shard_local_cfg().quota_manager_gc_sec())
-      , _max_delay(config::shard_local_cfg().max_kafka_throttle_delay_ms()) {
-        auto full_window = _default_num_windows * _default_window_width;
-        _gc_timer.set_callback([this, full_window] { gc(full_window); });
-    }
+      , _max_delay(
+          config::shard_local_cfg().max_kafka_throttle_delay_ms.bind()) {}
 
     quota_manager(const quota_manager&) = delete;
     quota_manager& operator=(const quota_manager&) = delete;
     quota_manager(quota_manager&&) = delete;
     quota_manager& operator=(quota_manager&&) = delete;
 
-    ~quota_manager();
+    ~quota_manager() = default;
 
     ss::future<> stop();
 
@@ -78,12 +77,12 @@ public:
     throttle_delay record_tp_and_throttle(
       std::optional<std::string_view> client_id,
       uint64_t bytes,
-      clock::time_point now = clock::now());
+      clock::time_point now = cached_clock::now());
 
 private:
-    // erase inactive tracked quotas. windows are considered inactive if they
-    // have not received any updates in ten window's worth of time.
-    void gc(clock::duration full_window);
+    // erase inactive tracked quotas. amortized over new-client insertions,
+    // which are the only operations that grow the table.
+    void maybe_gc(clock::time_point now);
 
 private:
     // last_seen: used for gc keepalive
@@ -92,18 +91,35 @@ private:
     struct quota {
         clock::time_point last_seen;
         clock::duration delay;
-        rate_tracker tp_rate;
+        rate_estimator tp_rate;
+    };
+
+    // transparent hash/eq let the per-request client-id string_view probe
+    // the table directly without materializing an sstring on the hot path
+    struct quota_hash {
+        using is_transparent = void;
+        size_t operator()(std::string_view v) const {
+            return absl::Hash<std::string_view>{}(v);
+        }
+    };
+    struct quota_eq {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const {
+            return a == b;
+        }
     };
 
     const std::size_t _default_num_windows;
     const clock::duration _default_window_width;
 
-    const uint32_t _target_tp_rate;
-    absl::flat_hash_map<ss::sstring, quota> _quotas;
+    // bindings track runtime config updates, so the per-request reads below
+    // stay plain member loads
+    config::binding<uint32_t> _target_tp_rate;
+    absl::flat_hash_map<ss::sstring, quota, quota_hash, quota_eq> _quotas;
 
-    ss::timer<> _gc_timer;
     const clock::duration _gc_freq;
-    const clock::duration _max_delay;
+    clock::time_point _next_gc;
+    config::binding<std::chrono::milliseconds> _max_delay;
 };
 
 } // namespace kafka
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/temporary_buffer.hh>
+
+namespace kafka {
+
+/**
+ * Buffered view over a connection's input stream that frames are sliced out
+ * of instead of read one by one. The stream hands over its chunks wholesale:
+ * a client pipelining many requests into one tcp segment delivers them all
+ * in a single buffer handoff, and each frame is carved out as shared iobuf
+ * views with no per-request allocation or copy. The chunks themselves are
+ * recycled by the stream's buffer management once every frame sharing them
+ * has been processed.
+ */
+class recv_buffer {
+public:
+    explicit recv_buffer(ss::input_stream<char>& src)
+      : _src(src) {}
+
+    /**
+     * Buffer at least n bytes from the stream. Returns false if the stream
+     * reaches eof before n bytes are available.
+     */
+    ss::future<bool> ensure(size_t n) {
+        if (_buf.size_bytes() >= n) {
+            return ss::make_ready_future<bool>(true);
+        }
+        return _src.read().then([this, n](ss::temporary_buffer<char> chunk) {
+            if (chunk.empty()) {
+                return ss::make_ready_future<bool>(false);
+            }
+            _buf.append(std::move(chunk));
+            return ensure(n);
+        });
+    }
+
+    /**
+     * Detach the first n buffered bytes as shared views. The caller must
+     * have ensure()d that n bytes are available.
+     */
+    iobuf consume_shared(size_t n) {
+        auto head = _buf.share(0, n);
+        _buf.trim_front(n);
+        return head;
+    }
+
+    size_t buffered() const { return _buf.size_bytes(); }
+
+private:
+    ss::input_stream<char>& _src;
+    iobuf _buf;
+};
+
+} // namespace kafka
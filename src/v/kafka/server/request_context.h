@@ -92,6 +92,11 @@ public:
 
     request_reader& reader() { return _reader; }
 
+    /// per-connection scratch arena; see connection_context::request_arena
+    /// for the lifetime rules. only use it for state that dies with the
+    /// request
+    arena& request_arena() { return _conn->request_arena(); }
+
     const cluster::metadata_cache& metadata_cache() const {
         return _conn->server().metadata_cache();
     }
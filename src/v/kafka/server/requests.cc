@@ -167,6 +167,33 @@ handle_auth(request_context&& ctx, ss::smp_service_group g) {
     }
 }
 
+ss::scheduling_group protocol::scheduling_group_for(api_key key) const {
+    switch (key) {
+    case fetch_handler::api::key:
+        return _fetch_sg;
+    case api_versions_handler::api::key:
+    case metadata_handler::api::key:
+    case list_groups_handler::api::key:
+    case list_offsets_handler::api::key:
+    case create_topics_handler::api::key:
+    case describe_configs_handler::api::key:
+    case alter_configs_handler::api::key:
+    case delete_topics_handler::api::key:
+    case describe_groups_handler::api::key:
+    case incremental_alter_configs_handler::api::key:
+    case delete_groups_handler::api::key:
+    case describe_acls_handler::api::key:
+        return _admin_sg;
+    default:
+        /*
+         * produce, the group membership protocol, offset management and
+         * auth run wherever the connection runs. unknown keys too: they
+         * fail in process_request with the usual error path.
+         */
+        return ss::current_scheduling_group();
+    }
+}
+
 ss::future<response_ptr>
 process_request(request_context&& ctx, ss::smp_service_group g) {
     /*
@@ -167,15 +167,10 @@ FIXTURE_TEST(read_from_ntp_max_bytes, redpanda_thread_fixture) {
             shard,
             [ntp, config](cluster::partition_manager& pm) {
                 return kafka::read_from_ntp(
-                  pm,
-                  model::materialized_ntp(ntp),
-                  config,
-                  true,
-                  model::no_timeout);
+                  pm, model::materialized_ntp(ntp), config, model::no_timeout);
             })
           .then([](kafka::read_result res) {
-              return std::move(*res.reader)
-                .consume(kafka::kafka_batch_serializer(), model::no_timeout);
+              return std::move(*res.record_data);
           })
           .get0();
     };
@@ -192,10 +187,10 @@ FIXTURE_TEST(read_from_ntp_max_bytes, redpanda_thread_fixture) {
           });
     }).get();
 
-    auto zero = do_read(ntp, 0).data.size_bytes();
-    auto one = do_read(ntp, 1).data.size_bytes();
+    auto zero = do_read(ntp, 0).size_bytes();
+    auto one = do_read(ntp, 1).size_bytes();
     auto maxlimit
-      = do_read(ntp, std::numeric_limits<size_t>::max()).data.size_bytes();
+      = do_read(ntp, std::numeric_limits<size_t>::max()).size_bytes();
 
     BOOST_TEST(zero > 0); // read something
     BOOST_TEST(zero == one);
@@ -44,7 +44,9 @@ static bool is_uuid(const ss::sstring& uuid) {
  */
 static group get() {
     static config::configuration conf;
-    return group(kafka::group_id("g"), group_state::empty, conf, nullptr);
+    static timer_wheel<group::clock_type> timeouts;
+    return group(
+      kafka::group_id("g"), group_state::empty, conf, nullptr, timeouts);
 }
 
 static const std::vector<member_protocol> test_group_protos = {
@@ -428,6 +430,38 @@ SEASTAR_THREAD_TEST_CASE(leader_rejoined) {
     BOOST_TEST(g.leader() == "n");
 }
 
+SEASTAR_THREAD_TEST_CASE(static_member_tracking) {
+    auto g = get();
+
+    auto m0 = ss::make_lw_shared<group_member>(
+      kafka::member_id("m0"),
+      kafka::group_id("g"),
+      kafka::group_instance_id("i0"),
+      std::chrono::seconds(1),
+      std::chrono::milliseconds(2),
+      kafka::protocol_type("p"),
+      test_group_protos);
+
+    // dynamic member - no instance id
+    auto m1 = ss::make_lw_shared<group_member>(
+      kafka::member_id("m1"),
+      kafka::group_id("g"),
+      std::nullopt,
+      std::chrono::seconds(1),
+      std::chrono::milliseconds(2),
+      kafka::protocol_type("p"),
+      test_group_protos);
+
+    (void)g.add_member(m0);
+    (void)g.add_member(m1);
+
+    BOOST_TEST(g.contains_static_member(kafka::group_instance_id("i0")));
+    BOOST_TEST(!g.contains_static_member(kafka::group_instance_id("i1")));
+
+    g.remove_member(m0);
+    BOOST_TEST(!g.contains_static_member(kafka::group_instance_id("i0")));
+}
+
 SEASTAR_THREAD_TEST_CASE(generate_member_id) {
     join_group_request r;
 
@@ -44,6 +44,9 @@ BOOST_AUTO_TEST_CASE(test_all_additional_options) {
         {"retention.bytes", "-1"},
         {"retention.ms", "86400000"},
         {"compaction.strategy", "header"},
+        {"flush.ms", "500"},
+        {"flush.bytes", "262144"},
+        {"redpanda.in.memory", "true"},
       }};
 
     auto cluster_tp_config = to_cluster_type(all_options);
@@ -67,4 +70,8 @@ BOOST_AUTO_TEST_CASE(test_all_additional_options) {
       cluster_tp_config.cleanup_policy_bitflags,
       model::cleanup_policy_bitflags::compaction
         | model::cleanup_policy_bitflags::deletion);
+    BOOST_REQUIRE_EQUAL(
+      cluster_tp_config.flush_interval.value().count(), (500ms).count());
+    BOOST_REQUIRE_EQUAL(cluster_tp_config.flush_bytes.value(), 262144);
+    BOOST_REQUIRE_EQUAL(cluster_tp_config.in_memory, true);
 }
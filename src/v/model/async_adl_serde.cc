@@ -12,39 +12,75 @@
 #include "model/adl_serde.h"
 #include "model/record_batch_reader.h"
 
+#include <seastar/core/do_with.hh>
+#include <seastar/core/future-util.hh>
+
 namespace reflection {
-/**
- * My moving the individual record_batches into a std::vector, we can take
- * advantage of the async_adl<std::vector<T>> template specializtion.
+
+/*
+ * Bound on the number of batch bytes encoded or decoded between reactor
+ * suspension points. Readers carrying multi-MB payloads (recovery, partition
+ * movement) must not monopolize the shard for the whole (de)serialization.
  */
+static constexpr size_t max_synchronous_serialize_bytes = 128 * 1024;
+
+// wire format matches async_adl<std::vector<model::record_batch>>: an
+// int32_t batch count followed by adl-encoded batches
 ss::future<> async_adl<model::record_batch_reader>::to(
   iobuf& out, model::record_batch_reader&& reader) {
     return model::consume_reader_to_memory(std::move(reader), model::no_timeout)
-      .then([&out](ss::circular_buffer<model::record_batch> data) {
-          std::vector<model::record_batch> batches;
-          batches.reserve(data.size());
-          std::transform(
-            std::make_move_iterator(data.begin()),
-            std::make_move_iterator(data.end()),
-            std::back_inserter(batches),
-            [](model::record_batch&& rb) { return std::move(rb); });
-          return async_adl<std::vector<model::record_batch>>{}.to(
-            out, std::move(batches));
+      .then([&out](ss::circular_buffer<model::record_batch> batches) {
+          reflection::serialize<int32_t>(out, batches.size());
+          return ss::do_with(
+            std::move(batches),
+            size_t{0},
+            [&out](
+              ss::circular_buffer<model::record_batch>& batches,
+              size_t& bytes_since_yield) {
+                return ss::do_for_each(
+                  batches,
+                  [&out, &bytes_since_yield](model::record_batch& batch) {
+                      bytes_since_yield += batch.size_bytes();
+                      reflection::serialize(out, std::move(batch));
+                      if (
+                        bytes_since_yield >= max_synchronous_serialize_bytes) {
+                          bytes_since_yield = 0;
+                          return ss::later();
+                      }
+                      return ss::now();
+                  });
+            });
       });
 }
 
 ss::future<model::record_batch_reader>
 async_adl<model::record_batch_reader>::from(iobuf_parser& in) {
-    return async_adl<std::vector<model::record_batch>>{}.from(in).then(
-      [](std::vector<model::record_batch> batches) {
-          ss::circular_buffer<model::record_batch> cbuffer;
-          cbuffer.reserve(batches.size());
-          std::transform(
-            std::make_move_iterator(batches.begin()),
-            std::make_move_iterator(batches.end()),
-            std::back_inserter(cbuffer),
-            [](model::record_batch&& rb) { return std::move(rb); });
-          return model::make_memory_record_batch_reader(std::move(cbuffer));
+    const auto size = adl<int32_t>{}.from(in);
+    return ss::do_with(
+      ss::circular_buffer<model::record_batch>{},
+      size_t{0},
+      [&in, size](
+        ss::circular_buffer<model::record_batch>& batches,
+        size_t& bytes_since_yield) {
+          batches.reserve(size);
+          return ss::do_until(
+                   [&batches, size] {
+                       return batches.size() == size_t(size);
+                   },
+                   [&in, &batches, &bytes_since_yield] {
+                       batches.push_back(adl<model::record_batch>{}.from(in));
+                       bytes_since_yield += batches.back().size_bytes();
+                       if (
+                         bytes_since_yield >= max_synchronous_serialize_bytes) {
+                           bytes_since_yield = 0;
+                           return ss::later();
+                       }
+                       return ss::now();
+                   })
+            .then([&batches] {
+                return model::make_memory_record_batch_reader(
+                  std::move(batches));
+            });
       });
 }
 
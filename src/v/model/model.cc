@@ -14,7 +14,7 @@
 #include "model/record.h"
 #include "model/timestamp.h"
 #include "model/validation.h"
-#include "utils/string_switch.h"
+#include "utils/static_string_map.h"
 #include "utils/to_string.h"
 
 #include <seastar/core/print.hh>
@@ -244,12 +244,15 @@ std::filesystem::path ntp::topic_path() const {
 std::istream& operator>>(std::istream& i, compression& c) {
     ss::sstring s;
     i >> s;
-    c = string_switch<compression>(s)
-          .match_all("none", "uncompressed", compression::none)
-          .match("gzip", compression::gzip)
-          .match("snappy", compression::snappy)
-          .match("lz4", compression::lz4)
-          .match("zstd", compression::zstd);
+    static constexpr auto values = make_static_string_map<compression>({
+      {"none", compression::none},
+      {"uncompressed", compression::none},
+      {"gzip", compression::gzip},
+      {"snappy", compression::snappy},
+      {"lz4", compression::lz4},
+      {"zstd", compression::zstd},
+    });
+    c = values.at(s);
     return i;
 }
 
@@ -312,19 +315,23 @@ std::ostream& operator<<(std::ostream& o, compaction_strategy c) {
 std::istream& operator>>(std::istream& i, compaction_strategy& cs) {
     ss::sstring s;
     i >> s;
-    cs = string_switch<compaction_strategy>(s)
-           .match("offset", compaction_strategy::offset)
-           .match("header", compaction_strategy::header)
-           .match("timestamp", compaction_strategy::timestamp);
+    static constexpr auto values = make_static_string_map<compaction_strategy>({
+      {"offset", compaction_strategy::offset},
+      {"header", compaction_strategy::header},
+      {"timestamp", compaction_strategy::timestamp},
+    });
+    cs = values.at(s);
     return i;
 };
 
 std::istream& operator>>(std::istream& i, timestamp_type& ts_type) {
     ss::sstring s;
     i >> s;
-    ts_type = string_switch<timestamp_type>(s)
-                .match("LogAppendTime", timestamp_type::append_time)
-                .match("CreateTime", timestamp_type::create_time);
+    static constexpr auto values = make_static_string_map<timestamp_type>({
+      {"LogAppendTime", timestamp_type::append_time},
+      {"CreateTime", timestamp_type::create_time},
+    });
+    ts_type = values.at(s);
     return i;
 };
 
@@ -350,14 +357,18 @@ std::ostream& operator<<(std::ostream& o, cleanup_policy_bitflags c) {
 std::istream& operator>>(std::istream& i, cleanup_policy_bitflags& cp) {
     ss::sstring s;
     i >> s;
-    cp = string_switch<cleanup_policy_bitflags>(s)
-           .match("delete", cleanup_policy_bitflags::deletion)
-           .match("compact", cleanup_policy_bitflags::compaction)
-           .match_all(
-             "compact,delete",
-             "delete,compact",
-             cleanup_policy_bitflags::deletion
-               | cleanup_policy_bitflags::compaction);
+    static constexpr auto values
+      = make_static_string_map<cleanup_policy_bitflags>({
+        {"delete", cleanup_policy_bitflags::deletion},
+        {"compact", cleanup_policy_bitflags::compaction},
+        {"compact,delete",
+         cleanup_policy_bitflags::deletion
+           | cleanup_policy_bitflags::compaction},
+        {"delete,compact",
+         cleanup_policy_bitflags::deletion
+           | cleanup_policy_bitflags::compaction},
+      });
+    cp = values.at(s);
     return i;
 }
 
@@ -25,6 +25,7 @@
 #include <seastar/util/optimized_optional.hh>
 
 #include <memory>
+#include <optional>
 #include <variant>
 
 namespace model {
@@ -84,6 +85,14 @@ public:
 
         virtual ss::future<> finally() noexcept { return ss::now(); }
 
+        /// true when both the current slice and any prefetched slice are
+        /// exhausted. do_load_slice may reach the end of the underlying
+        /// stream while the prefetched data is still unconsumed, so
+        /// is_end_of_stream alone is not sufficient with readahead on
+        bool no_more_slices() const {
+            return !_readahead.has_value() && is_end_of_stream();
+        }
+
         /// Meant for non-owning iteration of the data. If you need to own the
         /// batches, please use consume() below
         template<typename ReferenceConsumer>
@@ -100,6 +109,15 @@ public:
               });
         }
 
+    protected:
+        /// fetch the next slice in the background while the current one is
+        /// consumed, as long as the current slice holds fewer than
+        /// window_bytes. hides the disk read boundary from sequential
+        /// consumers; enabled by implementations that load slices from disk
+        void enable_readahead(size_t window_bytes) {
+            _readahead_window = window_bytes;
+        }
+
     private:
         record_batch pop_batch() {
             return ss::visit(
@@ -116,11 +134,57 @@ public:
               });
         }
         ss::future<> load_slice(timeout_clock::time_point timeout) {
-            return do_load_slice(timeout).then([this](storage_t s) {
+            auto f = _readahead ? std::move(
+                       *std::exchange(_readahead, std::nullopt))
+                                : do_load_slice(timeout);
+            return f.then([this, timeout](storage_t s) {
                 // reassign the local cache
                 _slice = std::move(s);
+                maybe_start_readahead(timeout);
             });
         }
+        void maybe_start_readahead(timeout_clock::time_point timeout) {
+            if (
+              _readahead_window == 0 || is_end_of_stream()
+              || slice_bytes() >= _readahead_window) {
+                return;
+            }
+            _readahead = do_load_slice(timeout);
+        }
+        size_t slice_bytes() const {
+            auto sum = [](const data_t& d) {
+                size_t bytes = 0;
+                for (const auto& b : d) {
+                    bytes += b.size_bytes();
+                }
+                return bytes;
+            };
+            return ss::visit(
+              _slice,
+              [sum](const data_t& d) { return sum(d); },
+              [sum](const foreign_data_t& d) { return sum(*d.buffer); });
+        }
+        /// a prefetch that is still in flight when consumption stops must
+        /// be waited out before the consumer regains control - destroying
+        /// the impl with do_load_slice running would be use-after-free. the
+        /// result is kept so a follow up consume() call can still use it
+        ss::future<> drain_readahead() {
+            if (
+              !_readahead
+              || (_readahead->available() && !_readahead->failed())) {
+                return ss::now();
+            }
+            return std::exchange(_readahead, std::nullopt)
+              ->then_wrapped([this](ss::future<storage_t> f) {
+                  if (f.failed()) {
+                      // nobody is consuming; the next load will rediscover
+                      // any persistent error
+                      f.ignore_ready_future();
+                      return;
+                  }
+                  _readahead = ss::make_ready_future<storage_t>(f.get0());
+              });
+        }
         template<typename ReferenceConsumer>
         auto do_for_each_ref(
           ReferenceConsumer& refc, timeout_clock::time_point timeout) {
@@ -155,16 +219,19 @@ public:
                        if (likely(!is_slice_empty())) {
                            return fn(consumer);
                        }
-                       if (is_end_of_stream()) {
+                       if (no_more_slices()) {
                            return ss::make_ready_future<ss::stop_iteration>(
                              ss::stop_iteration::yes);
                        }
                        return load_slice(timeout).then(
                          [] { return ss::stop_iteration::no; });
                    })
+              .finally([this] { return drain_readahead(); })
               .then([&consumer] { return consumer.end_of_stream(); });
         }
         storage_t _slice;
+        size_t _readahead_window{0};
+        std::optional<ss::future<storage_t>> _readahead;
     };
 
 public:
@@ -177,7 +244,7 @@ public:
     ~record_batch_reader() noexcept = default;
 
     bool is_end_of_stream() const {
-        return _impl->is_slice_empty() && _impl->is_end_of_stream();
+        return _impl->is_slice_empty() && _impl->no_more_slices();
     }
 
     /// \brief Intended for non-owning iteration of the data
@@ -14,17 +14,28 @@
 #include "reflection/adl.h"
 #include "utils/vint.h"
 
-namespace model {
+#include <array>
+#include <cstring>
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_le(crc32& crc, T i) {
-    auto j = ss::cpu_to_le(i);
-    crc.extend(j);
-}
+namespace model {
 
+/*
+ * the hardware crc kernels pay a dispatch cost per extend() call, which
+ * dominates when fed the 2-8 byte header fields one at a time. fold all of
+ * the fixed-size fields into a single stack buffer and issue one extend
+ * over the contiguous bytes instead.
+ */
 template<typename... T>
 void crc_extend_all_cpu_to_le(crc32& crc, T... t) {
-    ((crc_extend_cpu_to_le(crc, t)), ...);
+    static_assert((std::is_integral_v<T> && ...));
+    std::array<uint8_t, (sizeof(T) + ...)> buf;
+    size_t pos = 0;
+    auto append = [&buf, &pos](auto v) {
+        std::memcpy(buf.data() + pos, &v, sizeof(v));
+        pos += sizeof(v);
+    };
+    ((append(ss::cpu_to_le(t))), ...);
+    crc.extend(buf.data(), buf.size());
 }
 
 /// \brief uint32_t because that's what crc32c uses
@@ -52,15 +63,17 @@ uint32_t internal_header_only_crc(const record_batch_header& header) {
     return c.value();
 }
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_be(crc32& crc, T i) {
-    auto j = ss::cpu_to_be(i);
-    crc.extend(j);
-}
-
 template<typename... T>
 void crc_extend_all_cpu_to_be(crc32& crc, T... t) {
-    ((crc_extend_cpu_to_be(crc, t)), ...);
+    static_assert((std::is_integral_v<T> && ...));
+    std::array<uint8_t, (sizeof(T) + ...)> buf;
+    size_t pos = 0;
+    auto append = [&buf, &pos](auto v) {
+        std::memcpy(buf.data() + pos, &v, sizeof(v));
+        pos += sizeof(v);
+    };
+    ((append(ss::cpu_to_be(t))), ...);
+    crc.extend(buf.data(), buf.size());
 }
 
 void crc_record_batch_header(crc32& crc, const record_batch_header& header) {
@@ -88,6 +88,41 @@ ss::circular_buffer<model::record_batch> make_batches(Offsets... o) {
     return batches;
 }
 
+// hands out one batch per slice so every slice boundary exercises the
+// readahead machinery, including the prefetch that discovers end of stream
+// while buffered data is still unconsumed
+class readahead_slice_source final : public record_batch_reader::impl {
+public:
+    explicit readahead_slice_source(ss::circular_buffer<record_batch> batches)
+      : _batches(std::move(batches)) {
+        enable_readahead(128 * 1024);
+    }
+
+    bool is_end_of_stream() const final { return _batches.empty(); }
+
+    ss::future<record_batch_reader::storage_t>
+    do_load_slice(timeout_clock::time_point) final {
+        record_batch_reader::data_t slice;
+        if (!_batches.empty()) {
+            slice.push_back(std::move(_batches.front()));
+            _batches.pop_front();
+        }
+        return ss::make_ready_future<record_batch_reader::storage_t>(
+          std::move(slice));
+    }
+
+    void print(std::ostream& os) final { os << "{readahead slice source}"; }
+
+private:
+    ss::circular_buffer<record_batch> _batches;
+};
+
+record_batch_reader
+make_readahead_reader(ss::circular_buffer<record_batch> batches) {
+    return make_record_batch_reader<readahead_slice_source>(
+      std::move(batches));
+}
+
 record_batch_reader
 make_generating_reader(ss::circular_buffer<record_batch> batches) {
     return make_generating_record_batch_reader(
@@ -146,6 +181,11 @@ void do_test_interrupt_consume(record_batch_reader reader) {
     BOOST_CHECK_EQUAL(batches.size(), 0);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_consume_with_readahead) {
+    do_test_consume(make_readahead_reader(
+      make_batches(offset(1), offset(2), offset(3), offset(4))));
+}
+
 SEASTAR_THREAD_TEST_CASE(test_interrupt_consume) {
     do_test_interrupt_consume(make_memory_record_batch_reader(
       make_batches(offset(1), offset(2), offset(3), offset(4), offset(5))));
@@ -155,6 +195,13 @@ SEASTAR_THREAD_TEST_CASE(test_interrupt_consume_multiple_slices) {
     do_test_interrupt_consume(make_generating_reader(
       make_batches(offset(1), offset(2), offset(3), offset(4), offset(5))));
 }
+SEASTAR_THREAD_TEST_CASE(test_interrupt_consume_with_readahead) {
+    // a prefetched slice must survive an interrupted consume and be handed
+    // to the next one
+    do_test_interrupt_consume(make_readahead_reader(
+      make_batches(offset(1), offset(2), offset(3), offset(4), offset(5))));
+}
+
 SEASTAR_THREAD_TEST_CASE(record_batch_sharing) {
     auto v1 = make_batches(
       offset(1), offset(2), offset(3), offset(4), offset(5));
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "kafka/protocol/fetch.h"
+#include "pandaproxy/json/requests/produce.h"
+#include "pandaproxy/json/rjson_util.h"
+#include "seastarx.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace pandaproxy::binary {
+
+/**
+ * Raw binary produce body: a sequence of records with no envelope around
+ * them, each encoded as
+ *
+ *   partition  int32, big endian, -1 leaves the choice to the proxy
+ *   key_size   int32, big endian, -1 for null
+ *   key        key_size bytes
+ *   value_size int32, big endian, -1 for null
+ *   value      value_size bytes
+ *
+ * Payload bytes are shared out of the body buffer as iobufs, there is no
+ * per-record decode or re-encode step.
+ */
+inline std::vector<json::record> parse_produce_body(std::string_view body) {
+    iobuf buf;
+    buf.append(body.data(), body.size());
+    iobuf_parser parser(std::move(buf));
+
+    auto read_sized = [&parser]() -> std::optional<iobuf> {
+        if (parser.bytes_left() < sizeof(int32_t)) {
+            throw json::parse_error(parser.bytes_consumed());
+        }
+        auto size = parser.consume_be_type<int32_t>();
+        if (size < 0) {
+            return std::nullopt;
+        }
+        if (static_cast<size_t>(size) > parser.bytes_left()) {
+            throw json::parse_error(parser.bytes_consumed());
+        }
+        return parser.share(size);
+    };
+
+    std::vector<json::record> records;
+    while (parser.bytes_left() > 0) {
+        if (parser.bytes_left() < sizeof(int32_t)) {
+            throw json::parse_error(parser.bytes_consumed());
+        }
+        auto raw_id = parser.consume_be_type<int32_t>();
+        auto id = raw_id < 0 ? std::optional<model::partition_id>{}
+                             : std::optional{model::partition_id(raw_id)};
+        auto key = read_sized();
+        auto value = read_sized();
+        records.push_back(json::record{
+          .id = id, .key = std::move(key), .value = std::move(value)});
+    }
+    return records;
+}
+
+/**
+ * Raw binary fetch body: the record batches exactly as they arrived from
+ * the broker - kafka wire format, concatenated across partitions. Errors
+ * are reported via an error reply instead, so a 200 body is all data.
+ */
+inline ss::sstring serialize_fetch_body(kafka::fetch_response res) {
+    iobuf all;
+    for (auto& part : res.partitions) {
+        for (auto& p : part.responses) {
+            if (p.record_set) {
+                all.append(std::move(*p.record_set).release());
+            }
+        }
+    }
+    ss::sstring body(ss::sstring::initialized_later{}, all.size_bytes());
+    size_t written = 0;
+    iobuf::iterator_consumer it(all.cbegin(), all.cend());
+    it.consume(all.size_bytes(), [&body, &written](const char* src, size_t sz) {
+        std::copy_n(src, sz, body.data() + written);
+        written += sz;
+        return ss::stop_iteration::no;
+    });
+    return body;
+}
+
+} // namespace pandaproxy::binary
@@ -0,0 +1,103 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/binary/requests.h"
+
+#include "bytes/iobuf_parser.h"
+#include "kafka/protocol/batch_reader.h"
+#include "kafka/protocol/fetch.h"
+#include "seastarx.h"
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+namespace ppb = pandaproxy::binary;
+
+namespace {
+
+void append_be(ss::sstring& out, int32_t v) {
+    auto be = ss::cpu_to_be(v);
+    // NOLINTNEXTLINE
+    out.append(reinterpret_cast<const char*>(&be), sizeof(be));
+}
+
+void append_record(
+  ss::sstring& out,
+  int32_t partition,
+  std::optional<std::string_view> key,
+  std::optional<std::string_view> value) {
+    append_be(out, partition);
+    append_be(out, key ? int32_t(key->size()) : int32_t(-1));
+    if (key) {
+        out.append(key->data(), key->size());
+    }
+    append_be(out, value ? int32_t(value->size()) : int32_t(-1));
+    if (value) {
+        out.append(value->data(), value->size());
+    }
+}
+
+ss::sstring linearize(iobuf buf) {
+    iobuf_parser parser(std::move(buf));
+    return parser.read_string(parser.bytes_left());
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_parse_produce_body) {
+    ss::sstring body;
+    append_record(body, 0, std::nullopt, "vectorized");
+    append_record(body, 1, "k", "pandaproxy");
+    append_record(body, -1, "k", "unassigned");
+
+    auto records = ppb::parse_produce_body(body);
+    BOOST_REQUIRE_EQUAL(records.size(), 3);
+
+    BOOST_REQUIRE(records[0].id == model::partition_id(0));
+    BOOST_TEST(!records[0].key);
+    BOOST_REQUIRE(records[0].value);
+    BOOST_TEST(linearize(std::move(*records[0].value)) == "vectorized");
+
+    BOOST_REQUIRE(records[1].id == model::partition_id(1));
+    BOOST_REQUIRE(records[1].key);
+    BOOST_TEST(linearize(std::move(*records[1].key)) == "k");
+    BOOST_REQUIRE(records[1].value);
+    BOOST_TEST(linearize(std::move(*records[1].value)) == "pandaproxy");
+
+    // -1 leaves partition selection to the proxy
+    BOOST_REQUIRE(!records[2].id.has_value());
+
+    BOOST_TEST(ppb::parse_produce_body("").empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_parse_produce_body_truncated) {
+    ss::sstring body;
+    append_record(body, 0, std::nullopt, "vectorized");
+    body.resize(body.size() - 1);
+
+    BOOST_REQUIRE_THROW(
+      ppb::parse_produce_body(body), pandaproxy::json::parse_error);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_serialize_fetch_body) {
+    iobuf batches;
+    batches.append("not-really-a-batch", 18);
+
+    kafka::fetch_response res;
+    res.partitions.emplace_back(model::topic("t"));
+    res.partitions.back().responses.push_back(
+      kafka::fetch_response::partition_response{
+        .id = model::partition_id(0),
+        .error = kafka::error_code::none,
+        .record_set = kafka::batch_reader(
+          batches.share(0, batches.size_bytes()))});
+
+    auto body = ppb::serialize_fetch_body(std::move(res));
+    BOOST_TEST(body == "not-really-a-batch");
+}
@@ -9,7 +9,10 @@
 
 #include "handlers.h"
 
+#include "bytes/iobuf.h"
+#include "json/iobuf_ostream.h"
 #include "kafka/client/exceptions.h"
+#include "kafka/client/partitioner.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/protocol/leave_group.h"
@@ -18,6 +21,7 @@
 #include "kafka/protocol/schemata/offset_commit_request.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
+#include "pandaproxy/binary/requests.h"
 #include "pandaproxy/configuration.h"
 #include "pandaproxy/json/requests/create_consumer.h"
 #include "pandaproxy/json/requests/fetch.h"
@@ -63,6 +67,12 @@ ppj::serialization_format parse_serialization_format(std::string_view accept) {
         return ppj::serialization_format::binary_v2;
     }
 
+    if (std::any_of(results.begin(), results.end(), [](std::string_view v) {
+            return v == "application/vnd.kafka.binary.v2";
+        })) {
+        return ppj::serialization_format::raw_binary;
+    }
+
     if (std::any_of(
           results.begin(), results.end(), [&none](std::string_view lhs) {
               return std::any_of(
@@ -102,6 +112,43 @@ get_topics_names(server::request_t rq, server::reply_t rp) {
       });
 }
 
+/**
+ * Assemble a raw binary fetch reply: the record batches are handed back in
+ * kafka wire format straight from the client response. A partition error
+ * turns into an error reply because the body framing has no room for it.
+ */
+static server::reply_t
+write_binary_fetch_body(server::reply_t rp, kafka::fetch_response res) {
+    for (const auto& part : res.partitions) {
+        for (const auto& p : part.responses) {
+            if (p.has_error()) {
+                rp.rep = errored_body(
+                  ss::httpd::reply::status_type::bad_request,
+                  fmt::format("fetch error: {}", p.error));
+                return rp;
+            }
+        }
+    }
+    rp.rep->write_body("bin", binary::serialize_fetch_body(std::move(res)));
+    rp.mime_type = "application/vnd.kafka.binary.v2";
+    return rp;
+}
+
+// Stream a serialized json document as the response body, without
+// linearizing it into a contiguous string first.
+static void write_json_body(server::reply_t& rp, iobuf buf) {
+    rp.rep->write_body(
+      "json", [buf{std::move(buf)}](ss::output_stream<char>&& os) mutable {
+          return ss::do_with(
+            std::move(os),
+            std::move(buf),
+            [](ss::output_stream<char>& os, iobuf& buf) {
+                return write_iobuf_to_output_stream(std::move(buf), os)
+                  .then([&os]() { return os.close(); });
+            });
+      });
+}
+
 ss::future<server::reply_t>
 get_topics_records(server::request_t rq, server::reply_t rp) {
     auto fmt = parse_serialization_format(rq.req->get_header("Accept"));
@@ -126,62 +173,117 @@ get_topics_records(server::request_t rq, server::reply_t rp) {
     return rq.ctx.client
       .fetch_partition(std::move(tp), offset, max_bytes, timeout)
       .then([fmt, rp = std::move(rp)](kafka::fetch_response res) mutable {
-          rapidjson::StringBuffer str_buf;
-          rapidjson::Writer<rapidjson::StringBuffer> w(str_buf);
+          if (fmt == ppj::serialization_format::raw_binary) {
+              return write_binary_fetch_body(std::move(rp), std::move(res));
+          }
+
+          iobuf json_rslt;
+          ::json::iobuf_ostream os{json_rslt};
+          rapidjson::Writer<::json::iobuf_ostream> w(os);
 
           ppj::rjson_serialize_fmt(fmt)(w, std::move(res));
+          os.Flush();
 
-          // TODO Ben: Prevent this linearization
-          ss::sstring json_rslt = str_buf.GetString();
-          rp.rep->write_body("json", json_rslt);
+          write_json_body(rp, std::move(json_rslt));
           return std::move(rp);
       });
 }
 
 ss::future<server::reply_t>
 post_topics_name(server::request_t rq, server::reply_t rp) {
-    auto fmt = parse_serialization_format(rq.req->get_header("Accept"));
-    if (fmt == ppj::serialization_format::unsupported) {
-        rp.rep = unprocessable_entity("Unsupported serialization format");
-        return ss::make_ready_future<server::reply_t>(std::move(rp));
-    }
-
-    auto raw_records = ppj::rjson_parse(
-      rq.req->content.data(), ppj::produce_request_handler(fmt));
-
-    absl::flat_hash_map<model::partition_id, storage::record_batch_builder>
-      partition_builders;
-
-    for (auto& r : raw_records) {
-        auto it = partition_builders
-                    .try_emplace(r.id, raft::data_batch_type, model::offset(0))
-                    .first;
-        it->second.add_raw_kv(
-          std::move(r.key).value_or(iobuf{}),
-          std::move(r.value).value_or(iobuf{}));
-    }
-
-    std::vector<kafka::produce_request::partition> partitions;
-    partitions.reserve(partition_builders.size());
-    for (auto& pb : partition_builders) {
-        partitions.emplace_back(kafka::produce_request::partition{
-          .id = pb.first,
-          .data = {},
-          .adapter = kafka::kafka_batch_adapter{
-            .v2_format = true,
-            .valid_crc = true,
-            .batch = std::move(pb.second).build()}});
+    std::vector<ppj::record> raw_records;
+    // raw binary bodies are declared by the content type; everything else
+    // carries the json envelope and the record format comes from Accept
+    auto body_fmt = parse_serialization_format(
+      rq.req->get_header("Content-Type"));
+    if (body_fmt == ppj::serialization_format::raw_binary) {
+        raw_records = binary::parse_produce_body(rq.req->content);
+    } else {
+        auto fmt = parse_serialization_format(rq.req->get_header("Accept"));
+        if (
+          fmt == ppj::serialization_format::unsupported
+          || fmt == ppj::serialization_format::raw_binary) {
+            rp.rep = unprocessable_entity("Unsupported serialization format");
+            return ss::make_ready_future<server::reply_t>(std::move(rp));
+        }
+
+        raw_records = ppj::rjson_parse(
+          rq.req->content.data(), ppj::produce_request_handler(fmt));
     }
 
     auto topic = model::topic(rq.req->param["topic_name"]);
-    return ssx::parallel_transform(
-             std::move(partitions),
-             [topic,
-              rq{std::move(rq)}](kafka::produce_request::partition p) mutable {
-                 return rq.ctx.client.produce_record_batch(
-                   model::topic_partition(topic, p.id),
-                   std::move(*p.adapter.batch));
-             })
+
+    // records the request does not address explicitly are placed by the
+    // proxy: keyed ones with kafka's default key partitioning so they
+    // interleave correctly with other clients, keyless ones round-robin;
+    // both need the topic's partition count from metadata
+    auto needs_selection = std::any_of(
+      raw_records.begin(), raw_records.end(), [](const ppj::record& r) {
+          return !r.id.has_value();
+      });
+    auto count_fut = needs_selection
+                       ? rq.ctx.client.topic_partition_count(topic)
+                       : ss::make_ready_future<size_t>(size_t(0));
+
+    return count_fut
+      .then([topic, rq{std::move(rq)}, raw_records{std::move(raw_records)}](
+              size_t n_partitions) mutable {
+          std::vector<const iobuf*> keys;
+          for (const auto& r : raw_records) {
+              if (!r.id.has_value()) {
+                  keys.push_back(r.key.has_value() ? &*r.key : nullptr);
+              }
+          }
+          // all the keys needing selection are hashed in one batched call
+          auto selected = kafka::client::partitions_for_keys(
+            keys, n_partitions);
+
+          // keyless records are spread across partitions; shard-local so
+          // consecutive single-record requests don't pile up on one
+          static thread_local uint32_t next_keyless{0};
+
+          absl::flat_hash_map<model::partition_id, storage::record_batch_builder>
+            partition_builders;
+
+          auto s_it = selected.begin();
+          for (auto& r : raw_records) {
+              auto id = r.id.value_or(model::partition_id(0));
+              if (!r.id.has_value()) {
+                  auto sel = *s_it++;
+                  id = sel.has_value() ? *sel
+                                       : model::partition_id(int32_t(
+                                         next_keyless++ % n_partitions));
+              }
+              auto it = partition_builders
+                          .try_emplace(
+                            id, raft::data_batch_type, model::offset(0))
+                          .first;
+              it->second.add_raw_kv(
+                std::move(r.key).value_or(iobuf{}),
+                std::move(r.value).value_or(iobuf{}));
+          }
+
+          std::vector<kafka::produce_request::partition> partitions;
+          partitions.reserve(partition_builders.size());
+          for (auto& pb : partition_builders) {
+              partitions.emplace_back(kafka::produce_request::partition{
+                .id = pb.first,
+                .data = {},
+                .adapter = kafka::kafka_batch_adapter{
+                  .v2_format = true,
+                  .valid_crc = true,
+                  .batch = std::move(pb.second).build()}});
+          }
+
+          return ssx::parallel_transform(
+            std::move(partitions),
+            [topic,
+             rq{std::move(rq)}](kafka::produce_request::partition p) mutable {
+                return rq.ctx.client.produce_record_batch(
+                  model::topic_partition(topic, p.id),
+                  std::move(*p.adapter.batch));
+            });
+      })
       .then([topic, rp{std::move(rp)}](auto responses) mutable {
           std::vector<kafka::produce_response::topic> topics;
           topics.push_back(kafka::produce_response::topic{
@@ -263,14 +365,18 @@ consumer_fetch(server::request_t rq, server::reply_t rp) {
 
     return rq.ctx.client.consumer_fetch(group_id, member_id, timeout, max_bytes)
       .then([fmt, rp{std::move(rp)}](kafka::fetch_response res) mutable {
-          rapidjson::StringBuffer str_buf;
-          rapidjson::Writer<rapidjson::StringBuffer> w(str_buf);
+          if (fmt == ppj::serialization_format::raw_binary) {
+              return write_binary_fetch_body(std::move(rp), std::move(res));
+          }
+
+          iobuf json_rslt;
+          ::json::iobuf_ostream os{json_rslt};
+          rapidjson::Writer<::json::iobuf_ostream> w(os);
 
           ppj::rjson_serialize_fmt(fmt)(w, std::move(res));
+          os.Flush();
 
-          // TODO Ben: Prevent this linearization
-          ss::sstring json_rslt = str_buf.GetString();
-          rp.rep->write_body("json", json_rslt);
+          write_json_body(rp, std::move(json_rslt));
           return std::move(rp);
       });
 }
@@ -285,11 +391,12 @@ get_consumer_offsets(server::request_t rq, server::reply_t rp) {
 
     auto res = co_await rq.ctx.client.consumer_offset_fetch(
       group_id, member_id, std::move(req_data));
-    rapidjson::StringBuffer str_buf;
-    rapidjson::Writer<rapidjson::StringBuffer> w(str_buf);
+    iobuf json_rslt;
+    ::json::iobuf_ostream os{json_rslt};
+    rapidjson::Writer<::json::iobuf_ostream> w(os);
     ppj::rjson_serialize(w, res);
-    ss::sstring json_rslt = str_buf.GetString();
-    rp.rep->write_body("json", json_rslt);
+    os.Flush();
+    write_json_body(rp, std::move(json_rslt));
     co_return rp;
 }
 
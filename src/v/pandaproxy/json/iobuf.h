@@ -45,8 +45,7 @@ public:
     inline std::pair<bool, std::optional<iobuf>>
     decode_base64(std::string_view v) {
         try {
-            auto decoded = base64_to_bytes(v);
-            return {true, bytes_to_iobuf(decoded)};
+            return {true, base64_to_iobuf(v)};
         } catch (const base64_decoder_exception&) {
             return {false, std::nullopt};
         }
@@ -62,7 +61,8 @@ public:
     explicit rjson_serialize_impl(serialization_format fmt)
       : _fmt(fmt) {}
 
-    bool operator()(rapidjson::Writer<rapidjson::StringBuffer>& w, iobuf buf) {
+    template<typename Buffer>
+    bool operator()(rapidjson::Writer<Buffer>& w, iobuf buf) {
         switch (_fmt) {
         case serialization_format::none:
             [[fallthrough]];
@@ -75,8 +75,8 @@ public:
         }
     }
 
-    bool
-    encode_base64(rapidjson::Writer<rapidjson::StringBuffer>& w, iobuf buf) {
+    template<typename Buffer>
+    bool encode_base64(rapidjson::Writer<Buffer>& w, iobuf buf) {
         if (buf.empty()) {
             return w.String("", 0);
         }
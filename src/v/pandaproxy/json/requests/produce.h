@@ -27,7 +27,8 @@
 namespace pandaproxy::json {
 
 struct record {
-    model::partition_id id;
+    /// Absent when the request leaves partition selection to the proxy.
+    std::optional<model::partition_id> id;
     std::optional<iobuf> key;
     std::optional<iobuf> value;
 };
@@ -151,9 +152,9 @@ public:
     bool EndArray(rapidjson::SizeType) { return state == state::records; }
 };
 
-inline void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w,
-  const kafka::produce_response::partition& v) {
+template<typename Buffer>
+void rjson_serialize(
+  rapidjson::Writer<Buffer>& w, const kafka::produce_response::partition& v) {
     w.StartObject();
     w.Key("partition");
     w.Int(v.id);
@@ -166,9 +167,9 @@ inline void rjson_serialize(
     w.EndObject();
 }
 
-inline void rjson_serialize(
-  rapidjson::Writer<rapidjson::StringBuffer>& w,
-  const kafka::produce_response::topic& v) {
+template<typename Buffer>
+void rjson_serialize(
+  rapidjson::Writer<Buffer>& w, const kafka::produce_response::topic& v) {
     w.StartObject();
     w.Key("offsets");
     w.StartArray();
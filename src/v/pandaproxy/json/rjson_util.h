@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+#include "json/iobuf_ostream.h"
 #include "json/json.h"
 #include "pandaproxy/json/types.h"
 #include "utils/concepts-enabled.h"
@@ -48,6 +50,22 @@ ss::sstring rjson_serialize(const T& v) {
     return ss::sstring(str_buf.GetString(), str_buf.GetSize());
 }
 
+/// Serialize a value into an iobuf, so large documents can be sent as the
+/// response body without being linearized into a contiguous string.
+template<typename T>
+iobuf rjson_serialize_iobuf(const T& v) {
+    iobuf buf;
+    ::json::iobuf_ostream os{buf};
+    rapidjson::Writer<::json::iobuf_ostream> wrt(os);
+
+    using ::json::rjson_serialize;
+    using ::pandaproxy::json::rjson_serialize;
+    rjson_serialize(wrt, v);
+
+    os.Flush();
+    return buf;
+}
+
 struct rjson_serialize_fmt_impl {
     explicit rjson_serialize_fmt_impl(serialization_format fmt)
       : fmt{fmt} {}
@@ -58,8 +76,8 @@ struct rjson_serialize_fmt_impl {
         rjson_serialize_impl<std::remove_reference_t<T>>{fmt}(
           std::forward<T>(t));
     }
-    template<typename T>
-    void operator()(rapidjson::Writer<rapidjson::StringBuffer>& w, T&& t) {
+    template<typename Buffer, typename T>
+    void operator()(rapidjson::Writer<Buffer>& w, T&& t) {
         rjson_serialize_impl<std::remove_reference_t<T>>{fmt}(
           w, std::forward<T>(t));
     }
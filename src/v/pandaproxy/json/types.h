@@ -15,7 +15,14 @@
 
 namespace pandaproxy::json {
 
-enum class serialization_format : uint8_t { none = 0, binary_v2, unsupported };
+enum class serialization_format : uint8_t {
+    none = 0,
+    binary_v2,
+    // raw length-prefixed payloads with no json envelope; never routed
+    // through the rjson handlers
+    raw_binary,
+    unsupported,
+};
 
 template<typename T>
 class rjson_parse_impl;
@@ -46,6 +46,9 @@ public:
 
     struct reply_t {
         std::unique_ptr<ss::httpd::reply> rep;
+        // content type stamped on the reply once the handler finishes;
+        // handlers serving non-json bodies override it
+        ss::sstring mime_type{"application/vnd.kafka.binary.v2+json"};
         // will contains other extensions passed to user specific handler.
     };
 
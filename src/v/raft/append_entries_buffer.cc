@@ -5,6 +5,7 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/do_with.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/util/later.hh>
 #include <seastar/util/variant_utils.hh>
@@ -42,6 +43,7 @@ append_entries_buffer::enqueue(append_entries_request&& r) {
 ss::future<> append_entries_buffer::stop() {
     _enqueued.broken();
     _flushed.broken();
+    _as.request_abort();
     return _gate.close();
 }
 
@@ -51,6 +53,7 @@ void append_entries_buffer::start() {
           [this] { return _gate.is_closed(); },
           [this] {
               return _enqueued.wait([this] { return !_requests.empty(); })
+                .then([this] { return maybe_linger(); })
                 .then([this] { return flush(); })
                 .handle_exception_type(
                   [](const ss::broken_condition_variable&) {
@@ -60,6 +63,25 @@ void append_entries_buffer::start() {
     });
 }
 
+ss::future<> append_entries_buffer::maybe_linger() {
+    // Feedback driven flush policy. When the previous flush round was fast
+    // the follower is keeping up and we dispatch immediately to minimize
+    // commit latency. When it was slow the disk is saturated, so we linger
+    // for a fraction of the measured round trip letting more requests
+    // accumulate - the same log flush then amortizes over a larger batch.
+    // A queue that already holds half of its capacity is flushed right away
+    // to release the enqueue backpressure.
+    if (
+      _last_flush_duration < linger_trigger
+      || _requests.size() * 2 >= _max_buffered) {
+        return ss::now();
+    }
+    auto linger = std::min(
+      std::chrono::microseconds(_last_flush_duration / 2), max_linger);
+    return ss::sleep_abortable(linger, _as).handle_exception_type(
+      [](const ss::sleep_aborted&) {});
+}
+
 ss::future<> append_entries_buffer::flush() {
     auto requests = std::exchange(_requests, {});
     auto response_promises = std::exchange(_responses, {});
@@ -74,6 +96,7 @@ ss::future<> append_entries_buffer::flush() {
 
 ss::future<> append_entries_buffer::do_flush(
   request_t requests, response_t response_promises) {
+    auto started = std::chrono::steady_clock::now();
     bool needs_flush = false;
     std::vector<reply_t> replies;
     replies.reserve(requests.size());
@@ -92,6 +115,8 @@ ss::future<> append_entries_buffer::do_flush(
     if (needs_flush) {
         co_await _consensus.flush_log();
     }
+    _last_flush_duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - started);
 
     propagate_results(std::move(replies), std::move(response_promises));
     _flushed.broadcast();
@@ -2,9 +2,12 @@
 
 #include "raft/types.h"
 
+#include <seastar/core/abort_source.hh>
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/gate.hh>
 
+#include <chrono>
+
 namespace raft {
 
 class consensus;
@@ -135,6 +138,14 @@ private:
     using response_t = std::vector<ss::promise<append_entries_reply>>;
     using reply_t = std::variant<append_entries_reply, std::exception_ptr>;
 
+    /**
+     * Only linger before flushing when the previous flush round took longer
+     * than this, i.e. when the disk is actually the bottleneck.
+     */
+    static constexpr std::chrono::microseconds linger_trigger{1000};
+    static constexpr std::chrono::microseconds max_linger{2000};
+
+    ss::future<> maybe_linger();
     ss::future<> flush();
     ss::future<> do_flush(request_t, response_t);
 
@@ -146,6 +157,12 @@ private:
     ss::condition_variable _enqueued;
     ss::gate _gate;
     ss::condition_variable _flushed;
+    ss::abort_source _as;
+    /**
+     * Duration of the most recent flush round, the feedback signal driving
+     * the adaptive linger in maybe_linger()
+     */
+    std::chrono::microseconds _last_flush_duration{0};
     const size_t _max_buffered;
 };
 
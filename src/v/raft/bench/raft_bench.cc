@@ -0,0 +1,517 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "config/configuration.h"
+#include "model/metadata.h"
+#include "model/record_batch_reader.h"
+#include "model/timeout_clock.h"
+#include "raft/consensus.h"
+#include "raft/consensus_client_protocol.h"
+#include "raft/heartbeat_manager.h"
+#include "raft/logger.h"
+#include "raft/rpc_client_protocol.h"
+#include "raft/service.h"
+#include "raft/types.h"
+#include "random/generators.h"
+#include "rpc/connection_cache.h"
+#include "rpc/server.h"
+#include "rpc/simple_protocol.h"
+#include "storage/api.h"
+#include "storage/record_batch_builder.h"
+#include "syschecks/syschecks.h"
+#include "utils/hdr_hist.h"
+#include "utils/unresolved_address.h"
+#include "vlog.h"
+
+#include <seastar/core/app-template.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/future-util.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/util/defer.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <fmt/format.h>
+
+#include <chrono>
+#include <vector>
+
+/*
+ * Multi-group raft load/latency harness. Drives raft::consensus through the
+ * real replicate_batcher path and reports commit-latency percentiles from an
+ * hdr histogram per shard. Stage costs are isolated by comparing runs at the
+ * three ack levels: --ack none measures the batcher and in-memory append,
+ * --ack leader adds the disk flush and --ack quorum adds the follower network
+ * round trip. Runs standalone (single node quorum) or against peers started
+ * with the same binary, like kvelldb/tron.
+ */
+
+using namespace std::chrono_literals; // NOLINT
+
+static ss::logger benchlog{"raft_bench"};
+namespace po = boost::program_options; // NOLINT
+
+void cli_opts(po::options_description_easy_init o) {
+    o("ip",
+      po::value<ss::sstring>()->default_value("127.0.0.1"),
+      "ip to listen to");
+    o("workdir",
+      po::value<ss::sstring>()->default_value("."),
+      "work directory");
+    o("peers",
+      po::value<std::vector<ss::sstring>>()->multitoken(),
+      "--peers 1,127.0.0.1:11215 \n --peers 2,127.0.0.0.1:11216");
+    o("port",
+      po::value<uint16_t>()->default_value(20776),
+      "port for raft service");
+    o("node-id", po::value<int32_t>()->default_value(1), "node-id required");
+    o("heartbeat-timeout-ms",
+      po::value<int32_t>()->default_value(100),
+      "raft heartbeat timeout in milliseconds");
+    o("groups",
+      po::value<size_t>()->default_value(8),
+      "number of raft groups, distributed round robin over shards");
+    o("batch-size",
+      po::value<size_t>()->default_value(10),
+      "records per replicated batch");
+    o("record-size",
+      po::value<size_t>()->default_value(1024),
+      "value bytes per record");
+    o("concurrency",
+      po::value<size_t>()->default_value(4),
+      "in-flight replicate calls per group");
+    o("seconds",
+      po::value<size_t>()->default_value(30),
+      "workload duration in seconds");
+    o("ack",
+      po::value<ss::sstring>()->default_value("quorum"),
+      "ack mode: quorum | leader | none");
+}
+
+struct bench_cfg {
+    size_t groups;
+    size_t batch_size;
+    size_t record_size;
+    size_t concurrency;
+    std::chrono::seconds duration;
+    raft::consistency_level ack;
+};
+
+struct shard_report {
+    size_t ops{0};
+    size_t errors{0};
+    size_t bytes{0};
+    int64_t p50_us{0};
+    int64_t p95_us{0};
+    int64_t p99_us{0};
+    int64_t max_us{0};
+};
+
+struct bench_shard_lookup {
+    ss::shard_id shard_for(raft::group_id g) { return g() % ss::smp::count; }
+    bool contains(raft::group_id) { return true; }
+};
+
+class bench_group_manager {
+public:
+    bench_group_manager(
+      model::node_id self,
+      ss::sstring directory,
+      std::chrono::milliseconds raft_heartbeat_interval,
+      ss::sharded<rpc::connection_cache>& clients,
+      bench_cfg cfg)
+      : _self(self)
+      , _cfg(cfg)
+      , _consensus_client_protocol(
+          raft::make_rpc_client_protocol(self, clients))
+      , _storage(
+          storage::kvstore_config(
+            1_MiB, 10ms, directory, storage::debug_sanitize_files::no),
+          storage::log_config(
+            storage::log_config::storage_type::disk,
+            std::move(directory),
+            1_GiB,
+            storage::debug_sanitize_files::no))
+      , _hbeats(raft_heartbeat_interval, _consensus_client_protocol, self)
+      , _payload(random_generators::get_bytes(cfg.record_size)) {}
+
+    ss::lw_shared_ptr<raft::consensus> consensus_for(raft::group_id g) {
+        auto it = _groups.find(g);
+        return it == _groups.end() ? nullptr : it->second;
+    }
+
+    ss::future<> start(std::vector<model::broker> brokers) {
+        co_await _storage.start();
+        for (size_t i = 0; i < _cfg.groups; ++i) {
+            if (i % ss::smp::count != ss::this_shard_id()) {
+                continue;
+            }
+            co_await start_group(raft::group_id(i), brokers);
+        }
+        co_await _hbeats.start();
+    }
+
+    ss::future<> stop() {
+        for (auto& [g, c] : _groups) {
+            co_await c->stop();
+        }
+        co_await _hbeats.stop();
+        co_await _storage.stop();
+    }
+
+    ss::future<shard_report> run_load() {
+        // let elections settle; in multi node mode only the groups this
+        // node ends up leading are driven
+        for (int i = 0; i < 100; ++i) {
+            if (leader_count() == _groups.size()) {
+                break;
+            }
+            co_await ss::sleep(100ms);
+        }
+        const auto deadline = model::timeout_clock::now() + _cfg.duration;
+        std::vector<ss::future<>> drivers;
+        for (auto& [g, c] : _groups) {
+            if (!c->is_leader()) {
+                vlog(
+                  benchlog.info,
+                  "skipping group {} - not the leader on this node",
+                  g);
+                continue;
+            }
+            for (size_t i = 0; i < _cfg.concurrency; ++i) {
+                drivers.push_back(drive(c, deadline));
+            }
+        }
+        co_await ss::when_all_succeed(drivers.begin(), drivers.end());
+        co_return shard_report{
+          .ops = _ops,
+          .errors = _errors,
+          .bytes = _bytes,
+          .p50_us = _hist.get_value_at(50.0),
+          .p95_us = _hist.get_value_at(95.0),
+          .p99_us = _hist.get_value_at(99.0),
+          .max_us = _hist.get_value_at(100.0),
+        };
+    }
+
+private:
+    ss::future<>
+    start_group(raft::group_id group, std::vector<model::broker> brokers) {
+        auto log = co_await _storage.log_mgr().manage(storage::ntp_config(
+          model::ntp(
+            model::ns("raft_bench"),
+            model::topic("load"),
+            model::partition_id(group())),
+          _storage.log_mgr().config().base_dir));
+        auto consensus = ss::make_lw_shared<raft::consensus>(
+          _self,
+          group,
+          raft::group_configuration(
+            std::move(brokers), model::revision_id(0)),
+          raft::timeout_jitter(
+            config::shard_local_cfg().raft_election_timeout_ms()),
+          log,
+          ss::default_priority_class(),
+          std::chrono::seconds(1),
+          _consensus_client_protocol,
+          [group](raft::leadership_status st) {
+              if (st.current_leader) {
+                  vlog(
+                    benchlog.info,
+                    "group {} leader: {}",
+                    group,
+                    st.current_leader.value());
+              }
+          },
+          _storage);
+        co_await consensus->start();
+        co_await _hbeats.register_group(consensus);
+        _groups.emplace(group, std::move(consensus));
+    }
+
+    size_t leader_count() const {
+        size_t n = 0;
+        for (auto& [g, c] : _groups) {
+            if (c->is_leader()) {
+                ++n;
+            }
+        }
+        return n;
+    }
+
+    model::record_batch make_batch() {
+        storage::record_batch_builder b(
+          model::record_batch_type(1), model::offset(0));
+        for (size_t i = 0; i < _cfg.batch_size; ++i) {
+            iobuf key;
+            key.append(_payload.data(), std::min<size_t>(_payload.size(), 16));
+            b.add_raw_kv(std::move(key), bytes_to_iobuf(_payload));
+        }
+        return std::move(b).build();
+    }
+
+    ss::future<> drive(
+      ss::lw_shared_ptr<raft::consensus> c,
+      model::timeout_clock::time_point deadline) {
+        while (model::timeout_clock::now() < deadline && c->is_leader()) {
+            auto batch = make_batch();
+            const auto bytes = batch.size_bytes();
+            const auto started = hdr_hist::clock_type::now();
+            auto r = co_await c->replicate(
+              model::make_memory_record_batch_reader(std::move(batch)),
+              raft::replicate_options(_cfg.ack));
+            if (r) {
+                _hist.record(
+                  std::chrono::duration_cast<std::chrono::microseconds>(
+                    hdr_hist::clock_type::now() - started)
+                    .count());
+                ++_ops;
+                _bytes += bytes;
+            } else {
+                ++_errors;
+            }
+        }
+    }
+
+    model::node_id _self;
+    bench_cfg _cfg;
+    raft::consensus_client_protocol _consensus_client_protocol;
+    storage::api _storage;
+    raft::heartbeat_manager _hbeats;
+    bytes _payload;
+    absl::
+      flat_hash_map<raft::group_id, ss::lw_shared_ptr<raft::consensus>>
+        _groups;
+    hdr_hist _hist;
+    size_t _ops{0};
+    size_t _errors{0};
+    size_t _bytes{0};
+};
+
+static std::pair<model::node_id, rpc::transport_configuration>
+extract_peer(ss::sstring peer) {
+    std::vector<ss::sstring> parts;
+    parts.reserve(2);
+    boost::split(parts, peer, boost::is_any_of(","));
+    if (parts.size() != 2) {
+        throw std::runtime_error(fmt::format("Could not parse peer:{}", peer));
+    }
+    int32_t n = boost::lexical_cast<int32_t>(parts[0]);
+    rpc::transport_configuration cfg;
+    cfg.server_addr = ss::ipv4_addr(parts[1]);
+    return {model::node_id(n), cfg};
+}
+
+static void initialize_connection_cache_in_thread(
+  model::node_id self,
+  ss::sharded<rpc::connection_cache>& cache,
+  std::vector<ss::sstring> opts) {
+    for (auto& i : opts) {
+        auto [node, cfg] = extract_peer(i);
+        for (ss::shard_id i = 0; i < ss::smp::count; ++i) {
+            auto shard = rpc::connection_cache::shard_for(self, i, node);
+            ss::smp::submit_to(shard, [&cache, n = node, config = cfg] {
+                return cache.local().emplace(
+                  n,
+                  config,
+                  rpc::make_exponential_backoff_policy<rpc::clock_type>(
+                    std::chrono::seconds(1), std::chrono::seconds(60)));
+            }).get();
+        }
+    }
+}
+
+static model::broker broker_from_arg(ss::sstring peer) {
+    std::vector<ss::sstring> parts;
+    parts.reserve(2);
+    boost::split(parts, peer, boost::is_any_of(","));
+    if (parts.size() != 2) {
+        throw std::runtime_error(fmt::format("Could not parse peer:{}", peer));
+    }
+    int32_t id = boost::lexical_cast<int32_t>(parts[0]);
+    std::vector<ss::sstring> host_port;
+    host_port.reserve(2);
+    boost::split(host_port, parts[1], boost::is_any_of(":"));
+    if (host_port.size() != 2) {
+        throw std::runtime_error(fmt::format("Could not host:{}", parts[1]));
+    }
+    auto port = boost::lexical_cast<int32_t>(host_port[1]);
+    return model::broker(
+      model::node_id(id),
+      unresolved_address(host_port[0], port),
+      unresolved_address(host_port[0], port),
+      std::nullopt,
+      model::broker_properties{.cores = ss::smp::count});
+}
+
+static std::vector<model::broker>
+brokers_from_args(const po::variables_map& opts) {
+    std::vector<model::broker> brokers;
+    if (opts.find("peers") != opts.end()) {
+        auto peers = opts["peers"].as<std::vector<ss::sstring>>();
+        for (auto& arg : peers) {
+            brokers.push_back(broker_from_arg(arg));
+        }
+    }
+    // add self
+    brokers.push_back(model::broker(
+      model::node_id(opts["node-id"].as<int32_t>()),
+      unresolved_address(
+        opts["ip"].as<ss::sstring>(), opts["port"].as<uint16_t>()),
+      unresolved_address(
+        opts["ip"].as<ss::sstring>(), opts["port"].as<uint16_t>()),
+      std::optional<ss::sstring>(),
+      model::broker_properties{
+        .cores = ss::smp::count,
+      }));
+    return brokers;
+}
+
+static raft::consistency_level parse_ack(const ss::sstring& a) {
+    if (a == "quorum") {
+        return raft::consistency_level::quorum_ack;
+    }
+    if (a == "leader") {
+        return raft::consistency_level::leader_ack;
+    }
+    if (a == "none") {
+        return raft::consistency_level::no_ack;
+    }
+    throw std::runtime_error(fmt::format("unknown ack mode:{}", a));
+}
+
+int main(int args, char** argv, char** env) {
+    syschecks::initialize_intrinsics();
+    std::setvbuf(stdout, nullptr, _IOLBF, 1024);
+    ss::sharded<rpc::server> serv;
+    ss::sharded<rpc::connection_cache> connection_cache;
+    ss::sharded<bench_group_manager> group_manager;
+    ss::app_template app;
+    cli_opts(app.add_options());
+    return app.run(args, argv, [&] {
+        return ss::async([&] {
+            auto& cfg = app.configuration();
+            bench_cfg bcfg{
+              .groups = cfg["groups"].as<size_t>(),
+              .batch_size = cfg["batch-size"].as<size_t>(),
+              .record_size = cfg["record-size"].as<size_t>(),
+              .concurrency = cfg["concurrency"].as<size_t>(),
+              .duration = std::chrono::seconds(cfg["seconds"].as<size_t>()),
+              .ack = parse_ack(cfg["ack"].as<ss::sstring>()),
+            };
+            connection_cache.start().get();
+            auto ccd = ss::defer(
+              [&connection_cache] { connection_cache.stop().get(); });
+
+            auto self_id = cfg["node-id"].as<int32_t>();
+            if (cfg.find("peers") != cfg.end()) {
+                initialize_connection_cache_in_thread(
+                  model::node_id(self_id),
+                  connection_cache,
+                  cfg["peers"].as<std::vector<ss::sstring>>());
+            }
+            const ss::sstring workdir = fmt::format(
+              "{}/raft_bench-{}", cfg["workdir"].as<ss::sstring>(), self_id);
+            vlog(benchlog.info, "Work directory:{}", workdir);
+
+            group_manager
+              .start(
+                model::node_id(self_id),
+                workdir,
+                std::chrono::milliseconds(
+                  cfg["heartbeat-timeout-ms"].as<int32_t>()),
+                std::ref(connection_cache),
+                bcfg)
+              .get();
+            auto gmd = ss::defer(
+              [&group_manager] { group_manager.stop().get(); });
+
+            rpc::server_configuration scfg("raft_bench_rpc");
+            scfg.addrs.emplace_back(ss::socket_address(
+              ss::net::inet_address(cfg["ip"].as<ss::sstring>()),
+              cfg["port"].as<uint16_t>()));
+            scfg.max_service_memory_per_core
+              = ss::memory::stats().total_memory() * .7;
+            serv.start(scfg).get();
+            auto dserv = ss::defer([&serv] { serv.stop().get(); });
+            bench_shard_lookup shard_table;
+            serv
+              .invoke_on_all([&shard_table, &group_manager](rpc::server& s) {
+                  auto proto = std::make_unique<rpc::simple_protocol>();
+                  proto->register_service<
+                    raft::service<bench_group_manager, bench_shard_lookup>>(
+                    ss::default_scheduling_group(),
+                    ss::default_smp_service_group(),
+                    group_manager,
+                    shard_table);
+                  s.set_protocol(std::move(proto));
+              })
+              .get();
+            serv.invoke_on_all(&rpc::server::start).get();
+
+            auto brokers = brokers_from_args(cfg);
+            group_manager
+              .invoke_on_all([brokers](bench_group_manager& m) {
+                  return m.start(brokers);
+              })
+              .get();
+
+            vlog(
+              benchlog.info,
+              "running: groups:{} batch_size:{} record_size:{} "
+              "concurrency:{} seconds:{} ack:{}",
+              bcfg.groups,
+              bcfg.batch_size,
+              bcfg.record_size,
+              bcfg.concurrency,
+              bcfg.duration.count(),
+              cfg["ack"].as<ss::sstring>());
+
+            auto reports = group_manager
+                             .map([](bench_group_manager& m) {
+                                 return m.run_load();
+                             })
+                             .get0();
+            shard_report total;
+            for (size_t shard = 0; shard < reports.size(); ++shard) {
+                const auto& r = reports[shard];
+                fmt::print(
+                  "shard {}: ops:{} errors:{} bytes:{} p50:{}us p95:{}us "
+                  "p99:{}us max:{}us\n",
+                  shard,
+                  r.ops,
+                  r.errors,
+                  r.bytes,
+                  r.p50_us,
+                  r.p95_us,
+                  r.p99_us,
+                  r.max_us);
+                total.ops += r.ops;
+                total.errors += r.errors;
+                total.bytes += r.bytes;
+                total.max_us = std::max(total.max_us, r.max_us);
+            }
+            const auto secs = std::max<size_t>(bcfg.duration.count(), 1);
+            fmt::print(
+              "total: ops:{} errors:{} throughput:{}op/s {}MiB/s "
+              "max:{}us\n",
+              total.ops,
+              total.errors,
+              total.ops / secs,
+              total.bytes / secs / 1_MiB,
+              total.max_us);
+            return 0;
+        });
+    });
+}
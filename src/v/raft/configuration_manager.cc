@@ -18,9 +18,10 @@
 #include "storage/kvstore.h"
 #include "vlog.h"
 
-#include <absl/container/btree_map.h>
 #include <boost/range/irange.hpp>
 
+#include <algorithm>
+
 namespace raft {
 
 configuration_manager::configuration_manager(
@@ -32,21 +33,42 @@ configuration_manager::configuration_manager(
   , _storage(storage)
   , _ctxlog(log) {
     vlog(_ctxlog.trace, "Initial configuration: {}", initial_cfg);
-    _configurations.emplace(model::offset{}, std::move(initial_cfg));
+    _configurations.push_back(
+      make_indexed(model::offset{}, std::move(initial_cfg)));
+    refresh_latest_snapshot();
+}
+
+configuration_manager::indexed_configuration configuration_manager::make_indexed(
+  model::offset offset, group_configuration cfg) {
+    iobuf buf;
+    reflection::serialize(buf, offset, cfg);
+    return indexed_configuration{offset, std::move(cfg), std::move(buf)};
+}
+
+configuration_manager::underlying_t::const_iterator
+configuration_manager::lower_bound(model::offset offset) const {
+    return std::lower_bound(
+      _configurations.cbegin(),
+      _configurations.cend(),
+      offset,
+      [](const indexed_configuration& ic, model::offset o) {
+          return ic.offset < o;
+      });
 }
 
 ss::future<> configuration_manager::truncate(model::offset offset) {
     vlog(_ctxlog.trace, "Truncating configurations at {}", offset);
-    if (unlikely(offset <= _configurations.begin()->first)) {
+    if (unlikely(offset <= _configurations.front().offset)) {
         return ss::make_exception_future<>(std::invalid_argument(fmt::format(
           "can not truncate with offsets, lower or equal than the first one {} "
           "included in the manager ",
-          _configurations.begin()->first)));
+          _configurations.front().offset)));
     }
 
     return _lock.with([this, offset] {
-        auto it = _configurations.lower_bound(offset);
-        _configurations.erase(it, _configurations.end());
+        auto it = lower_bound(offset);
+        _configurations.erase(it, _configurations.cend());
+        refresh_latest_snapshot();
 
         _highest_known_offset = std::min(offset, _highest_known_offset);
         return store_highest_known_offset().then(
@@ -57,8 +79,8 @@ ss::future<> configuration_manager::truncate(model::offset offset) {
 ss::future<> configuration_manager::prefix_truncate(model::offset offset) {
     vlog(_ctxlog.trace, "Prefix truncating configurations at {}", offset);
     return _lock.with([this, offset] {
-        auto it = _configurations.lower_bound(offset);
-        if (it == _configurations.end()) {
+        auto it = lower_bound(offset);
+        if (it == _configurations.cend()) {
             // we can not prefix truncate all configurations
             return ss::make_exception_future<>(
               std::invalid_argument(fmt::format(
@@ -67,7 +89,8 @@ ss::future<> configuration_manager::prefix_truncate(model::offset offset) {
                 offset,
                 get_latest_offset())));
         }
-        _configurations.erase(_configurations.begin(), it);
+        _configurations.erase(_configurations.cbegin(), it);
+        refresh_latest_snapshot();
         _highest_known_offset = std::max(offset, _highest_known_offset);
         return store_highest_known_offset().then(
           [this] { return store_configurations(); });
@@ -76,13 +99,14 @@ ss::future<> configuration_manager::prefix_truncate(model::offset offset) {
 
 void configuration_manager::add_configuration(
   model::offset offset, group_configuration cfg) {
-    auto [_, success] = _configurations.try_emplace(offset, std::move(cfg));
-    if (!success) {
+    auto it = lower_bound(offset);
+    if (it != _configurations.cend() && it->offset == offset) {
         throw std::invalid_argument(fmt::format(
           "Unable to add configuration at offset {} as it "
           "already exists",
           offset));
     }
+    _configurations.insert(it, make_indexed(offset, std::move(cfg)));
 }
 
 ss::future<>
@@ -100,6 +124,7 @@ configuration_manager::add(std::vector<offset_configuration> configurations) {
             add_configuration(co.offset, std::move(co.cfg));
             _highest_known_offset = std::max(_highest_known_offset, co.offset);
         }
+        refresh_latest_snapshot();
         _config_changed.broadcast();
         return store_configurations().then(
           [this] { return store_highest_known_offset(); });
@@ -113,14 +138,17 @@ configuration_manager::add(model::offset offset, group_configuration cfg) {
 
     vlog(_ctxlog.trace, "Adding configuration: {}, offset: {}", cfg, offset);
     return _lock.with([this, cfg = std::move(cfg), offset]() mutable {
-        auto it = _configurations.find(offset);
+        auto it = lower_bound(offset);
         // we already have this configuration, do nothing
         // this may happen if configuration is the last batch of the snapshot
-        if (it != _configurations.end() && it->second == cfg) {
+        if (
+          it != _configurations.cend() && it->offset == offset
+          && it->cfg == cfg) {
             return ss::now();
         }
 
         add_configuration(offset, std::move(cfg));
+        refresh_latest_snapshot();
         _highest_known_offset = std::max(offset, _highest_known_offset);
         _config_changed.broadcast();
         return store_configurations().then(
@@ -128,57 +156,69 @@ configuration_manager::add(model::offset offset, group_configuration cfg) {
     });
 }
 
+void configuration_manager::refresh_latest_snapshot() {
+    if (unlikely(_configurations.empty())) {
+        return;
+    }
+    _latest_snapshot = ss::make_lw_shared<const group_configuration>(
+      _configurations.back().cfg);
+}
+
+ss::lw_shared_ptr<const group_configuration>
+configuration_manager::get_latest_snapshot() const {
+    vassert(
+      _latest_snapshot != nullptr,
+      "Configuration manager should always have at least one configuration");
+    return _latest_snapshot;
+}
+
 const group_configuration& configuration_manager::get_latest() const {
     vassert(
       !_configurations.empty(),
       "Configuration manager should always have at least one configuration");
-    return _configurations.rbegin()->second;
+    return _configurations.back().cfg;
 }
 
 model::offset configuration_manager::get_latest_offset() const {
     vassert(
       !_configurations.empty(),
       "Configuration manager should always have at least one configuration");
-    return _configurations.rbegin()->first;
+    return _configurations.back().offset;
 }
 
 std::optional<group_configuration>
 configuration_manager::get(model::offset offset) const {
-    auto it = _configurations.lower_bound(offset);
-    if (it != _configurations.end() && it->first == offset) {
-        return it->second;
+    auto it = lower_bound(offset);
+    if (it != _configurations.cend() && it->offset == offset) {
+        return it->cfg;
     }
     // we are returning previous configuration as this is the one that was
     // active for requested offset
-    if (it != _configurations.begin()) {
-        return std::prev(it)->second;
+    if (it != _configurations.cbegin()) {
+        return std::prev(it)->cfg;
     }
 
     return std::nullopt;
 }
 
-ss::future<iobuf> serialize_configurations(
-  const absl::btree_map<model::offset, group_configuration>& cfgs) {
-    return ss::do_with(iobuf(), [&cfgs](iobuf& ret) {
-        reflection::adl<uint64_t>{}.to(ret, cfgs.size());
-        return ss::do_for_each(
-                 cfgs.cbegin(),
-                 cfgs.cend(),
-                 [&ret](const auto& p) mutable {
-                     reflection::serialize(ret, p.first, p.second);
-                 })
-          .then([&ret] { return std::move(ret); });
-    });
+iobuf configuration_manager::serialize_configurations() {
+    iobuf ret;
+    reflection::adl<uint64_t>{}.to(ret, _configurations.size());
+    for (auto& ic : _configurations) {
+        // share the memoized encoding instead of re-encoding the entry
+        ret.append(ic.serialized.share(0, ic.serialized.size_bytes()));
+    }
+    return ret;
 }
 
-ss::future<absl::btree_map<model::offset, group_configuration>>
-deserialize_configurations(iobuf&& buf) {
-    using ret_t = absl::btree_map<model::offset, group_configuration>;
+ss::future<configuration_manager::underlying_t>
+configuration_manager::deserialize_configurations(iobuf buf) {
     return ss::do_with(
       iobuf_parser(std::move(buf)),
-      ret_t{},
-      [](iobuf_parser& parser, ret_t& configs) {
+      underlying_t{},
+      [](iobuf_parser& parser, underlying_t& configs) {
           auto size = reflection::adl<uint64_t>{}.from(parser);
+          configs.reserve(size);
           return ss::do_with(
             boost::irange<uint64_t>(0, size),
             [&configs, &parser](boost::integer_range<uint64_t>& range) {
@@ -189,12 +229,14 @@ deserialize_configurations(iobuf&& buf) {
                                parser);
                              auto value = reflection::adl<group_configuration>{}
                                             .from(parser);
-                             auto [_, success] = configs.try_emplace(
-                               key, std::move(value));
                              vassert(
-                               success,
-                               "Duplicated configuration key at offset {}",
+                               configs.empty()
+                                 || configs.back().offset < key,
+                               "Duplicated or unordered configuration key at "
+                               "offset {}",
                                key);
+                             configs.push_back(
+                               make_indexed(key, std::move(value)));
                          })
                   .then([&configs]() mutable { return std::move(configs); });
             });
@@ -215,12 +257,10 @@ bytes configuration_manager::highest_known_offset_key() {
 }
 
 ss::future<> configuration_manager::store_configurations() {
-    return serialize_configurations(_configurations).then([this](iobuf buf) {
-        return _storage.kvs().put(
-          storage::kvstore::key_space::consensus,
-          configurations_map_key(),
-          std::move(buf));
-    });
+    return _storage.kvs().put(
+      storage::kvstore::key_space::consensus,
+      configurations_map_key(),
+      serialize_configurations());
 }
 
 ss::future<> configuration_manager::store_highest_known_offset() {
@@ -260,7 +300,7 @@ configuration_manager::start(bool reset, model::revision_id initial_revision) {
                       _configurations = std::move(cfgs);
                       if (!_configurations.empty()) {
                           _highest_known_offset
-                            = _configurations.rbegin()->first;
+                            = _configurations.back().offset;
                       }
                   });
         }
@@ -277,9 +317,15 @@ configuration_manager::start(bool reset, model::revision_id initial_revision) {
         }
 
         return f.then([this] {
-            for (auto& [o, cfg] : _configurations) {
-                cfg.maybe_set_initial_revision(_initial_revision);
+            for (auto& ic : _configurations) {
+                ic.cfg.maybe_set_initial_revision(_initial_revision);
+                // the revision may have changed, refresh the memoized
+                // encoding
+                iobuf buf;
+                reflection::serialize(buf, ic.offset, ic.cfg);
+                ic.serialized = std::move(buf);
             }
+            refresh_latest_snapshot();
         });
     });
 }
@@ -344,13 +390,13 @@ model::revision_id configuration_manager::get_latest_revision() const {
       !_configurations.empty(),
       "Configuration manager should always have at least one "
       "configuration");
-    return _configurations.rbegin()->second.revision_id();
+    return _configurations.back().cfg.revision_id();
 }
 
 std::ostream& operator<<(std::ostream& o, const configuration_manager& m) {
     o << "{configurations: ";
-    for (const auto& p : m._configurations) {
-        o << "{ offset: " << p.first << " cfg: " << p.second << " } ";
+    for (const auto& ic : m._configurations) {
+        o << "{ offset: " << ic.offset << " cfg: " << ic.cfg << " } ";
     }
 
     return o << " }";
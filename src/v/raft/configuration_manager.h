@@ -23,8 +23,7 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
-
-#include <absl/container/btree_map.h>
+#include <seastar/core/shared_ptr.hh>
 
 #include <utility>
 #include <vector>
@@ -95,6 +94,15 @@ public:
      */
     const group_configuration& get_latest() const;
 
+    /**
+     * Get latest configuration as a shared immutable snapshot. The
+     * snapshot is re-published whenever the configuration history
+     * changes, so read paths hold onto it across scheduling points or
+     * hand it out per request without copying the broker list and
+     * without touching any lock.
+     */
+    ss::lw_shared_ptr<const group_configuration> get_latest_snapshot() const;
+
     /**
      * Get latest configuration offset.
      */
@@ -138,10 +146,27 @@ public:
     operator<<(std::ostream&, const configuration_manager&);
 
 private:
-    // using ordered map in here to execute truncations and being able to
-    // efficiently search for configurations with offset smaller or equal than
-    // requested
-    using underlying_t = absl::btree_map<model::offset, group_configuration>;
+    /**
+     * Configuration with the offset it was added at and the memoized adl
+     * encoding of both. The encoding is shared every time the history is
+     * persisted, so repeated kvstore writes do not re-encode every entry.
+     */
+    struct indexed_configuration {
+        model::offset offset;
+        group_configuration cfg;
+        iobuf serialized;
+    };
+    // history sorted by offset, configurations are rare so truncations and
+    // inserts on the vector are cheap while lookups binary search
+    using underlying_t = std::vector<indexed_configuration>;
+
+    static indexed_configuration
+      make_indexed(model::offset, group_configuration);
+
+    underlying_t::const_iterator lower_bound(model::offset) const;
+
+    iobuf serialize_configurations();
+    static ss::future<underlying_t> deserialize_configurations(iobuf);
 
     ss::future<> store_configurations();
     ss::future<> store_highest_known_offset();
@@ -150,8 +175,16 @@ private:
 
     void add_configuration(model::offset, group_configuration);
 
+    /**
+     * Installs a fresh immutable snapshot of the latest configuration,
+     * called from every place the configuration history changes
+     * (RCU-style: readers keep whatever snapshot they already hold)
+     */
+    void refresh_latest_snapshot();
+
     raft::group_id _group;
     underlying_t _configurations;
+    ss::lw_shared_ptr<const group_configuration> _latest_snapshot;
     /**
      * The highest know offset is latest offset for which configuration manager
      * has all configurations. In other words, some configuration may be in the
@@ -30,6 +30,8 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/core/with_scheduling_group.hh>
 
 #include <fmt/ostream.h>
 
@@ -56,7 +58,10 @@ consensus::consensus(
   , _client_protocol(client)
   , _leader_notification(std::move(cb))
   , _fstats(_self)
-  , _batcher(this, config::shard_local_cfg().raft_replicate_batch_window_size())
+  , _batcher(
+      this,
+      config::shard_local_cfg().raft_replicate_batch_window_size(),
+      config::shard_local_cfg().raft_replicate_batcher_max_linger_ms())
   , _event_manager(this)
   , _ctxlog(group, _log.config().ntp())
   , _replicate_append_timeout(
@@ -326,6 +331,11 @@ void consensus::maybe_promote_to_voter(vnode id) {
         if (latest_cfg.is_voter(id)) {
             return ss::now();
         }
+
+        // observers are long lived non voters, never promote them
+        if (latest_cfg.is_observer(id)) {
+            return ss::now();
+        }
         auto it = _fstats.find(id);
 
         // already removed
@@ -355,6 +365,17 @@ void consensus::maybe_promote_to_voter(vnode id) {
 }
 
 void consensus::process_append_entries_reply(
+  model::node_id physical_node,
+  result<append_entries_reply> r,
+  follower_req_seq seq_id,
+  model::offset dirty_offset) {
+    if (update_follower_state(
+          physical_node, std::move(r), seq_id, dirty_offset)) {
+        dispatch_follower_advances();
+    }
+}
+
+bool consensus::update_follower_state(
   model::node_id physical_node,
   result<append_entries_reply> r,
   follower_req_seq seq_id,
@@ -363,10 +384,14 @@ void consensus::process_append_entries_reply(
       physical_node, r, seq_id, dirty_offset);
     if (is_success) {
         maybe_promote_to_voter(r.value().node_id);
-        maybe_update_majority_replicated_index();
-        maybe_update_leader_commit_idx();
-        _follower_reply.broadcast();
     }
+    return bool(is_success);
+}
+
+void consensus::dispatch_follower_advances() {
+    maybe_update_majority_replicated_index();
+    maybe_update_leader_commit_idx();
+    _follower_reply.broadcast();
 }
 
 void consensus::successfull_append_entries_reply(
@@ -406,17 +431,27 @@ void consensus::dispatch_recovery(follower_index_metadata& idx) {
         idx.next_index = log_max_offset;
     }
     idx.is_recovering = true;
-    // background
-    (void)with_gate(_bg, [this, node_id = idx.node_id] {
-        auto recovery = std::make_unique<recovery_stm>(
-          this, node_id, _io_priority);
-        auto ptr = recovery.get();
-        return ptr->apply()
-          .handle_exception([this, node_id](const std::exception_ptr& e) {
-              vlog(_ctxlog.warn, "Node {} recovery failed - {}", node_id, e);
-          })
-          .finally([r = std::move(recovery)] {});
-    }).handle_exception([this](const std::exception_ptr& e) {
+    // background, in the recovery scheduling group so that catching up
+    // followers does not starve the foreground raft work
+    (void)ss::with_scheduling_group(
+      _recovery_sg,
+      [this, node_id = idx.node_id] {
+          return with_gate(_bg, [this, node_id] {
+              auto recovery = std::make_unique<recovery_stm>(
+                this, node_id, _io_priority);
+              auto ptr = recovery.get();
+              return ptr->apply()
+                .handle_exception(
+                  [this, node_id](const std::exception_ptr& e) {
+                      vlog(
+                        _ctxlog.warn,
+                        "Node {} recovery failed - {}",
+                        node_id,
+                        e);
+                  })
+                .finally([r = std::move(recovery)] {});
+          });
+      }).handle_exception([this](const std::exception_ptr& e) {
         vlog(_ctxlog.warn, "Recovery error - {}", e);
     });
 }
@@ -533,6 +568,16 @@ ss::future<result<replicate_result>> consensus::do_replicate(
           errc::not_leader);
     }
 
+    if (
+      opts.consistency == consistency_level::quorum_ack
+      && unlikely(_log.config().has_relaxed_fsync())) {
+        // the topic traded the per-request fdatasync for interval/byte
+        // driven flushes. acknowledge from leader memory - followers are
+        // kept up to date by the recovery mechanism and the log is flushed
+        // in the background when the configured thresholds are reached.
+        opts.consistency = consistency_level::leader_ack;
+    }
+
     if (opts.consistency == consistency_level::quorum_ack) {
         _probe.replicate_requests_ack_all();
         return ss::with_gate(
@@ -579,6 +624,7 @@ ss::future<result<replicate_result>> consensus::do_replicate(
                       _visibility_upper_bound_index, res.last_offset);
                     maybe_update_majority_replicated_index();
                 }
+                maybe_flush_relaxed(res.byte_size);
                 return result<replicate_result>(
                   replicate_result{.last_offset = res.last_offset});
             });
@@ -586,6 +632,24 @@ ss::future<result<replicate_result>> consensus::do_replicate(
       .finally([this] { _probe.replicate_done(); });
 }
 
+void consensus::maybe_flush_relaxed(size_t appended_bytes) {
+    const auto& ntp_cfg = _log.config();
+    if (likely(!ntp_cfg.has_relaxed_fsync())) {
+        return;
+    }
+    _relaxed_unflushed_bytes += appended_bytes;
+    const auto flush_bytes = ntp_cfg.flush_bytes();
+    const auto flush_interval = ntp_cfg.flush_interval();
+    const bool bytes_due = flush_bytes
+                           && _relaxed_unflushed_bytes >= *flush_bytes;
+    const bool interval_due = flush_interval
+                              && clock_type::now() - _relaxed_last_flush
+                                   >= *flush_interval;
+    if (bytes_due || interval_due) {
+        dispatch_flush_with_lock();
+    }
+}
+
 void consensus::dispatch_flush_with_lock() {
     if (!_has_pending_flushes) {
         return;
@@ -1738,9 +1802,56 @@ append_entries_reply consensus::make_append_entries_reply(
     return reply;
 }
 
+namespace {
+/*
+ * Shard-level group commit window. Every consensus instance fsyncs its own
+ * log, so on a node with thousands of raft groups the fdatasync rate scales
+ * with partition count. Aligning the flushes of all groups on the shard
+ * into a shared window lets the disk absorb them as one queue burst and
+ * bounds the per-group fsync rate by the window length.
+ */
+class flush_window {
+public:
+    flush_window()
+      : _timer([this] { fire(); }) {}
+
+    ss::future<> wait(std::chrono::microseconds window) {
+        if (!_timer.armed()) {
+            _timer.arm(window);
+        }
+        _waiters.emplace_back();
+        return _waiters.back().get_future();
+    }
+
+private:
+    void fire() {
+        auto waiters = std::exchange(_waiters, {});
+        for (auto& w : waiters) {
+            w.set_value();
+        }
+    }
+
+    ss::timer<> _timer;
+    std::vector<ss::promise<>> _waiters;
+};
+} // namespace
+
 ss::future<> consensus::flush_log() {
     _probe.log_flushed();
-    return _log.flush().then([this] { _has_pending_flushes = false; });
+    const auto window = std::chrono::microseconds(
+      config::shard_local_cfg().raft_flush_coalescing_window_us());
+    auto f = ss::now();
+    if (window > std::chrono::microseconds(0)) {
+        static thread_local flush_window shard_window;
+        f = shard_window.wait(window);
+    }
+    return f.then([this] {
+        return _log.flush().then([this] {
+            _has_pending_flushes = false;
+            _relaxed_unflushed_bytes = 0;
+            _relaxed_last_flush = clock_type::now();
+        });
+    });
 }
 
 ss::future<storage::append_result> consensus::disk_append(
@@ -1845,12 +1956,23 @@ consensus::next_followers_request_seq() {
 }
 
 void consensus::maybe_update_leader_commit_idx() {
+    // every follower response within a heartbeat interval tries to advance
+    // the commit index; a single queued advance observes all follower state
+    // recorded before it acquires the op lock, so additional tasks would
+    // only recompute the same result
+    if (_commit_index_update_pending) {
+        return;
+    }
+    _commit_index_update_pending = true;
     (void)with_gate(_bg, [this] {
         return _op_lock.get_units().then(
           [this](ss::semaphore_units<> u) mutable {
+              // state recorded from here on needs a new advance
+              _commit_index_update_pending = false;
               return do_maybe_update_leader_commit_idx(std::move(u));
           });
     }).handle_exception([this](const std::exception_ptr& e) {
+        _commit_index_update_pending = false;
         vlog(_ctxlog.warn, "Error updating leader commit index", e);
     });
 }
@@ -1998,6 +2120,11 @@ group_configuration consensus::config() const {
     return _configuration_manager.get_latest();
 }
 
+ss::lw_shared_ptr<const group_configuration>
+consensus::config_snapshot() const {
+    return _configuration_manager.get_latest_snapshot();
+}
+
 static std::ostream&
 operator<<(std::ostream& os, const consensus::vote_state& state) {
     switch (state) {
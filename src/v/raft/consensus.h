@@ -35,6 +35,7 @@
 #include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/util/bool_class.hh>
 
@@ -147,6 +148,10 @@ public:
     raft::group_id group() const { return _group; }
     model::term_id term() const { return _term; }
     group_configuration config() const;
+    /// latest configuration as a shared immutable snapshot - the cheap
+    /// accessor for read paths that would otherwise copy the broker list
+    /// on every call; see configuration_manager::get_latest_snapshot
+    ss::lw_shared_ptr<const group_configuration> config_snapshot() const;
     const model::ntp& ntp() const { return _log.config().ntp(); }
     clock_type::time_point last_heartbeat() const { return _hbeat; };
 
@@ -170,6 +175,22 @@ public:
       follower_req_seq,
       model::offset);
 
+    /// first phase of batched heartbeat response processing: updates
+    /// follower state without any scheduling point and returns true when
+    /// replication progressed, i.e. dispatch_follower_advances() should
+    /// run for this group
+    bool update_follower_state(
+      model::node_id,
+      result<append_entries_reply>,
+      follower_req_seq,
+      model::offset);
+
+    /// second phase: advances majority replicated and commit indexes and
+    /// wakes replication waiters. split out so the heartbeat manager can
+    /// update every group's follower state in one pass and batch these
+    /// dispatches afterwards
+    void dispatch_follower_advances();
+
     ss::future<result<replicate_result>>
     replicate(model::record_batch_reader&&, replicate_options);
 
@@ -290,6 +311,12 @@ public:
 
     void suppress_heartbeats(vnode, follower_req_seq, bool);
 
+    // scheduling group follower recovery runs in, defaults to the group
+    // the consensus instance was created in
+    void set_recovery_scheduling_group(ss::scheduling_group sg) {
+        _recovery_sg = sg;
+    }
+
 private:
     friend replicate_entries_stm;
     friend vote_stm;
@@ -379,6 +406,9 @@ private:
     /// \brief called by the vote timer, to dispatch a write under
     /// the ops semaphore
     void dispatch_flush_with_lock();
+    /// \brief dispatches a background flush when the relaxed-fsync
+    /// interval/byte thresholds of this ntp are reached
+    void maybe_flush_relaxed(size_t appended_bytes);
 
     void maybe_step_down();
 
@@ -468,6 +498,10 @@ private:
     // consensus state
     model::offset _commit_index;
     model::term_id _term;
+    // true while a commit index advance is queued behind the op lock;
+    // used to coalesce the advances triggered by every follower response
+    // within a heartbeat interval into a single task
+    bool _commit_index_update_pending{false};
 
     // read at `ss::future<> start()`
     vnode _voted_for;
@@ -487,12 +521,19 @@ private:
 
     replicate_batcher _batcher;
     bool _has_pending_flushes{false};
+    // relaxed-fsync flush policy bookkeeping, see maybe_flush_relaxed()
+    size_t _relaxed_unflushed_bytes{0};
+    clock_type::time_point _relaxed_last_flush = clock_type::now();
 
     /// used to wait for background ops before shutting down
     ss::gate _bg;
 
-    /// all raft operations must happen exclusively since the common case
-    /// is for the operation to touch the disk
+    /// all raft *mutations* must happen exclusively since the common case
+    /// is for the operation to touch the disk. read-mostly metadata (term,
+    /// commit/visible offsets, configuration) is published outside the
+    /// lock - plain members for the scalars, a shared immutable snapshot
+    /// for the configuration - so fetch-side queries never contend with
+    /// the produce path here
     mutex _op_lock;
     /// used for notifying when commits happened to log
     event_manager _event_manager;
@@ -502,6 +543,7 @@ private:
 
     std::chrono::milliseconds _replicate_append_timeout;
     std::chrono::milliseconds _recovery_append_timeout;
+    ss::scheduling_group _recovery_sg = ss::current_scheduling_group();
     ss::metrics::metric_groups _metrics;
     ss::abort_source _as;
     storage::api& _storage;
@@ -32,7 +32,11 @@ bool group_nodes::contains(vnode id) const {
         return true;
     }
     auto l_it = std::find(std::cbegin(learners), std::cend(learners), id);
-    return l_it != learners.cend();
+    if (l_it != learners.cend()) {
+        return true;
+    }
+    auto o_it = std::find(std::cbegin(observers), std::cend(observers), id);
+    return o_it != observers.cend();
 }
 
 std::optional<vnode> group_nodes::find(model::node_id id) const {
@@ -49,7 +53,15 @@ std::optional<vnode> group_nodes::find(model::node_id id) const {
           return rni.id() == id;
       });
 
-    return l_it != learners.cend() ? std::make_optional(*l_it) : std::nullopt;
+    if (l_it != learners.cend()) {
+        return *l_it;
+    }
+    auto o_it = std::find_if(
+      std::cbegin(observers), std::cend(observers), [id](const vnode& rni) {
+          return rni.id() == id;
+      });
+
+    return o_it != observers.cend() ? std::make_optional(*o_it) : std::nullopt;
 }
 
 group_configuration::group_configuration(
@@ -110,6 +122,22 @@ bool group_configuration::is_voter(vnode id) const {
     return old_it != std::cend(_old->voters);
 }
 
+bool group_configuration::is_observer(vnode id) const {
+    auto it = std::find(
+      std::cbegin(_current.observers), std::cend(_current.observers), id);
+
+    if (it != std::cend(_current.observers)) {
+        return true;
+    }
+    if (!_old) {
+        return false;
+    }
+    auto old_it = std::find(
+      std::cbegin(_old->observers), std::cend(_old->observers), id);
+
+    return old_it != std::cend(_old->observers);
+}
+
 bool group_configuration::contains_broker(model::node_id id) const {
     auto it = std::find_if(
       std::cbegin(_brokers),
@@ -155,6 +183,10 @@ std::vector<vnode> group_configuration::unique_learner_ids() const {
     auto old_learners = _old ? _old->learners : std::vector<vnode>();
     return unique_ids(_current.learners, old_learners);
 }
+std::vector<vnode> group_configuration::unique_observer_ids() const {
+    auto old_observers = _old ? _old->observers : std::vector<vnode>();
+    return unique_ids(_current.observers, old_observers);
+}
 
 void erase_id(std::vector<vnode>& v, model::node_id id) {
     auto it = std::find_if(
@@ -190,6 +222,20 @@ void group_configuration::add(
     }
 }
 
+void group_configuration::add_observer(
+  model::broker broker, model::revision_id rev) {
+    vassert(!_old, "can not add observer to joint configuration - {}", *this);
+    if (unlikely(contains_broker(broker.id()))) {
+        throw std::invalid_argument(fmt::format(
+          "broker {} already present in current configuration {}",
+          broker.id(),
+          *this));
+    }
+    _revision = rev;
+    _current.observers.emplace_back(broker.id(), rev);
+    _brokers.push_back(std::move(broker));
+}
+
 void group_configuration::remove(const std::vector<model::node_id>& ids) {
     vassert(
       !_old, "can not remove broker from joint configuration - {}", *this);
@@ -210,6 +256,7 @@ void group_configuration::remove(const std::vector<model::node_id>& ids) {
     for (auto& id : ids) {
         erase_id(new_cfg.learners, id);
         erase_id(new_cfg.voters, id);
+        erase_id(new_cfg.observers, id);
     }
 
     _old = std::move(_current);
@@ -303,6 +350,10 @@ void group_configuration::discard_old_config() {
     for (auto& id : _current.voters) {
         physical_node_ids.insert(id.id());
     }
+
+    for (auto& id : _current.observers) {
+        physical_node_ids.insert(id.id());
+    }
     // remove unused brokers from brokers set
     auto it = std::stable_partition(
       std::begin(_brokers),
@@ -364,11 +415,14 @@ void group_configuration::maybe_set_initial_revision(
         // current configuration
         _current.voters = with_revisions_assigned(_current.voters, new_rev);
         _current.learners = with_revisions_assigned(_current.learners, new_rev);
+        _current.observers = with_revisions_assigned(
+          _current.observers, new_rev);
 
         // old configuration
         if (_old) {
             _old->voters = with_revisions_assigned(_old->voters, new_rev);
             _old->learners = with_revisions_assigned(_old->learners, new_rev);
+            _old->observers = with_revisions_assigned(_old->observers, new_rev);
         }
     }
 }
@@ -385,7 +439,12 @@ std::ostream& operator<<(std::ostream& o, const group_configuration& c) {
 }
 
 std::ostream& operator<<(std::ostream& o, const group_nodes& n) {
-    fmt::print(o, "{{voters: {}, learners: {}}}", n.voters, n.learners);
+    fmt::print(
+      o,
+      "{{voters: {}, learners: {}, observers: {}}}",
+      n.voters,
+      n.learners,
+      n.observers);
     return o;
 }
 
@@ -395,7 +454,8 @@ std::ostream& operator<<(std::ostream& o, const offset_configuration& c) {
 }
 
 bool operator==(const group_nodes& a, const group_nodes& b) {
-    return a.learners == b.learners && a.voters == b.voters;
+    return a.learners == b.learners && a.voters == b.voters
+           && a.observers == b.observers;
 }
 
 bool operator==(const group_configuration& a, const group_configuration& b) {
@@ -439,6 +499,19 @@ struct group_nodes_v0 {
     }
 };
 
+// group_nodes before observers were introduced in version 4
+struct group_nodes_v2 {
+    std::vector<raft::vnode> voters;
+    std::vector<raft::vnode> learners;
+
+    raft::group_nodes to_current() {
+        raft::group_nodes ret;
+        ret.voters = std::move(voters);
+        ret.learners = std::move(learners);
+        return ret;
+    }
+};
+
 raft::group_configuration
 adl<raft::group_configuration>::from(iobuf_parser& p) {
     auto version = adl<uint8_t>{}.from(p);
@@ -456,6 +529,7 @@ adl<raft::group_configuration>::from(iobuf_parser& p) {
      * version 1 - introduced revision id
      * version 2 - introduced raft::vnode
      * version 3 - model::broker with multiple endpoints
+     * version 4 - introduced long lived observers
      */
 
     std::vector<model::broker> brokers;
@@ -477,9 +551,18 @@ adl<raft::group_configuration>::from(iobuf_parser& p) {
     raft::group_nodes current;
     std::optional<raft::group_nodes> old;
 
-    if (likely(version >= 2)) {
+    if (likely(version >= 4)) {
         current = adl<raft::group_nodes>{}.from(p);
         old = adl<std::optional<raft::group_nodes>>{}.from(p);
+    } else if (version >= 2) {
+        // observers were not serialized yet
+        auto current_v2 = adl<group_nodes_v2>{}.from(p);
+        auto old_v2 = adl<std::optional<group_nodes_v2>>{}.from(p);
+
+        current = current_v2.to_current();
+        if (old_v2) {
+            old = old_v2->to_current();
+        }
     } else {
         // no raft::vnodes
         auto current_v0 = adl<group_nodes_v0>{}.from(p);
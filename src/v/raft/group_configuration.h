@@ -53,6 +53,10 @@ enum class configuration_type : uint8_t { simple, joint };
 struct group_nodes {
     std::vector<vnode> voters;
     std::vector<vnode> learners;
+    // long lived non voting replicas. observers receive append_entries like
+    // learners do, but they are never promoted to voters and never count
+    // toward the quorum or participate in elections
+    std::vector<vnode> observers;
 
     bool contains(vnode id) const;
 
@@ -64,7 +68,7 @@ struct group_nodes {
 
 class group_configuration final {
 public:
-    static constexpr int8_t current_version = 3;
+    static constexpr int8_t current_version = 4;
     /**
      * creates a configuration where all provided brokers are current
      * configuration voters
@@ -99,6 +103,11 @@ public:
      */
     bool is_voter(vnode) const;
 
+    /**
+     * Check if node with given id is a long lived observer replica
+     */
+    bool is_observer(vnode) const;
+
     /**
      * Configuration manipulation API. Each operation cause the configuration to
      * become joint configuration.
@@ -107,6 +116,12 @@ public:
     void remove(const std::vector<model::node_id>&);
     void replace(std::vector<model::broker>, model::revision_id);
 
+    /**
+     * Adds a long lived observer replica. Observers do not change the
+     * majority so this operation does not require joint consensus.
+     */
+    void add_observer(model::broker, model::revision_id);
+
     /**
      * Updating broker configuration. This operation does not require entering
      * joint consensus as it never change majority
@@ -197,6 +212,7 @@ public:
 private:
     std::vector<vnode> unique_voter_ids() const;
     std::vector<vnode> unique_learner_ids() const;
+    std::vector<vnode> unique_observer_ids() const;
 
     uint8_t _version = current_version;
     std::vector<model::broker> _brokers;
@@ -254,7 +270,8 @@ template<typename Func>
 void group_configuration::for_each_broker_id(Func&& f) const {
     auto voters = unique_voter_ids();
     auto learners = unique_learner_ids();
-    auto joined = boost::join(voters, learners);
+    auto observers = unique_observer_ids();
+    auto joined = boost::join(boost::join(voters, learners), observers);
     std::for_each(
       std::cbegin(joined), std::cend(joined), std::forward<Func>(f));
 }
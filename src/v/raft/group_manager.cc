@@ -12,7 +12,11 @@
 #include "config/configuration.h"
 #include "model/metadata.h"
 #include "prometheus/prometheus_sanitize.h"
+#include "raft/logger.h"
 #include "resource_mgmt/io_priority.h"
+#include "vlog.h"
+
+#include <seastar/core/sleep.hh>
 
 namespace raft {
 
@@ -21,17 +25,91 @@ group_manager::group_manager(
   model::timeout_clock::duration disk_timeout,
   std::chrono::milliseconds heartbeat_interval,
   ss::sharded<rpc::connection_cache>& clients,
-  ss::sharded<storage::api>& storage)
+  ss::sharded<storage::api>& storage,
+  ss::scheduling_group recovery_sg)
   : _self(self)
   , _disk_timeout(disk_timeout)
   , _client(make_rpc_client_protocol(self, clients))
   , _heartbeats(heartbeat_interval, _client, _self)
-  , _storage(storage.local()) {
+  , _storage(storage.local())
+  , _recovery_sg(recovery_sg) {
     setup_metrics();
 }
 
 ss::future<> group_manager::start() { return _heartbeats.start(); }
 
+ss::future<> group_manager::drain_leadership() {
+    return ss::with_gate(_gate, [this] {
+        // copy - groups may be concurrently removed while we drain
+        std::vector<ss::lw_shared_ptr<consensus>> leaders;
+        for (auto& gr : _groups) {
+            if (gr->is_leader()) {
+                leaders.push_back(gr);
+            }
+        }
+        if (leaders.empty()) {
+            return ss::now();
+        }
+        vlog(
+          raftlog.info,
+          "Draining leadership of {} raft groups before shutdown",
+          leaders.size());
+        return ss::do_with(
+          std::move(leaders),
+          ss::semaphore(max_concurrent_leadership_transfers),
+          [this](
+            std::vector<ss::lw_shared_ptr<consensus>>& leaders,
+            ss::semaphore& sem) {
+              return ss::parallel_for_each(
+                leaders, [this, &sem](ss::lw_shared_ptr<consensus> c) {
+                    return ss::with_semaphore(
+                      sem, 1, [this, c] { return drain_group_leadership(c); });
+                });
+          });
+    });
+}
+
+ss::future<>
+group_manager::drain_group_leadership(ss::lw_shared_ptr<consensus> c) {
+    return c->transfer_leadership(std::nullopt)
+      .then([c](std::error_code ec) {
+          if (ec) {
+              // not fatal - the group falls back to a regular election
+              // after this node goes away
+              vlog(
+                raftlog.debug,
+                "Unable to transfer leadership of group {} before shutdown - "
+                "{}",
+                c->group(),
+                ec.message());
+              return ss::now();
+          }
+          /*
+           * a successful reply only means the target started an election.
+           * wait until this node observes itself stepping down (the same
+           * event that feeds the leaders table) so shutdown does not race
+           * with the handoff. bounded - if the election stalls we carry on
+           * with shutdown anyway.
+           */
+          auto deadline = clock_type::now()
+                          + 2
+                              * config::shard_local_cfg()
+                                  .raft_election_timeout_ms();
+          return ss::do_until(
+            [c, deadline] {
+                return !c->is_leader() || clock_type::now() > deadline;
+            },
+            [] { return ss::sleep(std::chrono::milliseconds(10)); });
+      })
+      .handle_exception([c](const std::exception_ptr& e) {
+          vlog(
+            raftlog.info,
+            "Error transferring leadership of group {} before shutdown - {}",
+            c->group(),
+            e);
+      });
+}
+
 ss::future<> group_manager::stop() {
     return _gate.close()
       .then([this] { return _heartbeats.stop(); })
@@ -59,6 +137,7 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
           trigger_leadership_notification(std::move(st));
       },
       _storage);
+    raft->set_recovery_scheduling_group(_recovery_sg);
 
     return ss::with_gate(_gate, [this, raft] {
         return _heartbeats.register_group(raft).then([this, raft] {
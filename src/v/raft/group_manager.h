@@ -19,6 +19,7 @@
 #include "storage/fwd.h"
 
 #include <seastar/core/metrics_registration.hh>
+#include <seastar/core/scheduling.hh>
 
 #include <absl/container/flat_hash_map.h>
 
@@ -39,11 +40,20 @@ public:
       model::timeout_clock::duration disk_timeout,
       std::chrono::milliseconds heartbeat_interval,
       ss::sharded<rpc::connection_cache>& clients,
-      ss::sharded<storage::api>& storage);
+      ss::sharded<storage::api>& storage,
+      ss::scheduling_group recovery_sg = ss::current_scheduling_group());
 
     ss::future<> start();
     ss::future<> stop();
 
+    /*
+     * Proactively hand off leadership of every locally led group to an up
+     * to date follower. Called on shutdown, before the rpc subsystem goes
+     * away, so that followers elect replacements immediately instead of
+     * waiting out election timeouts after this node disappears.
+     */
+    ss::future<> drain_leadership();
+
     ss::future<ss::lw_shared_ptr<raft::consensus>> create_group(
       raft::group_id id, std::vector<model::broker> nodes, storage::log log);
 
@@ -73,7 +83,13 @@ public:
     }
 
 private:
+    // bound on in flight transfers while draining, so a node hosting
+    // thousands of groups does not flood its peers with recovery and
+    // timeout_now traffic all at once
+    static constexpr size_t max_concurrent_leadership_transfers = 25;
+
     void trigger_leadership_notification(raft::leadership_status);
+    ss::future<> drain_group_leadership(ss::lw_shared_ptr<raft::consensus>);
     void setup_metrics();
 
     model::node_id _self;
@@ -87,6 +103,7 @@ private:
       _notifications;
     ss::metrics::metric_groups _metrics;
     storage::api& _storage;
+    ss::scheduling_group _recovery_sg;
 };
 
 } // namespace raft
@@ -214,6 +214,12 @@ void heartbeat_manager::process_reply(
         }
         return;
     }
+    // symmetric to the batched send: one pass updates the follower state
+    // of every group carried by this peer's response without yielding,
+    // then the commit index / majority offset advances for the groups
+    // that progressed are dispatched together
+    std::vector<consensus_ptr> advance;
+    advance.reserve(r.value().meta.size());
     for (auto& m : r.value().meta) {
         auto it = _consensus_groups.find(m.group);
         if (it == _consensus_groups.end()) {
@@ -222,11 +228,16 @@ void heartbeat_manager::process_reply(
             continue;
         }
         auto meta = groups.find(m.group)->second;
-        (*it)->process_append_entries_reply(
-          n,
-          result<append_entries_reply>(std::move(m)),
-          meta.seq,
-          meta.dirty_offset);
+        if ((*it)->update_follower_state(
+              n,
+              result<append_entries_reply>(std::move(m)),
+              meta.seq,
+              meta.dirty_offset)) {
+            advance.push_back(*it);
+        }
+    }
+    for (auto& ptr : advance) {
+        ptr->dispatch_follower_advances();
     }
 }
 
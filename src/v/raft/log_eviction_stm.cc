@@ -24,14 +24,18 @@ log_eviction_stm::log_eviction_stm(
   : _raft(raft)
   , _logger(logger)
   , _stm_manager(stm_manager)
-  , _as(as) {}
+  , _as(as)
+  , _eviction_timer([this] { dispatch_flush(); }) {}
 
 ss::future<> log_eviction_stm::start() {
     monitor_log_eviction();
     return ss::now();
 }
 
-ss::future<> log_eviction_stm::stop() { return _gate.close(); }
+ss::future<> log_eviction_stm::stop() {
+    _eviction_timer.cancel();
+    return _gate.close();
+}
 
 void log_eviction_stm::monitor_log_eviction() {
     (void)ss::with_gate(_gate, [this] {
@@ -59,6 +63,32 @@ log_eviction_stm::handle_deletion_notification(model::offset last_evicted) {
     if (last_evicted <= _previous_eviction_offset) {
         return ss::now();
     }
+    // Don't act on the event directly. Remember the highest evicted offset
+    // and let the timer flush once per window: a retention storm then costs
+    // a single snapshot instead of one per event. The timer is not re-armed
+    // on subsequent events so the flush latency stays bounded.
+    _max_pending_eviction_offset = std::max(
+      last_evicted, _max_pending_eviction_offset);
+    if (!_eviction_timer.armed()) {
+        _eviction_timer.arm(eviction_coalescing_interval);
+    }
+    return ss::now();
+}
+
+void log_eviction_stm::dispatch_flush() {
+    (void)ss::with_gate(_gate, [this] {
+        return flush_evictions().handle_exception([this](std::exception_ptr e) {
+            vlog(_logger.trace, "Error flushing log evictions - {}", e);
+        });
+    });
+}
+
+ss::future<> log_eviction_stm::flush_evictions() {
+    auto last_evicted = std::exchange(
+      _max_pending_eviction_offset, model::offset{});
+    if (last_evicted <= _previous_eviction_offset) {
+        return ss::now();
+    }
     // persist empty snapshot, we can have no timeout in here as we are passing
     // in an abort source
     _previous_eviction_offset = last_evicted;
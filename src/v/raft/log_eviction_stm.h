@@ -17,6 +17,8 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/timer.hh>
 #include <seastar/util/log.hh>
 
 namespace raft {
@@ -39,9 +41,17 @@ public:
 
     ss::future<> stop();
 
+    /// Eviction events arriving within this window are coalesced into a
+    /// single snapshot covering the highest evicted offset, so aggressive
+    /// retention produces one prefix truncation (and one index/kvstore
+    /// update) per partition per window instead of one per event
+    static constexpr std::chrono::seconds eviction_coalescing_interval{5};
+
 private:
     ss::future<> handle_deletion_notification(model::offset);
     void monitor_log_eviction();
+    void dispatch_flush();
+    ss::future<> flush_evictions();
 
     consensus* _raft;
     ss::logger& _logger;
@@ -49,6 +59,9 @@ private:
     ss::abort_source& _as;
     ss::gate _gate;
     model::offset _previous_eviction_offset;
+    /// Highest evicted offset observed since the last flush
+    model::offset _max_pending_eviction_offset;
+    ss::timer<ss::lowres_clock> _eviction_timer;
 };
 
 } // namespace raft
@@ -23,6 +23,7 @@
 #include "utils/mutex.h"
 #include "vassert.h"
 
+#include <seastar/core/future-util.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/util/bool_class.hh>
@@ -32,7 +33,9 @@
 
 #include <optional>
 #include <system_error>
+#include <type_traits>
 #include <variant>
+#include <vector>
 
 namespace raft {
 
@@ -67,6 +70,18 @@ using persistent_last_applied
 // when batch is applicable for one state is has to be not applicable for
 // another
 //
+// Runs of consecutive committed batches that target the same state are
+// dispatched together. A state may additionally implement
+//
+//   ss::future<std::vector<std::error_code>>
+//   apply_updates(std::vector<model::record_batch>);
+//
+// returning one error code per batch to receive a whole run in a single
+// call and amortize locking and notification fan-out across it; states
+// without it have the run replayed through apply_update one batch at a
+// time. Either way the waiter promises are resolved with one mutex
+// acquisition and the last applied offset is persisted once per run.
+//
 // +---------+               +---------+      +-------+ +---------+
 // | caller  |               | mux_stm |      | raft  | | state_1 |
 // +---------+               +---------+      +-------+ +---------+
@@ -128,6 +143,11 @@ private:
       = absl::node_hash_map<model::offset, expiring_promise<std::error_code>>;
 
     ss::future<> apply(model::record_batch b) final;
+    ss::future<> apply_batches(std::vector<model::record_batch>) final;
+    /// applies the run of same-state batches starting at next, advancing
+    /// next past the batches it consumed
+    ss::future<>
+    apply_one_run(std::vector<model::record_batch>& batches, size_t& next);
 
     container_t _promises;
 
@@ -247,6 +267,45 @@ is_batch_applicable(State& s, const model::record_batch& batch) {
     return std::nullopt;
 }
 
+namespace details {
+// detects the optional batched apply hook on a state
+template<typename State, typename = void>
+struct has_batched_apply : std::false_type {};
+template<typename State>
+struct has_batched_apply<
+  State,
+  std::void_t<decltype(std::declval<State&>().apply_updates(
+    std::declval<std::vector<model::record_batch>>()))>> : std::true_type {};
+} // namespace details
+
+// deliver a run of batches to one state, either in a single call or by
+// replaying it through the per-batch interface
+template<typename State>
+static ss::future<std::vector<std::error_code>>
+apply_updates_to_state(State& s, std::vector<model::record_batch> run) {
+    if constexpr (details::has_batched_apply<State>::value) {
+        return s.apply_updates(std::move(run));
+    } else {
+        return ss::do_with(
+          std::move(run),
+          std::vector<std::error_code>{},
+          [&s](
+            std::vector<model::record_batch>& run,
+            std::vector<std::error_code>& results) {
+              results.reserve(run.size());
+              return ss::do_for_each(
+                       run,
+                       [&s, &results](model::record_batch& b) {
+                           return s.apply_update(std::move(b))
+                             .then([&results](std::error_code ec) {
+                                 results.push_back(ec);
+                             });
+                       })
+                .then([&results] { return std::move(results); });
+          });
+    }
+}
+
 template<typename... T>
 CONCEPT(requires(State<T>, ...))
 ss::future<> mux_state_machine<T...>::apply(model::record_batch b) {
@@ -295,4 +354,99 @@ ss::future<> mux_state_machine<T...>::apply(model::record_batch b) {
     });
 }
 
+template<typename... T>
+CONCEPT(requires(State<T>, ...))
+ss::future<> mux_state_machine<T...>::apply_batches(
+  std::vector<model::record_batch> batches) {
+    return ss::with_gate(_gate, [this, batches = std::move(batches)]() mutable {
+        return ss::do_with(
+          std::move(batches),
+          size_t{0},
+          [this](std::vector<model::record_batch>& batches, size_t& next) {
+              return ss::do_until(
+                [&batches, &next] { return next == batches.size(); },
+                [this, &batches, &next] {
+                    return apply_one_run(batches, next);
+                });
+          });
+    });
+}
+
+template<typename... T>
+CONCEPT(requires(State<T>, ...))
+ss::future<> mux_state_machine<T...>::apply_one_run(
+  std::vector<model::record_batch>& batches, size_t& next) {
+    auto lookup = [this](const model::record_batch& b) {
+        return std::apply(
+          [&b](T&... st) {
+              using variant_t = std::variant<T*...>;
+              std::optional<variant_t> res;
+              (void)((res = is_batch_applicable(st, b), res) || ...);
+              return res;
+          },
+          _state);
+    };
+    auto state = lookup(batches[next]);
+
+    // applicable state not found
+    if (!state) {
+        vassert(
+          batches[next].header().type == state_machine::checkpoint_batch_type
+            || batches[next].header().type == raft::configuration_batch_type,
+          "State handler for batch of type: {} not found",
+          batches[next].header().type);
+        ++next;
+        return ss::now();
+    }
+
+    // extend the run while consecutive batches target the same state
+    auto begin = next++;
+    while (next < batches.size()) {
+        auto s = lookup(batches[next]);
+        if (!s || s->index() != state->index()) {
+            break;
+        }
+        ++next;
+    }
+
+    std::vector<model::record_batch> run;
+    run.reserve(next - begin);
+    std::vector<model::offset> offsets;
+    offsets.reserve(next - begin);
+    for (auto i = begin; i < next; ++i) {
+        offsets.push_back(batches[i].last_offset());
+        run.push_back(std::move(batches[i]));
+    }
+
+    auto result_f = std::visit(
+      [run = std::move(run)](auto* st) mutable {
+          return apply_updates_to_state(*st, std::move(run));
+      },
+      *state);
+
+    return result_f.then([this, offsets = std::move(offsets)](
+                           std::vector<std::error_code> results) mutable {
+        vassert(
+          results.size() == offsets.size(),
+          "State returned {} results for a run of {} batches",
+          results.size(),
+          offsets.size());
+        auto last_offset = offsets.back();
+        auto f = _mutex.with(
+          [this, offsets = std::move(offsets), results = std::move(results)] {
+              for (size_t i = 0; i < offsets.size(); ++i) {
+                  if (auto it = _promises.find(offsets[i]);
+                      it != _promises.end()) {
+                      it->second.set_value(results[i]);
+                  }
+              }
+          });
+        if (!_persist_last_applied) {
+            return f;
+        }
+        return f.then(
+          [this, last_offset] { return write_last_applied(last_offset); });
+    });
+}
+
 } // namespace raft
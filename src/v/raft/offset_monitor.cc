@@ -17,7 +17,7 @@ namespace raft {
 
 void offset_monitor::stop() {
     for (auto& waiter : _waiters) {
-        waiter.second->done.set_exception(wait_aborted());
+        waiter->done.set_exception(wait_aborted());
     }
     _waiters.clear();
 }
@@ -30,12 +30,12 @@ ss::future<> offset_monitor::wait(
     if (offset <= _last_applied) {
         return ss::now();
     }
-    auto w = std::make_unique<waiter>(this, timeout, as);
+    auto w = std::make_unique<waiter>(this, offset, timeout, as);
     auto f = w->done.get_future();
     if (!f.available()) {
         // the future may already be available, for example if an abort had
         // already be requested. in that case, skip adding as a waiter.
-        _waiters.emplace(offset, std::move(w));
+        heap_push(std::move(w));
     }
     return f;
 }
@@ -43,23 +43,82 @@ ss::future<> offset_monitor::wait(
 void offset_monitor::notify(model::offset offset) {
     _last_applied = std::max(offset, _last_applied);
 
+    // every satisfied waiter surfaces at the root of the min-heap in turn
+    while (!_waiters.empty() && _waiters.front()->offset <= offset) {
+        auto w = heap_remove(0);
+        w->done.set_value();
+        // when the waiter is destroyed here, then if they are active, the
+        // timer is cancelled and the abort source subscription is removed.
+    }
+}
+
+void offset_monitor::sift_up(size_t idx) {
+    while (idx > 0) {
+        const size_t parent = (idx - 1) / 2;
+        if (_waiters[parent]->offset <= _waiters[idx]->offset) {
+            break;
+        }
+        std::swap(_waiters[parent], _waiters[idx]);
+        _waiters[idx]->heap_idx = idx;
+        idx = parent;
+    }
+    _waiters[idx]->heap_idx = idx;
+}
+
+void offset_monitor::sift_down(size_t idx) {
+    const size_t size = _waiters.size();
     while (true) {
-        auto it = _waiters.begin();
-        if (it == _waiters.end() || offset < it->first) {
-            return;
+        size_t smallest = idx;
+        const size_t left = 2 * idx + 1;
+        const size_t right = left + 1;
+        if (
+          left < size && _waiters[left]->offset < _waiters[smallest]->offset) {
+            smallest = left;
         }
-        it->second->done.set_value();
-        // when the waiter is destroyed here by erase, then if they are active,
-        // the timer is cancelled and the abort source subscription is removed.
-        _waiters.erase(it);
+        if (
+          right < size
+          && _waiters[right]->offset < _waiters[smallest]->offset) {
+            smallest = right;
+        }
+        if (smallest == idx) {
+            break;
+        }
+        std::swap(_waiters[idx], _waiters[smallest]);
+        _waiters[idx]->heap_idx = idx;
+        idx = smallest;
+    }
+    _waiters[idx]->heap_idx = idx;
+}
+
+void offset_monitor::heap_push(std::unique_ptr<waiter> w) {
+    w->heap_idx = _waiters.size();
+    _waiters.push_back(std::move(w));
+    sift_up(_waiters.size() - 1);
+}
+
+std::unique_ptr<offset_monitor::waiter>
+offset_monitor::heap_remove(size_t idx) {
+    vassert(idx < _waiters.size(), "waiter heap index out of range");
+    std::swap(_waiters[idx], _waiters.back());
+    auto w = std::move(_waiters.back());
+    _waiters.pop_back();
+    if (idx < _waiters.size()) {
+        // the element swapped into the hole may violate the heap property
+        // in either direction; at most one of the sifts moves it
+        _waiters[idx]->heap_idx = idx;
+        sift_down(idx);
+        sift_up(idx);
     }
+    return w;
 }
 
 offset_monitor::waiter::waiter(
   offset_monitor* mon,
+  model::offset offset,
   model::timeout_clock::time_point timeout,
   std::optional<std::reference_wrapper<ss::abort_source>> as)
-  : mon(mon) {
+  : mon(mon)
+  , offset(offset) {
     if (as) {
         auto opt_sub = as->get().subscribe(
           [this]() noexcept { handle_abort(); });
@@ -78,16 +137,10 @@ offset_monitor::waiter::waiter(
 
 void offset_monitor::waiter::handle_abort() {
     done.set_exception(wait_aborted());
-    auto it = std::find_if(
-      mon->_waiters.begin(),
-      mon->_waiters.end(),
-      [this](const waiters_type::value_type& w) {
-          return w.second.get() == this;
-      });
-    vassert(it != mon->_waiters.end(), "waiter not found");
-    // when the waiter is destroyed here by erase, then if they are active,
-    // the timer is cancelled and the abort source subscription is removed.
-    mon->_waiters.erase(it); // *this is no longer valid after erase
+    // removing the waiter destroys it once 'self' goes out of scope,
+    // cancelling the timer and dropping the abort source subscription
+    auto self = mon->heap_remove(heap_idx);
+    vassert(self.get() == this, "waiter heap index corrupted");
 }
 
 } // namespace raft
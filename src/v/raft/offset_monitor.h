@@ -18,7 +18,8 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/timer.hh>
 
-#include <absl/container/btree_map.h>
+#include <memory>
+#include <vector>
 
 namespace raft {
 
@@ -69,12 +70,16 @@ public:
 private:
     struct waiter {
         offset_monitor* mon;
+        model::offset offset;
+        /// position in the monitor's heap, maintained by the sift routines
+        size_t heap_idx{0};
         ss::promise<> done;
         ss::timer<model::timeout_clock> timer;
         ss::abort_source::subscription sub;
 
         waiter(
           offset_monitor*,
+          model::offset,
           model::timeout_clock::time_point,
           std::optional<std::reference_wrapper<ss::abort_source>>);
 
@@ -83,10 +88,17 @@ private:
 
     friend waiter;
 
-    using waiters_type
-      = absl::btree_multimap<model::offset, std::unique_ptr<waiter>>;
-
-    waiters_type _waiters;
+    void heap_push(std::unique_ptr<waiter>);
+    std::unique_ptr<waiter> heap_remove(size_t idx);
+    void sift_up(size_t idx);
+    void sift_down(size_t idx);
+
+    /// Binary min-heap keyed by offset, stored flat. The next waiter to
+    /// wake is an O(1) peek at the root and notify() batch-pops every
+    /// satisfied waiter; a wait costs no node allocation and, because each
+    /// waiter tracks its slot, timeout/abort removal is O(log n) instead of
+    /// a linear scan
+    std::vector<std::unique_ptr<waiter>> _waiters;
     model::offset _last_applied;
 };
 
@@ -0,0 +1,179 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/offset_translator_stm.h"
+
+#include "raft/consensus.h"
+#include "reflection/adl.h"
+#include "vlog.h"
+
+#include <seastar/core/future.hh>
+
+#include <algorithm>
+#include <filesystem>
+
+namespace raft {
+
+offset_translator_stm::offset_translator_stm(
+  ss::logger& logger, consensus* c)
+  : raft::state_machine(c, logger, ss::default_priority_class())
+  , _raft(c)
+  , _snapshot_mgr(
+      std::filesystem::path(c->log_config().work_directory()),
+      "offset_translator",
+      ss::default_priority_class())
+  , _log(logger) {}
+
+model::offset
+offset_translator_stm::from_log_offset(model::offset o) const {
+    // last filtered batch at or before the requested offset
+    auto it = std::upper_bound(
+      _entries.begin(),
+      _entries.end(),
+      o,
+      [](model::offset o, const filtered_entry& e) { return o < e.last_offset; });
+    if (it == _entries.begin()) {
+        return o;
+    }
+    return o - model::offset(std::prev(it)->delta);
+}
+
+model::offset offset_translator_stm::to_log_offset(model::offset o) const {
+    // last filtered batch whose translated last offset is strictly below
+    // the requested client offset, i.e. the region containing the record
+    auto it = std::upper_bound(
+      _entries.begin(),
+      _entries.end(),
+      o,
+      [](model::offset o, const filtered_entry& e) {
+          return o <= e.last_offset - model::offset(e.delta);
+      });
+    if (it == _entries.begin()) {
+        return o;
+    }
+    return o + model::offset(std::prev(it)->delta);
+}
+
+ss::future<> offset_translator_stm::apply(model::record_batch b) {
+    const auto& hdr = b.header();
+    if (hdr.type != data_batch_type) {
+        int64_t filtered = hdr.last_offset_delta + 1;
+        int64_t delta = _entries.empty() ? filtered
+                                         : _entries.back().delta + filtered;
+        _entries.push_back(filtered_entry{b.last_offset(), delta});
+        if (++_entries_since_snapshot >= snapshot_entry_interval) {
+            _entries_since_snapshot = 0;
+            (void)ss::with_gate(_gate, [this] { return do_make_snapshot(); });
+        }
+    }
+    _insync_offset = b.last_offset();
+    return ss::now();
+}
+
+ss::future<>
+offset_translator_stm::hydrate_snapshot(storage::snapshot_reader& reader) {
+    return reader.read_metadata().then([this, &reader](iobuf meta_buf) {
+        iobuf_parser meta_parser(std::move(meta_buf));
+        offset_translator_snapshot_header hdr;
+        hdr.version = reflection::adl<int8_t>{}.from(meta_parser);
+        vassert(
+          hdr.version == offset_translator_snapshot_header::supported_version,
+          "unsupported offset_translator_snapshot_header version {}",
+          hdr.version);
+        hdr.snapshot_size = reflection::adl<int32_t>{}.from(meta_parser);
+
+        return read_iobuf_exactly(reader.input(), hdr.snapshot_size)
+          .then([this](iobuf data_buf) {
+              iobuf_parser data_parser(std::move(data_buf));
+              auto data = reflection::adl<snapshot>{}.from(data_parser);
+              _entries = std::move(data.entries);
+              _last_snapshot_offset = data.offset;
+              _insync_offset = data.offset;
+              vlog(
+                _log.trace,
+                "offset_translator_stm snapshot with offset:{} is loaded",
+                data.offset);
+          })
+          .then([this]() { return _snapshot_mgr.remove_partial_snapshots(); });
+    });
+}
+
+ss::future<> offset_translator_stm::persist_snapshot(iobuf&& data) {
+    offset_translator_snapshot_header header;
+    header.version = offset_translator_snapshot_header::supported_version;
+    header.snapshot_size = data.size_bytes();
+
+    iobuf data_size_buf;
+    reflection::serialize(data_size_buf, header.version, header.snapshot_size);
+
+    return _snapshot_mgr.start_snapshot().then(
+      [this, data = std::move(data), data_size_buf = std::move(data_size_buf)](
+        storage::snapshot_writer writer) mutable {
+          return ss::do_with(
+            std::move(writer),
+            [this,
+             data = std::move(data),
+             data_size_buf = std::move(data_size_buf)](
+              storage::snapshot_writer& writer) mutable {
+                return writer.write_metadata(std::move(data_size_buf))
+                  .then([&writer, data = std::move(data)]() mutable {
+                      return write_iobuf_to_output_stream(
+                        std::move(data), writer.output());
+                  })
+                  .finally([&writer] { return writer.close(); })
+                  .then([this, &writer] {
+                      return _snapshot_mgr.finish_snapshot(writer);
+                  });
+            });
+      });
+}
+
+ss::future<> offset_translator_stm::do_make_snapshot() {
+    snapshot data;
+    data.offset = _insync_offset;
+    data.entries = _entries;
+
+    iobuf v_buf;
+    reflection::adl<snapshot>{}.to(v_buf, std::move(data));
+    return persist_snapshot(std::move(v_buf))
+      .then([this, snapshot_offset = _insync_offset]() {
+          if (snapshot_offset >= _last_snapshot_offset) {
+              _last_snapshot_offset = snapshot_offset;
+          }
+      });
+}
+
+ss::future<> offset_translator_stm::start() {
+    return _snapshot_mgr.open_snapshot().then(
+      [this](std::optional<storage::snapshot_reader> reader) {
+          auto f = ss::now();
+          if (reader) {
+              f = ss::do_with(
+                std::move(*reader), [this](storage::snapshot_reader& reader) {
+                    return hydrate_snapshot(reader).finally([this, &reader] {
+                        auto offset = std::max(
+                          _insync_offset, _raft->start_offset());
+                        if (offset >= model::offset(0)) {
+                            set_next(offset);
+                        }
+                        return reader.close();
+                    });
+                });
+          } else {
+              auto offset = _raft->start_offset();
+              if (offset >= model::offset(0)) {
+                  set_next(offset);
+              }
+          }
+
+          return f.then([this]() { return state_machine::start(); });
+      });
+}
+
+} // namespace raft
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2020 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "raft/state_machine.h"
+#include "storage/snapshot.h"
+
+#include <vector>
+
+namespace raft {
+
+class consensus;
+
+struct offset_translator_snapshot_header {
+    static constexpr const int8_t supported_version = 0;
+
+    int8_t version{offset_translator_snapshot_header::supported_version};
+    int32_t snapshot_size{0};
+};
+
+/**
+ * offset_translator_stm maps between raft log offsets and the offsets
+ * visible to kafka clients. Batches that are raft internals (configuration
+ * changes and linearizable read checkpoints) occupy log offsets but carry
+ * no client data, so the kafka offset of a record is its log offset minus
+ * the number of such records that precede it.
+ *
+ * The state is a compact vector of (last offset of a filtered batch,
+ * cumulative filtered record count) entries sorted by offset, so both
+ * translation directions are a single binary search. The vector is
+ * rebuilt on apply and periodically persisted to a snapshot file next to
+ * the log, bounding the amount of log that has to be replayed on startup.
+ */
+class offset_translator_stm final : public raft::state_machine {
+public:
+    offset_translator_stm(ss::logger&, consensus*);
+
+    ss::future<> start() final;
+
+    /**
+     * Translate a log offset to the offset visible to kafka clients. The
+     * given offset must point to a data batch record.
+     */
+    model::offset from_log_offset(model::offset) const;
+
+    /**
+     * Translate an offset provided by a kafka client back to the log
+     * offset of the corresponding data record.
+     */
+    model::offset to_log_offset(model::offset) const;
+
+private:
+    struct filtered_entry {
+        // last offset of a non-data batch
+        model::offset last_offset;
+        // number of filtered records at offsets not greater than last_offset
+        int64_t delta;
+    };
+
+    struct snapshot {
+        model::offset offset;
+        std::vector<filtered_entry> entries;
+    };
+
+    // persist the state after this many new filtered batches
+    static constexpr size_t snapshot_entry_interval = 64;
+
+    ss::future<> apply(model::record_batch) final;
+    ss::future<> hydrate_snapshot(storage::snapshot_reader&);
+    ss::future<> persist_snapshot(iobuf&& data);
+    ss::future<> do_make_snapshot();
+
+    consensus* _raft;
+    storage::snapshot_manager _snapshot_mgr;
+    ss::logger& _log;
+    std::vector<filtered_entry> _entries;
+    model::offset _insync_offset;
+    model::offset _last_snapshot_offset;
+    size_t _entries_since_snapshot{0};
+};
+
+} // namespace raft
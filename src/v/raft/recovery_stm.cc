@@ -9,6 +9,7 @@
 
 #include "raft/recovery_stm.h"
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "outcome_future_utils.h"
@@ -17,14 +18,52 @@
 #include "raft/errc.h"
 #include "raft/logger.h"
 #include "raft/raftgen_service.h"
+#include "raft/recovery_throttle.h"
 
 #include <seastar/core/future-util.hh>
+#include <seastar/core/sleep.hh>
 
 #include <chrono>
 
 namespace raft {
 using namespace std::chrono_literals;
 
+namespace {
+
+// Paces snapshot chunk transfers at the configured shard-wide rate. All
+// recovering groups on a shard draw from the same schedule, so parallel
+// snapshot transfers cannot multiply past the limit.
+class snapshot_transfer_pacer {
+public:
+    ss::future<> throttle(size_t bytes, ss::abort_source& as) {
+        const auto rate
+          = config::shard_local_cfg().raft_recovery_snapshot_rate_bytes();
+        if (rate == 0) {
+            return ss::now();
+        }
+        using clock = ss::lowres_clock;
+        const auto now = clock::now();
+        const auto cost = std::chrono::duration_cast<clock::duration>(
+          std::chrono::duration<double>(
+            static_cast<double>(bytes) / static_cast<double>(rate)));
+        // idle time is not banked, so a quiet period does not turn into a
+        // burst above the configured rate
+        const auto start = std::max(now, _next_slot);
+        _next_slot = start + cost;
+        if (start <= now) {
+            return ss::now();
+        }
+        return ss::sleep_abortable(start - now, as);
+    }
+
+private:
+    ss::lowres_clock::time_point _next_slot;
+};
+
+thread_local snapshot_transfer_pacer snapshot_pacer;
+
+} // namespace
+
 recovery_stm::recovery_stm(
   consensus* p, vnode node_id, ss::io_priority_class prio)
   : _ptr(p)
@@ -160,19 +199,18 @@ recovery_stm::should_flush(model::offset follower_committed_match_index) const {
       && (follower_has_batches_to_commit || last_replicate_with_quorum));
 }
 
-ss::future<> recovery_stm::read_range_for_recovery(
-  model::offset start_offset,
-  model::offset end_offset,
-  model::offset follower_committed_match_index) {
+ss::future<ss::circular_buffer<model::record_batch>>
+recovery_stm::read_batches(model::offset start_offset, model::offset end_offset) {
     storage::log_reader_config cfg(
       start_offset,
       end_offset,
       1,
-      // 32KB is a modest estimate. It has good batching and it also prevents an
-      // OOM situation where we have a lot of raft groups recovering at the same
-      // time and all drawing from memory. If this setting proves difficult,
-      // we'll need to throttle with a core-local semaphore
-      32 * 1024,
+      // the default is a modest 32KB. It has good batching and it also
+      // prevents an OOM situation where we have a lot of raft groups
+      // recovering at the same time and all drawing from memory. If this
+      // setting proves difficult, we'll need to throttle with a core-local
+      // semaphore
+      config::shard_local_cfg().raft_recovery_read_size(),
       _prio,
       std::nullopt,
       std::nullopt,
@@ -186,35 +224,107 @@ ss::future<> recovery_stm::read_range_for_recovery(
       _node_id);
 
     // TODO: add timeout of maybe 1minute?
-    return _ptr->_log.make_reader(cfg)
-      .then([](model::record_batch_reader reader) {
+    return _ptr->_log.make_reader(cfg).then(
+      [](model::record_batch_reader reader) {
           return model::consume_reader_to_memory(
             std::move(reader), model::no_timeout);
       })
-      .then([this, start_offset, follower_committed_match_index](
-              ss::circular_buffer<model::record_batch> batches) {
-          vlog(
-            _ctxlog.trace,
-            "Read {} batches for {} node recovery",
-            batches.size(),
-            _node_id);
-          if (batches.empty()) {
-              _stop_requested = true;
-              return ss::make_ready_future<>();
+      .then([this](ss::circular_buffer<model::record_batch> batches) {
+          // charge the recovery rate budget for what was actually read, so
+          // many groups catching up at once (e.g. after a partition move)
+          // stay within the configured node wide recovery bandwidth
+          size_t bytes = 0;
+          for (const auto& b : batches) {
+              bytes += b.size_bytes();
           }
-          auto gap_filled_batches = details::make_ghost_batches_in_gaps(
-            start_offset, std::move(batches));
-          _base_batch_offset = gap_filled_batches.begin()->base_offset();
-          _last_batch_offset = gap_filled_batches.back().last_offset();
+          return shard_recovery_throttle()
+            .throttle(bytes, _ptr->_as)
+            .then([batches = std::move(batches)]() mutable {
+                return std::move(batches);
+            });
+      });
+}
 
-          auto f_reader = model::make_foreign_memory_record_batch_reader(
-            std::move(gap_filled_batches));
+void recovery_stm::maybe_dispatch_read_ahead(model::offset start_offset) {
+    if (_read_ahead || _stop_requested || _ptr->_bg.is_closed()) {
+        return;
+    }
+    auto end_offset = _ptr->_log.offsets().dirty_offset;
+    if (start_offset > end_offset) {
+        return;
+    }
+    /*
+     * the committed offset must be captured before the read is dispatched
+     * for the same reason it is captured before the read in do_recover()
+     */
+    _read_ahead = read_ahead{
+      .base_offset = start_offset,
+      .committed_offset = _ptr->committed_offset(),
+      .batches = ss::with_gate(_ptr->_bg, [this, start_offset, end_offset] {
+          return read_batches(start_offset, end_offset);
+      })};
+}
 
-          return replicate(
-            std::move(f_reader), should_flush(follower_committed_match_index));
+ss::future<> recovery_stm::discard_read_ahead() {
+    if (!_read_ahead) {
+        return ss::now();
+    }
+    auto f = std::move(_read_ahead->batches);
+    _read_ahead.reset();
+    return f.then_wrapped(
+      [](ss::future<ss::circular_buffer<model::record_batch>> fut) {
+          fut.ignore_ready_future();
       });
 }
 
+ss::future<> recovery_stm::read_range_for_recovery(
+  model::offset start_offset,
+  model::offset end_offset,
+  model::offset follower_committed_match_index) {
+    ss::future<ss::circular_buffer<model::record_batch>> f_batches
+      = ss::make_ready_future<ss::circular_buffer<model::record_batch>>();
+
+    if (_read_ahead && _read_ahead->base_offset == start_offset) {
+        // consume the range that was read while the previous request was on
+        // the wire
+        _committed_offset = _read_ahead->committed_offset;
+        f_batches = std::move(_read_ahead->batches);
+        _read_ahead.reset();
+    } else {
+        f_batches = discard_read_ahead().then([this, start_offset, end_offset] {
+            return read_batches(start_offset, end_offset);
+        });
+    }
+
+    return f_batches.then([this, start_offset, follower_committed_match_index](
+                            ss::circular_buffer<model::record_batch> batches) {
+        vlog(
+          _ctxlog.trace,
+          "Read {} batches for {} node recovery",
+          batches.size(),
+          _node_id);
+        if (batches.empty()) {
+            _stop_requested = true;
+            return ss::make_ready_future<>();
+        }
+        auto gap_filled_batches = details::make_ghost_batches_in_gaps(
+          start_offset, std::move(batches));
+        _base_batch_offset = gap_filled_batches.begin()->base_offset();
+        _last_batch_offset = gap_filled_batches.back().last_offset();
+
+        auto f_reader = model::make_foreign_memory_record_batch_reader(
+          std::move(gap_filled_batches));
+
+        // overlap the next disk read with the request that is about to be
+        // dispatched. on success the next iteration picks it up, on failure
+        // (next index moved backward) it is dropped
+        maybe_dispatch_read_ahead(details::next_offset(_last_batch_offset));
+
+        return replicate(
+          std::move(f_reader), should_flush(follower_committed_match_index));
+    });
+}
+
 ss::future<> recovery_stm::open_snapshot_reader() {
     return _ptr->_snapshot_mgr.open_snapshot().then(
       [this](std::optional<storage::snapshot_reader> rdr) {
@@ -229,38 +339,46 @@ ss::future<> recovery_stm::open_snapshot_reader() {
 }
 
 ss::future<> recovery_stm::send_install_snapshot_request() {
-    // send 32KB at a time
-    return read_iobuf_exactly(_snapshot_reader->input(), 32_KiB)
-      .then([this](iobuf chunk) mutable {
+    return read_iobuf_exactly(
+             _snapshot_reader->input(),
+             config::shard_local_cfg().raft_recovery_snapshot_chunk_size())
+      .then([this](iobuf chunk) {
           auto chunk_size = chunk.size_bytes();
-          install_snapshot_request req{
-            .target_node_id = _node_id,
-            .term = _ptr->term(),
-            .group = _ptr->group(),
-            .node_id = _ptr->_self,
-            .last_included_index = _ptr->_last_snapshot_index,
-            .file_offset = _sent_snapshot_bytes,
-            .chunk = std::move(chunk),
-            .done = (_sent_snapshot_bytes + chunk_size) == _snapshot_size};
-
-          vlog(
-            _ctxlog.trace,
-            "Sending install snapshot request to {}, last included index: {}",
-            _node_id,
-            req.last_included_index);
-          return _ptr->_client_protocol
-            .install_snapshot(
-              _node_id.id(),
-              std::move(req),
-              rpc::client_opts(append_entries_timeout()))
-            .then([this](result<install_snapshot_reply> reply) {
-                return handle_install_snapshot_reply(
-                  _ptr->validate_reply_target_node(
-                    "install_snapshot", std::move(reply)));
+          return snapshot_pacer.throttle(chunk_size, _ptr->_as)
+            .then([this, chunk = std::move(chunk)]() mutable {
+                return do_send_install_snapshot_request(std::move(chunk));
             });
       });
 }
 
+ss::future<> recovery_stm::do_send_install_snapshot_request(iobuf chunk) {
+    auto chunk_size = chunk.size_bytes();
+    install_snapshot_request req{
+      .target_node_id = _node_id,
+      .term = _ptr->term(),
+      .group = _ptr->group(),
+      .node_id = _ptr->_self,
+      .last_included_index = _ptr->_last_snapshot_index,
+      .file_offset = _sent_snapshot_bytes,
+      .chunk = std::move(chunk),
+      .done = (_sent_snapshot_bytes + chunk_size) == _snapshot_size};
+
+    vlog(
+      _ctxlog.trace,
+      "Sending install snapshot request to {}, last included index: {}",
+      _node_id,
+      req.last_included_index);
+    return _ptr->_client_protocol
+      .install_snapshot(
+        _node_id.id(),
+        std::move(req),
+        rpc::client_opts(append_entries_timeout()))
+      .then([this](result<install_snapshot_reply> reply) {
+          return handle_install_snapshot_reply(_ptr->validate_reply_target_node(
+            "install_snapshot", std::move(reply)));
+      });
+}
+
 ss::future<> recovery_stm::close_snapshot_reader() {
     return _snapshot_reader->close().then([this] {
         _snapshot_reader.reset();
@@ -476,10 +594,11 @@ ss::future<> recovery_stm::apply() {
               meta.value()->is_recovering = false;
               meta.value()->recovery_finished.broadcast();
           }
+          auto f = discard_read_ahead();
           if (_snapshot_reader != nullptr) {
-              return close_snapshot_reader();
+              return f.then([this] { return close_snapshot_reader(); });
           }
-          return ss::now();
+          return f;
       });
 }
 
@@ -12,10 +12,13 @@
 #pragma once
 
 #include "model/metadata.h"
+#include "model/record.h"
 #include "outcome.h"
 #include "raft/logger.h"
 #include "storage/snapshot.h"
 
+#include <seastar/core/circular_buffer.hh>
+
 namespace raft {
 
 class recovery_stm {
@@ -27,6 +30,10 @@ private:
     ss::future<> do_recover();
     ss::future<>
       read_range_for_recovery(model::offset, model::offset, model::offset);
+    ss::future<ss::circular_buffer<model::record_batch>>
+      read_batches(model::offset, model::offset);
+    void maybe_dispatch_read_ahead(model::offset);
+    ss::future<> discard_read_ahead();
     ss::future<> replicate(
       model::record_batch_reader&&, append_entries_request::flush_after_append);
     ss::future<result<append_entries_reply>>
@@ -36,6 +43,7 @@ private:
 
     ss::future<> install_snapshot();
     ss::future<> send_install_snapshot_request();
+    ss::future<> do_send_install_snapshot_request(iobuf);
     ss::future<> handle_install_snapshot_reply(result<install_snapshot_reply>);
     ss::future<> open_snapshot_reader();
     ss::future<> close_snapshot_reader();
@@ -57,6 +65,21 @@ private:
     size_t _snapshot_size = 0;
     // needed to early exit. (node down)
     bool _stop_requested = false;
+
+    /*
+     * recovery pipelining: while an append_entries request is on the wire
+     * the next range is already being read from disk. the read ahead is
+     * only consumed when the follower's next index still matches the range
+     * base - a failed request that moves next index backward simply drops
+     * it. the committed offset is captured before the read is dispatched,
+     * see the ordering discussion in do_recover().
+     */
+    struct read_ahead {
+        model::offset base_offset;
+        model::offset committed_offset;
+        ss::future<ss::circular_buffer<model::record_batch>> batches;
+    };
+    std::optional<read_ahead> _read_ahead;
 };
 
 } // namespace raft
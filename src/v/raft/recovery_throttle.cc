@@ -0,0 +1,25 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/recovery_throttle.h"
+
+#include "config/configuration.h"
+
+#include <seastar/core/smp.hh>
+
+namespace raft {
+
+recovery_throttle& shard_recovery_throttle() {
+    static thread_local recovery_throttle throttle(
+      config::shard_local_cfg().raft_learner_recovery_rate()
+      / ss::smp::count);
+    return throttle;
+}
+
+} // namespace raft
@@ -0,0 +1,76 @@
+/*
+ * Copyright 2020 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/abort_source.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/semaphore.hh>
+#include <seastar/core/timer.hh>
+
+namespace raft {
+
+/*
+ * Token bucket limiting how many bytes follower/learner recovery may read
+ * per second on this shard, so background catch up (e.g. during partition
+ * movement) does not starve foreground produce and fetch traffic. The node
+ * wide budget from configuration is split evenly across shards. The bucket
+ * never accumulates more than one second worth of budget, so an idle
+ * period does not turn into a burst.
+ */
+class recovery_throttle {
+public:
+    explicit recovery_throttle(size_t rate_bytes_per_sec)
+      : _rate(std::max(rate_bytes_per_sec, size_t{1}))
+      , _sem(_rate) {
+        _refill_timer.set_callback([this] { refill(); });
+        _refill_timer.arm_periodic(std::chrono::seconds(1));
+    }
+
+    /*
+     * Charge the bucket for bytes that were read for recovery, waiting for
+     * budget when the rate is exceeded. The wait is chunked so shutdown is
+     * observed via the abort source instead of blocking gate closure.
+     */
+    ss::future<> throttle(size_t bytes, ss::abort_source& as) {
+        const auto count = std::min(std::max(bytes, size_t{1}), _rate);
+        return ss::repeat([this, count, &as] {
+            if (as.abort_requested()) {
+                return ss::make_ready_future<ss::stop_iteration>(
+                  ss::stop_iteration::yes);
+            }
+            return _sem.wait(std::chrono::seconds(1), count)
+              .then([] { return ss::stop_iteration::yes; })
+              .handle_exception_type([](const ss::semaphore_timed_out&) {
+                  return ss::stop_iteration::no;
+              });
+        });
+    }
+
+private:
+    void refill() {
+        const auto available = _sem.current();
+        if (available < _rate) {
+            _sem.signal(_rate - available);
+        }
+    }
+
+    size_t _rate;
+    ss::semaphore _sem;
+    ss::timer<> _refill_timer;
+};
+
+/// shard local throttle shared by every group recovering on this core
+recovery_throttle& shard_recovery_throttle();
+
+} // namespace raft
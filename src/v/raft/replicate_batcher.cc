@@ -29,19 +29,45 @@
 
 namespace raft {
 using namespace std::chrono_literals; // NOLINT
-replicate_batcher::replicate_batcher(consensus* ptr, size_t cache_size)
+replicate_batcher::replicate_batcher(
+  consensus* ptr, size_t cache_size, std::chrono::milliseconds max_linger)
   : _ptr(ptr)
-  , _max_batch_size_sem(cache_size) {}
+  , _max_batch_size_sem(cache_size)
+  , _linger_target_bytes(cache_size / 8)
+  , _max_linger(max_linger)
+  , _arrival_rate(1s) {}
 
 ss::future<result<replicate_result>> replicate_batcher::replicate(
   std::optional<model::term_id> expected_term, model::record_batch_reader&& r) {
     return do_cache(expected_term, std::move(r)).then([this](item_ptr i) {
-        return _lock.with([this] { return flush(); }).then([i] {
-            return i->_promise.get_future();
-        });
+        return maybe_linger()
+          .then([this] { return _lock.with([this] { return flush(); }); })
+          .then([i] { return i->_promise.get_future(); });
     });
 }
 
+ss::future<> replicate_batcher::maybe_linger() {
+    if (_max_linger <= 0ms || _pending_bytes >= _linger_target_bytes) {
+        return ss::now();
+    }
+    auto rate = _arrival_rate.measure(ss::lowres_clock::now());
+    if (rate <= 0) {
+        return ss::now();
+    }
+    // time for arrivals at the observed rate to build the target batch
+    auto fill = std::chrono::duration<double>(
+      static_cast<double>(_linger_target_bytes - _pending_bytes) / rate);
+    if (fill > _max_linger) {
+        // a low-rate partition won't build the batch within the latency
+        // budget, flushing now keeps its acks latency unchanged
+        return ss::now();
+    }
+    // the first waiter to wake up flushes everything accumulated in the
+    // meantime, later waiters find an empty cache and no-op
+    return ss::sleep(
+      std::chrono::duration_cast<std::chrono::microseconds>(fill));
+}
+
 ss::future<> replicate_batcher::stop() {
     // we keep a lock here to make sure that all inflight requests have finished
     // already
@@ -52,6 +78,7 @@ ss::future<> replicate_batcher::stop() {
                                  "finish replicating pending entries"));
         }
         _item_cache.clear();
+        _pending_bytes = 0;
     });
 }
 
@@ -79,7 +106,7 @@ replicate_batcher::do_cache_with_backpressure(
   ss::circular_buffer<model::record_batch> batches,
   size_t bytes) {
     return ss::get_units(_max_batch_size_sem, bytes)
-      .then([this, expected_term, batches = std::move(batches)](
+      .then([this, expected_term, bytes, batches = std::move(batches)](
 
               ss::semaphore_units<> u) mutable {
           size_t record_count = 0;
@@ -96,12 +123,16 @@ replicate_batcher::do_cache_with_backpressure(
           i->record_count = record_count;
           i->units = std::move(u);
           _item_cache.emplace_back(i);
+          _pending_bytes += bytes;
+          _arrival_rate.record_and_measure(
+            static_cast<double>(bytes), ss::lowres_clock::now());
           return i;
       });
 }
 
 ss::future<> replicate_batcher::flush() {
     auto item_cache = std::exchange(_item_cache, {});
+    _pending_bytes = 0;
     if (item_cache.empty()) {
         return ss::now();
     }
@@ -14,12 +14,15 @@
 #include "model/record_batch_reader.h"
 #include "outcome.h"
 #include "raft/types.h"
+#include "resource_mgmt/rate.h"
 #include "units.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/semaphore.hh>
 
 #include <absl/container/flat_hash_map.h>
+
+#include <chrono>
 namespace raft {
 class consensus;
 
@@ -37,7 +40,14 @@ public:
         ss::semaphore_units<> units;
     };
     using item_ptr = ss::lw_shared_ptr<item>;
-    explicit replicate_batcher(consensus* ptr, size_t cache_size);
+    /// \param cache_size is a bound on the number of cached request bytes
+    /// \param max_linger is an acks-latency budget: a flush may be held
+    ///        this long waiting for more data when the observed arrival
+    ///        rate predicts a fuller batch, 0 flushes immediately
+    explicit replicate_batcher(
+      consensus* ptr,
+      size_t cache_size,
+      std::chrono::milliseconds max_linger = std::chrono::milliseconds(0));
 
     replicate_batcher(replicate_batcher&&) noexcept = default;
     replicate_batcher& operator=(replicate_batcher&&) noexcept = delete;
@@ -66,8 +76,22 @@ private:
       ss::circular_buffer<model::record_batch>,
       size_t);
 
+    /// Hold the flush for up to the linger budget when the observed
+    /// arrival rate predicts that waiting builds a meaningfully larger
+    /// batch. Low-rate partitions flush immediately so their acks
+    /// latency is unchanged.
+    ss::future<> maybe_linger();
+
     consensus* _ptr;
     ss::semaphore _max_batch_size_sem;
+    /// Bytes cached at which a flush is considered full enough to skip
+    /// the linger
+    size_t _linger_target_bytes;
+    std::chrono::milliseconds _max_linger;
+    /// Arrival rate of replicate payload in bytes/sec
+    rate_estimator _arrival_rate;
+    /// Bytes currently held in '_item_cache'
+    size_t _pending_bytes{0};
 
     std::vector<item_ptr> _item_cache;
     mutex _lock;
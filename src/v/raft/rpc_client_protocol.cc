@@ -29,7 +29,8 @@ ss::future<result<vote_reply>> rpc_client_protocol::vote(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.vote(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<vote_reply>);
-      });
+      },
+      rpc::transport_lane::low_latency);
 }
 
 ss::future<result<append_entries_reply>> rpc_client_protocol::append_entries(
@@ -57,7 +58,8 @@ ss::future<result<heartbeat_reply>> rpc_client_protocol::heartbeat(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.heartbeat(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<heartbeat_reply>);
-      });
+      },
+      rpc::transport_lane::low_latency);
 }
 
 ss::future<result<install_snapshot_reply>>
@@ -86,7 +88,8 @@ ss::future<result<timeout_now_reply>> rpc_client_protocol::timeout_now(
        opts = std::move(opts)](raftgen_client_protocol client) mutable {
           return client.timeout_now(std::move(r), std::move(opts))
             .then(&rpc::get_ctx_data<timeout_now_reply>);
-      });
+      },
+      rpc::transport_lane::low_latency);
 }
 
 } // namespace raft
@@ -65,21 +65,8 @@ public:
     [[gnu::always_inline]] ss::future<heartbeat_reply>
     heartbeat(heartbeat_request&& r, rpc::streaming_context&) final {
         using ret_t = std::vector<append_entries_reply>;
-        std::vector<append_entries_request> reqs;
-        reqs.reserve(r.heartbeats.size());
-        for (auto& m : r.heartbeats) {
-            append_entries_request append_req(
-              m.node_id,
-              m.target_node_id,
-              m.meta,
-              model::make_memory_record_batch_reader(
-                ss::circular_buffer<model::record_batch>{}),
-              append_entries_request::flush_after_append::no);
-            reqs.push_back(std::move(append_req));
-        };
-
-        auto req_size = reqs.size();
-        auto groupped = group_hbeats_by_shard(std::move(reqs));
+        auto req_size = r.heartbeats.size();
+        auto groupped = group_hbeats_by_shard(std::move(r.heartbeats));
 
         std::vector<ss::future<std::vector<append_entries_reply>>> futures;
         futures.reserve(groupped.shard_requests.size());
@@ -94,9 +81,9 @@ public:
           std::begin(groupped.group_missing_requests),
           std::end(groupped.group_missing_requests),
           std::back_inserter(group_missing_replies),
-          [](append_entries_request& r) {
+          [](heartbeat_metadata& hb) {
               return append_entries_reply{
-                .group = r.meta.group,
+                .group = hb.meta.group,
                 .result = append_entries_reply::status::group_unavailable};
           });
 
@@ -117,62 +104,70 @@ public:
 
     [[gnu::always_inline]] ss::future<vote_reply>
     vote(vote_request&& r, rpc::streaming_context&) final {
-        return _probe.vote().then([this, r = std::move(r)]() mutable {
-            return dispatch_request(
-              std::move(r),
-              &service::make_failed_vote_reply,
-              [](vote_request&& r, consensus_ptr c) {
-                  return c->vote(std::move(r));
-              });
-        });
+        return finjector::maybe_inject(
+          [this] { return _probe.vote(); }, [this, r = std::move(r)]() mutable {
+              return dispatch_request(
+                std::move(r),
+                &service::make_failed_vote_reply,
+                [](vote_request&& r, consensus_ptr c) {
+                    return c->vote(std::move(r));
+                });
+          });
     }
 
     [[gnu::always_inline]] ss::future<append_entries_reply>
     append_entries(append_entries_request&& r, rpc::streaming_context&) final {
-        return _probe.append_entries().then([this, r = std::move(r)]() mutable {
-            auto gr = r.target_group();
-            return dispatch_request(
-              append_entries_request::make_foreign(std::move(r)),
-              [gr]() { return make_missing_group_reply(gr); },
-              [](append_entries_request&& r, consensus_ptr c) {
-                  return c->append_entries(std::move(r));
-              });
-        });
+        return finjector::maybe_inject(
+          [this] { return _probe.append_entries(); },
+          [this, r = std::move(r)]() mutable {
+              auto gr = r.target_group();
+              return dispatch_request(
+                append_entries_request::make_foreign(std::move(r)),
+                [gr]() { return make_missing_group_reply(gr); },
+                [](append_entries_request&& r, consensus_ptr c) {
+                    return c->append_entries(std::move(r));
+                });
+          });
     }
 
     [[gnu::always_inline]] ss::future<install_snapshot_reply> install_snapshot(
       install_snapshot_request&& r, rpc::streaming_context&) final {
-        return _probe.install_snapshot().then([this,
-                                               r = std::move(r)]() mutable {
-            return dispatch_request(
-              std::move(install_snapshot_request_foreign_wrapper(std::move(r))),
-              &service::make_failed_install_snapshot_reply,
-              [](
-                install_snapshot_request_foreign_wrapper&& r, consensus_ptr c) {
-                  return c->install_snapshot(r.copy());
-              });
-        });
+        return finjector::maybe_inject(
+          [this] { return _probe.install_snapshot(); },
+          [this, r = std::move(r)]() mutable {
+              return dispatch_request(
+                install_snapshot_request_foreign_wrapper(std::move(r)),
+                &service::make_failed_install_snapshot_reply,
+                [](
+                  install_snapshot_request_foreign_wrapper&& r,
+                  consensus_ptr c) { return c->install_snapshot(r.copy()); });
+          });
     }
 
     [[gnu::always_inline]] ss::future<timeout_now_reply>
     timeout_now(timeout_now_request&& r, rpc::streaming_context&) final {
-        return _probe.timeout_now().then([this, r = std::move(r)]() mutable {
-            return dispatch_request(
-              std::move(r),
-              &service::make_failed_timeout_now_reply,
-              [](timeout_now_request&& r, consensus_ptr c) {
-                  return c->timeout_now(std::move(r));
-              });
-        });
+        return finjector::maybe_inject(
+          [this] { return _probe.timeout_now(); },
+          [this, r = std::move(r)]() mutable {
+              return dispatch_request(
+                std::move(r),
+                &service::make_failed_timeout_now_reply,
+                [](timeout_now_request&& r, consensus_ptr c) {
+                    return c->timeout_now(std::move(r));
+                });
+          });
     }
 
 private:
     using consensus_ptr = seastar::lw_shared_ptr<consensus>;
-    using hbeats_t = std::vector<append_entries_request>;
+    // heartbeats travel between cores as the flat metadata entries; the
+    // per-group append_entries_request (and its empty batch reader) is only
+    // materialized on the shard that owns the group
+    using hbeats_t = std::vector<heartbeat_metadata>;
     using hbeats_ptr = ss::foreign_ptr<std::unique_ptr<hbeats_t>>;
     struct shard_groupped_hbeat_requests {
         absl::flat_hash_map<ss::shard_id, hbeats_ptr> shard_requests;
-        std::vector<append_entries_request> group_missing_requests;
+        std::vector<heartbeat_metadata> group_missing_requests;
     };
 
     static ss::future<vote_reply> make_failed_vote_reply() {
@@ -251,7 +246,14 @@ private:
           reqs->begin(),
           reqs->end(),
           std::back_inserter(futures),
-          [this, &m](append_entries_request& req) mutable {
+          [this, &m](heartbeat_metadata& hb) mutable {
+              append_entries_request req(
+                hb.node_id,
+                hb.target_node_id,
+                hb.meta,
+                model::make_memory_record_batch_reader(
+                  ss::circular_buffer<model::record_batch>{}),
+                append_entries_request::flush_after_append::no);
               return dispatch_append_entries(m, std::move(req));
           });
 
@@ -269,8 +271,7 @@ private:
 
             auto shard = _shard_table.shard_for(r.meta.group);
             if (!ret.shard_requests.contains(shard)) {
-                auto hbeats = ss::make_foreign(
-                  std::make_unique<std::vector<append_entries_request>>());
+                auto hbeats = ss::make_foreign(std::make_unique<hbeats_t>());
                 hbeats->push_back(std::move(r));
                 ret.shard_requests.emplace(shard, std::move(hbeats));
                 continue;
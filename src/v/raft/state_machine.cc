@@ -15,6 +15,8 @@
 #include "storage/log.h"
 #include "storage/record_batch_builder.h"
 
+#include <seastar/core/sleep.hh>
+
 namespace raft {
 
 state_machine::state_machine(
@@ -53,22 +55,34 @@ model::offset state_machine::bootstrap_last_applied() const {
     return _bootstrap_last_applied;
 }
 
-state_machine::batch_applicator::batch_applicator(state_machine* machine)
+state_machine::batch_collector::batch_collector(state_machine* machine)
   : _machine(machine) {}
 
 ss::future<ss::stop_iteration>
-state_machine::batch_applicator::operator()(model::record_batch batch) {
+state_machine::batch_collector::operator()(model::record_batch batch) {
     if (_machine->stop_batch_applicator()) {
         return ss::make_ready_future<ss::stop_iteration>(
           ss::stop_iteration::yes);
     }
 
-    auto last_offset = batch.last_offset();
-    return _machine->apply(std::move(batch)).then([this, last_offset] {
-        _last_applied = last_offset;
-        _machine->_waiters.notify(_last_applied);
-        return ss::stop_iteration::no;
-    });
+    _bytes += batch.size_bytes();
+    _batches.push_back(std::move(batch));
+    // stop collecting once the span caps are reached, the remainder of the
+    // committed range is picked up by the next apply loop iteration
+    auto full = _batches.size() >= max_apply_batches
+                || _bytes >= max_apply_bytes;
+    return ss::make_ready_future<ss::stop_iteration>(
+      full ? ss::stop_iteration::yes : ss::stop_iteration::no);
+}
+
+ss::future<> state_machine::apply_batches(
+  std::vector<model::record_batch> batches) {
+    return ss::do_with(
+      std::move(batches), [this](std::vector<model::record_batch>& batches) {
+          return ss::do_for_each(batches, [this](model::record_batch& b) {
+              return apply(std::move(b));
+          });
+      });
 }
 
 bool state_machine::stop_batch_applicator() { return _gate.is_closed(); }
@@ -104,6 +118,15 @@ ss::future<> state_machine::apply() {
     // wait until consensus commit index is >= _next
     return _raft->events()
       .wait(_next, model::no_timeout, _as)
+      .then([this] {
+          if (_apply_delay <= std::chrono::milliseconds(0)) {
+              return ss::now();
+          }
+          // low priority stm, linger so more entries commit and get
+          // applied as one span
+          return ss::sleep_abortable(_apply_delay, _as)
+            .handle_exception_type([](const ss::sleep_aborted&) {});
+      })
       .then([this] {
           // build a reader for log range [_next, +inf).
           storage::log_reader_config config(
@@ -111,13 +134,19 @@ ss::future<> state_machine::apply() {
           return _raft->make_reader(config);
       })
       .then([this](model::record_batch_reader reader) {
-          // apply each batch to the state machine
+          // collect a span of committed batches and apply them together
           return std::move(reader)
-            .consume(batch_applicator(this), model::no_timeout)
-            .then([this](model::offset last_applied) {
-                if (last_applied >= model::offset(0)) {
-                    _next = last_applied + model::offset(1);
+            .consume(batch_collector(this), model::no_timeout)
+            .then([this](std::vector<model::record_batch> batches) {
+                if (batches.empty()) {
+                    return ss::now();
                 }
+                auto last_applied = batches.back().last_offset();
+                return apply_batches(std::move(batches))
+                  .then([this, last_applied] {
+                      _next = last_applied + model::offset(1);
+                      _waiters.notify(last_applied);
+                  });
             });
       })
       .handle_exception([this](const std::exception_ptr& e) {
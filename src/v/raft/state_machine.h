@@ -23,6 +23,9 @@
 #include <seastar/core/gate.hh>
 #include <seastar/util/log.hh>
 
+#include <chrono>
+#include <vector>
+
 namespace raft {
 
 class consensus;
@@ -73,6 +76,15 @@ public:
      * is returned an error is logged and the same batch will be applied again.
      */
     virtual ss::future<> apply(model::record_batch) = 0;
+
+    /**
+     * Applies a span of committed batches, bounded by max_apply_batches and
+     * max_apply_bytes. The default implementation replays them one by one
+     * through apply(); implementations that can amortize locking or kvstore
+     * writes across a whole committed range may override it instead of
+     * apply(). On failure the entire span is applied again.
+     */
+    virtual ss::future<> apply_batches(std::vector<model::record_batch>);
     /**
      * Return last applied offset established when STM starts. This can be used
      * to wait for the entries to be applied when STM is starting.
@@ -88,25 +100,50 @@ public:
     ss::future<result<replicate_result>>
       quorum_write_empty_batch(model::timeout_clock::time_point);
 
+    /**
+     * Skip replaying the log prefix below the given offset. Must be called
+     * before start(); the caller is responsible for having restored the
+     * machine's state from a snapshot covering every entry below the offset.
+     */
+    void start_from(model::offset next) { set_next(next); }
+
     virtual ~state_machine() {}
 
 protected:
     void set_next(model::offset offset);
+
+    /**
+     * Let the apply loop linger for the given duration after new entries
+     * commit before reading them, so that a low priority stm coalesces its
+     * work into fewer, larger spans on a busy shard. Zero (the default)
+     * applies entries as soon as they commit.
+     */
+    void set_apply_coalescing_delay(std::chrono::milliseconds d) {
+        _apply_delay = d;
+    }
+
     ss::gate _gate;
 
 private:
-    class batch_applicator {
+    // caps for a single apply_batches span
+    static constexpr size_t max_apply_batches = 256;
+    static constexpr size_t max_apply_bytes = 1024 * 1024;
+
+    class batch_collector {
     public:
-        explicit batch_applicator(state_machine*);
+        explicit batch_collector(state_machine*);
         ss::future<ss::stop_iteration> operator()(model::record_batch);
-        model::offset end_of_stream() const { return _last_applied; }
+        std::vector<model::record_batch> end_of_stream() {
+            return std::move(_batches);
+        }
 
     private:
         state_machine* _machine;
-        model::offset _last_applied;
+        std::vector<model::record_batch> _batches;
+        size_t _bytes{0};
     };
 
-    friend batch_applicator;
+    friend batch_collector;
 
     ss::future<> apply();
     bool stop_batch_applicator();
@@ -116,6 +153,7 @@ private:
     ss::logger& _log;
     offset_monitor _waiters;
     model::offset _next;
+    std::chrono::milliseconds _apply_delay{0};
     ss::abort_source _as;
     model::offset _bootstrap_last_applied;
 };
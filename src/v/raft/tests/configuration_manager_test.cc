@@ -265,3 +265,22 @@ FIXTURE_TEST(test_assigning_initial_revision, config_manager_fixture) {
     BOOST_REQUIRE(
       mgr.get_latest().contains(raft::vnode(model::node_id(1), new_revision)));
 }
+
+FIXTURE_TEST(test_latest_snapshot, config_manager_fixture) {
+    auto configurations = test_configurations();
+
+    auto snapshot = _cfg_mgr.get_latest_snapshot();
+    BOOST_REQUIRE_EQUAL(*snapshot, configurations[5]);
+    BOOST_REQUIRE_EQUAL(*snapshot, _cfg_mgr.get_latest());
+
+    // RCU semantics: a held snapshot is immutable, new readers see the
+    // freshly published configuration
+    auto new_cfg = add_random_cfg(model::offset(2000));
+    BOOST_REQUIRE_EQUAL(*snapshot, configurations[5]);
+    BOOST_REQUIRE_EQUAL(*_cfg_mgr.get_latest_snapshot(), new_cfg);
+
+    // truncation also re-publishes
+    _cfg_mgr.truncate(model::offset(2000)).get0();
+    BOOST_REQUIRE_EQUAL(*_cfg_mgr.get_latest_snapshot(), configurations[5]);
+    BOOST_REQUIRE_EQUAL(*snapshot, configurations[5]);
+}
@@ -35,24 +35,32 @@ raft::group_configuration random_configuration() {
     auto brokers = random_brokers();
     raft::group_nodes current;
     for (auto& b : brokers) {
-        if (random_generators::get_int(0, 100) > 50) {
+        auto roll = random_generators::get_int(0, 100);
+        if (roll > 66) {
             current.voters.emplace_back(
               b.id(), model::revision_id(random_generators::get_int(100)));
-        } else {
+        } else if (roll > 33) {
             current.learners.emplace_back(
               b.id(), model::revision_id(random_generators::get_int(100)));
+        } else {
+            current.observers.emplace_back(
+              b.id(), model::revision_id(random_generators::get_int(100)));
         }
     }
 
     if (random_generators::get_int(0, 100) > 50) {
         raft::group_nodes old;
         for (auto& b : brokers) {
-            if (random_generators::get_int(0, 100) > 50) {
+            auto roll = random_generators::get_int(0, 100);
+            if (roll > 66) {
                 old.voters.emplace_back(
                   b.id(), model::revision_id(random_generators::get_int(100)));
-            } else {
+            } else if (roll > 33) {
                 old.learners.emplace_back(
                   b.id(), model::revision_id(random_generators::get_int(100)));
+            } else {
+                old.observers.emplace_back(
+                  b.id(), model::revision_id(random_generators::get_int(100)));
             }
         }
         return raft::group_configuration(
@@ -215,14 +223,20 @@ iobuf serialize_v1() {
     return buffer;
 }
 
+// group_nodes as serialized before observers were added in version 4
+struct group_nodes_v2 {
+    std::vector<raft::vnode> voters;
+    std::vector<raft::vnode> learners;
+};
+
 iobuf serialize_v2() {
     iobuf buffer;
 
-    raft::group_nodes current;
+    group_nodes_v2 current;
     current.learners.emplace_back(node_0.id, model::revision_id(15));
     current.voters.emplace_back(node_1.id, model::revision_id(10));
 
-    std::optional<raft::group_nodes> old = raft::group_nodes{};
+    std::optional<group_nodes_v2> old = group_nodes_v2{};
     old->voters.emplace_back(node_2.id, model::revision_id(5));
 
     reflection::serialize(
@@ -238,20 +252,21 @@ iobuf serialize_v2() {
 iobuf serialize_v3() {
     iobuf buffer;
 
-    raft::group_nodes current;
+    group_nodes_v2 current;
     current.learners.emplace_back(node_0.id, model::revision_id(15));
     current.voters.emplace_back(node_1.id, model::revision_id(10));
 
-    raft::group_nodes old;
-    old.voters.emplace_back(node_2.id, model::revision_id(5));
+    std::optional<group_nodes_v2> old = group_nodes_v2{};
+    old->voters.emplace_back(node_2.id, model::revision_id(5));
 
-    raft::group_configuration cfg(
+    reflection::serialize(
+      buffer,
+      (uint8_t)3, // version
       std::vector<model::broker>{
         node_0.to_v3(), node_1.to_v3(), node_2.to_v3()},
       std::move(current),
-      model::revision_id(15),
-      std::move(old));
-    reflection::serialize(buffer, cfg);
+      std::move(old),
+      model::revision_id(15));
     return buffer;
 }
 
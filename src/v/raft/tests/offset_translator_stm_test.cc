@@ -0,0 +1,62 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/fundamental.h"
+#include "raft/offset_translator_stm.h"
+#include "raft/tests/mux_state_machine_fixture.h"
+#include "raft/tests/raft_group_fixture.h"
+#include "raft/types.h"
+#include "storage/tests/utils/random_batch.h"
+#include "test_utils/async.h"
+
+#include <seastar/util/defer.hh>
+
+static ss::logger ot_logger{"offset-translator-test"};
+
+FIXTURE_TEST(test_offset_translation, mux_state_machine_fixture) {
+    start_raft();
+
+    raft::offset_translator_stm stm(ot_logger, _raft.get());
+    stm.start().get0();
+    auto stop = ss::defer([&stm] { stm.stop().get0(); });
+
+    wait_for_leader();
+
+    // the log starts with a configuration batch and the empty quorum write
+    // appends a checkpoint batch, both invisible to kafka clients
+    auto ck = stm
+                .quorum_write_empty_batch(
+                  model::timeout_clock::now() + 5s)
+                .get0();
+    BOOST_REQUIRE((bool)ck);
+
+    auto rdr = random_batch_reader(storage::test::record_batch_spec{
+      .offset = model::offset(0), .allow_compression = true, .count = 5});
+    auto res = _raft
+                 ->replicate(
+                   std::move(rdr),
+                   raft::replicate_options(
+                     raft::consistency_level::quorum_ack))
+                 .get0();
+    BOOST_REQUIRE((bool)res);
+    auto last_log_offset = res.value().last_offset;
+    stm.wait(last_log_offset, model::no_timeout).get0();
+
+    auto client_offset = stm.from_log_offset(last_log_offset);
+    // at least the configuration and the checkpoint records are filtered
+    // out of the client offset space
+    BOOST_REQUIRE_LE(client_offset, last_log_offset - model::offset(2));
+    // translation has to round trip for data records
+    BOOST_REQUIRE_EQUAL(stm.to_log_offset(client_offset), last_log_offset);
+
+    // adjacent data records stay adjacent in the client offset space
+    BOOST_REQUIRE_EQUAL(
+      stm.from_log_offset(last_log_offset - model::offset(1)),
+      client_offset - model::offset(1));
+}
@@ -18,6 +18,9 @@
 #include "vassert.h"
 #include "vlog.h"
 
+#include <seastar/core/do_with.hh>
+#include <seastar/core/future-util.hh>
+
 #include <fmt/ostream.h>
 
 #include <type_traits>
@@ -168,44 +171,93 @@ struct rpc_model_reader_consumer {
     iobuf& ref;
 };
 
+/*
+ * Recovery traffic routinely carries multi-MB batch vectors, and encoding or
+ * decoding one in a single synchronous stretch stalls every other fiber on
+ * the shard - most visibly heartbeat processing. Yield back to the reactor
+ * once roughly this many bytes have been handled without a suspension point.
+ */
+static constexpr size_t max_synchronous_serialize_bytes = 128 * 1024;
+
 ss::future<> async_adl<raft::append_entries_request>::to(
   iobuf& out, raft::append_entries_request&& request) {
     return model::consume_reader_to_memory(
              std::move(request.batches), model::no_timeout)
       .then([&out, request = std::move(request)](
-              ss::circular_buffer<model::record_batch> batches) {
+              ss::circular_buffer<model::record_batch> batches) mutable {
           reflection::adl<uint32_t>{}.to(out, batches.size());
-          for (auto& batch : batches) {
-              reflection::serialize(out, std::move(batch));
-          }
-          reflection::serialize(
-            out,
-            request.target_node_id,
-            request.meta,
-            request.node_id,
-            request.flush);
+          return ss::do_with(
+                   std::move(batches),
+                   size_t{0},
+                   [&out](
+                     ss::circular_buffer<model::record_batch>& batches,
+                     size_t& bytes_since_yield) {
+                       return ss::do_for_each(
+                         batches,
+                         [&out,
+                          &bytes_since_yield](model::record_batch& batch) {
+                             bytes_since_yield += batch.size_bytes();
+                             reflection::serialize(out, std::move(batch));
+                             if (
+                               bytes_since_yield
+                               >= max_synchronous_serialize_bytes) {
+                                 bytes_since_yield = 0;
+                                 return ss::later();
+                             }
+                             return ss::now();
+                         });
+                   })
+            .then([&out, request = std::move(request)] {
+                reflection::serialize(
+                  out,
+                  request.target_node_id,
+                  request.meta,
+                  request.node_id,
+                  request.flush);
+            });
       });
 }
 
 ss::future<raft::append_entries_request>
 async_adl<raft::append_entries_request>::from(iobuf_parser& in) {
     auto batchCount = reflection::adl<uint32_t>{}.from(in);
-    auto batches = ss::circular_buffer<model::record_batch>{};
-    batches.reserve(batchCount);
-    for (uint32_t i = 0; i < batchCount; ++i) {
-        batches.push_back(adl<model::record_batch>{}.from(in));
-    }
-    auto reader = model::make_memory_record_batch_reader(std::move(batches));
-    auto target_node = reflection::adl<raft::vnode>{}.from(in);
-    auto meta = reflection::adl<raft::protocol_metadata>{}.from(in);
-    auto n = reflection::adl<raft::vnode>{}.from(in);
-    auto flush
-      = reflection::adl<raft::append_entries_request::flush_after_append>{}
-          .from(in);
-
-    raft::append_entries_request ret(
-      n, target_node, meta, std::move(reader), flush);
-    return ss::make_ready_future<raft::append_entries_request>(std::move(ret));
+    return ss::do_with(
+      ss::circular_buffer<model::record_batch>{},
+      size_t{0},
+      [&in, batchCount](
+        ss::circular_buffer<model::record_batch>& batches,
+        size_t& bytes_since_yield) {
+          batches.reserve(batchCount);
+          return ss::do_until(
+                   [&batches, batchCount] {
+                       return batches.size() == batchCount;
+                   },
+                   [&in, &batches, &bytes_since_yield] {
+                       batches.push_back(adl<model::record_batch>{}.from(in));
+                       bytes_since_yield += batches.back().size_bytes();
+                       if (
+                         bytes_since_yield
+                         >= max_synchronous_serialize_bytes) {
+                           bytes_since_yield = 0;
+                           return ss::later();
+                       }
+                       return ss::now();
+                   })
+            .then([&in, &batches] {
+                auto reader = model::make_memory_record_batch_reader(
+                  std::move(batches));
+                auto target_node = reflection::adl<raft::vnode>{}.from(in);
+                auto meta = reflection::adl<raft::protocol_metadata>{}.from(
+                  in);
+                auto n = reflection::adl<raft::vnode>{}.from(in);
+                auto flush = reflection::adl<
+                               raft::append_entries_request::
+                                 flush_after_append>{}
+                               .from(in);
+                return raft::append_entries_request(
+                  n, target_node, meta, std::move(reader), flush);
+            });
+      });
 }
 
 void adl<raft::protocol_metadata>::to(
@@ -11,20 +11,29 @@
 
 #include "archival/ntp_archiver_service.h"
 #include "archival/service.h"
+#include "bytes/details/io_allocation_size.h"
+#include "bytes/details/io_fragment_stats.h"
 #include "cluster/cluster_utils.h"
 #include "cluster/id_allocator.h"
 #include "cluster/id_allocator_frontend.h"
+#include "cluster/leader_balancer.h"
+#include "cluster/members_table.h"
 #include "cluster/metadata_dissemination_handler.h"
 #include "cluster/metadata_dissemination_service.h"
 #include "cluster/partition_manager.h"
+#include "cluster/partition_probe.h"
 #include "cluster/service.h"
+#include "cluster/topic_table.h"
+#include "cluster/topics_frontend.h"
 #include "config/configuration.h"
 #include "config/seed_server.h"
 #include "kafka/client/configuration.h"
 #include "kafka/security/scram_algorithm.h"
+#include "kafka/server/client_load_tracker.h"
 #include "kafka/server/coordinator_ntp_mapper.h"
 #include "kafka/server/group_manager.h"
 #include "kafka/server/group_router.h"
+#include "kafka/server/produce_trace.h"
 #include "kafka/server/protocol.h"
 #include "kafka/server/quota_manager.h"
 #include "model/metadata.h"
@@ -33,14 +42,18 @@
 #include "platform/stop_signal.h"
 #include "raft/service.h"
 #include "redpanda/admin/api-doc/config.json.h"
+#include "redpanda/admin/api-doc/debug.json.h"
 #include "redpanda/admin/api-doc/kafka.json.h"
+#include "redpanda/admin/api-doc/partition.json.h"
 #include "redpanda/admin/api-doc/raft.json.h"
 #include "resource_mgmt/io_priority.h"
 #include "rpc/simple_protocol.h"
 #include "storage/chunk_cache.h"
+#include "storage/file_handle_cache.h"
 #include "storage/directories.h"
 #include "syschecks/syschecks.h"
 #include "test_utils/logs.h"
+#include "utils/cpu_profiler.h"
 #include "utils/file_io.h"
 #include "version.h"
 #include "vlog.h"
@@ -55,12 +68,16 @@
 #include <seastar/json/json_elements.hh>
 #include <seastar/util/defer.hh>
 
+#include <boost/iterator/counting_iterator.hpp>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <sys/utsname.h>
 
+#include <absl/container/flat_hash_map.h>
+
 #include <chrono>
 #include <exception>
+#include <sstream>
 #include <vector>
 
 application::application(ss::sstring logger_name)
@@ -225,6 +242,33 @@ void application::check_environment() {
         storage::directories::initialize(
           config::shard_local_cfg().data_directory().as_sstring())
           .get();
+        if (config::shard_local_cfg().segment_fallocation_step() == 0) {
+            // auto mode: derive the fallocation step from a short write
+            // probe of the data directory
+            syschecks::systemd_message("probing disk io").get();
+            try {
+                auto profile = syschecks::measure_io(
+                                 config::shard_local_cfg()
+                                   .data_directory()
+                                   .as_sstring())
+                                 .get0();
+                const auto step = syschecks::recommended_falloc_step(profile);
+                vlog(
+                  _log.info,
+                  "io probe {}, using fallocation step {}",
+                  profile,
+                  step);
+                ss::smp::invoke_on_all([step] {
+                    config::shard_local_cfg().segment_fallocation_step.set_value(
+                      step);
+                }).get();
+            } catch (...) {
+                vlog(
+                  _log.warn,
+                  "disk io probe failed, keeping default storage tuning: {}",
+                  std::current_exception());
+            }
+        }
     }
 }
 
@@ -297,6 +341,20 @@ void application::configure_admin_server() {
     metrics_conf.metric_help = "redpanda metrics";
     metrics_conf.prefix = "vectorized";
     ss::prometheus::add_prometheus_routes(_admin, metrics_conf).get();
+    if (
+      conf.metrics_snapshot_interval_ms()
+      > std::chrono::milliseconds::zero()) {
+        construct_service(
+          _prometheus_snapshot,
+          conf.metrics_snapshot_interval_ms(),
+          _scheduling_groups.admin_sg())
+          .get();
+        _admin
+          .invoke_on_all([this](ss::http_server& server) {
+              return _prometheus_snapshot.local().attach(server);
+          })
+          .get();
+    }
     if (conf.enable_admin_api()) {
         syschecks::systemd_message(
           "enabling admin HTTP api: {}", config::shard_local_cfg().admin())
@@ -315,6 +373,8 @@ void application::configure_admin_server() {
               rb->register_api_file(server._routes, "raft");
               rb->register_function(server._routes, insert_comma);
               rb->register_api_file(server._routes, "kafka");
+              rb->register_function(server._routes, insert_comma);
+              rb->register_api_file(server._routes, "debug");
               ss::httpd::config_json::get_config.set(
                 server._routes, []([[maybe_unused]] ss::const_req req) {
                     rapidjson::StringBuffer buf;
@@ -323,7 +383,9 @@ void application::configure_admin_server() {
                     return ss::json::json_return_type(buf.GetString());
                 });
               admin_register_raft_routes(server);
+              admin_register_partition_routes(server);
               admin_register_kafka_routes(server);
+              admin_register_debug_routes(server);
           })
           .get();
     }
@@ -359,11 +421,12 @@ static storage::kvstore_config kvstore_config_from_global_config() {
       config::shard_local_cfg().kvstore_max_segment_size(),
       config::shard_local_cfg().kvstore_flush_interval(),
       config::shard_local_cfg().data_directory().as_sstring(),
-      storage::debug_sanitize_files::no);
+      storage::debug_sanitize_files::no,
+      config::shard_local_cfg().kvstore_snapshot_interval_segments());
 }
 
 static storage::log_config manager_config_from_global_config() {
-    return storage::log_config(
+    auto cfg = storage::log_config(
       storage::log_config::storage_type::disk,
       config::shard_local_cfg().data_directory().as_sstring(),
       config::shard_local_cfg().log_segment_size(),
@@ -381,6 +444,9 @@ static storage::log_config manager_config_from_global_config() {
         .min_size = config::shard_local_cfg().reclaim_min_size(),
         .max_size = config::shard_local_cfg().reclaim_max_size(),
       });
+    cfg.scrub_bytes_per_interval
+      = config::shard_local_cfg().segment_scrub_bytes_per_interval();
+    return cfg;
 }
 
 // add additional services in here
@@ -400,18 +466,39 @@ void application::wire_up_redpanda_services() {
         return storage::internal::chunks().start();
     }).get();
 
+    ss::smp::invoke_on_all([] {
+        storage::internal::file_handles().set_capacity(
+          config::shard_local_cfg().segment_reader_handle_cache_size());
+    }).get();
+
+    ss::smp::invoke_on_all([] {
+        auto table = config::shard_local_cfg().iobuf_allocation_table();
+        if (!table.empty()) {
+            details::io_allocation_size::configure_allocation_table(
+              std::move(table));
+        }
+        if (!config::shard_local_cfg().disable_metrics()) {
+            details::io_fragment_stats::local().setup_metrics();
+        }
+    }).get();
+
     // cluster
     syschecks::systemd_message("Adding raft client cache").get();
+    if (config::shard_local_cfg().enable_per_shard_rpc_clients()) {
+        ss::smp::invoke_on_all([] {
+            rpc::connection_cache::set_per_shard_connections(true);
+        }).get();
+    }
     construct_service(_raft_connection_cache).get();
     syschecks::systemd_message("Building shard-lookup tables").get();
     construct_service(shard_table).get();
 
     syschecks::systemd_message("Intializing storage services").get();
 
+    auto log_cfg = manager_config_from_global_config();
+    log_cfg.compaction_sg = _scheduling_groups.compaction_sg();
     construct_service(
-      storage,
-      kvstore_config_from_global_config(),
-      manager_config_from_global_config())
+      storage, kvstore_config_from_global_config(), std::move(log_cfg))
       .get();
 
     if (coproc_enabled()) {
@@ -432,7 +519,8 @@ void application::wire_up_redpanda_services() {
       config::shard_local_cfg().raft_io_timeout_ms(),
       config::shard_local_cfg().raft_heartbeat_interval_ms(),
       std::ref(_raft_connection_cache),
-      std::ref(storage))
+      std::ref(storage),
+      _scheduling_groups.recovery_sg())
       .get();
 
     syschecks::systemd_message("Adding partition manager").get();
@@ -475,10 +563,13 @@ void application::wire_up_redpanda_services() {
       && !config::shard_local_cfg().static_scram_pass().empty()) {
         credentials
           .invoke_on_all([](kafka::credential_store& store) {
-              store.put(
-                config::shard_local_cfg().static_scram_user(),
-                kafka::scram_sha256::make_credentials(
-                  config::shard_local_cfg().static_scram_pass(), 4096));
+              return kafka::scram_sha256::make_credentials(
+                       config::shard_local_cfg().static_scram_pass(), 4096)
+                .then([&store](kafka::scram_credential credential) {
+                    store.put(
+                      config::shard_local_cfg().static_scram_user(),
+                      std::move(credential));
+                });
           })
           .get();
     }
@@ -494,16 +585,28 @@ void application::wire_up_redpanda_services() {
       std::ref(_raft_connection_cache))
       .get();
 
+    syschecks::systemd_message("Creating leader balancer").get();
+    construct_service(
+      leader_balancer,
+      std::ref(controller->get_partition_leaders()),
+      std::ref(partition_manager))
+      .get();
+
     if (archival_storage_enabled()) {
         syschecks::systemd_message("Starting archival scheduler").get();
         ss::sharded<archival::configuration> configs;
         configs.start().get();
         configs
-          .invoke_on_all([](archival::configuration& c) {
-              return archival::scheduler_service::get_archival_service_config()
-                .then(
-                  [&c](archival::configuration cfg) { c = std::move(cfg); });
-          })
+          .invoke_on_all(
+            [sg = _scheduling_groups.archival_sg()](
+              archival::configuration& c) {
+                return archival::scheduler_service::
+                  get_archival_service_config()
+                    .then([&c, sg](archival::configuration cfg) {
+                        cfg.upload_scheduling_group = sg;
+                        c = std::move(cfg);
+                    });
+            })
           .get();
         construct_service(
           archival_scheduler,
@@ -520,6 +623,7 @@ void application::wire_up_redpanda_services() {
       _group_manager,
       std::ref(raft_group_manager),
       std::ref(partition_manager),
+      std::ref(storage),
       std::ref(controller->get_topics_state()),
       std::ref(config::shard_local_cfg()))
       .get();
@@ -583,6 +687,14 @@ void application::wire_up_redpanda_services() {
       .get();
 
     rpc::server_configuration kafka_cfg("kafka_rpc");
+    /**
+     * Kafka connections are wildly unequal in cost, so unlike the internal
+     * rpc server we steer each accepted connection to the shard currently
+     * handling the fewest connections rather than hashing on the remote
+     * port.
+     **/
+    kafka_cfg.load_balancing_algo
+      = ss::server_socket::load_balancing_algorithm::connection_distribution;
     kafka_cfg.max_service_memory_per_core = memory_groups::kafka_total_memory();
     for (const auto& ep : config::shard_local_cfg().kafka_api()) {
         kafka_cfg.addrs.emplace_back(
@@ -683,6 +795,9 @@ void application::start_redpanda() {
       .invoke_on_all(&cluster::metadata_dissemination_service::start)
       .get();
 
+    syschecks::systemd_message("Starting leader balancer").get();
+    leader_balancer.invoke_on_all(&cluster::leader_balancer::start).get();
+
     syschecks::systemd_message("Starting RPC").get();
     _rpc
       .invoke_on_all([this](rpc::server& s) {
@@ -724,11 +839,25 @@ void application::start_redpanda() {
 
     quota_mgr.invoke_on_all(&kafka::quota_manager::start).get();
 
+    // the per-api-class groups are created before the configuration is
+    // hydrated, so their configured shares are applied here instead of at
+    // group creation. shares are a per-shard scheduler property
+    ss::smp::invoke_on_all([this] {
+        auto fetch_sg = _scheduling_groups.kafka_fetch_sg();
+        fetch_sg.set_shares(
+          config::shard_local_cfg().kafka_fetch_api_shares());
+        auto admin_sg = _scheduling_groups.kafka_admin_sg();
+        admin_sg.set_shares(
+          config::shard_local_cfg().kafka_admin_api_shares());
+    }).get();
+
     // Kafka API
     _kafka_server
       .invoke_on_all([this](rpc::server& s) {
           auto proto = std::make_unique<kafka::protocol>(
             smp_service_groups.kafka_smp_sg(),
+            _scheduling_groups.kafka_fetch_sg(),
+            _scheduling_groups.kafka_admin_sg(),
             metadata_cache,
             controller->get_topics_frontend(),
             quota_mgr,
@@ -746,6 +875,76 @@ void application::start_redpanda() {
     vlog(
       _log.info, "Started Kafka API server listening at {}", conf.kafka_api());
 
+    // memory rebalancing between subsystem groups, started once every
+    // participating service is up
+    construct_service(_memory_coordinator).get();
+    _memory_coordinator
+      .invoke_on_all([this](resource_mgmt::memory_groups_coordinator& mgc) {
+          mgc.register_group(
+            memory_group::kafka,
+            [this] {
+                return resource_mgmt::memory_group_status{
+                  .used = _kafka_server.local().memory_consumed()};
+            },
+            [this](size_t budget) {
+                _kafka_server.local().set_memory_limit(budget);
+            });
+          mgc.register_group(
+            memory_group::rpc,
+            [this] {
+                return resource_mgmt::memory_group_status{
+                  .used = _rpc.local().memory_consumed()};
+            },
+            [this](size_t budget) { _rpc.local().set_memory_limit(budget); });
+          mgc.register_group(
+            memory_group::chunk_cache,
+            [] {
+                auto& cache = storage::internal::chunks();
+                // idle cached chunks are cheap to give back
+                return resource_mgmt::memory_group_status{
+                  .used = cache.size_total(),
+                  .reclaimable = cache.size_available()};
+            },
+            [](size_t budget) {
+                // keep the historical 1:3 target/limit split of the group
+                storage::internal::chunks().set_size_targets(
+                  budget / 3, budget);
+            });
+          mgc.start();
+      })
+      .get();
+
+    // shares of the background scheduling groups track the latency the
+    // kafka group observes
+    construct_service(_cpu_tuner, _scheduling_groups.kafka_sg()).get();
+    _cpu_tuner
+      .invoke_on_all([this](resource_mgmt::cpu_scheduling_tuner& tuner) {
+          tuner.add_background_group(
+            _scheduling_groups.compaction_sg(),
+            scheduling_groups::compaction_shares);
+          tuner.add_background_group(
+            _scheduling_groups.archival_sg(),
+            scheduling_groups::archival_shares);
+          tuner.add_background_group(
+            _scheduling_groups.recovery_sg(),
+            scheduling_groups::recovery_shares);
+          tuner.start();
+      })
+      .get();
+
+    /**
+     * Drain raft leadership as the very first shutdown step, while
+     * heartbeats and rpc connections to the peers are still alive.
+     * Followers elect replacements right away instead of waiting out
+     * election timeouts after this node disappears, which keeps the
+     * produce availability dip of a rolling restart to a minimum.
+     */
+    _deferred.emplace_back([this] {
+        raft_group_manager
+          .invoke_on_all(&raft::group_manager::drain_leadership)
+          .get();
+    });
+
     if (coproc_enabled()) {
         construct_single_service(_wasm_event_listener, std::ref(pacemaker));
         _wasm_event_listener->start().get();
@@ -815,7 +1014,202 @@ void application::admin_register_raft_routes(ss::http_server& server) {
       });
 }
 
+namespace {
+
+// partitions of a topic are spread over the target node's cores the same
+// way fresh allocations are
+uint32_t shard_on_broker(const model::broker& broker, model::partition_id p) {
+    auto cores = broker.properties().cores;
+    return cores == 0 ? 0 : static_cast<uint32_t>(p()) % cores;
+}
+
+std::vector<model::broker_shard> replica_set_for_nodes(
+  const std::vector<cluster::broker_ptr>& brokers,
+  const std::vector<model::node_id>& targets,
+  model::partition_id pid) {
+    std::vector<model::broker_shard> replicas;
+    replicas.reserve(targets.size());
+    for (auto id : targets) {
+        auto it = std::find_if(
+          brokers.begin(), brokers.end(), [id](const cluster::broker_ptr& b) {
+              return b->id() == id;
+          });
+        if (it == brokers.end()) {
+            throw ss::httpd::not_found_exception(
+              fmt::format("Node {} is not a cluster member", id));
+        }
+        replicas.push_back(
+          model::broker_shard{id, shard_on_broker(**it, pid)});
+    }
+    return replicas;
+}
+
+// auto computed placement: keep the replication factor and pick the nodes
+// hosting the fewest replicas cluster wide, the most common remediation
+// for a hot node
+std::vector<model::broker_shard> balanced_replica_set(
+  std::vector<cluster::broker_ptr> brokers,
+  const cluster::topic_table& topics,
+  size_t replication_factor,
+  model::partition_id pid) {
+    if (brokers.size() < replication_factor) {
+        throw ss::httpd::bad_param_exception(fmt::format(
+          "Cannot place {} replicas on a {} node cluster",
+          replication_factor,
+          brokers.size()));
+    }
+    absl::flat_hash_map<model::node_id, size_t> replicas_per_node;
+    for (const auto& md : topics.all_topics_metadata()) {
+        for (const auto& p : md.partitions) {
+            for (const auto& bs : p.replicas) {
+                ++replicas_per_node[bs.node_id];
+            }
+        }
+    }
+    std::sort(
+      brokers.begin(),
+      brokers.end(),
+      [&replicas_per_node](
+        const cluster::broker_ptr& a, const cluster::broker_ptr& b) {
+          return replicas_per_node[a->id()] < replicas_per_node[b->id()];
+      });
+    std::vector<model::broker_shard> replicas;
+    replicas.reserve(replication_factor);
+    for (size_t i = 0; i < replication_factor; ++i) {
+        replicas.push_back(model::broker_shard{
+          brokers[i]->id(), shard_on_broker(*brokers[i], pid)});
+    }
+    return replicas;
+}
+
+} // namespace
+
+void application::admin_register_partition_routes(ss::http_server& server) {
+    ss::httpd::partition_json::set_partition_replicas.set(
+      server._routes, [this](std::unique_ptr<ss::httpd::request> req) {
+          auto ns = model::ns(req->param["namespace"]);
+          auto topic = model::topic(req->param["topic"]);
+
+          model::partition_id partition;
+          try {
+              partition = model::partition_id(
+                std::stoll(req->param["partition"]));
+          } catch (...) {
+              throw ss::httpd::bad_param_exception(fmt::format(
+                "Partition id must be an integer: {}",
+                req->param["partition"]));
+          }
+          if (partition() < 0) {
+              throw ss::httpd::bad_param_exception(
+                fmt::format("Invalid partition id {}", partition));
+          }
+          model::ntp ntp(std::move(ns), std::move(topic), partition);
+
+          auto assignment
+            = controller->get_topics_state().local().get_partition_assignment(
+              ntp);
+          if (!assignment) {
+              throw ss::httpd::not_found_exception(
+                fmt::format("Partition {} not found", ntp));
+          }
+
+          std::vector<model::node_id> targets;
+          if (auto t = req->get_query_param("targets"); !t.empty()) {
+              std::stringstream ss(t);
+              std::string node;
+              try {
+                  while (std::getline(ss, node, ',')) {
+                      targets.emplace_back(std::stoi(node));
+                  }
+              } catch (...) {
+                  throw ss::httpd::bad_param_exception(fmt::format(
+                    "Targets must be a comma separated list of node ids: {}",
+                    t));
+              }
+          }
+
+          auto brokers = controller->get_members_table().local().all_brokers();
+          auto replicas
+            = targets.empty()
+                ? balanced_replica_set(
+                  std::move(brokers),
+                  controller->get_topics_state().local(),
+                  assignment->replicas.size(),
+                  partition)
+                : replica_set_for_nodes(brokers, targets, partition);
+
+          vlog(
+            _log.info,
+            "Moving replicas of partition {} to {}",
+            ntp,
+            replicas);
+
+          return controller->get_topics_frontend()
+            .local()
+            .move_partition_replicas(
+              std::move(ntp),
+              std::move(replicas),
+              model::timeout_clock::now() + std::chrono::seconds(10))
+            .then([](std::error_code ec) {
+                if (ec) {
+                    throw ss::httpd::server_error_exception(fmt::format(
+                      "Partition movement failed: {}", ec.message()));
+                }
+                return ss::json::json_return_type(ss::json::json_void());
+            });
+      });
+}
+
 void application::admin_register_kafka_routes(ss::http_server& server) {
+    ss::httpd::kafka_json::kafka_produce_traces.set(
+      server._routes, []([[maybe_unused]] std::unique_ptr<ss::httpd::request> req) {
+          using traces_t
+            = std::vector<kafka::produce_tracer::completed_trace>;
+          return ss::do_with(traces_t{}, [](traces_t& all) {
+              return ss::do_for_each(
+                       boost::counting_iterator<ss::shard_id>(0),
+                       boost::counting_iterator<ss::shard_id>(ss::smp::count),
+                       [&all](ss::shard_id shard) {
+                           return ss::smp::submit_to(shard, [] {
+                                      return kafka::local_produce_tracer()
+                                        .snapshot();
+                                  })
+                             .then([&all](traces_t shard_traces) {
+                                 std::move(
+                                   shard_traces.begin(),
+                                   shard_traces.end(),
+                                   std::back_inserter(all));
+                             });
+                       })
+                .then([&all] {
+                    rapidjson::StringBuffer buf;
+                    rapidjson::Writer<rapidjson::StringBuffer> w(buf);
+                    w.StartArray();
+                    for (const auto& t : all) {
+                        w.StartObject();
+                        w.Key("ntp");
+                        w.String(fmt::format("{}", t.ntp).c_str());
+                        w.Key("completed_at");
+                        w.Int64(t.completed_at.value());
+                        w.Key("stages");
+                        w.StartArray();
+                        for (const auto& s : t.stages) {
+                            w.StartObject();
+                            w.Key("name");
+                            w.String(s.name.c_str());
+                            w.Key("elapsed_us");
+                            w.Int64(s.elapsed.count());
+                            w.EndObject();
+                        }
+                        w.EndArray();
+                        w.EndObject();
+                    }
+                    w.EndArray();
+                    return ss::json::json_return_type(buf.GetString());
+                });
+          });
+      });
+
     ss::httpd::kafka_json::kafka_transfer_leadership.set(
       server._routes, [this](std::unique_ptr<ss::httpd::request> req) {
           auto topic = model::topic(req->param["topic"]);
@@ -884,3 +1278,169 @@ void application::admin_register_kafka_routes(ss::http_server& server) {
             });
       });
 }
+
+void application::admin_register_debug_routes(ss::http_server& server) {
+    ss::httpd::debug_json::debug_cpu_profiler_start.set(
+      server._routes, [](std::unique_ptr<ss::httpd::request> req) {
+          auto period = std::chrono::milliseconds(10);
+          if (auto p = req->get_query_param("period_ms"); !p.empty()) {
+              try {
+                  period = std::chrono::milliseconds(std::stoll(p));
+              } catch (...) {
+                  throw ss::httpd::bad_param_exception(fmt::format(
+                    "Sampling period must be an integer: {}", p));
+              }
+              if (period < std::chrono::milliseconds(1)) {
+                  throw ss::httpd::bad_param_exception(
+                    fmt::format("Invalid sampling period {}ms", p));
+              }
+          }
+          return ss::smp::invoke_on_all([period] {
+                     auto& profiler = utils::cpu_profiler::local();
+                     if (!profiler.running()) {
+                         profiler.start(period);
+                     }
+                 })
+            .then([] {
+                return ss::json::json_return_type(ss::json::json_void());
+            });
+      });
+
+    ss::httpd::debug_json::debug_cpu_profiler_stop.set(
+      server._routes,
+      []([[maybe_unused]] std::unique_ptr<ss::httpd::request> req) {
+          return ss::smp::invoke_on_all(
+                   [] { utils::cpu_profiler::local().stop(); })
+            .then([] {
+                return ss::json::json_return_type(ss::json::json_void());
+            });
+      });
+
+    ss::httpd::debug_json::debug_cpu_profiler_stacks.set(
+      server._routes,
+      []([[maybe_unused]] std::unique_ptr<ss::httpd::request> req) {
+          return ss::do_with(ss::sstring{}, [](ss::sstring& all) {
+              return ss::do_for_each(
+                       boost::counting_iterator<ss::shard_id>(0),
+                       boost::counting_iterator<ss::shard_id>(ss::smp::count),
+                       [&all](ss::shard_id shard) {
+                           return ss::smp::submit_to(shard, [] {
+                                      return utils::cpu_profiler::local()
+                                        .folded_stacks();
+                                  })
+                             .then([&all](ss::sstring stacks) {
+                                 all += stacks;
+                             });
+                       })
+                .then([&all] {
+                    return ss::json::json_return_type(std::move(all));
+                });
+          });
+      });
+
+    ss::httpd::debug_json::debug_hot_keys.set(
+      server._routes,
+      []([[maybe_unused]] std::unique_ptr<ss::httpd::request> req) {
+          struct shard_snapshot {
+              std::vector<cluster::partition_load_tracker::sketch_type::entry>
+                produce_bytes;
+              std::vector<cluster::partition_load_tracker::sketch_type::entry>
+                fetch_bytes;
+              std::vector<kafka::client_load_tracker::sketch_type::entry>
+                client_requests;
+              std::vector<kafka::client_load_tracker::sketch_type::entry>
+                client_bytes;
+          };
+          using snapshots_t = std::vector<shard_snapshot>;
+          return ss::do_with(snapshots_t{}, [](snapshots_t& all) {
+              return ss::do_for_each(
+                       boost::counting_iterator<ss::shard_id>(0),
+                       boost::counting_iterator<ss::shard_id>(ss::smp::count),
+                       [&all](ss::shard_id shard) {
+                           return ss::smp::submit_to(shard, [] {
+                                      return shard_snapshot{
+                                        cluster::partition_load_tracker::local()
+                                          .produce_bytes()
+                                          .entries(),
+                                        cluster::partition_load_tracker::local()
+                                          .fetch_bytes()
+                                          .entries(),
+                                        kafka::local_client_load_tracker()
+                                          .requests()
+                                          .entries(),
+                                        kafka::local_client_load_tracker()
+                                          .bytes()
+                                          .entries()};
+                                  })
+                             .then([&all](shard_snapshot s) {
+                                 all.push_back(std::move(s));
+                             });
+                       })
+                .then([&all] {
+                    // merge the per-shard sketches by key, then emit each
+                    // category heaviest first
+                    struct totals {
+                        uint64_t count{0};
+                        uint64_t error{0};
+                    };
+                    using merged_t = absl::flat_hash_map<ss::sstring, totals>;
+
+                    auto merge = [](merged_t& into, const auto& entries) {
+                        for (const auto& e : entries) {
+                            auto& t = into[fmt::format("{}", e.key)];
+                            t.count += e.count;
+                            t.error += e.error;
+                        }
+                    };
+                    auto write = [](
+                                   rapidjson::Writer<rapidjson::StringBuffer>&
+                                     w,
+                                   const char* name,
+                                   const merged_t& m) {
+                        std::vector<std::pair<ss::sstring, totals>> sorted(
+                          m.begin(), m.end());
+                        std::sort(
+                          sorted.begin(),
+                          sorted.end(),
+                          [](const auto& a, const auto& b) {
+                              return a.second.count > b.second.count;
+                          });
+                        w.Key(name);
+                        w.StartArray();
+                        for (const auto& [key, t] : sorted) {
+                            w.StartObject();
+                            w.Key("key");
+                            w.String(key.c_str());
+                            w.Key("count");
+                            w.Uint64(t.count);
+                            w.Key("max_overestimate");
+                            w.Uint64(t.error);
+                            w.EndObject();
+                        }
+                        w.EndArray();
+                    };
+
+                    merged_t produce_bytes;
+                    merged_t fetch_bytes;
+                    merged_t client_requests;
+                    merged_t client_bytes;
+                    for (const auto& s : all) {
+                        merge(produce_bytes, s.produce_bytes);
+                        merge(fetch_bytes, s.fetch_bytes);
+                        merge(client_requests, s.client_requests);
+                        merge(client_bytes, s.client_bytes);
+                    }
+
+                    rapidjson::StringBuffer buf;
+                    rapidjson::Writer<rapidjson::StringBuffer> w(buf);
+                    w.StartObject();
+                    write(w, "produce_bytes_by_partition", produce_bytes);
+                    write(w, "fetch_bytes_by_partition", fetch_bytes);
+                    write(w, "requests_by_client", client_requests);
+                    write(w, "bytes_by_client", client_bytes);
+                    w.EndObject();
+                    return ss::json::json_return_type(buf.GetString());
+                });
+          });
+      });
+}
@@ -20,8 +20,11 @@
 #include "pandaproxy/configuration.h"
 #include "pandaproxy/fwd.h"
 #include "raft/group_manager.h"
+#include "redpanda/prometheus_snapshot.h"
 #include "resource_mgmt/cpu_scheduling.h"
 #include "resource_mgmt/memory_groups.h"
+#include "resource_mgmt/cpu_scheduling_tuner.h"
+#include "resource_mgmt/memory_groups_coordinator.h"
 #include "resource_mgmt/smp_groups.h"
 #include "rpc/server.h"
 #include "seastarx.h"
@@ -70,6 +73,7 @@ public:
     ss::sharded<raft::group_manager> raft_group_manager;
     ss::sharded<cluster::metadata_dissemination_service>
       md_dissemination_service;
+    ss::sharded<cluster::leader_balancer> leader_balancer;
     ss::sharded<kafka::coordinator_ntp_mapper> coordinator_ntp_mapper;
     std::unique_ptr<cluster::controller> controller;
     ss::sharded<kafka::fetch_session_cache> fetch_session_cache;
@@ -90,7 +94,9 @@ private:
     void hydrate_config(const po::variables_map&);
 
     void admin_register_raft_routes(ss::http_server& server);
+    void admin_register_partition_routes(ss::http_server& server);
     void admin_register_kafka_routes(ss::http_server& server);
+    void admin_register_debug_routes(ss::http_server& server);
 
     bool coproc_enabled() {
         const auto& cfg = config::shard_local_cfg();
@@ -124,7 +130,10 @@ private:
     ss::sharded<kafka::group_manager> _group_manager;
     ss::sharded<rpc::server> _rpc;
     ss::sharded<ss::http_server> _admin;
+    ss::sharded<prometheus_snapshot_cache> _prometheus_snapshot;
     ss::sharded<rpc::server> _kafka_server;
+    ss::sharded<resource_mgmt::memory_groups_coordinator> _memory_coordinator;
+    ss::sharded<resource_mgmt::cpu_scheduling_tuner> _cpu_tuner;
     ss::sharded<pandaproxy::proxy> _proxy;
     ss::metrics::metric_groups _metrics;
     // run these first on destruction
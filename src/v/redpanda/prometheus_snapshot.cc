@@ -0,0 +1,98 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "redpanda/prometheus_snapshot.h"
+
+#include "vassert.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/with_scheduling_group.hh>
+#include <seastar/http/reply.hh>
+#include <seastar/http/request.hh>
+#include <seastar/util/log.hh>
+
+static ss::logger plog("prometheus-snapshot"); // NOLINT
+
+/// Writes the cached rendering. The share taken when the request arrives
+/// keeps the fragments alive even if a refresh swaps the snapshot while
+/// the response is in flight.
+class prometheus_snapshot_cache::snapshot_handler final
+  : public ss::httpd::handler_base {
+public:
+    explicit snapshot_handler(prometheus_snapshot_cache& cache)
+      : _cache(cache) {}
+
+    ss::future<std::unique_ptr<ss::httpd::reply>> handle(
+      const ss::sstring&,
+      std::unique_ptr<ss::httpd::request>,
+      std::unique_ptr<ss::httpd::reply> rep) final {
+        rep->write_body(
+          "txt",
+          [buf = _cache.snapshot()](ss::output_stream<char>&& s) mutable {
+              return ss::do_with(
+                std::move(s),
+                std::move(buf),
+                [](ss::output_stream<char>& out, iobuf& buf) {
+                    return write_iobuf_to_output_stream(std::move(buf), out)
+                      .finally([&out] { return out.close(); });
+                });
+          });
+        return ss::make_ready_future<std::unique_ptr<ss::httpd::reply>>(
+          std::move(rep));
+    }
+
+private:
+    prometheus_snapshot_cache& _cache;
+};
+
+ss::future<> prometheus_snapshot_cache::attach(ss::http_server& server) {
+    auto* inner = server._routes.drop(
+      ss::httpd::operation_type::GET, "/metrics");
+    vassert(inner != nullptr, "no /metrics route to serve snapshots from");
+    _metrics_handler.reset(inner);
+    // the first scrape may arrive before the first refresh tick
+    co_await rebuild();
+    server._routes.put(
+      ss::httpd::operation_type::GET, "/metrics", new snapshot_handler(*this));
+    _timer.set_callback([this] {
+        (void)ss::with_gate(_gate, [this] {
+            return ss::with_scheduling_group(
+                     _sg, [this] { return rebuild(); })
+              .handle_exception([](const std::exception_ptr& e) {
+                  vlog(plog.warn, "metrics snapshot refresh failed: {}", e);
+              })
+              .finally([this] {
+                  if (!_gate.is_closed()) {
+                      _timer.arm(_refresh);
+                  }
+              });
+        });
+    });
+    _timer.arm(_refresh);
+}
+
+ss::future<> prometheus_snapshot_cache::rebuild() {
+    auto req = std::make_unique<ss::httpd::request>();
+    req->_method = "GET";
+    req->_url = "/metrics";
+    auto rep = co_await _metrics_handler->handle(
+      "/metrics", std::move(req), std::make_unique<ss::httpd::reply>());
+    iobuf fresh;
+    // the metrics writer streams family by family with a future in
+    // between, so rendering into the buffer is spread by the scheduler
+    // rather than serializing everything in one reactor poll
+    co_await rep->_body_writer(make_iobuf_ref_output_stream(fresh));
+    _snapshot = std::move(fresh);
+}
+
+ss::future<> prometheus_snapshot_cache::stop() {
+    _timer.cancel();
+    return _gate.close();
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "seastarx.h"
+
+#include <seastar/core/gate.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/http/handlers.hh>
+#include <seastar/http/httpd.hh>
+
+#include <chrono>
+#include <memory>
+
+/**
+ * Serves prometheus scrapes from a prebuilt snapshot.
+ *
+ * The stock seastar handler serializes every metric of the scraped shard
+ * synchronously when the request arrives, which shows up as a latency blip
+ * aligned with the scrape interval. attach() takes over the /metrics route
+ * of a server: the original handler is kept and driven by a background
+ * fiber that renders the metrics into an iobuf on a refresh tick, in a
+ * scheduling group of the caller's choosing, so the work is spread by the
+ * scheduler instead of riding on the scrape. The route handler then only
+ * writes the most recent rendering.
+ *
+ * Scrapes observe values up to one refresh interval old, which is the
+ * point of the exercise; keep the interval at or below the scrape
+ * interval.
+ *
+ * One instance per shard, attached to that shard's server instance.
+ */
+class prometheus_snapshot_cache {
+public:
+    prometheus_snapshot_cache(
+      std::chrono::milliseconds refresh, ss::scheduling_group sg)
+      : _refresh(refresh)
+      , _sg(sg) {}
+
+    /**
+     * Replace the server's /metrics handler with one serving the snapshot.
+     * Builds the first snapshot before swapping, so a scrape arriving
+     * ahead of the first refresh tick does not see an empty body.
+     */
+    ss::future<> attach(ss::http_server&);
+
+    ss::future<> stop();
+
+    /// Cheap share of the current rendering
+    iobuf snapshot() { return _snapshot.share(0, _snapshot.size_bytes()); }
+
+private:
+    class snapshot_handler;
+
+    ss::future<> rebuild();
+
+    std::chrono::milliseconds _refresh;
+    ss::scheduling_group _sg;
+    /// the stock seastar metrics handler, now only invoked by rebuild()
+    std::unique_ptr<ss::httpd::handler_base> _metrics_handler;
+    iobuf _snapshot;
+    ss::timer<> _timer;
+    ss::gate _gate;
+};
@@ -74,6 +74,9 @@ public:
         // used by request context builder
         proto = std::make_unique<kafka::protocol>(
           app.smp_service_groups.kafka_smp_sg(),
+          // scheduling isolation between api classes is not under test
+          ss::default_scheduling_group(),
+          ss::default_scheduling_group(),
           app.metadata_cache,
           app.controller->get_topics_frontend(),
           app.quota_mgr,
@@ -20,6 +20,7 @@
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/sstring.hh>
 
+#include <bit>
 #include <optional>
 #include <type_traits>
 #include <vector>
@@ -53,6 +54,64 @@ struct is_ss_bool<ss::bool_class<T>> : std::true_type {};
 template<typename T>
 inline constexpr bool is_ss_bool_v = is_ss_bool<T>::value;
 
+namespace detail {
+
+template<typename T, typename = void>
+struct flat_layout {
+    static constexpr bool value = false;
+    static constexpr size_t encoded_size = 0;
+};
+
+template<typename Tuple>
+struct flat_fields {
+    static constexpr bool value = false;
+    static constexpr size_t encoded_size = 0;
+};
+
+template<typename... Fields>
+struct flat_fields<std::tuple<Fields&...>> {
+    static constexpr bool value = (flat_layout<Fields>::value && ...);
+    static constexpr size_t encoded_size
+      = (flat_layout<Fields>::encoded_size + ... + size_t(0));
+};
+
+template<typename T>
+struct flat_layout<
+  T,
+  std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>> {
+    static constexpr bool value = true;
+    static constexpr size_t encoded_size = sizeof(T);
+};
+
+template<typename T, typename Tag>
+struct flat_layout<named_type<T, Tag>> : flat_layout<T> {};
+
+template<typename T>
+struct flat_layout<
+  T,
+  std::enable_if_t<
+    std::is_class_v<T> && std::is_aggregate_v<T>
+    && std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>>> {
+    using fields = flat_fields<decltype(to_tuple(std::declval<T&>()))>;
+    // a single copy only matches the field-by-field encoding when the
+    // aggregate has no padding between or after its members
+    static constexpr bool value = fields::value
+                                  && fields::encoded_size == sizeof(T);
+    static constexpr size_t encoded_size = sizeof(T);
+};
+
+} // namespace detail
+
+/// True when the adl encoding of T is byte-identical to its in-memory
+/// representation: fixed width integrals, enums, named_type wrappers of
+/// those and padding-free aggregates built from them. Such types (and
+/// vectors of them) are copied in and out of the buffer in one shot
+/// instead of dispatching per field. The wire format is little endian, so
+/// the fast path is disabled on big endian hosts.
+template<typename T>
+inline constexpr bool is_flat_encodable_v
+  = std::endian::native == std::endian::little && detail::flat_layout<T>::value;
+
 template<typename T>
 struct adl {
     using type = std::remove_reference_t<std::decay_t<T>>;
@@ -98,6 +157,15 @@ struct adl {
             using value_type = typename type::value_type;
             int32_t n = in.consume_type<int32_t>();
             std::vector<value_type> ret;
+            if constexpr (
+              is_flat_encodable_v<value_type>
+              && !std::is_same_v<value_type, bool>) {
+                ret.resize(n);
+                in.consume_to(
+                  sizeof(value_type) * ret.size(),
+                  reinterpret_cast<char*>(ret.data()));
+                return ret;
+            }
             ret.reserve(n);
             while (n-- > 0) {
                 ret.push_back(adl<value_type>{}.from(in));
@@ -116,6 +184,9 @@ struct adl {
             return std::chrono::milliseconds(
               ss::le_to_cpu(in.consume_type<int64_t>()));
         } else if constexpr (is_standard_layout) {
+            if constexpr (is_flat_encodable_v<type>) {
+                return in.consume_type<type>();
+            }
             T t;
             reflection::for_each_field(t, [&in](auto& field) mutable {
                 field = std::move(
@@ -149,6 +220,14 @@ struct adl {
         } else if constexpr (is_vector) {
             using value_type = typename type::value_type;
             adl<int32_t>{}.to(out, t.size());
+            if constexpr (
+              is_flat_encodable_v<value_type>
+              && !std::is_same_v<value_type, bool>) {
+                out.append(
+                  reinterpret_cast<const char*>(t.data()),
+                  sizeof(value_type) * t.size());
+                return;
+            }
             for (value_type& i : t) {
                 adl<value_type>{}.to(out, std::move(i));
             }
@@ -170,6 +249,10 @@ struct adl {
             adl<int64_t>{}.to(out, t.count());
             return;
         } else if constexpr (is_standard_layout) {
+            if constexpr (is_flat_encodable_v<type>) {
+                out.append(reinterpret_cast<const char*>(&t), sizeof(type));
+                return;
+            }
             /*
             std::apply(
               [&out](auto&&... args) {
@@ -21,6 +21,20 @@
 // and any shard that needs to schedule continuations into a given group.
 class scheduling_groups final {
 public:
+    // default shares of the background groups. these are starting points:
+    // the cpu_scheduling_tuner moves the effective shares around these
+    // values based on observed foreground scheduling latency
+    static constexpr unsigned compaction_shares = 100;
+    static constexpr unsigned archival_shares = 100;
+    static constexpr unsigned recovery_shares = 200;
+
+    // default shares of the kafka api classes. fetch runs at parity with
+    // the main kafka group (where produce executes); admin/metadata
+    // chatter runs at a tenth so control-plane floods cannot take cpu
+    // from the data plane. both are overridable through configuration
+    static constexpr unsigned kafka_fetch_shares = 1000;
+    static constexpr unsigned kafka_admin_shares = 100;
+
     ss::future<> create_groups() {
         return ss::create_scheduling_group("admin", 100)
           .then([this](ss::scheduling_group sg) { _admin = sg; })
@@ -28,30 +42,68 @@ public:
           .then([this](ss::scheduling_group sg) { _raft = sg; })
           .then([] { return ss::create_scheduling_group("kafka", 1000); })
           .then([this](ss::scheduling_group sg) { _kafka = sg; })
+          .then([] {
+              return ss::create_scheduling_group(
+                "kafka_fetch", kafka_fetch_shares);
+          })
+          .then([this](ss::scheduling_group sg) { _kafka_fetch = sg; })
+          .then([] {
+              return ss::create_scheduling_group(
+                "kafka_admin", kafka_admin_shares);
+          })
+          .then([this](ss::scheduling_group sg) { _kafka_admin = sg; })
           .then([] { return ss::create_scheduling_group("cluster", 300); })
           .then([this](ss::scheduling_group sg) { _cluster = sg; })
           .then([] { return ss::create_scheduling_group("coproc", 100); })
-          .then([this](ss::scheduling_group sg) { _coproc = sg; });
+          .then([this](ss::scheduling_group sg) { _coproc = sg; })
+          .then([] {
+              return ss::create_scheduling_group(
+                "compaction", compaction_shares);
+          })
+          .then([this](ss::scheduling_group sg) { _compaction = sg; })
+          .then([] {
+              return ss::create_scheduling_group("archival", archival_shares);
+          })
+          .then([this](ss::scheduling_group sg) { _archival = sg; })
+          .then([] {
+              return ss::create_scheduling_group("recovery", recovery_shares);
+          })
+          .then([this](ss::scheduling_group sg) { _recovery = sg; });
     }
 
     ss::future<> destroy_groups() {
         return destroy_scheduling_group(_admin)
           .then([this] { return destroy_scheduling_group(_raft); })
           .then([this] { return destroy_scheduling_group(_kafka); })
+          .then([this] { return destroy_scheduling_group(_kafka_fetch); })
+          .then([this] { return destroy_scheduling_group(_kafka_admin); })
           .then([this] { return destroy_scheduling_group(_cluster); })
-          .then([this] { return destroy_scheduling_group(_coproc); });
+          .then([this] { return destroy_scheduling_group(_coproc); })
+          .then([this] { return destroy_scheduling_group(_compaction); })
+          .then([this] { return destroy_scheduling_group(_archival); })
+          .then([this] { return destroy_scheduling_group(_recovery); });
     }
 
     ss::scheduling_group admin_sg() { return _admin; }
     ss::scheduling_group raft_sg() { return _raft; }
     ss::scheduling_group kafka_sg() { return _kafka; }
+    ss::scheduling_group kafka_fetch_sg() { return _kafka_fetch; }
+    ss::scheduling_group kafka_admin_sg() { return _kafka_admin; }
     ss::scheduling_group cluster_sg() { return _cluster; }
     ss::scheduling_group coproc_sg() { return _coproc; }
+    ss::scheduling_group compaction_sg() { return _compaction; }
+    ss::scheduling_group archival_sg() { return _archival; }
+    ss::scheduling_group recovery_sg() { return _recovery; }
 
 private:
     ss::scheduling_group _admin;
     ss::scheduling_group _raft;
     ss::scheduling_group _kafka;
+    ss::scheduling_group _kafka_fetch;
+    ss::scheduling_group _kafka_admin;
     ss::scheduling_group _cluster;
     ss::scheduling_group _coproc;
+    ss::scheduling_group _compaction;
+    ss::scheduling_group _archival;
+    ss::scheduling_group _recovery;
 };
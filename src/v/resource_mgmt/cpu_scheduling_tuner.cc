@@ -0,0 +1,126 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/cpu_scheduling_tuner.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+#include <seastar/core/with_scheduling_group.hh>
+
+#include <algorithm>
+
+namespace resource_mgmt {
+
+cpu_scheduling_tuner::cpu_scheduling_tuner(
+  ss::scheduling_group foreground) noexcept
+  : _foreground(foreground)
+  , _timer([this] { tick(); }) {}
+
+void cpu_scheduling_tuner::add_background_group(
+  ss::scheduling_group sg, float shares) {
+    _groups.push_back(entry{sg, shares, shares});
+}
+
+void cpu_scheduling_tuner::start() {
+    setup_metrics();
+    _timer.arm_periodic(tick_interval);
+}
+
+ss::future<> cpu_scheduling_tuner::stop() {
+    _timer.cancel();
+    return _gate.close();
+}
+
+void cpu_scheduling_tuner::tick() {
+    (void)ss::with_gate(_gate, [this] {
+        const auto enqueued = clock::now();
+        return ss::with_scheduling_group(_foreground, [this, enqueued] {
+            observe(clock::now() - enqueued);
+        });
+    });
+}
+
+void cpu_scheduling_tuner::observe(clock::duration delay) {
+    _window_max = std::max(_window_max, delay);
+    if (++_ticks_in_window < ticks_per_window) {
+        return;
+    }
+    _ticks_in_window = 0;
+    adjust(std::exchange(_window_max, clock::duration{0}));
+}
+
+void cpu_scheduling_tuner::adjust(clock::duration window_max_delay) {
+    _last_window_max = window_max_delay;
+    if (window_max_delay > latency_slo) {
+        // foreground is hurting: back off quickly
+        for (auto& e : _groups) {
+            e.current_shares = std::max(
+              e.default_shares * min_share_factor, e.current_shares / 2);
+            e.group.set_shares(e.current_shares);
+        }
+        ++_shrinks;
+    } else if (window_max_delay < latency_slo / 2) {
+        // headroom: give background work its cpu back, slowly
+        for (auto& e : _groups) {
+            e.current_shares = std::min(
+              e.default_shares * max_share_factor,
+              e.current_shares + e.default_shares * grow_step_factor);
+            e.group.set_shares(e.current_shares);
+        }
+        ++_grows;
+    }
+}
+
+float cpu_scheduling_tuner::current_shares(ss::scheduling_group sg) const {
+    for (const auto& e : _groups) {
+        if (e.group == sg) {
+            return e.current_shares;
+        }
+    }
+    return 0;
+}
+
+void cpu_scheduling_tuner::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    std::vector<sm::metric_definition> defs;
+    defs.push_back(sm::make_gauge(
+      "probe_delay_us",
+      [this] {
+          return std::chrono::duration_cast<std::chrono::microseconds>(
+                   _last_window_max)
+            .count();
+      },
+      sm::description("Worst foreground scheduling delay observed in the "
+                      "last control window")));
+    defs.push_back(sm::make_derive(
+      "share_shrinks",
+      [this] { return _shrinks; },
+      sm::description("Control decisions that shrank background shares")));
+    defs.push_back(sm::make_derive(
+      "share_grows",
+      [this] { return _grows; },
+      sm::description("Control decisions that grew background shares")));
+    for (auto& e : _groups) {
+        defs.push_back(sm::make_gauge(
+          "group_shares",
+          [&e] { return e.current_shares; },
+          sm::description("Current shares of a tuned scheduling group"),
+          {sm::label("group")(e.group.name())}));
+    }
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("scheduling_groups"),
+      std::move(defs));
+}
+
+} // namespace resource_mgmt
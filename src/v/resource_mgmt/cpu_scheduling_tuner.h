@@ -0,0 +1,95 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <vector>
+
+namespace resource_mgmt {
+
+/**
+ * Feedback controller for the shares of background scheduling groups.
+ *
+ * Once per tick a no-op probe task is queued into the foreground group
+ * (kafka) and its scheduling delay is measured - a direct proxy for the
+ * latency produce/fetch requests see when background work competes for
+ * the cpu. Every control window the worst delay observed is compared
+ * against the SLO: above it the shares of all registered background
+ * groups are halved, and with comfortable headroom they are grown back
+ * additively, up to a multiple of their configured defaults. Shares only
+ * matter under contention, so growing them on an idle shard is free.
+ */
+class cpu_scheduling_tuner {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr std::chrono::seconds tick_interval{1};
+    /// number of probe ticks folded into one control decision
+    static constexpr unsigned ticks_per_window = 5;
+    /// foreground scheduling delay above which background shares shrink
+    static constexpr std::chrono::milliseconds latency_slo{5};
+    /// background shares stay within [default / 10, default * 2]
+    static constexpr float min_share_factor = 0.1;
+    static constexpr float max_share_factor = 2.0;
+    /// fraction of the default shares added back per growth step
+    static constexpr float grow_step_factor = 0.1;
+
+    explicit cpu_scheduling_tuner(ss::scheduling_group foreground) noexcept;
+
+    /// \param shares the group's configured default share count, the
+    /// anchor for the controller's guardrails
+    void add_background_group(ss::scheduling_group, float shares);
+
+    void start();
+    ss::future<> stop();
+
+    /// one control decision over the worst probe delay seen in the
+    /// window, normally driven by the periodic probe
+    void adjust(clock::duration window_max_delay);
+
+    /// controller-set shares of a registered group, for tests and
+    /// debugging
+    float current_shares(ss::scheduling_group) const;
+
+private:
+    struct entry {
+        ss::scheduling_group group;
+        float default_shares;
+        float current_shares;
+    };
+
+    void tick();
+    void observe(clock::duration delay);
+    void setup_metrics();
+
+    ss::scheduling_group _foreground;
+    std::vector<entry> _groups;
+    ss::timer<ss::lowres_clock> _timer;
+    ss::gate _gate;
+    clock::duration _window_max{0};
+    unsigned _ticks_in_window{0};
+    clock::duration _last_window_max{0};
+    uint64_t _shrinks{0};
+    uint64_t _grows{0};
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace resource_mgmt
@@ -15,27 +15,65 @@
 
 #include <seastar/core/memory.hh>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+/// Subsystem groups that a shard's memory is divided between and that
+/// participate in pressure-driven rebalancing.
+enum class memory_group : uint8_t {
+    kafka = 0,
+    rpc,
+    chunk_cache,
+};
+
 // centralized unit for memory management
 struct memory_groups {
+    static constexpr size_t num_groups = 3;
+
+    /// fraction of shard memory each group starts with
+    static constexpr double default_share(memory_group g) {
+        switch (g) {
+        case memory_group::kafka:
+            return .30;
+        case memory_group::rpc:
+            return .30;
+        case memory_group::chunk_cache:
+            return .30;
+        }
+        __builtin_unreachable();
+    }
+
+    /// rebalancing guardrails: a group never shrinks below half of its
+    /// default share and never grows beyond 1.5x of it
+    static constexpr double min_share_factor = 0.5;
+    static constexpr double max_share_factor = 1.5;
+
+    static double current_share(memory_group g) {
+        return shares()[static_cast<size_t>(g)];
+    }
+
+    /// current budget of the group in bytes
+    static size_t total_memory(memory_group g) {
+        return ss::memory::stats().total_memory() * current_share(g);
+    }
+
     static size_t kafka_total_memory() {
-        // 30%
-        return ss::memory::stats().total_memory() * .30;
+        return total_memory(memory_group::kafka);
     }
     /// \brief includes raft & all services
     static size_t rpc_total_memory() {
-        // 30%
-        return ss::memory::stats().total_memory() * .30;
+        return total_memory(memory_group::rpc);
     }
 
     /**
      * The target allocation size for the chunk cache. This is a soft target,
      * and may be expanded as needed by segment appenders, or reclaimed from by
-     * seastar under memory pressure.
-     *
-     * add upper bound of 30 pct of memory as a hard outstanding limit.
+     * seastar under memory pressure. Kept at a third of the group's budget,
+     * preserving the historical 10% target / 30% limit split.
      */
     static size_t chunk_cache_min_memory() {
-        return ss::memory::stats().total_memory() * .10; // NOLINT
+        return total_memory(memory_group::chunk_cache) / 3; // NOLINT
     }
 
     /**
@@ -44,6 +82,45 @@ struct memory_groups {
      * returned to the cache.
      */
     static size_t chunk_cache_max_memory() {
-        return ss::memory::stats().total_memory() * .30; // NOLINT
+        return total_memory(memory_group::chunk_cache);
+    }
+
+    /**
+     * Upper bound on the memory retained by the per-shard pools of
+     * reusable compression contexts and scratch buffers. Fixed reserve,
+     * not part of rebalancing.
+     */
+    static size_t compression_reserved_memory() {
+        return ss::memory::stats().total_memory() * .01; // NOLINT
+    }
+
+    /**
+     * Move up to \p share of shard memory from one group's budget to
+     * another, clamped so that neither group leaves its guardrails.
+     *
+     * \return number of bytes actually moved
+     */
+    static size_t shift_share(memory_group from, memory_group to, double share) {
+        auto& s = shares();
+        auto& f = s[static_cast<size_t>(from)];
+        auto& t = s[static_cast<size_t>(to)];
+        const double f_floor = default_share(from) * min_share_factor;
+        const double t_ceil = default_share(to) * max_share_factor;
+        const double moved = std::min({share, f - f_floor, t_ceil - t});
+        if (moved <= 0) {
+            return 0;
+        }
+        f -= moved;
+        t += moved;
+        return ss::memory::stats().total_memory() * moved;
+    }
+
+private:
+    static std::array<double, num_groups>& shares() {
+        static thread_local std::array<double, num_groups> s{
+          default_share(memory_group::kafka),
+          default_share(memory_group::rpc),
+          default_share(memory_group::chunk_cache)};
+        return s;
     }
 };
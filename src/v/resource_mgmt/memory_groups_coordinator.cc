@@ -0,0 +1,100 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/memory_groups_coordinator.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace resource_mgmt {
+
+memory_groups_coordinator::memory_groups_coordinator() noexcept
+  : _timer([this] { rebalance(); }) {}
+
+void memory_groups_coordinator::register_group(
+  memory_group g, status_fn status, budget_change_fn on_budget_change) {
+    _groups.push_back(
+      entry{g, std::move(status), std::move(on_budget_change)});
+}
+
+void memory_groups_coordinator::start() {
+    setup_metrics();
+    _timer.arm_periodic(rebalance_interval);
+}
+
+ss::future<> memory_groups_coordinator::stop() {
+    _timer.cancel();
+    return ss::make_ready_future<>();
+}
+
+void memory_groups_coordinator::rebalance() {
+    entry* receiver = nullptr;
+    entry* donor = nullptr;
+    double receiver_util = receiver_watermark;
+    double donor_util = donor_watermark;
+    for (auto& e : _groups) {
+        const auto budget = memory_groups::total_memory(e.group);
+        if (budget == 0) {
+            continue;
+        }
+        const auto st = e.status();
+        const auto util = static_cast<double>(st.used) / budget;
+        // a donor is judged on what it would actually miss: memory it can
+        // reclaim cheaply doesn't count against giving budget away
+        const auto net_used = st.used > st.reclaimable
+                                ? st.used - st.reclaimable
+                                : size_t{0};
+        const auto net_util = static_cast<double>(net_used) / budget;
+        if (util >= receiver_util) {
+            receiver_util = util;
+            receiver = &e;
+        }
+        if (net_util <= donor_util) {
+            donor_util = net_util;
+            donor = &e;
+        }
+    }
+    if (receiver == nullptr || donor == nullptr || receiver == donor) {
+        return;
+    }
+    const auto moved = memory_groups::shift_share(
+      donor->group, receiver->group, shift_step);
+    if (moved == 0) {
+        // one of the groups sits at its guardrail
+        return;
+    }
+    ++_shifts;
+    _bytes_shifted += moved;
+    donor->on_budget_change(memory_groups::total_memory(donor->group));
+    receiver->on_budget_change(memory_groups::total_memory(receiver->group));
+}
+
+void memory_groups_coordinator::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("memory_groups"),
+      {
+        sm::make_derive(
+          "budget_shifts",
+          [this] { return _shifts; },
+          sm::description("Number of budget shifts between memory groups")),
+        sm::make_derive(
+          "budget_bytes_shifted",
+          [this] { return _bytes_shifted; },
+          sm::description("Cumulative bytes of budget moved between memory "
+                          "groups")),
+      });
+}
+
+} // namespace resource_mgmt
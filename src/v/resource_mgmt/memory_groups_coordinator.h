@@ -0,0 +1,88 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "resource_mgmt/memory_groups.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <chrono>
+#include <vector>
+
+namespace resource_mgmt {
+
+/// Utilization snapshot a group reports on every rebalance pass.
+struct memory_group_status {
+    /// bytes of the group's budget currently in use
+    size_t used{0};
+    /// subset of 'used' that the group could give up cheaply (e.g. cached
+    /// data); discounted when the group is considered as a donor
+    size_t reclaimable{0};
+};
+
+/**
+ * Shifts per-shard memory budget between subsystem groups based on the
+ * pressure each reports.
+ *
+ * Groups register a status callback and a budget-change callback. Once per
+ * interval the coordinator compares utilizations: when one group runs hot
+ * while another sits on idle (or cheaply reclaimable) budget, a fixed
+ * share step moves from the coldest donor to the hottest receiver, within
+ * the guardrails enforced by 'memory_groups'. Both groups are told their
+ * new budget and every shift is counted in metrics.
+ */
+class memory_groups_coordinator {
+public:
+    using status_fn = ss::noncopyable_function<memory_group_status()>;
+    using budget_change_fn = ss::noncopyable_function<void(size_t)>;
+
+    static constexpr std::chrono::seconds rebalance_interval{10};
+    /// share of shard memory moved per rebalance step
+    static constexpr double shift_step = 0.02;
+    /// a group above this utilization may receive budget
+    static constexpr double receiver_watermark = 0.90;
+    /// a group at or below this utilization (net of reclaimable memory)
+    /// may donate budget
+    static constexpr double donor_watermark = 0.50;
+
+    memory_groups_coordinator() noexcept;
+
+    void register_group(memory_group, status_fn, budget_change_fn);
+
+    void start();
+    ss::future<> stop();
+
+    /// single rebalance pass, normally driven by the timer
+    void rebalance();
+
+private:
+    struct entry {
+        memory_group group;
+        status_fn status;
+        budget_change_fn on_budget_change;
+    };
+
+    void setup_metrics();
+
+    std::vector<entry> _groups;
+    ss::timer<ss::lowres_clock> _timer;
+    uint64_t _shifts{0};
+    uint64_t _bytes_shifted{0};
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace resource_mgmt
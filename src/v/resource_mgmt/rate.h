@@ -15,87 +15,55 @@
 #include <seastar/core/lowres_clock.hh>
 
 #include <chrono>
-#include <numeric>
-#include <vector>
+#include <cmath>
 
-// rate_tracker tracks the rate of a metric over time using a sliding window
-// average. configure with number of windows and the width of each window.
+// rate_estimator tracks the rate of a metric in units/second with an
+// exponentially decayed counter: every observation lands in a single
+// accumulator that decays with the configured time constant, and the
+// current rate is the accumulator divided by the time constant. constant
+// time, no allocation, two doubles of state - unlike the multi-window
+// tracker it replaced, whose per-observation sweep over its sample vector
+// showed up in profiles on the request hot path.
 //
-// this class effectively merges Kafka's SampledStat and Rate classes together
-// so that the same computation is done with a single pass over the samples for
-// the common case of recording a new value and sampling the rate.
-class rate_tracker final {
+// a steady input of r units/sec converges to an accumulator of r * tau,
+// so the reported rate converges to r; once the input stops the reported
+// rate decays to 1/e of its value every time constant. right after
+// construction the estimate ramps up from zero over roughly one time
+// constant, erring on the side of under-reporting - the same conservative
+// warm-up the windowed tracker implemented by inflating its elapsed time.
+class rate_estimator final {
 public:
     using clock = ss::lowres_clock;
 
-private:
-    struct window {
-        clock::time_point time;
-        double count{0.};
-        window() = default;
-    };
-
-public:
-    rate_tracker(size_t num_windows, clock::duration window_size)
-      : _windows(num_windows)
-      , _window_size(window_size)
-      , _current(0) {}
-
-    // record an observation and return the updated rate in units/second.
-    double record_and_measure(double v, const clock::time_point& now) {
-        // update the current window
-        maybe_advance_current(now);
-        _windows[_current].count += v;
-
-        // process historical samples
-        double total = 0.;
-        struct window* oldest = nullptr;
-        auto max_age = _window_size * _windows.size();
-        for (auto& w : _windows) {
-            // purge windows that are obsolete
-            if ((now - w.time) > max_age) {
-                w.time = now;
-                w.count = 0;
-            }
-
-            // find oldest non-obsolete window
-            if (!oldest || w.time < oldest->time) {
-                oldest = &w;
-            }
+    explicit rate_estimator(clock::duration time_constant)
+      : _tau(std::chrono::duration<double>(time_constant).count()) {}
 
-            // accumulate
-            total += w.count;
-        }
-
-        // compute window size and current rate. the reason that the elapsed
-        // time is adjusted up is to error conservatively to allow utilization
-        // to ramp up until a steady state is hit in which all the windows are
-        // fully used. this is an identical approach taken by the kafka broker.
-        auto elapsed = now - oldest->time;
-        auto num_windows = elapsed / _window_size;
-        auto min_windows = _windows.size() - 1;
-        // chrono uses signed integers
-        if ((size_t)num_windows < min_windows) {
-            elapsed += (min_windows - num_windows) * _window_size;
-        }
-
-        return total / std::chrono::duration<double>(elapsed).count();
+    // record an observation and return the updated rate in units/second
+    double record_and_measure(double v, clock::time_point now) {
+        decay(now);
+        _acc += v;
+        return _acc / _tau;
     }
 
-    clock::duration window_size() const { return _window_size; }
+    // current rate in units/second without recording anything
+    double measure(clock::time_point now) {
+        decay(now);
+        return _acc / _tau;
+    }
 
 private:
-    // maybe advance to and reset the next window
-    void maybe_advance_current(clock::time_point now) {
-        if ((_windows[_current].time + _window_size) < now) {
-            _current = (_current + 1) % _windows.size();
-            auto& curr = _windows[_current];
-            curr.time = now;
-            curr.count = 0.;
+    void decay(clock::time_point now) {
+        // lowres timestamps repeat within a reactor poll, so the common
+        // case of several observations per tick skips the exp entirely
+        if (now <= _last) {
+            return;
         }
+        const auto dt = std::chrono::duration<double>(now - _last).count();
+        _last = now;
+        _acc *= std::exp(-dt / _tau);
     }
 
-    std::vector<window> _windows;
-    clock::duration _window_size;
-    std::size_t _current;
+    double _tau;
+    double _acc{0};
+    clock::time_point _last;
 };
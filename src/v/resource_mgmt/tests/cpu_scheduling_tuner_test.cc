@@ -0,0 +1,44 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/cpu_scheduling_tuner.h"
+
+#include <seastar/core/scheduling.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(aimd_share_control) {
+    auto sg = ss::create_scheduling_group("tuner_test", 100).get0();
+    resource_mgmt::cpu_scheduling_tuner tuner(
+      ss::default_scheduling_group());
+    tuner.add_background_group(sg, 100);
+
+    // delay over the SLO halves the shares
+    tuner.adjust(10ms);
+    BOOST_REQUIRE_EQUAL(tuner.current_shares(sg), 50);
+
+    // sustained pressure bottoms out at the floor
+    for (int i = 0; i < 20; ++i) {
+        tuner.adjust(20ms);
+    }
+    BOOST_REQUIRE_EQUAL(tuner.current_shares(sg), 10);
+
+    // headroom grows the shares back, capped at twice the default
+    for (int i = 0; i < 100; ++i) {
+        tuner.adjust(0ms);
+    }
+    BOOST_REQUIRE_EQUAL(tuner.current_shares(sg), 200);
+
+    // delay between slo/2 and slo holds steady
+    tuner.adjust(3ms);
+    BOOST_REQUIRE_EQUAL(tuner.current_shares(sg), 200);
+
+    ss::destroy_scheduling_group(sg).get();
+}
@@ -0,0 +1,76 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/memory_groups_coordinator.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <optional>
+
+SEASTAR_THREAD_TEST_CASE(shift_budget_under_pressure) {
+    resource_mgmt::memory_groups_coordinator mgc;
+    const auto kafka_before = memory_groups::kafka_total_memory();
+    const auto rpc_before = memory_groups::rpc_total_memory();
+
+    std::optional<size_t> kafka_budget;
+    std::optional<size_t> rpc_budget;
+    mgc.register_group(
+      memory_group::kafka,
+      [] {
+          // permanently hot: uses its entire current budget
+          return resource_mgmt::memory_group_status{
+            .used = memory_groups::kafka_total_memory()};
+      },
+      [&kafka_budget](size_t b) { kafka_budget = b; });
+    mgc.register_group(
+      memory_group::rpc,
+      [] {
+          // permanently idle
+          return resource_mgmt::memory_group_status{};
+      },
+      [&rpc_budget](size_t b) { rpc_budget = b; });
+
+    mgc.rebalance();
+    BOOST_REQUIRE(kafka_budget.has_value());
+    BOOST_REQUIRE(rpc_budget.has_value());
+    BOOST_REQUIRE(*kafka_budget > kafka_before);
+    BOOST_REQUIRE(*rpc_budget < rpc_before);
+
+    // sustained pressure cannot push either group past its guardrail
+    for (int i = 0; i < 100; ++i) {
+        mgc.rebalance();
+    }
+    BOOST_REQUIRE(
+      memory_groups::current_share(memory_group::rpc)
+      >= memory_groups::default_share(memory_group::rpc)
+             * memory_groups::min_share_factor
+           - 1e-9);
+    BOOST_REQUIRE(
+      memory_groups::current_share(memory_group::kafka)
+      <= memory_groups::default_share(memory_group::kafka)
+             * memory_groups::max_share_factor
+           + 1e-9);
+}
+
+SEASTAR_THREAD_TEST_CASE(no_shift_without_pressure) {
+    resource_mgmt::memory_groups_coordinator mgc;
+    bool changed = false;
+    mgc.register_group(
+      memory_group::chunk_cache,
+      [] {
+          // busy, but everything it holds is cheaply reclaimable so it is
+          // a donor candidate, never a receiver
+          const auto budget = memory_groups::chunk_cache_max_memory();
+          return resource_mgmt::memory_group_status{
+            .used = budget, .reclaimable = budget};
+      },
+      [&changed](size_t) { changed = true; });
+    mgc.rebalance();
+    BOOST_REQUIRE(!changed);
+}
@@ -0,0 +1,50 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "resource_mgmt/rate.h"
+
+#define BOOST_TEST_MODULE resource_mgmt
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+BOOST_AUTO_TEST_CASE(steady_rate_converges) {
+    rate_estimator est(10s);
+    auto now = rate_estimator::clock::time_point{};
+    double rate = 0;
+    // 1000 units/sec in 100ms steps, for many time constants
+    for (int i = 0; i < 1000; ++i) {
+        now += 100ms;
+        rate = est.record_and_measure(100, now);
+    }
+    BOOST_REQUIRE_CLOSE(rate, 1000.0, 5.0);
+}
+
+BOOST_AUTO_TEST_CASE(rate_decays_when_idle) {
+    rate_estimator est(10s);
+    auto now = rate_estimator::clock::time_point{};
+    for (int i = 0; i < 1000; ++i) {
+        now += 100ms;
+        est.record_and_measure(100, now);
+    }
+    const auto before = est.measure(now);
+    // one time constant of silence decays the rate to 1/e
+    const auto after = est.measure(now + 10s);
+    BOOST_REQUIRE_CLOSE(after, before / std::exp(1.0), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(same_tick_observations_accumulate) {
+    rate_estimator est(1s);
+    const auto now = rate_estimator::clock::time_point{} + 1s;
+    est.record_and_measure(100, now);
+    const auto rate = est.record_and_measure(100, now);
+    BOOST_REQUIRE_CLOSE(rate, 200.0, 0.1);
+}
@@ -31,12 +31,18 @@ public:
 
         virtual void reset() = 0;
 
+        virtual std::unique_ptr<impl> clone() const = 0;
+
         virtual ~impl() noexcept = default;
     };
 
     explicit backoff_policy(std::unique_ptr<impl> i)
       : _impl(std::move(i)) {}
 
+    /// independent copy with the same parameters, for callers that need one
+    /// policy per connection out of a single configured instance
+    backoff_policy copy() const { return backoff_policy(_impl->clone()); }
+
     void next_backoff() { _impl->next_backoff(); }
 
     std::chrono::milliseconds current_backoff_duration() {
@@ -77,6 +83,10 @@ backoff_policy make_exponential_backoff_policy(
 
         void reset() final { _current = 0; }
 
+        std::unique_ptr<backoff_policy::impl> clone() const final {
+            return std::make_unique<policy>(*this);
+        }
+
     private:
         DurationType _base_duration;
         DurationType _max_backoff;
@@ -24,6 +24,13 @@ namespace rpc {
 class batched_output_stream {
 public:
     static constexpr size_t default_max_unflushed_bytes = 1024 * 1024;
+    /// Buffer size for the underlying socket output_stream. Scattered
+    /// messages are handed to the TCP stack as zero-copy chunks of at most
+    /// this size, and the sub-chunk tail of each message is staged in the
+    /// stream's internal buffer. The connected_socket default of 8KB turns
+    /// a 1MB append_entries batch into ~128 sendmsg calls; 128KB keeps the
+    /// fragment list intact in much larger writev batches.
+    static constexpr size_t default_stream_buffer_size = 128 * 1024;
 
     batched_output_stream() = default;
     explicit batched_output_stream(
@@ -23,7 +23,7 @@ connection::connection(
   , _name(std::move(name))
   , _fd(std::move(f))
   , _in(_fd.input())
-  , _out(_fd.output())
+  , _out(_fd.output(batched_output_stream::default_stream_buffer_size))
   , _probe(p) {
     _hook.push_back(*this);
     _probe.connection_established();
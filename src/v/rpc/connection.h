@@ -16,11 +16,14 @@
 #include "seastarx.h"
 
 #include <seastar/core/iostream.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/net/api.hh>
 #include <seastar/net/socket_defs.hh>
 
 #include <boost/intrusive/list.hpp>
 
+#include <optional>
+
 namespace rpc {
 
 class connection : public boost::intrusive::list_base_hook<> {
@@ -43,6 +46,15 @@ public:
     ss::future<> shutdown();
     void shutdown_input();
 
+    /// held while the connection's tls handshake may still be in flight.
+    /// the protocol releases the slot once the first complete frame
+    /// arrives - the handshake is behind us by then - and destruction of
+    /// the connection returns it either way
+    void set_handshake_units(ss::semaphore_units<> u) {
+        _handshake_units.emplace(std::move(u));
+    }
+    void release_handshake_units() { _handshake_units.reset(); }
+
     // NOLINTNEXTLINE
     const ss::socket_address addr;
 
@@ -53,5 +65,6 @@ private:
     ss::input_stream<char> _in;
     batched_output_stream _out;
     server_probe& _probe;
+    std::optional<ss::semaphore_units<>> _handshake_units;
 };
 } // namespace rpc
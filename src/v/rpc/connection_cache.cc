@@ -22,36 +22,61 @@ namespace rpc {
 ss::future<> connection_cache::emplace(
   model::node_id n,
   rpc::transport_configuration c,
-  backoff_policy backoff_policy) {
+  backoff_policy backoff_policy,
+  std::optional<clock_type::duration> maintenance_interval,
+  reconnect_transport::warm_standby standby) {
     return _mutex.with([this,
                         n,
                         c = std::move(c),
-                        backoff_policy = std::move(backoff_policy)]() mutable {
+                        backoff_policy = std::move(backoff_policy),
+                        maintenance_interval,
+                        standby]() mutable {
         if (_cache.find(n) != _cache.end()) {
             return;
         }
-        _cache.emplace(
-          n,
-          ss::make_lw_shared<rpc::reconnect_transport>(
-            std::move(c), std::move(backoff_policy)));
+        // one transport per lane, all from the same configuration. the
+        // connections are established lazily, an unused lane costs only the
+        // transport object
+        lanes_t lanes;
+        for (size_t i = 0; i < lane_count - 1; ++i) {
+            lanes[i] = ss::make_lw_shared<rpc::reconnect_transport>(
+              c, backoff_policy.copy());
+        }
+        lanes[lane_count - 1] = ss::make_lw_shared<rpc::reconnect_transport>(
+          std::move(c), std::move(backoff_policy));
+        if (maintenance_interval) {
+            for (size_t i = 0; i < lane_count; ++i) {
+                auto lane_standby
+                  = i == static_cast<size_t>(transport_lane::general)
+                      ? standby
+                      : reconnect_transport::warm_standby::no;
+                lanes[i]->start_connection_maintenance(
+                  *maintenance_interval, lane_standby);
+            }
+        }
+        _cache.emplace(n, std::move(lanes));
     });
 }
 ss::future<> connection_cache::remove(model::node_id n) {
     return _mutex
-      .with([this, n]() -> transport_ptr {
+      .with([this, n]() -> lanes_t {
           auto it = _cache.find(n);
           if (it == _cache.end()) {
-              return nullptr;
+              return {};
           }
-          auto ptr = it->second;
+          auto lanes = std::move(it->second);
           _cache.erase(it);
-          return ptr;
+          return lanes;
       })
-      .then([](transport_ptr ptr) {
-          if (!ptr) {
-              return ss::now();
-          }
-          return ptr->stop().finally([ptr] {});
+      .then([](lanes_t lanes) {
+          return ss::do_with(std::move(lanes), [](lanes_t& lanes) {
+              return ss::parallel_for_each(lanes, [](transport_ptr& ptr) {
+                  if (!ptr) {
+                      return ss::now();
+                  }
+                  return ptr->stop().finally([ptr] {});
+              });
+          });
       });
 }
 
@@ -59,8 +84,9 @@ ss::future<> connection_cache::remove(model::node_id n) {
 ss::future<> connection_cache::stop() {
     return _mutex.with([this]() {
         return parallel_for_each(_cache, [](auto& it) {
-            auto& [_, cli] = it;
-            return cli->stop();
+            auto& [_, lanes] = it;
+            return ss::parallel_for_each(
+              lanes, [](transport_ptr& cli) { return cli->stop(); });
         });
         _cache.clear();
         // mark mutex as broken to prevent new connections from being created
@@ -19,20 +19,32 @@
 #include "rpc/errc.h"
 #include "rpc/reconnect_transport.h"
 #include "rpc/types.h"
+#include "utils/cached_clock.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/sharded.hh>
 #include <seastar/core/shared_ptr.hh>
 
+#include <array>
 #include <chrono>
+#include <optional>
 #include <unordered_map>
 
 namespace rpc {
+
+/// Traffic class of a per-peer connection. Latency critical small messages
+/// (raft heartbeats, votes) use a dedicated connection with its own output
+/// stream so they are never queued behind multi-megabyte payloads such as
+/// recovery append_entries on the shared socket.
+enum class transport_lane : uint8_t { general = 0, low_latency = 1 };
+
 class connection_cache final
   : public ss::peering_sharded_service<connection_cache> {
 public:
     using transport_ptr = ss::lw_shared_ptr<rpc::reconnect_transport>;
-    using underlying = std::unordered_map<model::node_id, transport_ptr>;
+    static constexpr size_t lane_count = 2;
+    using lanes_t = std::array<transport_ptr, lane_count>;
+    using underlying = std::unordered_map<model::node_id, lanes_t>;
     using iterator = typename underlying::iterator;
 
     static inline ss::shard_id shard_for(
@@ -41,16 +53,36 @@ public:
       model::node_id node,
       ss::shard_id max_shards = ss::smp::count);
 
+    /// opt in to one connection per (shard, peer) pair so that submitting a
+    /// request never hops to another shard. must be set on every shard at
+    /// startup, before any clients are created
+    static void set_per_shard_connections(bool enabled) {
+        _per_shard_connections = enabled;
+    }
+
     connection_cache() = default;
     bool contains(model::node_id n) const {
         return _cache.find(n) != _cache.end();
     }
-    transport_ptr get(model::node_id n) const { return _cache.find(n)->second; }
+    transport_ptr
+    get(model::node_id n, transport_lane lane = transport_lane::general) const {
+        return _cache.find(n)->second.at(static_cast<size_t>(lane));
+    }
 
     /// \brief needs to be a future, because mutations may come from different
     /// fibers and they need to be synchronized
-    ss::future<>
-    emplace(model::node_id n, rpc::transport_configuration c, backoff_policy);
+    ///
+    /// when a maintenance interval is given every lane keeps itself
+    /// connected in the background; a warm standby is held for the general
+    /// lane only, the low latency lane carries small messages and redials
+    /// cheaply
+    ss::future<> emplace(
+      model::node_id n,
+      rpc::transport_configuration c,
+      backoff_policy,
+      std::optional<clock_type::duration> maintenance_interval = std::nullopt,
+      reconnect_transport::warm_standby standby
+      = reconnect_transport::warm_standby::no);
 
     /// \brief removes the node *and* closes the connection
     ss::future<> remove(model::node_id n);
@@ -69,20 +101,21 @@ public:
         ss::shard_id src_shard,
         model::node_id node_id,
         clock_type::time_point connection_timeout,
-        Func&& f) {
+        Func&& f,
+        transport_lane lane = transport_lane::general) {
         using ret_t = result_wrap_t<std::invoke_result_t<Func, Protocol>>;
         auto shard = rpc::connection_cache::shard_for(self, src_shard, node_id);
 
         return container().invoke_on(
           shard,
-          [node_id, f = std::forward<Func>(f), connection_timeout](
+          [node_id, f = std::forward<Func>(f), connection_timeout, lane](
             rpc::connection_cache& cache) mutable {
               if (!cache.contains(node_id)) {
                   // No client available
                   return ss::futurize<ret_t>::convert(
                     rpc::make_error_code(errc::missing_node_rpc_client));
               }
-              return cache.get(node_id)
+              return cache.get(node_id, lane)
                 ->get_connected(connection_timeout)
                 .then([f = std::forward<Func>(f)](
                         result<rpc::transport*> transport) mutable {
@@ -107,16 +140,20 @@ public:
         ss::shard_id src_shard,
         model::node_id node_id,
         clock_type::duration connection_timeout,
-        Func&& f) {
+        Func&& f,
+        transport_lane lane = transport_lane::general) {
         return with_node_client<Protocol, Func>(
           self,
           src_shard,
           node_id,
-          connection_timeout + clock_type::now(),
-          std::forward<Func>(f));
+          connection_timeout + cached_clock::now(),
+          std::forward<Func>(f),
+          lane);
     }
 
 private:
+    static inline thread_local bool _per_shard_connections{false};
+
     mutex _mutex; // to add/remove nodes
     underlying _cache;
 };
@@ -125,7 +162,10 @@ inline ss::shard_id connection_cache::shard_for(
   ss::shard_id src_shard,
   model::node_id n,
   ss::shard_id total_shards) {
-    if (ss::smp::count <= 8) {
+    // every shard owning its own connection removes the cross-shard submit
+    // hop and the foreign-iobuf traffic it drags along; on small machines
+    // the socket count is low enough to always do so, larger ones opt in
+    if (_per_shard_connections || ss::smp::count <= 8) {
         return src_shard;
     }
     static const constexpr size_t vnodes = 8;
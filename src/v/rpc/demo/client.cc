@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "model/timeout_clock.h"
+#include "random/generators.h"
 #include "rpc/demo/demo_utils.h"
 #include "rpc/demo/simple_service.h"
 #include "rpc/types.h"
@@ -17,10 +18,15 @@
 
 #include <seastar/core/app-template.hh>
 #include <seastar/core/fstream.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/util/defer.hh>
 
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
 #include <string>
 
 namespace ch = std::chrono;
@@ -47,11 +53,30 @@ void cli_opts(boost::program_options::options_description_easy_init o) {
     o("test-case",
       po::value<std::size_t>()->default_value(1),
       "1: large payload, 2: complex struct, 3: interspersed");
+    o("mix",
+      po::value<std::string>()->default_value(""),
+      "per-method weights overriding test-case, "
+      "i.e: put:8,complex:1,interspersed:1");
+    o("mode",
+      po::value<std::string>()->default_value("closed"),
+      "closed: keep every concurrency slot busy, "
+      "open: issue requests at a fixed arrival rate");
+    o("requests",
+      po::value<std::size_t>()->default_value(1),
+      "closed-loop requests per concurrency slot");
+    o("rate",
+      po::value<std::size_t>()->default_value(10000),
+      "open-loop arrival rate in requests per second, per core");
+    o("seconds",
+      po::value<std::size_t>()->default_value(10),
+      "open-loop run duration in seconds");
     o("ca-cert",
       po::value<std::string>()->default_value(""),
       "CA root certificate");
 }
 
+enum class method { put, put_complex, put_interspersed };
+
 struct load_gen_cfg {
     std::size_t global_total_requests() const {
         return core_total_requests() * ss::smp::count;
@@ -63,14 +88,23 @@ struct load_gen_cfg {
         return global_total_requests() * sizeof(demo::complex_request);
     }
     std::size_t core_total_requests() const {
-        return parallelism * concurrency;
+        return parallelism * concurrency * requests;
     }
+    // in-flight cap; queueing beyond it is reflected in open-loop latency
+    std::size_t max_in_flight() const { return parallelism * concurrency; }
 
     std::size_t data_size;
     std::size_t chunk_size;
     std::size_t concurrency;
     std::size_t parallelism;
     std::size_t test_case;
+    // cumulative weight -> method, empty when test-case drives selection
+    std::vector<std::pair<std::size_t, method>> mix;
+    std::string mix_spec;
+    bool open_loop;
+    std::size_t requests;
+    std::size_t rate;
+    std::size_t seconds;
     rpc::transport_configuration client_cfg;
     ss::sharded<hdr_hist>* hist;
 };
@@ -82,6 +116,11 @@ inline std::ostream& operator<<(std::ostream& o, const load_gen_cfg& cfg) {
              << ", 'concurrency':" << cfg.concurrency
              << ", 'parallelism':" << cfg.parallelism
              << ", 'test_case':" << cfg.test_case
+             << ", 'mix':'" << cfg.mix_spec << "'"
+             << ", 'mode':'" << (cfg.open_loop ? "open" : "closed") << "'"
+             << ", 'requests':" << cfg.requests
+             << ", 'rate':" << cfg.rate
+             << ", 'seconds':" << cfg.seconds
              << ", 'max_queued_bytes_per_tcp':"
              << cfg.client_cfg.max_queued_bytes
              << ", 'global_test_1_data_size':" << cfg.global_size_test1()
@@ -91,16 +130,19 @@ inline std::ostream& operator<<(std::ostream& o, const load_gen_cfg& cfg) {
 }
 
 // 1. creates cfg.parallelism number of TCP connections
-// 2. launches cfg.concurrency * parallelism number of requests
-// 3. each request is cfg.data_size large
-// 4. each cfg.data_size is split into cfg.chunk_size # of chunks
+// 2. closed loop: keeps cfg.concurrency * parallelism requests in flight,
+//    each slot issuing cfg.requests back to back
+// 3. open loop: issues requests at cfg.rate per second regardless of
+//    completions, so latency includes queueing delay
+// 4. each request method is chosen by cfg.mix weights (or test-case)
 // 5. profit
 class client_loadgen {
 public:
     using cli = rpc::client<demo::simple_client_protocol>;
     client_loadgen(load_gen_cfg cfg)
       : _cfg(std::move(cfg))
-      , _mem(ss::memory::stats().total_memory() * .9) {
+      , _mem(ss::memory::stats().total_memory() * .9)
+      , _in_flight(_cfg.max_in_flight()) {
         lgr.debug("Mem for loadgen: {}", _mem.available_units());
         for (std::size_t i = 0; i < _cfg.parallelism; ++i) {
             _clients.push_back(std::make_unique<cli>(_cfg.client_cfg));
@@ -109,10 +151,17 @@ public:
     ss::future<> execute_loadgen() {
         return ss::parallel_for_each(
           _clients.begin(), _clients.end(), [this](auto& c) {
+              if (_cfg.open_loop) {
+                  return execute_open_loop(c.get());
+              }
               return ss::parallel_for_each(
                 boost::irange(std::size_t(0), _cfg.concurrency),
                 [this, &c](std::size_t) mutable {
-                    return execute_one(c.get());
+                    return ss::do_for_each(
+                      boost::irange(std::size_t(0), _cfg.requests),
+                      [this, c = c.get()](std::size_t) {
+                          return execute_one(c);
+                      });
                 });
           });
     }
@@ -126,53 +175,160 @@ public:
         return ss::parallel_for_each(
           _clients.begin(), _clients.end(), [](auto& c) { return c->stop(); });
     }
+    std::size_t completed() const { return _completed; }
 
 private:
+    // closed loop sample: the measurement covers a single rpc, queueing on
+    // the concurrency slot is excluded by construction
     ss::future<> execute_one(cli* const c) {
-        if (_cfg.test_case < 1 && _cfg.test_case > 3) {
-            throw std::runtime_error(fmt::format(
-              "Unknown test:{}, bad config:{}", _cfg.test_case, _cfg));
-        }
-        if (_cfg.test_case == 1) {
+        return send_one(c).then(
+          [this, m = _cfg.hist->local().auto_measure()] { ++_completed; });
+    }
+
+    // open loop: requests are scheduled at a fixed interval and measured
+    // from their scheduled arrival, so time spent waiting behind slow
+    // responses is charged to latency (no coordinated omission)
+    ss::future<> execute_open_loop(cli* const c) {
+        using clock = std::chrono::steady_clock;
+        // each connection carries an equal share of the per-core rate
+        const auto interval = ch::duration_cast<clock::duration>(
+          ch::duration<double>(
+            static_cast<double>(_cfg.parallelism)
+            / static_cast<double>(_cfg.rate)));
+        const auto deadline = clock::now() + ch::seconds(_cfg.seconds);
+        return ss::do_with(
+          ss::gate(),
+          clock::now(),
+          [this, c, interval, deadline](
+            ss::gate& g, clock::time_point& next) {
+              return ss::do_until(
+                       [deadline] { return clock::now() >= deadline; },
+                       [this, c, interval, &g, &next] {
+                           next += interval;
+                           const auto scheduled = next;
+                           (void)ss::with_gate(g, [this, c, scheduled] {
+                               return get_units(_in_flight, 1)
+                                 .then([this, c](ss::semaphore_units<> u) {
+                                     return send_one(c).finally(
+                                       [u = std::move(u)] {});
+                                 })
+                                 .then([this, scheduled] {
+                                     auto us
+                                       = ch::duration_cast<ch::microseconds>(
+                                           clock::now() - scheduled)
+                                           .count();
+                                     _cfg.hist->local().record(us);
+                                     ++_completed;
+                                 });
+                           });
+                           const auto now = clock::now();
+                           if (next <= now) {
+                               // behind schedule - issue the next request
+                               // immediately to sustain the arrival rate
+                               return ss::now();
+                           }
+                           return ss::sleep(next - now);
+                       })
+                .then([&g] { return g.close(); });
+          });
+    }
+
+    ss::future<> send_one(cli* const c) {
+        switch (pick_method()) {
+        case method::put:
             return get_units(_mem, _cfg.data_size)
               .then([this, c](ss::semaphore_units<> u) {
                   return c
                     ->put(
                       demo::gen_simple_request(_cfg.data_size, _cfg.chunk_size),
                       rpc::client_opts(rpc::no_timeout))
-                    .then([m = _cfg.hist->local().auto_measure(),
-                           u = std::move(u)](auto _) {});
+                    .then([u = std::move(u)](auto _) {});
               });
-        } else if (_cfg.test_case == 2) {
+        case method::put_complex:
             return get_units(_mem, sizeof(demo::complex_request{}))
-              .then([this, &c](ss::semaphore_units<> u) {
+              .then([this, c](ss::semaphore_units<> u) {
                   return c
                     ->put_complex(
                       demo::complex_request{},
                       rpc::client_opts(rpc::no_timeout))
-                    .then([m = _cfg.hist->local().auto_measure(),
-                           u = std::move(u)](auto _) {});
+                    .then([u = std::move(u)](auto _) {});
               });
-        } else if (_cfg.test_case == 3) {
+        case method::put_interspersed:
             return get_units(_mem, _cfg.data_size)
-              .then([this, &c](ss::semaphore_units<> u) {
+              .then([this, c](ss::semaphore_units<> u) {
                   auto r = demo::gen_interspersed_request(
                     _cfg.data_size, _cfg.chunk_size);
                   return c
                     ->put_interspersed(
                       std::move(r), rpc::client_opts(rpc::no_timeout))
-                    .then([m = _cfg.hist->local().auto_measure(),
-                           u = std::move(u)](auto _) {});
+                    .then([u = std::move(u)](auto _) {});
               });
         }
         __builtin_unreachable();
     }
 
+    method pick_method() {
+        if (!_cfg.mix.empty()) {
+            auto r = random_generators::get_int(_cfg.mix.back().first - 1);
+            for (auto& [cumulative, m] : _cfg.mix) {
+                if (r < cumulative) {
+                    return m;
+                }
+            }
+        }
+        switch (_cfg.test_case) {
+        case 1:
+            return method::put;
+        case 2:
+            return method::put_complex;
+        case 3:
+            return method::put_interspersed;
+        default:
+            throw std::runtime_error(fmt::format(
+              "Unknown test:{}, bad config:{}", _cfg.test_case, _cfg));
+        }
+    }
+
     load_gen_cfg _cfg;
     ss::semaphore _mem;
+    ss::semaphore _in_flight;
+    std::size_t _completed{0};
     std::vector<std::unique_ptr<cli>> _clients;
 };
 
+inline std::vector<std::pair<std::size_t, method>>
+parse_mix(const std::string& spec) {
+    std::vector<std::pair<std::size_t, method>> mix;
+    if (spec.empty()) {
+        return mix;
+    }
+    std::vector<std::string> parts;
+    boost::split(parts, spec, boost::is_any_of(","));
+    std::size_t total = 0;
+    for (auto& part : parts) {
+        std::vector<std::string> kv;
+        boost::split(kv, part, boost::is_any_of(":"));
+        if (kv.size() != 2) {
+            throw std::runtime_error(
+              fmt::format("Could not parse mix entry:{}", part));
+        }
+        method m;
+        if (kv[0] == "put") {
+            m = method::put;
+        } else if (kv[0] == "complex") {
+            m = method::put_complex;
+        } else if (kv[0] == "interspersed") {
+            m = method::put_interspersed;
+        } else {
+            throw std::runtime_error(
+              fmt::format("Unknown method in mix:{}", kv[0]));
+        }
+        total += boost::lexical_cast<std::size_t>(kv[1]);
+        mix.emplace_back(total, m);
+    }
+    return mix;
+}
+
 inline load_gen_cfg
 cfg_from(boost::program_options::variables_map& m, ss::sharded<hdr_hist>* h) {
     rpc::transport_configuration client_cfg;
@@ -190,12 +346,22 @@ cfg_from(boost::program_options::variables_map& m, ss::sharded<hdr_hist>* h) {
           = builder.build_reloadable_certificate_credentials().get0();
     }
     client_cfg.max_queued_bytes = ss::memory::stats().total_memory() * .8;
+    auto mode = m["mode"].as<std::string>();
+    if (mode != "closed" && mode != "open") {
+        throw std::runtime_error(fmt::format("Unknown mode:{}", mode));
+    }
     return load_gen_cfg{
       .data_size = m["data-size"].as<std::size_t>(),
       .chunk_size = m["chunk-size"].as<std::size_t>(),
       .concurrency = m["concurrency"].as<std::size_t>(),
       .parallelism = m["parallelism"].as<std::size_t>(),
       .test_case = m["test-case"].as<std::size_t>(),
+      .mix = parse_mix(m["mix"].as<std::string>()),
+      .mix_spec = m["mix"].as<std::string>(),
+      .open_loop = mode == "open",
+      .requests = m["requests"].as<std::size_t>(),
+      .rate = m["rate"].as<std::size_t>(),
+      .seconds = m["seconds"].as<std::size_t>(),
       .client_cfg = std::move(client_cfg),
       .hist = h};
 }
@@ -220,6 +386,8 @@ public:
         }
         _end = now();
     }
+    // open-loop runs only know the completed count after the fact
+    void total_requests(std::size_t n) { _total_requests = n; }
     std::size_t duration_ms() const {
         return ch::duration_cast<ch::milliseconds>(_end - _begin).count();
     }
@@ -281,6 +449,14 @@ int main(int args, char** argv, char** env) {
             vlog(lgr.info, "invoking loadgen");
             client.invoke_on_all(&client_loadgen::execute_loadgen).get();
             tp.stop();
+            tp.total_requests(client
+                                .map_reduce0(
+                                  [](const client_loadgen& c) {
+                                      return c.completed();
+                                  },
+                                  std::size_t(0),
+                                  std::plus<>())
+                                .get0());
             vlog(lgr.info, "{}", tp);
             vlog(lgr.info, "writing results");
             write_configuration_in_thread(tp, lcfg);
@@ -12,34 +12,74 @@
 #include "rpc/demo/demo_utils.h"
 #include "rpc/demo/simple_service.h"
 #include "rpc/simple_protocol.h"
+#include "random/generators.h"
 #include "syschecks/syschecks.h"
 #include "vlog.h"
 
 #include <seastar/core/app-template.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 
 #include <string>
 
 static ss::logger lgr{"demo server"};
 
+// echo service with induced delays. delay and jitter model a slow or noisy
+// backend so client side queueing behavior can be studied in isolation;
+// echo mode sends the put payload back to exercise both directions of the
+// transport
 struct service final : demo::simple_service {
-    using demo::simple_service::simple_service;
+    service(
+      ss::scheduling_group sg,
+      ss::smp_service_group ssg,
+      std::chrono::milliseconds delay,
+      std::chrono::milliseconds jitter,
+      bool echo)
+      : demo::simple_service(sg, ssg)
+      , _delay(delay)
+      , _jitter(jitter)
+      , _echo(echo) {}
+
     ss::future<demo::simple_reply>
-    put(demo::simple_request&&, rpc::streaming_context&) final {
-        return ss::make_ready_future<demo::simple_reply>(
-          demo::simple_reply{{}});
+    put(demo::simple_request&& r, rpc::streaming_context&) final {
+        auto reply = _echo ? demo::simple_reply{std::move(r.data)}
+                           : demo::simple_reply{{}};
+        return delay().then([reply = std::move(reply)]() mutable {
+            return ss::make_ready_future<demo::simple_reply>(std::move(reply));
+        });
     }
     ss::future<demo::complex_reply>
     put_complex(demo::complex_request&&, rpc::streaming_context&) final {
-        return ss::make_ready_future<demo::complex_reply>(
-          demo::complex_reply{{}});
+        return delay().then([] {
+            return ss::make_ready_future<demo::complex_reply>(
+              demo::complex_reply{{}});
+        });
     }
     ss::future<demo::interspersed_reply> put_interspersed(
       demo::interspersed_request&&, rpc::streaming_context&) final {
-        return ss::make_ready_future<demo::interspersed_reply>(
-          demo::interspersed_reply{{}});
+        return delay().then([] {
+            return ss::make_ready_future<demo::interspersed_reply>(
+              demo::interspersed_reply{{}});
+        });
     }
+
+private:
+    ss::future<> delay() {
+        auto d = _delay;
+        if (_jitter.count() > 0) {
+            d += std::chrono::milliseconds(
+              random_generators::get_int(_jitter.count()));
+        }
+        if (d.count() == 0) {
+            return ss::now();
+        }
+        return ss::sleep(d);
+    }
+
+    std::chrono::milliseconds _delay;
+    std::chrono::milliseconds _jitter;
+    bool _echo;
 };
 
 void cli_opts(boost::program_options::options_description_easy_init o) {
@@ -54,6 +94,15 @@ void cli_opts(boost::program_options::options_description_easy_init o) {
     o("cert",
       po::value<std::string>()->default_value(""),
       "cert for TLS seccured connection");
+    o("delay-ms",
+      po::value<int64_t>()->default_value(0),
+      "induced service delay before every reply");
+    o("delay-jitter-ms",
+      po::value<int64_t>()->default_value(0),
+      "uniform random delay added on top of delay-ms");
+    o("echo",
+      po::value<bool>()->default_value(false),
+      "echo the put payload back instead of an empty reply");
 }
 
 int main(int args, char** argv, char** env) {
@@ -96,12 +145,20 @@ int main(int args, char** argv, char** env) {
             }
             serv.start(scfg).get();
             vlog(lgr.info, "registering service on all cores");
+            auto delay = std::chrono::milliseconds(
+              cfg["delay-ms"].as<int64_t>());
+            auto jitter = std::chrono::milliseconds(
+              cfg["delay-jitter-ms"].as<int64_t>());
+            auto echo = cfg["echo"].as<bool>();
             serv
-              .invoke_on_all([](rpc::server& s) {
+              .invoke_on_all([delay, jitter, echo](rpc::server& s) {
                   auto proto = std::make_unique<rpc::simple_protocol>();
                   proto->register_service<service>(
                     ss::default_scheduling_group(),
-                    ss::default_smp_service_group());
+                    ss::default_smp_service_group(),
+                    delay,
+                    jitter,
+                    echo);
                   s.set_protocol(std::move(proto));
               })
               .get();
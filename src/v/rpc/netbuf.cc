@@ -12,20 +12,83 @@
 #include "bytes/iobuf.h"
 #include "compression/stream_zstd.h"
 #include "hashing/xx.h"
-#include "reflection/adl.h"
 #include "rpc/types.h"
 #include "vassert.h"
 
+#include <seastar/core/temporary_buffer.hh>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
 namespace rpc {
-iobuf header_as_iobuf(const header& h) {
-    iobuf b;
-    b.reserve_memory(size_of_rpc_header);
-    reflection::adl<rpc::header>{}.to(b, h);
+
+namespace {
+
+/*
+ * Headers are 26 bytes and one is emitted per outbound message, which at
+ * heartbeat rates made the fragment allocation behind each header visible
+ * in shard-0 profiles. Slabs are recycled through a per-shard free list
+ * instead: the fragment's deleter runs once the scattered message has been
+ * flushed and returns the slab rather than freeing it.
+ */
+class header_slab_pool {
+    static constexpr size_t max_pooled = 1024;
+
+public:
+    ss::temporary_buffer<char> get() {
+        std::unique_ptr<char[]> slab;
+        if (!_slabs.empty()) {
+            slab = std::move(_slabs.back());
+            _slabs.pop_back();
+        } else {
+            slab = std::make_unique<char[]>(size_of_rpc_header);
+        }
+        auto* data = slab.get();
+        return ss::temporary_buffer<char>(
+          data,
+          size_of_rpc_header,
+          ss::make_deleter([this, slab = std::move(slab)]() mutable {
+              if (_slabs.size() < max_pooled) {
+                  _slabs.push_back(std::move(slab));
+              }
+          }));
+    }
+
+private:
+    std::vector<std::unique_ptr<char[]>> _slabs;
+};
+
+thread_local header_slab_pool slab_pool;
+
+template<typename T>
+char* write_le(char* dst, T t) {
+    auto le = ss::cpu_to_le(t);
+    std::memcpy(dst, &le, sizeof(le));
+    return dst + sizeof(le);
+}
+
+// field order and little-endian encoding match reflection::adl<header>,
+// which the receive side still uses to decode
+ss::temporary_buffer<char> header_as_slab(const header& h) {
+    auto slab = slab_pool.get();
+    char* p = slab.get_write();
+    p = write_le(p, h.version);
+    p = write_le(p, h.header_checksum);
+    p = write_le(
+      p, static_cast<std::underlying_type_t<compression_type>>(h.compression));
+    p = write_le(p, h.payload_size);
+    p = write_le(p, h.meta);
+    p = write_le(p, h.correlation_id);
+    p = write_le(p, h.payload_checksum);
     vassert(
-      b.size_bytes() == size_of_rpc_header,
+      p == slab.get_write() + size_of_rpc_header,
       "Header size must be known and exact");
-    return b;
+    return slab;
 }
+
+} // namespace
+
 /// \brief used to send the bytes down the wire
 /// we re-compute the header-checksum on every call
 ss::scattered_message<char> netbuf::as_scattered() && {
@@ -52,7 +115,9 @@ ss::scattered_message<char> netbuf::as_scattered() && {
     _hdr.payload_checksum = h.digest();
     _hdr.payload_size = _out.size_bytes();
     _hdr.header_checksum = rpc::checksum_header_only(_hdr);
-    _out.prepend(header_as_iobuf(_hdr));
+    // prepend wraps the slab as a full fragment - no copy, and the payload
+    // fragments behind it are the caller's buffers appended by reference
+    _out.prepend(header_as_slab(_hdr));
 
     // prepare for output
     return iobuf_as_scattered(std::move(_out));
@@ -26,6 +26,7 @@
 
 #include <fmt/format.h>
 
+#include <cstring>
 #include <memory>
 #include <optional>
 
@@ -39,47 +40,49 @@ inline void check_out_of_range(size_t got, size_t expected) {
           expected));
     }
 }
+
+template<typename T>
+const char* read_le(const char* src, T& t) {
+    T tmp;
+    std::memcpy(&tmp, src, sizeof(T));
+    t = ss::le_to_cpu(tmp);
+    return src + sizeof(T);
+}
 } // namespace detail
 
 inline ss::future<std::optional<header>>
 parse_header(ss::input_stream<char>& in) {
-    return read_iobuf_exactly(in, size_of_rpc_header).then([](iobuf b) {
-        if (b.size_bytes() != size_of_rpc_header) {
-            return ss::make_ready_future<std::optional<header>>();
-        }
-        iobuf_parser parser(std::move(b));
-        auto h = reflection::adl<header>{}.from(parser);
-        if (auto got = checksum_header_only(h);
-            unlikely(h.header_checksum != got)) {
-            vlog(
-              rpclog.info,
-              "rpc header missmatching checksums. expected:{}, got:{} - {}",
-              h.header_checksum,
-              got,
-              h);
-            return ss::make_ready_future<std::optional<header>>();
-        }
-        return ss::make_ready_future<std::optional<header>>(h);
-    });
-}
-
-inline void validate_payload_and_header(const iobuf& io, const header& h) {
-    detail::check_out_of_range(io.size_bytes(), h.payload_size);
-    auto in = iobuf::iterator_consumer(io.cbegin(), io.cend());
-    incremental_xxhash64 hasher;
-    size_t consumed = in.consume(
-      io.size_bytes(), [&hasher](const char* src, size_t sz) {
-          hasher.update(src, sz);
-          return ss::stop_iteration::no;
+    return in.read_exactly(size_of_rpc_header)
+      .then([](ss::temporary_buffer<char> b) {
+          if (b.size() != size_of_rpc_header) {
+              return ss::make_ready_future<std::optional<header>>();
+          }
+          // decode straight off the stream's buffer instead of round
+          // tripping through an intermediate iobuf. field order and
+          // little-endian encoding match reflection::adl<header>
+          header h;
+          const char* p = b.get();
+          p = detail::read_le(p, h.version);
+          p = detail::read_le(p, h.header_checksum);
+          std::underlying_type_t<compression_type> compression{};
+          p = detail::read_le(p, compression);
+          h.compression = compression_type(compression);
+          p = detail::read_le(p, h.payload_size);
+          p = detail::read_le(p, h.meta);
+          p = detail::read_le(p, h.correlation_id);
+          detail::read_le(p, h.payload_checksum);
+          if (auto got = checksum_header_only(h);
+              unlikely(h.header_checksum != got)) {
+              vlog(
+                rpclog.info,
+                "rpc header missmatching checksums. expected:{}, got:{} - {}",
+                h.header_checksum,
+                got,
+                h);
+              return ss::make_ready_future<std::optional<header>>();
+          }
+          return ss::make_ready_future<std::optional<header>>(h);
       });
-    detail::check_out_of_range(consumed, h.payload_size);
-    const auto got_checksum = hasher.digest();
-    if (h.payload_checksum != got_checksum) {
-        throw std::runtime_error(fmt::format(
-          "invalid rpc checksum. got:{}, expected:{}",
-          got_checksum,
-          h.payload_checksum));
-    }
 }
 
 template<typename T>
@@ -89,10 +92,49 @@ ss::future<T> parse_type_wihout_compression(iobuf io) {
     return reflection::async_adl<T>{}.from(*raw).finally([p = std::move(p)] {});
 }
 
+/*
+ * Reads the payload in chunks as they arrive from the socket, folding each
+ * chunk into the checksum right away. For recovery-sized payloads this
+ * overlaps the hash work with the network wait and avoids a second full
+ * walk over the buffered payload before the handler can start.
+ */
+inline ss::future<iobuf>
+read_and_validate_body(ss::input_stream<char>& in, const header& h) {
+    struct body_state {
+        iobuf buf;
+        incremental_xxhash64 hasher;
+    };
+    return ss::do_with(body_state{}, [&in, h](body_state& st) {
+        return ss::do_until(
+                 [&st, h] { return st.buf.size_bytes() >= h.payload_size; },
+                 [&in, &st, h] {
+                     return in.read_up_to(h.payload_size - st.buf.size_bytes())
+                       .then([&st, h](ss::temporary_buffer<char> b) {
+                           if (unlikely(b.empty())) {
+                               // stream ended before the full payload arrived
+                               detail::check_out_of_range(
+                                 st.buf.size_bytes(), h.payload_size);
+                           }
+                           st.hasher.update(b.get(), b.size());
+                           st.buf.append(std::move(b));
+                       });
+                 })
+          .then([&st, h] {
+              const auto got_checksum = st.hasher.digest();
+              if (h.payload_checksum != got_checksum) {
+                  throw std::runtime_error(fmt::format(
+                    "invalid rpc checksum. got:{}, expected:{}",
+                    got_checksum,
+                    h.payload_checksum));
+              }
+              return std::move(st.buf);
+          });
+    });
+}
+
 template<typename T>
 ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
-    return read_iobuf_exactly(in, h.payload_size).then([h](iobuf io) {
-        validate_payload_and_header(io, h);
+    return read_and_validate_body(in, h).then([h](iobuf io) {
         if (h.compression == compression_type::none) {
             return rpc::parse_type_wihout_compression<T>(std::move(io));
         }
@@ -73,11 +73,32 @@ void server_probe::setup_metrics(
           [this] { return _requests_blocked_memory; },
           sm::description(fmt::format(
             "{}: Number of requests blocked in memory backpressure", proto))),
+        sm::make_derive(
+          "memory_throttle_wait_us",
+          [this] { return _memory_throttle_wait_us; },
+          sm::description(fmt::format(
+            "{}: Total microseconds requests spent queued for the per-shard "
+            "memory budget",
+            proto))),
         sm::make_gauge(
           "requests_pending",
           [this] { return _requests_received - _requests_completed; },
           sm::description(fmt::format(
             "{}: Number of requests being processed by server", proto))),
+        sm::make_derive(
+          "responses_blocked_on_ordering",
+          [this] { return _responses_blocked_on_ordering; },
+          sm::description(fmt::format(
+            "{}: Number of responses that completed out of order and waited "
+            "for the ordered response write",
+            proto))),
+        sm::make_derive(
+          "response_ordering_wait_us",
+          [this] { return _response_ordering_wait_us; },
+          sm::description(fmt::format(
+            "{}: Total microseconds responses spent head-of-line blocked "
+            "behind slower requests on the same connection",
+            proto))),
       });
 }
 
@@ -91,7 +112,10 @@ std::ostream& operator<<(std::ostream& o, const server_probe& p) {
       << "sent bytes: " << p._out_bytes << ", "
       << "corrupted headers: " << p._corrupted_headers << ", "
       << "method not found errors: " << p._method_not_found_errors << ", "
-      << "requests blocked by memory: " << p._requests_blocked_memory << "}";
+      << "requests blocked by memory: " << p._requests_blocked_memory << ", "
+      << "memory throttle wait us: " << p._memory_throttle_wait_us << ", "
+      << "responses blocked on ordering: " << p._responses_blocked_on_ordering
+      << "}";
     return o;
 }
 
@@ -15,6 +15,7 @@
 #include "rpc/logger.h"
 #include "rpc/transport.h"
 #include "rpc/types.h"
+#include "utils/cached_clock.h"
 
 #include <seastar/net/inet_address.hh>
 
@@ -26,7 +27,7 @@ namespace ch = std::chrono; // NOLINT
 
 static inline bool has_backoff_expired(
   rpc::clock_type::time_point stamp, clock_type::duration backoff) {
-    auto now = rpc::clock_type::now();
+    auto now = cached_clock::now();
     if (now < stamp) {
         return false;
     }
@@ -34,24 +35,34 @@ static inline bool has_backoff_expired(
 }
 
 ss::future<> reconnect_transport::stop() {
-    return _dispatch_gate.close().then([this] { return _transport.stop(); });
+    _maintenance_timer.cancel();
+    return _dispatch_gate.close().then([this] {
+        auto f = _transport->stop();
+        if (_standby) {
+            f = f.then([this] { return _standby->stop(); });
+        }
+        return f;
+    });
 }
 ss::future<result<transport*>>
 reconnect_transport::get_connected(clock_type::duration connection_timeout) {
-    return get_connected(clock_type::now() + connection_timeout);
+    return get_connected(cached_clock::now() + connection_timeout);
 }
 
 ss::future<result<transport*>>
 reconnect_transport::get_connected(clock_type::time_point connection_timeout) {
     if (is_valid()) {
-        return ss::make_ready_future<result<transport*>>(&_transport);
+        return ss::make_ready_future<result<transport*>>(_transport.get());
+    }
+    if (maybe_promote_standby()) {
+        return ss::make_ready_future<result<transport*>>(_transport.get());
     }
     return reconnect(connection_timeout);
 }
 
 ss::future<result<rpc::transport*>>
 reconnect_transport::reconnect(clock_type::duration connection_timeout) {
-    return reconnect(clock_type::now() + connection_timeout);
+    return reconnect(cached_clock::now() + connection_timeout);
 }
 
 ss::future<result<transport*>>
@@ -61,21 +72,22 @@ reconnect_transport::reconnect(clock_type::time_point connection_timeout) {
           _stamp, _backoff_policy.current_backoff_duration())) {
         return ss::make_ready_future<ret_t>(errc::exponential_backoff);
     }
-    _stamp = rpc::clock_type::now();
+    _stamp = cached_clock::now();
     return with_gate(_dispatch_gate, [this, connection_timeout] {
         return with_semaphore(_connected_sem, 1, [this, connection_timeout] {
             if (is_valid()) {
-                return ss::make_ready_future<ret_t>(&_transport);
+                return ss::make_ready_future<ret_t>(_transport.get());
             }
-            vlog(rpclog.trace, "connecting to {}", _transport.server_address());
-            return _transport.connect(connection_timeout)
+            vlog(
+              rpclog.trace, "connecting to {}", _transport->server_address());
+            return _transport->connect(connection_timeout)
               .then_wrapped([this](ss::future<> f) {
                   try {
                       f.get();
                       rpclog.debug(
-                        "connected to {}", _transport.server_address());
+                        "connected to {}", _transport->server_address());
                       _backoff_policy.reset();
-                      return ss::make_ready_future<ret_t>(&_transport);
+                      return ss::make_ready_future<ret_t>(_transport.get());
                   } catch (...) {
                       _backoff_policy.next_backoff();
                       rpclog.trace(
@@ -87,4 +99,76 @@ reconnect_transport::reconnect(clock_type::time_point connection_timeout) {
         });
     });
 }
+
+void reconnect_transport::start_connection_maintenance(
+  clock_type::duration interval, warm_standby standby) {
+    _standby_enabled = standby;
+    _maintenance_jitter.emplace(interval);
+    _maintenance_timer.set_callback([this] {
+        if (_dispatch_gate.is_closed()) {
+            return;
+        }
+        (void)ss::with_gate(
+          _dispatch_gate, [this] { return do_connection_maintenance(); })
+          .finally([this] {
+              if (!_dispatch_gate.is_closed()) {
+                  _maintenance_timer.arm((*_maintenance_jitter)());
+              }
+          });
+    });
+    _maintenance_timer.arm((*_maintenance_jitter)());
+}
+
+ss::future<> reconnect_transport::do_connection_maintenance() {
+    auto f = ss::now();
+    if (!is_valid() && !maybe_promote_standby()) {
+        // the jittered timer paces the dials so rediscovered peers do not
+        // stampede a rejoining node; reconnect itself still honors the
+        // backoff policy
+        f = reconnect(_maintenance_jitter->base_duration())
+              .then([](result<transport*>) {});
+    }
+    if (_standby_enabled == warm_standby::no) {
+        return f;
+    }
+    return f.then([this] { return maintain_standby(); });
+}
+
+ss::future<> reconnect_transport::maintain_standby() {
+    if (!is_valid() || (_standby && _standby->is_valid())) {
+        return ss::now();
+    }
+    if (!_standby) {
+        _standby = std::make_unique<transport>(_config);
+    }
+    return _standby->connect(_maintenance_jitter->base_duration())
+      .then_wrapped([this](ss::future<> f) {
+          try {
+              f.get();
+              rpclog.debug(
+                "standby connected to {}", _standby->server_address());
+          } catch (...) {
+              rpclog.trace(
+                "error connecting standby {}", std::current_exception());
+          }
+      });
+}
+
+bool reconnect_transport::maybe_promote_standby() {
+    if (!_standby || !_standby->is_valid()) {
+        return false;
+    }
+    vlog(
+      rpclog.debug,
+      "promoting warm standby connection to {}",
+      _standby->server_address());
+    auto retired = std::exchange(_transport, std::exchange(_standby, nullptr));
+    // dispose of the dead primary in the background
+    (void)ss::with_gate(
+      _dispatch_gate, [retired = std::move(retired)]() mutable {
+          auto& t = *retired;
+          return t.stop().finally([retired = std::move(retired)] {});
+      });
+    return true;
+}
 } // namespace rpc
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "outcome.h"
+#include "random/simple_time_jitter.h"
 #include "rpc/backoff_policy.h"
 #include "rpc/transport.h"
 #include "rpc/types.h"
@@ -20,37 +21,65 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/net/socket_defs.hh>
+#include <seastar/util/bool_class.hh>
+
+#include <memory>
+#include <optional>
 
 namespace rpc {
 class reconnect_transport {
 public:
+    using warm_standby = ss::bool_class<struct warm_standby_tag>;
+
     explicit reconnect_transport(
       rpc::transport_configuration c, backoff_policy backoff_policy)
-      : _transport(std::move(c))
+      : _config(c)
+      , _transport(std::make_unique<rpc::transport>(std::move(c)))
       , _backoff_policy(std::move(backoff_policy)) {}
 
-    bool is_valid() const { return _transport.is_valid(); }
+    bool is_valid() const { return _transport->is_valid(); }
 
     ss::future<result<rpc::transport*>> reconnect(clock_type::time_point);
     ss::future<result<rpc::transport*>> reconnect(clock_type::duration);
 
-    rpc::transport& get() { return _transport; }
+    rpc::transport& get() { return *_transport; }
 
     /// safe client connect - attempts to reconnect if not connected
     ss::future<result<transport*>> get_connected(clock_type::time_point);
     ss::future<result<transport*>> get_connected(clock_type::duration);
 
     const ss::socket_address& server_address() const {
-        return _transport.server_address();
+        return _transport->server_address();
     }
 
+    /// Starts a background fiber that keeps the transport connected: after
+    /// a drop it redials on a jittered interval - so peers rediscovering a
+    /// rejoining node do not stampede it - while still honoring the backoff
+    /// policy, instead of leaving the first RPC after a network blip to pay
+    /// connect and TLS latency. With warm_standby::yes a second connected
+    /// transport is held alongside the primary and promoted instantly when
+    /// the primary dies.
+    void start_connection_maintenance(
+      clock_type::duration interval, warm_standby = warm_standby::no);
+
     ss::future<> stop();
 
 private:
-    rpc::transport _transport;
+    ss::future<> do_connection_maintenance();
+    ss::future<> maintain_standby();
+    /// replaces a dead primary with a connected standby, disposing of the
+    /// old transport in the background. returns true when promoted
+    bool maybe_promote_standby();
+
+    rpc::transport_configuration _config;
+    std::unique_ptr<rpc::transport> _transport;
+    std::unique_ptr<rpc::transport> _standby;
     rpc::clock_type::time_point _stamp{rpc::clock_type::now()};
     ss::semaphore _connected_sem{1};
     ss::gate _dispatch_gate;
     backoff_policy _backoff_policy;
+    warm_standby _standby_enabled{warm_standby::no};
+    std::optional<simple_time_jitter<clock_type>> _maintenance_jitter;
+    timer_type _maintenance_timer;
 };
 } // namespace rpc
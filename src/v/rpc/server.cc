@@ -28,11 +28,29 @@ namespace rpc {
 
 server::server(server_configuration c)
   : cfg(std::move(c))
+  , _memory_limit(cfg.max_service_memory_per_core)
   , _memory(cfg.max_service_memory_per_core)
+  , _handshake_sem(cfg.max_concurrent_tls_handshakes)
   , _creds(cfg.credentials) {}
 
 server::~server() = default;
 
+void server::set_memory_limit(size_t limit) {
+    if (limit > _memory_limit) {
+        _memory.signal(limit - _memory_limit);
+    } else if (limit < _memory_limit) {
+        _memory.consume(_memory_limit - limit);
+    }
+    _memory_limit = limit;
+}
+
+size_t server::memory_consumed() const {
+    const auto available = _memory.available_units();
+    const auto limit = static_cast<ssize_t>(_memory_limit);
+    return available >= limit ? size_t{0}
+                              : static_cast<size_t>(limit - available);
+}
+
 void server::start() {
     vassert(_proto, "must have a registered protocol before starting");
     if (!cfg.disable_metrics) {
@@ -123,11 +141,35 @@ ss::future<> server::accept(listener& s) {
                         ss::gate_closed_exception());
                   });
               }
-              (void)with_gate(_conn_gate, [this, conn]() mutable {
-                  return apply_proto(_proto.get(), resources(this, conn));
-              });
-              return ss::make_ready_future<ss::stop_iteration>(
-                ss::stop_iteration::no);
+              auto f = ss::make_ready_future<>();
+              if (_creds) {
+                  /*
+                   * the tls handshake runs during the connection's first
+                   * reads. holding a slot from accept until the first
+                   * complete frame bounds how many handshakes compute
+                   * asymmetric crypto concurrently; when the slots are
+                   * taken the accept loop itself waits and the listen
+                   * backlog absorbs the reconnect storm
+                   */
+                  f = ss::get_units(_handshake_sem, 1)
+                        .then([conn](ss::semaphore_units<> u) {
+                            conn->set_handshake_units(std::move(u));
+                        });
+              }
+              return f
+                .then([this, conn] {
+                    (void)with_gate(_conn_gate, [this, conn]() mutable {
+                        return apply_proto(_proto.get(), resources(this, conn));
+                    });
+                    return ss::make_ready_future<ss::stop_iteration>(
+                      ss::stop_iteration::no);
+                })
+                .handle_exception_type(
+                  // the semaphore is broken on stop while we wait for a slot
+                  [conn](const ss::broken_semaphore&) {
+                      return conn->shutdown().then(
+                        [] { return ss::stop_iteration::yes; });
+                  });
           });
     });
 } // namespace rpc
@@ -139,6 +181,8 @@ ss::future<> server::stop() {
     for (auto& l : _listeners) {
         l->socket.abort_accept();
     }
+    // wake an accept fiber parked on a handshake slot
+    _handshake_sem.broken();
     vlog(rpclog.debug, "{} - Service probes {}", proto_name, _probe);
     vlog(
       rpclog.info,
@@ -164,12 +208,12 @@ void server::setup_metrics() {
       prometheus_sanitize::metrics_name(cfg.name),
       {sm::make_total_bytes(
          "max_service_mem_bytes",
-         [this] { return cfg.max_service_memory_per_core; },
+         [this] { return memory_limit(); },
          sm::description(
            fmt::format("{}: Maximum memory allowed for RPC", cfg.name))),
        sm::make_total_bytes(
          "consumed_mem_bytes",
-         [this] { return cfg.max_service_memory_per_core - _memory.current(); },
+         [this] { return memory_consumed(); },
          sm::description(
            fmt::format("{}: Memory consumed by request processing", cfg.name))),
        sm::make_histogram(
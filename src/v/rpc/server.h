@@ -77,6 +77,17 @@ public:
     void start();
     ss::future<> stop();
 
+    /**
+     * Adjust the request memory budget at runtime, initially
+     * cfg.max_service_memory_per_core. Growth releases semaphore units
+     * immediately; shrinking consumes them, so new requests wait until
+     * in-flight ones release the difference.
+     */
+    void set_memory_limit(size_t limit);
+    size_t memory_limit() const { return _memory_limit; }
+    /// bytes of the budget held by in-flight requests
+    size_t memory_consumed() const;
+
     const server_configuration cfg; // NOLINT
     const hdr_hist& histogram() const { return _hist; }
 
@@ -95,7 +106,10 @@ private:
     void setup_metrics();
 
     std::unique_ptr<protocol> _proto;
+    size_t _memory_limit;
     ss::semaphore _memory;
+    // slots for connections whose tls handshake may still be in flight
+    ss::semaphore _handshake_sem;
     std::vector<std::unique_ptr<listener>> _listeners;
     boost::intrusive::list<connection> _connections;
     ss::abort_source _as;
@@ -15,6 +15,7 @@
 
 #include <seastar/core/metrics_registration.hh>
 
+#include <chrono>
 #include <iosfwd>
 
 namespace rpc {
@@ -46,6 +47,22 @@ public:
 
     void waiting_for_available_memory() { ++_requests_blocked_memory; }
 
+    /// time a request spent queued for the per-shard memory budget before
+    /// its reservation was granted
+    void add_memory_throttle_wait(std::chrono::microseconds wait) {
+        _memory_throttle_wait_us += wait.count();
+    }
+
+    /// time a completed response spent parked behind slower requests
+    /// pipelined ahead of it on the same connection (head-of-line
+    /// blocking on the ordered response write)
+    void add_response_ordering_wait(std::chrono::microseconds wait) {
+        if (wait.count() > 0) {
+            ++_responses_blocked_on_ordering;
+            _response_ordering_wait_us += wait.count();
+        }
+    }
+
     void setup_metrics(ss::metrics::metric_groups& mgs, const char* name);
 
 private:
@@ -60,6 +77,9 @@ private:
     uint32_t _corrupted_headers = 0;
     uint32_t _method_not_found_errors = 0;
     uint32_t _requests_blocked_memory = 0;
+    uint64_t _memory_throttle_wait_us = 0;
+    uint64_t _responses_blocked_on_ordering = 0;
+    uint64_t _response_ordering_wait_us = 0;
     friend std::ostream& operator<<(std::ostream& o, const server_probe& p);
 };
 
@@ -35,6 +35,12 @@ struct service {
     virtual ss::smp_service_group& get_smp_service_group() = 0;
     /// \brief return nullptr when method not found
     virtual method* method_from_id(uint32_t) = 0;
+    /// \brief invoke cb for every (method id, handler) pair. handlers live
+    /// in the service's method array for the lifetime of the service, so
+    /// the caller may retain the pointers
+    virtual void
+      for_each_method(const ss::noncopyable_function<void(uint32_t, method*)>&)
+      = 0;
 };
 
 class rpc_internal_body_parsing_exception : public std::exception {
@@ -9,6 +9,7 @@
 
 #include "rpc/simple_protocol.h"
 
+#include "likely.h"
 #include "rpc/logger.h"
 #include "rpc/types.h"
 
@@ -51,6 +52,9 @@ ss::future<> simple_protocol::apply(server::resources rs) {
                     rs.conn->shutdown_input();
                     return ss::now();
                 }
+                // a complete header means the tls handshake, if any, is
+                // behind us - free the slot for the next accept
+                rs.conn->release_handshake_units();
                 return dispatch_method_once(h.value(), rs);
             });
       });
@@ -77,6 +81,14 @@ send_reply(ss::lw_shared_ptr<server_context_impl> ctx, netbuf buf) {
       .finally([ctx] { ctx->res.probe().request_completed(); });
 }
 
+method* simple_protocol::lookup_method(uint32_t method_id) {
+    if (auto it = _method_table.find(method_id);
+        likely(it != _method_table.end())) {
+        return it->second;
+    }
+    return nullptr;
+}
+
 ss::future<>
 simple_protocol::dispatch_method_once(header h, server::resources rs) {
     const auto method_id = h.meta;
@@ -90,13 +102,8 @@ simple_protocol::dispatch_method_once(header h, server::resources rs) {
 
     // background!
     (void)with_gate(rs.conn_gate(), [this, method_id, rs, ctx]() mutable {
-        auto it = std::find_if(
-          _services.begin(),
-          _services.end(),
-          [method_id](std::unique_ptr<service>& srvc) {
-              return srvc->method_from_id(method_id) != nullptr;
-          });
-        if (unlikely(it == _services.end())) {
+        method* m = lookup_method(method_id);
+        if (unlikely(m == nullptr)) {
             rs.probe().method_not_found();
             netbuf reply_buf;
             reply_buf.set_status(rpc::status::method_not_found);
@@ -105,8 +112,6 @@ simple_protocol::dispatch_method_once(header h, server::resources rs) {
             });
         }
 
-        method* m = it->get()->method_from_id(method_id);
-
         return (*m)(ctx->res.conn->input(), *ctx)
           .then_wrapped([ctx, m = ctx->res.hist().auto_measure(), rs](
                           ss::future<netbuf> fut) mutable {
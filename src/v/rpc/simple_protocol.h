@@ -13,13 +13,22 @@
 #include "rpc/netbuf.h"
 #include "rpc/server.h"
 #include "rpc/service.h"
+#include "vassert.h"
+
+#include <absl/container/flat_hash_map.h>
+
 namespace rpc {
 class simple_protocol final : public server::protocol {
 public:
     template<typename T, typename... Args>
     void register_service(Args&&... args) {
         static_assert(std::is_base_of_v<service, T>, "must extend service.h");
-        _services.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+        auto& srvc = _services.emplace_back(
+          std::make_unique<T>(std::forward<Args>(args)...));
+        srvc->for_each_method([this](uint32_t id, method* m) {
+            auto res = _method_table.emplace(id, m);
+            vassert(res.second, "duplicate rpc method id: {}", id);
+        });
     }
 
     const char* name() const final {
@@ -29,8 +38,16 @@ public:
 
 private:
     ss::future<> dispatch_method_once(header, server::resources);
+    method* lookup_method(uint32_t);
 
     std::vector<std::unique_ptr<service>> _services;
+    // method id -> handler, frozen as each service registers. _services is
+    // fixed before the server starts accepting connections and handlers
+    // live in per-service arrays, so the pointers stay valid for the
+    // lifetime of the protocol. every dispatch - raft votes and heartbeats
+    // included - is a single hash probe with no virtual hops and no cold
+    // path that scans the registered services.
+    absl::flat_hash_map<uint32_t, method*> _method_table;
 };
 
 } // namespace rpc
@@ -0,0 +1,65 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "rpc/response_handler.h"
+#include "rpc/transport.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+static rpc::correlation_table::handler_ptr make_handler() {
+    return std::make_unique<rpc::internal::response_handler>();
+}
+
+SEASTAR_THREAD_TEST_CASE(correlation_insert_extract_roundtrip) {
+    rpc::correlation_table table;
+    auto h = make_handler();
+    auto* raw = h.get();
+    auto id = table.insert(std::move(h));
+    // zero is reserved as the unset id on the wire
+    BOOST_REQUIRE_NE(id, 0);
+    BOOST_REQUIRE_EQUAL(table.size(), 1);
+    auto extracted = table.extract(id);
+    BOOST_REQUIRE_EQUAL(extracted.get(), raw);
+    BOOST_REQUIRE_EQUAL(table.size(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(correlation_stale_ids_miss) {
+    rpc::correlation_table table;
+    auto first_id = table.insert(make_handler());
+    BOOST_REQUIRE(table.extract(first_id) != nullptr);
+    // double-extract of the same id is a miss, not a double completion
+    BOOST_REQUIRE(table.extract(first_id) == nullptr);
+    // the freed slot is reused with a different generation, the old id
+    // must not resolve to the new occupant
+    auto second_id = table.insert(make_handler());
+    BOOST_REQUIRE_NE(first_id, second_id);
+    BOOST_REQUIRE(table.extract(first_id) == nullptr);
+    BOOST_REQUIRE(table.extract(second_id) != nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(correlation_unknown_ids_miss) {
+    rpc::correlation_table table;
+    BOOST_REQUIRE(table.extract(0) == nullptr);
+    BOOST_REQUIRE(table.extract(42) == nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(correlation_release_all_drains) {
+    rpc::correlation_table table;
+    std::vector<uint32_t> ids;
+    for (int i = 0; i < 16; ++i) {
+        ids.push_back(table.insert(make_handler()));
+    }
+    BOOST_REQUIRE_EQUAL(table.size(), 16);
+    auto live = table.release_all();
+    BOOST_REQUIRE_EQUAL(live.size(), 16);
+    BOOST_REQUIRE_EQUAL(table.size(), 0);
+    for (auto id : ids) {
+        BOOST_REQUIRE(table.extract(id) == nullptr);
+    }
+}
@@ -32,6 +32,20 @@ inline constexpr size_t pod_bytes() {
            + sizeof(int64_t); // pod::z
 }
 
+struct packed_pod {
+    int64_t x = 1;
+    int64_t y = 2;
+    int32_t z = 3;
+    int32_t w = 4;
+};
+
+inline constexpr size_t packed_pod_bytes() {
+    return sizeof(int64_t)    // packed_pod::x
+           + sizeof(int64_t)  // packed_pod::y
+           + sizeof(int32_t)  // packed_pod::z
+           + sizeof(int32_t); // packed_pod::w
+}
+
 struct complex_custom {
     pod pit;
     iobuf oi;
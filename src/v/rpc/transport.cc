@@ -15,6 +15,7 @@
 #include "rpc/parse_utils.h"
 #include "rpc/response_handler.h"
 #include "rpc/types.h"
+#include "utils/cached_clock.h"
 #include "vlog.h"
 
 #include <seastar/core/coroutine.hh>
@@ -105,7 +106,8 @@ ss::future<> base_transport::do_connect(clock_type::time_point timeout) {
         _fd = std::make_unique<ss::connected_socket>(std::move(fd));
         _probe.connection_established();
         _in = _fd->input();
-        _out = batched_output_stream(_fd->output());
+        _out = batched_output_stream(
+          _fd->output(batched_output_stream::default_stream_buffer_size));
     } catch (...) {
         auto e = std::current_exception();
         _probe.connection_error(e);
@@ -135,13 +137,12 @@ ss::future<> base_transport::stop() {
 void transport::fail_outstanding_futures() noexcept {
     // must close the socket
     shutdown();
-    for (auto& [_, p] : _correlations) {
+    for (auto& p : _correlations.release_all()) {
         p->set_value(errc::disconnected_endpoint);
     }
     _last_seq = sequence_t{0};
     _seq = sequence_t{0};
     _requests_queue.clear();
-    _correlations.clear();
 }
 void base_transport::shutdown() noexcept {
     try {
@@ -159,13 +160,12 @@ void base_transport::shutdown() noexcept {
 }
 
 ss::future<> transport::connect(clock_type::duration connection_timeout) {
-    return connect(connection_timeout + rpc::clock_type::now());
+    return connect(connection_timeout + cached_clock::now());
 }
 
 ss::future<>
 transport::connect(rpc::clock_type::time_point connection_timeout) {
     return base_transport::connect(connection_timeout).then([this] {
-        _correlation_idx = 0;
         _last_seq = sequence_t{0};
         _seq = sequence_t{0};
         // background
@@ -190,30 +190,20 @@ transport::send(netbuf b, rpc::client_opts opts) {
 
 ss::future<result<std::unique_ptr<streaming_context>>>
 transport::make_response_handler(netbuf& b, const rpc::client_opts& opts) {
-    if (_correlations.find(_correlation_idx + 1) != _correlations.end()) {
-        _probe.client_correlation_error();
-        throw std::runtime_error("Invalid transport state. Doubly "
-                                 "registered correlation_id");
-    }
-    const uint32_t idx = ++_correlation_idx;
     auto item = std::make_unique<internal::response_handler>();
     auto item_raw_ptr = item.get();
-    // capture the future _before_ inserting promise in the map
+    // capture the future _before_ inserting promise in the table
     // in case there is a concurrent error w/ the connection and it
     // fails the future before we return from this function
     auto response_future = item_raw_ptr->get_future();
+    const uint32_t idx = _correlations.insert(std::move(item));
     b.set_correlation_id(idx);
-    auto [_, success] = _correlations.emplace(idx, std::move(item));
-    if (unlikely(!success)) {
-        throw std::logic_error(
-          fmt::format("Tried to reuse correlation id: {}", idx));
-    }
     item_raw_ptr->with_timeout(opts.timeout, [this, idx] {
-        auto it = _correlations.find(idx);
-        if (likely(it != _correlations.end())) {
+        // the generation tag on the id makes the extract a no-op when the
+        // response already completed the slot
+        if (likely(_correlations.extract(idx) != nullptr)) {
             vlog(rpclog.info, "Request timeout, correlation id: {}", idx);
             _probe.request_timeout();
-            _correlations.erase(it);
         }
     });
 
@@ -301,8 +291,10 @@ ss::future<> transport::do_reads() {
 /// - this needs a streaming_context.
 ///
 ss::future<> transport::dispatch(header h) {
-    auto it = _correlations.find(h.correlation_id);
-    if (it == _correlations.end()) {
+    // removes the handler from its slot before setting the value so that
+    // we don't run into nested exceptions of broken promises
+    auto pr = _correlations.extract(h.correlation_id);
+    if (pr == nullptr) {
         // We removed correlation already
         _probe.server_correlation_error();
         vlog(
@@ -315,10 +307,6 @@ ss::future<> transport::dispatch(header h) {
     _probe.add_bytes_received(size_of_rpc_header + h.payload_size);
     auto ctx = std::make_unique<client_context_impl>(*this, h);
     auto fut = ctx->pr.get_future();
-    // delete before setting value so that we don't run into nested exceptions
-    // of broken promises
-    auto pr = std::move(it->second);
-    _correlations.erase(it);
     pr->set_value(std::move(ctx));
     _probe.request_completed();
     return fut;
@@ -339,10 +327,9 @@ transport::~transport() {
 std::ostream& operator<<(std::ostream& o, const transport& t) {
     fmt::print(
       o,
-      "(server:{}, _correlations:{}, _correlation_idx:{})",
+      "(server:{}, in_flight_correlations:{})",
       t.server_address(),
-      t._correlations.size(),
-      t._correlation_idx);
+      t._correlations.size());
     return o;
 }
 } // namespace rpc
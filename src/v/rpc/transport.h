@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "likely.h"
 #include "outcome.h"
 #include "reflection/async_adl.h"
 #include "rpc/batched_output_stream.h"
@@ -31,17 +32,103 @@
 #include <seastar/net/tls.hh>
 
 #include <absl/container/btree_map.h>
-#include <absl/container/flat_hash_map.h>
 #include <bits/stdint-uintn.h>
 
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace rpc {
 struct client_context_impl;
 
+/**
+ * Slotted table of in-flight requests. Correlation ids are built from a
+ * slot index plus a per-slot generation counter, so arming a request and
+ * completing it are both O(1) vector accesses with no hashing and no
+ * per-request node allocation - the slot vector grows to the peak
+ * in-flight depth and is reused from a freelist afterwards. The
+ * generation tag makes ids from a previous occupant of the slot (late
+ * responses, fired timeouts) decode to a miss instead of completing the
+ * wrong request.
+ */
+class correlation_table {
+public:
+    using handler_ptr = std::unique_ptr<internal::response_handler>;
+
+    /// arm a request; returns the correlation id to put on the wire
+    uint32_t insert(handler_ptr h) {
+        uint32_t idx;
+        if (!_free.empty()) {
+            idx = _free.back();
+            _free.pop_back();
+        } else {
+            if (unlikely(_slots.size() > max_slot_index)) {
+                throw std::runtime_error(
+                  "Invalid transport state. Exhausted correlation slots");
+            }
+            idx = _slots.size();
+            _slots.emplace_back();
+        }
+        _slots[idx].handler = std::move(h);
+        return encoded_id(idx);
+    }
+
+    /// complete a request; nullptr when the id is unknown or stale
+    handler_ptr extract(uint32_t correlation_id) {
+        if (correlation_id == 0) {
+            return nullptr;
+        }
+        correlation_id -= 1;
+        const uint32_t idx = correlation_id & max_slot_index;
+        const uint32_t generation = correlation_id >> slot_bits;
+        if (idx >= _slots.size() || _slots[idx].generation != generation
+            || !_slots[idx].handler) {
+            return nullptr;
+        }
+        auto h = std::move(_slots[idx].handler);
+        // invalidate outstanding ids pointing at this slot before reuse.
+        // generations stay below max_generation so the +1 bias on encoded
+        // ids can never overflow back to the reserved zero id
+        _slots[idx].generation = (generation + 1) % max_generation;
+        _free.push_back(idx);
+        return h;
+    }
+
+    /// drain every live handler, e.g. to fail them on disconnect
+    std::vector<handler_ptr> release_all() {
+        std::vector<handler_ptr> live;
+        for (uint32_t idx = 0; idx < _slots.size(); ++idx) {
+            if (_slots[idx].handler) {
+                live.push_back(extract(encoded_id(idx)));
+            }
+        }
+        return live;
+    }
+
+    size_t size() const { return _slots.size() - _free.size(); }
+
+private:
+    static constexpr uint32_t slot_bits = 16;
+    static constexpr uint32_t max_slot_index = (1U << slot_bits) - 1;
+    static constexpr uint32_t max_generation = (1U << (32 - slot_bits)) - 1;
+
+    // biased by one - the wire format treats correlation id zero as unset
+    uint32_t encoded_id(uint32_t idx) const {
+        return ((_slots[idx].generation << slot_bits) | idx) + 1;
+    }
+
+    struct slot {
+        handler_ptr handler;
+        uint32_t generation{0};
+    };
+
+    std::vector<slot> _slots;
+    std::vector<uint32_t> _free;
+};
+
 class base_transport {
 public:
     struct configuration {
@@ -124,9 +211,7 @@ private:
     make_response_handler(netbuf&, const rpc::client_opts&);
 
     ss::semaphore _memory;
-    absl::flat_hash_map<uint32_t, std::unique_ptr<internal::response_handler>>
-      _correlations;
-    uint32_t _correlation_idx{0};
+    correlation_table _correlations;
     ss::metrics::metric_groups _metrics;
     /**
      * ordered map containing in-flight requests. The map preserves order of
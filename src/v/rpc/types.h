@@ -198,6 +198,11 @@ struct server_configuration {
     // we use the same default as seastar for load balancing algorithm
     ss::server_socket::load_balancing_algorithm load_balancing_algo
       = ss::server_socket::load_balancing_algorithm::connection_distribution;
+    /// with tls enabled, at most this many accepted connections may be mid
+    /// handshake per shard at a time; further accepts wait in the listen
+    /// backlog, so a client reconnect storm cannot pin the shard in
+    /// asymmetric crypto and starve established traffic
+    size_t max_concurrent_tls_handshakes = 64;
 
     explicit server_configuration(ss::sstring n)
       : name(std::move(n)) {}
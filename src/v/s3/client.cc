@@ -16,6 +16,7 @@
 #include "s3/error.h"
 #include "s3/logger.h"
 #include "s3/signature.h"
+#include "utils/gate_guard.h"
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/coroutine.hh>
@@ -246,6 +247,136 @@ request_creator::make_delete_object_request(
     return header;
 }
 
+result<http::client::request_header>
+request_creator::make_create_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<object_tag>& tags) {
+    http::client::request_header header{};
+    // POST /{object-id}?uploads HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // x-amz-content-sha256:e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploads", key().string());
+    std::string emptysig
+      = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    header.insert(aws_header_names::x_amz_content_sha256, emptysig);
+    if (!tags.empty()) {
+        std::stringstream tstr;
+        for (const auto& [key, val] : tags) {
+            tstr << fmt::format("&{}={}", key, val);
+        }
+        header.insert(aws_header_names::x_amz_tagging, tstr.str().substr(1));
+    }
+    auto ec = _sign.sign_header(header, emptysig);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header> request_creator::make_upload_part_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  size_t payload_size_bytes) {
+    http::client::request_header header{};
+    // PUT /{object-id}?partNumber={part-number}&uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: {payload-size}
+    // [{payload-size} bytes of part data]
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format(
+      "/{}?partNumber={}&uploadId={}", key().string(), part_number, upload_id);
+    std::string sig = "UNSIGNED-PAYLOAD";
+    header.method(boost::beast::http::verb::put);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(aws_header_names::x_amz_content_sha256, sig);
+    auto ec = _sign.sign_header(header, sig);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_complete_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  size_t payload_size_bytes) {
+    http::client::request_header header{};
+    // POST /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // Content-Length: {payload-size}
+    // [xml list of part etags]
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    std::string sig = "UNSIGNED-PAYLOAD";
+    header.method(boost::beast::http::verb::post);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(
+      boost::beast::http::field::content_length,
+      std::to_string(payload_size_bytes));
+    header.insert(aws_header_names::x_amz_content_sha256, sig);
+    auto ec = _sign.sign_header(header, sig);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
+result<http::client::request_header>
+request_creator::make_abort_multipart_upload_request(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id) {
+    http::client::request_header header{};
+    // DELETE /{object-id}?uploadId={upload-id} HTTP/1.1
+    // Host: {bucket-name}.s3.amazonaws.com
+    // x-amz-date:{req-datetime}
+    // Authorization:{signature}
+    // x-amz-content-sha256:e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855
+    auto host = fmt::format("{}.{}", name(), _ap());
+    auto target = fmt::format("/{}?uploadId={}", key().string(), upload_id);
+    std::string emptysig
+      = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+    header.method(boost::beast::http::verb::delete_);
+    header.target(target);
+    header.insert(
+      boost::beast::http::field::user_agent, aws_header_values::user_agent);
+    header.insert(boost::beast::http::field::host, host);
+    header.insert(boost::beast::http::field::content_length, "0");
+    header.insert(aws_header_names::x_amz_content_sha256, emptysig);
+    auto ec = _sign.sign_header(header, emptysig);
+    if (ec) {
+        return ec;
+    }
+    return header;
+}
+
 // client //
 
 /// Convert iobuf that contains xml data to boost::property_tree
@@ -481,4 +612,228 @@ client::delete_object(const bucket_name& bucket, const object_key& key) {
       });
 }
 
+/// Extract upload id from the 'CreateMultipartUpload' response
+static ss::sstring iobuf_to_upload_id(iobuf&& buf) {
+    try {
+        auto root = iobuf_to_ptree(std::move(buf));
+        return root.get<ss::sstring>("InitiateMultipartUploadResult.UploadId");
+    } catch (...) {
+        vlog(
+          s3_log.error, "!!error parse upload id {}", std::current_exception());
+        throw;
+    }
+}
+
+/// Generate the xml payload of the 'CompleteMultipartUpload' request
+static iobuf
+make_complete_multipart_upload_body(const std::vector<ss::sstring>& etags) {
+    std::stringstream body;
+    body << "<CompleteMultipartUpload>";
+    for (size_t i = 0; i < etags.size(); i++) {
+        body << "<Part><PartNumber>" << i + 1 << "</PartNumber><ETag>"
+             << etags[i] << "</ETag></Part>";
+    }
+    body << "</CompleteMultipartUpload>";
+    iobuf result;
+    auto str = body.str();
+    result.append(str.data(), str.size());
+    return result;
+}
+
+ss::future<ss::sstring> client::create_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const std::vector<object_tag>& tags) {
+    auto header = _requestor.make_create_multipart_upload_request(
+      name, key, tags);
+    if (!header) {
+        return ss::make_exception_future<ss::sstring>(
+          std::system_error(header.error()));
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header);
+    return _client.request(std::move(header.value()))
+      .then([](const http::client::response_stream_ref& ref) {
+          return drain_response_stream(ref).then([ref](iobuf&& res) {
+              auto status = ref->get_headers().result();
+              if (status != boost::beast::http::status::ok) {
+                  return parse_rest_error_response<ss::sstring>(
+                    std::move(res));
+              }
+              return ss::make_ready_future<ss::sstring>(
+                iobuf_to_upload_id(std::move(res)));
+          });
+      });
+}
+
+ss::future<ss::sstring> client::upload_part(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  uint32_t part_number,
+  size_t payload_size,
+  ss::input_stream<char>&& body) {
+    auto header = _requestor.make_upload_part_request(
+      name, key, upload_id, part_number, payload_size);
+    if (!header) {
+        return ss::make_exception_future<ss::sstring>(
+          std::system_error(header.error()));
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header);
+    return ss::do_with(
+      std::move(body),
+      [this, header = std::move(header)](ss::input_stream<char>& body) mutable {
+          return _client.request(std::move(header.value()), body)
+            .then([](const http::client::response_stream_ref& ref) {
+                return drain_response_stream(ref).then([ref](iobuf&& res) {
+                    auto status = ref->get_headers().result();
+                    if (status != boost::beast::http::status::ok) {
+                        return parse_rest_error_response<ss::sstring>(
+                          std::move(res));
+                    }
+                    auto etag = ref->get_headers().at(
+                      boost::beast::http::field::etag);
+                    return ss::make_ready_future<ss::sstring>(
+                      ss::sstring(etag.data(), etag.size()));
+                });
+            })
+            .finally([&body]() { return body.close(); });
+      });
+}
+
+ss::future<> client::complete_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id,
+  const std::vector<ss::sstring>& part_etags) {
+    auto payload = make_complete_multipart_upload_body(part_etags);
+    auto payload_size = payload.size_bytes();
+    auto header = _requestor.make_complete_multipart_upload_request(
+      name, key, upload_id, payload_size);
+    if (!header) {
+        return ss::make_exception_future<>(std::system_error(header.error()));
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header);
+    return ss::do_with(
+      make_iobuf_input_stream(std::move(payload)),
+      [this, header = std::move(header)](ss::input_stream<char>& body) mutable {
+          return _client.request(std::move(header.value()), body)
+            .then([](const http::client::response_stream_ref& ref) {
+                return drain_response_stream(ref).then([ref](iobuf&& res) {
+                    auto status = ref->get_headers().result();
+                    if (status != boost::beast::http::status::ok) {
+                        return parse_rest_error_response<>(std::move(res));
+                    }
+                    // S3 can return '200 OK' with an error digest in the
+                    // body if the request failed mid-flight
+                    auto root = iobuf_to_ptree(std::move(res));
+                    if (auto err = root.get_child_optional("Error"); err) {
+                        constexpr const char* empty = "";
+                        return ss::make_exception_future<>(rest_error_response(
+                          err->get<ss::sstring>("Code", empty),
+                          err->get<ss::sstring>("Message", empty),
+                          err->get<ss::sstring>("RequestId", empty),
+                          err->get<ss::sstring>("Resource", empty)));
+                    }
+                    return ss::now();
+                });
+            })
+            .finally([&body]() { return body.close(); });
+      });
+}
+
+ss::future<> client::abort_multipart_upload(
+  bucket_name const& name,
+  object_key const& key,
+  const ss::sstring& upload_id) {
+    auto header = _requestor.make_abort_multipart_upload_request(
+      name, key, upload_id);
+    if (!header) {
+        return ss::make_exception_future<>(std::system_error(header.error()));
+    }
+    vlog(s3_log.trace, "send https request:\n{}", header);
+    return _client.request(std::move(header.value()))
+      .then([](const http::client::response_stream_ref& ref) {
+          return drain_response_stream(ref).then([ref](iobuf&& res) {
+              auto status = ref->get_headers().result();
+              if (
+                status != boost::beast::http::status::ok
+                && status
+                     != boost::beast::http::status::no_content) { // expect 204
+                  return parse_rest_error_response<>(std::move(res));
+              }
+              return ss::now();
+          });
+      });
+}
+
+// client pool //
+
+client_pool::client_pool(
+  size_t size, configuration conf, client_pool_overdraft_policy policy)
+  : _max_size(size)
+  , _config(std::move(conf))
+  , _policy(policy) {
+    init();
+}
+
+ss::future<> client_pool::stop() {
+    _cvar.broken();
+    co_await _gate.close();
+    // Leased clients should be returned before 'stop' is called so at
+    // this point the pool owns all the clients
+    for (auto& cl : _pool) {
+        co_await cl->shutdown();
+    }
+}
+
+void client_pool::init() {
+    for (size_t i = 0; i < _max_size; i++) {
+        auto cl = ss::make_shared<client>(_config);
+        _pool.emplace_back(std::move(cl));
+    }
+}
+
+ss::future<client_pool::client_lease> client_pool::acquire() {
+    gate_guard guard(_gate);
+    try {
+        while (_pool.empty() && !_gate.is_closed()) {
+            if (_policy == client_pool_overdraft_policy::wait_if_empty) {
+                co_await _cvar.wait();
+            } else {
+                auto cl = ss::make_shared<client>(_config);
+                _pool.emplace_back(std::move(cl));
+            }
+        }
+    } catch (const ss::broken_condition_variable&) {
+    }
+    if (_gate.is_closed()) {
+        throw ss::gate_closed_exception();
+    }
+    auto cl = _pool.back();
+    _pool.pop_back();
+    vlog(
+      s3_log.trace, "client lease acquired, pool size: {}", _pool.size());
+    co_return client_lease{
+      .client = cl,
+      .deleter = ss::make_deleter([pool = weak_from_this(), cl] {
+          if (pool) {
+              pool->release(cl);
+          }
+      })};
+}
+
+size_t client_pool::size() const noexcept { return _pool.size(); }
+
+size_t client_pool::max_size() const noexcept { return _max_size; }
+
+void client_pool::release(client_ptr leased) {
+    vlog(
+      s3_log.trace, "client lease released, pool size: {}", _pool.size());
+    if (_pool.size() >= _max_size) {
+        return;
+    }
+    _pool.emplace_back(std::move(leased));
+    _cvar.signal();
+}
+
 } // namespace s3
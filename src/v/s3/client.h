@@ -14,6 +14,12 @@
 #include "rpc/transport.h"
 #include "s3/signature.h"
 
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/deleter.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/weak_ptr.hh>
+
 #include <boost/property_tree/ptree_fwd.hpp>
 
 #include <chrono>
@@ -112,6 +118,57 @@ public:
       std::optional<object_key> start_after,
       std::optional<size_t> max_keys);
 
+    /// \brief Create a 'CreateMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_create_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<object_tag>& tags);
+
+    /// \brief Create unsigned 'UploadPart' request header
+    /// The payload is unsigned, same as for 'PutObject'.
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param part_number is a 1-based index of the part
+    /// \param payload_size_bytes is a size of the part in bytes
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_upload_part_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size_bytes);
+
+    /// \brief Create a 'CompleteMultipartUpload' request header
+    /// The payload is an xml document that lists etags of the parts.
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \param payload_size_bytes is a size of the xml payload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_complete_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      size_t payload_size_bytes);
+
+    /// \brief Create an 'AbortMultipartUpload' request header
+    ///
+    /// \param name is a bucket that should be used to store new object
+    /// \param key is an object name
+    /// \param upload_id is an id of the multipart upload
+    /// \return initialized and signed http header or error
+    result<http::client::request_header> make_abort_multipart_upload_request(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id);
+
 private:
     access_point_uri _ap;
     signature_v4 _sign;
@@ -166,9 +223,114 @@ public:
     ss::future<>
     delete_object(const bucket_name& bucket, const object_key& key);
 
+    /// Start multipart upload of the object.
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \return future that returns upload id of the new multipart upload
+    ss::future<ss::sstring> create_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const std::vector<object_tag>& tags = {});
+
+    /// Upload one part of the multipart upload.
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by 'create_multipart_upload'
+    /// \param part_number is a 1-based index of the part
+    /// \param payload_size is a size of the part in bytes
+    /// \param body is an input_stream that can be used to read body
+    /// \return future that returns etag of the uploaded part
+    ss::future<ss::sstring> upload_part(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      uint32_t part_number,
+      size_t payload_size,
+      ss::input_stream<char>&& body);
+
+    /// Finish multipart upload by stitching the parts together.
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by 'create_multipart_upload'
+    /// \param part_etags are etags of the uploaded parts in part number order
+    /// \return future that becomes ready when the upload is completed
+    ss::future<> complete_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id,
+      const std::vector<ss::sstring>& part_etags);
+
+    /// Abort multipart upload and delete all uploaded parts.
+    /// \param name is a bucket name
+    /// \param key is an id of the object
+    /// \param upload_id is an id returned by 'create_multipart_upload'
+    /// \return future that becomes ready when the upload is aborted
+    ss::future<> abort_multipart_upload(
+      bucket_name const& name,
+      object_key const& key,
+      const ss::sstring& upload_id);
+
 private:
     request_creator _requestor;
     http::client _client;
 };
 
+/// Policy that controls behaviour of the client pool
+/// in the case when number of requested clients exceeds
+/// the pool capacity
+enum class client_pool_overdraft_policy { wait_if_empty, create_new_if_empty };
+
+/// Pool of S3 clients.
+/// The pool keeps the http connections of idle clients open so
+/// individual requests don't have to pay for connection setup and TLS
+/// handshake. The endpoint address is resolved once when the
+/// 'configuration' is created so the clients also share the DNS lookup
+/// result.
+class client_pool : public ss::weakly_referencable<client_pool> {
+public:
+    using client_ptr = ss::shared_ptr<client>;
+
+    /// Client rented from the pool. The client is returned back to the
+    /// pool automatically when the deleter is destroyed.
+    struct client_lease {
+        client_ptr client;
+        ss::deleter deleter;
+    };
+
+    client_pool(
+      size_t size,
+      configuration conf,
+      client_pool_overdraft_policy policy
+      = client_pool_overdraft_policy::wait_if_empty);
+
+    /// Stop the pool and shutdown all the clients. All the leased
+    /// clients should be returned before 'stop' is invoked.
+    ss::future<> stop();
+
+    /// \brief Acquire a client from the pool.
+    /// If the pool is empty the caller either waits until some other
+    /// fiber returns a client or receives a newly created one (depending
+    /// on the overdraft policy).
+    ///
+    /// \return future that returns the leased client
+    ss::future<client_lease> acquire();
+
+    /// Number of clients that are available for lease
+    size_t size() const noexcept;
+
+    /// Max number of clients that the pool can hold
+    size_t max_size() const noexcept;
+
+private:
+    void init();
+    void release(client_ptr leased);
+
+    size_t _max_size;
+    configuration _config;
+    client_pool_overdraft_policy _policy;
+    std::vector<client_ptr> _pool;
+    ss::condition_variable _cvar;
+    ss::gate _gate;
+};
+
 } // namespace s3
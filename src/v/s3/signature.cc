@@ -30,6 +30,14 @@ constexpr int sha256_digest_length = 32;
 using hmac_digest = std::array<char, sha256_digest_length>;
 
 constexpr std::string_view algorithm = "AWS4-HMAC-SHA256";
+constexpr std::string_view streaming_algorithm = "AWS4-HMAC-SHA256-PAYLOAD";
+constexpr std::string_view streaming_payload_sha256
+  = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+/// SHA256 of an empty string, chunk signatures don't cover any headers
+constexpr std::string_view empty_payload_sha256
+  = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+constexpr std::string_view chunk_signature_prefix = ";chunk-signature=";
+constexpr size_t signature_hex_length = 64;
 
 // time_source //
 
@@ -326,8 +334,19 @@ ss::sstring signature_v4::sha256_hexdigest(std::string_view payload) {
 }
 
 std::error_code signature_v4::sign_header(
+  http::client::request_header& header, const ss::sstring& sha256) const {
+    auto res = do_sign_header(header, sha256);
+    if (!res) {
+        return res.error();
+    }
+    return {};
+}
+
+result<signature_v4::signing_result> signature_v4::do_sign_header(
   http::client::request_header& header, const ss::sstring& sha256) const {
     auto amz_date = _sig_time.format_datetime();
+    // the date scope of the signing key has to match the x-amz-date header
+    maybe_renew_sign_key(amz_date.substr(0, 8));
     header.set("x-amz-date", {amz_date.data(), amz_date.size()});
     header.set("x-amz-content-sha256", {sha256.data(), sha256.size()});
     auto canonical_headers = get_canonical_headers(header);
@@ -343,16 +362,62 @@ std::error_code signature_v4::sign_header(
     auto str_to_sign = get_string_to_sign(
       amz_date, _cred_scope, canonical_req.value());
     auto digest = hmac(_sign_key, str_to_sign);
+    auto signature = hexdigest(digest);
     auto auth_header = fmt::format(
       "{} Credential={}/{},SignedHeaders={},Signature={}",
       algorithm,
       _access_key(),
       _cred_scope,
       canonical_headers.value().signed_headers,
-      hexdigest(digest));
+      signature);
     header.set(boost::beast::http::field::authorization, auth_header);
     vlog(s3_log.trace, "\n[signed-header]\n\n{}", header);
-    return {};
+    return signing_result{
+      .signature = std::move(signature),
+      .datetime = std::move(amz_date),
+    };
+}
+
+result<chunk_signer> signature_v4::sign_chunked_header(
+  http::client::request_header& header,
+  size_t decoded_content_length,
+  size_t chunk_size) const {
+    header.insert(boost::beast::http::field::content_encoding, "aws-chunked");
+    header.insert(
+      "x-amz-decoded-content-length", std::to_string(decoded_content_length));
+    // content-length covers the chunk framing, not just the payload
+    header.set(
+      boost::beast::http::field::content_length,
+      std::to_string(chunk_signer::chunked_content_length(
+        decoded_content_length, chunk_size)));
+    auto res = do_sign_header(
+      header,
+      ss::sstring{
+        streaming_payload_sha256.data(), streaming_payload_sha256.size()});
+    if (!res) {
+        return res.error();
+    }
+    return chunk_signer(
+      std::move(res.value().datetime),
+      _cred_scope,
+      _sign_key,
+      std::move(res.value().signature));
+}
+
+void signature_v4::maybe_renew_sign_key(const ss::sstring& datestr) const {
+    if (likely(datestr == _sign_key_date)) {
+        return;
+    }
+    ss::sstring service = "s3";
+    _sign_key = gen_sig_key(_private_key(), datestr, _region(), service);
+    _cred_scope = fmt::format(
+      "{}/{}/{}/aws4_request", datestr, _region(), service);
+    _sign_key_date = datestr;
+    vlog(
+      s3_log.trace,
+      "\n[signing key]\n{}\n[scope]\n{}\n",
+      hexdigest(_sign_key),
+      _cred_scope);
 }
 
 signature_v4::signature_v4(
@@ -364,15 +429,57 @@ signature_v4::signature_v4(
   , _region(std::move(region))
   , _access_key(std::move(access_key))
   , _private_key(std::move(private_key)) {
-    ss::sstring date_str = _sig_time.format_date();
-    ss::sstring service = "s3";
-    _sign_key = gen_sig_key(_private_key(), date_str, _region(), service);
-    _cred_scope = fmt::format(
-      "{}/{}/{}/aws4_request", date_str, _region(), service);
-    vlog(
-      s3_log.trace,
-      "\n[signing key]\n{}\n[scope]\n{}\n",
-      hexdigest(_sign_key),
-      _cred_scope);
+    maybe_renew_sign_key(_sig_time.format_date());
+}
+
+// chunk_signer //
+
+chunk_signer::chunk_signer(
+  ss::sstring datetime,
+  ss::sstring scope,
+  ss::sstring sign_key,
+  ss::sstring seed_signature)
+  : _datetime(std::move(datetime))
+  , _scope(std::move(scope))
+  , _sign_key(std::move(sign_key))
+  , _signature(std::move(seed_signature)) {}
+
+iobuf chunk_signer::sign_chunk(std::string_view payload) {
+    auto str_to_sign = fmt::format(
+      "{}\n{}\n{}\n{}\n{}\n{}",
+      streaming_algorithm,
+      _datetime,
+      _scope,
+      _signature,
+      empty_payload_sha256,
+      sha_256(payload));
+    auto digest = hmac(_sign_key, str_to_sign);
+    _signature = hexdigest(digest);
+    iobuf frame;
+    auto head = fmt::format(
+      "{:x}{}{}\r\n", payload.size(), chunk_signature_prefix, _signature);
+    frame.append(head.data(), head.size());
+    frame.append(payload.data(), payload.size());
+    frame.append("\r\n", 2);
+    return frame;
 }
+
+size_t chunk_signer::chunked_content_length(
+  size_t decoded_length, size_t chunk_size) {
+    vassert(chunk_size > 0, "invalid chunk size");
+    auto frame_size = [](size_t payload_size) {
+        // <size-hex><";chunk-signature="><64 hex digits>\r\n<payload>\r\n
+        return fmt::format("{:x}", payload_size).size()
+               + chunk_signature_prefix.size() + signature_hex_length + 2
+               + payload_size + 2;
+    };
+    size_t total = (decoded_length / chunk_size) * frame_size(chunk_size);
+    if (auto tail = decoded_length % chunk_size; tail != 0) {
+        total += frame_size(tail);
+    }
+    // the terminating zero length chunk
+    total += frame_size(0);
+    return total;
+}
+
 } // namespace s3
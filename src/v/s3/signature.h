@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
 #include "http/client.h"
 #include "outcome.h"
 #include "units.h"
@@ -69,6 +70,43 @@ private:
     ss::noncopyable_function<timestamp()> _gettime_fn;
 };
 
+/// Signs the chunks of an aws-chunked (streaming) upload. Created by
+/// signature_v4::sign_chunked_header which seeds the signature chain.
+class chunk_signer {
+public:
+    /// \brief Frame and sign a single chunk of the payload
+    /// Chunks have to be signed in upload order because every signature is
+    /// chained to the previous one. An empty payload produces the
+    /// terminating zero length chunk that has to conclude the upload.
+    ///
+    /// \param payload is the content of the chunk without framing
+    /// \return framed chunk ready to be written to the connection
+    iobuf sign_chunk(std::string_view payload);
+
+    /// Length of the aws-chunked encoded body. The framing is covered by
+    /// the content-length header while x-amz-decoded-content-length holds
+    /// the payload size.
+    ///
+    /// \param decoded_length is the payload size without framing
+    /// \param chunk_size is used for all chunks except possibly the last
+    static size_t
+    chunked_content_length(size_t decoded_length, size_t chunk_size);
+
+private:
+    friend class signature_v4;
+    chunk_signer(
+      ss::sstring datetime,
+      ss::sstring scope,
+      ss::sstring sign_key,
+      ss::sstring seed_signature);
+
+    ss::sstring _datetime;
+    ss::sstring _scope;
+    ss::sstring _sign_key;
+    /// Signature of the previous chunk, seed signature initially
+    ss::sstring _signature;
+};
+
 /// AWS Signature V4 generator
 class signature_v4 {
 public:
@@ -94,6 +132,21 @@ public:
     std::error_code sign_header(
       http::client::request_header& header, const ss::sstring& sha256) const;
 
+    /// \brief Sign http header for an aws-chunked (streaming) upload
+    /// Sets the streaming payload marker, content-encoding and the length
+    /// headers, then signs the header. The returned signer continues the
+    /// signature chain so the payload can be streamed chunk by chunk
+    /// without buffering a whole part.
+    ///
+    /// \param header is an in/out parameter that contains request headers
+    /// \param decoded_content_length is the payload size without framing
+    /// \param chunk_size is the chunk size the uploader will use for all
+    ///        chunks except possibly the last one
+    result<chunk_signer> sign_chunked_header(
+      http::client::request_header& header,
+      size_t decoded_content_length,
+      size_t chunk_size) const;
+
     static ss::sstring gen_sig_key(
       std::string_view key,
       std::string_view datestr,
@@ -108,6 +161,24 @@ private:
     /// requirements)
     static ss::sstring sha256_hexdigest(std::string_view payload);
 
+    struct signing_result {
+        /// Hex encoded signature of the header, used to seed the chunk
+        /// signature chain of streaming uploads
+        ss::sstring signature;
+        /// The x-amz-date the header was signed with
+        ss::sstring datetime;
+    };
+
+    /// Sign the header and return the signature for chaining
+    result<signing_result> do_sign_header(
+      http::client::request_header& header, const ss::sstring& sha256) const;
+
+    /// Re-derive the date scoped signing key and credential scope if the
+    /// cached ones were derived for a different date. The derivation chain
+    /// costs four hmac rounds per (day, region, service) but its result
+    /// only changes when the UTC day rolls over.
+    void maybe_renew_sign_key(const ss::sstring& datestr) const;
+
     /// Time of the signing key
     time_source _sig_time;
     /// AWS region
@@ -116,10 +187,12 @@ private:
     public_key_str _access_key;
     /// Secret key
     private_key_str _private_key;
-    /// Service specific signing key
-    ss::sstring _sign_key;
+    /// Cached date scoped signing key
+    mutable ss::sstring _sign_key;
     /// Scope of the key (part of the header digest)
-    ss::sstring _cred_scope;
+    mutable ss::sstring _cred_scope;
+    /// Date the cached signing key was derived for
+    mutable ss::sstring _sign_key_date;
 };
 
 template<class Fn>
@@ -37,6 +37,7 @@
 
 #include <chrono>
 #include <exception>
+#include <optional>
 
 static const uint16_t httpd_port_number = 4434;
 static constexpr const char* httpd_host_name = "127.0.0.1";
@@ -78,6 +79,17 @@ static constexpr const char* list_objects_payload = R"xml(
     <Prefix>test-prefix</Prefix>
   </CommonPrefixes>
 </ListBucketResult>)xml";
+static constexpr const char* create_multipart_payload = R"xml(
+<InitiateMultipartUploadResult>
+  <Bucket>test-bucket</Bucket>
+  <Key>test-mpu</Key>
+  <UploadId>test-upload-id</UploadId>
+</InitiateMultipartUploadResult>)xml";
+static constexpr const char* complete_multipart_payload = R"xml(
+<CompleteMultipartUploadResult>
+  <Bucket>test-bucket</Bucket>
+  <Key>test-mpu</Key>
+</CompleteMultipartUploadResult>)xml";
 
 void set_routes(ss::httpd::routes& r) {
     using namespace ss::httpd;
@@ -134,8 +146,39 @@ void set_routes(ss::httpd::routes& r) {
           return "";
       },
       "txt");
+    auto multipart_post_response = new function_handler(
+      [](const_req req) -> ss::sstring {
+          BOOST_REQUIRE(!req.get_header("x-amz-content-sha256").empty());
+          if (req.get_query_param("uploadId").empty()) {
+              // CreateMultipartUpload
+              return create_multipart_payload;
+          }
+          // CompleteMultipartUpload
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "test-upload-id");
+          BOOST_REQUIRE(!req.content.empty());
+          return complete_multipart_payload;
+      },
+      "txt");
+    auto erroneous_post_response = new function_handler(
+      []([[maybe_unused]] const_req req, reply& reply) {
+          reply.set_status(reply::status_type::internal_server_error);
+          return error_payload;
+      },
+      "txt");
+    auto upload_part_response = new function_handler(
+      [](const_req req, reply& reply) -> ss::sstring {
+          BOOST_REQUIRE_EQUAL(req.get_query_param("uploadId"), "test-upload-id");
+          BOOST_REQUIRE(!req.get_query_param("partNumber").empty());
+          BOOST_REQUIRE(req.content == expected_payload);
+          reply.add_header("ETag", "\"test-part-etag\"");
+          return "";
+      },
+      "txt");
     r.add(operation_type::PUT, url("/test"), empty_put_response);
     r.add(operation_type::PUT, url("/test-error"), erroneous_put_response);
+    r.add(operation_type::POST, url("/test-mpu"), multipart_post_response);
+    r.add(operation_type::POST, url("/test-error"), erroneous_post_response);
+    r.add(operation_type::PUT, url("/test-mpu"), upload_part_response);
     r.add(operation_type::GET, url("/test"), get_response);
     r.add(operation_type::GET, url("/test-error"), erroneous_get_response);
     r.add(operation_type::DELETE, url("/test"), empty_delete_response);
@@ -303,6 +346,69 @@ SEASTAR_TEST_CASE(test_delete_object_failure) {
     });
 }
 
+SEASTAR_TEST_CASE(test_multipart_upload_success) {
+    return ss::async([] {
+        auto conf = transport_configuration();
+        auto [server, client] = started_client_and_server(conf);
+        auto upload_id = client
+                           ->create_multipart_upload(
+                             s3::bucket_name("test-bucket"),
+                             s3::object_key("test-mpu"))
+                           .get0();
+        BOOST_REQUIRE_EQUAL(upload_id, "test-upload-id");
+        std::vector<ss::sstring> etags;
+        for (uint32_t part = 1; part <= 2; part++) {
+            iobuf payload;
+            payload.append(expected_payload, expected_payload_size);
+            auto payload_stream = make_iobuf_input_stream(std::move(payload));
+            auto etag = client
+                          ->upload_part(
+                            s3::bucket_name("test-bucket"),
+                            s3::object_key("test-mpu"),
+                            upload_id,
+                            part,
+                            expected_payload_size,
+                            std::move(payload_stream))
+                          .get0();
+            BOOST_REQUIRE_EQUAL(etag, "\"test-part-etag\"");
+            etags.push_back(etag);
+        }
+        client
+          ->complete_multipart_upload(
+            s3::bucket_name("test-bucket"),
+            s3::object_key("test-mpu"),
+            upload_id,
+            etags)
+          .get0();
+        // the requests are verified by the server
+        client->shutdown().get();
+        server->stop().get();
+    });
+}
+
+SEASTAR_TEST_CASE(test_create_multipart_upload_failure) {
+    return ss::async([] {
+        bool error_triggered = false;
+        auto conf = transport_configuration();
+        auto [server, client] = started_client_and_server(conf);
+        try {
+            auto upload_id = client
+                               ->create_multipart_upload(
+                                 s3::bucket_name("test-bucket"),
+                                 s3::object_key("test-error"))
+                               .get0();
+        } catch (const s3::rest_error_response& err) {
+            BOOST_REQUIRE_EQUAL(err.code(), s3::s3_error_code::internal_error);
+            BOOST_REQUIRE_EQUAL(err.message(), "Error.Message");
+            BOOST_REQUIRE_EQUAL(err.request_id(), "Error.RequestId");
+            BOOST_REQUIRE_EQUAL(err.resource(), "Error.Resource");
+            error_triggered = true;
+        }
+        BOOST_REQUIRE(error_triggered);
+        server->stop().get();
+    });
+}
+
 static ss::sstring strtime(const std::chrono::system_clock::time_point& ts) {
     auto tt = std::chrono::system_clock::to_time_t(ts);
     auto tm = *std::gmtime(&tt);
@@ -359,3 +465,44 @@ SEASTAR_TEST_CASE(test_list_objects_failure) {
         server->stop().get();
     });
 }
+
+SEASTAR_TEST_CASE(test_client_pool_wait_if_empty) {
+    return ss::async([] {
+        auto conf = transport_configuration();
+        auto pool = ss::make_shared<s3::client_pool>(
+          2, conf, s3::client_pool_overdraft_policy::wait_if_empty);
+        BOOST_REQUIRE_EQUAL(pool->size(), 2);
+        BOOST_REQUIRE_EQUAL(pool->max_size(), 2);
+        {
+            auto lease1 = pool->acquire().get0();
+            auto lease2 = std::make_optional(pool->acquire().get0());
+            BOOST_REQUIRE_EQUAL(pool->size(), 0);
+            auto fut = pool->acquire();
+            BOOST_REQUIRE(!fut.available());
+            // the waiter should receive the returned client
+            lease2.reset();
+            auto lease3 = fut.get0();
+            BOOST_REQUIRE_EQUAL(pool->size(), 0);
+        }
+        BOOST_REQUIRE_EQUAL(pool->size(), 2);
+        pool->stop().get();
+    });
+}
+
+SEASTAR_TEST_CASE(test_client_pool_create_new_if_empty) {
+    return ss::async([] {
+        auto conf = transport_configuration();
+        auto pool = ss::make_shared<s3::client_pool>(
+          1, conf, s3::client_pool_overdraft_policy::create_new_if_empty);
+        BOOST_REQUIRE_EQUAL(pool->size(), 1);
+        {
+            auto lease1 = pool->acquire().get0();
+            // the pool is empty but the acquire shouldn't block
+            auto lease2 = pool->acquire().get0();
+            BOOST_REQUIRE_EQUAL(pool->size(), 0);
+        }
+        // the pool can't grow larger than max_size
+        BOOST_REQUIRE_EQUAL(pool->size(), 1);
+        pool->stop().get();
+    });
+}
@@ -15,10 +15,12 @@
 
 #include <seastar/core/future-util.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/core/when_all.hh>
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 
 namespace ssx {
 
@@ -258,4 +260,206 @@ inline auto parallel_transform(Rng rng, Func func) {
       });
 }
 
+namespace detail {
+
+template<typename T, typename ResultType, typename Func>
+inline seastar::future<std::vector<ResultType>> parallel_transform_limited(
+  std::vector<T> items, size_t max_concurrent, Func func) {
+    struct state {
+        std::vector<T> items;
+        std::vector<std::optional<ResultType>> results;
+        size_t next{0};
+        Func func;
+    };
+    const auto fibers = std::min(std::max(max_concurrent, size_t{1}),
+                                 items.size());
+    return seastar::do_with(
+      state{std::move(items), {}, 0, std::move(func)},
+      [fibers](state& st) {
+          st.results.resize(st.items.size());
+          std::vector<seastar::future<>> pool;
+          pool.reserve(fibers);
+          for (size_t i = 0; i < fibers; ++i) {
+              pool.push_back(seastar::repeat([&st] {
+                  if (st.next >= st.items.size()) {
+                      return seastar::make_ready_future<
+                        seastar::stop_iteration>(
+                        seastar::stop_iteration::yes);
+                  }
+                  const auto idx = st.next++;
+                  return seastar::futurize_invoke(
+                           st.func, std::move(st.items[idx]))
+                    .then([&st, idx](ResultType r) {
+                        st.results[idx] = std::move(r);
+                        return seastar::stop_iteration::no;
+                    })
+                    .handle_exception([&st](std::exception_ptr e) {
+                        // stop handing out new work, surface the error
+                        st.next = st.items.size();
+                        return seastar::make_exception_future<
+                          seastar::stop_iteration>(std::move(e));
+                    });
+              }));
+          }
+          return seastar::when_all_succeed(pool.begin(), pool.end())
+            .then([&st] {
+                std::vector<ResultType> out;
+                out.reserve(st.results.size());
+                for (auto& r : st.results) {
+                    out.push_back(std::move(*r));
+                }
+                return out;
+            });
+      });
+}
+
+} // namespace detail
+
+/// \brief Run tasks in parallel with bounded concurrency and wait for
+/// completion (work-stealing iterator version).
+///
+/// Given a range [\c begin, \c end) of objects, run \c func on each \c *i
+/// with at most \c max_concurrent invocations in flight. The range is
+/// drained by a fixed pool of fibers that each take the next unprocessed
+/// element as soon as they finish their current one, so a mix of cheap and
+/// expensive elements keeps every fiber busy instead of convoying behind
+/// the slowest member of a fixed partition. Each fiber runs inside
+/// \c seastar::repeat, which yields to the reactor between chunks of
+/// synchronously completing elements, so a large range of cheap tasks
+/// cannot monopolize the shard.
+///
+/// Results are returned in input order. When an invocation fails no new
+/// elements are handed out, already running invocations finish, and one of
+/// the exceptions is returned by this function as a failed future.
+///
+/// \param begin an \c InputIterator designating the beginning of the range
+/// \param end an \c InputIterator designating the end of the range
+/// \param max_concurrent bound on simultaneous invocations, clamped to >= 1
+/// \param func Function to invoke with each element in the range (will be
+/// futurized if it doesn't return a \c future<>)
+/// \return a \c future<> containing a \c std::vector<> of the results
+// clang-format off
+template<typename Iterator, typename Func>
+CONCEPT(requires requires(Func f, Iterator i) {
+    *(++i);
+    { i != i } -> std::convertible_to<bool>;
+    seastar::futurize_invoke(f, *i).get0();
+})
+// clang-format on
+inline auto parallel_transform_limited(
+  Iterator begin, Iterator end, size_t max_concurrent, Func func) {
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using result_type = decltype(seastar::futurize_invoke(func, *begin).get0());
+    std::vector<value_type> items(begin, end);
+    return detail::parallel_transform_limited<value_type, result_type>(
+      std::move(items), max_concurrent, std::move(func));
+}
+
+/// \brief Run tasks in parallel with bounded concurrency and wait for
+/// completion (work-stealing range version).
+///
+/// See the iterator version; the elements of \c rng are moved into the
+/// call, so an rvalue range is safe to pass.
+// clang-format off
+template<typename Rng, typename Func>
+CONCEPT(requires requires(Func f, Rng r) {
+    r.begin();
+    r.end();
+    { r.begin() != r.begin() } -> std::convertible_to<bool>;
+    seastar::futurize_invoke(f, *r.begin()).get0();
+})
+// clang-format on
+inline auto
+parallel_transform_limited(Rng rng, size_t max_concurrent, Func func) {
+    return parallel_transform_limited(
+      std::make_move_iterator(rng.begin()),
+      std::make_move_iterator(rng.end()),
+      max_concurrent,
+      std::move(func));
+}
+
+/// \brief Run tasks in parallel with bounded concurrency and stream every
+/// result into \c consumer in completion order.
+///
+/// Like \c parallel_transform_limited, but instead of collecting results
+/// into a vector the (possibly asynchronous) \c consumer is invoked with
+/// each result as soon as it is ready: fast elements never wait behind
+/// slow ones submitted earlier. Consumer invocations are serialized and
+/// never overlap. When an invocation of \c func or \c consumer fails no
+/// new elements are handed out and one of the exceptions is returned by
+/// this function as a failed future.
+///
+/// \param rng an \c InputRange, its elements are moved into the call
+/// \param max_concurrent bound on simultaneous \c func invocations,
+/// clamped to >= 1
+/// \param func Function to invoke with each element in the range (will be
+/// futurized if it doesn't return a \c future<>)
+/// \param consumer Function invoked with each result in completion order
+/// (will be futurized if it doesn't return a \c future<>)
+/// \return a \c future<> that resolves when the whole range is consumed
+// clang-format off
+template<typename Rng, typename Func, typename Consumer>
+CONCEPT(requires requires(Func f, Consumer c, Rng r) {
+    r.begin();
+    r.end();
+    { r.begin() != r.begin() } -> std::convertible_to<bool>;
+    seastar::futurize_invoke(
+      c, seastar::futurize_invoke(f, *r.begin()).get0());
+})
+// clang-format on
+inline seastar::future<> parallel_consume(
+  Rng rng, size_t max_concurrent, Func func, Consumer consumer) {
+    using value_type = typename std::iterator_traits<decltype(
+      rng.begin())>::value_type;
+    using result_type = decltype(
+      seastar::futurize_invoke(func, *rng.begin()).get0());
+    struct state {
+        std::vector<value_type> items;
+        size_t next{0};
+        Func func;
+        Consumer consumer;
+        seastar::semaphore consumer_lock{1};
+    };
+    std::vector<value_type> items(
+      std::make_move_iterator(rng.begin()),
+      std::make_move_iterator(rng.end()));
+    const auto fibers = std::min(std::max(max_concurrent, size_t{1}),
+                                 items.size());
+    return seastar::do_with(
+      state{std::move(items), 0, std::move(func), std::move(consumer)},
+      [fibers](state& st) {
+          std::vector<seastar::future<>> pool;
+          pool.reserve(fibers);
+          for (size_t i = 0; i < fibers; ++i) {
+              pool.push_back(seastar::repeat([&st] {
+                  if (st.next >= st.items.size()) {
+                      return seastar::make_ready_future<
+                        seastar::stop_iteration>(
+                        seastar::stop_iteration::yes);
+                  }
+                  const auto idx = st.next++;
+                  return seastar::futurize_invoke(
+                           st.func, std::move(st.items[idx]))
+                    .then([&st](result_type r) {
+                        return seastar::with_semaphore(
+                          st.consumer_lock,
+                          1,
+                          [&st, r = std::move(r)]() mutable {
+                              return seastar::futurize_invoke(
+                                st.consumer, std::move(r));
+                          });
+                    })
+                    .then([] { return seastar::stop_iteration::no; })
+                    .handle_exception([&st](std::exception_ptr e) {
+                        // stop handing out new work, surface the error
+                        st.next = st.items.size();
+                        return seastar::make_exception_future<
+                          seastar::stop_iteration>(std::move(e));
+                    });
+              }));
+          }
+          return seastar::when_all_succeed(pool.begin(), pool.end());
+      });
+}
+
 } // namespace ssx
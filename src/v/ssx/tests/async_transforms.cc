@@ -9,6 +9,7 @@
 
 #include "ssx/future-util.h"
 
+#include <seastar/core/sleep.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/testing/thread_test_case.hh>
 
@@ -116,3 +117,70 @@ SEASTAR_THREAD_TEST_CASE(parallel_transform_range_test) {
     BOOST_TEST(std::equal(
       out_range.begin(), out_range.end(), expected.begin(), expected.end()));
 }
+
+SEASTAR_THREAD_TEST_CASE(parallel_transform_limited_test) {
+    std::vector<int> input(100);
+    std::iota(input.begin(), input.end(), 0);
+
+    std::vector<int> expected(100);
+    std::iota(expected.begin(), expected.end(), 2);
+
+    size_t in_flight = 0;
+    size_t max_in_flight = 0;
+    std::vector<int> out = ssx::parallel_transform_limited(
+                             input.begin(),
+                             input.end(),
+                             4,
+                             [&in_flight, &max_in_flight](int v) {
+                                 ++in_flight;
+                                 max_in_flight = std::max(
+                                   max_in_flight, in_flight);
+                                 return ss::sleep(std::chrono::milliseconds(1))
+                                   .then([&in_flight, v] {
+                                       --in_flight;
+                                       return v + 2;
+                                   });
+                             })
+                             .get0();
+    BOOST_TEST(std::equal(
+      out.begin(), out.end(), expected.begin(), expected.end()));
+    BOOST_TEST(max_in_flight <= 4);
+}
+
+SEASTAR_THREAD_TEST_CASE(parallel_transform_limited_error_test) {
+    std::vector<int> input(10);
+    std::iota(input.begin(), input.end(), 0);
+    BOOST_REQUIRE_THROW(
+      ssx::parallel_transform_limited(
+        input.begin(),
+        input.end(),
+        2,
+        [](int v) {
+            if (v == 3) {
+                throw std::runtime_error("boom");
+            }
+            return v;
+        })
+        .get0(),
+      std::runtime_error);
+}
+
+SEASTAR_THREAD_TEST_CASE(parallel_consume_completion_order_test) {
+    // the slowest element is submitted first; completion order streaming
+    // must hand results over as they finish, not in submission order
+    std::vector<int> input{3, 2, 1};
+    std::vector<int> order;
+    ssx::parallel_consume(
+      input,
+      3,
+      [](int v) {
+          return ss::sleep(std::chrono::milliseconds(v * 20)).then([v] {
+              return v;
+          });
+      },
+      [&order](int v) { order.push_back(v); })
+      .get();
+    const std::vector<int> expected{1, 2, 3};
+    BOOST_TEST(std::equal(
+      order.begin(), order.end(), expected.begin(), expected.end()));
+}
@@ -9,6 +9,7 @@
 
 #include "batch_cache.h"
 
+#include "utils/cached_clock.h"
 #include "utils/to_string.h"
 #include "vassert.h"
 
@@ -33,14 +34,14 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
     // if weak_from_this were to cause an allocation--which it shouldn't--`e`
     // wouldn't be visible to the reclaimer since it isn't on a lru/pool list.
     auto p = e->weak_from_this();
-    _lru.push_back(*e);
+    _probation.push_back(*e);
     return p;
 }
 
 batch_cache::~batch_cache() noexcept {
     clear();
     vassert(
-      _size_bytes == 0 && _lru.empty(),
+      _size_bytes == 0 && _lru.empty() && _probation.empty(),
       "Detected incorrect batch_cache accounting. {}",
       *this);
 }
@@ -52,8 +53,10 @@ void batch_cache::evict(entry_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->_batch.memory_usage();
-        _lru.erase_and_dispose(
-          _lru.iterator_to(*p), [](entry* e) { delete e; });
+        // the entry lives on either the probationary or the main lru list,
+        // but unhooking does not care which one
+        p->_hook.unlink();
+        delete p.get(); // NOLINT
     }
 }
 
@@ -70,7 +73,7 @@ size_t batch_cache::reclaim(size_t size) {
      * reclaim loops. otherwise, use the last guess if it has been less than
      * `reclaim_stable_window` and reset the process if it has been longer.
      */
-    auto elapsed = ss::lowres_clock::now() - _last_reclaim;
+    auto elapsed = cached_clock::now() - _last_reclaim;
     if (elapsed < _reclaim_opts.growth_window) {
         _reclaim_size = (((_reclaim_size * 3) + 1) / 2);
     } else if (elapsed > _reclaim_opts.stable_window) {
@@ -92,38 +95,49 @@ size_t batch_cache::reclaim(size_t size) {
     size_t reclaimed = 0;
     intrusive_list<entry, &entry::_hook> reclaimed_entries;
 
-    for (auto it = _lru.begin(); it != _lru.end();) {
-        if (reclaimed >= _reclaim_size) {
-            break;
-        }
+    auto reclaim_from = [this, &reclaimed, &reclaimed_entries](
+                          intrusive_list<entry, &entry::_hook>& lst) {
+        for (auto it = lst.begin(); it != lst.end();) {
+            if (reclaimed >= _reclaim_size) {
+                break;
+            }
 
-        // skip any entry that has a live reference.
-        if (unlikely(it->pinned())) {
-            ++it;
-            continue;
-        }
+            // skip any entry that has a live reference.
+            if (unlikely(it->pinned())) {
+                ++it;
+                continue;
+            }
 
-        // reclaim the batch's record data
-        reclaimed += it->_batch.memory_usage();
-        it->_batch.clear_data();
+            // reclaim the batch's record data
+            reclaimed += it->_batch.memory_usage();
+            it->_batch.clear_data();
+
+            /*
+             * if the owning index is locked invalidate the entry but leave it
+             * on the list for deferred deletion so as to not invalidate any
+             * open iterators on the index.
+             */
+            if (unlikely(it->_index.locked())) {
+                reclaimed -= it->_batch.memory_usage();
+                it->invalidate();
+                ++it;
+                continue;
+            }
 
-        /*
-         * if the owning index is locked invalidate the entry but leave it on
-         * the lru list for deferred deletion so as to not invalidate any open
-         * iterators on the index.
-         */
-        if (unlikely(it->_index.locked())) {
-            reclaimed -= it->_batch.memory_usage();
-            it->invalidate();
-            ++it;
-            continue;
+            // collect the entries that will be fully removed
+            it = lst.erase_and_dispose(it, [&reclaimed_entries](entry* e) {
+                reclaimed_entries.push_back(*e);
+            });
         }
+    };
 
-        // collect the entries that will be fully removed
-        it = _lru.erase_and_dispose(it, [&reclaimed_entries](entry* e) {
-            reclaimed_entries.push_back(*e);
-        });
-    }
+    /*
+     * entries that were never re-referenced after insertion are reclaimed
+     * first, so a cold sequential scan cannot evict the working set of the
+     * hot tailing readers on the shard.
+     */
+    reclaim_from(_probation);
+    reclaim_from(_lru);
 
     /*
      * final removal from the index is deferred because there is some chance
@@ -146,7 +160,7 @@ size_t batch_cache::reclaim(size_t size) {
         index->remove(offset);
     });
 
-    _last_reclaim = ss::lowres_clock::now();
+    _last_reclaim = cached_clock::now();
     _size_bytes -= reclaimed;
     return reclaimed;
 }
@@ -264,7 +278,8 @@ std::ostream& operator<<(std::ostream& o, const batch_cache& b) {
     // Do _not_ print size of _lru
     return o << "{is_reclaiming:" << b.is_memory_reclaiming()
              << ", size_bytes: " << b._size_bytes
-             << ", lru_empty:" << b._lru.empty() << "}";
+             << ", lru_empty:" << b._lru.empty()
+             << ", probation_empty:" << b._probation.empty() << "}";
 }
 std::ostream&
 operator<<(std::ostream& o, const batch_cache_index::read_result& c) {
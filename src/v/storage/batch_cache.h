@@ -50,6 +50,13 @@ class batch_cache_index;
  * example, a batch cache index is created for each log segment, all of which
  * share the same LRU cache.
  *
+ * Eviction is scan resistant: a newly inserted batch starts on a
+ * probationary list and is only promoted to the main LRU list on its first
+ * re-reference (touch). Reclaim drains the probationary list before touching
+ * the main list, so a cold sequential scan - which inserts batches that are
+ * never read twice - cannot push the re-referenced working set of the other
+ * partitions on the shard out of the cache.
+ *
  * The LRU cache serves as an entry point for the Seastar memory reclaimer.
  * During a low-memory event Seastar may make an upcall to the LRU cache to free
  * memory. When memory is reclaimed cache entries are invalidated. Since this
@@ -190,6 +197,7 @@ public:
      */
     batch_cache(batch_cache&& o) noexcept
       : _lru(std::move(o._lru))
+      , _probation(std::move(o._probation))
       , _reclaimer(
           [this](reclaimer::request r) { return reclaim(r); },
           reclaim_scope::sync)
@@ -204,7 +212,7 @@ public:
     ~batch_cache() noexcept;
 
     /// Returns true if the cache is empty, and false otherwise.
-    bool empty() const { return _lru.empty(); }
+    bool empty() const { return _lru.empty() && _probation.empty(); }
 
     /// Removes all entries from the cache and entry pool.
     void clear() { reclaim(std::numeric_limits<size_t>::max()); }
@@ -235,7 +243,8 @@ public:
     void evict(entry_ptr&& e);
 
     /**
-     * Notify the cache that the specified entry was recently used.
+     * Notify the cache that the specified entry was recently used. The first
+     * touch promotes a probationary entry onto the main LRU list.
      */
     void touch(entry_ptr& e) {
         if (e) {
@@ -293,6 +302,8 @@ private:
     }
 
     intrusive_list<entry, &entry::_hook> _lru;
+    // insertions that have not yet been re-referenced. reclaimed before _lru
+    intrusive_list<entry, &entry::_hook> _probation;
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
@@ -349,6 +360,28 @@ public:
         }
     }
 
+    /**
+     * \brief Insert a contiguous range of batches in a single operation.
+     *
+     * Equivalent to calling put() on every batch, but the index lock is
+     * taken once for the whole range. On the disk read path a single parse
+     * produces tens of batches, so inserting them in bulk also means a
+     * reclaim racing with the insertion defers its index removals once for
+     * the entire range rather than once per batch.
+     */
+    void put_range(const ss::circular_buffer<model::record_batch>& batches) {
+        lock_guard lk(*this);
+        for (const auto& batch : batches) {
+            auto offset = batch.header().base_offset;
+            if (likely(!_index.contains(offset))) {
+                // entries are initialized in the cache and index together.
+                // see put() for details.
+                auto p = _cache->put(*this, batch);
+                _index.emplace(offset, std::move(p));
+            }
+        }
+    }
+
     /**
      * Return the batch containing the specified offset, if one exists.
      */
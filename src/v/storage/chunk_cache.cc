@@ -0,0 +1,51 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/chunk_cache.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace storage::internal {
+
+void chunk_cache::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:chunk_cache"),
+      {
+        sm::make_current_bytes(
+          "available_bytes",
+          [this] { return _size_available; },
+          sm::description("Bytes of appender chunks ready to be handed out")),
+        sm::make_current_bytes(
+          "total_bytes",
+          [this] { return _size_total; },
+          sm::description("Bytes of appender chunks in existence")),
+        sm::make_gauge(
+          "waiters",
+          [this] { return _sem.waiters(); },
+          sm::description("Appenders currently blocked waiting for a chunk")),
+        sm::make_derive(
+          "wait_count",
+          [this] { return _wait_count; },
+          sm::description("Number of chunk requests that had to wait")),
+        sm::make_derive(
+          "wait_time_us",
+          [this] { return _wait_time_us; },
+          sm::description(
+            "Cumulative microseconds appenders spent waiting for chunks")),
+      });
+}
+
+} // namespace storage::internal
@@ -9,11 +9,14 @@
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
+#include <seastar/core/metrics_registration.hh>
 #include <seastar/core/semaphore.hh>
 #include <seastar/util/later.hh>
 
 #include <boost/iterator/counting_iterator.hpp>
 
+#include <chrono>
+
 namespace storage::internal {
 
 class chunk_cache {
@@ -41,6 +44,7 @@ public:
     ~chunk_cache() noexcept = default;
 
     ss::future<> start() {
+        setup_metrics();
         const auto num_chunks = memory_groups::chunk_cache_min_memory()
                                 / chunk::chunk_size;
         return ss::do_for_each(
@@ -70,8 +74,23 @@ public:
         if (!_sem.waiters()) {
             return do_get();
         }
-        return ss::get_units(_sem, 1).then(
-          [this](ss::semaphore_units<>) { return do_get(); });
+        return wait_for_chunk();
+    }
+
+    /// occupancy snapshot for the memory group coordinator: everything
+    /// sitting idle in the cache is cheap to give back
+    size_t size_total() const { return _size_total; }
+    size_t size_available() const { return _size_available; }
+
+    /**
+     * Adopt a new budget from the memory group coordinator. Shrinking takes
+     * effect lazily: cached chunks above the new target are dropped as they
+     * are returned, and chunks outstanding above the new limit drain as
+     * appenders release them.
+     */
+    void set_size_targets(size_t target, size_t limit) {
+        _size_target = target;
+        _size_limit = limit;
     }
 
 private:
@@ -79,10 +98,29 @@ private:
         if (auto c = pop_or_allocate(); c) {
             return ss::make_ready_future<chunk_ptr>(c);
         }
+        return wait_for_chunk();
+    }
+
+    /**
+     * Blocks until a chunk is returned to the cache, accounting for the time
+     * an appender spends stalled so chunk pressure shows up in metrics
+     * instead of only as produce latency.
+     */
+    ss::future<chunk_ptr> wait_for_chunk() {
+        ++_wait_count;
+        auto start = std::chrono::steady_clock::now();
         return ss::get_units(_sem, 1).then(
-          [this](ss::semaphore_units<>) { return do_get(); });
+          [this, start](ss::semaphore_units<>) {
+              _wait_time_us
+                += std::chrono::duration_cast<std::chrono::microseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+              return do_get();
+          });
     }
 
+    void setup_metrics();
+
     chunk_ptr pop_or_allocate() {
         if (!_chunks.empty()) {
             auto c = _chunks.front();
@@ -107,8 +145,11 @@ private:
     ss::semaphore _sem{0};
     size_t _size_available{0};
     size_t _size_total{0};
-    const size_t _size_target;
-    const size_t _size_limit;
+    size_t _size_target;
+    size_t _size_limit;
+    uint64_t _wait_count{0};
+    uint64_t _wait_time_us{0};
+    ss::metrics::metric_groups _metrics;
 };
 
 inline chunk_cache& chunks() {
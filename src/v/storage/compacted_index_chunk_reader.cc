@@ -15,6 +15,7 @@
 #include "storage/compacted_index.h"
 #include "storage/compacted_index_reader.h"
 #include "storage/logger.h"
+#include "units.h"
 #include "utils/to_string.h"
 
 #include <seastar/core/file.hh>
@@ -41,7 +42,20 @@ compacted_index_chunk_reader::compacted_index_chunk_reader(
   , _iopc(pc)
   , _max_chunk_memory(max_chunk_memory) {}
 
-ss::future<> compacted_index_chunk_reader::close() { return _handle.close(); }
+ss::future<> compacted_index_chunk_reader::close() {
+    auto f = ss::now();
+    if (_readahead) {
+        // wait for an in flight chunk parse before closing the handle it
+        // reads from; the result - value or error - is no longer wanted
+        auto ra = std::move(_readahead.value());
+        _readahead = std::nullopt;
+        f = ra.then_wrapped(
+          [](ss::future<ss::circular_buffer<compacted_index::entry>> fut) {
+              fut.ignore_ready_future();
+          });
+    }
+    return f.then([this] { return _handle.close(); });
+}
 
 static inline ss::future<compacted_index::footer>
 footer_from_stream(ss::input_stream<char>& in) {
@@ -67,11 +81,13 @@ footer_from_stream(ss::input_stream<char>& in) {
 ss::future<> compacted_index_chunk_reader::verify_integrity() {
     reset();
     return load_footer().then([this](compacted_index::footer) {
-        // NOTE: these are *different* options from other methods in this class
+        // NOTE: these are *different* options from other methods in this class.
+        // deep enough readahead that the crc computation overlaps the next
+        // buffer's io instead of waiting for it
         ss::file_input_stream_options options;
-        options.buffer_size = 4096;
+        options.buffer_size = 32_KiB;
         options.io_priority_class = _iopc;
-        options.read_ahead = 1;
+        options.read_ahead = 4;
         return ss::do_with(
                  int32_t(_footer->size),
                  crc32{},
@@ -168,6 +184,14 @@ bool compacted_index_chunk_reader::is_end_of_stream() const {
 }
 
 void compacted_index_chunk_reader::reset() {
+    vassert(
+      !_readahead || _readahead->available(),
+      "reset() with a chunk readahead in flight - {}",
+      *this);
+    if (_readahead) {
+        _readahead->ignore_ready_future();
+        _readahead = std::nullopt;
+    }
     _end_of_stream = false;
     _byte_index = 0;
     _file_size = std::nullopt;
@@ -183,9 +207,30 @@ compacted_index_chunk_reader::load_slice(model::timeout_clock::time_point t) {
           [this, t](compacted_index::footer) { return load_slice(t); });
     }
     if (!_cursor) {
-        _cursor = ss::make_file_input_stream(_handle, 0, _footer->size);
+        ss::file_input_stream_options options;
+        options.buffer_size = 32_KiB;
+        options.io_priority_class = _iopc;
+        options.read_ahead = 2;
+        _cursor = ss::make_file_input_stream(
+          _handle, 0, _footer->size, std::move(options));
     }
+    // double buffering: hand out the chunk parsed during the consumer's
+    // previous compute phase and immediately start on the next one, so
+    // the reducers alternate between ready chunks instead of alternating
+    // compute and io
+    auto fut = _readahead ? std::move(_readahead.value()) : read_chunk();
+    _readahead = std::nullopt;
+    return fut.then([this](ret_t slice) {
+        if (!is_end_of_stream()) {
+            _readahead = read_chunk();
+        }
+        return ss::make_ready_future<ret_t>(std::move(slice));
+    });
+}
 
+ss::future<ss::circular_buffer<compacted_index::entry>>
+compacted_index_chunk_reader::read_chunk() {
+    using ret_t = ss::circular_buffer<compacted_index::entry>;
     return ss::do_with(
       ret_t{}, size_t(0), [this](ret_t& slice, size_t& mem_use) {
           return ss::do_until(
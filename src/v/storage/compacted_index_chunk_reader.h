@@ -47,6 +47,8 @@ public:
 
 private:
     bool is_footer_loaded() const;
+    /// parses the next chunk of entries from the cursor
+    ss::future<ss::circular_buffer<compacted_index::entry>> read_chunk();
 
     ss::file _handle;
     ss::io_priority_class _iopc;
@@ -56,6 +58,11 @@ private:
     std::optional<compacted_index::footer> _footer;
     bool _end_of_stream{false};
     std::optional<ss::input_stream<char>> _cursor;
+    // the chunk after the one last returned, parsed in the background
+    // while the consumer works on the current one so the reducer
+    // pipeline does not stall on every chunk boundary
+    std::optional<ss::future<ss::circular_buffer<compacted_index::entry>>>
+      _readahead;
 
     friend std::ostream&
     operator<<(std::ostream&, const compacted_index_chunk_reader&);
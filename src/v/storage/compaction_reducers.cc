@@ -107,6 +107,11 @@ compacted_offset_list_reducer::operator()(compacted_index::entry&& e) {
 
 std::optional<model::record_batch>
 copy_data_segment_reducer::filter(model::record_batch&& batch) {
+    // recompression-only rewrite - every record survives
+    if (!_list) {
+        return std::move(batch);
+    }
+
     // 1. compute which records to keep
     const auto base = batch.base_offset();
     std::vector<int32_t> offset_deltas;
@@ -212,6 +217,36 @@ copy_data_segment_reducer::filter(model::record_batch&& batch) {
       h, std::move(ret), model::record_batch::tag_ctor_ng{});
     return new_batch;
 }
+ss::future<ss::stop_iteration>
+copy_data_segment_reducer::write_batch(model::record_batch&& b) {
+    using stop_t = ss::stop_iteration;
+    return ss::do_with(std::move(b), [this](model::record_batch& batch) {
+               auto const start_offset = _appender->file_byte_offset();
+               auto const header_size = batch.header().size_bytes;
+               _acc += header_size;
+               if (_idx.maybe_index(
+                     _acc,
+                     32_KiB,
+                     start_offset,
+                     batch.base_offset(),
+                     batch.last_offset(),
+                     batch.header().first_timestamp,
+                     batch.header().max_timestamp)) {
+                   _acc = 0;
+               }
+               return storage::write(*_appender, batch)
+                 .then([this, start_offset, header_size] {
+                     vassert(
+                       _appender->file_byte_offset()
+                         == start_offset + header_size,
+                       "Size must be deterministic. Expected:{} == {}",
+                       _appender->file_byte_offset(),
+                       start_offset + header_size);
+                 });
+           })
+      .then([] { return ss::make_ready_future<stop_t>(stop_t::no); });
+}
+
 ss::future<ss::stop_iteration> copy_data_segment_reducer::do_compaction(
   model::compression original, model::record_batch&& b) {
     using stop_t = ss::stop_iteration;
@@ -219,34 +254,11 @@ ss::future<ss::stop_iteration> copy_data_segment_reducer::do_compaction(
     if (to_copy == std::nullopt) {
         return ss::make_ready_future<stop_t>(stop_t::no);
     }
-    return compress_batch(original, std::move(to_copy.value()))
+    const auto codec = _target_compression.value_or(original);
+    return compress_batch(codec, std::move(to_copy.value()))
       .then([this](model::record_batch&& b) {
-          return ss::do_with(std::move(b), [this](model::record_batch& batch) {
-              auto const start_offset = _appender->file_byte_offset();
-              auto const header_size = batch.header().size_bytes;
-              _acc += header_size;
-              if (_idx.maybe_index(
-                    _acc,
-                    32_KiB,
-                    start_offset,
-                    batch.base_offset(),
-                    batch.last_offset(),
-                    batch.header().first_timestamp,
-                    batch.header().max_timestamp)) {
-                  _acc = 0;
-              }
-              return storage::write(*_appender, batch)
-                .then([this, start_offset, header_size] {
-                    vassert(
-                      _appender->file_byte_offset()
-                        == start_offset + header_size,
-                      "Size must be deterministic. Expected:{} == {}",
-                      _appender->file_byte_offset(),
-                      start_offset + header_size);
-                });
-          });
-      })
-      .then([] { return ss::make_ready_future<stop_t>(stop_t::no); });
+          return write_batch(std::move(b));
+      });
 }
 
 ss::future<ss::stop_iteration>
@@ -255,33 +267,15 @@ copy_data_segment_reducer::operator()(model::record_batch&& b) {
     if (!b.compressed()) {
         return do_compaction(comp, std::move(b));
     }
+    // nothing to filter and the batch is already stored with the target
+    // codec - copy the bytes through untouched
+    if (!_list && _target_compression && comp == *_target_compression) {
+        return write_batch(std::move(b));
+    }
     return decompress_batch(std::move(b))
       .then([comp, this](model::record_batch&& b) {
           return do_compaction(comp, std::move(b));
       });
 }
 
-ss::future<ss::stop_iteration>
-index_rebuilder_reducer::operator()(model::record_batch&& b) {
-    using stop_t = ss::stop_iteration;
-    auto f = ss::now();
-    if (!b.compressed()) {
-        f = do_index(std::move(b));
-    } else {
-        f = internal::decompress_batch(std::move(b))
-              .then([this](model::record_batch&& b) {
-                  return do_index(std::move(b));
-              });
-    }
-    return f.then([] { return ss::make_ready_future<stop_t>(stop_t::no); });
-}
-
-ss::future<> index_rebuilder_reducer::do_index(model::record_batch&& b) {
-    return ss::do_with(std::move(b), [this](model::record_batch& b) {
-        return model::for_each_record(
-          b, [this, o = b.base_offset()](model::record& r) {
-              return _w->index(r.key(), o, r.offset_delta());
-          });
-    });
-}
 } // namespace storage::internal
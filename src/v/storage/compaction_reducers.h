@@ -95,11 +95,19 @@ private:
     compacted_offset_list _list;
 };
 
+/// Copies batches into the appender, optionally dropping records not present
+/// in the compacted offset list and optionally re-encoding every batch with a
+/// target codec. With no offset list the reducer degenerates into a pure
+/// recompression rewrite that keeps every record.
 class copy_data_segment_reducer : public compaction_reducer {
 public:
-    copy_data_segment_reducer(compacted_offset_list l, segment_appender* a)
+    copy_data_segment_reducer(
+      std::optional<compacted_offset_list> l,
+      segment_appender* a,
+      std::optional<model::compression> target_compression = std::nullopt)
       : _list(std::move(l))
-      , _appender(a) {}
+      , _appender(a)
+      , _target_compression(target_compression) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch&&);
     storage::index_state end_of_stream() { return std::move(_idx); }
@@ -108,29 +116,19 @@ private:
     ss::future<ss::stop_iteration>
     do_compaction(model::compression, model::record_batch&&);
 
+    ss::future<ss::stop_iteration> write_batch(model::record_batch&&);
+
     bool should_keep(model::offset base, int32_t delta) const {
         const auto o = base + model::offset(delta);
-        return _list.contains(o);
+        return _list->contains(o);
     }
     std::optional<model::record_batch> filter(model::record_batch&&);
 
-    compacted_offset_list _list;
+    std::optional<compacted_offset_list> _list;
     segment_appender* _appender;
+    std::optional<model::compression> _target_compression;
     index_state _idx;
     size_t _acc{0};
 };
 
-class index_rebuilder_reducer : public compaction_reducer {
-public:
-    explicit index_rebuilder_reducer(compacted_index_writer* w) noexcept
-      : _w(w) {}
-    ss::future<ss::stop_iteration> operator()(model::record_batch&&);
-    void end_of_stream() {}
-
-private:
-    ss::future<> do_index(model::record_batch&&);
-
-    compacted_index_writer* _w;
-};
-
 } // namespace storage::internal
@@ -9,6 +9,7 @@
 
 #include "storage/disk_log_impl.h"
 
+#include "bytes/iobuf_parser.h"
 #include "model/adl_serde.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -20,6 +21,7 @@
 #include "storage/logger.h"
 #include "storage/offset_assignment.h"
 #include "storage/offset_to_filepos_consumer.h"
+#include "storage/scrubber.h"
 #include "storage/segment.h"
 #include "storage/segment_set.h"
 #include "storage/segment_utils.h"
@@ -40,6 +42,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <iterator>
 
 using namespace std::literals::chrono_literals;
@@ -61,6 +64,25 @@ disk_log_impl::disk_log_impl(
         if (is_compacted) {
             s->mark_as_compacted_segment();
         }
+        /*
+         * Restore the scrub state persisted by a previous process. The
+         * stored committed offset and file size must both match the segment
+         * we recovered - a segment that was truncated or rewritten by
+         * compaction since it was scrubbed has to be scrubbed again.
+         */
+        auto scrub = _kvstore.get(
+          kvstore::key_space::storage,
+          internal::crc_scrub_key(config().ntp(), s->offsets().base_offset));
+        if (scrub) {
+            iobuf_parser p(std::move(*scrub));
+            auto committed = reflection::adl<model::offset>{}.from(p);
+            auto file_size = reflection::adl<uint64_t>{}.from(p);
+            if (
+              committed == s->offsets().committed_offset
+              && file_size == s->size_bytes()) {
+                s->mark_as_crc_scrubbed();
+            }
+        }
     }
     _probe.setup_metrics(this->config().ntp());
 }
@@ -71,26 +93,30 @@ disk_log_impl::~disk_log_impl() {
 ss::future<> disk_log_impl::remove() {
     vassert(!_closed, "Invalid double closing of log - {}", *this);
     _closed = true;
-    // gets all the futures started in the background
-    std::vector<ss::future<>> permanent_delete;
-    permanent_delete.reserve(_segs.size());
-    while (!_segs.empty()) {
-        auto s = _segs.back();
-        _segs.pop_back();
-        permanent_delete.emplace_back(
-          remove_segment_permanently(s, "disk_log_impl::remove()"));
-    }
-    // wait for all futures
-    return ss::when_all_succeed(
-             permanent_delete.begin(), permanent_delete.end())
-      .then([this]() {
-          vlog(stlog.info, "Finished removing all segments:{}", config());
-      })
-      .then([this] {
-          return _kvstore.remove(
-            kvstore::key_space::storage,
-            internal::start_offset_key(config().ntp()));
-      });
+    // parked readers pin segments through their leases - release them
+    // before the destructive operations below
+    return evict_cached_readers().then([this] {
+        // gets all the futures started in the background
+        std::vector<ss::future<>> permanent_delete;
+        permanent_delete.reserve(_segs.size());
+        while (!_segs.empty()) {
+            auto s = _segs.back();
+            _segs.pop_back();
+            permanent_delete.emplace_back(
+              remove_segment_permanently(s, "disk_log_impl::remove()"));
+        }
+        // wait for all futures
+        return ss::when_all_succeed(
+                 permanent_delete.begin(), permanent_delete.end())
+          .then([this]() {
+              vlog(stlog.info, "Finished removing all segments:{}", config());
+          })
+          .then([this] {
+              return _kvstore.remove(
+                kvstore::key_space::storage,
+                internal::start_offset_key(config().ntp()));
+          });
+    });
 }
 ss::future<> disk_log_impl::close() {
     vassert(!_closed, "Invalid double closing of log - {}", *this);
@@ -100,10 +126,13 @@ ss::future<> disk_log_impl::close() {
       && !_eviction_monitor->promise.get_future().available()) {
         _eviction_monitor->promise.set_exception(segment_closed_exception());
     }
-    return ss::parallel_for_each(_segs, [](ss::lw_shared_ptr<segment>& h) {
-        return h->close().handle_exception([h](std::exception_ptr e) {
-            vlog(stlog.error, "Error closing segment:{} - {}", e, h);
-        });
+    return evict_cached_readers().then([this] {
+        return ss::parallel_for_each(
+          _segs, [](ss::lw_shared_ptr<segment>& h) {
+              return h->close().handle_exception([h](std::exception_ptr e) {
+                  vlog(stlog.error, "Error closing segment:{} - {}", e, h);
+              });
+          });
     });
 }
 
@@ -201,41 +230,48 @@ ss::future<> disk_log_impl::garbage_collect_segments(
 
     max_offset = std::min(max_offset, _max_collectible_offset);
 
-    return ss::do_until(
-      [this, as, max_offset] {
-          return _segs.size() <= 1 || as->abort_requested()
-                 || _segs.front()->offsets().committed_offset > max_offset;
-      },
-      [this, ctx] {
-          auto ptr = _segs.front();
-          // we have to use std::max in here to prevent start_offset from being
-          // `moved backward`. The _kvstore.put calls may be reordered and we do
-          // not want to update kvstore with stall data. We leverage the fact
-          // that start_offsets updates are monotonically increasing.
-          auto start_offset = std::max(
-            ptr->offsets().dirty_offset + model::offset(1),
-            read_start_offset());
-
-          return _kvstore
-            .put(
-              kvstore::key_space::storage,
-              internal::start_offset_key(config().ntp()),
-              reflection::to_iobuf(start_offset))
-            .then([this, ptr, ctx] {
-                if (!is_front_segment(ptr)) {
-                    return ss::now();
-                }
-                _segs.pop_front();
-                return remove_segment_permanently(ptr, ctx);
-            })
-            .then([this] {
-                // we have to update start offset with the most recent offset as
-                // updates to kv store _start_offset may have been reordered (we
-                // execute then independently from `gc` and `prefix_truncate`
-                // apis)
-                _start_offset = read_start_offset();
-            });
-      });
+    // parked readers hold read locks on the segments they cover and would
+    // stall the segment close below; release the ones positioned over the
+    // prefix being collected and leave the rest parked
+    return evict_cached_readers(model::offset::min(), max_offset)
+      .then([this, as, max_offset, ctx] {
+        return ss::do_until(
+          [this, as, max_offset] {
+              return _segs.size() <= 1 || as->abort_requested()
+                     || _segs.front()->offsets().committed_offset > max_offset;
+          },
+          [this, ctx] {
+              auto ptr = _segs.front();
+              // we have to use std::max in here to prevent start_offset from
+              // being `moved backward`. The _kvstore.put calls may be
+              // reordered and we do not want to update kvstore with stall
+              // data. We leverage the fact that start_offsets updates are
+              // monotonically increasing.
+              auto start_offset = std::max(
+                ptr->offsets().dirty_offset + model::offset(1),
+                read_start_offset());
+
+              return _kvstore
+                .put(
+                  kvstore::key_space::storage,
+                  internal::start_offset_key(config().ntp()),
+                  reflection::to_iobuf(start_offset))
+                .then([this, ptr, ctx] {
+                    if (!is_front_segment(ptr)) {
+                        return ss::now();
+                    }
+                    _segs.pop_front();
+                    return remove_segment_permanently(ptr, ctx);
+                })
+                .then([this] {
+                    // we have to update start offset with the most recent
+                    // offset as updates to kv store _start_offset may have
+                    // been reordered (we execute then independently from
+                    // `gc` and `prefix_truncate` apis)
+                    _start_offset = read_start_offset();
+                });
+          });
+    });
 }
 
 ss::future<> disk_log_impl::garbage_collect_max_partition_size(
@@ -250,7 +286,39 @@ ss::future<> disk_log_impl::garbage_collect_oldest_segments(
     return garbage_collect_segments(max_offset, as, "gc[time_based_retention]");
 }
 
+ss::future<> disk_log_impl::do_recompress(compaction_config cfg) {
+    /*
+     * recompression-only rewrite for non-compacted topics. rolled segments
+     * are rewritten one per housekeeping pass, mirroring the incremental
+     * self compaction schedule
+     */
+    auto segit = std::find_if(
+      _segs.begin(), _segs.end(), [](ss::lw_shared_ptr<segment>& s) {
+          return !s->has_appender() && !s->finished_recompression();
+      });
+    if (segit == _segs.end()) {
+        return ss::now();
+    }
+    auto seg = *segit;
+    // the rewrite swaps file handles under the segment write lock; a reader
+    // parked over this segment would hold it up
+    return evict_cached_readers(
+             seg->offsets().base_offset, seg->offsets().dirty_offset)
+      .then([this, seg, cfg] {
+          return storage::internal::recompress_segment(
+            seg, *cfg.recompression, cfg, _probe);
+      });
+}
+
 ss::future<> disk_log_impl::do_compact(compaction_config cfg) {
+    if (!config().is_compacted()) {
+        /*
+         * topics with a recompression override but no compaction have no
+         * compacted index to consult - rewrite rolled segments through the
+         * keep-everything reducer instead
+         */
+        return do_recompress(cfg);
+    }
     /*
      * single segment compaction
      */
@@ -265,8 +333,16 @@ ss::future<> disk_log_impl::do_compact(compaction_config cfg) {
           seg->offsets().committed_offset);
 
         return f.then([this, seg, cfg]() {
-            return storage::internal::self_compact_segment(seg, cfg, _probe)
-              .finally([seg] { seg->mark_as_finished_self_compaction(); });
+            // release only the parked readers pinning this segment before
+            // the compacted data file is swapped in under its write lock
+            return evict_cached_readers(
+                     seg->offsets().base_offset, seg->offsets().dirty_offset)
+              .then([this, seg, cfg] {
+                  return storage::internal::self_compact_segment(
+                           seg, cfg, _probe)
+                    .finally(
+                      [seg] { seg->mark_as_finished_self_compaction(); });
+              });
         });
     }
 
@@ -290,60 +366,42 @@ disk_log_impl::find_compaction_range() {
         return std::nullopt;
     }
 
-    // sliding window over segments. currently restricted to two segments
-    auto range = std::make_pair(_segs.begin(), std::next(_segs.begin(), 2));
-
-    while (true) {
-        // the simple compaction process in use right now builds a concatenation
-        // of segments so we avoid processing a group that is too large.
-        const auto total_size = std::accumulate(
-          range.first,
-          range.second,
-          size_t(0),
-          [](size_t acc, ss::lw_shared_ptr<segment>& seg) {
-              return acc + seg->size_bytes();
-          });
-
+    /*
+     * sliding window over segments. from every start position grow the
+     * window greedily so that duplicate keys spanning several adjacent
+     * segments are eliminated in one merge instead of cascading pairwise
+     * merges.
+     */
+    for (auto begin = _segs.begin(); std::next(begin) != _segs.end();
+         ++begin) {
         // batches in a segment have a term that is implicitly defined by the
         // name of the file they are contained in. since we need to retain the
-        // term information for reach batch we'll avoid combining segments with
+        // term information for each batch we'll avoid combining segments with
         // different terms. this can be addressed in a later optimization.
-        const auto same_term = std::all_of(
-          range.first,
-          range.second,
-          [term = (*range.first)->offsets().term](
-            ss::lw_shared_ptr<segment>& seg) {
-              return seg->offsets().term == term;
-          });
-
-        // found a good range if all the tests pass
-        if (
-          same_term
-          && total_size < _manager.config().max_compacted_segment_size) {
-            break;
+        const auto term = (*begin)->offsets().term;
+        // segments in the window all need to be stable
+        if ((*begin)->has_appender()) {
+            continue;
         }
-
-        // no candidate range found, yet. advance the window if we aren't
-        // already at the end of the set. one option would also be to shrink the
-        // range from the lower end if the range is large enough. advanced
-        // scheduling is future work.
-        if (range.second == _segs.end()) {
-            return std::nullopt;
+        auto total_size = (*begin)->size_bytes();
+        auto end = std::next(begin);
+        size_t count = 1;
+        while (end != _segs.end() && count < max_adjacent_merge_segments
+               && (*end)->offsets().term == term && !(*end)->has_appender()
+               && total_size + (*end)->size_bytes()
+                    < _manager.config().max_compacted_segment_size) {
+            // the compaction process builds a concatenation of the window,
+            // so its combined size stays under the compacted segment ceiling
+            total_size += (*end)->size_bytes();
+            ++end;
+            ++count;
+        }
+        if (count >= 2) {
+            return std::make_pair(begin, end);
         }
-        ++range.first;
-        ++range.second;
-    }
-
-    // the chosen segments all need to be stable
-    const auto unstable = std::any_of(
-      range.first, range.second, [](ss::lw_shared_ptr<segment>& seg) {
-          return seg->has_appender();
-      });
-    if (unstable) {
-        return std::nullopt;
     }
 
-    return range;
+    return std::nullopt;
 }
 
 ss::future<> disk_log_impl::compact_adjacent_segments(
@@ -403,6 +461,11 @@ ss::future<> disk_log_impl::compact_adjacent_segments(
     // copying and compaction i/o occurred above with no locks held. 5 retries
     // with a max lock timeout of 1 second. if we don't get the locks there is
     // probably a reader. compaction will revisit.
+    // release parked readers pinning this range first - their read locks
+    // would otherwise make every adjacent compaction time out and revisit
+    co_await evict_cached_readers(
+      segments.front()->offsets().base_offset,
+      segments.back()->offsets().dirty_offset);
     auto locks = co_await internal::write_lock_segments(segments, 1s, 5);
 
     // fast check if we should abandon all the expensive i/o work if we happened
@@ -422,20 +485,24 @@ ss::future<> disk_log_impl::compact_adjacent_segments(
     // this could occur if racing with functions like truncate which manipulate
     // the segment set before acquiring segment locks. this also means that the
     // input iterator range may not longer be valid so we must manually search
-    // the segment set.  the current adjacent segment compaction limits
-    // compaction to two segments, and we check that assumption here and use
-    // simplified clean-up routine.
+    // the segment set for every segment that was merged into the target.
     locks.clear();
-    vassert(segments.size() == 2, "Cannot compact more than two segments");
-    auto it = std::find(_segs.begin(), _segs.end(), segments.back());
-    if (it != _segs.end()) {
-        _segs.erase(it, std::next(it));
-        co_await remove_segment_permanently(
-          segments.back(), "compact_adjacent_segments");
+    for (auto merged = std::next(segments.begin()); merged != segments.end();
+         ++merged) {
+        auto it = std::find(_segs.begin(), _segs.end(), *merged);
+        if (it != _segs.end()) {
+            _segs.erase(it, std::next(it));
+            co_await remove_segment_permanently(
+              *merged, "compact_adjacent_segments");
+        }
     }
 }
 
 ss::future<> disk_log_impl::compact(compaction_config cfg) {
+    // each destructive path below evicts only the parked readers pinning
+    // the segments it actually touches; readers parked elsewhere in the log
+    // ride out the housekeeping pass undisturbed
+    cfg.recompression = config().recompression();
     ss::future<> f = ss::now();
     if (config().is_collectable()) {
         f = gc(cfg);
@@ -449,7 +516,7 @@ ss::future<> disk_log_impl::compact(compaction_config cfg) {
         // have this set
         f = ss::now();
     }
-    if (config().is_compacted() && !_segs.empty()) {
+    if ((config().is_compacted() || cfg.recompression) && !_segs.empty()) {
         f = f.then([this, cfg] { return do_compact(cfg); });
     }
     return f;
@@ -608,6 +675,103 @@ ss::future<> disk_log_impl::flush() {
     return _segs.back()->flush();
 }
 
+size_t disk_log_impl::compaction_backlog(
+  model::timestamp collection_threshold) const {
+    size_t backlog = 0;
+    auto collectable = config().is_collectable();
+    if (unlikely(
+          config().has_overrides()
+          && config().get_overrides().cleanup_policy_bitflags
+               == model::cleanup_policy_bitflags::none)) {
+        // collection is prevented entirely, see compact()
+        collectable = false;
+    }
+    for (const auto& s : _segs) {
+        if (collectable && s->index().max_timestamp() < collection_threshold) {
+            backlog += s->size_bytes();
+            continue;
+        }
+        if (
+          config().is_compacted() && !s->has_appender()
+          && s->is_compacted_segment() && !s->finished_self_compaction()) {
+            backlog += s->size_bytes();
+        }
+    }
+    return backlog;
+}
+
+ss::future<> disk_log_impl::hibernate() {
+    vassert(!_closed, "hibernate on closed log - {}", *this);
+    // an idle log has no fetch stream worth keeping armed
+    auto f = evict_cached_readers();
+    if (!_segs.empty() && _segs.back()->has_appender()) {
+        f = f.then([this] { return _segs.back()->release_appender(); });
+    }
+    return f.then([this] {
+        for (auto& s : _segs) {
+            s->index().shrink_to_fit();
+        }
+    });
+}
+
+ss::future<size_t> disk_log_impl::scrub(scrub_config cfg) {
+    vassert(!_closed, "scrub on closed log - {}", *this);
+    // oldest first - cold segments go the longest without their checksums
+    // being exercised by reads. the shared pointers keep the segments alive
+    // across scheduling points, scrub_segment itself takes the read lock
+    // and skips segments closed in the meantime
+    std::vector<ss::lw_shared_ptr<segment>> candidates;
+    for (auto& s : _segs) {
+        if (!s->has_appender() && !s->is_crc_scrubbed() && !s->empty()) {
+            candidates.push_back(s);
+        }
+    }
+    return ss::do_with(
+      std::move(candidates),
+      size_t{0},
+      [this, cfg](
+        std::vector<ss::lw_shared_ptr<segment>>& candidates,
+        size_t& bytes_read) {
+          return ss::do_for_each(
+                   candidates,
+                   [this, cfg, &bytes_read](ss::lw_shared_ptr<segment>& s) {
+                       if (
+                         bytes_read >= cfg.read_bytes_budget
+                         || cfg.asrc->abort_requested()) {
+                           return ss::now();
+                       }
+                       return internal::scrub_segment(s, cfg).then(
+                         [this, s, &bytes_read](internal::scrub_result r) {
+                             bytes_read += r.bytes_read;
+                             if (!r.clean) {
+                                 vlog(
+                                   stlog.error,
+                                   "scrub failed, segment stays on the "
+                                   "verifying read path: {}",
+                                   s);
+                                 return ss::now();
+                             }
+                             if (s->is_closed() || s->has_appender()) {
+                                 return ss::now();
+                             }
+                             s->mark_as_crc_scrubbed();
+                             iobuf value;
+                             reflection::serialize(
+                               value,
+                               s->offsets().committed_offset,
+                               uint64_t(s->size_bytes()),
+                               model::timestamp::now());
+                             return _kvstore.put(
+                               kvstore::key_space::storage,
+                               internal::crc_scrub_key(
+                                 config().ntp(), s->offsets().base_offset),
+                               std::move(value));
+                         });
+                   })
+            .then([&bytes_read] { return bytes_read; });
+      });
+}
+
 size_t disk_log_impl::max_segment_size() const {
     // override for segment size
     if (config().has_overrides() && config().get_overrides().segment_size) {
@@ -682,6 +846,115 @@ disk_log_impl::make_unchecked_reader(log_reader_config config) {
       });
 }
 
+/*
+ * wraps a log_reader used on the fetch path so that a reader which drained
+ * cleanly returns to the disk_log_impl reader cache when the consumer is
+ * done with it, instead of being torn down. the next sequential fetch then
+ * skips the range lock and segment reader setup entirely.
+ */
+class cached_log_reader final : public model::record_batch_reader::impl {
+public:
+    using storage_t = model::record_batch_reader::storage_t;
+
+    cached_log_reader(
+      std::unique_ptr<log_reader> reader,
+      disk_log_impl* log,
+      size_t readahead) noexcept
+      : _reader(std::move(reader))
+      , _log(log) {
+        // readahead is driven from this wrapper. the inner reader's
+        // do_load_slice is called directly so its own window never engages
+        enable_readahead(readahead);
+    }
+
+    bool is_end_of_stream() const final { return _reader->is_end_of_stream(); }
+
+    ss::future<storage_t>
+    do_load_slice(model::timeout_clock::time_point timeout) final {
+        return _reader->do_load_slice(timeout);
+    }
+
+    void print(std::ostream& os) final { _reader->print(os); }
+
+    ss::future<> finally() noexcept final {
+        if (is_slice_empty() && no_more_slices()) {
+            // every batch produced was handed to the consumer, so the
+            // reader position matches exactly what the consumer saw and a
+            // follow up fetch can continue from it
+            return _log->park_reader(std::move(_reader));
+        }
+        // the consumer stopped mid-slice; the reader is ahead of what was
+        // consumed and cannot be resumed
+        auto raw = _reader.get();
+        return raw->finally().finally([r = std::move(_reader)] {});
+    }
+
+private:
+    std::unique_ptr<log_reader> _reader;
+    disk_log_impl* _log;
+};
+
+std::optional<model::record_batch_reader>
+disk_log_impl::get_cached_reader(const log_reader_config& config) {
+    auto it = std::find_if(
+      _reader_cache.begin(),
+      _reader_cache.end(),
+      [&config](const std::unique_ptr<log_reader>& r) {
+          return r->next_read() == config.start_offset && r->is_reusable();
+      });
+    if (it == _reader_cache.end()) {
+        return std::nullopt;
+    }
+    auto reader = std::move(*it);
+    _reader_cache.erase(it);
+    reader->reset_config(config);
+    return model::record_batch_reader(std::make_unique<cached_log_reader>(
+      std::move(reader), this, config.readahead_bytes));
+}
+
+ss::future<> disk_log_impl::park_reader(std::unique_ptr<log_reader> reader) {
+    if (
+      !_closed && reader->is_reusable()
+      && _reader_cache.size() < max_cached_readers) {
+        _reader_cache.push_back(std::move(reader));
+        return ss::make_ready_future<>();
+    }
+    auto raw = reader.get();
+    return raw->finally().finally([r = std::move(reader)] {});
+}
+
+ss::future<> disk_log_impl::evict_cached_readers() {
+    return evict_cached_readers(model::offset::min(), model::offset::max());
+}
+
+ss::future<>
+disk_log_impl::evict_cached_readers(model::offset begin, model::offset end) {
+    if (_reader_cache.empty()) {
+        return ss::make_ready_future<>();
+    }
+    auto overlapping = std::stable_partition(
+      _reader_cache.begin(),
+      _reader_cache.end(),
+      [begin, end](const std::unique_ptr<log_reader>& r) {
+          return !r->lease_overlaps(begin, end);
+      });
+    if (overlapping == _reader_cache.end()) {
+        return ss::make_ready_future<>();
+    }
+    std::vector<std::unique_ptr<log_reader>> evicted;
+    evicted.reserve(std::distance(overlapping, _reader_cache.end()));
+    std::move(
+      overlapping, _reader_cache.end(), std::back_inserter(evicted));
+    _reader_cache.erase(overlapping, _reader_cache.end());
+    return ss::do_with(
+      std::move(evicted),
+      [](std::vector<std::unique_ptr<log_reader>>& readers) {
+          return ss::parallel_for_each(
+            readers,
+            [](std::unique_ptr<log_reader>& r) { return r->finally(); });
+      });
+}
+
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(log_reader_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
@@ -692,7 +965,18 @@ disk_log_impl::make_reader(log_reader_config config) {
             config.start_offset,
             _start_offset)));
     }
-    return make_unchecked_reader(config);
+    if (auto cached = get_cached_reader(config)) {
+        return ss::make_ready_future<model::record_batch_reader>(
+          std::move(*cached));
+    }
+    return _lock_mngr.range_lock(config).then(
+      [this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
+          return model::record_batch_reader(
+            std::make_unique<cached_log_reader>(
+              std::make_unique<log_reader>(std::move(lease), cfg, _probe),
+              this,
+              cfg.readahead_bytes));
+      });
 }
 
 ss::future<model::record_batch_reader>
@@ -702,9 +986,19 @@ disk_log_impl::make_reader(timequery_config config) {
       [this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
           auto start_offset = _start_offset;
           if (!lease->range.empty()) {
+              auto& first = *lease->range.begin();
               // adjust for partial visibility of segment prefix
               start_offset = std::max(
-                start_offset, (*lease->range.begin())->offsets().base_offset);
+                start_offset, first->offsets().base_offset);
+              /*
+               * consult the sparse time index to skip the prefix of the
+               * segment that is entirely below the queried timestamp,
+               * instead of scanning (and caching) every batch from the
+               * segment base.
+               */
+              if (auto e = first->index().find_nearest(cfg.time)) {
+                  start_offset = std::max(start_offset, e->offset);
+              }
           }
           log_reader_config config(
             start_offset,
@@ -771,6 +1065,12 @@ ss::future<> disk_log_impl::remove_segment_permanently(
       .handle_exception([s](std::exception_ptr e) {
           vlog(stlog.error, "Cannot close segment: {} - {}", e, s);
       })
+      .then([this, s] {
+          // drop the persisted scrub state along with the segment
+          return _kvstore.remove(
+            kvstore::key_space::storage,
+            internal::crc_scrub_key(config().ntp(), s->offsets().base_offset));
+      })
       .finally([s] {});
 }
 
@@ -803,10 +1103,14 @@ disk_log_impl::remove_prefix_full_segments(truncate_prefix_config cfg) {
 
 ss::future<> disk_log_impl::truncate_prefix(truncate_prefix_config cfg) {
     vassert(!_closed, "truncate_prefix() on closed log - {}", *this);
-    return _failure_probes.truncate_prefix().then([this, cfg]() mutable {
-        // dispatch the actual truncation
-        return do_truncate_prefix(cfg);
-    });
+    return finjector::maybe_inject(
+      [this] { return _failure_probes.truncate_prefix(); },
+      [this, cfg]() mutable {
+          // parked readers pin segments through their leases; only those
+          // positioned over the prefix being removed need to go
+          return evict_cached_readers(model::offset::min(), cfg.start_offset)
+            .then([this, cfg] { return do_truncate_prefix(cfg); });
+      });
 }
 
 ss::future<> disk_log_impl::do_truncate_prefix(truncate_prefix_config cfg) {
@@ -876,10 +1180,16 @@ ss::future<> disk_log_impl::do_truncate_prefix(truncate_prefix_config cfg) {
 
 ss::future<> disk_log_impl::truncate(truncate_config cfg) {
     vassert(!_closed, "truncate() on closed log - {}", *this);
-    return _failure_probes.truncate().then([this, cfg]() mutable {
-        // dispatch the actual truncation
-        return do_truncate(cfg);
-    });
+    return finjector::maybe_inject(
+      [this] { return _failure_probes.truncate(); },
+      [this, cfg]() mutable {
+          // parked readers hold read locks on the segments that truncation
+          // modifies under the write lock, and their position may no longer
+          // exist afterwards. readers over the surviving prefix are
+          // untouched
+          return evict_cached_readers(cfg.base_offset, model::offset::max())
+            .then([this, cfg] { return do_truncate(cfg); });
+      });
 }
 
 ss::future<> disk_log_impl::do_truncate(truncate_config cfg) {
@@ -30,6 +30,8 @@
 
 namespace storage {
 
+class cached_log_reader;
+
 class disk_log_impl final : public log::impl {
 public:
     using failure_probes = storage::log_failure_probes;
@@ -44,6 +46,9 @@ public:
     ss::future<> close() final;
     ss::future<> remove() final;
     ss::future<> flush() final;
+    ss::future<> hibernate() final;
+    ss::future<size_t> scrub(scrub_config) final;
+    size_t compaction_backlog(model::timestamp) const final;
     ss::future<> truncate(truncate_config) final;
     ss::future<> truncate_prefix(truncate_prefix_config) final;
     ss::future<> compact(compaction_config) final;
@@ -59,6 +64,7 @@ public:
     ss::future<std::optional<timequery_result>>
     timequery(timequery_config cfg) final;
     size_t segment_count() const final { return _segs.size(); }
+    size_t reader_cache_size() const { return _reader_cache.size(); }
     offset_stats offsets() const final;
     std::optional<model::term_id> get_term(model::offset) const final;
     std::ostream& print(std::ostream&) const final;
@@ -79,14 +85,34 @@ public:
 private:
     friend class disk_log_appender; // for multi-term appends
     friend class disk_log_builder;  // for tests
+    friend class cached_log_reader; // for parking drained readers
     friend std::ostream& operator<<(std::ostream& o, const disk_log_impl& d);
 
     ss::future<model::record_batch_reader>
       make_unchecked_reader(log_reader_config);
 
+    // most fetches are a consumer polling from exactly where its previous
+    // read ended, so drained readers are parked here keyed by their next
+    // offset instead of being torn down. parked readers hold the read locks
+    // of their lease - destructive operations must evict them first
+    static constexpr size_t max_cached_readers = 8;
+    std::optional<model::record_batch_reader>
+    get_cached_reader(const log_reader_config&);
+    ss::future<> park_reader(std::unique_ptr<log_reader>);
+    ss::future<> evict_cached_readers();
+    // evict only the parked readers whose lease pins a segment intersecting
+    // [begin, end]; readers parked over other parts of the log keep their
+    // read locks and stay reusable
+    ss::future<> evict_cached_readers(model::offset begin, model::offset end);
+
     model::offset read_start_offset() const;
 
+    // upper bound on the window merged by a single adjacent segment
+    // compaction, keeping the amount of data rewritten per pass bounded
+    static constexpr size_t max_adjacent_merge_segments = 8;
+
     ss::future<> do_compact(compaction_config);
+    ss::future<> do_recompress(compaction_config);
     ss::future<> compact_adjacent_segments(
       std::pair<segment_set::iterator, segment_set::iterator>,
       storage::compaction_config cfg);
@@ -139,6 +165,7 @@ private:
     std::optional<eviction_monitor> _eviction_monitor;
     model::offset _max_collectible_offset;
     size_t _max_segment_size;
+    std::vector<std::unique_ptr<log_reader>> _reader_cache;
 };
 
 } // namespace storage
@@ -50,27 +50,27 @@ public:
     }
 
     ss::future<> append() {
-        if (is_enabled()) {
+        if constexpr (is_active()) {
             return inject_method_failure(methods::append, "append");
         }
         return ss::make_ready_future<>();
     }
 
     ss::future<> roll() {
-        if (is_enabled()) {
+        if constexpr (is_active()) {
             return inject_method_failure(methods::roll, "roll");
         }
         return ss::make_ready_future<>();
     }
 
     ss::future<> truncate() {
-        if (is_enabled()) {
+        if constexpr (is_active()) {
             return inject_method_failure(methods::truncate, "truncate");
         }
         return ss::make_ready_future<>();
     }
     ss::future<> truncate_prefix() {
-        if (is_enabled()) {
+        if constexpr (is_active()) {
             return inject_method_failure(
               methods::truncate_prefix, "truncate_prefix");
         }
@@ -117,7 +117,7 @@ public:
     std::vector<ss::sstring> points() final { return {"consume"}; }
 
     ss::future<> consume() {
-        if (is_enabled()) {
+        if constexpr (is_active()) {
             return do_consume();
         }
         return ss::make_ready_future<>();
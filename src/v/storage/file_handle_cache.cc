@@ -0,0 +1,175 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/file_handle_cache.h"
+
+#include "storage/logger.h"
+#include "vassert.h"
+#include "vlog.h"
+
+#include <seastar/core/reactor.hh>
+
+namespace storage::internal {
+
+cached_file_impl::cached_file_impl(
+  ss::sstring filename,
+  ss::open_flags flags,
+  ss::file_open_options options,
+  file_handle_cache& cache)
+  : _filename(std::move(filename))
+  , _flags(flags)
+  , _options(options)
+  , _cache(cache) {}
+
+cached_file_impl::~cached_file_impl() {
+    _cache.remove(*this);
+    if (_file) {
+        auto fd = std::move(*_file);
+        _file.reset();
+        // segment_reader always close()es before dropping the file, so
+        // this is a backstop; the capture keeps the kernel handle alive
+        // until the close completes
+        (void)fd.close().finally([fd] {});
+    }
+}
+
+ss::future<> cached_file_impl::ensure_open() {
+    if (_file) {
+        _cache.touch(*this);
+        return ss::make_ready_future<>();
+    }
+    return ss::with_semaphore(_open_lock, 1, [this] {
+        if (_file) {
+            return ss::make_ready_future<>();
+        }
+        return ss::open_file_dma(_filename, _flags, _options)
+          .then([this](ss::file f) {
+              _file = std::move(f);
+              _cache.note_open(*this);
+          });
+    });
+}
+
+bool cached_file_impl::try_evict() {
+    if (!_file || _ops_in_flight > 0) {
+        return false;
+    }
+    auto fd = std::move(*_file);
+    _file.reset();
+    _cache.remove(*this);
+    // fire and forget; a reopen of the same path while this close is in
+    // flight gets an independent handle, which is safe for ro files
+    (void)fd.close()
+      .handle_exception([name = _filename](std::exception_ptr e) {
+          vlog(stlog.warn, "error closing idle handle {} - {}", name, e);
+      })
+      .finally([fd] {});
+    return true;
+}
+
+ss::future<size_t> cached_file_impl::write_dma(
+  uint64_t pos,
+  const void* buffer,
+  size_t len,
+  const ss::io_priority_class& pc) {
+    return with_file([this, pos, buffer, len, pc] {
+        return get_file_impl(*_file)->write_dma(pos, buffer, len, pc);
+    });
+}
+
+ss::future<size_t> cached_file_impl::write_dma(
+  uint64_t pos, std::vector<iovec> iov, const ss::io_priority_class& pc) {
+    return with_file([this, pos, iov = std::move(iov), pc]() mutable {
+        return get_file_impl(*_file)->write_dma(pos, std::move(iov), pc);
+    });
+}
+
+ss::future<size_t> cached_file_impl::read_dma(
+  uint64_t pos, void* buffer, size_t len, const ss::io_priority_class& pc) {
+    return with_file([this, pos, buffer, len, pc] {
+        return get_file_impl(*_file)->read_dma(pos, buffer, len, pc);
+    });
+}
+
+ss::future<size_t> cached_file_impl::read_dma(
+  uint64_t pos, std::vector<iovec> iov, const ss::io_priority_class& pc) {
+    return with_file([this, pos, iov = std::move(iov), pc]() mutable {
+        return get_file_impl(*_file)->read_dma(pos, std::move(iov), pc);
+    });
+}
+
+ss::future<> cached_file_impl::flush() {
+    return with_file([this] { return get_file_impl(*_file)->flush(); });
+}
+
+ss::future<struct stat> cached_file_impl::stat() {
+    return with_file([this] { return get_file_impl(*_file)->stat(); });
+}
+
+ss::future<> cached_file_impl::truncate(uint64_t length) {
+    return with_file(
+      [this, length] { return get_file_impl(*_file)->truncate(length); });
+}
+
+ss::future<> cached_file_impl::discard(uint64_t offset, uint64_t length) {
+    return with_file([this, offset, length] {
+        return get_file_impl(*_file)->discard(offset, length);
+    });
+}
+
+ss::future<> cached_file_impl::allocate(uint64_t position, uint64_t length) {
+    return with_file([this, position, length] {
+        return get_file_impl(*_file)->allocate(position, length);
+    });
+}
+
+ss::future<uint64_t> cached_file_impl::size() {
+    return with_file([this] { return get_file_impl(*_file)->size(); });
+}
+
+ss::future<> cached_file_impl::close() {
+    _cache.remove(*this);
+    if (!_file) {
+        return ss::make_ready_future<>();
+    }
+    auto fd = std::move(*_file);
+    _file.reset();
+    return fd.close().finally([fd] {});
+}
+
+std::unique_ptr<ss::file_handle_impl> cached_file_impl::dup() {
+    vassert(_file, "dup() called on cold cached handle {}", _filename);
+    return get_file_impl(*_file)->dup();
+}
+
+ss::subscription<ss::directory_entry> cached_file_impl::list_directory(
+  std::function<ss::future<>(ss::directory_entry de)> next) {
+    vassert(
+      _file, "list_directory() called on cold cached handle {}", _filename);
+    return get_file_impl(*_file)->list_directory(std::move(next));
+}
+
+ss::future<ss::temporary_buffer<uint8_t>> cached_file_impl::dma_read_bulk(
+  uint64_t offset, size_t range_size, const ss::io_priority_class& pc) {
+    return with_file([this, offset, range_size, pc] {
+        return get_file_impl(*_file)->dma_read_bulk(offset, range_size, pc);
+    });
+}
+
+void file_handle_cache::maybe_evict() {
+    auto it = _lru.begin();
+    while (_open > _capacity && it != _lru.end()) {
+        auto& h = *it;
+        // advance before try_evict unlinks the current handle
+        ++it;
+        h.try_evict();
+    }
+}
+
+} // namespace storage::internal
@@ -0,0 +1,171 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/semaphore.hh>
+#include <seastar/core/shared_ptr.hh>
+
+#include <boost/intrusive/list.hpp>
+
+#include <optional>
+
+namespace storage::internal {
+
+class file_handle_cache;
+
+/**
+ * A file whose kernel handle materializes on first use. Until an
+ * operation arrives the wrapper holds only the path, so a node with
+ * 100k sealed segments pays no open() storm at startup and no standing
+ * fd cost for cold logs. Once open the handle registers with the
+ * shard's file_handle_cache; when the cache is over capacity the least
+ * recently used idle handle is closed and the next operation on it
+ * reopens transparently. Operations in flight pin the handle - it is
+ * never evicted under an active read.
+ *
+ * dup() and list_directory() are only served while the handle is open;
+ * neither is used on segment data files.
+ */
+class cached_file_impl final
+  : public ss::file_impl
+  , public boost::intrusive::list_base_hook<
+      boost::intrusive::link_mode<boost::intrusive::auto_unlink>> {
+public:
+    cached_file_impl(
+      ss::sstring filename,
+      ss::open_flags flags,
+      ss::file_open_options options,
+      file_handle_cache& cache);
+    cached_file_impl(const cached_file_impl&) = delete;
+    cached_file_impl& operator=(const cached_file_impl&) = delete;
+    cached_file_impl(cached_file_impl&&) noexcept = delete;
+    cached_file_impl& operator=(cached_file_impl&&) noexcept = delete;
+    ~cached_file_impl() override;
+
+    ss::future<size_t> write_dma(
+      uint64_t pos,
+      const void* buffer,
+      size_t len,
+      const ss::io_priority_class& pc) final;
+    ss::future<size_t> write_dma(
+      uint64_t pos,
+      std::vector<iovec> iov,
+      const ss::io_priority_class& pc) final;
+    ss::future<size_t> read_dma(
+      uint64_t pos,
+      void* buffer,
+      size_t len,
+      const ss::io_priority_class& pc) final;
+    ss::future<size_t> read_dma(
+      uint64_t pos,
+      std::vector<iovec> iov,
+      const ss::io_priority_class& pc) final;
+    ss::future<> flush() final;
+    ss::future<struct stat> stat() final;
+    ss::future<> truncate(uint64_t length) final;
+    ss::future<> discard(uint64_t offset, uint64_t length) final;
+    ss::future<> allocate(uint64_t position, uint64_t length) final;
+    ss::future<uint64_t> size() final;
+    ss::future<> close() final;
+    std::unique_ptr<ss::file_handle_impl> dup() final;
+    ss::subscription<ss::directory_entry> list_directory(
+      std::function<ss::future<>(ss::directory_entry de)> next) final;
+    ss::future<ss::temporary_buffer<uint8_t>> dma_read_bulk(
+      uint64_t offset,
+      size_t range_size,
+      const ss::io_priority_class& pc) final;
+
+    const ss::sstring& filename() const { return _filename; }
+    bool is_open() const { return _file.has_value(); }
+
+private:
+    friend class file_handle_cache;
+
+    /// opens the underlying file if needed and bumps it to most
+    /// recently used
+    ss::future<> ensure_open();
+    /// closes the underlying handle if idle; returns whether it did
+    bool try_evict();
+
+    template<typename Func>
+    auto with_file(Func f) {
+        // pin before opening so the handle cannot be evicted between
+        // the open resolving and the operation starting
+        ++_ops_in_flight;
+        return ensure_open()
+          .then([this, f = std::move(f)]() mutable { return f(); })
+          .finally([this] { --_ops_in_flight; });
+    }
+
+    ss::sstring _filename;
+    ss::open_flags _flags;
+    ss::file_open_options _options;
+    file_handle_cache& _cache;
+    std::optional<ss::file> _file;
+    // serializes concurrent first-use opens of a cold handle
+    ss::semaphore _open_lock{1};
+    size_t _ops_in_flight{0};
+};
+
+/**
+ * Bounded per-shard LRU of open cached_file_impl handles. Above
+ * capacity the coldest idle handle is closed; its owner stays valid and
+ * reopens on the next operation. The bound is per shard - size the
+ * configured capacity accordingly against the process fd limit.
+ */
+class file_handle_cache {
+public:
+    static constexpr size_t default_capacity = 4096;
+
+    size_t open_handles() const { return _open; }
+    size_t capacity() const { return _capacity; }
+    void set_capacity(size_t c) {
+        _capacity = c;
+        maybe_evict();
+    }
+
+private:
+    friend class cached_file_impl;
+
+    void note_open(cached_file_impl& h) {
+        _lru.push_back(h);
+        ++_open;
+        maybe_evict();
+    }
+    void touch(cached_file_impl& h) {
+        h.unlink();
+        _lru.push_back(h);
+    }
+    void remove(cached_file_impl& h) {
+        if (h.is_linked()) {
+            h.unlink();
+            --_open;
+        }
+    }
+    void maybe_evict();
+
+    boost::intrusive::
+      list<cached_file_impl, boost::intrusive::constant_time_size<false>>
+        _lru;
+    size_t _capacity{default_capacity};
+    size_t _open{0};
+};
+
+inline file_handle_cache& file_handles() {
+    static thread_local file_handle_cache cache;
+    return cache;
+}
+
+} // namespace storage::internal
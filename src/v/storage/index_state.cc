@@ -20,10 +20,47 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <cstring>
 #include <optional>
 
 namespace storage {
 
+/*
+ * The three index arrays are stored as packed little endian uint32_t spans,
+ * which is also their exact in-memory layout on every supported platform.
+ * That lets hydration, serialization and checksumming move whole spans at a
+ * time instead of decoding entry-by-entry, keeping segment open time flat as
+ * index density grows.
+ */
+
+static void serialize_span(iobuf& out, const std::vector<uint32_t>& v) {
+    // NOLINTNEXTLINE
+    out.append(
+      reinterpret_cast<const char*>(v.data()), v.size() * sizeof(uint32_t));
+}
+
+static std::vector<uint32_t> hydrate_span(iobuf_parser& parser, size_t vsize) {
+    std::vector<uint32_t> v(vsize);
+    // NOLINTNEXTLINE
+    auto* dst = reinterpret_cast<char*>(v.data());
+    parser.consume(
+      vsize * sizeof(uint32_t), [&dst](const char* src, size_t n) {
+          std::memcpy(dst, src, n);
+          dst += n; // NOLINT
+          return ss::stop_iteration::no;
+      });
+    return v;
+}
+
+static void
+checksum_span(incremental_xxhash64& xx, const std::vector<uint32_t>& v) {
+    // identical digest to hashing every element: the stream is a
+    // concatenation either way
+    // NOLINTNEXTLINE
+    xx.update(
+      reinterpret_cast<const char*>(v.data()), v.size() * sizeof(uint32_t));
+}
+
 uint64_t index_state::checksum_state(const index_state& r) {
     auto xx = incremental_xxhash64{};
     xx.update_all(
@@ -33,16 +70,9 @@ uint64_t index_state::checksum_state(const index_state& r) {
       r.base_timestamp(),
       r.max_timestamp(),
       uint32_t(r.relative_offset_index.size()));
-    const uint32_t vsize = r.relative_offset_index.size();
-    for (auto i = 0U; i < vsize; ++i) {
-        xx.update(r.relative_offset_index[i]);
-    }
-    for (auto i = 0U; i < vsize; ++i) {
-        xx.update(r.relative_time_index[i]);
-    }
-    for (auto i = 0U; i < vsize; ++i) {
-        xx.update(r.position_index[i]);
-    }
+    checksum_span(xx, r.relative_offset_index);
+    checksum_span(xx, r.relative_time_index);
+    checksum_span(xx, r.position_index);
     return xx.digest();
 }
 bool index_state::maybe_index(
@@ -150,21 +180,9 @@ std::optional<index_state> index_state::hydrate_from_buffer(iobuf b) {
 
     const uint32_t vsize = ss::le_to_cpu(
       reflection::adl<uint32_t>{}.from(parser));
-    retval.relative_offset_index.reserve(vsize);
-    retval.relative_time_index.reserve(vsize);
-    retval.position_index.reserve(vsize);
-    for (auto i = 0U; i < vsize; ++i) {
-        retval.relative_offset_index.push_back(
-          reflection::adl<uint32_t>{}.from(parser));
-    }
-    for (auto i = 0U; i < vsize; ++i) {
-        retval.relative_time_index.push_back(
-          reflection::adl<uint32_t>{}.from(parser));
-    }
-    for (auto i = 0U; i < vsize; ++i) {
-        retval.position_index.push_back(
-          reflection::adl<uint32_t>{}.from(parser));
-    }
+    retval.relative_offset_index = hydrate_span(parser, vsize);
+    retval.relative_time_index = hydrate_span(parser, vsize);
+    retval.position_index = hydrate_span(parser, vsize);
     const auto computed_checksum = storage::index_state::checksum_state(retval);
     if (unlikely(retval.checksum != computed_checksum)) {
         vlog(
@@ -206,16 +224,9 @@ iobuf index_state::checksum_and_serialize() {
       base_timestamp(),
       max_timestamp(),
       uint32_t(relative_offset_index.size()));
-    const uint32_t vsize = relative_offset_index.size();
-    for (auto i = 0U; i < vsize; ++i) {
-        reflection::adl<uint32_t>{}.to(out, relative_offset_index[i]);
-    }
-    for (auto i = 0U; i < vsize; ++i) {
-        reflection::adl<uint32_t>{}.to(out, relative_time_index[i]);
-    }
-    for (auto i = 0U; i < vsize; ++i) {
-        reflection::adl<uint32_t>{}.to(out, position_index[i]);
-    }
+    serialize_span(out, relative_offset_index);
+    serialize_span(out, relative_time_index);
+    serialize_span(out, position_index);
     // add back the version and size field
     const auto expected_size = size + sizeof(int8_t) + sizeof(uint32_t);
     vassert(
@@ -76,6 +76,13 @@ struct index_state {
         relative_time_index.pop_back();
         position_index.pop_back();
     }
+    // drop the capacity slack left by push_back growth, used when a
+    // segment goes idle
+    void shrink_to_fit() {
+        relative_offset_index.shrink_to_fit();
+        relative_time_index.shrink_to_fit();
+        position_index.shrink_to_fit();
+    }
     std::tuple<uint32_t, uint32_t, uint32_t> get_entry(size_t i) {
         return {
           relative_offset_index[i], relative_time_index[i], position_index[i]};
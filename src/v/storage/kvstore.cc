@@ -277,15 +277,22 @@ ss::future<> kvstore::roll() {
         // cleaned-up segment.
         auto seg = std::exchange(_segment, nullptr);
         return seg->close()
-          .then([this] { return save_snapshot(); })
-          .then([seg] {
-              vlog(
-                lg.debug,
-                "Removing old segment with base offset {}",
-                seg->offsets().base_offset);
-              return ss::remove_file(seg->reader().filename()).then([seg] {
-                  return ss::remove_file(seg->index().filename());
-              });
+          .then([this, seg] {
+              /*
+               * the sealed segment already holds every operation since the
+               * last snapshot in durable form, so re-serializing the whole
+               * database on each roll is pure write amplification. defer the
+               * full snapshot (and the gc it enables) until enough segments
+               * accumulate; recovery replays the retained segments on top of
+               * the last snapshot.
+               */
+              _sealed_segments.push_back(seg);
+              if (
+                _sealed_segments.size() < _conf.snapshot_interval_segments) {
+                  return ss::now();
+              }
+              return save_snapshot().then(
+                [this] { return gc_sealed_segments(); });
           })
           .then([this] {
               return make_segment(
@@ -306,6 +313,22 @@ ss::future<> kvstore::roll() {
     return ss::now();
 }
 
+ss::future<> kvstore::gc_sealed_segments() {
+    auto segs = std::exchange(_sealed_segments, {});
+    return ss::do_with(
+      std::move(segs), [](std::vector<ss::lw_shared_ptr<segment>>& segs) {
+          return ss::do_for_each(segs, [](ss::lw_shared_ptr<segment>& seg) {
+              vlog(
+                lg.debug,
+                "Removing old segment with base offset {}",
+                seg->offsets().base_offset);
+              return ss::remove_file(seg->reader().filename()).then([seg] {
+                  return ss::remove_file(seg->index().filename());
+              });
+          });
+      });
+}
+
 ss::future<> kvstore::save_snapshot() {
     vassert(
       _next_offset >= model::offset(0),
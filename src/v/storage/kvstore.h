@@ -78,16 +78,19 @@ struct kvstore_config {
     std::chrono::milliseconds commit_interval;
     ss::sstring base_dir;
     debug_sanitize_files sanitize_fileops;
+    size_t snapshot_interval_segments;
 
     kvstore_config(
       size_t max_segment_size,
       std::chrono::milliseconds commit_interval,
       ss::sstring base_dir,
-      debug_sanitize_files sanitize_fileops)
+      debug_sanitize_files sanitize_fileops,
+      size_t snapshot_interval_segments = 4)
       : max_segment_size(max_segment_size)
       , commit_interval(commit_interval)
       , base_dir(std::move(base_dir))
-      , sanitize_fileops(sanitize_fileops) {}
+      , sanitize_fileops(sanitize_fileops)
+      , snapshot_interval_segments(snapshot_interval_segments) {}
 };
 
 class kvstore {
@@ -97,6 +100,7 @@ public:
         consensus = 1,
         storage = 2,
         controller = 3,
+        kafka = 4,
         /* your sub-system here */
     };
 
@@ -145,6 +149,13 @@ private:
     ss::timer<> _timer;
     ss::semaphore _sem{0};
     ss::lw_shared_ptr<segment> _segment;
+    /*
+     * rolled segments retained as incremental snapshot state. the database is
+     * only re-serialized into a full snapshot every snapshot_interval_segments
+     * rolls; until then the sealed segments hold the dirty keys and recovery
+     * replays them on top of the last full snapshot.
+     */
+    std::vector<ss::lw_shared_ptr<segment>> _sealed_segments;
     model::offset _next_offset;
     absl::flat_hash_map<bytes, iobuf, bytes_type_hash, bytes_type_eq> _db;
 
@@ -153,6 +164,7 @@ private:
     ss::future<> flush_and_apply_ops();
     ss::future<> roll();
     ss::future<> save_snapshot();
+    ss::future<> gc_sealed_segments();
 
     /*
      * Recovery
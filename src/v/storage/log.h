@@ -63,6 +63,33 @@ public:
 
         virtual ss::future<> flush() = 0;
 
+        /**
+         * Release resources that are only needed while the log is actively
+         * written: the active segment appender (and its write-ahead chunks)
+         * and index memory slack. The next append transparently re-acquires
+         * them by rolling a new segment.
+         */
+        virtual ss::future<> hibernate() = 0;
+
+        /**
+         * Re-verify batch checksums of sealed segments against the bytes
+         * on disk, oldest segment first, until the configured read budget
+         * is exhausted. Returns the number of bytes read so the caller can
+         * charge them against a node wide budget. Segments that pass are
+         * remembered (in memory and in the kvstore) and their batches are
+         * served without checksum re-verification on the read path.
+         */
+        virtual ss::future<size_t> scrub(scrub_config) = 0;
+
+        /**
+         * Estimate of the bytes that a compaction pass over this log could
+         * reclaim (segments past the retention threshold) or has to churn
+         * (compacted segments awaiting self compaction). Used to rank logs
+         * when scheduling housekeeping.
+         */
+        virtual size_t
+        compaction_backlog(model::timestamp collection_threshold) const = 0;
+
         virtual ss::future<std::optional<timequery_result>>
           timequery(timequery_config) = 0;
 
@@ -93,6 +120,11 @@ public:
     ss::future<> close() { return _impl->close(); }
     ss::future<> remove() { return _impl->remove(); }
     ss::future<> flush() { return _impl->flush(); }
+    ss::future<> hibernate() { return _impl->hibernate(); }
+    ss::future<size_t> scrub(scrub_config cfg) { return _impl->scrub(cfg); }
+    size_t compaction_backlog(model::timestamp collection_threshold) const {
+        return _impl->compaction_backlog(collection_threshold);
+    }
 
     /**
      * \brief Truncate the suffix of log at a base offset
@@ -25,6 +25,9 @@ struct log_housekeeping_meta {
     log handle;
     bitflags flags{bitflags::none};
     ss::lowres_clock::time_point last_compaction;
+    // dirty offset observed by the previous housekeeping round, used to
+    // detect logs that went idle and can be hibernated
+    model::offset last_seen_dirty_offset;
 };
 
 inline log_housekeeping_meta::bitflags operator|(
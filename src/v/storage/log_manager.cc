@@ -39,9 +39,11 @@
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/core/with_scheduling_group.hh>
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <filesystem>
@@ -54,21 +56,27 @@ log_manager::log_manager(log_config config, kvstore& kvstore) noexcept
   : _config(std::move(config))
   , _kvstore(kvstore)
   , _jitter(_config.compaction_interval)
-  , _batch_cache(config.reclaim_opts) {
+  , _batch_cache(config.reclaim_opts)
+  , _segment_pool(
+      _config.base_dir,
+      config::shard_local_cfg().segment_fallocation_pool_size(),
+      segment_appender::fallocation_step) {
     _compaction_timer.set_callback([this] { trigger_housekeeping(); });
     _compaction_timer.rearm(_jitter());
 }
 void log_manager::trigger_housekeeping() {
     (void)ss::with_gate(_open_gate, [this] {
         auto next_housekeeping = _jitter();
-        return housekeeping().finally([this, next_housekeeping] {
-            // all of these *MUST* be in the finally
-            if (_open_gate.is_closed()) {
-                return;
-            }
+        return ss::with_scheduling_group(
+                 _config.compaction_sg, [this] { return housekeeping(); })
+          .finally([this, next_housekeeping] {
+              // all of these *MUST* be in the finally
+              if (_open_gate.is_closed()) {
+                  return;
+              }
 
-            _compaction_timer.rearm(next_housekeeping);
-        });
+              _compaction_timer.rearm(next_housekeeping);
+          });
     }).handle_exception([](std::exception_ptr e) {
         vlog(stlog.info, "Error processing housekeeping(): {}", e);
     });
@@ -77,67 +85,126 @@ void log_manager::trigger_housekeeping() {
 ss::future<> log_manager::stop() {
     _compaction_timer.cancel();
     _abort_source.request_abort();
-    return _open_gate.close().then([this] {
-        return ss::parallel_for_each(_logs, [](logs_type::value_type& entry) {
-            return entry.second.handle.close();
-        });
-    });
-}
-
-static inline logs_type::iterator find_next_non_compacted_log(logs_type& logs) {
-    using bflags = log_housekeeping_meta::bitflags;
-    return std::find_if(
-      logs.begin(), logs.end(), [](const logs_type::value_type& l) {
-          return bflags::none == (l.second.flags & bflags::compacted);
-      });
+    return _open_gate.close()
+      .then([this] {
+          return ss::parallel_for_each(
+            _logs, [](logs_type::value_type& entry) {
+                return entry.second.handle.close();
+            });
+      })
+      .then([this] { return _segment_pool.stop(); });
 }
 
 ss::future<> log_manager::housekeeping() {
     auto collection_threshold = model::timestamp(
       model::timestamp::now().value() - _config.delete_retention.count());
     /**
-     * Note that this loop does a double find - which is not fast. This solution
-     * is the tradeoff to *not* lock the segment during log_manager::remove(ntp)
-     * and to *not* use an ordered container.
+     * Rank logs before compacting: on a disk near capacity the compactions
+     * with the largest estimated reclaimable/dirty byte count have to run
+     * first, not whichever log the map iteration order yields. Logs with no
+     * estimated backlog still run (the estimate does not cover size based
+     * retention), but only after every valuable candidate finished.
      *
-     * The issue with keeping an iterator and effectively doing a iterator++
-     * is that during a concurrent log_manager::remove() we invalidate all the
-     * iterators for the absl::flat_hash_map; - an alternative here would be to
-     * use a lock
-     *
-     * Note that we also do not use an ordered container like an absl::tree-set
-     * because finds are frequent on this datastructure and we want to serve
-     * them as fast as we can since the majority of the time they will be in the
-     * hotpath / (request-response)
+     * The pass over the ranked list does a double find per log. This is the
+     * tradeoff to *not* lock the map during log_manager::remove(ntp): a
+     * concurrent remove() invalidates all iterators of the
+     * absl::flat_hash_map, so we re-find each ntp and skip it when it is
+     * gone.
      */
-    using bflags = log_housekeeping_meta::bitflags;
-    return ss::do_until(
-             [this] {
-                 auto it = find_next_non_compacted_log(_logs);
-                 return it == _logs.end();
-             },
-             [this, collection_threshold] {
-                 auto it = find_next_non_compacted_log(_logs);
-                 if (it == _logs.end()) {
-                     // must check again because between the stop condition
-                     // and this continuation we might have removed the log
-                     return ss::now();
-                 }
-                 it->second.flags |= bflags::compacted;
-                 it->second.last_compaction = ss::lowres_clock::now();
-                 return it->second.handle.compact(compaction_config(
-                   collection_threshold,
-                   // TODO: [ch433] - this configuration needs to be updated
-                   _config.retention_bytes,
-                   _config.compaction_priority,
-                   _abort_source));
+    std::vector<std::pair<size_t, model::ntp>> ranked;
+    ranked.reserve(_logs.size());
+    for (auto& [ntp, meta] : _logs) {
+        ranked.emplace_back(
+          meta.handle.compaction_backlog(collection_threshold), ntp);
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+    return ss::do_with(
+             std::move(ranked),
+             [this, collection_threshold](
+               std::vector<std::pair<size_t, model::ntp>>& ranked) {
+                 return ss::do_for_each(
+                   ranked, [this, collection_threshold](const auto& r) {
+                       auto it = _logs.find(r.second);
+                       if (it == _logs.end()) {
+                           return ss::now();
+                       }
+                       it->second.last_compaction = ss::lowres_clock::now();
+                       return it->second.handle.compact(compaction_config(
+                         collection_threshold,
+                         // TODO: [ch433] - this configuration needs to be
+                         // updated
+                         _config.retention_bytes,
+                         _config.compaction_priority,
+                         _abort_source));
+                   });
              })
-      .finally([this] {
-          for (auto& h : _logs) {
-              h.second.flags &= ~bflags::compacted;
-          }
+      .then([this] { return hibernate_idle_logs(); })
+      .then([this] { return scrub_cold_segments(); });
+}
+
+ss::future<> log_manager::scrub_cold_segments() {
+    if (_config.scrub_bytes_per_interval == 0) {
+        return ss::now();
+    }
+    // per-segment scrub results are durable, so a budget that runs out mid
+    // pass simply resumes from the first unscrubbed segment next round - no
+    // cursor has to be carried between rounds. the ntp snapshot plus re-find
+    // is the same trick the compaction loop uses to survive a concurrent
+    // remove()
+    std::vector<model::ntp> ntps;
+    ntps.reserve(_logs.size());
+    for (auto& [ntp, meta] : _logs) {
+        ntps.push_back(ntp);
+    }
+    return ss::do_with(
+      std::move(ntps),
+      _config.scrub_bytes_per_interval,
+      [this](std::vector<model::ntp>& ntps, size_t& budget) {
+          return ss::do_for_each(ntps, [this, &budget](const model::ntp& ntp) {
+              if (budget == 0 || _abort_source.abort_requested()) {
+                  return ss::now();
+              }
+              auto it = _logs.find(ntp);
+              if (it == _logs.end()) {
+                  return ss::now();
+              }
+              return it->second.handle
+                .scrub(scrub_config(
+                  budget, _config.compaction_priority, _abort_source))
+                .then([&budget](size_t bytes_read) {
+                    budget -= std::min(budget, bytes_read);
+                });
+          });
       });
 }
+
+ss::future<> log_manager::hibernate_idle_logs() {
+    // a log whose dirty offset did not move since the previous housekeeping
+    // round is idle - release the resources it only needs while actively
+    // written. wake up is transparent, the first append simply rolls a new
+    // segment.
+    std::vector<model::ntp> idle;
+    for (auto& [ntp, meta] : _logs) {
+        auto dirty = meta.handle.offsets().dirty_offset;
+        if (dirty == meta.last_seen_dirty_offset) {
+            idle.push_back(ntp);
+        }
+        meta.last_seen_dirty_offset = dirty;
+    }
+    return ss::do_with(std::move(idle), [this](std::vector<model::ntp>& idle) {
+        return ss::do_for_each(idle, [this](const model::ntp& ntp) {
+            // the same double find as the compaction loop above, the log may
+            // have been removed while we were hibernating another one
+            auto it = _logs.find(ntp);
+            if (it == _logs.end()) {
+                return ss::now();
+            }
+            return it->second.handle.hibernate();
+        });
+    });
+}
 ss::future<ss::lw_shared_ptr<segment>> log_manager::make_log_segment(
   const ntp_config& ntp,
   model::offset base_offset,
@@ -147,15 +214,33 @@ ss::future<ss::lw_shared_ptr<segment>> log_manager::make_log_segment(
   size_t buf_size) {
     return ss::with_gate(
       _open_gate, [this, &ntp, base_offset, term, pc, version, buf_size] {
-          return make_segment(
-            ntp,
-            base_offset,
-            term,
-            pc,
-            version,
-            buf_size,
-            _config.sanitize_fileops,
-            create_cache(ntp.cache_enabled()));
+          auto path = segment_path::make_segment_path(
+            ntp, base_offset, term, version);
+          /*
+           * claiming a pre-created, pre-fallocated blank file turns the hot
+           * path cost of a segment roll into a single rename. on a miss (or
+           * when the pool is disabled) we fall through to plain creation.
+           */
+          return _segment_pool.claim(std::move(path))
+            .then([this, &ntp, base_offset, term, pc, version, buf_size](
+                    bool claimed) {
+                if (claimed) {
+                    vlog(
+                      stlog.debug,
+                      "Claimed pooled segment file for {} at offset {}",
+                      ntp.ntp(),
+                      base_offset);
+                }
+                return make_segment(
+                  ntp,
+                  base_offset,
+                  term,
+                  pc,
+                  version,
+                  buf_size,
+                  _config.sanitize_fileops,
+                  create_cache(ntp.cache_enabled()));
+            });
       });
 }
 
@@ -198,7 +283,9 @@ ss::future<log> log_manager::do_manage(ntp_config cfg) {
     vassert(
       _logs.find(cfg.ntp()) == _logs.end(), "cannot double register same ntp");
 
-    if (_config.stype == log_config::storage_type::memory) {
+    if (
+      _config.stype == log_config::storage_type::memory
+      || cfg.is_memory_backed()) {
         auto path = cfg.work_directory();
         auto l = storage::make_memory_backed_log(std::move(cfg));
         _logs.emplace(l.config().ntp(), l);
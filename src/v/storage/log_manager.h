@@ -19,6 +19,7 @@
 #include "storage/log_housekeeping_meta.h"
 #include "storage/ntp_config.h"
 #include "storage/segment.h"
+#include "storage/segment_pool.h"
 #include "storage/types.h"
 #include "storage/version.h"
 #include "units.h"
@@ -29,6 +30,7 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/lowres_clock.hh>
+#include <seastar/core/scheduling.hh>
 #include <seastar/core/sstring.hh>
 
 #include <absl/container/flat_hash_map.h>
@@ -112,11 +114,17 @@ struct log_config {
     // used for testing: keeps a backtrace of operations for debugging
     debug_sanitize_files sanitize_fileops = debug_sanitize_files::no;
     ss::io_priority_class compaction_priority;
+    // scheduling group housekeeping (compaction, retention, scrubbing)
+    // runs in. defaults to the main group for tests and tools
+    ss::scheduling_group compaction_sg;
     // same as retention.bytes in kafka
     std::optional<size_t> retention_bytes = std::nullopt;
     std::chrono::milliseconds compaction_interval = std::chrono::minutes(10);
     // same as delete.retention.ms in kafka - default 1 week
     std::chrono::milliseconds delete_retention = std::chrono::minutes(10080);
+    // byte budget of the background checksum scrubber per housekeeping
+    // round. zero disables scrubbing
+    size_t scrub_bytes_per_interval = 512_MiB;
     with_cache cache = with_cache::yes;
     batch_cache::reclaim_options reclaim_opts{
       .growth_window = std::chrono::seconds(3),
@@ -219,6 +227,8 @@ private:
     void trigger_housekeeping();
     void arm_housekeeping();
     ss::future<> housekeeping();
+    ss::future<> hibernate_idle_logs();
+    ss::future<> scrub_cold_segments();
 
     std::optional<batch_cache_index> create_cache(with_cache);
 
@@ -231,6 +241,7 @@ private:
     ss::timer<ss::lowres_clock> _compaction_timer;
     logs_type _logs;
     batch_cache _batch_cache;
+    segment_pool _segment_pool;
     ss::gate _open_gate;
     ss::abort_source _abort_source;
 
@@ -12,6 +12,7 @@
 #include "bytes/iobuf.h"
 #include "model/record.h"
 #include "storage/logger.h"
+#include "utils/cached_clock.h"
 #include "vassert.h"
 #include "vlog.h"
 
@@ -40,6 +41,20 @@ batch_consumer::consume_result skipping_consumer::consume_batch_start(
     }
     _expected_next_batch = header.last_offset() + model::offset(1);
 
+    /*
+     * in prefetch mode batches are inserted into the batch cache only, so
+     * the config driven filters below - which describe what the current
+     * fetch wants delivered - do not apply.
+     */
+    if (_reader._state.prefetching) {
+        if (_reader._state.prefetch_is_full()) {
+            return stop_parser::yes;
+        }
+        _header = header;
+        _header.ctx.term = _reader._seg.offsets().term;
+        return skip_batch::no;
+    }
+
     if (header.last_offset() < _reader._config.start_offset) {
         return skip_batch::yes;
     }
@@ -65,6 +80,14 @@ batch_consumer::consume_result skipping_consumer::consume_batch_start(
            > _reader._config.max_bytes) {
         // signal to log reader to stop (see log_reader::is_done)
         _reader._config.over_budget = true;
+        if (!_reader._config.skip_batch_cache) {
+            // over budget for delivery, but the batch is already under the
+            // read head: switch to cache-only prefetch and keep parsing
+            _reader._state.prefetching = true;
+            _header = header;
+            _header.ctx.term = _reader._seg.offsets().term;
+            return skip_batch::no;
+        }
         return stop_parser::yes;
     }
 
@@ -78,6 +101,19 @@ void skipping_consumer::consume_records(iobuf&& records) {
 }
 
 batch_consumer::stop_parser skipping_consumer::consume_batch_end() {
+    if (_reader._state.prefetching) {
+        _reader.add_prefetch(model::record_batch(
+          _header, std::move(_records), model::record_batch::tag_ctor_ng{}));
+        if (
+          _header.last_offset() >= _reader._seg.offsets().stable_offset
+          || _next_cached_batch == (_header.last_offset() + model::offset(1))
+          || _reader._state.prefetch_is_full()
+          || cached_clock::now() >= _timeout) {
+            return stop_parser::yes;
+        }
+        _header = {};
+        return stop_parser::no;
+    }
     // Note: This is what keeps the train moving. the `_reader.*` transitively
     // updates the next batch to consume
     _reader.add_one(model::record_batch(
@@ -95,9 +131,21 @@ batch_consumer::stop_parser skipping_consumer::consume_batch_end() {
     if (_next_cached_batch == (_header.last_offset() + model::offset(1))) {
         return stop_parser::yes;
     }
-    if (
-      _reader._config.bytes_consumed >= _reader._config.max_bytes
-      || model::timeout_clock::now() >= _timeout) {
+    if (cached_clock::now() >= _timeout) {
+        return stop_parser::yes;
+    }
+    if (_reader._config.bytes_consumed >= _reader._config.max_bytes) {
+        /*
+         * the fetch is complete, but the disk seek for this parse is
+         * already paid for: keep reading into the cache so the next
+         * sequential fetch finds the adjacent range in memory instead of
+         * going back to disk.
+         */
+        if (!_reader._config.skip_batch_cache) {
+            _reader._state.prefetching = true;
+            _header = {};
+            return stop_parser::no;
+        }
         return stop_parser::yes;
     }
     _header = {};
@@ -118,9 +166,15 @@ std::unique_ptr<continuous_batch_parser> log_segment_batch_reader::initialize(
   model::timeout_clock::time_point timeout,
   std::optional<model::offset> next_cached_batch) {
     auto input = _seg.offset_data_stream(_config.start_offset, _config.prio);
+    auto consumer = std::make_unique<skipping_consumer>(
+      *this, timeout, next_cached_batch);
+    _consumer = consumer.get();
     return std::make_unique<continuous_batch_parser>(
-      std::make_unique<skipping_consumer>(*this, timeout, next_cached_batch),
-      std::move(input));
+      std::move(consumer),
+      std::move(input),
+      // batches of a scrubbed segment were re-verified against the disk in
+      // the background, no need to burn cpu re-checking them per fetch
+      continuous_batch_parser::batches_verified(_seg.is_crc_scrubbed()));
 }
 
 ss::future<> log_segment_batch_reader::close() {
@@ -138,9 +192,13 @@ void log_segment_batch_reader::add_one(model::record_batch&& batch) {
     _config.bytes_consumed += size_bytes;
     _state.buffer_size += size_bytes;
     _probe.add_bytes_read(size_bytes);
-    if (!_config.skip_batch_cache) {
-        _seg.cache_put(b);
-    }
+}
+
+void log_segment_batch_reader::add_prefetch(model::record_batch&& batch) {
+    // deliberately does not touch the reader config: prefetched batches are
+    // invisible to the current fetch and only populate the batch cache
+    _state.prefetch_size += batch.header().size_bytes;
+    _state.prefetch.emplace_back(std::move(batch));
 }
 ss::future<result<records_t>>
 log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
@@ -183,15 +241,52 @@ log_segment_batch_reader::read_some(model::timeout_clock::time_point timeout) {
 
     if (!_iterator) {
         _iterator = initialize(timeout, cache_read.next_cached_batch);
+    } else {
+        // the parser survives across fetches when its reader is parked in
+        // the reader cache - refresh the deadline its consumer captured
+        _consumer->set_timeout(timeout);
     }
     auto ptr = _iterator.get();
     return ptr->consume().then(
-      [this](result<size_t> bytes_consumed) -> result<records_t> {
+      [this](result<size_t> bytes_consumed) -> ss::future<result<records_t>> {
           if (!bytes_consumed) {
-              return bytes_consumed.error();
+              return ss::make_ready_future<result<records_t>>(
+                bytes_consumed.error());
           }
           auto tmp = std::exchange(_state, {});
-          return result<records_t>(std::move(tmp.buffer));
+          if (!_config.skip_batch_cache) {
+              /*
+               * everything the parse produced is inserted into the cache in
+               * bulk - the index is locked once per disk read rather than
+               * once per batch - and the prefetched tail turns the next
+               * sequential miss into a hit.
+               */
+              _seg.cache_put_range(tmp.buffer);
+              if (!tmp.prefetch.empty()) {
+                  _seg.cache_put_range(tmp.prefetch);
+                  _probe.add_prefetched_bytes(tmp.prefetch_size);
+              }
+          }
+          if (tmp.prefetching) {
+              /*
+               * the parser ran ahead of the delivery position to fill the
+               * cache, so its stream can no longer serve the next
+               * sequential read and must not be reused. the cache holds
+               * everything between the delivery position and the stream
+               * position, so the next read either bridges the gap with a
+               * hit or starts a fresh parser at the right offset.
+               */
+              auto it = std::exchange(_iterator, nullptr);
+              _consumer = nullptr;
+              auto raw = it.get();
+              return raw->close().then(
+                [it = std::move(it),
+                 buf = std::move(tmp.buffer)]() mutable -> result<records_t> {
+                    return result<records_t>(std::move(buf));
+                });
+          }
+          return ss::make_ready_future<result<records_t>>(
+            std::move(tmp.buffer));
       });
 }
 
@@ -203,22 +298,50 @@ log_reader::log_reader(
   , _iterator(_lease->range.begin())
   , _config(config)
   , _probe(probe) {
-    if (config.abort_source) {
-        auto op_sub = config.abort_source.value().get().subscribe(
-          [this]() noexcept { set_end_of_stream(); });
-
-        if (op_sub) {
-            _as_sub = std::move(*op_sub);
-        } else {
-            // already aborted
-            set_end_of_stream();
-        }
-    }
+    hook_abort_source();
 
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
           **_iterator.next_seg, _config, _probe);
     }
+
+    enable_readahead(_config.readahead_bytes);
+}
+
+void log_reader::hook_abort_source() {
+    if (!_config.abort_source) {
+        return;
+    }
+    auto op_sub = _config.abort_source.value().get().subscribe(
+      [this]() noexcept { set_end_of_stream(); });
+
+    if (op_sub) {
+        _as_sub = std::move(*op_sub);
+    } else {
+        // already aborted
+        set_end_of_stream();
+    }
+}
+
+void log_reader::reset_config(log_reader_config config) {
+    vassert(is_reusable(), "reset_config on reader that is not reusable");
+    vassert(
+      config.start_offset == next_read(),
+      "reset_config must continue the stream: wanted {}, reader is at {}",
+      config.start_offset,
+      next_read());
+    _config = config;
+    _finished = false;
+    _last_base = model::offset{};
+    _as_sub = ss::abort_source::subscription{};
+    hook_abort_source();
+    // the error paths close the segment reader; a clean stop keeps it (and
+    // its open parser) alive, so only recreate when it is gone
+    if (!_iterator.reader) {
+        _iterator.reader = std::make_unique<log_segment_batch_reader>(
+          **_iterator.next_seg, _config, _probe);
+    }
+    enable_readahead(_config.readahead_bytes);
 }
 
 ss::future<> log_reader::find_next_valid_iterator() {
@@ -250,15 +373,17 @@ ss::future<log_reader::storage_t>
 log_reader::do_load_slice(model::timeout_clock::time_point timeout) {
     if (is_done()) {
         // must keep this function because, the segment might not be done
-        // but offsets might have exceeded the read
+        // but offsets might have exceeded the read.
+        //
+        // the iterator is deliberately left open: a reader stopped by its
+        // config limits may be parked in the reader cache and re-armed for
+        // the next sequential fetch. finally() closes it otherwise
         set_end_of_stream();
-        return _iterator.close().then(
-          [] { return ss::make_ready_future<storage_t>(); });
+        return ss::make_ready_future<storage_t>();
     }
     if (_last_base == _config.start_offset) {
         set_end_of_stream();
-        return _iterator.close().then(
-          [] { return ss::make_ready_future<storage_t>(); });
+        return ss::make_ready_future<storage_t>();
     }
     _last_base = _config.start_offset;
     ss::future<> fut = find_next_valid_iterator();
@@ -270,6 +395,7 @@ log_reader::do_load_slice(model::timeout_clock::time_point timeout) {
       .then([this, timeout](result<records_t> recs) -> ss::future<storage_t> {
           if (!recs) {
               set_end_of_stream();
+              _failed = true;
               vlog(
                 stlog.info,
                 "stopped reading stream: {}",
@@ -292,6 +418,7 @@ log_reader::do_load_slice(model::timeout_clock::time_point timeout) {
       })
       .handle_exception([this](std::exception_ptr e) {
           set_end_of_stream();
+          _failed = true;
           _probe.batch_parse_error();
           return _iterator.close().then(
             [e] { return ss::make_exception_future<storage_t>(e); });
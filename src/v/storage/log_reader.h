@@ -70,6 +70,10 @@ public:
     stop_parser consume_batch_end() override;
     void print(std::ostream&) const override;
 
+    // the consumer outlives a single fetch when its reader is parked in the
+    // reader cache, so the deadline has to be refreshed per read
+    void set_timeout(model::timeout_clock::time_point t) { _timeout = t; }
+
 private:
     log_segment_batch_reader& _reader;
     model::record_batch_header _header;
@@ -82,6 +86,14 @@ private:
 class log_segment_batch_reader {
 public:
     static constexpr size_t max_buffer_size = 32 * 1024; // 32KB
+    /*
+     * once a fetch exhausted its byte budget mid-parse the disk seek is
+     * already paid for, so up to this many additional bytes are parsed and
+     * inserted into the batch cache (never delivered). a consumer catching
+     * up from behind the tail then finds the adjacent range in memory
+     * instead of repeating the miss for every fetch-sized slice.
+     */
+    static constexpr size_t max_prefetch_size = 128 * 1024; // 128KB
 
     log_segment_batch_reader(
       segment&, log_reader_config& config, probe& p) noexcept;
@@ -104,12 +116,21 @@ private:
       std::optional<model::offset> next_cached_batch);
 
     void add_one(model::record_batch&&);
+    void add_prefetch(model::record_batch&&);
 
 private:
     struct tmp_state {
         ss::circular_buffer<model::record_batch> buffer;
         size_t buffer_size = 0;
+        // batches parsed past the delivery budget. they are destined only
+        // for the batch cache and are never returned to the caller
+        ss::circular_buffer<model::record_batch> prefetch;
+        size_t prefetch_size = 0;
+        bool prefetching = false;
         bool is_full() const { return buffer_size >= max_buffer_size; }
+        bool prefetch_is_full() const {
+            return prefetch_size >= max_prefetch_size;
+        }
     };
 
     segment& _seg;
@@ -117,6 +138,8 @@ private:
     probe& _probe;
 
     std::unique_ptr<continuous_batch_parser> _iterator;
+    // owned by _iterator, kept to refresh the timeout on reuse
+    skipping_consumer* _consumer{nullptr};
     tmp_state _state;
     friend class skipping_consumer;
 };
@@ -135,7 +158,7 @@ public:
     }
 
     bool is_end_of_stream() const final {
-        return _iterator.next_seg == _lease->range.end();
+        return _finished || _iterator.next_seg == _lease->range.end();
     }
 
     ss::future<storage_t> do_load_slice(model::timeout_clock::time_point) final;
@@ -146,8 +169,35 @@ public:
         fmt::print(os, "storage::log_reader. config {}", _config);
     }
 
+    /// offset the next sequential fetch through this reader would start at
+    model::offset next_read() const { return _config.start_offset; }
+
+    /// a reader that stopped because it hit the offset or byte limits of
+    /// its config - not an error and not the end of its lease - can be
+    /// re-armed with reset_config() and continue where it left off
+    bool is_reusable() const {
+        return !_failed && _iterator.next_seg != _lease->range.end();
+    }
+
+    /// re-arm a reusable reader for the next fetch. the caller must ensure
+    /// cfg.start_offset equals next_read()
+    void reset_config(log_reader_config cfg);
+
+    /// true when the lease pins (holds a read lock on) a segment whose
+    /// offset span intersects [begin, end]
+    bool lease_overlaps(model::offset begin, model::offset end) const {
+        for (const auto& s : _lease->range) {
+            const auto& o = s->offsets();
+            if (o.base_offset <= end && o.dirty_offset >= begin) {
+                return true;
+            }
+        }
+        return false;
+    }
+
 private:
-    void set_end_of_stream() { _iterator.next_seg = _lease->range.end(); }
+    void set_end_of_stream() { _finished = true; }
+    void hook_abort_source();
     bool is_done();
     ss::future<> find_next_valid_iterator();
 
@@ -179,6 +229,11 @@ private:
     model::offset _last_base;
     probe& _probe;
     ss::abort_source::subscription _as_sub;
+    // the reader finished its current config. the segment position is kept
+    // so the reader can be re-armed for the next sequential fetch
+    bool _finished{false};
+    // the reader stopped on an error and must not be reused
+    bool _failed{false};
 };
 
 } // namespace storage
@@ -159,8 +159,39 @@ struct mem_log_impl final : log::impl {
     }
     ss::future<> remove() final { return ss::make_ready_future<>(); }
     ss::future<> flush() final { return ss::make_ready_future<>(); }
+
+    ss::future<> hibernate() final { return ss::make_ready_future<>(); }
+
+    // nothing to verify, there are no on disk bytes
+    ss::future<size_t> scrub(scrub_config) final {
+        return ss::make_ready_future<size_t>(0);
+    }
+
+    size_t compaction_backlog(model::timestamp) const final { return 0; }
     ss::future<> compact(compaction_config cfg) final {
-        return gc(cfg.eviction_time, cfg.max_bytes);
+        if (!config().is_collectable()) {
+            return ss::make_ready_future<>();
+        }
+        // per-topic retention overrides bound a memory backed partition
+        // the same way they bound a disk log
+        auto max_bytes = cfg.max_bytes;
+        auto eviction_time = cfg.eviction_time;
+        if (config().has_overrides()) {
+            const auto& o = config().get_overrides();
+            if (o.retention_bytes.is_disabled()) {
+                max_bytes = std::nullopt;
+            } else if (o.retention_bytes.has_value()) {
+                max_bytes = o.retention_bytes.value();
+            }
+            if (o.retention_time.is_disabled()) {
+                eviction_time = model::timestamp::min();
+            } else if (o.retention_time.has_value()) {
+                eviction_time = model::timestamp(
+                  model::timestamp::now().value()
+                  - o.retention_time.value().count());
+            }
+        }
+        return gc(eviction_time, max_bytes);
     }
     std::ostream& print(std::ostream& o) const final {
         fmt::print(o, "{{mem_log_impl:{}}}", offsets());
@@ -10,6 +10,7 @@
  */
 
 #pragma once
+#include "model/compression.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "tristate.h"
@@ -20,6 +21,7 @@
 
 namespace storage {
 using with_cache = ss::bool_class<struct log_cache_tag>;
+using in_memory_backed = ss::bool_class<struct in_memory_backed_tag>;
 
 class ntp_config {
 public:
@@ -37,6 +39,20 @@ public:
         tristate<std::chrono::milliseconds> retention_time{std::nullopt};
         // if set, log will not use batch cache
         with_cache cache_enabled = with_cache::yes;
+        // relaxed-fsync durability policy. when either threshold is set the
+        // partition acknowledges writes before fdatasync and the log is
+        // flushed in the background once the configured amount of time or
+        // bytes accumulated since the last flush.
+        std::optional<std::chrono::milliseconds> flush_interval;
+        std::optional<size_t> flush_bytes;
+        // broker side recompression target. batches are appended as sent by
+        // the client and rewritten with this codec when housekeeping rewrites
+        // the segment, off the produce hot path
+        std::optional<model::compression> recompression;
+        // if yes the partition lives purely in memory: replicated through
+        // raft, bounded by the retention settings, never written to a
+        // segment and lost on restart
+        in_memory_backed memory_backed = in_memory_backed::no;
 
         friend std::ostream&
         operator<<(std::ostream&, const default_overrides&);
@@ -111,6 +127,40 @@ public:
         return with_cache(!has_overrides() || _overrides->cache_enabled);
     }
 
+    /**
+     * Relaxed-fsync mode - writes to this ntp are acknowledged before
+     * fdatasync, durability is bounded by the flush interval/byte thresholds
+     */
+    bool has_relaxed_fsync() const {
+        return _overrides
+               && (_overrides->flush_interval || _overrides->flush_bytes);
+    }
+
+    std::optional<std::chrono::milliseconds> flush_interval() const {
+        return _overrides ? _overrides->flush_interval : std::nullopt;
+    }
+
+    std::optional<size_t> flush_bytes() const {
+        return _overrides ? _overrides->flush_bytes : std::nullopt;
+    }
+
+    /**
+     * In-memory partition - batches never hit a segment or an index; the
+     * contents are bounded by the retention settings and do not survive a
+     * restart
+     */
+    bool is_memory_backed() const {
+        return _overrides && _overrides->memory_backed;
+    }
+
+    /**
+     * Codec that background housekeeping re-encodes batches with. Unset
+     * means batches are stored exactly as the client sent them.
+     */
+    std::optional<model::compression> recompression() const {
+        return _overrides ? _overrides->recompression : std::nullopt;
+    }
+
 private:
     model::ntp _ntp;
     /// \brief currently this is the basedir. In the future
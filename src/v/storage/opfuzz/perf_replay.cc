@@ -0,0 +1,220 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/opfuzz/perf_replay.h"
+
+#include "bytes/iobuf.h"
+#include "model/record_batch_reader.h"
+#include "model/timeout_clock.h"
+#include "random/generators.h"
+#include "storage/record_batch_builder.h"
+#include "storage/types.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/memory.hh>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+
+namespace storage {
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+std::chrono::microseconds since(clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+      clock::now() - start);
+}
+
+std::chrono::microseconds
+percentile(std::vector<std::chrono::microseconds>& samples, double p) {
+    if (samples.empty()) {
+        return std::chrono::microseconds(0);
+    }
+    std::sort(samples.begin(), samples.end());
+    auto ix = static_cast<size_t>(
+      p * static_cast<double>(samples.size() - 1));
+    return samples[ix];
+}
+
+struct counting_consumer {
+    ss::future<ss::stop_iteration> operator()(model::record_batch batch) {
+        bytes += batch.size_bytes();
+        return ss::make_ready_future<ss::stop_iteration>(
+          ss::stop_iteration::no);
+    }
+    size_t end_of_stream() { return bytes; }
+    size_t bytes{0};
+};
+
+} // namespace
+
+double perf_replay::report::write_throughput_mb_sec() const {
+    if (total_time.count() == 0) {
+        return 0;
+    }
+    return static_cast<double>(bytes_written)
+           / static_cast<double>(total_time.count());
+}
+
+void perf_replay::report::merge(const report& other) {
+    produce_ops += other.produce_ops;
+    fetch_ops += other.fetch_ops;
+    bytes_written += other.bytes_written;
+    bytes_read += other.bytes_read;
+    total_time = std::max(total_time, other.total_time);
+    produce_p50 = std::max(produce_p50, other.produce_p50);
+    produce_p99 = std::max(produce_p99, other.produce_p99);
+    fetch_p50 = std::max(fetch_p50, other.fetch_p50);
+    fetch_p99 = std::max(fetch_p99, other.fetch_p99);
+    allocs_per_op = std::max(allocs_per_op, other.allocs_per_op);
+}
+
+size_t perf_replay::next_value_size() {
+    unsigned total = 0;
+    for (const auto& [_, weight] : _profile.value_size_dist) {
+        total += weight;
+    }
+    auto pick = std::uniform_int_distribution<unsigned>(1, total)(_prng);
+    for (const auto& [size, weight] : _profile.value_size_dist) {
+        if (pick <= weight) {
+            return size;
+        }
+        pick -= weight;
+    }
+    return _profile.value_size_dist.back().first;
+}
+
+model::record_batch perf_replay::make_profiled_batch() {
+    auto records = std::uniform_int_distribution<int>(
+      _profile.min_records_per_batch,
+      _profile.max_records_per_batch)(_prng);
+    record_batch_builder builder(
+      model::record_batch_type(1), model::offset(0));
+    for (int i = 0; i < records; ++i) {
+        builder.add_raw_kv(
+          bytes_to_iobuf(random_generators::get_bytes(16)),
+          bytes_to_iobuf(random_generators::get_bytes(next_value_size())));
+    }
+    auto batch = std::move(builder).build();
+    batch.set_term(_term);
+    return batch;
+}
+
+ss::future<std::chrono::microseconds> perf_replay::produce_once() {
+    auto batch = make_profiled_batch();
+    _bytes_written += batch.size_bytes();
+    auto reader = model::make_memory_record_batch_reader(std::move(batch));
+    log_append_config append_cfg{
+      log_append_config::fsync::no,
+      ss::default_priority_class(),
+      model::no_timeout};
+    auto start = clock::now();
+    co_await std::move(reader).for_each_ref(
+      _log.make_appender(append_cfg), model::no_timeout);
+    co_return since(start);
+}
+
+ss::future<std::pair<std::chrono::microseconds, size_t>>
+perf_replay::fetch_once() {
+    auto lstats = _log.offsets();
+    if (lstats.dirty_offset < lstats.start_offset) {
+        // nothing has been produced yet
+        co_return std::make_pair(std::chrono::microseconds(0), size_t(0));
+    }
+    // production fetches are mostly tail reads, start somewhere in the
+    // upper half of the log
+    int64_t mid = lstats.start_offset()
+                  + (lstats.dirty_offset() - lstats.start_offset()) / 2;
+    auto from = model::offset(std::uniform_int_distribution<int64_t>(
+      mid, lstats.dirty_offset())(_prng));
+    log_reader_config cfg(
+      from, lstats.dirty_offset, ss::default_priority_class());
+    auto start = clock::now();
+    auto reader = co_await _log.make_reader(cfg);
+    auto bytes = co_await std::move(reader).consume(
+      counting_consumer{}, model::no_timeout);
+    co_return std::make_pair(since(start), bytes);
+}
+
+ss::future<perf_replay::report> perf_replay::execute() {
+    // interleave fetches with produces in a deterministic order
+    std::vector<bool> is_produce;
+    is_produce.reserve(_profile.produce_ops + _profile.fetch_ops);
+    is_produce.insert(is_produce.end(), _profile.produce_ops, true);
+    is_produce.insert(is_produce.end(), _profile.fetch_ops, false);
+    std::shuffle(is_produce.begin(), is_produce.end(), _prng);
+
+    report r{
+      .produce_ops = _profile.produce_ops,
+      .fetch_ops = _profile.fetch_ops,
+    };
+    std::vector<std::chrono::microseconds> produce_lat;
+    std::vector<std::chrono::microseconds> fetch_lat;
+    produce_lat.reserve(_profile.produce_ops);
+    fetch_lat.reserve(_profile.fetch_ops);
+
+    auto allocs_before = ss::memory::stats().mallocs();
+    auto start = clock::now();
+    for (auto produce : is_produce) {
+        if (produce) {
+            produce_lat.push_back(co_await produce_once());
+        } else {
+            auto [lat, bytes] = co_await fetch_once();
+            fetch_lat.push_back(lat);
+            r.bytes_read += bytes;
+        }
+    }
+    co_await _log.flush();
+    r.total_time = since(start);
+    auto allocs_after = ss::memory::stats().mallocs();
+
+    r.bytes_written = _bytes_written;
+    r.produce_p50 = percentile(produce_lat, 0.50);
+    r.produce_p99 = percentile(produce_lat, 0.99);
+    r.fetch_p50 = percentile(fetch_lat, 0.50);
+    r.fetch_p99 = percentile(fetch_lat, 0.99);
+    if (!is_produce.empty()) {
+        r.allocs_per_op = (allocs_after - allocs_before) / is_produce.size();
+    }
+    co_return r;
+}
+
+std::ostream& operator<<(std::ostream& o, const perf_replay::report& r) {
+    fmt::print(
+      o,
+      "{{produce_ops: {}, fetch_ops: {}, bytes_written: {}, bytes_read: {}, "
+      "total_time_us: {}, write_throughput_mb_sec: {:.3f}, "
+      "produce_p50_us: {}, produce_p99_us: {}, fetch_p50_us: {}, "
+      "fetch_p99_us: {}, allocs_per_op: {}}}",
+      r.produce_ops,
+      r.fetch_ops,
+      r.bytes_written,
+      r.bytes_read,
+      r.total_time.count(),
+      r.write_throughput_mb_sec(),
+      r.produce_p50.count(),
+      r.produce_p99.count(),
+      r.fetch_p50.count(),
+      r.fetch_p99.count(),
+      r.allocs_per_op);
+    return o;
+}
+
+bool within_thresholds(
+  const perf_replay::report& r, const perf_replay::thresholds& t) {
+    return r.write_throughput_mb_sec() >= t.min_write_throughput_mb_sec
+           && r.produce_p99 <= t.max_produce_p99
+           && r.fetch_p99 <= t.max_fetch_p99
+           && r.allocs_per_op <= t.max_allocs_per_op;
+}
+
+} // namespace storage
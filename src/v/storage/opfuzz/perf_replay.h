@@ -0,0 +1,121 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "model/fundamental.h"
+#include "storage/log.h"
+
+#include <seastar/core/abort_source.hh>
+
+#include <chrono>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace storage {
+
+/// Performance companion to 'opfuzz'. Where opfuzz randomizes operation
+/// interleavings to shake out correctness bugs, perf_replay runs a
+/// deterministic, production-shaped produce/fetch workload against a
+/// storage::log and measures throughput, latency and allocations per
+/// operation. The numbers are compared against regression thresholds by
+/// the perf_replay_test target so storage changes that slow down the hot
+/// path fail a test instead of a cluster.
+class perf_replay {
+public:
+    /// Shape of the replayed workload. All randomness is drawn from a
+    /// generator seeded with 'seed' so two runs of the same profile
+    /// produce the same sequence of operations and payload sizes.
+    struct workload_profile {
+        uint64_t seed{42};
+        /// Number of produce operations, each appends one batch
+        size_t produce_ops{1000};
+        /// Number of fetch operations interleaved with the produces
+        size_t fetch_ops{100};
+        /// Records per produced batch, drawn uniformly from the range
+        int min_records_per_batch{1};
+        int max_records_per_batch{20};
+        /// Weighted record value size buckets in bytes. Defaults model a
+        /// typical mixed workload: mostly small events with an occasional
+        /// large payload.
+        std::vector<std::pair<size_t, unsigned>> value_size_dist = {
+          {128, 60},
+          {1024, 30},
+          {16384, 10},
+        };
+    };
+
+    /// Metrics gathered by a replay
+    struct report {
+        size_t produce_ops{0};
+        size_t fetch_ops{0};
+        size_t bytes_written{0};
+        size_t bytes_read{0};
+        std::chrono::microseconds total_time{0};
+        std::chrono::microseconds produce_p50{0};
+        std::chrono::microseconds produce_p99{0};
+        std::chrono::microseconds fetch_p50{0};
+        std::chrono::microseconds fetch_p99{0};
+        /// Memory allocations per operation, averaged over the whole run
+        size_t allocs_per_op{0};
+
+        double write_throughput_mb_sec() const;
+
+        /// Merge metrics from a replay of another log (latencies take the
+        /// max, counters are added) so multi-partition runs can be checked
+        /// with a single set of thresholds
+        void merge(const report& other);
+    };
+
+    /// Regression thresholds, a replay fails its target when any measured
+    /// metric crosses one of them. Defaults accept everything.
+    struct thresholds {
+        double min_write_throughput_mb_sec{0};
+        std::chrono::microseconds max_produce_p99{
+          std::chrono::microseconds::max()};
+        std::chrono::microseconds max_fetch_p99{
+          std::chrono::microseconds::max()};
+        size_t max_allocs_per_op{std::numeric_limits<size_t>::max()};
+    };
+
+    perf_replay(storage::log l, workload_profile profile)
+      : _log(std::move(l))
+      , _profile(std::move(profile))
+      , _prng(_profile.seed) {}
+
+    /// Run the workload to completion and return the measurements
+    ss::future<report> execute();
+
+    const storage::log& log() const { return _log; }
+
+private:
+    ss::future<std::chrono::microseconds> produce_once();
+    ss::future<std::pair<std::chrono::microseconds, size_t>> fetch_once();
+
+    model::record_batch make_profiled_batch();
+    size_t next_value_size();
+
+    storage::log _log;
+    workload_profile _profile;
+    std::mt19937_64 _prng;
+    model::term_id _term{0};
+    size_t _bytes_written{0};
+};
+
+std::ostream& operator<<(std::ostream&, const perf_replay::report&);
+
+/// True when every metric in 'r' is within 't'
+bool within_thresholds(
+  const perf_replay::report& r, const perf_replay::thresholds& t);
+
+} // namespace storage
@@ -0,0 +1,88 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/fundamental.h"
+#include "storage/opfuzz/perf_replay.h"
+#include "storage/tests/storage_test_fixture.h"
+#include "test_utils/fixture.h"
+
+#include <seastar/util/defer.hh>
+
+#include <memory>
+
+/*
+ * Performance regression safety net for the storage stack. The workload
+ * below replays a deterministic, production-shaped produce/fetch mix
+ * against several partitions through the full storage::api path and fails
+ * when throughput, tail latency or allocations per operation regress
+ * beyond the thresholds.
+ *
+ * The thresholds are intentionally generous: they're meant to catch
+ * order-of-magnitude regressions (an accidental O(n) scan per append, an
+ * allocation storm, a lost fast path) without flaking on slow or shared
+ * CI machines. Tighten them only with care.
+ */
+
+FIXTURE_TEST(test_produce_fetch_replay, storage_test_fixture) {
+    storage::log_manager mngr = make_log_manager(storage::log_config(
+      storage::log_config::storage_type::disk,
+      std::move(test_dir),
+      200_MiB,
+      storage::debug_sanitize_files::no,
+      ss::default_priority_class(),
+      storage::with_cache::yes));
+    auto deferred = ss::defer([&mngr]() mutable { mngr.stop().get0(); });
+
+    const size_t ntp_count = 4;
+    std::vector<std::unique_ptr<storage::perf_replay>> replays;
+    replays.reserve(ntp_count);
+    for (size_t i = 0; i < ntp_count; ++i) {
+        auto ntp = model::ntp("test.default", "perf-replay", i);
+        auto log = mngr.manage(storage::ntp_config(ntp, mngr.config().base_dir))
+                     .get0();
+        storage::perf_replay::workload_profile profile{
+          // per-partition seed keeps the run deterministic while giving
+          // every partition a distinct operation sequence
+          .seed = 1042 + i,
+          .produce_ops = 500,
+          .fetch_ops = 50,
+        };
+        replays.emplace_back(std::make_unique<storage::perf_replay>(
+          std::move(log), std::move(profile)));
+    }
+
+    // Partitions replay in parallel like they would on a real shard
+    storage::perf_replay::report merged{};
+    ss::parallel_for_each(
+      replays,
+      [&merged](std::unique_ptr<storage::perf_replay>& r) {
+          return r->execute().then([&merged,
+                                    &r](storage::perf_replay::report rep) {
+              info("replay report for {}: {}", r->log().config().ntp(), rep);
+              merged.merge(rep);
+          });
+      })
+      .get0();
+    info("merged replay report: {}", merged);
+
+    storage::perf_replay::thresholds limits{
+      // a debug build on a loaded CI box still writes a few MB/s
+      .min_write_throughput_mb_sec = 0.5,
+      // appends are asynchronous disk writes, a p99 in the seconds range
+      // means something is stuck behind the op
+      .max_produce_p99 = std::chrono::seconds(2),
+      .max_fetch_p99 = std::chrono::seconds(2),
+      // measured in the hundreds on the current tree, an allocation storm
+      // on the hot path pushes this orders of magnitude higher
+      .max_allocs_per_op = 20000,
+    };
+    BOOST_REQUIRE_MESSAGE(
+      storage::within_thresholds(merged, limits),
+      fmt::format("performance regression detected: {}", merged));
+}
@@ -11,6 +11,7 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "compression/compression.h"
 #include "likely.h"
 #include "model/record.h"
 #include "model/record_utils.h"
@@ -126,18 +127,23 @@ ss::future<result<stop_parser>> continuous_batch_parser::consume_header() {
               return ss::make_ready_future<result<stop_parser>>(
                 parser_errc::end_of_stream);
           }
-          if (auto computed_crc = model::internal_header_only_crc(o.value());
-              unlikely(o.value().header_crc != computed_crc)) {
-              vlog(
-                stlog.error,
-                "detected header corruption. stopping parser. Expected CRC of "
-                "{}, but got header CRC: {} - {}. consumer:{}",
-                computed_crc,
-                o.value().header_crc,
-                o.value(),
-                *_consumer);
-              return ss::make_ready_future<result<stop_parser>>(
-                parser_errc::header_only_crc_missmatch);
+          // a scrubbed stream was already verified against the bytes on
+          // disk - skip the per batch crc recomputation
+          if (_batches_verified == batches_verified::no) {
+              if (auto computed_crc = model::internal_header_only_crc(
+                    o.value());
+                  unlikely(o.value().header_crc != computed_crc)) {
+                  vlog(
+                    stlog.error,
+                    "detected header corruption. stopping parser. Expected "
+                    "CRC of {}, but got header CRC: {} - {}. consumer:{}",
+                    computed_crc,
+                    o.value().header_crc,
+                    o.value(),
+                    *_consumer);
+                  return ss::make_ready_future<result<stop_parser>>(
+                    parser_errc::header_only_crc_missmatch);
+              }
           }
           if (unlikely(o.value().header_crc == 0)) {
               return ss::make_ready_future<result<stop_parser>>(
@@ -200,12 +206,55 @@ void continuous_batch_parser::add_bytes_and_reset() {
 ss::future<result<stop_parser>> continuous_batch_parser::consume_records() {
     auto sz = _header.size_bytes - model::packed_record_batch_header_size;
     return verify_read_iobuf(_input, sz, "parser::consume_records")
-      .then([this](result<iobuf> record) -> result<stop_parser> {
+      .then([this](result<iobuf> record) {
           if (!record) {
-              return record.error();
+              return ss::make_ready_future<result<stop_parser>>(record.error());
+          }
+          if (unlikely(bool(_consumer->wants_keys_only()))) {
+              return consume_record_keys(std::move(record.value()));
           }
           _consumer->consume_records(std::move(record.value()));
-          return result<stop_parser>(_consumer->consume_batch_end());
+          return ss::make_ready_future<result<stop_parser>>(
+            _consumer->consume_batch_end());
+      });
+}
+
+ss::future<result<stop_parser>>
+continuous_batch_parser::consume_record_keys(iobuf records) {
+    if (_header.attrs.compression() != model::compression::none) {
+        // the batch framing does not allow seeking inside a compressed
+        // payload, decompress and key-scan the raw buffer instead
+        records = compression::compressor::uncompress(
+          records, _header.attrs.compression());
+    }
+    return ss::do_with(
+      iobuf_parser(std::move(records)), [this](iobuf_parser& parser) {
+          return ss::do_until(
+                   [&parser] { return parser.bytes_left() == 0; },
+                   [this, &parser] {
+                       // record framing: size, attributes, timestamp delta,
+                       // offset delta, key, value, headers. the record size
+                       // covers everything after the size varint itself, so
+                       // once the key is shared out the rest of the record
+                       // is skipped in one step
+                       auto [record_size, rv] = parser.read_varlong();
+                       const auto start = parser.bytes_consumed();
+                       parser.skip(sizeof(model::record_attributes::type));
+                       parser.read_varlong(); // timestamp delta
+                       auto [offset_delta, ov] = parser.read_varlong();
+                       auto [key_length, kv] = parser.read_varlong();
+                       iobuf key;
+                       if (key_length > 0) {
+                           key = parser.share(key_length);
+                       }
+                       const auto consumed = parser.bytes_consumed() - start;
+                       parser.skip(static_cast<size_t>(record_size) - consumed);
+                       return _consumer->consume_record_key(
+                         static_cast<int32_t>(offset_delta), std::move(key));
+                   })
+            .then([this] {
+                return result<stop_parser>(_consumer->consume_batch_end());
+            });
       });
 }
 
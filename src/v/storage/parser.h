@@ -41,6 +41,12 @@ public:
     using stop_parser = ss::bool_class<struct stop_parser_tag>;
     using consume_result = std::variant<stop_parser, skip_batch>;
 
+    /// \brief declared by consumers that only need record keys - think
+    /// compaction index rebuild. the parser walks the record framing and
+    /// hands each key to consume_record_key(), seeking past value and
+    /// header bytes instead of materializing them
+    using keys_only = ss::bool_class<struct keys_only_tag>;
+
     batch_consumer() noexcept = default;
     batch_consumer(const batch_consumer&) = default;
     batch_consumer& operator=(const batch_consumer&) = default;
@@ -57,6 +63,15 @@ public:
     virtual void consume_records(iobuf&&) = 0;
     virtual stop_parser consume_batch_end() = 0;
 
+    virtual keys_only wants_keys_only() const { return keys_only::no; }
+    /// \brief called once per record instead of consume_records() when
+    /// wants_keys_only() is set. compressed batches are decompressed
+    /// first - the batch framing does not allow seeking inside the
+    /// compressed payload
+    virtual ss::future<> consume_record_key(int32_t, iobuf&&) {
+        return ss::make_ready_future<>();
+    }
+
     virtual void print(std::ostream&) const = 0;
 
 private:
@@ -70,11 +85,19 @@ inline std::ostream& operator<<(std::ostream& os, const batch_consumer& c) {
 
 class continuous_batch_parser {
 public:
+    /// \brief a stream whose batches were already checksum-verified against
+    /// the on disk bytes (a scrubbed segment) may be parsed with
+    /// batches_verified set - the per batch header crc recomputation is
+    /// skipped. the zero-crc end of fallocated file detection still runs
+    using batches_verified = ss::bool_class<struct batches_verified_tag>;
+
     continuous_batch_parser(
       std::unique_ptr<batch_consumer> consumer,
-      ss::input_stream<char> input) noexcept
+      ss::input_stream<char> input,
+      batches_verified verified = batches_verified::no) noexcept
       : _consumer(std::move(consumer))
-      , _input(std::move(input)) {}
+      , _input(std::move(input))
+      , _batches_verified(verified) {}
     continuous_batch_parser(const continuous_batch_parser&) = delete;
     continuous_batch_parser& operator=(const continuous_batch_parser&) = delete;
     continuous_batch_parser(continuous_batch_parser&&) noexcept = default;
@@ -98,6 +121,9 @@ private:
     /// consume the [un]compressed records
     ss::future<result<batch_consumer::stop_parser>> consume_records();
 
+    /// key-only scan over the records of the current batch
+    ss::future<result<batch_consumer::stop_parser>> consume_record_keys(iobuf);
+
     size_t consumed_batch_bytes() const;
     void add_bytes_and_reset();
 
@@ -105,6 +131,7 @@ private:
     std::unique_ptr<batch_consumer> _consumer;
     ss::input_stream<char> _input;
     model::record_batch_header _header;
+    batches_verified _batches_verified{batches_verified::no};
     parser_errc _err = parser_errc::none;
     size_t _bytes_consumed{0};
     size_t _physical_base_offset{0};
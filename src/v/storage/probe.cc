@@ -54,6 +54,12 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _cached_bytes_read; },
           sm::description("Total number of cached bytes read"),
           labels),
+        sm::make_total_bytes(
+          "prefetched_bytes",
+          [this] { return _prefetched_bytes; },
+          sm::description("Total number of bytes read from disk ahead of a "
+                          "fetch to populate the batch cache"),
+          labels),
         sm::make_derive(
           "batches_read",
           [this] { return _batches_read; },
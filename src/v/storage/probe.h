@@ -29,6 +29,7 @@ public:
 
     void add_bytes_read(uint64_t read) { _bytes_read += read; }
     void add_cached_bytes_read(uint64_t read) { _cached_bytes_read += read; }
+    void add_prefetched_bytes(uint64_t read) { _prefetched_bytes += read; }
 
     void batch_written() { ++_batches_written; }
 
@@ -63,6 +64,7 @@ private:
     uint64_t _bytes_written = 0;
     uint64_t _bytes_read = 0;
     uint64_t _cached_bytes_read = 0;
+    uint64_t _prefetched_bytes = 0;
 
     uint64_t _batches_written = 0;
     uint64_t _batches_read = 0;
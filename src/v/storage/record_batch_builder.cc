@@ -25,7 +25,18 @@ record_batch_builder::record_batch_builder(
 
 record_batch_builder::~record_batch_builder() {}
 
-model::record_batch record_batch_builder::build() && {
+model::record_batch record_batch_builder::build() && { return do_build(); }
+
+model::record_batch
+record_batch_builder::build_and_reset(model::offset next_base_offset) {
+    auto batch = do_build();
+    _records.clear();
+    _records_size_bytes = 0;
+    _base_offset = next_base_offset;
+    return batch;
+}
+
+model::record_batch record_batch_builder::do_build() {
     int32_t offset_delta = 0;
     auto now_ts = model::timestamp::now();
 
@@ -46,8 +57,13 @@ model::record_batch record_batch_builder::build() && {
         model::term_id(0), ss::this_shard_id())};
 
     iobuf records;
+    if (_records_size_bytes > 0) {
+        // one allocation holding the exact serialized payload; every
+        // reserve/append below packs into it
+        records.reserve_memory_exact(_records_size_bytes);
+    }
     for (auto& sr : _records) {
-        auto rec_sz = record_size(offset_delta, sr);
+        auto rec_sz = sr.encoded_size;
         auto kz = sr.key.size_bytes();
         auto vz = sr.encoded_value_size;
         auto r = model::record(
@@ -27,6 +27,7 @@ public:
     virtual record_batch_builder&
     add_raw_kv(iobuf&& key, std::optional<iobuf>&& value) {
         _records.emplace_back(std::move(key), std::move(value));
+        account_latest_record();
         return *this;
     }
     virtual record_batch_builder& add_raw_kw(
@@ -35,9 +36,16 @@ public:
       std::vector<model::record_header> headers) {
         _records.emplace_back(
           std::move(key), std::move(value), std::move(headers));
+        account_latest_record();
         return *this;
     }
     virtual model::record_batch build() &&;
+
+    /// build the batch and re-arm the builder for the next one at the given
+    /// base offset. the record vector keeps its capacity across batches, so
+    /// producers emitting batches in a loop skip its reallocation
+    model::record_batch build_and_reset(model::offset next_base_offset);
+
     virtual ~record_batch_builder();
 
 private:
@@ -62,12 +70,29 @@ private:
         iobuf value;
         int32_t encoded_value_size;
         std::vector<model::record_header> headers;
+        // wire size of the record body, fixed once it is added since the
+        // offset delta is its position in the batch
+        uint32_t encoded_size{0};
     };
 
     uint32_t record_size(int32_t offset_delta, const serialized_record& r);
 
+    /// record sizes are final at add time, so the exact payload size is
+    /// accumulated here and build() preallocates the serialization buffer
+    /// in one shot instead of growing it record by record
+    void account_latest_record() {
+        auto& r = _records.back();
+        r.encoded_size = record_size(
+          static_cast<int32_t>(_records.size() - 1), r);
+        _records_size_bytes += vint::vint_size(r.encoded_size)
+                               + r.encoded_size;
+    }
+
+    model::record_batch do_build();
+
     model::record_batch_type _batch_type;
     model::offset _base_offset;
     std::vector<serialized_record> _records;
+    size_t _records_size_bytes{0};
 };
 } // namespace storage
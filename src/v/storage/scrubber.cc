@@ -0,0 +1,105 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/scrubber.h"
+
+#include "bytes/utils.h"
+#include "hashing/crc32c.h"
+#include "likely.h"
+#include "model/record_utils.h"
+#include "storage/logger.h"
+#include "storage/parser.h"
+#include "vlog.h"
+
+#include <seastar/core/rwlock.hh>
+
+namespace storage::internal {
+
+/// verifies the payload crc of every batch it is fed. unlike the recovery
+/// consumer in log_replayer it leaves the segment index untouched - the
+/// segment stays fully readable while it is being scrubbed
+class scrubbing_consumer final : public batch_consumer {
+public:
+    explicit scrubbing_consumer(scrub_result& r)
+      : _result(r) {}
+
+    consume_result consume_batch_start(
+      model::record_batch_header header,
+      size_t /*physical_base_offset*/,
+      size_t /*size_on_disk*/) final {
+        _header = header;
+        _crc = crc32();
+        model::crc_record_batch_header(_crc, header);
+        return skip_batch::no;
+    }
+
+    void consume_records(iobuf&& records) final {
+        crc_extend_iobuf(_crc, records);
+    }
+
+    stop_parser consume_batch_end() final {
+        // crc is calculated as a uint32_t but because of kafka we carry
+        // around a signed type in the batch structure
+        if (unlikely((uint32_t)_header.crc != _crc.value())) {
+            vlog(
+              stlog.error,
+              "scrub detected batch crc mismatch at offset {}: expected {}, "
+              "computed {}",
+              _header.base_offset,
+              _header.crc,
+              _crc.value());
+            _result.clean = false;
+            return stop_parser::yes;
+        }
+        _header = {};
+        return stop_parser::no;
+    }
+
+    void print(std::ostream& os) const final {
+        fmt::print(os, "storage::scrubbing_consumer");
+    }
+
+private:
+    model::record_batch_header _header;
+    scrub_result& _result;
+    crc32 _crc;
+};
+
+ss::future<scrub_result>
+scrub_segment(ss::lw_shared_ptr<segment> s, const scrub_config& cfg) {
+    return s->read_lock().then([s, iopc = cfg.iopc](ss::rwlock::holder h) {
+        if (s->is_closed()) {
+            return ss::make_ready_future<scrub_result>(scrub_result{});
+        }
+        return ss::do_with(
+          scrub_result{},
+          [s, iopc](scrub_result& res) {
+              auto parser = std::make_unique<continuous_batch_parser>(
+                std::make_unique<scrubbing_consumer>(res),
+                s->reader().data_stream(0, iopc));
+              auto raw = parser.get();
+              return raw->consume()
+                .then([&res](result<size_t> bytes) {
+                    if (!bytes) {
+                        // a parse error (e.g. a corrupt header crc) is a
+                        // failed scrub, not an exception - the segment is
+                        // left unmarked and the read path keeps verifying
+                        res.clean = false;
+                        return res;
+                    }
+                    res.bytes_read = bytes.value();
+                    return res;
+                })
+                .finally([p = std::move(parser)] { return p->close(); });
+          })
+          .finally([h = std::move(h)] {});
+    });
+}
+
+} // namespace storage::internal
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2020 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "storage/segment.h"
+#include "storage/types.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/shared_ptr.hh>
+
+namespace storage::internal {
+
+/// outcome of one full checksum pass over a sealed segment
+struct scrub_result {
+    // every batch crc matched the bytes on disk
+    bool clean{true};
+    // bytes read from disk, charged against the scrub budget
+    size_t bytes_read{0};
+};
+
+/**
+ * \brief Re-verify every batch crc of a sealed segment against the bytes
+ * on local storage.
+ *
+ * Holds the segment read lock for the duration of the pass so the data
+ * file cannot be truncated or swapped from underneath the parser. The
+ * caller is responsible for marking the segment as scrubbed and for
+ * persisting the result.
+ */
+ss::future<scrub_result>
+scrub_segment(ss::lw_shared_ptr<segment>, const scrub_config&);
+
+} // namespace storage::internal
@@ -33,8 +33,10 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
 
+#include <cerrno>
 #include <optional>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
 namespace storage {
@@ -261,6 +263,8 @@ segment::do_truncate(model::offset prev_last_offset, size_t physical) {
     _tracker.stable_offset = prev_last_offset;
     _tracker.dirty_offset = prev_last_offset;
     _reader.set_file_size(physical);
+    // the bytes past the truncation point were never scrubbed
+    clear_crc_scrubbed();
     cache_truncate(prev_last_offset + model::offset(1));
     auto f = ss::now();
     if (is_compacted_segment()) {
@@ -538,17 +542,30 @@ ss::future<ss::lw_shared_ptr<segment>> open_segment(
     // preventing x-file synchronization This is fine, because truncation to
     // sealed segments are supposed to be very rare events. The hotpath of
     // truncating the appender, is optimized.
-    return internal::make_reader_handle(path, sanitize_fileops)
-      .then([](ss::file f) {
-          return f.stat().then([f](struct stat s) {
-              return ss::make_ready_future<std::tuple<uint64_t, ss::file>>(
-                std::make_tuple(s.st_size, f));
-          });
+    // the data file is not opened here: the reader gets a lazy handle that
+    // materializes on first read through the shard's bounded
+    // file_handle_cache, so recovering a node with many sealed segments
+    // does not storm open(). the size comes from a plain stat; a segment
+    // created through make_segment has no data file on disk yet, which
+    // reads as an empty one.
+    return ss::file_stat(path.string())
+      .then_wrapped([](ss::future<ss::stat_data> f) {
+          try {
+              return ss::make_ready_future<uint64_t>(f.get0().size);
+          } catch (const std::system_error& e) {
+              if (e.code().value() == ENOENT) {
+                  return ss::make_ready_future<uint64_t>(0);
+              }
+              return ss::make_exception_future<uint64_t>(
+                std::current_exception());
+          }
       })
-      .then([buf_size, path](std::tuple<uint64_t, ss::file> t) {
-          auto& [size, fd] = t;
-          return std::make_unique<segment_reader>(
-            path.string(), std::move(fd), size, buf_size);
+      .then([buf_size, path, sanitize_fileops](uint64_t size) {
+          return internal::make_cached_reader_handle(path, sanitize_fileops)
+            .then([buf_size, path, size](ss::file fd) {
+                return std::make_unique<segment_reader>(
+                  path.string(), std::move(fd), size, buf_size);
+            });
       })
       .then([batch_cache = std::move(batch_cache), meta, sanitize_fileops](
               std::unique_ptr<segment_reader> rdr) mutable {
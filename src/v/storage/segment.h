@@ -61,6 +61,13 @@ public:
         finished_self_compaction = 1U << 1U,
         mark_tombstone = 1U << 2U,
         closed = 1U << 3U,
+        // every batch crc was verified against the on disk bytes - readers
+        // may trust batch headers without recomputing checksums
+        crc_scrubbed = 1U << 4U,
+        // the segment was rewritten with the topic's recompression codec.
+        // in-memory only - after a restart the rewrite is repeated, the
+        // reducer copies already-converted batches through untouched
+        finished_recompression = 1U << 5U,
     };
 
 public:
@@ -107,6 +114,11 @@ public:
     bool is_compacted_segment() const;
     void mark_as_finished_self_compaction();
     bool finished_self_compaction() const;
+    void mark_as_finished_recompression();
+    bool finished_recompression() const;
+    void mark_as_crc_scrubbed();
+    void clear_crc_scrubbed();
+    bool is_crc_scrubbed() const;
     /// \brief used for compaction, to reset the tracker from index
     void force_set_commit_offset_from_index();
     // low level api's are discouraged and might be deprecated
@@ -133,6 +145,8 @@ public:
       size_t max_bytes,
       bool skip_lru_promote);
     void cache_put(const model::record_batch& batch);
+    void
+    cache_put_range(const ss::circular_buffer<model::record_batch>& batches);
 
     ss::future<ss::rwlock::holder> read_lock(
       ss::semaphore::time_point timeout = ss::semaphore::time_point::max());
@@ -276,6 +290,18 @@ inline bool segment::finished_self_compaction() const {
     return (_flags & bitflags::finished_self_compaction)
            == bitflags::finished_self_compaction;
 }
+inline void segment::mark_as_finished_recompression() {
+    _flags |= bitflags::finished_recompression;
+}
+inline bool segment::finished_recompression() const {
+    return (_flags & bitflags::finished_recompression)
+           == bitflags::finished_recompression;
+}
+inline void segment::mark_as_crc_scrubbed() { _flags |= bitflags::crc_scrubbed; }
+inline void segment::clear_crc_scrubbed() { _flags &= ~bitflags::crc_scrubbed; }
+inline bool segment::is_crc_scrubbed() const {
+    return (_flags & bitflags::crc_scrubbed) == bitflags::crc_scrubbed;
+}
 inline batch_cache_index& segment::cache() { return *_cache; }
 inline const batch_cache_index& segment::cache() const { return *_cache; }
 inline bool segment::has_cache() const { return _cache != std::nullopt; }
@@ -304,6 +330,12 @@ inline void segment::cache_put(const model::record_batch& batch) {
         _cache->put(batch);
     }
 }
+inline void segment::cache_put_range(
+  const ss::circular_buffer<model::record_batch>& batches) {
+    if (likely(bool(_cache))) {
+        _cache->put_range(batches);
+    }
+}
 inline ss::future<ss::rwlock::holder>
 segment::read_lock(ss::semaphore::time_point timeout) {
     return _destructive_ops.hold_read_lock(timeout);
@@ -48,6 +48,7 @@ segment_appender::segment_appender(ss::file f, options opts)
 
 segment_appender::~segment_appender() noexcept {
     vassert(_inflight.empty(), "not empty flights");
+    vassert(_flush_ops.empty(), "pending flushes");
     vassert(
       _bytes_flush_pending == 0 && _closed,
       "Must flush & close before deleting {}",
@@ -66,7 +67,10 @@ segment_appender::segment_appender(segment_appender&& o) noexcept
   , _bytes_flush_pending(o._bytes_flush_pending)
   , _concurrent_flushes(std::move(o._concurrent_flushes))
   , _head(std::move(o._head))
+  , _stashed_tail(std::move(o._stashed_tail))
+  , _stashed_tail_offset(o._stashed_tail_offset)
   , _inflight(std::move(o._inflight))
+  , _flush_ops(std::move(o._flush_ops))
   , _callbacks(std::exchange(o._callbacks, nullptr))
   , _inactive_timer([this] { handle_inactive_timer(); })
   , _previously_inactive(o._previously_inactive) {
@@ -188,6 +192,18 @@ void segment_appender::handle_inactive_timer() {
      */
     if (_concurrent_flushes.try_wait(ss::semaphore::max_counter())) {
         if (_head && !_head->bytes_pending()) {
+            /*
+             * with the full semaphore held there are no writes in flight, so
+             * the chunk content matches the file. save the unaligned tail of
+             * the last page before giving up the chunk so that the next
+             * append can rehydrate without re-reading it from disk.
+             */
+            const size_t tail = _committed_offset % _head->alignment();
+            if (tail > 0) {
+                _stashed_tail = ss::temporary_buffer<char>(
+                  _head->data() + _head->flushed_pos() - tail, tail);
+                _stashed_tail_offset = _committed_offset;
+            }
             internal::chunks().add(std::exchange(_head, nullptr));
             vlog(
               stlog.debug, "reclaiming inactive chunk from appender {}", *this);
@@ -224,6 +240,14 @@ ss::future<> segment_appender::hydrate_last_half_page() {
     if (bytes_to_read == 0) {
         return ss::make_ready_future<>();
     }
+    if (auto stash = std::exchange(_stashed_tail, {});
+        stash.size() == bytes_to_read
+        && _stashed_tail_offset == _committed_offset) {
+        // tail saved when the inactive timer reclaimed the chunk; hydrate
+        // without touching the disk
+        std::copy_n(stash.get(), bytes_to_read, buff);
+        return ss::make_ready_future<>();
+    }
     return _out
       .dma_read(
         sz, buff, read_align /*must be full _write_ alignment*/, _opts.priority)
@@ -352,6 +376,11 @@ void segment_appender::maybe_advance_stable_offset(
             break;
         }
 
+        while (!_flush_ops.empty() && _flush_ops.front()->target <= committed) {
+            _flush_ops.front()->done.set_value();
+            _flush_ops.pop_front();
+        }
+
         if (_callbacks) {
             _callbacks->committed_physical_offset(committed);
         }
@@ -411,11 +440,33 @@ void segment_appender::dispatch_background_head_write() {
       });
 }
 
+ss::future<> segment_appender::do_chained_flush() {
+    /*
+     * everything up to _committed_offset has already been handed to a
+     * background write, so it is enough to wait for those writes to land and
+     * then fdatasync. unlike the quiescing flush below this does not grab the
+     * full semaphore, so appends racing with the flush keep making progress.
+     */
+    if (_inflight.empty()) {
+        return _out.flush();
+    }
+    auto op = ss::make_lw_shared<flush_op>(_committed_offset);
+    _flush_ops.push_back(op);
+    return op->done.get_future()
+      .then([this] { return _out.flush(); })
+      .handle_exception([this](std::exception_ptr e) {
+          vassert(false, "Could not flush: {} - {}", e, *this);
+      });
+}
+
 ss::future<> segment_appender::flush() {
     _inactive_timer.cancel();
     if (_head && _head->bytes_pending()) {
         dispatch_background_head_write();
     }
+    if (_opts.chained_flushes) {
+        return do_chained_flush();
+    }
     return ss::with_semaphore(
              _concurrent_flushes,
              ss::semaphore::max_counter(),
@@ -22,6 +22,7 @@
 #include <seastar/core/fstream.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include <iosfwd>
 
@@ -50,9 +51,20 @@ public:
           , number_of_chunks(chunks_no)
           , falloc_step(step) {}
 
+        options(
+          ss::io_priority_class p, size_t chunks_no, size_t step, bool chained)
+          : priority(p)
+          , number_of_chunks(chunks_no)
+          , falloc_step(step)
+          , chained_flushes(chained) {}
+
         ss::io_priority_class priority;
         size_t number_of_chunks{chunks_no_buffer};
         size_t falloc_step{fallocation_step};
+        /// when set, flush() links the fdatasync to the completion of the
+        /// writes dispatched so far instead of quiescing the appender, so a
+        /// write+flush pair does not stall appends racing with the flush.
+        bool chained_flushes{false};
     };
 
     segment_appender(ss::file f, options opts);
@@ -82,6 +94,7 @@ public:
 
 private:
     void dispatch_background_head_write();
+    ss::future<> do_chained_flush();
     ss::future<> do_next_adaptive_fallocation();
     ss::future<> hydrate_last_half_page();
     ss::future<> do_truncation(size_t);
@@ -110,6 +123,16 @@ private:
     ss::semaphore _concurrent_flushes;
     ss::lw_shared_ptr<chunk> _head;
 
+    /*
+     * when the inactive timer reclaims the head chunk the unaligned tail of
+     * the last written page is saved here so that the next append can
+     * rehydrate the chunk with a memcpy instead of a blocking dma_read. the
+     * stash is only valid while the committed offset it was taken at is
+     * unchanged.
+     */
+    ss::temporary_buffer<char> _stashed_tail;
+    size_t _stashed_tail_offset{0};
+
     struct inflight_write {
         bool done;
         size_t offset;
@@ -120,6 +143,22 @@ private:
     };
 
     ss::chunked_fifo<ss::lw_shared_ptr<inflight_write>> _inflight;
+
+    /*
+     * a chained flush waits for the writes dispatched before it to become
+     * stable and then issues the fdatasync, while later appends and writes
+     * proceed concurrently. the waiter is resolved by the same bookkeeping
+     * that advances the stable offset.
+     */
+    struct flush_op {
+        size_t target;
+        ss::promise<> done;
+
+        explicit flush_op(size_t target)
+          : target(target) {}
+    };
+
+    ss::chunked_fifo<ss::lw_shared_ptr<flush_op>> _flush_ops;
     callbacks* _callbacks = nullptr;
     void maybe_advance_stable_offset(const ss::lw_shared_ptr<inflight_write>&);
 
@@ -16,6 +16,9 @@
 
 namespace storage {
 
+/// serialize a batch header into the on disk representation
+iobuf disk_header_to_iobuf(const model::record_batch_header&);
+
 ss::future<>
 write(segment_appender& appender, const model::record_batch& batch);
 
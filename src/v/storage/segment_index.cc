@@ -80,15 +80,21 @@ segment_index::find_nearest(model::timestamp t) {
         return std::nullopt;
     }
     const uint32_t i = t() - _state.base_timestamp();
-    auto it = std::lower_bound(
+    /*
+     * entries track the last timestamp of the indexed batch, so seek to the
+     * greatest entry at-or-below the needle. a forward scan starting there
+     * cannot skip the first batch with a timestamp >= t, which would be
+     * possible when starting at the lower bound with a sparse index.
+     */
+    auto it = std::upper_bound(
       std::begin(_state.relative_time_index),
       std::end(_state.relative_time_index),
       i,
       std::less<uint32_t>{});
-    if (it == _state.relative_offset_index.end()) {
-        return std::nullopt;
+    if (it != _state.relative_time_index.begin()) {
+        it = std::prev(it);
     }
-    auto dist = std::distance(_state.relative_offset_index.begin(), it);
+    auto dist = std::distance(_state.relative_time_index.begin(), it);
     return translate_index_entry(_state, _state.get_entry(dist));
 }
 
@@ -79,6 +79,7 @@ public:
     /// \brief resets the state to 0, except for base_offset
     /// a destructive operation. Needed for node bootstrap
     void reset();
+    void shrink_to_fit() { _state.shrink_to_fit(); }
     void swap_index_state(index_state&&);
     bool needs_persistence() const { return _needs_persistence; }
     index_state release_index_state() && { return std::move(_state); }
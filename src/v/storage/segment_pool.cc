@@ -0,0 +1,108 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/segment_pool.h"
+
+#include "storage/logger.h"
+#include "vlog.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/file.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/core/smp.hh>
+
+#include <fmt/format.h>
+
+namespace storage {
+
+segment_pool::segment_pool(
+  ss::sstring base_dir, size_t capacity, size_t falloc_size) noexcept
+  : _base_dir(std::move(base_dir))
+  , _capacity(capacity)
+  , _falloc_size(falloc_size) {}
+
+std::filesystem::path segment_pool::pool_directory() const {
+    return std::filesystem::path(
+      fmt::format("{}/.segment_pool/{}", _base_dir, ss::this_shard_id()));
+}
+
+ss::future<bool> segment_pool::claim(std::filesystem::path dest) {
+    if (_capacity == 0 || _gate.is_closed()) {
+        co_return false;
+    }
+    if (_ready.empty()) {
+        // a miss still primes the pool so the next roll hits
+        maybe_refill();
+        co_return false;
+    }
+    auto src = _ready.front();
+    _ready.pop_front();
+    maybe_refill();
+    co_await ss::rename_file(src.string(), dest.string());
+    co_return true;
+}
+
+void segment_pool::maybe_refill() {
+    if (_refilling || _ready.size() >= _capacity || _gate.is_closed()) {
+        return;
+    }
+    _refilling = true;
+    (void)ss::with_gate(_gate, [this] {
+        return do_refill().finally([this] { _refilling = false; });
+    }).handle_exception([this](std::exception_ptr e) {
+        vlog(stlog.info, "Error refilling segment pool: {}", e);
+    });
+}
+
+ss::future<> segment_pool::do_refill() {
+    co_await ss::recursive_touch_directory(pool_directory().string());
+    while (_ready.size() < _capacity && !_gate.is_closed()) {
+        auto path = pool_directory()
+                    / fmt::format("blank-{}.staging", _name_seq++);
+        co_await create_blank(path);
+        _ready.push_back(std::move(path));
+    }
+}
+
+ss::future<> segment_pool::create_blank(std::filesystem::path path) {
+    auto f = co_await ss::open_file_dma(
+      path.string(), ss::open_flags::create | ss::open_flags::rw);
+    std::exception_ptr e;
+    try {
+        co_await f.allocate(0, _falloc_size);
+        co_await f.flush();
+    } catch (...) {
+        e = std::current_exception();
+    }
+    co_await f.close();
+    if (e) {
+        std::rethrow_exception(e);
+    }
+}
+
+ss::future<> segment_pool::stop() {
+    co_await _gate.close();
+    // blank files hold fallocated disk space; give it back on shutdown
+    while (!_ready.empty()) {
+        auto path = _ready.front();
+        _ready.pop_front();
+        try {
+            co_await ss::remove_file(path.string());
+        } catch (...) {
+            vlog(
+              stlog.info,
+              "Error removing pooled segment {}: {}",
+              path.string(),
+              std::current_exception());
+        }
+    }
+}
+
+} // namespace storage
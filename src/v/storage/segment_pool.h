@@ -0,0 +1,69 @@
+/*
+ * Copyright 2020 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "storage/types.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
+#include <seastar/core/sstring.hh>
+
+#include <deque>
+#include <filesystem>
+
+namespace storage {
+
+/**
+ * \brief Per-shard pool of pre-created, pre-fallocated blank segment files.
+ *
+ * Rolling a segment on the produce hot path pays for file creation and the
+ * first adaptive fallocation. The pool hides that cost by creating blank
+ * files of `falloc_size` bytes in a shard-private staging directory in the
+ * background. Claiming a segment is then a single rename into the final
+ * path; the appender's first fallocation over already-allocated blocks is
+ * effectively free.
+ *
+ * The pool refills lazily: the first claim (or miss) kicks a background
+ * refill, so an idle shard pays nothing. A miss simply returns false and the
+ * caller falls back to plain file creation.
+ */
+class segment_pool {
+public:
+    segment_pool(
+      ss::sstring base_dir, size_t capacity, size_t falloc_size) noexcept;
+
+    /// Rename a pooled blank file into `dest`. Returns false when the pool
+    /// is empty; the caller creates the file the usual way.
+    ss::future<bool> claim(std::filesystem::path dest);
+
+    ss::future<> stop();
+
+    size_t size() const { return _ready.size(); }
+
+private:
+    std::filesystem::path pool_directory() const;
+    void maybe_refill();
+    ss::future<> do_refill();
+    ss::future<> create_blank(std::filesystem::path);
+
+    ss::sstring _base_dir;
+    size_t _capacity;
+    size_t _falloc_size;
+    size_t _name_seq{0};
+    bool _refilling{false};
+    std::deque<std::filesystem::path> _ready;
+    ss::gate _gate;
+};
+
+} // namespace storage
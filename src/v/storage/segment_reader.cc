@@ -36,13 +36,24 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class& pc) {
       "cannot read negative bytes. Asked to read at position: '{}' - {}",
       pos,
       *this);
+    return data_stream(pos, _file_size - pos, pc);
+}
+
+ss::input_stream<char> segment_reader::data_stream(
+  size_t pos, size_t len, const ss::io_priority_class& pc) {
+    vassert(
+      pos + len <= _file_size,
+      "cannot read past the end of file. Asked to read {} bytes at position: "
+      "'{}' - {}",
+      len,
+      pos,
+      *this);
     ss::file_input_stream_options options;
     options.buffer_size = _buffer_size;
     options.io_priority_class = pc;
     options.read_ahead = 4; // FIXME: scylla uses 10
     options.dynamic_adjustments = _history;
-    return make_file_input_stream(
-      _data_file, pos, _file_size - pos, std::move(options));
+    return make_file_input_stream(_data_file, pos, len, std::move(options));
 }
 
 ss::future<> segment_reader::truncate(size_t n) {
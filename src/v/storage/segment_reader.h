@@ -65,6 +65,11 @@ public:
     ss::input_stream<char>
     data_stream(size_t pos, const ss::io_priority_class&);
 
+    /// create an input stream _sharing_ the underlying file handle
+    /// covering @len bytes starting at position @pos
+    ss::input_stream<char>
+    data_stream(size_t pos, size_t len, const ss::io_priority_class&);
+
 private:
     ss::sstring _filename;
     ss::file _data_file;
@@ -9,6 +9,7 @@
 
 #include "storage/segment_set.h"
 
+#include "config/configuration.h"
 #include "storage/fs_utils.h"
 #include "storage/log_replayer.h"
 #include "storage/logger.h"
@@ -19,13 +20,28 @@
 #include <seastar/core/future.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/core/seastar.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/core/thread.hh>
 
 #include <fmt/format.h>
 
 #include <exception>
+#include <numeric>
 
 namespace storage {
+
+/*
+ * Shard wide bound on the number of segment files opened and verified in
+ * parallel during startup recovery. The semaphore is shared by every log on
+ * the shard so that a node with thousands of partitions fans out without
+ * unbounded file handle and memory usage.
+ */
+static ss::semaphore& recovery_concurrency() {
+    static thread_local ss::semaphore sem{
+      config::shard_local_cfg().storage_recovery_concurrency()};
+    return sem;
+}
+
 struct segment_ordering {
     using type = ss::lw_shared_ptr<segment>;
     bool operator()(const type& seg1, const type& seg2) const {
@@ -42,6 +58,10 @@ struct segment_ordering {
 segment_set::segment_set(segment_set::underlying_t segs)
   : _handles(std::move(segs)) {
     std::sort(_handles.begin(), _handles.end(), segment_ordering{});
+    _base_offsets.reserve(_handles.size());
+    for (auto& s : _handles) {
+        _base_offsets.push_back(s->offsets().base_offset);
+    }
 }
 
 void segment_set::add(ss::lw_shared_ptr<segment> h) {
@@ -55,12 +75,23 @@ void segment_set::add(ss::lw_shared_ptr<segment> h) {
           *h,
           *this);
     }
+    _base_offsets.push_back(h->offsets().base_offset);
     _handles.emplace_back(std::move(h));
 }
 
-void segment_set::pop_back() { _handles.pop_back(); }
-void segment_set::pop_front() { _handles.pop_front(); }
+void segment_set::pop_back() {
+    _handles.pop_back();
+    _base_offsets.pop_back();
+}
+void segment_set::pop_front() {
+    _handles.pop_front();
+    _base_offsets.erase(_base_offsets.begin());
+}
 void segment_set::erase(iterator begin, iterator end) {
+    auto first = std::distance(_handles.begin(), begin);
+    auto last = std::distance(_handles.begin(), end);
+    _base_offsets.erase(
+      _base_offsets.begin() + first, _base_offsets.begin() + last);
     _handles.erase(begin, end);
 }
 
@@ -107,19 +138,54 @@ Iterator segments_lower_bound(Iterator begin, Iterator end, Needle needle) {
     return end;
 }
 
-/// lower_bound returns the element that is _strictly_ greater than or equal
-/// to bucket->dirty_offset() - see comparator above because our offsets are
-/// _inclusive_ we must check the previous iterator in the case that we are at
-/// the end, we also check the last element.
+bool segment_set::segment_contains(size_t i, model::offset o) const {
+    auto& s = *_handles[i];
+    if (s.empty()) {
+        return false;
+    }
+    return o >= s.offsets().base_offset && o <= s.offsets().dirty_offset;
+}
+
+/// segments are ordered and non overlapping, so the only candidate for an
+/// offset is the last segment whose base offset is not greater than it. a
+/// sequential consumer resolves into the same segment - or its successor
+/// right after crossing a boundary - thousands of times in a row, so both
+/// are checked before searching. the search itself runs over the packed
+/// base offset array: eight offsets per cache line instead of a shared
+/// pointer dereference per comparison.
+size_t segment_set::index_of(model::offset o) const {
+    const size_t n = _handles.size();
+    if (n == 0) {
+        return n;
+    }
+    if (_hint < n) {
+        if (segment_contains(_hint, o)) {
+            return _hint;
+        }
+        if (_hint + 1 < n && segment_contains(_hint + 1, o)) {
+            return ++_hint;
+        }
+    }
+    auto it = std::upper_bound(_base_offsets.begin(), _base_offsets.end(), o);
+    if (it == _base_offsets.begin()) {
+        return n;
+    }
+    auto idx = static_cast<size_t>(
+      std::distance(_base_offsets.begin(), std::prev(it)));
+    if (!segment_contains(idx, o)) {
+        return n;
+    }
+    _hint = idx;
+    return idx;
+}
+
 segment_set::iterator segment_set::lower_bound(model::offset offset) {
-    return segments_lower_bound(
-      std::begin(_handles), std::end(_handles), offset);
+    return std::next(std::begin(_handles), index_of(offset));
 }
 
 segment_set::const_iterator
 segment_set::lower_bound(model::offset offset) const {
-    return segments_lower_bound(
-      std::cbegin(_handles), std::cend(_handles), offset);
+    return std::next(std::cbegin(_handles), index_of(offset));
 }
 // Lower bound for timestamp based indexing
 //
@@ -162,32 +228,49 @@ unsafe_do_recover(segment_set&& segments, ss::abort_source& as) {
         segment_set::underlying_t to_recover;
         to_recover.push_back(std::move(good.back()));
         good.pop_back(); // always recover last segment
-        // keep segments sorted
-        auto good_end = std::stable_partition(
-          good.begin(), good.end(), [](ss::lw_shared_ptr<segment>& ss) {
-              auto& s = *ss;
-              try {
-                  // use the segment materialize instead of going through
-                  // the index directly to hydrate the max_offset state
-                  return s.materialize_index().get0();
-              } catch (...) {
-                  vlog(
-                    stlog.info,
-                    "Error materializing index:{}. Recovering parent "
-                    "segment:{}. Details:{}",
-                    s.index().filename(),
-                    s.reader().filename(),
-                    std::current_exception());
-              }
-              return false;
-          });
-        std::move(
-          std::move_iterator(good_end),
-          std::move_iterator(good.end()),
-          std::back_inserter(to_recover));
-        good.erase(
-          good_end,
-          good.end()); // remove all the ones we copied into recover
+        /*
+         * hydrate the index of every closed segment with bounded
+         * parallelism. use the segment materialize instead of going through
+         * the index directly to hydrate the max_offset state. segments whose
+         * index cannot be materialized fall through to full replay below.
+         */
+        std::vector<char> materialized(good.size(), 0);
+        std::vector<size_t> indices(good.size());
+        std::iota(indices.begin(), indices.end(), size_t(0));
+        ss::parallel_for_each(
+          indices,
+          [&good, &materialized](size_t i) {
+              return ss::with_semaphore(
+                recovery_concurrency(), 1, [&good, &materialized, i] {
+                    auto& s = *good[i];
+                    return s.materialize_index()
+                      .then([&materialized, i](bool hydrated) {
+                          materialized[i] = hydrated ? 1 : 0;
+                      })
+                      .handle_exception([&s](const std::exception_ptr& e) {
+                          vlog(
+                            stlog.info,
+                            "Error materializing index:{}. Recovering parent "
+                            "segment:{}. Details:{}",
+                            s.index().filename(),
+                            s.reader().filename(),
+                            e);
+                      });
+                });
+          })
+          .get();
+        // keep segments sorted, preserving the relative order of both the
+        // verified set and the set that needs replay
+        segment_set::underlying_t verified;
+        verified.reserve(good.size());
+        for (size_t i = 0; i < good.size(); ++i) {
+            if (materialized[i]) {
+                verified.push_back(std::move(good[i]));
+            } else {
+                to_recover.push_back(std::move(good[i]));
+            }
+        }
+        good = std::move(verified);
 
         // remove empty segments
         auto non_empty_end = std::stable_partition(
@@ -290,16 +373,11 @@ static ss::future<segment_set::underlying_t> open_segments(
     using segs_type = segment_set::underlying_t;
     return ss::do_with(
       segs_type{},
+      std::vector<std::filesystem::path>{},
       [&as, cache_factory, sanitize_fileops, dir = std::move(dir)](
-        segs_type& segs) {
+        segs_type& segs, std::vector<std::filesystem::path>& paths) {
           auto f = directory_walker::walk(
-            dir,
-            [&as, cache_factory, dir, sanitize_fileops, &segs](
-              ss::directory_entry seg) {
-                // abort if requested
-                if (as.abort_requested()) {
-                    return ss::now();
-                }
+            dir, [dir, &paths](ss::directory_entry seg) {
                 /*
                  * Skip non-regular files (including links)
                  */
@@ -319,19 +397,41 @@ static ss::future<segment_set::underlying_t> open_segments(
                     // not a reader filename
                     return ss::make_ready_future<>();
                 }
-                return open_segment(path, sanitize_fileops, cache_factory())
-                  .then([&segs](ss::lw_shared_ptr<segment> p) {
-                      segs.push_back(std::move(p));
-                  });
+                paths.push_back(std::move(path));
+                return ss::make_ready_future<>();
             });
           /*
-           * if the directory walker returns an exceptional future then all
-           * the segment readers that were created are cleaned up by
-           * ss::do_with.
+           * open the segments with bounded parallelism. the order segments
+           * are opened in is irrelevant, the resulting set is sorted by base
+           * offset. if the directory walker or any open returns an
+           * exceptional future then all the segment readers that were
+           * created are cleaned up by ss::do_with.
            */
-          return f.then([&segs]() mutable {
-              return ss::make_ready_future<segs_type>(std::move(segs));
-          });
+          return f
+            .then([&as, cache_factory, sanitize_fileops, &segs, &paths] {
+                return ss::parallel_for_each(
+                  paths,
+                  [&as, cache_factory, sanitize_fileops, &segs](
+                    const std::filesystem::path& path) {
+                      return ss::with_semaphore(
+                        recovery_concurrency(),
+                        1,
+                        [&as, cache_factory, sanitize_fileops, &segs, &path] {
+                            // abort if requested
+                            if (as.abort_requested()) {
+                                return ss::now();
+                            }
+                            return open_segment(
+                                     path, sanitize_fileops, cache_factory())
+                              .then([&segs](ss::lw_shared_ptr<segment> p) {
+                                  segs.push_back(std::move(p));
+                              });
+                        });
+                  });
+            })
+            .then([&segs]() mutable {
+                return ss::make_ready_future<segs_type>(std::move(segs));
+            });
       });
 }
 
@@ -16,6 +16,7 @@
 #include <seastar/core/circular_buffer.hh>
 
 #include <deque>
+#include <vector>
 
 namespace storage {
 /*
@@ -69,6 +70,11 @@ public:
     type& operator[](size_t i) { return _handles[i]; }
     const type& operator[](size_t i) const { return _handles[i]; }
 
+    /// resolves the segment containing @o. sequential consumers are served
+    /// from a last-hit hint (same or next segment) without searching; a
+    /// miss binary searches a dense base offset array kept alongside the
+    /// segment pointers, so probes touch packed offsets instead of chasing
+    /// a pointer per comparison
     iterator lower_bound(model::offset o);
     const_iterator lower_bound(model::offset o) const;
     iterator lower_bound(model::timestamp o);
@@ -82,7 +88,18 @@ public:
     const_iterator end() const { return _handles.end(); }
 
 private:
+    /// true when segment @i is non-empty and covers @o
+    bool segment_contains(size_t i, model::offset o) const;
+    /// index of the segment containing @o, or size() when none does.
+    /// refreshes _hint on success
+    size_t index_of(model::offset o) const;
+
     underlying_t _handles;
+    // base offsets of _handles, same order. base offsets are immutable for
+    // the lifetime of a segment so the array only changes with membership
+    std::vector<model::offset> _base_offsets;
+    // last segment index resolved by offset lookup; validated before use
+    mutable size_t _hint{0};
 
     friend std::ostream& operator<<(std::ostream&, const segment_set&);
 };
@@ -10,6 +10,7 @@
 #include "storage/segment_utils.h"
 
 #include "bytes/iobuf_parser.h"
+#include "config/configuration.h"
 #include "likely.h"
 #include "model/adl_serde.h"
 #include "model/fundamental.h"
@@ -19,11 +20,13 @@
 #include "storage/compacted_index.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compaction_reducers.h"
+#include "storage/file_handle_cache.h"
 #include "storage/index_state.h"
 #include "storage/lock_manager.h"
 #include "storage/log_reader.h"
 #include "storage/logger.h"
 #include "storage/ntp_config.h"
+#include "storage/parser.h"
 #include "storage/parser_utils.h"
 #include "storage/segment.h"
 #include "storage/types.h"
@@ -99,6 +102,16 @@ ss::future<ss::file> make_reader_handle(
       debug);
 }
 
+ss::future<ss::file> make_cached_reader_handle(
+  const std::filesystem::path& path, storage::debug_sanitize_files debug) {
+    auto f = ss::file(ss::make_shared<cached_file_impl>(
+      path.string(),
+      ss::open_flags::ro | ss::open_flags::create,
+      ss::file_open_options{},
+      file_handles()));
+    return ss::make_ready_future<ss::file>(wrap_handle(std::move(f), debug));
+}
+
 ss::future<compacted_index_writer> make_compacted_index_writer(
   const std::filesystem::path& path,
   debug_sanitize_files debug,
@@ -138,7 +151,13 @@ ss::future<segment_appender_ptr> make_segment_appender(
               // 1MB of memory aligned buffers
               return ss::make_ready_future<segment_appender_ptr>(
                 std::make_unique<segment_appender>(
-                  writer, segment_appender::options(iopc, number_of_chunks)));
+                  writer,
+                  segment_appender::options(
+                    iopc,
+                    number_of_chunks,
+                    falloc_step_from_config(),
+                    config::shard_local_cfg()
+                      .segment_appender_chained_flushes())));
           } catch (...) {
               auto e = std::current_exception();
               vlog(stlog.error, "could not allocate appender: {}", e);
@@ -149,6 +168,13 @@ ss::future<segment_appender_ptr> make_segment_appender(
       });
 }
 
+size_t falloc_step_from_config() {
+    const auto step = config::shard_local_cfg().segment_fallocation_step();
+    // 0 means the startup io probe did not run (e.g. tests); keep the
+    // compiled-in default
+    return step == 0 ? segment_appender::fallocation_step : step;
+}
+
 size_t number_of_chunks_from_config(const ntp_config& ntpc) {
     if (!ntpc.has_overrides()) {
         return segment_appender::chunks_no_buffer;
@@ -315,7 +341,8 @@ ss::future<storage::index_state> do_copy_segment_data(
               .then([l = std::move(list), &pb, h = std::move(h), cfg, s](
                       segment_appender_ptr w) mutable {
                   auto raw = w.get();
-                  auto red = copy_data_segment_reducer(std::move(l), raw);
+                  auto red = copy_data_segment_reducer(
+                    std::move(l), raw, cfg.recompression);
                   auto r = create_segment_full_reader(s, cfg, pb, std::move(h));
                   return std::move(r)
                     .consume(std::move(red), model::no_timeout)
@@ -384,37 +411,27 @@ ss::future<> do_swap_data_file_handles(
                 pb.delete_segment(*s.get());
                 std::swap(s->reader(), r);
                 pb.add_initial_segment(*s.get());
+                // the data file was rewritten, prior scrub results no
+                // longer describe the bytes on disk
+                s->clear_crc_scrubbed();
             });
       });
 }
 
-ss::future<> do_self_compact_segment(
-  ss::lw_shared_ptr<segment> s, compaction_config cfg, storage::probe& pb) {
-    return s->read_lock()
-      .then([cfg, s, &pb](ss::rwlock::holder h) {
+// swap the staged data file produced by a rewrite into the segment and
+// replace the offset index with the freshly built state
+ss::future<> install_rewritten_segment(
+  ss::lw_shared_ptr<segment> s, compaction_config cfg, storage::probe& pb,
+  storage::index_state idx) {
+    return s->write_lock()
+      .then([s, idx = std::move(idx)](ss::rwlock::holder h) mutable {
+          using type = std::tuple<index_state, ss::rwlock::holder>;
           if (s->is_closed()) {
-              return ss::make_exception_future<index_state>(
+              return ss::make_exception_future<type>(
                 segment_closed_exception());
           }
-
-          return do_compact_segment_index(s, cfg)
-            // copy the bytes after segment is good - note that we
-            // need to do it with the READ-lock, not the write lock
-            .then([cfg, s, h = std::move(h), &pb]() mutable {
-                return do_copy_segment_data(s, cfg, pb, std::move(h));
-            });
-      })
-      .then([s](storage::index_state idx) {
-          return s->write_lock().then(
-            [s, idx = std::move(idx)](ss::rwlock::holder h) mutable {
-                using type = std::tuple<index_state, ss::rwlock::holder>;
-                if (s->is_closed()) {
-                    return ss::make_exception_future<type>(
-                      segment_closed_exception());
-                }
-                return ss::make_ready_future<type>(
-                  std::make_tuple(std::move(idx), std::move(h)));
-            });
+          return ss::make_ready_future<type>(
+            std::make_tuple(std::move(idx), std::move(h)));
       })
       .then([cfg, s, &pb](std::tuple<index_state, ss::rwlock::holder> h) {
           return s->index()
@@ -434,16 +451,150 @@ ss::future<> do_self_compact_segment(
       });
 }
 
+ss::future<> do_self_compact_segment(
+  ss::lw_shared_ptr<segment> s, compaction_config cfg, storage::probe& pb) {
+    return s->read_lock()
+      .then([cfg, s, &pb](ss::rwlock::holder h) {
+          if (s->is_closed()) {
+              return ss::make_exception_future<index_state>(
+                segment_closed_exception());
+          }
+
+          return do_compact_segment_index(s, cfg)
+            // copy the bytes after segment is good - note that we
+            // need to do it with the READ-lock, not the write lock
+            .then([cfg, s, h = std::move(h), &pb]() mutable {
+                return do_copy_segment_data(s, cfg, pb, std::move(h));
+            });
+      })
+      .then([cfg, s, &pb](storage::index_state idx) {
+          return install_rewritten_segment(s, cfg, pb, std::move(idx));
+      });
+}
+
+ss::future<storage::index_state> do_recompress_segment_data(
+  ss::lw_shared_ptr<segment> s,
+  model::compression target,
+  compaction_config cfg,
+  storage::probe& pb,
+  ss::rwlock::holder h) {
+    const auto tmpname = data_segment_staging_name(s);
+    return make_segment_appender(
+             tmpname, cfg.sanitize, segment_appender::chunks_no_buffer, cfg.iopc)
+      .then([target, &pb, h = std::move(h), cfg, s](
+              segment_appender_ptr w) mutable {
+          auto raw = w.get();
+          // no offset list - every record is kept, only the encoding changes
+          auto red = copy_data_segment_reducer(std::nullopt, raw, target);
+          auto r = create_segment_full_reader(s, cfg, pb, std::move(h));
+          return std::move(r)
+            .consume(std::move(red), model::no_timeout)
+            .finally([raw, w = std::move(w)]() mutable {
+                return raw->close()
+                  .handle_exception([](std::exception_ptr e) {
+                      vlog(
+                        stlog.error,
+                        "Error closing recompressed segment:{}",
+                        e);
+                  })
+                  .finally([w = std::move(w)] {});
+            });
+      });
+}
+
+ss::future<> recompress_segment(
+  ss::lw_shared_ptr<segment> s,
+  model::compression target,
+  compaction_config cfg,
+  storage::probe& pb) {
+    if (s->has_appender()) {
+        return ss::make_exception_future<>(std::runtime_error(fmt::format(
+          "Cannot recompress an active segment. cfg:{} - segment:{}", cfg, s)));
+    }
+    if (s->finished_recompression()) {
+        return ss::now();
+    }
+    vlog(
+      stlog.debug,
+      "recompressing {} with {}",
+      s->reader().filename(),
+      target);
+    return s->read_lock()
+      .then([target, cfg, s, &pb](ss::rwlock::holder h) {
+          if (s->is_closed()) {
+              return ss::make_exception_future<index_state>(
+                segment_closed_exception());
+          }
+          return do_recompress_segment_data(s, target, cfg, pb, std::move(h));
+      })
+      .then([cfg, s, &pb](storage::index_state idx) {
+          return install_rewritten_segment(s, cfg, pb, std::move(idx));
+      })
+      .then([s] { s->mark_as_finished_recompression(); });
+}
+
+namespace {
+/**
+ * Key-only parser consumer feeding the compacted index writer. The index
+ * needs nothing but keys and offsets, so the parser is asked to seek past
+ * value and header bytes - for the typical value heavy workload this is
+ * almost the entire segment.
+ */
+class index_rebuild_key_consumer final : public batch_consumer {
+public:
+    explicit index_rebuild_key_consumer(compacted_index_writer* w) noexcept
+      : _w(w) {}
+
+    consume_result consume_batch_start(
+      model::record_batch_header header, size_t, size_t) final {
+        _base_offset = header.base_offset;
+        return skip_batch::no;
+    }
+
+    keys_only wants_keys_only() const final { return keys_only::yes; }
+
+    ss::future<> consume_record_key(int32_t offset_delta, iobuf&& key) final {
+        return ss::do_with(std::move(key), [this, offset_delta](iobuf& key) {
+            return _w->index(key, _base_offset, offset_delta);
+        });
+    }
+
+    void consume_records(iobuf&&) final {}
+    stop_parser consume_batch_end() final { return stop_parser::no; }
+
+    void print(std::ostream& os) const final {
+        os << "{index_rebuild_key_consumer}";
+    }
+
+private:
+    compacted_index_writer* _w;
+    model::offset _base_offset;
+};
+} // namespace
+
 ss::future<> rebuild_compaction_index(
-  model::record_batch_reader rdr,
+  ss::lw_shared_ptr<segment> s,
   std::filesystem::path p,
   compaction_config cfg) {
     return make_compacted_index_writer(p, cfg.sanitize, cfg.iopc)
-      .then([r = std::move(rdr)](compacted_index_writer w) mutable {
+      .then([s, cfg](compacted_index_writer w) mutable {
           auto u = std::make_unique<compacted_index_writer>(std::move(w));
           auto ptr = u.get();
-          return std::move(r)
-            .consume(index_rebuilder_reducer(ptr), model::no_timeout)
+          auto parser = std::make_unique<continuous_batch_parser>(
+            std::make_unique<index_rebuild_key_consumer>(ptr),
+            s->reader().data_stream(0, cfg.iopc));
+          auto raw_parser = parser.get();
+          return raw_parser->consume()
+            .then([](result<size_t> r) {
+                if (!r) {
+                    return ss::make_exception_future<>(
+                      std::runtime_error(fmt::format(
+                        "error rebuilding compacted index: {}", r.error())));
+                }
+                return ss::now();
+            })
+            .finally(
+              [parser = std::move(parser)] { return parser->close(); })
             .then_wrapped([x = std::move(u)](ss::future<> fut) mutable {
                 return x->close()
                   .handle_exception([](std::exception_ptr e) {
@@ -486,11 +637,9 @@ ss::future<> self_compact_segment(
                   idx_path);
                 pb.corrupted_compaction_index();
                 return s->read_lock()
-                  .then([s, cfg, &pb, idx_path](ss::rwlock::holder h) {
-                      return rebuild_compaction_index(
-                        create_segment_full_reader(s, cfg, pb, std::move(h)),
-                        idx_path,
-                        cfg);
+                  .then([s, cfg, idx_path](ss::rwlock::holder h) {
+                      return rebuild_compaction_index(s, idx_path, cfg)
+                        .finally([h = std::move(h)] {});
                   })
                   .then([s, cfg, &pb, idx_path] {
                       vlog(
@@ -662,4 +811,11 @@ bytes start_offset_key(model::ntp ntp) {
     return iobuf_to_bytes(buf);
 }
 
+bytes crc_scrub_key(model::ntp ntp, model::offset segment_base_offset) {
+    iobuf buf;
+    reflection::serialize(
+      buf, kvstore_key_type::crc_scrub, std::move(ntp), segment_base_offset);
+    return iobuf_to_bytes(buf);
+}
+
 } // namespace storage::internal
@@ -35,6 +35,15 @@ ss::future<> self_compact_segment(
   storage::compaction_config,
   storage::probe&);
 
+/// \brief rewrite a rolled segment in place re-encoding every batch with the
+/// target codec. keeps all records - used for non-compacted topics with a
+/// recompression override. acquires it's own locks on the segment
+ss::future<> recompress_segment(
+  ss::lw_shared_ptr<storage::segment>,
+  model::compression,
+  storage::compaction_config,
+  storage::probe&);
+
 /*
  * Concatentate segments into a minimal new segment.
  *
@@ -82,6 +91,11 @@ make_writer_handle(const std::filesystem::path&, storage::debug_sanitize_files);
 /// make file handle with default opts
 ss::future<ss::file>
 make_reader_handle(const std::filesystem::path&, storage::debug_sanitize_files);
+/// make a lazy reader handle: the kernel fd materializes on first read
+/// through the shard's bounded file_handle_cache and idle cold handles
+/// are closed and reopened transparently
+ss::future<ss::file> make_cached_reader_handle(
+  const std::filesystem::path&, storage::debug_sanitize_files);
 
 ss::future<compacted_index_writer> make_compacted_index_writer(
   const std::filesystem::path& path,
@@ -96,6 +110,8 @@ ss::future<segment_appender_ptr> make_segment_appender(
 
 size_t number_of_chunks_from_config(const storage::ntp_config&);
 
+size_t falloc_step_from_config();
+
 /*
 1. if footer.flags == truncate write new .compacted_index file
 2. produce list of dedup'd (base_offset,delta) - in memory
@@ -155,8 +171,10 @@ size_t
 // key types used to store data in key-value store
 enum class kvstore_key_type : int8_t {
     start_offset = 0,
+    crc_scrub = 1,
 };
 
 bytes start_offset_key(model::ntp ntp);
+bytes crc_scrub_key(model::ntp ntp, model::offset segment_base_offset);
 
 } // namespace storage::internal
@@ -45,8 +45,32 @@ spill_key_index::~spill_key_index() {
       _midx.size());
 }
 
+/**
+ * Keys that cannot fit in an index entry used to be blindly truncated when
+ * spilled, aliasing every pair of distinct keys that shares a long prefix. We
+ * now reduce them up front to a prefix plus the xxhash of the full key. This
+ * bounds the in-memory footprint of a wide key, keeps the on-disk entry
+ * format unchanged, and shrinks the aliasing window to a 64-bit hash
+ * collision on top of an identical prefix.
+ */
+bytes spill_key_index::reduce_key(bytes_view v) {
+    static constexpr size_t prefix_size = max_key_size - sizeof(uint64_t);
+    const uint64_t hash = xxh3_64(v.data(), v.size());
+    bytes reduced(bytes::initialized_later{}, max_key_size);
+    std::copy_n(v.data(), prefix_size, reduced.begin());
+    std::copy_n(
+      // NOLINTNEXTLINE
+      reinterpret_cast<const uint8_t*>(&hash),
+      sizeof(hash),
+      reduced.begin() + prefix_size);
+    return reduced;
+}
+
 ss::future<>
 spill_key_index::index(bytes_view v, model::offset base_offset, int32_t delta) {
+    if (unlikely(v.size() > max_key_size)) {
+        return index(reduce_key(v), base_offset, delta);
+    }
     if (auto it = _midx.find(v); it != _midx.end()) {
         auto& pair = it->second;
         if (base_offset > pair.base_offset) {
@@ -67,9 +91,16 @@ ss::future<> spill_key_index::add_key(bytes b, value_type v) {
     if (expected_size >= _max_mem) {
         f = ss::do_until(
           [this, key_size] {
-              // stop condition
+              /*
+               * stop condition; drain down to half the limit instead of just
+               * below it. evicting a single entry would leave the index
+               * pinned at the limit and make every subsequent insert pay for
+               * another spill - draining a batch amortizes the evictions
+               * across many inserts
+               */
               return _midx.empty()
-                     || idx_mem_usage() + _keys_mem_usage + key_size < _max_mem;
+                     || idx_mem_usage() + _keys_mem_usage + key_size
+                          < _max_mem / 2;
           },
           [this] {
               /**
@@ -98,6 +129,9 @@ ss::future<> spill_key_index::add_key(bytes b, value_type v) {
 
 ss::future<>
 spill_key_index::index(bytes&& b, model::offset base_offset, int32_t delta) {
+    if (unlikely(b.size() > max_key_size)) {
+        b = reduce_key(b);
+    }
     if (auto it = _midx.find(b); it != _midx.end()) {
         auto& pair = it->second;
         // must use both base+delta, since we only want to keep the latest
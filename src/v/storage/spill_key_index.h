@@ -22,7 +22,7 @@
 #include <seastar/core/file.hh>
 #include <seastar/core/future.hh>
 
-#include <absl/container/node_hash_map.h>
+#include <absl/container/flat_hash_map.h>
 #include <absl/hash/hash.h>
 namespace storage::internal {
 using namespace storage; // NOLINT
@@ -35,10 +35,10 @@ public:
     static constexpr auto value_sz = sizeof(value_type);
     static constexpr size_t max_key_size = compacted_index::max_entry_size
                                            - (2 * vint::max_length);
-    using underlying_t = absl::node_hash_map<
+    using underlying_t = absl::flat_hash_map<
       bytes,
       value_type,
-      bytes_hasher<uint64_t, xxhash_64>,
+      bytes_hasher<uint64_t, xxh3_64>,
       bytes_type_eq>;
 
     spill_key_index(
@@ -77,6 +77,7 @@ private:
     ss::future<> drain_all_keys();
     ss::future<> add_key(bytes b, value_type);
     ss::future<> spill(compacted_index::entry_type, bytes_view, value_type);
+    static bytes reduce_key(bytes_view);
 
     segment_appender _appender;
     underlying_t _midx;
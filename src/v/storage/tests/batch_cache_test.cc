@@ -140,6 +140,43 @@ SEASTAR_THREAD_TEST_CASE(touch) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(scan_resistance) {
+    static storage::batch_cache::reclaim_options opts = {
+      .growth_window = std::chrono::milliseconds(3000),
+      .stable_window = std::chrono::milliseconds(10000),
+      .min_size = 1,
+      .max_size = 1,
+    };
+
+    std::unique_ptr<storage::batch_cache_index> index;
+
+    storage::batch_cache c(opts);
+    index = std::make_unique<storage::batch_cache_index>(c);
+
+    // a re-referenced batch is promoted off the probationary list
+    auto hot = c.put(*index, make_batch(10));
+    c.touch(hot);
+
+    // a scan inserts batches that are never read twice
+    auto scan0 = c.put(*index, make_batch(10));
+    auto scan1 = c.put(*index, make_batch(10));
+
+    // reclaim frees the probationary scan insertions before the older but
+    // re-referenced working set
+    c.reclaim(1);
+    BOOST_CHECK(hot);
+    BOOST_CHECK(!scan0);
+    BOOST_CHECK(scan1);
+
+    c.reclaim(1);
+    BOOST_CHECK(hot);
+    BOOST_CHECK(!scan1);
+
+    // with the probationary list drained the main list is reclaimed
+    c.reclaim(1);
+    BOOST_CHECK(!hot);
+}
+
 SEASTAR_THREAD_TEST_CASE(index_get_empty) {
     storage::batch_cache cache(opts);
     storage::batch_cache_index index(cache);
@@ -202,6 +239,37 @@ SEASTAR_THREAD_TEST_CASE(index_get) {
     BOOST_CHECK(!index2.get(model::offset(40)));
 }
 
+SEASTAR_THREAD_TEST_CASE(index_put_range) {
+    storage::batch_cache cache(opts);
+    storage::batch_cache_index index(cache);
+
+    // pre-existing entry: put_range must not clobber it
+    index.put(make_batch(10, model::offset(11)));
+
+    // [10][11:20][21:30]
+    ss::circular_buffer<model::record_batch> batches;
+    batches.push_back(make_batch(1, model::offset(10)));
+    batches.push_back(make_batch(10, model::offset(11)));
+    batches.push_back(make_batch(10, model::offset(21)));
+    index.put_range(batches);
+
+    BOOST_REQUIRE(index.get(model::offset(10)));
+    BOOST_REQUIRE(index.get(model::offset(15)));
+    BOOST_REQUIRE(index.get(model::offset(30)));
+    BOOST_CHECK(!index.get(model::offset(31)));
+
+    // the whole range is readable back as one contiguous read
+    auto rr = index.read(
+      model::offset(10),
+      model::offset(30),
+      std::nullopt,
+      std::nullopt,
+      std::numeric_limits<size_t>::max(),
+      false);
+    BOOST_CHECK(rr.batches.size() == 3);
+    BOOST_CHECK(rr.next_batch == model::offset(31));
+}
+
 SEASTAR_THREAD_TEST_CASE(index_truncate_smoke) {
     storage::batch_cache cache(opts);
     storage::batch_cache_index index(cache);
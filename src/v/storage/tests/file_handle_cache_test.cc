@@ -0,0 +1,81 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/file_handle_cache.h"
+#include "storage/segment_utils.h"
+#include "storage/types.h"
+
+#include <seastar/core/seastar.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <fmt/format.h>
+
+using namespace storage; // NOLINT
+
+static ss::file make_handle(size_t i) {
+    return internal::make_cached_reader_handle(
+             std::filesystem::path(
+               fmt::format("file_handle_cache_test_{}", i)),
+             debug_sanitize_files::no)
+      .get0();
+}
+
+SEASTAR_THREAD_TEST_CASE(handles_open_lazily) {
+    auto& cache = internal::file_handles();
+    cache.set_capacity(4);
+    auto before = cache.open_handles();
+    auto f = make_handle(0);
+    // no kernel handle until the first operation
+    BOOST_REQUIRE_EQUAL(cache.open_handles(), before);
+    BOOST_REQUIRE_EQUAL(f.size().get0(), 0);
+    BOOST_REQUIRE_EQUAL(cache.open_handles(), before + 1);
+    f.close().get();
+    BOOST_REQUIRE_EQUAL(cache.open_handles(), before);
+    cache.set_capacity(internal::file_handle_cache::default_capacity);
+}
+
+SEASTAR_THREAD_TEST_CASE(cold_handles_are_evicted_and_reopen) {
+    auto& cache = internal::file_handles();
+    cache.set_capacity(2);
+    std::vector<ss::file> files;
+    files.reserve(5);
+    for (size_t i = 0; i < 5; ++i) {
+        files.push_back(make_handle(i));
+        files.back().size().get0();
+        BOOST_REQUIRE_LE(cache.open_handles(), 2);
+    }
+    // the first handle went cold and was closed; using it again must
+    // reopen transparently
+    BOOST_REQUIRE_EQUAL(files.front().size().get0(), 0);
+    BOOST_REQUIRE_LE(cache.open_handles(), 2);
+    for (auto& f : files) {
+        f.close().get();
+    }
+    BOOST_REQUIRE_EQUAL(cache.open_handles(), 0);
+    cache.set_capacity(internal::file_handle_cache::default_capacity);
+}
+
+SEASTAR_THREAD_TEST_CASE(shrinking_capacity_closes_idle_handles) {
+    auto& cache = internal::file_handles();
+    cache.set_capacity(8);
+    std::vector<ss::file> files;
+    files.reserve(4);
+    for (size_t i = 0; i < 4; ++i) {
+        files.push_back(make_handle(i));
+        files.back().size().get0();
+    }
+    BOOST_REQUIRE_EQUAL(cache.open_handles(), 4);
+    cache.set_capacity(1);
+    BOOST_REQUIRE_LE(cache.open_handles(), 1);
+    for (auto& f : files) {
+        f.close().get();
+    }
+    cache.set_capacity(internal::file_handle_cache::default_capacity);
+}
@@ -0,0 +1,105 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "bytes/iobuf.h"
+#include "model/record_utils.h"
+#include "random/generators.h"
+#include "seastarx.h"
+#include "storage/parser.h"
+#include "storage/parser_utils.h"
+#include "storage/segment_appender.h"
+#include "storage/segment_appender_utils.h"
+#include "storage/tests/utils/random_batch.h"
+#include "utils/file_sanitizer.h"
+
+#include <seastar/core/fstream.hh>
+#include <seastar/core/thread.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <memory>
+
+using namespace storage; // NOLINT
+
+namespace {
+struct key_collector final : batch_consumer {
+    consume_result consume_batch_start(
+      model::record_batch_header header, size_t, size_t) final {
+        base_offset = header.base_offset;
+        return skip_batch::no;
+    }
+
+    keys_only wants_keys_only() const final { return keys_only::yes; }
+
+    ss::future<> consume_record_key(int32_t offset_delta, iobuf&& key) final {
+        keys.emplace_back(
+          base_offset + model::offset(offset_delta), iobuf_to_bytes(key));
+        return ss::make_ready_future<>();
+    }
+
+    void consume_records(iobuf&&) final {
+        BOOST_FAIL("keys_only consumer must not receive full payloads");
+    }
+    stop_parser consume_batch_end() final { return stop_parser::no; }
+    void print(std::ostream& os) const final { os << "{key_collector}"; }
+
+    model::offset base_offset;
+    std::vector<std::pair<model::offset, bytes>> keys;
+};
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(key_only_scan_matches_full_parse) {
+    auto name = "test." + random_generators::gen_alphanum_string(20);
+    auto fd = ss::open_file_dma(
+                name, ss::open_flags::create | ss::open_flags::rw)
+                .get0();
+    fd = ss::file(ss::make_shared(file_io_sanitizer(std::move(fd))));
+    auto appender = segment_appender(
+      fd, segment_appender::options(ss::default_priority_class(), 1));
+
+    // compression allowed - the scan has to decompress those batches
+    auto batches = test::make_random_batches(model::offset(1), 10);
+    for (auto& b : batches) {
+        b.header().header_crc = model::internal_header_only_crc(b.header());
+        storage::write(appender, b).get();
+    }
+    appender.flush().get();
+
+    // expected keys via the full record parse
+    std::vector<std::pair<model::offset, bytes>> expected;
+    for (auto& b : batches) {
+        auto body = b.compressed()
+                      ? storage::internal::decompress_batch(b).get0()
+                      : b.share();
+        body.for_each_record(
+          [&expected, base = body.base_offset()](model::record r) {
+              expected.emplace_back(
+                base + model::offset(r.offset_delta()),
+                iobuf_to_bytes(r.key()));
+          });
+    }
+    BOOST_REQUIRE(!expected.empty());
+
+    auto collector = std::make_unique<key_collector>();
+    auto* keys = &collector->keys;
+    auto parser = continuous_batch_parser(
+      std::move(collector),
+      ss::make_file_input_stream(
+        ss::open_file_dma(name, ss::open_flags::ro).get0()));
+    auto consumed = parser.consume().get0();
+    parser.close().get();
+    appender.close().get();
+
+    BOOST_REQUIRE(bool(consumed));
+    BOOST_REQUIRE_EQUAL(keys->size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        BOOST_CHECK_EQUAL((*keys)[i].first, expected[i].first);
+        BOOST_CHECK((*keys)[i].second == expected[i].second);
+    }
+}
@@ -8,6 +8,8 @@
 // by the Apache License, Version 2.0
 
 #include "model/fundamental.h"
+#include "model/limits.h"
+#include "model/record_batch_reader.h"
 #include "model/record_utils.h"
 #include "random/generators.h"
 #include "storage/api.h"
@@ -17,6 +19,8 @@
 #include "storage/segment_appender_utils.h"
 #include "storage/segment_reader.h"
 #include "storage/tests/utils/random_batch.h"
+#include "storage/types.h"
+#include "utils/directory_walker.h"
 #include "utils/file_sanitizer.h"
 
 #include <seastar/core/thread.hh>
@@ -114,3 +118,49 @@ SEASTAR_THREAD_TEST_CASE(test_can_load_logs) {
     BOOST_CHECK(
       file_exists(seg4->reader().filename() + ".cannotrecover").get0());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_memory_backed_ntp_under_disk_manager) {
+    auto conf = make_config();
+    BOOST_REQUIRE(conf.stype == log_config::storage_type::disk);
+    storage::api store(
+      storage::kvstore_config(
+        1_MiB, 10ms, conf.base_dir, storage::debug_sanitize_files::yes),
+      conf);
+    store.start().get();
+    auto stop_kvstore = ss::defer([&store] { store.stop().get(); });
+    auto& m = store.log_mgr();
+
+    auto overrides = std::make_unique<ntp_config::default_overrides>();
+    overrides->memory_backed = in_memory_backed::yes;
+    auto ntp = model::ntp("kafka", "ephemeral", 0);
+    auto log
+      = m.manage(ntp_config(ntp, "test.dir", std::move(overrides))).get0();
+    BOOST_REQUIRE(log.config().is_memory_backed());
+
+    auto batches = test::make_random_batches(model::offset(0), 5);
+    auto expected = batches.size();
+    storage::log_append_config append_cfg{
+      storage::log_append_config::fsync::no,
+      ss::default_priority_class(),
+      model::no_timeout};
+    auto reader = model::make_memory_record_batch_reader(std::move(batches));
+    std::move(reader)
+      .for_each_ref(log.make_appender(append_cfg), append_cfg.timeout)
+      .get0();
+
+    // everything lives in memory, nothing was written to a segment
+    auto work_dir = std::filesystem::path(log.config().work_directory());
+    BOOST_CHECK(directory_walker::empty(work_dir).get0());
+
+    auto read = log
+                  .make_reader(log_reader_config(
+                    model::offset(0),
+                    model::model_limits<model::offset>::max(),
+                    ss::default_priority_class()))
+                  .get0();
+    auto read_batches = model::consume_reader_to_memory(
+                          std::move(read), model::no_timeout)
+                          .get0();
+    BOOST_CHECK_EQUAL(read_batches.size(), expected);
+    m.remove(ntp).get();
+}
@@ -95,6 +95,44 @@ FIXTURE_TEST(bucket_bug1, context) {
         BOOST_REQUIRE_EQUAL(p->filepos, 600121);
     }
 }
+FIXTURE_TEST(timequery_floor_lookup, context) {
+    // every batch is large enough to be indexed; timestamps grow by 100 per
+    // batch with a last timestamp 50 above the first
+    for (uint32_t i = 0; i < 10; ++i) {
+        _base_hdr.first_timestamp = model::timestamp(100 * i);
+        _base_hdr.max_timestamp = model::timestamp(100 * i + 50);
+        _idx->maybe_track(
+          modify_get(
+            model::offset(i * 10),
+            storage::segment_index::default_data_buffer_step),
+          i * 1000);
+    }
+    // below the base timestamp there is nothing to seek to
+    BOOST_REQUIRE(!_idx->find_nearest(model::timestamp(-1)));
+    // between two entries the scan must start at the earlier one so that no
+    // qualifying batch can be skipped
+    {
+        auto p = _idx->find_nearest(model::timestamp(125));
+        BOOST_REQUIRE(bool(p));
+        BOOST_REQUIRE_EQUAL(p->offset, model::offset(0));
+        BOOST_REQUIRE_EQUAL(p->filepos, 0);
+    }
+    // an exact match on an entry timestamp seeks to that entry
+    {
+        auto p = _idx->find_nearest(model::timestamp(450));
+        BOOST_REQUIRE(bool(p));
+        BOOST_REQUIRE_EQUAL(p->offset, model::offset(40));
+        BOOST_REQUIRE_EQUAL(p->filepos, 4000);
+    }
+    // past the end the scan starts at the last entry
+    {
+        auto p = _idx->find_nearest(model::timestamp(100000));
+        BOOST_REQUIRE(bool(p));
+        BOOST_REQUIRE_EQUAL(p->offset, model::offset(90));
+        BOOST_REQUIRE_EQUAL(p->filepos, 9000);
+    }
+}
+
 FIXTURE_TEST(bucket_truncate, context) {
     info("index: {}", _idx);
     info("Testing bucket truncate");
@@ -0,0 +1,76 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/fundamental.h"
+#include "storage/tests/disk_log_builder_fixture.h"
+#include "test_utils/fixture.h"
+
+static storage::log_reader_config reader_range_config(
+  model::offset start, model::offset max) {
+    return storage::log_reader_config(
+      start, max, ss::default_priority_class());
+}
+
+FIXTURE_TEST(reader_reused_across_sequential_fetches, log_builder_fixture) {
+    using namespace storage; // NOLINT
+
+    b | start() | add_segment(0)
+      | add_random_batch(0, 10, maybe_compress_batches::yes) | add_segment(10)
+      | add_random_batch(10, 10, maybe_compress_batches::yes);
+
+    // a fetch bounded below the end of the log leaves a reusable reader
+    auto first = b.consume(reader_range_config(model::offset(0),
+                                               model::offset(9)))
+                   .get0();
+    BOOST_REQUIRE_EQUAL(first.size(), 1);
+    BOOST_REQUIRE_EQUAL(first.front().base_offset(), model::offset(0));
+    BOOST_REQUIRE_EQUAL(b.get_disk_log_impl().reader_cache_size(), 1);
+
+    // the follow up fetch starts exactly where the first ended. a cache miss
+    // would park a second reader at the same offset, so the size staying at
+    // one proves the parked reader was re-armed
+    auto second = b
+                    .consume(reader_range_config(
+                      model::offset(10),
+                      model::model_limits<model::offset>::max()))
+                    .get0();
+    BOOST_REQUIRE_EQUAL(second.size(), 1);
+    BOOST_REQUIRE_EQUAL(second.front().base_offset(), model::offset(10));
+    BOOST_REQUIRE_EQUAL(b.get_disk_log_impl().reader_cache_size(), 1);
+
+    // a fetch that does not line up with the parked reader takes the slow
+    // path and the stream is still correct
+    auto all = b.consume().get0();
+    BOOST_REQUIRE_EQUAL(all.size(), 2);
+    b | stop();
+}
+
+FIXTURE_TEST(truncate_evicts_cached_readers, log_builder_fixture) {
+    using namespace storage; // NOLINT
+
+    b | start() | add_segment(0)
+      | add_random_batch(0, 10, maybe_compress_batches::yes) | add_segment(10)
+      | add_random_batch(10, 10, maybe_compress_batches::yes);
+
+    auto batches = b.consume(reader_range_config(model::offset(0),
+                                                 model::offset(9)))
+                     .get0();
+    BOOST_REQUIRE_EQUAL(batches.size(), 1);
+    BOOST_REQUIRE_EQUAL(b.get_disk_log_impl().reader_cache_size(), 1);
+
+    // truncation invalidates the parked reader - it holds segment read
+    // locks and its position may no longer exist
+    b | truncate_log(10);
+    BOOST_REQUIRE_EQUAL(b.get_disk_log_impl().reader_cache_size(), 0);
+
+    auto after = b.consume().get0();
+    BOOST_REQUIRE_EQUAL(after.size(), 1);
+    BOOST_REQUIRE_EQUAL(after.front().base_offset(), model::offset(0));
+    b | stop();
+}
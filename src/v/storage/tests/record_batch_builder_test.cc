@@ -126,3 +126,33 @@ SEASTAR_THREAD_TEST_CASE(serialize_deserialize_then_cmp) {
     });
     BOOST_CHECK_EQUAL(sample_data, sample_output);
 }
+
+SEASTAR_THREAD_TEST_CASE(reusable_builder) {
+    storage::record_batch_builder rbb(
+      model::record_batch_type(), model::offset(0));
+
+    rbb.add_raw_kv(
+      reflection::to_iobuf(ss::sstring("k0")),
+      reflection::to_iobuf(ss::sstring("v0")));
+    auto first = rbb.build_and_reset(model::offset(1));
+    BOOST_CHECK_EQUAL(first.record_count(), 1);
+    BOOST_CHECK_EQUAL(first.base_offset(), model::offset(0));
+
+    /// the builder is re-armed: the first batch's records must not leak
+    /// into the second and the new base offset must stick
+    rbb.add_raw_kv(
+      reflection::to_iobuf(ss::sstring("k1")),
+      reflection::to_iobuf(ss::sstring("v1")));
+    rbb.add_raw_kv(
+      reflection::to_iobuf(ss::sstring("k2")),
+      reflection::to_iobuf(ss::sstring("v2")));
+    auto second = std::move(rbb).build();
+    BOOST_CHECK_EQUAL(second.record_count(), 2);
+    BOOST_CHECK_EQUAL(second.base_offset(), model::offset(1));
+
+    second.for_each_record([](model::record r) {
+        iobuf_parser key_parser(r.release_key());
+        auto key = reflection::adl<ss::sstring>{}.from(key_parser);
+        BOOST_CHECK(key == "k1" || key == "k2");
+    });
+}
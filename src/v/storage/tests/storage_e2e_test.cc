@@ -1129,9 +1129,7 @@ FIXTURE_TEST(adjacent_segment_compaction, storage_test_fixture) {
     log.compact(c_cfg).get0();
     BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 4);
 
-    log.compact(c_cfg).get0();
-    BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 3);
-
+    // all three stable segments merge in a single window
     log.compact(c_cfg).get0();
     BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 2);
 
@@ -1202,6 +1200,61 @@ FIXTURE_TEST(adjacent_segment_compaction_terms, storage_test_fixture) {
     }
 }
 
+FIXTURE_TEST(recompression_rewrites_rolled_segments, storage_test_fixture) {
+    auto cfg = default_log_config(test_dir);
+    cfg.stype = storage::log_config::storage_type::disk;
+    // read from disk so the rewritten encoding is observable
+    cfg.cache = storage::with_cache::no;
+    storage::ntp_config::default_overrides overrides;
+    overrides.recompression = model::compression::zstd;
+
+    ss::abort_source as;
+    storage::log_manager mgr = make_log_manager(cfg);
+
+    info("config: {}", mgr.config());
+    auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get0(); });
+    auto ntp = model::ntp("default", "test", 0);
+    auto log = mgr
+                 .manage(storage::ntp_config(
+                   ntp,
+                   mgr.config().base_dir,
+                   std::make_unique<storage::ntp_config::default_overrides>(
+                     overrides)))
+                 .get0();
+
+    auto disk_log = get_disk_log(log);
+    append_single_record_batch(log, 20, model::term_id(1), 128);
+    disk_log->force_roll(ss::default_priority_class()).get();
+    append_single_record_batch(log, 10, model::term_id(1), 128);
+    log.flush().get0();
+    BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 2);
+
+    auto before = read_and_validate_all_batches(log);
+
+    storage::compaction_config c_cfg(
+      model::timestamp::min(), std::nullopt, ss::default_priority_class(), as);
+    log.compact(c_cfg).get0();
+
+    auto after = read_and_validate_all_batches(log);
+    BOOST_REQUIRE_EQUAL(after.size(), before.size());
+    const auto active_base = disk_log->segments().back()->offsets().base_offset;
+    for (size_t i = 0; i < after.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(after[i].base_offset(), before[i].base_offset());
+        BOOST_REQUIRE_EQUAL(after[i].record_count(), before[i].record_count());
+        // the rolled segment is rewritten with the target codec, the active
+        // segment keeps batches exactly as appended
+        const auto expected = after[i].base_offset() < active_base
+                                ? model::compression::zstd
+                                : before[i].header().attrs.compression();
+        BOOST_REQUIRE_EQUAL(after[i].header().attrs.compression(), expected);
+    }
+
+    // a second pass finds nothing left to rewrite
+    log.compact(c_cfg).get0();
+    auto again = read_and_validate_all_batches(log);
+    BOOST_REQUIRE_EQUAL(again.size(), after.size());
+}
+
 FIXTURE_TEST(max_adjacent_segment_compaction, storage_test_fixture) {
     auto cfg = default_log_config(test_dir);
     cfg.max_compacted_segment_size = 6_MiB;
@@ -1260,16 +1313,13 @@ FIXTURE_TEST(max_adjacent_segment_compaction, storage_test_fixture) {
     log.compact(c_cfg).get0();
     BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 6);
 
-    // the first two segments are combined 2+2=4 < 6 MB
+    // the first two segments are combined 2+2=4 < 6 MB, the third one does
+    // not fit in that window 2+2+5 > 6 MB
     log.compact(c_cfg).get0();
     BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 5);
 
-    // the new first and second are too big 4+5 > 6 MB but the second and third
-    // can be combined 5 + 15KB < 6 MB
-    log.compact(c_cfg).get0();
-    BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 4);
-
-    // then the next 16 KB can be folded in
+    // the new first and second are too big 4+5 > 6 MB but the second, third
+    // and fourth can be combined 5MB + 16KB + 16KB < 6 MB
     log.compact(c_cfg).get0();
     BOOST_REQUIRE_EQUAL(disk_log->segment_count(), 3);
 
@@ -0,0 +1,289 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "model/record.h"
+#include "model/record_utils.h"
+#include "random/generators.h"
+#include "storage/batch_cache.h"
+#include "storage/compacted_offset_list.h"
+#include "storage/parser.h"
+#include "storage/record_batch_builder.h"
+#include "storage/segment_appender.h"
+#include "storage/segment_appender_utils.h"
+#include "storage/segment_index.h"
+#include "storage/tests/utils/random_batch.h"
+#include "units.h"
+
+#include <seastar/core/file.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <boost/range/irange.hpp>
+
+/*
+ * Calibrated microbenchmarks for the storage hot path. Each benchmark
+ * reports latency per operation and allocations per operation so encoding,
+ * caching or appender regressions are visible before they reach a cluster.
+ */
+
+namespace {
+
+model::record_batch
+make_bench_batch(model::offset o, size_t records, size_t value_size) {
+    storage::record_batch_builder b(model::record_batch_type(1), o);
+    for (size_t i = 0; i < records; ++i) {
+        b.add_raw_kv(
+          bytes_to_iobuf(random_generators::get_bytes(32)),
+          bytes_to_iobuf(random_generators::get_bytes(value_size)));
+    }
+    return std::move(b).build();
+}
+
+} // namespace
+
+/*
+ * segment_appender - append and append+flush cost for a produce sized
+ * payload. The file is created fresh per sample and removed afterwards so
+ * only the measured section touches the appender.
+ */
+static ss::future<size_t> with_appender(
+  ss::noncopyable_function<ss::future<size_t>(storage::segment_appender&)>
+    fn) {
+    auto name = "storage_perf_bench."
+                + random_generators::gen_alphanum_string(20);
+    return ss::open_file_dma(
+             name,
+             ss::open_flags::create | ss::open_flags::rw
+               | ss::open_flags::truncate)
+      .then([fn = std::move(fn)](ss::file f) mutable {
+          auto appender = std::make_unique<storage::segment_appender>(
+            std::move(f),
+            storage::segment_appender::options(
+              ss::default_priority_class(),
+              storage::segment_appender::chunks_no_buffer));
+          auto raw = appender.get();
+          return fn(*raw).finally([a = std::move(appender)]() mutable {
+              return a->close().finally([a = std::move(a)] {});
+          });
+      })
+      .finally([name] { return ss::remove_file(name); });
+}
+
+static constexpr size_t appends_per_sample = 256;
+
+PERF_TEST(segment_appender, append_4k) {
+    return with_appender([](storage::segment_appender& a) {
+        auto payload = bytes_to_iobuf(random_generators::get_bytes(4_KiB));
+        return ss::do_with(std::move(payload), [&a](iobuf& payload) {
+            perf_tests::start_measuring_time();
+            return ss::do_for_each(
+                     boost::irange<size_t>(0, appends_per_sample),
+                     [&a, &payload](size_t) { return a.append(payload); })
+              .then([&a] { return a.flush(); })
+              .then([] {
+                  perf_tests::stop_measuring_time();
+                  return appends_per_sample;
+              });
+        });
+    });
+}
+
+PERF_TEST(segment_appender, append_4k_flush_each) {
+    return with_appender([](storage::segment_appender& a) {
+        auto payload = bytes_to_iobuf(random_generators::get_bytes(4_KiB));
+        return ss::do_with(std::move(payload), [&a](iobuf& payload) {
+            perf_tests::start_measuring_time();
+            return ss::do_for_each(
+                     boost::irange<size_t>(0, appends_per_sample),
+                     [&a, &payload](size_t) {
+                         return a.append(payload).then(
+                           [&a] { return a.flush(); });
+                     })
+              .then([] {
+                  perf_tests::stop_measuring_time();
+                  return appends_per_sample;
+              });
+        });
+    });
+}
+
+/*
+ * storage::parser - batch parse throughput over an in-memory stream of the
+ * on disk representation, isolating the framing and crc work from disk io.
+ */
+namespace {
+struct counting_consumer final : storage::batch_consumer {
+    consume_result consume_batch_start(
+      model::record_batch_header, size_t, size_t) final {
+        return skip_batch::no;
+    }
+    void consume_records(iobuf&&) final {}
+    stop_parser consume_batch_end() final { return stop_parser::no; }
+    void print(std::ostream& os) const final { os << "{counting_consumer}"; }
+};
+} // namespace
+
+struct parser_bench {
+    parser_bench() {
+        auto batches = storage::test::make_random_batches(
+          model::offset(0), 64);
+        for (auto& b : batches) {
+            b.header().header_crc = model::internal_header_only_crc(
+              b.header());
+            _data.append(storage::disk_header_to_iobuf(b.header()));
+            _data.append(b.data().copy());
+            ++_batch_count;
+        }
+    }
+    iobuf _data;
+    size_t _batch_count{0};
+};
+
+PERF_TEST_F(parser_bench, consume_stream) {
+    auto parser = std::make_unique<storage::continuous_batch_parser>(
+      std::make_unique<counting_consumer>(),
+      make_iobuf_input_stream(_data.copy()));
+    auto raw = parser.get();
+    perf_tests::start_measuring_time();
+    return raw->consume()
+      .then([this](result<size_t>) {
+          perf_tests::stop_measuring_time();
+          return _batch_count;
+      })
+      .finally([p = std::move(parser)] { return p->close(); });
+}
+
+/*
+ * batch_cache - index hit/miss lookups, the put+evict cycle and bulk
+ * reclaim, the operations on the fetch and low-memory paths.
+ */
+static constexpr size_t cached_batches = 1024;
+
+static storage::batch_cache::reclaim_options bench_reclaim_opts{
+  .growth_window = std::chrono::milliseconds(3000),
+  .stable_window = std::chrono::milliseconds(10000),
+  .min_size = 128_KiB,
+  .max_size = 4_MiB,
+};
+
+struct batch_cache_bench {
+    batch_cache_bench()
+      : _cache(bench_reclaim_opts)
+      , _index(_cache)
+      , _batch(make_bench_batch(model::offset(0), 1, 1_KiB)) {
+        for (size_t i = 0; i < cached_batches; ++i) {
+            _index.put(make_bench_batch(model::offset(i), 1, 1_KiB));
+        }
+    }
+    storage::batch_cache _cache;
+    storage::batch_cache_index _index;
+    model::record_batch _batch;
+    size_t _i{0};
+};
+
+PERF_TEST_F(batch_cache_bench, index_get_hit) {
+    auto b = _index.get(model::offset(_i++ % cached_batches));
+    perf_tests::do_not_optimize(b);
+}
+
+PERF_TEST_F(batch_cache_bench, index_get_miss) {
+    auto b = _index.get(model::offset(cached_batches + (_i++ % 1024)));
+    perf_tests::do_not_optimize(b);
+}
+
+PERF_TEST_F(batch_cache_bench, put_evict) {
+    auto w = _cache.put(_index, _batch.share());
+    _cache.evict(std::move(w));
+}
+
+struct batch_cache_reclaim_bench {
+    batch_cache_reclaim_bench()
+      : _cache(bench_reclaim_opts)
+      , _index(_cache)
+      , _batch(make_bench_batch(model::offset(0), 1, 1_KiB)) {}
+    storage::batch_cache _cache;
+    storage::batch_cache_index _index;
+    model::record_batch _batch;
+};
+
+PERF_TEST_F(batch_cache_reclaim_bench, reclaim_128k) {
+    // refill outside of the measured section - reclaim leaves the cache
+    // empty after every sample
+    size_t bytes = 0;
+    while (bytes < 256_KiB) {
+        _cache.put(_index, _batch.share());
+        bytes += _batch.memory_usage();
+    }
+    perf_tests::start_measuring_time();
+    auto reclaimed = _cache.reclaim(128_KiB);
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(reclaimed);
+}
+
+/*
+ * segment_index - offset to file position translation for a large segment.
+ * the lookup is purely in-memory so the index file handle stays unopened.
+ */
+struct segment_index_bench {
+    static constexpr size_t batches = 100000;
+    static constexpr size_t batch_size = 16_KiB;
+
+    segment_index_bench()
+      : _index(
+        "storage_perf_bench.base_index",
+        ss::file{},
+        model::offset(0),
+        storage::segment_index::default_data_buffer_step) {
+        size_t filepos = 0;
+        for (size_t i = 0; i < batches; ++i) {
+            model::record_batch_header h;
+            h.base_offset = model::offset(i * 10);
+            h.last_offset_delta = 9;
+            h.size_bytes = batch_size;
+            h.first_timestamp = model::timestamp(i);
+            h.max_timestamp = model::timestamp(i);
+            _index.maybe_track(h, filepos);
+            filepos += batch_size;
+        }
+    }
+    storage::segment_index _index;
+    size_t _i{0};
+};
+
+PERF_TEST_F(segment_index_bench, find_nearest_offset) {
+    auto e = _index.find_nearest(
+      model::offset((_i++ * 7919) % (batches * 10)));
+    perf_tests::do_not_optimize(e);
+}
+
+/*
+ * compacted_offset_list - the per record membership test on the compaction
+ * rewrite path. complements the key reducer benchmark in compacting_bench.
+ */
+struct offset_list_bench {
+    static constexpr size_t offsets = 1000000;
+
+    offset_list_bench()
+      : _list(model::offset(0), Roaring{}) {
+        // keep every other offset, like a half-dedupable keyspace
+        for (size_t i = 0; i < offsets; i += 2) {
+            _list.add(model::offset(i));
+        }
+    }
+    storage::internal::compacted_offset_list _list;
+    size_t _i{0};
+};
+
+PERF_TEST_F(offset_list_bench, contains) {
+    auto c = _list.contains(model::offset(_i++ % offsets));
+    perf_tests::do_not_optimize(c);
+}
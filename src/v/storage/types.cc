@@ -55,12 +55,17 @@ operator<<(std::ostream& o, const ntp_config::default_overrides& v) {
     fmt::print(
       o,
       "{{compaction_strategy: {}, cleanup_policy_bitflags: {}, segment_size: "
-      "{}, retention_bytes: {}, retention_time_ms: {}}}",
+      "{}, retention_bytes: {}, retention_time_ms: {}, flush_interval_ms: {}, "
+      "flush_bytes: {}, recompression: {}, memory_backed: {}}}",
       v.compaction_strategy,
       v.cleanup_policy_bitflags,
       v.segment_size,
       v.retention_bytes,
-      v.retention_time);
+      v.retention_time,
+      v.flush_interval ? v.flush_interval->count() : -1,
+      v.flush_bytes,
+      v.recompression,
+      bool(v.memory_backed));
 
     return o;
 }
@@ -103,11 +108,18 @@ std::ostream& operator<<(std::ostream& o, const offset_stats& s) {
 std::ostream& operator<<(std::ostream& o, const compaction_config& c) {
     fmt::print(
       o,
-      "{{evicition_time:{}, max_bytes:{}, should_sanitize:{}}}",
+      "{{evicition_time:{}, max_bytes:{}, recompression:{}, "
+      "should_sanitize:{}}}",
       c.eviction_time,
       c.max_bytes.value_or(-1),
+      c.recompression,
       c.sanitize);
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const scrub_config& c) {
+    fmt::print(o, "{{read_bytes_budget:{}}}", c.read_bytes_budget);
+    return o;
+}
+
 } // namespace storage
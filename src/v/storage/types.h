@@ -237,6 +237,13 @@ struct log_reader_config {
     // historical read-once workloads like compaction).
     bool skip_batch_cache{false};
 
+    // number of bytes the reader may hold beyond what the consumer has
+    // asked for, used to prefetch the next slice while the current one is
+    // consumed. zero disables readahead.
+    size_t readahead_bytes{default_readahead_bytes};
+
+    static constexpr size_t default_readahead_bytes = 128 * 1024;
+
     log_reader_config(
       model::offset start_offset,
       model::offset max_offset,
@@ -295,6 +302,10 @@ struct compaction_config {
     std::optional<size_t> max_bytes;
     // priority for all IO in compaction
     ss::io_priority_class iopc;
+    // when set, batches are re-encoded with this codec as segments are
+    // rewritten by housekeeping. stamped from the ntp_config overrides by
+    // disk_log_impl::compact
+    std::optional<model::compression> recompression;
     // use proxy fileops with assertions
     debug_sanitize_files sanitize;
     // abort source for compaction task
@@ -302,4 +313,21 @@ struct compaction_config {
 
     friend std::ostream& operator<<(std::ostream&, const compaction_config&);
 };
+
+struct scrub_config {
+    explicit scrub_config(
+      size_t budget, ss::io_priority_class p, ss::abort_source& as)
+      : read_bytes_budget(budget)
+      , iopc(p)
+      , asrc(&as) {}
+
+    // stop picking up new segments once this many bytes were read
+    size_t read_bytes_budget;
+    // priority for all IO done by the scrubber
+    ss::io_priority_class iopc;
+    // abort source for the scrub task
+    ss::abort_source* asrc;
+
+    friend std::ostream& operator<<(std::ostream&, const scrub_config&);
+};
 } // namespace storage
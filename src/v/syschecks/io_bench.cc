@@ -0,0 +1,87 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "syschecks/syschecks.h"
+#include "units.h"
+
+#include <seastar/core/aligned_buffer.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/file.hh>
+#include <seastar/core/seastar.hh>
+
+#include <chrono>
+#include <cstring>
+#include <ostream>
+
+namespace syschecks {
+
+static constexpr size_t probe_alignment = 4_KiB;
+static constexpr size_t probe_chunk_size = 128_KiB;
+static constexpr size_t probe_chunk_count = 64;
+static constexpr size_t probe_flush_count = 16;
+
+std::ostream& operator<<(std::ostream& o, const io_profile& p) {
+    return o << "{seq_write_bytes_per_sec:" << p.seq_write_bytes_per_sec
+             << ", flush_latency_us:" << p.flush_latency.count() << "}";
+}
+
+ss::future<io_profile> measure_io(const ss::sstring& path) {
+    using clock = std::chrono::steady_clock;
+
+    auto name = fmt::format("{}/syschecks_io_probe.tmp", path);
+    auto f = co_await ss::open_file_dma(
+      name,
+      ss::open_flags::rw | ss::open_flags::create | ss::open_flags::truncate);
+
+    io_profile profile;
+    auto buf = ss::allocate_aligned_buffer<char>(
+      probe_chunk_size, probe_alignment);
+    std::memset(buf.get(), 'x', probe_chunk_size);
+
+    // sequential write bandwidth over a handful of appender-sized chunks
+    auto start = clock::now();
+    for (size_t i = 0; i < probe_chunk_count; ++i) {
+        co_await f.dma_write(i * probe_chunk_size, buf.get(), probe_chunk_size);
+    }
+    co_await f.flush();
+    const std::chrono::duration<double> elapsed = clock::now() - start;
+    profile.seq_write_bytes_per_sec = static_cast<uint64_t>(
+      static_cast<double>(probe_chunk_count * probe_chunk_size)
+      / elapsed.count());
+
+    // durable small-write latency: one block per write-flush cycle, the
+    // pattern of an acks=all append
+    const size_t base = probe_chunk_count * probe_chunk_size;
+    start = clock::now();
+    for (size_t i = 0; i < probe_flush_count; ++i) {
+        co_await f.dma_write(
+          base + i * probe_alignment, buf.get(), probe_alignment);
+        co_await f.flush();
+    }
+    profile.flush_latency
+      = std::chrono::duration_cast<std::chrono::microseconds>(
+          clock::now() - start)
+        / probe_flush_count;
+
+    co_await f.close();
+    co_await ss::remove_file(name);
+    co_return profile;
+}
+
+size_t recommended_falloc_step(const io_profile& p) {
+    if (p.seq_write_bytes_per_sec >= 1_GiB) {
+        return 64_MiB;
+    }
+    if (p.seq_write_bytes_per_sec >= 256_MiB) {
+        return 32_MiB;
+    }
+    return 8_MiB;
+}
+
+} // namespace syschecks
@@ -19,8 +19,10 @@
 #include <fmt/format.h>
 
 #include <cpuid.h>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <iosfwd>
 
 namespace syschecks {
 
@@ -45,6 +47,27 @@ static inline void cpu() {
 
 ss::future<> disk(const ss::sstring& path);
 
+/// Result of the startup disk write probe.
+struct io_profile {
+    uint64_t seq_write_bytes_per_sec{0};
+    std::chrono::microseconds flush_latency{0};
+
+    friend std::ostream& operator<<(std::ostream&, const io_profile&);
+};
+
+/// Measure sequential write bandwidth and flush latency of the disk backing
+/// 'path' by writing and removing a small temporary file. Intended to run
+/// once at startup, before any services are constructed; the same binary is
+/// deployed to disks ranging from local NVMe to network volumes, and the
+/// profile lets tuning defaults follow the hardware instead of being
+/// hand-set per fleet.
+ss::future<io_profile> measure_io(const ss::sstring& path);
+
+/// Map a measured io profile to a segment fallocation step: fast disks
+/// amortize better with a large step, while on slow disks a large
+/// fallocation stalls the append path.
+size_t recommended_falloc_step(const io_profile&);
+
 void memory(bool ignore);
 
 ss::future<> systemd_raw_message(ss::sstring out);
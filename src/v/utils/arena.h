@@ -0,0 +1,166 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "likely.h"
+#include "seastarx.h"
+
+#include <seastar/core/align.hh>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * A bump allocator for short-lived, same-lifetime allocations.
+ *
+ * Memory is carved sequentially out of a chain of blocks and is only
+ * reclaimed wholesale by reset(), which rewinds to a single retained block.
+ * Individual deallocation is a no-op, so an arena is only suitable for
+ * allocations that all die before the owner resets it - e.g. scratch
+ * state scoped to a request.
+ *
+ * Once the configured budget is exceeded allocate() must not be called
+ * anymore; allocator adapters are expected to check over_budget() and fall
+ * back to the regular allocator so that a busy owner cannot grow the arena
+ * without bound between resets.
+ */
+class arena {
+public:
+    static constexpr size_t default_block_size = 16 * 1024;
+
+    explicit arena(size_t budget, size_t block_size = default_block_size)
+      : _budget(budget)
+      , _block_size(block_size) {}
+    arena(arena&&) noexcept = default;
+    arena& operator=(arena&&) noexcept = default;
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+    ~arena() noexcept = default;
+
+    void* allocate(size_t bytes, size_t align) {
+        if (!_blocks.empty()) {
+            auto& b = _blocks.back();
+            const size_t offset = ss::align_up(b.used, align);
+            if (offset + bytes <= b.size) {
+                b.used = offset + bytes;
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                return b.data.get() + offset;
+            }
+        }
+        return allocate_new_block(bytes);
+    }
+
+    bool over_budget() const { return _allocated_bytes >= _budget; }
+
+    /// true when p points into one of the arena's blocks. used by
+    /// allocator adapters to tell arena pointers from fallback heap
+    /// pointers on deallocation; the block chain is short so a scan is
+    /// cheap
+    bool owns(const void* p) const {
+        for (const auto& b : _blocks) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (p >= b.data.get() && p < b.data.get() + b.size) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// drop everything except the first block and rewind it. all pointers
+    /// previously handed out become invalid
+    void reset() {
+        if (_blocks.empty()) {
+            return;
+        }
+        _blocks.erase(std::next(_blocks.begin()), _blocks.end());
+        _blocks.front().used = 0;
+        _allocated_bytes = _blocks.front().size;
+    }
+
+    size_t allocated_bytes() const { return _allocated_bytes; }
+
+private:
+    struct block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    void* allocate_new_block(size_t bytes) {
+        const size_t sz = std::max(bytes, _block_size);
+        _blocks.push_back(block{
+          // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+          .data = std::unique_ptr<char[]>(new char[sz]),
+          .size = sz,
+          .used = bytes,
+        });
+        _allocated_bytes += sz;
+        return _blocks.back().data.get();
+    }
+
+    std::vector<block> _blocks;
+    size_t _allocated_bytes{0};
+    size_t _budget;
+    size_t _block_size;
+};
+
+/**
+ * std allocator adapter for arena. allocations go to the arena until it is
+ * over budget, then to the regular allocator; deallocation of arena memory
+ * is a no-op. the referenced arena must outlive every container using the
+ * adapter.
+ */
+template<typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+
+    explicit arena_allocator(arena& a) noexcept
+      : _arena(&a) {}
+
+    template<typename U>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    arena_allocator(const arena_allocator<U>& o) noexcept
+      : _arena(o._arena) {}
+
+    T* allocate(size_t n) {
+        if (unlikely(_arena->over_budget())) {
+            return std::allocator<T>{}.allocate(n);
+        }
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (unlikely(!_arena->owns(p))) {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+    }
+
+    template<typename U>
+    bool operator==(const arena_allocator<U>& o) const noexcept {
+        return _arena == o._arena;
+    }
+    template<typename U>
+    bool operator!=(const arena_allocator<U>& o) const noexcept {
+        return !(*this == o);
+    }
+
+private:
+    template<typename U>
+    friend class arena_allocator;
+
+    arena* _arena;
+};
+
+template<typename T>
+using arena_vector = std::vector<T, arena_allocator<T>>;
@@ -0,0 +1,65 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/async_logger.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/core/loop.hh>
+
+#include <utility>
+
+namespace utils {
+
+ss::future<> async_logger::start() {
+    (void)ss::with_gate(_gate, [this] { return flush_loop(); });
+    return ss::now();
+}
+
+ss::future<> async_logger::stop() {
+    _stopped = true;
+    _flush_signal.signal();
+    return _gate.close();
+}
+
+ss::future<> async_logger::flush_loop() {
+    return ss::do_until(
+      [this] { return _stopped && _records.empty(); },
+      [this] {
+          if (_records.empty()) {
+              return _flush_signal.wait(
+                [this] { return !_records.empty() || _stopped; });
+          }
+          return flush_once();
+      });
+}
+
+ss::future<> async_logger::flush_once() {
+    auto batch = std::exchange(_records, {});
+    auto dropped = std::exchange(_dropped, 0);
+    _dropped_total += dropped;
+    return ss::do_with(
+             std::move(batch),
+             [this](ss::circular_buffer<record>& batch) {
+                 // do_for_each yields between records so a large backlog
+                 // does not monopolize the reactor
+                 return ss::do_for_each(batch, [this](record& r) {
+                     _sink.log(r.level, "{}", r.message);
+                 });
+             })
+      .then([this, dropped] {
+          if (dropped > 0) {
+              _sink.log(
+                ss::log_level::warn,
+                "async log buffer overflow - dropped {} records",
+                dropped);
+          }
+      });
+}
+
+} // namespace utils
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+
+#include <seastar/core/circular_buffer.hh>
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/util/log.hh>
+
+#include <fmt/format.h>
+
+namespace utils {
+
+/// Per-shard asynchronous backend for hot-path logging. Synchronous
+/// logging writes through the reactor on the calling fiber, so enabling
+/// trace/debug on a busy subsystem directly inflates produce tail
+/// latency. An async_logger instead deposits rendered records into a
+/// bounded per-shard buffer and a background fiber writes them through
+/// the sink logger; when the buffer is full records are dropped and
+/// counted, and the drop count is reported on the next flush.
+///
+/// The level methods have the same shape as ss::logger, so call sites
+/// keep using the vlog() macro:
+///
+///    utils::async_logger alog(my_logger);
+///    co_await alog.start();
+///    vlog(alog.trace, "offset:{}", o);     // hot path, never blocks
+///    co_await alog.stop();                 // flushes whats buffered
+///
+/// Arguments are rendered at the call site because they may reference
+/// stack data that is gone by the time the flush fiber runs; the
+/// deferred part is the write through the sink, which is where the
+/// reactor stalls come from.
+class async_logger {
+public:
+    static constexpr size_t default_capacity = 4096;
+
+    explicit async_logger(
+      ss::logger& sink, size_t capacity = default_capacity)
+      : _sink(sink)
+      , _capacity(capacity) {}
+
+    async_logger(const async_logger&) = delete;
+    async_logger& operator=(const async_logger&) = delete;
+    async_logger(async_logger&&) = delete;
+    async_logger& operator=(async_logger&&) = delete;
+    ~async_logger() = default;
+
+    /// spawns the flush fiber on the calling shard
+    ss::future<> start();
+    /// drains buffered records through the sink and joins the fiber
+    ss::future<> stop();
+
+    template<typename... Args>
+    void log(ss::log_level lvl, const char* format, Args&&... args) {
+        if (!_sink.is_enabled(lvl)) {
+            return;
+        }
+        if (_records.size() >= _capacity) {
+            ++_dropped;
+            return;
+        }
+        _records.push_back(
+          record{lvl, fmt::format(format, std::forward<Args>(args)...)});
+        _flush_signal.signal();
+    }
+
+    // clang-format off
+    template<typename... Args>
+    void trace(const char* f, Args&&... a) {
+        log(ss::log_level::trace, f, std::forward<Args>(a)...);
+    }
+    template<typename... Args>
+    void debug(const char* f, Args&&... a) {
+        log(ss::log_level::debug, f, std::forward<Args>(a)...);
+    }
+    template<typename... Args>
+    void info(const char* f, Args&&... a) {
+        log(ss::log_level::info, f, std::forward<Args>(a)...);
+    }
+    template<typename... Args>
+    void warn(const char* f, Args&&... a) {
+        log(ss::log_level::warn, f, std::forward<Args>(a)...);
+    }
+    template<typename... Args>
+    void error(const char* f, Args&&... a) {
+        log(ss::log_level::error, f, std::forward<Args>(a)...);
+    }
+    // clang-format on
+
+    /// records dropped on overflow since construction
+    size_t dropped() const { return _dropped_total + _dropped; }
+    /// records currently waiting for the flush fiber
+    size_t buffered() const { return _records.size(); }
+
+private:
+    struct record {
+        ss::log_level level;
+        ss::sstring message;
+    };
+
+    ss::future<> flush_loop();
+    ss::future<> flush_once();
+
+    ss::logger& _sink;
+    size_t _capacity;
+    ss::circular_buffer<record> _records;
+    ss::condition_variable _flush_signal;
+    ss::gate _gate;
+    bool _stopped{false};
+    size_t _dropped{0};
+    size_t _dropped_total{0};
+};
+
+} // namespace utils
@@ -28,3 +28,6 @@ ss::sstring bytes_to_base64(bytes_view);
 
 // base64 <-> iobuf
 ss::sstring iobuf_to_base64(const iobuf&);
+// decodes straight into an iobuf fragment, skipping the intermediate
+// contiguous bytes copy of base64_to_bytes + bytes_to_iobuf
+iobuf base64_to_iobuf(std::string_view);
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+
+#include <seastar/core/future-util.hh>
+#include <seastar/core/lowres_clock.hh>
+
+/**
+ * Per-shard cached coarse clock.
+ *
+ * 'ss::lowres_clock::now()' is cheap but still an atomic read plus a
+ * conversion on every call, and hot paths take several timestamps per
+ * request (quota windows, read timeouts, probes). 'cached_clock::now()'
+ * reads the underlying clock at most once per reactor poll and hands out
+ * the cached value as a plain thread-local load afterwards.
+ *
+ * The cached value is never older than one task quota on top of the
+ * lowres granularity. Use the underlying clock directly where that slack
+ * matters, e.g. latency measurement or arming timers against absolute
+ * deadlines computed elsewhere.
+ */
+class cached_clock {
+public:
+    using base_clock = ss::lowres_clock;
+    using rep = base_clock::rep;
+    using period = base_clock::period;
+    using duration = base_clock::duration;
+    using time_point = base_clock::time_point;
+    static constexpr bool is_steady = base_clock::is_steady;
+
+    static time_point now() {
+        if (!_refresh_scheduled) {
+            _cached = base_clock::now();
+            _refresh_scheduled = true;
+            // invalidate once the current task queue drains so the next
+            // poll re-reads the clock
+            (void)ss::later().then([] { _refresh_scheduled = false; });
+        }
+        return _cached;
+    }
+
+private:
+    static inline thread_local time_point _cached;
+    static inline thread_local bool _refresh_scheduled{false};
+};
@@ -0,0 +1,126 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/cpu_profiler.h"
+
+#include "vassert.h"
+
+#include <fmt/format.h>
+
+#include <cerrno>
+#include <execinfo.h>
+#include <map>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace utils {
+
+// one signal for all shards; the handler resolves the shard's profiler
+// through a thread local so a signal only ever touches the thread it was
+// delivered to
+static int profiler_signal() { return SIGRTMIN + 2; }
+
+static thread_local cpu_profiler* active_profiler{nullptr};
+
+cpu_profiler& cpu_profiler::local() {
+    static thread_local cpu_profiler profiler;
+    return profiler;
+}
+
+void cpu_profiler::signal_handler(int, siginfo_t*, void*) {
+    if (active_profiler != nullptr) {
+        active_profiler->record_sample();
+    }
+}
+
+void cpu_profiler::record_sample() {
+    if (_sample_count >= _samples.size()) {
+        return;
+    }
+    auto& s = _samples[_sample_count];
+    // ::backtrace is what the seastar stall detector relies on in the
+    // same context; no allocations happen here
+    auto depth = ::backtrace(s.frames.data(), max_frames);
+    if (depth <= 0) {
+        return;
+    }
+    s.depth = static_cast<size_t>(depth);
+    ++_sample_count;
+}
+
+void cpu_profiler::start(std::chrono::milliseconds period) {
+    vassert(!_running, "cpu profiler is already running");
+    _samples.resize(max_samples);
+    _sample_count = 0;
+
+    struct sigaction sa {};
+    sa.sa_sigaction = &cpu_profiler::signal_handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    auto r = ::sigaction(profiler_signal(), &sa, nullptr);
+    vassert(r == 0, "failed to install profiler signal handler: {}", errno);
+
+    struct sigevent sev {};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = profiler_signal();
+    // route the signal to this reactor thread only
+    sev._sigev_un._tid = static_cast<pid_t>(::syscall(SYS_gettid));
+    r = ::timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &_timer);
+    if (r != 0) {
+        throw std::system_error(
+          errno, std::system_category(), "timer_create failed");
+    }
+
+    active_profiler = this;
+    _running = true;
+
+    struct itimerspec its {};
+    its.it_value.tv_sec = period.count() / 1000;
+    its.it_value.tv_nsec = (period.count() % 1000) * 1000000;
+    its.it_interval = its.it_value;
+    r = ::timer_settime(_timer, 0, &its, nullptr);
+    if (r != 0) {
+        stop();
+        throw std::system_error(
+          errno, std::system_category(), "timer_settime failed");
+    }
+}
+
+void cpu_profiler::stop() {
+    if (!_running) {
+        return;
+    }
+    ::timer_delete(_timer);
+    active_profiler = nullptr;
+    _running = false;
+}
+
+cpu_profiler::~cpu_profiler() noexcept { stop(); }
+
+ss::sstring cpu_profiler::folded_stacks() const {
+    // aggregate identical stacks; flamegraph tooling expects one
+    // semicolon separated stack per line, root frame first
+    std::map<ss::sstring, uint64_t> folded;
+    for (size_t i = 0; i < _sample_count; ++i) {
+        const auto& s = _samples[i];
+        fmt::memory_buffer line;
+        for (size_t f = s.depth; f > 0; --f) {
+            fmt::format_to(
+              line, "{}{}", fmt::ptr(s.frames[f - 1]), f > 1 ? ";" : "");
+        }
+        folded[ss::sstring(line.data(), line.size())]++;
+    }
+    fmt::memory_buffer out;
+    for (const auto& [stack, count] : folded) {
+        fmt::format_to(out, "{} {}\n", stack, count);
+    }
+    return ss::sstring(out.data(), out.size());
+}
+
+} // namespace utils
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+#include "seastarx.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <array>
+#include <chrono>
+#include <csignal>
+#include <ctime>
+#include <vector>
+
+namespace utils {
+
+/// Built-in sampling CPU profiler. Each shard owns one instance; when
+/// started it arms a POSIX timer that delivers a signal to the reactor
+/// thread at the configured period and the handler captures a raw stack
+/// into a preallocated buffer, so profiling a production reactor does
+/// not require attaching perf. Stacks are aggregated lazily into the
+/// folded format understood by flamegraph tooling; frames are raw
+/// addresses, symbolize offline against the binary.
+class cpu_profiler {
+public:
+    static constexpr size_t max_frames = 64;
+    /// sampling stops once the buffer is full; at the default 10ms
+    /// period this is about 80 seconds of samples
+    static constexpr size_t max_samples = 8192;
+
+    struct sample {
+        std::array<void*, max_frames> frames;
+        size_t depth;
+    };
+
+    cpu_profiler() = default;
+    cpu_profiler(const cpu_profiler&) = delete;
+    cpu_profiler& operator=(const cpu_profiler&) = delete;
+    cpu_profiler(cpu_profiler&&) = delete;
+    cpu_profiler& operator=(cpu_profiler&&) = delete;
+    ~cpu_profiler() noexcept;
+
+    /// arms the sampling timer on the calling shard; clears previously
+    /// collected samples
+    void start(std::chrono::milliseconds period);
+    /// disarms the timer, collected samples stay queryable
+    void stop();
+    bool running() const { return _running; }
+    size_t sample_count() const { return _sample_count; }
+
+    /// samples aggregated to "addr;addr;addr count" lines, one stack per
+    /// line, root frame first
+    ss::sstring folded_stacks() const;
+
+    static cpu_profiler& local();
+
+private:
+    static void signal_handler(int, siginfo_t*, void*);
+    void record_sample();
+
+    bool _running{false};
+    timer_t _timer{};
+    std::vector<sample> _samples;
+    size_t _sample_count{0};
+};
+
+} // namespace utils
@@ -12,12 +12,53 @@
 #include "utils/file_io.h"
 
 #include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
 
+#include <seastar/core/align.hh>
+#include <seastar/core/aligned_buffer.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/deleter.hh>
 #include <seastar/core/file.hh>
 #include <seastar/core/fstream.hh>
 #include <seastar/core/temporary_buffer.hh>
 
+#include <fmt/format.h>
+
+#include <cstring>
 #include <exception>
+#include <stdexcept>
+#include <sys/uio.h>
+
+/// buffers batched into a single vectored dma call
+static constexpr size_t max_io_vectors = 8;
+
+ss::temporary_buffer<char> file_io_buffer_pool::get() {
+    allocation mem;
+    if (_idle.empty()) {
+        mem = ss::allocate_aligned_buffer<char>(buffer_size, alignment);
+    } else {
+        mem = std::move(_idle.back());
+        _idle.pop_back();
+    }
+    auto* data = mem.get();
+    return ss::temporary_buffer<char>(
+      data, buffer_size, ss::make_deleter([mem = std::move(mem)]() mutable {
+          // buffers are only used shard-locally, so the release always
+          // happens on the shard that owns the pool
+          local().put(std::move(mem));
+      }));
+}
+
+void file_io_buffer_pool::put(allocation mem) {
+    if (_idle.size() < max_idle) {
+        _idle.push_back(std::move(mem));
+    }
+}
+
+file_io_buffer_pool& file_io_buffer_pool::local() {
+    static thread_local file_io_buffer_pool pool;
+    return pool;
+}
 
 ss::future<ss::temporary_buffer<char>>
 read_fully_tmpbuf(const std::filesystem::path& name) {
@@ -30,30 +71,162 @@ read_fully_tmpbuf(const std::filesystem::path& name) {
 }
 
 ss::future<iobuf> read_fully(const std::filesystem::path& name) {
-    return read_fully_tmpbuf(name).then([](ss::temporary_buffer<char> buf) {
-        iobuf iob;
-        iob.append(std::move(buf));
-        return iob;
-    });
+    auto f = co_await ss::open_file_dma(name.string(), ss::open_flags::ro);
+    std::exception_ptr eptr;
+    iobuf result;
+    try {
+        const uint64_t size = co_await f.size();
+        uint64_t pos = 0;
+        while (pos < size) {
+            // gather a window of pooled buffers and fill them with one
+            // vectored read; the filled buffers become the iobuf's
+            // fragments without an intermediate copy
+            std::vector<ss::temporary_buffer<char>> bufs;
+            std::vector<iovec> iov;
+            uint64_t wanted = size - pos;
+            while (wanted > 0 && iov.size() < max_io_vectors) {
+                auto b = file_io_buffer_pool::local().get();
+                iov.push_back(iovec{b.get_write(), b.size()});
+                wanted -= std::min<uint64_t>(wanted, b.size());
+                bufs.push_back(std::move(b));
+            }
+            uint64_t n = co_await f.dma_read(pos, std::move(iov));
+            if (n == 0) {
+                throw std::runtime_error(fmt::format(
+                  "unexpected eof reading {} at offset {}, file size {}",
+                  name.string(),
+                  pos,
+                  size));
+            }
+            pos += n;
+            for (auto& b : bufs) {
+                if (n == 0) {
+                    break;
+                }
+                const size_t fragment = std::min<uint64_t>(n, b.size());
+                b.trim(fragment);
+                n -= fragment;
+                result.append(std::move(b));
+            }
+        }
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await f.close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
+    co_return result;
+}
+
+/// Feeds a file's contents to an input_stream through pooled dma buffers,
+/// one buffer per read, so arbitrarily large files stream with a bounded
+/// footprint
+class pooled_file_data_source final : public ss::data_source_impl {
+public:
+    pooled_file_data_source(ss::file f, uint64_t size)
+      : _file(std::move(f))
+      , _size(size) {}
+
+    ss::future<> close() final { return _file.close(); }
+
+    ss::future<ss::temporary_buffer<char>> get() final {
+        if (_pos >= _size) {
+            return ss::make_ready_future<ss::temporary_buffer<char>>();
+        }
+        auto b = file_io_buffer_pool::local().get();
+        auto* data = b.get_write();
+        return _file.dma_read(_pos, data, b.size())
+          .then([this, b = std::move(b)](size_t n) mutable {
+              const size_t fragment = std::min<uint64_t>(n, _size - _pos);
+              if (fragment == 0) {
+                  throw std::runtime_error(fmt::format(
+                    "unexpected eof streaming file at offset {}, size {}",
+                    _pos,
+                    _size));
+              }
+              b.trim(fragment);
+              _pos += fragment;
+              return std::move(b);
+          });
+    }
+
+private:
+    ss::file _file;
+    uint64_t _pos{0};
+    uint64_t _size;
+};
+
+ss::future<ss::input_stream<char>>
+read_as_stream(const std::filesystem::path& name) {
+    auto f = co_await ss::open_file_dma(name.string(), ss::open_flags::ro);
+    std::exception_ptr eptr;
+    uint64_t size = 0;
+    try {
+        size = co_await f.size();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    if (eptr) {
+        co_await f.close();
+        std::rethrow_exception(eptr);
+    }
+    co_return ss::input_stream<char>(ss::data_source(
+      std::make_unique<pooled_file_data_source>(std::move(f), size)));
 }
 
 ss::future<> write_fully(const std::filesystem::path& p, iobuf buf) {
-    static constexpr const size_t buf_size = 4096;
     auto flags = ss::open_flags::wo | ss::open_flags::create
                  | ss::open_flags::truncate;
-    /// Closes file on failure, otherwise file is expected to be closed in the
-    /// success case where the ss::output_stream calls close()
-    return ss::with_file_close_on_failure(
-      ss::open_file_dma(p.string(), flags),
-      [buf = std::move(buf)](ss::file f) mutable {
-          return ss::make_file_output_stream(std::move(f), buf_size)
-            .then([buf = std::move(buf)](ss::output_stream<char> out) mutable {
-                return ss::do_with(
-                  std::move(out),
-                  [buf = std::move(buf)](ss::output_stream<char>& out) mutable {
-                      return write_iobuf_to_output_stream(std::move(buf), out)
-                        .then([&out]() mutable { return out.close(); });
-                  });
-            });
-      });
+    auto f = co_await ss::open_file_dma(p.string(), flags);
+    std::exception_ptr eptr;
+    try {
+        const uint64_t size = buf.size_bytes();
+        const uint64_t write_alignment = f.disk_write_dma_alignment();
+        iobuf_const_parser in(buf);
+        uint64_t pos = 0;
+        while (pos < size) {
+            // stage a window of the buffer into pooled aligned buffers and
+            // write it with one vectored dma call
+            std::vector<ss::temporary_buffer<char>> bufs;
+            std::vector<iovec> iov;
+            uint64_t window = 0;
+            uint64_t padded = 0;
+            while (pos + window < size && iov.size() < max_io_vectors) {
+                auto b = file_io_buffer_pool::local().get();
+                const size_t fill = std::min<uint64_t>(
+                  b.size(), size - pos - window);
+                in.consume_to(fill, b.get_write());
+                size_t len = fill;
+                if (fill < b.size()) {
+                    // dma lengths have to be alignment multiples; zero the
+                    // pad, the file is truncated back to size below
+                    len = ss::align_up<size_t>(fill, write_alignment);
+                    // NOLINTNEXTLINE
+                    std::memset(b.get_write() + fill, 0, len - fill);
+                }
+                iov.push_back(iovec{b.get_write(), len});
+                window += fill;
+                padded += len;
+                bufs.push_back(std::move(b));
+            }
+            auto written = co_await f.dma_write(pos, std::move(iov));
+            if (written != padded) {
+                throw std::runtime_error(fmt::format(
+                  "short dma write to {}: wrote {} bytes out of {}",
+                  p.string(),
+                  written,
+                  padded));
+            }
+            pos += window;
+        }
+        co_await f.truncate(size);
+        co_await f.flush();
+    } catch (...) {
+        eptr = std::current_exception();
+    }
+    co_await f.close();
+    if (eptr) {
+        std::rethrow_exception(eptr);
+    }
 }
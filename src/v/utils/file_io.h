@@ -13,18 +13,64 @@
 
 #include "bytes/iobuf.h"
 #include "seastarx.h"
+#include "units.h"
 
+#include <seastar/core/iostream.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/temporary_buffer.hh>
 
 #include <filesystem>
+#include <memory>
+#include <vector>
+
+/// \brief Per-shard pool of dma-aligned buffers backing the file_io helpers.
+///
+/// Buffers handed out by get() return their storage to the pool of the
+/// owning shard when released, so whole-file reads and writes recycle a
+/// small working set of alignment-suitable buffers instead of allocating
+/// per call and copying inside seastar's file layer.
+class file_io_buffer_pool {
+public:
+    /// size of every pooled buffer; a multiple of any dma alignment
+    static constexpr size_t buffer_size = 128_KiB;
+    /// alignment suitable for dma reads and writes on any backing store
+    static constexpr size_t alignment = 4_KiB;
+    /// per-shard cap on idle buffers kept for reuse (2MiB of memory)
+    static constexpr size_t max_idle = 16;
+
+    /// A dma-aligned buffer of buffer_size bytes. The buffer may be
+    /// trimmed, shared and appended to an iobuf; the underlying storage is
+    /// recycled once the last reference is released.
+    ss::temporary_buffer<char> get();
+
+    /// Number of idle buffers currently held
+    size_t idle() const { return _idle.size(); }
+
+    static file_io_buffer_pool& local();
+
+private:
+    using allocation = std::unique_ptr<char[], ss::free_deleter>;
+
+    void put(allocation mem);
+
+    std::vector<allocation> _idle;
+};
 
 /// \brief Read an entire file into a ss::temporary_buffer
 ss::future<ss::temporary_buffer<char>>
 read_fully_tmpbuf(const std::filesystem::path&);
 
-/// \brief Read an entire file into an iobuf
+/// \brief Read an entire file into an iobuf.
+/// The file is read with scatter-gather dma into pooled aligned buffers
+/// that become the iobuf's fragments directly, without intermediate copies.
 ss::future<iobuf> read_fully(const std::filesystem::path&);
 
-/// \brief Write an entire buffer into the file at location 'path'
+/// \brief Stream the contents of a file through pooled dma buffers.
+/// For files too large to hold in memory whole. The stream owns the file
+/// handle; closing the stream closes the file.
+ss::future<ss::input_stream<char>> read_as_stream(const std::filesystem::path&);
+
+/// \brief Write an entire buffer into the file at location 'path'.
+/// The buffer is staged through pooled aligned buffers and written with
+/// vectored dma instead of going through a buffered output stream.
 ss::future<> write_fully(const std::filesystem::path&, iobuf buf);
@@ -16,30 +16,52 @@
 
 #include <iostream>
 
-void hdr_hist::record(uint64_t value) {
-    _sample_count++;
-    _sample_sum += value;
-    ::hdr_record_value(_hist.get(), value);
+uint64_t hdr_hist::fast_bucket_midpoint(size_t idx) {
+    // inverse of fast_bucket(); values below the sub-bucket count map to
+    // themselves so they are exact
+    if (idx < fast_sub_bucket_count) {
+        return idx;
+    }
+    const unsigned msb = (idx >> fast_sub_bucket_bits) + fast_sub_bucket_bits
+                         - 1;
+    const unsigned shift = msb - fast_sub_bucket_bits;
+    const uint64_t sub = idx & (fast_sub_bucket_count - 1);
+    const uint64_t lower_bound = (uint64_t(1) << msb) + (sub << shift);
+    return lower_bound + (uint64_t(1) << shift) / 2;
 }
+
+void hdr_hist::fold_fast_counts() const {
+    for (size_t i = 0; i < _fast_counts.size(); ++i) {
+        if (const auto count = std::exchange(_fast_counts[i], 0); count > 0) {
+            ::hdr_record_values(_hist.get(), fast_bucket_midpoint(i), count);
+        }
+    }
+}
+
 void hdr_hist::record_multiple_times(uint64_t value, uint32_t times) {
     _sample_count += times;
     _sample_sum += value * times;
-    ::hdr_record_values(_hist.get(), value, times);
+    _fast_counts[fast_bucket(value)] += times;
 }
 void hdr_hist::record_corrected(uint64_t value, uint64_t interval) {
     // TODO: how should summation work for coordinated omission values? the sum
     // is tracked outside hdr, currently.
     _sample_count++;
     _sample_sum += value;
+    // coordinated omission correction needs the full hdr machinery, there
+    // is no fast path for it
     ::hdr_record_corrected_value(_hist.get(), value, interval);
 }
 
 hdr_hist& hdr_hist::operator+=(const hdr_hist& o) {
+    fold_fast_counts();
+    o.fold_fast_counts();
     ::hdr_add(_hist.get(), o._hist.get());
     return *this;
 }
 
 ss::temporary_buffer<char> hdr_hist::print_classic() const {
+    fold_fast_counts();
     char* buf = nullptr;
     std::size_t len = 0;
     FILE* fp = open_memstream(&buf, &len);
@@ -63,14 +85,22 @@ ss::temporary_buffer<char> hdr_hist::print_classic() const {
 }
 // getters
 int64_t hdr_hist::get_value_at(double percentile) const {
+    fold_fast_counts();
     return ::hdr_value_at_percentile(_hist.get(), percentile);
 }
-double hdr_hist::stddev() const { return ::hdr_stddev(_hist.get()); }
-double hdr_hist::mean() const { return ::hdr_mean(_hist.get()); }
+double hdr_hist::stddev() const {
+    fold_fast_counts();
+    return ::hdr_stddev(_hist.get());
+}
+double hdr_hist::mean() const {
+    fold_fast_counts();
+    return ::hdr_mean(_hist.get());
+}
 size_t hdr_hist::memory_size() const {
     return ::hdr_get_memory_size(_hist.get());
 }
 ss::metrics::histogram hdr_hist::seastar_histogram_logform() const {
+    fold_fast_counts();
     // logarithmic histogram configuration. this will range from 10 microseconds
     // through around 6000 seconds with 26 buckets doubling.
     //
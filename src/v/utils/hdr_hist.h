@@ -26,6 +26,7 @@
 #include <boost/intrusive/list.hpp>
 #include <hdr/hdr_histogram.h>
 
+#include <array>
 #include <chrono>
 #include <memory>
 #include <utility>
@@ -113,6 +114,7 @@ public:
     hdr_hist(hdr_hist&& o) noexcept
       : _probes(std::move(o._probes))
       , _hist(std::move(o._hist))
+      , _fast_counts(o._fast_counts)
       , _sample_count(o._sample_count)
       , _sample_sum(o._sample_sum) {}
     hdr_hist& operator=(hdr_hist&& o) noexcept {
@@ -128,7 +130,15 @@ public:
 
     hdr_hist& operator+=(const hdr_hist& o);
     ss::temporary_buffer<char> print_classic() const;
-    void record(uint64_t value);
+    /// \brief hot-path recording. Only bumps a counter in a small fixed
+    /// array of power-of-two buckets; the array is folded into the full
+    /// hdr histogram lazily, when the histogram is read (typically on a
+    /// metrics scrape)
+    void record(uint64_t value) {
+        _sample_count++;
+        _sample_sum += value;
+        _fast_counts[fast_bucket(value)]++;
+    }
     void record_multiple_times(uint64_t value, uint32_t times);
     void record_corrected(uint64_t value, uint64_t interval);
     // getters
@@ -144,8 +154,36 @@ private:
     friend measurement;
     friend std::ostream& operator<<(std::ostream& o, const hdr_hist& h);
 
+    /// number of linear sub-buckets per power of two in the fast array;
+    /// compile-time precision knob - the fast path only resolves values
+    /// down to 1/2^bits of their magnitude, the folded hdr histogram
+    /// keeps its configured significant figures for everything else
+    static constexpr unsigned fast_sub_bucket_bits = 3;
+    static constexpr size_t fast_sub_bucket_count = 1
+                                                    << fast_sub_bucket_bits;
+    static constexpr size_t fast_bucket_count
+      = ((64 - fast_sub_bucket_bits) << fast_sub_bucket_bits)
+        + fast_sub_bucket_count;
+
+    static size_t fast_bucket(uint64_t value) {
+        if (value < fast_sub_bucket_count) {
+            return value;
+        }
+        const unsigned msb = 63 - __builtin_clzll(value);
+        const unsigned shift = msb - fast_sub_bucket_bits;
+        const auto sub = (value >> shift) & (fast_sub_bucket_count - 1);
+        return ((msb - fast_sub_bucket_bits + 1) << fast_sub_bucket_bits)
+               + sub;
+    }
+    static uint64_t fast_bucket_midpoint(size_t idx);
+
+    /// drains the fast array into the hdr histogram; all getters call
+    /// this before touching the hdr state
+    void fold_fast_counts() const;
+
     boost::intrusive::list<measurement> _probes;
     hist_internal::hdr_histogram_ptr _hist;
+    mutable std::array<uint64_t, fast_bucket_count> _fast_counts{};
     uint64_t _sample_count{0};
     uint64_t _sample_sum{0};
 
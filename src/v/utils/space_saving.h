@@ -0,0 +1,93 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <absl/container/flat_hash_map.h>
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/// Space-saving top-k sketch over a weighted key stream.
+///
+/// Tracks at most \c capacity keys. While a key is tracked an increment is
+/// a hash lookup plus a few neighbour swaps; when an untracked key arrives
+/// and the sketch is full it replaces the current minimum and inherits its
+/// count, so every tracked count is an overestimate by at most the entry's
+/// \c error. Keys with true counts above that bound are guaranteed to be
+/// present, which is exactly the "who is hot" question - memory stays fixed
+/// no matter the stream's cardinality.
+///
+/// Entries are kept sorted by count, heaviest first, so eviction of the
+/// minimum is O(1) and reading the top-k is a prefix copy. Not thread or
+/// shard safe; intended as a shard-local structure.
+template<
+  typename Key,
+  typename Hash = std::hash<Key>,
+  typename Eq = std::equal_to<Key>>
+class space_saving {
+public:
+    struct entry {
+        Key key;
+        uint64_t count{0};
+        /// upper bound on how much of count may belong to keys that
+        /// previously occupied this slot
+        uint64_t error{0};
+    };
+
+    explicit space_saving(size_t capacity)
+      : _capacity(capacity) {}
+
+    void record(const Key& key, uint64_t weight = 1) {
+        if (auto it = _index.find(key); it != _index.end()) {
+            _entries[it->second].count += weight;
+            promote(it->second);
+            return;
+        }
+        if (_entries.size() < _capacity) {
+            _entries.push_back(entry{.key = key, .count = weight});
+            promote(_entries.size() - 1);
+            return;
+        }
+        // replace the current minimum; its count becomes the new key's
+        // error bound
+        auto& min = _entries.back();
+        _index.erase(min.key);
+        min.error = min.count;
+        min.count += weight;
+        min.key = key;
+        promote(_entries.size() - 1);
+    }
+
+    /// tracked entries, sorted by count descending
+    const std::vector<entry>& entries() const { return _entries; }
+
+    size_t capacity() const { return _capacity; }
+    size_t size() const { return _entries.size(); }
+
+private:
+    /// restore the descending count order after _entries[i] grew, fixing
+    /// up the index of every entry that moves
+    void promote(size_t i) {
+        while (i > 0 && _entries[i - 1].count < _entries[i].count) {
+            std::swap(_entries[i - 1], _entries[i]);
+            _index[_entries[i].key] = i;
+            --i;
+        }
+        _index[_entries[i].key] = i;
+    }
+
+    size_t _capacity;
+    std::vector<entry> _entries;
+    absl::flat_hash_map<Key, size_t, Hash, Eq> _index;
+};
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2020 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+/// A frozen string -> value map built entirely at compile time, a drop-in
+/// replacement for string_switch chains on hot paths.
+///
+/// string_switch compares the input against every case in order. Here the
+/// cases are sorted at compile time by a (length, first byte) discriminator;
+/// a lookup computes the discriminator, binary searches it, and only then
+/// does a full comparison. For realistic case sets the discriminator is
+/// unique, so a hit costs one string compare and a miss usually none.
+///
+/// \code
+/// static constexpr auto colors = make_static_string_map<color>({
+///   {"red", color::red},
+///   {"green", color::green},
+///   {"blue", color::blue},
+/// });
+/// auto c = colors.find_or(name, color::unknown);
+/// \endcode
+template<typename T, size_t N>
+class static_string_map {
+public:
+    using entry = std::pair<std::string_view, T>;
+
+    constexpr explicit static_string_map(std::array<entry, N> entries)
+      : _entries(entries) {
+        // insertion sort; N is a handful of cases and this keeps the
+        // constructor constexpr without depending on constexpr std::sort
+        for (size_t i = 1; i < N; ++i) {
+            for (size_t j = i;
+                 j > 0
+                 && discriminator(_entries[j].first)
+                      < discriminator(_entries[j - 1].first);
+                 --j) {
+                std::swap(_entries[j], _entries[j - 1]);
+            }
+        }
+    }
+
+    constexpr std::optional<T> find(std::string_view s) const {
+        if (s.empty()) {
+            return std::nullopt;
+        }
+        const auto d = discriminator(s);
+        size_t lo = 0;
+        size_t hi = N;
+        while (lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+            if (discriminator(_entries[mid].first) < d) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        for (; lo < N && discriminator(_entries[lo].first) == d; ++lo) {
+            if (_entries[lo].first == s) {
+                return _entries[lo].second;
+            }
+        }
+        return std::nullopt;
+    }
+
+    constexpr T find_or(std::string_view s, T fallback) const {
+        if (auto r = find(s); r) {
+            return *r;
+        }
+        return fallback;
+    }
+
+    /// throws on a miss, mirroring string_switch falling off the end
+    constexpr T at(std::string_view s) const {
+        if (auto r = find(s); r) {
+            return *r;
+        }
+        throw std::runtime_error("Fell off the end of a string-switch");
+    }
+
+private:
+    static constexpr uint64_t discriminator(std::string_view s) {
+        return (uint64_t(s.size()) << 8) | uint8_t(s.front());
+    }
+
+    std::array<entry, N> _entries;
+};
+
+template<typename T, size_t N>
+constexpr static_string_map<T, N>
+make_static_string_map(const std::pair<std::string_view, T> (&entries)[N]) {
+    std::array<std::pair<std::string_view, T>, N> arr{};
+    for (size_t i = 0; i < N; ++i) {
+        arr[i] = entries[i];
+    }
+    return static_string_map<T, N>(arr);
+}
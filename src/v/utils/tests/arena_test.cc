@@ -0,0 +1,70 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/arena.h"
+
+#define BOOST_TEST_MODULE utils
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(arena_bump_allocation) {
+    arena a(1024 * 1024, 1024);
+    auto* p0 = a.allocate(100, 8);
+    auto* p1 = a.allocate(100, 8);
+    BOOST_REQUIRE(p0 != nullptr);
+    BOOST_REQUIRE(p1 != nullptr);
+    BOOST_REQUIRE(a.owns(p0));
+    BOOST_REQUIRE(a.owns(p1));
+    // both fit the first block
+    BOOST_REQUIRE_EQUAL(a.allocated_bytes(), 1024);
+    // an oversized request gets its own block
+    auto* big = a.allocate(4096, 8);
+    BOOST_REQUIRE(a.owns(big));
+    BOOST_REQUIRE_EQUAL(a.allocated_bytes(), 1024 + 4096);
+}
+
+BOOST_AUTO_TEST_CASE(arena_reset_retains_one_block) {
+    arena a(1024 * 1024, 1024);
+    a.allocate(1000, 8);
+    a.allocate(1000, 8);
+    BOOST_REQUIRE_EQUAL(a.allocated_bytes(), 2048);
+    a.reset();
+    BOOST_REQUIRE_EQUAL(a.allocated_bytes(), 1024);
+    // the retained block is rewound and reusable
+    auto* p = a.allocate(1000, 8);
+    BOOST_REQUIRE(a.owns(p));
+    BOOST_REQUIRE_EQUAL(a.allocated_bytes(), 1024);
+}
+
+BOOST_AUTO_TEST_CASE(arena_budget) {
+    arena a(1024, 1024);
+    BOOST_REQUIRE(!a.over_budget());
+    a.allocate(100, 8);
+    BOOST_REQUIRE(a.over_budget());
+    // over budget the allocator adapter falls back to the heap and frees
+    // through it
+    arena_allocator<int> alloc(a);
+    auto* p = alloc.allocate(10);
+    BOOST_REQUIRE(!a.owns(p));
+    alloc.deallocate(p, 10);
+}
+
+BOOST_AUTO_TEST_CASE(arena_vector_roundtrip) {
+    arena a(1024 * 1024);
+    arena_vector<int> v{arena_allocator<int>(a)};
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    BOOST_REQUIRE(a.owns(v.data()));
+    for (int i = 0; i < 1000; ++i) {
+        BOOST_REQUIRE_EQUAL(v[i], i);
+    }
+    auto moved = std::move(v);
+    BOOST_REQUIRE_EQUAL(moved.size(), 1000);
+    BOOST_REQUIRE(a.owns(moved.data()));
+}
@@ -0,0 +1,51 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/async_logger.h"
+#include "vlog.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+static ss::logger test_sink{"async_logger_test"};
+
+SEASTAR_THREAD_TEST_CASE(flushes_buffered_records_on_stop) {
+    utils::async_logger alog(test_sink);
+    alog.start().get();
+    for (int i = 0; i < 100; ++i) {
+        vlog(alog.info, "record {}", i);
+    }
+    alog.stop().get();
+    BOOST_REQUIRE_EQUAL(alog.buffered(), 0);
+    BOOST_REQUIRE_EQUAL(alog.dropped(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(overflow_drops_and_counts) {
+    // not started, so nothing drains while we fill the buffer
+    utils::async_logger alog(test_sink, 4);
+    for (int i = 0; i < 10; ++i) {
+        vlog(alog.info, "record {}", i);
+    }
+    BOOST_REQUIRE_EQUAL(alog.buffered(), 4);
+    BOOST_REQUIRE_EQUAL(alog.dropped(), 6);
+    alog.start().get();
+    alog.stop().get();
+    BOOST_REQUIRE_EQUAL(alog.buffered(), 0);
+    // the drop count survives the flush
+    BOOST_REQUIRE_EQUAL(alog.dropped(), 6);
+}
+
+SEASTAR_THREAD_TEST_CASE(disabled_level_is_a_noop) {
+    utils::async_logger alog(test_sink, 4);
+    BOOST_REQUIRE(!test_sink.is_enabled(ss::log_level::trace));
+    for (int i = 0; i < 10; ++i) {
+        vlog(alog.trace, "record {}", i);
+    }
+    BOOST_REQUIRE_EQUAL(alog.buffered(), 0);
+    BOOST_REQUIRE_EQUAL(alog.dropped(), 0);
+}
@@ -49,3 +49,14 @@ BOOST_AUTO_TEST_CASE(iobuf_type) {
     auto decoded = base64_to_bytes(encoded);
     BOOST_REQUIRE_EQUAL(decoded, iobuf_to_bytes(buf));
 }
+
+BOOST_AUTO_TEST_CASE(decode_to_iobuf) {
+    BOOST_REQUIRE_EQUAL(base64_to_iobuf("").size_bytes(), 0);
+
+    auto decoded = base64_to_iobuf("dGhpcyBpcyBhIHN0cmluZw==");
+    BOOST_REQUIRE_EQUAL(iobuf_to_bytes(decoded), bytes("this is a string"));
+
+    auto data = random_generators::get_bytes(4096);
+    auto roundtrip = base64_to_iobuf(bytes_to_base64(data));
+    BOOST_REQUIRE_EQUAL(iobuf_to_bytes(roundtrip), data);
+}
@@ -0,0 +1,32 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/cached_clock.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals; // NOLINT
+
+SEASTAR_THREAD_TEST_CASE(cached_clock_stable_within_task) {
+    auto a = cached_clock::now();
+    auto b = cached_clock::now();
+    BOOST_REQUIRE(a == b);
+}
+
+SEASTAR_THREAD_TEST_CASE(cached_clock_refreshes_across_polls) {
+    auto before = cached_clock::now();
+    ss::sleep(100ms).get();
+    auto after = cached_clock::now();
+    BOOST_REQUIRE(after > before);
+    // the cached value trails the underlying clock by at most one poll
+    BOOST_REQUIRE(cached_clock::base_clock::now() - after < 100ms);
+}
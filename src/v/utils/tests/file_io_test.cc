@@ -0,0 +1,79 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "bytes/iobuf_parser.h"
+#include "random/generators.h"
+#include "utils/file_io.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+static iobuf make_buf(size_t size) {
+    auto data = random_generators::gen_alphanum_string(size);
+    iobuf buf;
+    buf.append(data.data(), data.size());
+    return buf;
+}
+
+static void check_roundtrip(size_t size) {
+    auto path = std::filesystem::path(
+      "test.file_io_" + random_generators::gen_alphanum_string(4));
+    auto expected = make_buf(size);
+    write_fully(path, expected.copy()).get();
+
+    auto actual = read_fully(path).get0();
+    BOOST_REQUIRE_EQUAL(actual, expected);
+
+    auto tmpbuf = read_fully_tmpbuf(path).get0();
+    iobuf from_tmpbuf;
+    from_tmpbuf.append(std::move(tmpbuf));
+    BOOST_REQUIRE_EQUAL(from_tmpbuf, expected);
+
+    auto stream = read_as_stream(path).get0();
+    iobuf streamed;
+    while (!stream.eof()) {
+        streamed.append(stream.read().get0());
+    }
+    stream.close().get();
+    BOOST_REQUIRE_EQUAL(streamed, expected);
+}
+
+SEASTAR_THREAD_TEST_CASE(roundtrip_empty_file) { check_roundtrip(0); }
+
+SEASTAR_THREAD_TEST_CASE(roundtrip_unaligned_small_file) {
+    check_roundtrip(100);
+}
+
+SEASTAR_THREAD_TEST_CASE(roundtrip_one_buffer) {
+    check_roundtrip(file_io_buffer_pool::buffer_size);
+}
+
+SEASTAR_THREAD_TEST_CASE(roundtrip_multiple_io_windows) {
+    // more than max_io_vectors buffers, with an unaligned tail
+    check_roundtrip(10 * file_io_buffer_pool::buffer_size + 4097);
+}
+
+SEASTAR_THREAD_TEST_CASE(buffers_are_recycled) {
+    auto path = std::filesystem::path(
+      "test.file_io_" + random_generators::gen_alphanum_string(4));
+    write_fully(path, make_buf(2 * file_io_buffer_pool::buffer_size)).get();
+    {
+        auto buf = read_fully(path).get0();
+        BOOST_REQUIRE_EQUAL(
+          buf.size_bytes(), 2 * file_io_buffer_pool::buffer_size);
+    }
+    // the iobuf went away, its fragments' storage is back in the pool
+    auto& pool = file_io_buffer_pool::local();
+    BOOST_REQUIRE_GE(pool.idle(), 2);
+    const auto idle_before = pool.idle();
+    auto b = pool.get();
+    BOOST_REQUIRE_EQUAL(pool.idle(), idle_before - 1);
+    b = {};
+    BOOST_REQUIRE_EQUAL(pool.idle(), idle_before);
+}
@@ -0,0 +1,40 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/hdr_hist.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+SEASTAR_THREAD_TEST_CASE(hdr_hist_fold_test) {
+    hdr_hist h;
+    for (uint64_t v = 1; v <= 1000; ++v) {
+        h.record(v);
+    }
+    // the getters fold the fast buckets into the hdr histogram; the fast
+    // path only keeps 3 bits of sub-bucket precision so allow for that
+    auto hist = h.seastar_histogram_logform();
+    BOOST_CHECK_EQUAL(hist.sample_count, 1000);
+    BOOST_CHECK_EQUAL(hist.sample_sum, 500500);
+    BOOST_CHECK_CLOSE(h.mean(), 500.5, 15.0);
+    auto p50 = h.get_value_at(50.0);
+    BOOST_CHECK(p50 > 400 && p50 < 600);
+    BOOST_CHECK(h.get_value_at(100.0) >= 900);
+}
+
+SEASTAR_THREAD_TEST_CASE(hdr_hist_add_test) {
+    hdr_hist a;
+    hdr_hist b;
+    a.record_multiple_times(10, 100);
+    b.record_multiple_times(1000, 100);
+    a += b;
+    auto p99 = a.get_value_at(99.0);
+    BOOST_CHECK(p99 >= 900);
+    auto p10 = a.get_value_at(10.0);
+    BOOST_CHECK(p10 <= 12);
+}
@@ -0,0 +1,77 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE utils
+#include "utils/space_saving.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+BOOST_AUTO_TEST_CASE(space_saving_exact_below_capacity) {
+    space_saving<std::string> sketch(4);
+    sketch.record("a", 10);
+    sketch.record("b", 5);
+    sketch.record("a", 1);
+    sketch.record("c", 7);
+
+    const auto& e = sketch.entries();
+    BOOST_REQUIRE_EQUAL(e.size(), 3);
+    BOOST_REQUIRE_EQUAL(e[0].key, "a");
+    BOOST_REQUIRE_EQUAL(e[0].count, 11);
+    BOOST_REQUIRE_EQUAL(e[0].error, 0);
+    BOOST_REQUIRE_EQUAL(e[1].key, "c");
+    BOOST_REQUIRE_EQUAL(e[1].count, 7);
+    BOOST_REQUIRE_EQUAL(e[2].key, "b");
+    BOOST_REQUIRE_EQUAL(e[2].count, 5);
+}
+
+BOOST_AUTO_TEST_CASE(space_saving_eviction_inherits_min_count) {
+    space_saving<std::string> sketch(2);
+    sketch.record("a", 10);
+    sketch.record("b", 3);
+    // "c" evicts the minimum "b" and inherits its count as error
+    sketch.record("c", 1);
+
+    const auto& e = sketch.entries();
+    BOOST_REQUIRE_EQUAL(e.size(), 2);
+    BOOST_REQUIRE_EQUAL(e[0].key, "a");
+    BOOST_REQUIRE_EQUAL(e[1].key, "c");
+    BOOST_REQUIRE_EQUAL(e[1].count, 4);
+    BOOST_REQUIRE_EQUAL(e[1].error, 3);
+}
+
+BOOST_AUTO_TEST_CASE(space_saving_heavy_hitters_survive_churn) {
+    space_saving<int> sketch(8);
+    // two heavy keys mixed into a long tail of singletons
+    for (int i = 0; i < 10000; ++i) {
+        sketch.record(-1, 10);
+        sketch.record(-2, 5);
+        sketch.record(i);
+    }
+
+    const auto& e = sketch.entries();
+    BOOST_REQUIRE_EQUAL(e[0].key, -1);
+    BOOST_REQUIRE_GE(e[0].count, 100000);
+    BOOST_REQUIRE_EQUAL(e[1].key, -2);
+    BOOST_REQUIRE_GE(e[1].count, 50000);
+    // a tracked count never underestimates by more than the error bound
+    BOOST_REQUIRE_LE(e[0].error, e[0].count);
+}
+
+BOOST_AUTO_TEST_CASE(space_saving_order_is_maintained) {
+    space_saving<int> sketch(16);
+    for (int i = 0; i < 1000; ++i) {
+        sketch.record(i % 16, static_cast<uint64_t>(i % 7) + 1);
+    }
+    const auto& e = sketch.entries();
+    for (size_t i = 1; i < e.size(); ++i) {
+        BOOST_REQUIRE_GE(e[i - 1].count, e[i].count);
+    }
+}
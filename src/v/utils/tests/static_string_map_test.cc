@@ -0,0 +1,49 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE utils
+
+#include "utils/static_string_map.h"
+
+#include <boost/test/unit_test.hpp>
+
+static constexpr auto numbers = make_static_string_map<int>({
+  {"one", 1},
+  {"two", 2},
+  {"three", 3},
+});
+
+BOOST_AUTO_TEST_CASE(static_string_map_constexpr_lookup) {
+    constexpr int one = numbers.at("one");
+    BOOST_CHECK_EQUAL(one, 1);
+    constexpr int none = numbers.find_or("none", 0);
+    BOOST_CHECK_EQUAL(none, 0);
+}
+
+BOOST_AUTO_TEST_CASE(static_string_map_runtime_lookup) {
+    BOOST_CHECK_EQUAL(numbers.at("two"), 2);
+    BOOST_CHECK_EQUAL(numbers.at("three"), 3);
+    BOOST_CHECK(!numbers.find("four"));
+    BOOST_CHECK(!numbers.find(""));
+    BOOST_CHECK_THROW(numbers.at("four"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(static_string_map_discriminator_collisions) {
+    // "alpha" and "amiga" share length and first byte, so the lookup has
+    // to fall through to the full comparison
+    static constexpr auto collisions = make_static_string_map<int>({
+      {"alpha", 1},
+      {"amiga", 2},
+      {"aroma", 3},
+    });
+    BOOST_CHECK_EQUAL(collisions.at("alpha"), 1);
+    BOOST_CHECK_EQUAL(collisions.at("amiga"), 2);
+    BOOST_CHECK_EQUAL(collisions.at("aroma"), 3);
+    BOOST_CHECK(!collisions.find("abcde"));
+}
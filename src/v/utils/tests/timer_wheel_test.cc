@@ -0,0 +1,79 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/timer_wheel.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals; // NOLINT
+
+SEASTAR_THREAD_TEST_CASE(timer_wheel_fires_in_deadline_order) {
+    timer_wheel<> wheel(10ms);
+    timer_wheel<>::entry e1;
+    timer_wheel<>::entry e2;
+    std::vector<int> fired;
+    e1.set_callback([&fired] { fired.push_back(1); });
+    e2.set_callback([&fired] { fired.push_back(2); });
+    auto now = ss::lowres_clock::now();
+    wheel.arm(e2, now + 100ms);
+    wheel.arm(e1, now + 30ms);
+    BOOST_REQUIRE(e1.armed());
+    BOOST_REQUIRE(e2.armed());
+    ss::sleep(300ms).get();
+    BOOST_REQUIRE_EQUAL(fired.size(), 2);
+    BOOST_REQUIRE_EQUAL(fired[0], 1);
+    BOOST_REQUIRE_EQUAL(fired[1], 2);
+    BOOST_REQUIRE(!e1.armed());
+    BOOST_REQUIRE(wheel.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(timer_wheel_cancel) {
+    timer_wheel<> wheel(10ms);
+    bool fired = false;
+    timer_wheel<>::entry e;
+    e.set_callback([&fired] { fired = true; });
+    wheel.arm(e, ss::lowres_clock::now() + 30ms);
+    e.cancel();
+    BOOST_REQUIRE(!e.armed());
+    ss::sleep(100ms).get();
+    BOOST_REQUIRE(!fired);
+    // entries destroyed while armed cancel implicitly
+    {
+        timer_wheel<>::entry scoped;
+        scoped.set_callback([&fired] { fired = true; });
+        wheel.arm(scoped, ss::lowres_clock::now() + 30ms);
+    }
+    ss::sleep(100ms).get();
+    BOOST_REQUIRE(!fired);
+    BOOST_REQUIRE(wheel.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(timer_wheel_rearm) {
+    timer_wheel<> wheel(10ms);
+    int fired = 0;
+    timer_wheel<>::entry e;
+    e.set_callback([&fired] { fired++; });
+    // rearming replaces the previous deadline, mirroring the heartbeat
+    // refresh pattern
+    for (int i = 0; i < 5; ++i) {
+        wheel.arm(e, ss::lowres_clock::now() + 50ms);
+        ss::sleep(10ms).get();
+    }
+    ss::sleep(200ms).get();
+    BOOST_REQUIRE_EQUAL(fired, 1);
+    // a deadline in the past still fires, on the next tick. the callback
+    // was consumed by the first expiration so it is set again
+    e.set_callback([&fired] { fired++; });
+    wheel.arm(e, ss::lowres_clock::now() - 10ms);
+    ss::sleep(100ms).get();
+    BOOST_REQUIRE_EQUAL(fired, 2);
+}
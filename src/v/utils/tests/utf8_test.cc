@@ -0,0 +1,71 @@
+// Copyright 2020 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE utils
+#include "utils/utf8.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(utf8_accepts_ascii) {
+    BOOST_REQUIRE(is_valid_utf8(""));
+    BOOST_REQUIRE(is_valid_utf8("plain ascii topic-name_42"));
+    // longer than the word-at-a-time fast path stride
+    BOOST_REQUIRE(is_valid_utf8(std::string(1024, 'x')));
+}
+
+BOOST_AUTO_TEST_CASE(utf8_accepts_multibyte) {
+    BOOST_REQUIRE(is_valid_utf8("\xc3\xa9"));             // e acute
+    BOOST_REQUIRE(is_valid_utf8("\xe6\x97\xa5\xe6\x9c\xac")); // CJK
+    BOOST_REQUIRE(is_valid_utf8("\xf0\x9f\x98\x80"));     // emoji
+    BOOST_REQUIRE(is_valid_utf8("mixed \xc3\xa9 ascii"));
+}
+
+BOOST_AUTO_TEST_CASE(utf8_rejects_malformed) {
+    // lone continuation byte
+    BOOST_REQUIRE(!is_valid_utf8("\x80"));
+    // missing continuation byte
+    BOOST_REQUIRE(!is_valid_utf8("\xc3 "));
+    // overlong encoding of '/'
+    BOOST_REQUIRE(!is_valid_utf8("\xc0\xaf"));
+    // utf-16 surrogate half
+    BOOST_REQUIRE(!is_valid_utf8("\xed\xa0\x80"));
+    // above U+10FFFF
+    BOOST_REQUIRE(!is_valid_utf8("\xf4\x90\x80\x80"));
+    // truncated sequence at end of input
+    BOOST_REQUIRE(!is_valid_utf8("abc\xe6\x97"));
+}
+
+BOOST_AUTO_TEST_CASE(utf8_streaming_across_chunks) {
+    // a code point split between chunks must still validate
+    utf8_validator v;
+    BOOST_REQUIRE(v.add("abc\xe6", 4));
+    BOOST_REQUIRE(!v.done());
+    BOOST_REQUIRE(v.add("\x97\xa5", 2));
+    BOOST_REQUIRE(v.done());
+
+    utf8_validator bad;
+    BOOST_REQUIRE(bad.add("\xe6\x97", 2));
+    BOOST_REQUIRE(!bad.add("x", 1));
+}
+
+BOOST_AUTO_TEST_CASE(utf8_validates_fragmented_iobuf) {
+    iobuf buf;
+    buf.append("abc\xe6", 4);
+    buf.append("\x97\xa5", 2);
+    BOOST_REQUIRE_NO_THROW(validate_utf8(buf));
+
+    iobuf bad;
+    bad.append("abc\xe6", 4);
+    BOOST_REQUIRE_THROW(validate_utf8(bad), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(utf8_thrower_invoked) {
+    BOOST_REQUIRE_THROW(validate_utf8("\xff"), std::runtime_error);
+    BOOST_REQUIRE_NO_THROW(validate_utf8("ok"));
+}
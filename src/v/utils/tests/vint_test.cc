@@ -17,6 +17,7 @@
 #include <array>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <random>
 
 namespace {
@@ -36,3 +37,29 @@ void check_roundtrip_sweep(int64_t count) {
 SEASTAR_THREAD_TEST_CASE(sanity_signed_sweep_64) {
     check_roundtrip_sweep(100000000);
 }
+
+SEASTAR_THREAD_TEST_CASE(contiguous_decoder_matches_iterator_decoder) {
+    for (int64_t i = -100000000; i < 100000000; i += 100000) {
+        const auto b = vint::to_bytes(i);
+        const auto [deserialized, sz] = vint::deserialize(
+          // NOLINTNEXTLINE
+          reinterpret_cast<const char*>(b.data()),
+          b.size());
+        BOOST_REQUIRE_EQUAL(deserialized, i);
+        BOOST_REQUIRE_EQUAL(sz, b.size());
+    }
+    // boundary values exercising every encoded length
+    for (auto i : {
+           int64_t(0),
+           int64_t(-1),
+           std::numeric_limits<int64_t>::min(),
+           std::numeric_limits<int64_t>::max()}) {
+        const auto b = vint::to_bytes(i);
+        const auto [deserialized, sz] = vint::deserialize(
+          // NOLINTNEXTLINE
+          reinterpret_cast<const char*>(b.data()),
+          b.size());
+        BOOST_REQUIRE_EQUAL(deserialized, i);
+        BOOST_REQUIRE_EQUAL(sz, b.size());
+    }
+}
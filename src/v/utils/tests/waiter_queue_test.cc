@@ -0,0 +1,95 @@
+// Copyright 2021 Vectorized, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/waiter_queue.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+using namespace std::chrono_literals;
+
+enum class result { pending, done, timed_out, stopped };
+
+using queue_t = waiter_queue<int, result, ss::lowres_clock>;
+
+static constexpr auto no_timeout = ss::lowres_clock::time_point::max();
+
+SEASTAR_THREAD_TEST_CASE(notify_fulfils_at_or_below_key) {
+    queue_t queue;
+    queue_t::waiter w5;
+    queue_t::waiter w10;
+    queue_t::waiter w20;
+    auto f5 = queue.wait(w5, 5, no_timeout, result::timed_out);
+    auto f10 = queue.wait(w10, 10, no_timeout, result::timed_out);
+    auto f20 = queue.wait(w20, 20, no_timeout, result::timed_out);
+
+    queue.notify(10, result::done);
+    BOOST_REQUIRE_EQUAL(f5.get0(), result::done);
+    BOOST_REQUIRE_EQUAL(f10.get0(), result::done);
+    BOOST_REQUIRE(!f20.available());
+    BOOST_REQUIRE(!queue.empty());
+
+    queue.notify(20, result::done);
+    BOOST_REQUIRE_EQUAL(f20.get0(), result::done);
+    BOOST_REQUIRE(queue.empty());
+}
+
+SEASTAR_THREAD_TEST_CASE(keys_registered_out_of_order) {
+    queue_t queue;
+    queue_t::waiter w3;
+    queue_t::waiter w1;
+    queue_t::waiter w2;
+    auto f3 = queue.wait(w3, 3, no_timeout, result::timed_out);
+    auto f1 = queue.wait(w1, 1, no_timeout, result::timed_out);
+    auto f2 = queue.wait(w2, 2, no_timeout, result::timed_out);
+
+    queue.notify(1, result::done);
+    BOOST_REQUIRE_EQUAL(f1.get0(), result::done);
+    BOOST_REQUIRE(!f2.available());
+    BOOST_REQUIRE(!f3.available());
+    queue.stop(result::stopped);
+    BOOST_REQUIRE_EQUAL(f2.get0(), result::stopped);
+    BOOST_REQUIRE_EQUAL(f3.get0(), result::stopped);
+}
+
+SEASTAR_THREAD_TEST_CASE(timeout_unlinks_the_waiter) {
+    queue_t queue;
+    queue_t::waiter w;
+    auto f = queue.wait(
+      w, 10, ss::lowres_clock::now() + 10ms, result::timed_out);
+    BOOST_REQUIRE_EQUAL(f.get0(), result::timed_out);
+    BOOST_REQUIRE(queue.empty());
+    // a late notification finds nothing to wake
+    queue.notify(10, result::done);
+}
+
+SEASTAR_THREAD_TEST_CASE(notify_before_timeout_cancels_the_timer) {
+    queue_t queue;
+    queue_t::waiter w;
+    auto f = queue.wait(w, 10, ss::lowres_clock::now() + 1s, result::timed_out);
+    queue.notify(10, result::done);
+    BOOST_REQUIRE_EQUAL(f.get0(), result::done);
+    ss::sleep(20ms).get();
+}
+
+SEASTAR_THREAD_TEST_CASE(destroyed_waiter_unlinks_itself) {
+    queue_t queue;
+    ss::future<result> f = ss::make_ready_future<result>(result::pending);
+    {
+        queue_t::waiter w;
+        f = queue.wait(w, 10, no_timeout, result::timed_out);
+        BOOST_REQUIRE(!queue.empty());
+    }
+    BOOST_REQUIRE(queue.empty());
+    // a late notification finds nothing to wake, the abandoned future
+    // reports the broken promise
+    queue.notify(10, result::done);
+    BOOST_REQUIRE_THROW(f.get0(), ss::broken_promise);
+}
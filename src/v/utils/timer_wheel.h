@@ -0,0 +1,170 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <boost/intrusive/list.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+/**
+ * A hashed timer wheel for large sets of coarse timeouts.
+ *
+ * One seastar timer drives the whole wheel, so arming per-entity
+ * deadlines is an O(1) list insert and cancel is an O(1) unlink - no
+ * reactor timer churn per entity. Deadlines are quantized to the wheel's
+ * tick: a callback fires no earlier than its deadline and at most one
+ * tick late, which is the right trade for things like session timeouts
+ * where thousands of timers are armed and rearmed on every heartbeat.
+ *
+ * Entries hold an auto-unlinking hook, so destroying an armed entry
+ * cancels it implicitly. The wheel must outlive its entries' armed
+ * lifetime; entries are neither copyable nor movable while armed.
+ */
+template<typename Clock = ss::lowres_clock>
+class timer_wheel {
+public:
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    static constexpr size_t default_buckets = 512;
+
+    class entry {
+    public:
+        entry() noexcept = default;
+        entry(const entry&) = delete;
+        entry& operator=(const entry&) = delete;
+        entry(entry&&) = delete;
+        entry& operator=(entry&&) = delete;
+        ~entry() noexcept { cancel(); }
+
+        /// the callback is consumed when the entry fires; it must be set
+        /// again before rearming a fired entry
+        void set_callback(ss::noncopyable_function<void()> cb) {
+            _callback = std::move(cb);
+        }
+
+        bool armed() const { return _hook.is_linked(); }
+
+        void cancel() {
+            if (_hook.is_linked()) {
+                _hook.unlink();
+            }
+        }
+
+    private:
+        friend class timer_wheel;
+
+        time_point _deadline;
+        ss::noncopyable_function<void()> _callback;
+        boost::intrusive::list_member_hook<
+          boost::intrusive::link_mode<boost::intrusive::auto_unlink>>
+          _hook;
+    };
+
+    explicit timer_wheel(
+      duration tick = std::chrono::milliseconds(100),
+      size_t buckets = default_buckets)
+      : _tick(tick)
+      , _buckets(buckets) {
+        _driver.set_callback([this] { sweep(); });
+    }
+    timer_wheel(const timer_wheel&) = delete;
+    timer_wheel& operator=(const timer_wheel&) = delete;
+    timer_wheel(timer_wheel&&) = delete;
+    timer_wheel& operator=(timer_wheel&&) = delete;
+    ~timer_wheel() noexcept = default;
+
+    /// (re)arm an entry to fire its callback at the deadline. the entry
+    /// must stay alive while armed
+    void arm(entry& e, time_point deadline) {
+        e.cancel();
+        if (!_driver.armed()) {
+            _last_tick = tick_of(Clock::now());
+            _driver.arm_periodic(_tick);
+        }
+        e._deadline = deadline;
+        // a deadline in the current or a past tick would land in a bucket
+        // that was already swept this rotation; push it to the next sweep
+        const auto t = std::max(tick_of(deadline), _last_tick + 1);
+        _buckets[t % _buckets.size()].push_back(e);
+    }
+
+    bool empty() const {
+        return std::all_of(
+          _buckets.begin(), _buckets.end(), [](const bucket_t& b) {
+              return b.empty();
+          });
+    }
+
+private:
+    using bucket_t = boost::intrusive::list<
+      entry,
+      boost::intrusive::member_hook<
+        entry,
+        boost::intrusive::list_member_hook<
+          boost::intrusive::link_mode<boost::intrusive::auto_unlink>>,
+        &entry::_hook>,
+      boost::intrusive::constant_time_size<false>>;
+
+    uint64_t tick_of(time_point t) const {
+        return t.time_since_epoch() / _tick;
+    }
+
+    void sweep() {
+        const auto now_tick = tick_of(Clock::now());
+        // after an idle period or a reactor stall, visit each bucket at
+        // most once per sweep
+        const auto behind = now_tick - _last_tick;
+        const auto start = behind >= _buckets.size()
+                             ? now_tick - _buckets.size() + 1
+                             : _last_tick + 1;
+        bucket_t due;
+        for (auto t = start; t <= now_tick; ++t) {
+            auto& b = _buckets[t % _buckets.size()];
+            for (auto it = b.begin(); it != b.end();) {
+                auto& e = *it;
+                ++it;
+                if (tick_of(e._deadline) <= now_tick) {
+                    e._hook.unlink();
+                    due.push_back(e);
+                }
+            }
+        }
+        _last_tick = now_tick;
+        // pop before invoking: a callback may cancel (unlink) other due
+        // entries or rearm itself. the callback is moved out first so a
+        // callback that destroys its own entry (e.g. by dropping the last
+        // reference to the owning object) stays safe to run
+        while (!due.empty()) {
+            auto& e = due.front();
+            due.pop_front();
+            auto cb = std::move(e._callback);
+            cb();
+        }
+        if (empty()) {
+            _driver.cancel();
+        }
+    }
+
+    duration _tick;
+    std::vector<bucket_t> _buckets;
+    uint64_t _last_tick{0};
+    ss::timer<Clock> _driver;
+};
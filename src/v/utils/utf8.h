@@ -11,8 +11,13 @@
 
 #pragma once
 
-#include <boost/locale/encoding_utf.hpp>
+#include "bytes/iobuf.h"
+#include "likely.h"
+#include "utils/concepts-enabled.h"
 
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <string_view>
 
 // clang-format off
@@ -32,13 +37,99 @@ struct default_thrower {
 };
 } // namespace
 
+namespace utf8_detail {
+
+/*
+ * Table driven utf-8 DFA. Each input byte is mapped to a character class
+ * and the class indexes a state transition table; a byte never costs more
+ * than two loads and there are no branches on the byte value. State 0
+ * accepts, state 12 rejects, anything else is in the middle of a
+ * multi-byte sequence. Overlong encodings, surrogates and code points
+ * above U+10FFFF all transition to reject.
+ */
+inline constexpr uint8_t accept = 0;
+inline constexpr uint8_t reject = 12;
+
+// clang-format off
+inline constexpr std::array<uint8_t, 256> byte_class = {{
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 00..1f
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 20..3f
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 40..5f
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, // 60..7f
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9, // 80..9f
+  7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, 7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, // a0..bf
+  8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, // c0..df
+  10,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3,                                 // e0..ef
+  11,6,6,6,5,8,8,8,8,8,8,8,8,8,8,8,                                 // f0..ff
+}};
+
+inline constexpr std::array<uint8_t, 108> transition = {{
+   0,12,24,36,60,96,84,12,12,12,48,72, // state  0: accept
+  12,12,12,12,12,12,12,12,12,12,12,12, // state 12: reject
+  12, 0,12,12,12,12,12, 0,12, 0,12,12, // state 24: one continuation left
+  12,24,12,12,12,12,12,24,12,24,12,12, // state 36: two continuations left
+  12,12,12,12,12,12,12,24,12,12,12,12, // state 48: e0, no overlongs
+  12,24,12,12,12,12,12,12,12,24,12,12, // state 60: ed, no surrogates
+  12,12,12,12,12,12,12,36,12,36,12,12, // state 72: f0, no overlongs
+  12,36,12,12,12,12,12,36,12,36,12,12, // state 84: f1..f3
+  12,36,12,12,12,12,12,12,12,12,12,12, // state 96: f4, <= U+10FFFF
+}};
+// clang-format on
+
+} // namespace utf8_detail
+
+/**
+ * Streaming utf-8 validator. Input may be fed in arbitrary chunks - state
+ * carries across calls, so fragmented buffers are validated without
+ * linearizing them. Protocol strings are almost always plain ascii, so
+ * runs of ascii bytes are checked a word at a time.
+ */
+class utf8_validator {
+public:
+    /// feed a chunk; returns false as soon as the input cannot be utf-8
+    bool add(const char* data, size_t n) noexcept {
+        const auto* p = reinterpret_cast<const uint8_t*>(data); // NOLINT
+        const auto* const end = p + n;
+        while (p != end) {
+            if (_state == utf8_detail::accept) {
+                while (static_cast<size_t>(end - p) >= sizeof(uint64_t)) {
+                    uint64_t w;
+                    std::memcpy(&w, p, sizeof(w));
+                    if (w & 0x8080808080808080ULL) {
+                        break;
+                    }
+                    p += sizeof(w);
+                }
+                if (p == end) {
+                    break;
+                }
+            }
+            _state = utf8_detail::transition
+              [_state + utf8_detail::byte_class[*p]];
+            if (unlikely(_state == utf8_detail::reject)) {
+                return false;
+            }
+            ++p;
+        }
+        return true;
+    }
+
+    /// true when the input seen so far ends on a code point boundary
+    bool done() const noexcept { return _state == utf8_detail::accept; }
+
+private:
+    uint8_t _state{utf8_detail::accept};
+};
+
+inline bool is_valid_utf8(std::string_view s) noexcept {
+    utf8_validator v;
+    return v.add(s.data(), s.size()) && v.done();
+}
+
 template<typename Thrower>
 CONCEPT(requires ExceptionThrower<Thrower>)
 inline void validate_utf8(std::string_view s, Thrower&& thrower) {
-    try {
-        boost::locale::conv::utf_to_utf<char>(
-          s.begin(), s.end(), boost::locale::conv::stop);
-    } catch (const boost::locale::conv::conversion_error& ex) {
+    if (unlikely(!is_valid_utf8(s))) {
         thrower.conversion_error();
     }
 }
@@ -46,3 +137,21 @@ inline void validate_utf8(std::string_view s, Thrower&& thrower) {
 inline void validate_utf8(std::string_view s) {
     validate_utf8(s, default_thrower{});
 }
+
+template<typename Thrower>
+CONCEPT(requires ExceptionThrower<Thrower>)
+inline void validate_utf8(const iobuf& buf, Thrower&& thrower) {
+    utf8_validator v;
+    for (const auto& frag : buf) {
+        if (unlikely(!v.add(frag.get(), frag.size()))) {
+            thrower.conversion_error();
+        }
+    }
+    if (unlikely(!v.done())) {
+        thrower.conversion_error();
+    }
+}
+
+inline void validate_utf8(const iobuf& buf) {
+    validate_utf8(buf, default_thrower{});
+}
@@ -75,6 +75,44 @@ inline bytes to_bytes(int64_t value) noexcept {
     return out;
 }
 
+/// \brief decode from a contiguous buffer. the one and two byte encodings
+/// that dominate record headers (deltas and small lengths) are unrolled and
+/// branch-predicted, mirroring the early exits in serialize() above.
+inline std::pair<int64_t, size_t>
+deserialize(const char* src, size_t size) noexcept {
+    // NOLINTNEXTLINE
+    const auto* p = reinterpret_cast<const uint8_t*>(src);
+    uint64_t result = 0;
+    size_t bytes_read = 0;
+    uint64_t shift = 0;
+    if (likely(size >= 2)) {
+        uint64_t byte = p[0];
+        if (likely(!(byte & 128))) {
+            return {decode_zigzag(byte), 1};
+        }
+        result = byte & 127;
+        byte = p[1];
+        if (likely(!(byte & 128))) {
+            return {decode_zigzag(result | (byte << 7)), 2};
+        }
+        result |= (byte & 127) << 7;
+        bytes_read = 2;
+        shift = 14;
+    }
+    for (; shift <= 63 && bytes_read < size; ++bytes_read) {
+        uint64_t byte = p[bytes_read];
+        if (byte & 128) {
+            result |= ((byte & 127) << shift);
+        } else {
+            result |= byte << shift;
+            ++bytes_read;
+            break;
+        }
+        shift += 7;
+    }
+    return {decode_zigzag(result), bytes_read};
+}
+
 /// \brief almost identical impl to leveldb, made generic for c++
 /// friendliness
 /// https://github.com/google/leveldb/blob/201f52201f/util/coding.cc#L116
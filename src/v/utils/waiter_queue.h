@@ -0,0 +1,121 @@
+/*
+ * Copyright 2021 Vectorized, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "utils/intrusive_list_helpers.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/timer.hh>
+
+#include <iterator>
+
+/**
+ * \brief Intrusive registry of operations waiting on a monotonic key.
+ *
+ * A replacement for promise-per-key maps on paths that see bursts of
+ * thousands of outstanding waits (e.g. batched replicate-and-wait). The
+ * registry itself never allocates: each waiting operation embeds a
+ * waiter_queue::waiter slot and the registry links the slots into a list
+ * sorted by key. Keys typically arrive in increasing order, so the sorted
+ * insert is an O(1) append in the common case.
+ *
+ * notify(key) batch-fulfils every waiter at or below the key, matching
+ * apply loops where the notified key advances monotonically: a waiter can
+ * never be stranded behind a skipped notification.
+ *
+ * Waiter slots must stay alive and in place until their future resolves;
+ * they are pinned (non-movable) and unlink themselves on timeout or
+ * destruction.
+ */
+template<typename Key, typename Result, typename Clock>
+class waiter_queue {
+public:
+    class waiter {
+    public:
+        waiter() = default;
+        waiter(const waiter&) = delete;
+        waiter& operator=(const waiter&) = delete;
+        waiter(waiter&&) = delete;
+        waiter& operator=(waiter&&) = delete;
+        // the auto-unlink hook removes a still-pending slot from the queue
+        ~waiter() = default;
+
+    private:
+        friend waiter_queue;
+
+        Key _key{};
+        ss::promise<Result> _promise;
+        ss::timer<Clock> _timer;
+        intrusive_list_hook _hook;
+    };
+
+    /**
+     * Register the given slot to wait until notify() reaches \p key.
+     * Resolves with \p timeout_result if the timeout fires first.
+     */
+    ss::future<Result> wait(
+      waiter& w,
+      Key key,
+      typename Clock::time_point timeout,
+      Result timeout_result) {
+        w._key = key;
+        if (timeout != Clock::time_point::max()) {
+            w._timer.set_callback([&w, timeout_result] {
+                w._hook.unlink();
+                w._promise.set_value(timeout_result);
+            });
+            w._timer.arm(timeout);
+        }
+        // keep the list sorted; scan from the back because keys mostly
+        // arrive in increasing order
+        auto it = _waiters.end();
+        while (it != _waiters.begin()) {
+            auto prev = std::prev(it);
+            if (prev->_key <= key) {
+                break;
+            }
+            it = prev;
+        }
+        _waiters.insert(it, w);
+        return w._promise.get_future();
+    }
+
+    /**
+     * Fulfil every waiter registered at or below \p key with \p result.
+     */
+    void notify(Key key, Result result) {
+        while (!_waiters.empty() && _waiters.front()._key <= key) {
+            complete(_waiters.front(), result);
+        }
+    }
+
+    /**
+     * Fulfil all remaining waiters with \p result.
+     */
+    void stop(Result result) {
+        while (!_waiters.empty()) {
+            complete(_waiters.front(), result);
+        }
+    }
+
+    bool empty() const { return _waiters.empty(); }
+
+private:
+    void complete(waiter& w, Result result) {
+        w._hook.unlink();
+        w._timer.cancel();
+        w._promise.set_value(result);
+    }
+
+    intrusive_list<waiter, &waiter::_hook> _waiters;
+};
@@ -88,6 +88,13 @@ public:
          default: return nullptr;
        }
     }
+
+    void for_each_method(
+      const ss::noncopyable_function<void(uint32_t, rpc::method*)>& cb) final {
+       {%- for method in methods %}
+       cb({{method.id}}, &_methods[{{loop.index - 1}}]);
+       {%- endfor %}
+    }
     {%- for method in methods %}
     /// \\brief {{method.input_type}} -> {{method.output_type}}
     virtual ss::future<rpc::netbuf>
@@ -162,7 +169,7 @@ public:
     }
     {%- for method in methods %}
     ss::future<> {{method.name}}() {
-        if(is_enabled()) {
+        if constexpr (is_active()) {
           return do_{{method.name}}();
         }
         return ss::make_ready_future<>();